@@ -20,15 +20,8 @@
 #include "best_practices/best_practices_validation.h"
 #include "best_practices/bp_state.h"
 
-struct VendorSpecificInfo {
-    EnableFlags vendor_id;
-    std::string name;
-};
-
-const std::map<BPVendorFlagBits, VendorSpecificInfo> kVendorInfo = {{kBPVendorArm, {vendor_specific_arm, "Arm"}},
-                                                                    {kBPVendorAMD, {vendor_specific_amd, "AMD"}},
-                                                                    {kBPVendorIMG, {vendor_specific_img, "IMG"}},
-                                                                    {kBPVendorNVIDIA, {vendor_specific_nvidia, "NVIDIA"}}};
+const std::map<BPVendorFlagBits, const char*> kVendorNames = {
+    {kBPVendorArm, "Arm"}, {kBPVendorAMD, "AMD"}, {kBPVendorIMG, "IMG"}, {kBPVendorNVIDIA, "NVIDIA"}};
 
 ReadLockGuard BestPractices::ReadLock() const {
     if (fine_grained_locking) {
@@ -57,42 +50,34 @@ bp_state::CommandBuffer::CommandBuffer(BestPractices& bp, VkCommandBuffer handle
                                        const vvl::CommandPool* pool)
     : vvl::CommandBuffer(bp, handle, pCreateInfo, pool) {}
 
-bool BestPractices::VendorCheckEnabled(BPVendorFlags vendors) const {
-    for (const auto& vendor : kVendorInfo) {
-        if (vendors & vendor.first && enabled[vendor.second.vendor_id]) {
-            return true;
-        }
-    }
-    return false;
-}
-
 const char* BestPractices::VendorSpecificTag(BPVendorFlags vendors) const {
-    // Cache built vendor tags in a map
-    static vvl::unordered_map<BPVendorFlags, std::string> tag_map;
-
-    auto res = tag_map.find(vendors);
-    if (res == tag_map.end()) {
-        // Build the vendor tag string
-        std::stringstream vendor_tag;
-
-        vendor_tag << "[";
-        bool first_vendor = true;
-        for (const auto& vendor : kVendorInfo) {
-            if (vendors & vendor.first) {
-                if (!first_vendor) {
-                    vendor_tag << ", ";
+    // The tags of every combination of vendors are built once, so the warnings logged from several threads only read them
+    constexpr BPVendorFlags kAllVendors = kBPVendorArm | kBPVendorAMD | kBPVendorIMG | kBPVendorNVIDIA;
+    static const std::array<std::string, kAllVendors + 1> tags = []() {
+        std::array<std::string, kAllVendors + 1> vendor_tags;
+        for (BPVendorFlags combination = 0; combination <= kAllVendors; ++combination) {
+            // Build the vendor tag string
+            std::stringstream vendor_tag;
+
+            vendor_tag << "[";
+            bool first_vendor = true;
+            for (const auto& vendor : kVendorNames) {
+                if (combination & vendor.first) {
+                    if (!first_vendor) {
+                        vendor_tag << ", ";
+                    }
+                    vendor_tag << vendor.second;
+                    first_vendor = false;
                 }
-                vendor_tag << vendor.second.name;
-                first_vendor = false;
             }
+            vendor_tag << "]";
+            vendor_tags[combination] = vendor_tag.str();
         }
-        vendor_tag << "]";
-
-        tag_map[vendors] = vendor_tag.str();
-        res = tag_map.find(vendors);
-    }
+        return vendor_tags;
+    }();
 
-    return res->second.c_str();
+    assert((vendors & ~kAllVendors) == 0);
+    return tags[vendors & kAllVendors].c_str();
 }
 
 // Despite the return code being successful this can be a useful utility for some developers in niche debugging situation.
@@ -252,6 +252,9 @@ class BestPractices : public ValidationStateTracker {
     void ManualPostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                             const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
                                             const RecordObject& record_obj);
+    uint32_t MemoryTypeHeapIndex(uint32_t memory_type_index) const;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                    const RecordObject& record_obj) override;
     bool ValidateBindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, const Location& loc) const;
     bool PreCallValidateBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset,
                                          const ErrorObject& error_obj) const override;
@@ -464,6 +467,9 @@ class BestPractices : public ValidationStateTracker {
                                        const ErrorObject& error_obj) const override;
     bool ValidateIndexBufferArm(const bp_state::CommandBuffer& cb_state, uint32_t indexCount, uint32_t instanceCount,
                                 uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance, const Location& loc) const;
+    bool ValidateIndexBufferContentsArm(const vvl::Buffer& ib_state, VkIndexType ib_type, bool primitive_restart_enable,
+                                        uint32_t indexCount, uint32_t firstIndex, const Location& loc) const;
+    void DeferIndexBufferValidationArm(vvl::Queue& queue_state, const bp_state::CommandBuffer& cb_state) const;
     void PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
                                      uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                      const RecordObject& record_obj) override;
@@ -810,6 +816,8 @@ class BestPractices : public ValidationStateTracker {
 
     void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                   const RecordObject& record_obj) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
+                                   const RecordObject& record_obj) override;
 
     void PreCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                           const VkClearAttachment* pClearAttachments, uint32_t rectCount, const VkClearRect* pRects,
@@ -869,28 +877,32 @@ class BestPractices : public ValidationStateTracker {
                                                                ShaderModuleUniqueIds* shader_unique_id_map) const final;
 
   private:
-    // CacheEntry and PostTransformLRUCacheModel are used on the stack
-    struct CacheEntry {
-        uint32_t value;
-        uint32_t age;
-    };
-
+    // PostTransformLRUCacheModel is used on the stack, the values and ages are kept apart so looking for a hit is a compare of
+    // one small array
     class PostTransformLRUCacheModel {
       public:
-        typedef std::vector<CacheEntry>::iterator cache_iterator;
-
-        void resize(size_t size);
-
         // Returns true if there was a cache hit - also models LRU behavior which will effect subsequent calls.
         bool query_cache(uint32_t value);
 
       private:
-        std::vector<CacheEntry> _entries = {};
-        uint32_t iteration = 0;
+        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+        // target architecture.
+        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+        static constexpr uint32_t kSize = 32;
+        std::array<uint32_t, kSize> values_{};
+        std::array<uint32_t, kSize> ages_{};
+        uint32_t iteration_ = 0;
     };
 
     // Check that vendor-specific checks are enabled for at least one of the vendors
-    bool VendorCheckEnabled(BPVendorFlags vendors) const;
+    bool VendorCheckEnabled(BPVendorFlags vendors) const {
+        return ((vendors & kBPVendorArm) && enabled[vendor_specific_arm]) ||
+               ((vendors & kBPVendorAMD) && enabled[vendor_specific_amd]) ||
+               ((vendors & kBPVendorIMG) && enabled[vendor_specific_img]) ||
+               ((vendors & kBPVendorNVIDIA) && enabled[vendor_specific_nvidia]);
+    }
     const char* VendorSpecificTag(BPVendorFlags vendors) const;
 
     void RecordCmdDrawTypeArm(bp_state::CommandBuffer& cb_state, uint32_t draw_count);
@@ -971,6 +983,9 @@ class BestPractices : public ValidationStateTracker {
     std::deque<MemoryFreeEvent> memory_free_events_;
     mutable std::shared_mutex memory_free_events_lock_;
 
+    // Written to the memory report (memory_report setting) at device destruction
+    vvl::DeviceMemoryStats device_memory_stats_;
+
     std::set<std::array<uint32_t, 4>> clear_colors_;
     mutable std::shared_mutex clear_colors_lock_;
 
@@ -67,6 +67,7 @@ void BestPractices::PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffe
     cb_state->num_submits = 0;
     cb_state->uses_vertex_buffer = false;
     cb_state->small_indexed_draw_call_count = 0;
+    cb_state->deferred_indexed_draws.clear();
 }
 
 bool BestPractices::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo,
@@ -299,12 +300,12 @@ void BestPractices::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
             }
         }
 
-        for (auto& touch : secondary->render_pass_state.touchesAttachments) {
-            RecordAttachmentAccess(*primary, touch.framebufferAttachment, touch.aspects);
-        }
+        primary->render_pass_state.touchesAttachments |= secondary->render_pass_state.touchesAttachments;
 
         primary->render_pass_state.numDrawCallsDepthEqualCompare += secondary->render_pass_state.numDrawCallsDepthEqualCompare;
         primary->render_pass_state.numDrawCallsDepthOnly += secondary->render_pass_state.numDrawCallsDepthOnly;
+        primary->deferred_indexed_draws.insert(primary->deferred_indexed_draws.end(), secondary->deferred_indexed_draws.begin(),
+                                               secondary->deferred_indexed_draws.end());
 
         for (const auto& [event, secondary_info] : secondary->event_signaling_state) {
             if (auto* primary_info = vvl::Find(primary->event_signaling_state, event)) {
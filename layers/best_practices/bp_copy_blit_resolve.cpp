@@ -134,15 +134,8 @@ bool BestPractices::ValidateClearAttachment(const bp_state::CommandBuffer& cb_st
 
     const auto& rp_state = cb_state.render_pass_state;
 
-    auto attachment_itr =
-        std::find_if(rp_state.touchesAttachments.begin(), rp_state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
     // Only report aspects which haven't been touched yet.
-    VkImageAspectFlags new_aspects = aspects;
-    if (attachment_itr != rp_state.touchesAttachments.end()) {
-        new_aspects &= ~attachment_itr->aspects;
-    }
+    const VkImageAspectFlags new_aspects = aspects & ~rp_state.touchesAttachments.Get(fb_attachment);
 
     // Warn if this is issued prior to Draw Cmd and clearing the entire attachment
     if (!cb_state.has_draw_cmd) {
@@ -47,14 +47,18 @@ bool BestPractices::PreCallValidateAllocateMemory(VkDevice device, const VkMemor
     }
 
     if (pAllocateInfo->allocationSize < kMinDeviceAllocationSize) {
+        const auto memory_type_stats = device_memory_stats_.GetMemoryType(pAllocateInfo->memoryTypeIndex);
         skip |= LogPerformanceWarning("BestPractices-vkAllocateMemory-small-allocation", device,
                                       error_obj.location.dot(Field::pAllocateInfo).dot(Field::allocationSize),
                                       "is %" PRIu64
                                       ". This is a very small allocation (current "
                                       "threshold is %" PRIu64
                                       " bytes). "
-                                      "You should make large allocations and sub-allocate from one large VkDeviceMemory.",
-                                      pAllocateInfo->allocationSize, kMinDeviceAllocationSize);
+                                      "You should make large allocations and sub-allocate from one large VkDeviceMemory. "
+                                      "(%" PRIu64 " small allocations of memory type %" PRIu32 " so far, %" PRIu64 " still live.)",
+                                      pAllocateInfo->allocationSize, kMinDeviceAllocationSize,
+                                      memory_type_stats.small_allocations, pAllocateInfo->memoryTypeIndex,
+                                      memory_type_stats.live_allocations);
     }
 
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -112,8 +116,40 @@ bool BestPractices::PreCallValidateAllocateMemory(VkDevice device, const VkMemor
     return skip;
 }
 
+uint32_t BestPractices::MemoryTypeHeapIndex(uint32_t memory_type_index) const {
+    return memory_type_index < phys_dev_mem_props.memoryTypeCount ? phys_dev_mem_props.memoryTypes[memory_type_index].heapIndex
+                                                                  : vvl::kU32Max;
+}
+
+void BestPractices::ManualPostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                                       const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
+                                                       const RecordObject& record_obj) {
+    if (record_obj.result != VK_SUCCESS) {
+        return;
+    }
+    const uint32_t memory_type_index = pAllocateInfo->memoryTypeIndex;
+    device_memory_stats_.RecordAllocation(memory_type_index, MemoryTypeHeapIndex(memory_type_index),
+                                          pAllocateInfo->allocationSize,
+                                          pAllocateInfo->allocationSize < kMinDeviceAllocationSize);
+}
+
+void BestPractices::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    if (memory_report) {
+        memory_report->RecordDeviceMemory(device_memory_stats_.GetSnapshot());
+    }
+    ValidationStateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+}
+
 void BestPractices::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator,
                                             const RecordObject& record_obj) {
+    if (memory != VK_NULL_HANDLE) {
+        if (auto mem_info = Get<vvl::DeviceMemory>(memory)) {
+            const uint32_t memory_type_index = mem_info->allocate_info.memoryTypeIndex;
+            device_memory_stats_.RecordFree(memory_type_index, MemoryTypeHeapIndex(memory_type_index),
+                                            mem_info->allocate_info.allocationSize);
+        }
+    }
     if (memory != VK_NULL_HANDLE && VendorCheckEnabled(kBPVendorNVIDIA)) {
         auto mem_info = Get<vvl::DeviceMemory>(memory);
         ASSERT_AND_RETURN(mem_info);
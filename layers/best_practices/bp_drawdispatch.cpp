@@ -27,6 +27,11 @@
 bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const Location& loc) const {
     bool skip = false;
     const auto cb_state = GetRead<bp_state::CommandBuffer>(cmd_buffer);
+    // Only sampled past the frame budget, see chassis/frame_budget.h
+    if (!SampleBudgetedCheck(cb_state->command_count)) {
+        return skip;
+    }
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::BestPracticesDraw);
     if (const auto* pipe = cb_state->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS)) {
         if (const auto rp_state = pipe->RenderPassState()) {
             for (uint32_t i = 0; i < rp_state->create_info.subpassCount; ++i) {
@@ -93,9 +98,7 @@ void BestPractices::RecordCmdDrawType(VkCommandBuffer cmd_buffer, uint32_t draw_
     }
 
     if (cb_state->render_pass_state.drawTouchAttachments) {
-        for (auto& touch : cb_state->render_pass_state.nextDrawTouchesAttachments) {
-            RecordAttachmentAccess(*cb_state, touch.framebufferAttachment, touch.aspects);
-        }
+        cb_state->render_pass_state.touchesAttachments |= cb_state->render_pass_state.nextDrawTouchesAttachments;
         // No need to touch the same attachments over and over.
         cb_state->render_pass_state.drawTouchAttachments = false;
     }
@@ -174,7 +177,7 @@ bool BestPractices::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
                                       kSmallIndexedDrawcallIndices);
     }
 
-    if (VendorCheckEnabled(kBPVendorArm)) {
+    if (VendorCheckEnabled(kBPVendorArm) && !enabled[async_submit_validation] && SampleBudgetedCheck(cmd_state->command_count)) {
         skip |= ValidateIndexBufferArm(*cmd_state, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance,
                                        error_obj.location);
     }
@@ -182,31 +185,50 @@ bool BestPractices::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
     return skip;
 }
 
-void BestPractices::PostTransformLRUCacheModel::resize(size_t size) { _entries.resize(size); }
-
 bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
-    // look for a cache hit
-    auto hit = std::find_if(_entries.begin(), _entries.end(), [value](const CacheEntry& entry) { return entry.value == value; });
-    if (hit != _entries.end()) {
+    // look for a cache hit, all the entries are compared (no early exit) so the loop vectorizes
+    static_assert(kSize <= 32, "hit mask is 32 bits");
+    uint32_t hit_mask = 0;
+    for (uint32_t i = 0; i < kSize; ++i) {
+        hit_mask |= static_cast<uint32_t>(values_[i] == value) << i;
+    }
+    if (hit_mask != 0) {
         // mark the cache hit as being most recently used
-        hit->age = iteration++;
+        ages_[LeastSignificantBit(hit_mask)] = iteration_++;
         return true;
     }
 
     // if there's no cache hit, we need to model the entry being inserted into the cache
-    CacheEntry new_entry = {value, iteration};
-    if (iteration < static_cast<uint32_t>(std::distance(_entries.begin(), _entries.end()))) {
-        // if there is still space left in the cache, use the next available slot
-        *(_entries.begin() + iteration) = new_entry;
-    } else {
+    // if there is still space left in the cache, use the next available slot
+    uint32_t slot = iteration_;
+    if (slot >= kSize) {
         // otherwise replace the least recently used cache entry
-        auto lru = std::min_element(_entries.begin(), hit, [](const CacheEntry& a, const CacheEntry& b) { return a.age < b.age; });
-        *lru = new_entry;
+        slot = 0;
+        for (uint32_t i = 1; i < kSize; ++i) {
+            if (ages_[i] < ages_[slot]) {
+                slot = i;
+            }
+        }
     }
-    iteration++;
+    values_[slot] = value;
+    ages_[slot] = iteration_++;
     return false;
 }
 
+// The index buffer is read when the command buffer is submitted, which is also when the application must have written it
+void BestPractices::DeferIndexBufferValidationArm(vvl::Queue& queue_state, const bp_state::CommandBuffer& cb_state) const {
+    if (cb_state.deferred_indexed_draws.empty()) {
+        return;
+    }
+    queue_state.DeferValidation([this, draws = cb_state.deferred_indexed_draws]() {
+        const Location loc(Func::vkCmdDrawIndexed);
+        for (const auto& draw : draws) {
+            ValidateIndexBufferContentsArm(*draw.index_buffer, draw.index_type, draw.primitive_restart_enable, draw.index_count,
+                                           draw.first_index, loc);
+        }
+    });
+}
+
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_state, uint32_t indexCount, uint32_t instanceCount,
                                            uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                            const Location& loc) const {
@@ -216,21 +238,29 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
     const auto ib_state = Get<vvl::Buffer>(cmd_state.index_buffer_binding.buffer);
     ASSERT_AND_RETURN_SKIP(ib_state);
 
-    const VkIndexType ib_type = cmd_state.index_buffer_binding.index_type;
-    const auto ib_mem_state = ib_state->MemState();
-    if (!ib_mem_state) return skip;
-
-    const void* ib_mem = ib_mem_state->p_driver_data;
-    bool primitive_restart_enable = false;
-
     const auto* pipeline_state = cmd_state.GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS);
     ASSERT_AND_RETURN_SKIP(pipeline_state);
 
+    bool primitive_restart_enable = false;
     const auto* ia_state = pipeline_state->InputAssemblyState();
     if (ia_state) {
         primitive_restart_enable = ia_state->primitiveRestartEnable == VK_TRUE;
     }
 
+    skip |= ValidateIndexBufferContentsArm(*ib_state, cmd_state.index_buffer_binding.index_type, primitive_restart_enable,
+                                           indexCount, firstIndex, loc);
+    return skip;
+}
+
+bool BestPractices::ValidateIndexBufferContentsArm(const vvl::Buffer& ib_state, VkIndexType ib_type, bool primitive_restart_enable,
+                                                   uint32_t indexCount, uint32_t firstIndex, const Location& loc) const {
+    bool skip = false;
+
+    const auto ib_mem_state = ib_state.MemState();
+    if (!ib_mem_state) return skip;
+
+    const void* ib_mem = ib_mem_state->p_driver_data;
+
     // no point checking index buffer if the memory is nonexistant/unmapped, or if there is no graphics pipeline bound to this CB
     if (ib_mem) {
         const uint32_t scan_stride = GetIndexAlignment(ib_type);
@@ -252,13 +282,6 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
 
         PostTransformLRUCacheModel post_transform_cache;
 
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
         for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
             uint32_t scan_index;
             uint32_t primitive_restart_value;
@@ -371,6 +394,17 @@ void BestPractices::PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, u
         cb_state->small_indexed_draw_call_count++;
     }
 
+    if (VendorCheckEnabled(kBPVendorArm) && enabled[async_submit_validation]) {
+        const auto* pipeline_state = cb_state->GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS);
+        auto ib_state = Get<vvl::Buffer>(cb_state->index_buffer_binding.buffer);
+        if (pipeline_state && ib_state) {
+            const auto* ia_state = pipeline_state->InputAssemblyState();
+            const bool primitive_restart_enable = ia_state && ia_state->primitiveRestartEnable == VK_TRUE;
+            cb_state->deferred_indexed_draws.emplace_back(bp_state::CommandBuffer::DeferredIndexedDraw{
+                std::move(ib_state), cb_state->index_buffer_binding.index_type, primitive_restart_enable, indexCount, firstIndex});
+        }
+    }
+
     ValidateBoundDescriptorSets(*cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location.function);
 }
 
@@ -120,9 +120,8 @@ bool BestPractices::PreCallValidateCreateDevice(VkPhysicalDevice physicalDevice,
     bool skip = false;
 
     // get API version of physical device passed when creating device.
-    VkPhysicalDeviceProperties physical_device_properties{};
-    DispatchGetPhysicalDeviceProperties(physicalDevice, &physical_device_properties);
-    auto device_api_version = physical_device_properties.apiVersion;
+    const auto phys_dev_info = vvl::GetPhysicalDeviceInfo(physicalDevice);
+    auto device_api_version = phys_dev_info->properties.apiVersion;
 
     // Check api versions and log an info message when instance api Version is higher than version on device.
     if (api_version > device_api_version) {
@@ -135,18 +134,9 @@ bool BestPractices::PreCallValidateCreateDevice(VkPhysicalDevice physicalDevice,
     }
 
     std::vector<std::string> extensions;
-    {
-        uint32_t property_count = 0;
-        if (DispatchEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &property_count, nullptr) == VK_SUCCESS) {
-            std::vector<VkExtensionProperties> property_list(property_count);
-            if (DispatchEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &property_count, property_list.data()) ==
-                VK_SUCCESS) {
-                extensions.reserve(property_list.size());
-                for (const VkExtensionProperties& properties : property_list) {
-                    extensions.push_back(properties.extensionName);
-                }
-            }
-        }
+    extensions.reserve(phys_dev_info->extensions.size());
+    for (const VkExtensionProperties& properties : phys_dev_info->extensions) {
+        extensions.push_back(properties.extensionName);
     }
 
     for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
@@ -323,11 +313,27 @@ void BestPractices::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount
             for (auto& func : cb->queue_submit_functions) {
                 func(*this, *queue_state, *cb);
             }
+            DeferIndexBufferValidationArm(*queue_state, *cb);
             cb->num_submits++;
         }
     }
 }
 
+void BestPractices::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
+                                              const RecordObject& record_obj) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+
+    auto queue_state = Get<vvl::Queue>(queue);
+    for (uint32_t submit = 0; submit < submitCount; submit++) {
+        const auto& submit_info = pSubmits[submit];
+        for (uint32_t cb_index = 0; cb_index < submit_info.commandBufferInfoCount; cb_index++) {
+            if (auto cb = GetRead<bp_state::CommandBuffer>(submit_info.pCommandBufferInfos[cb_index].commandBuffer)) {
+                DeferIndexBufferValidationArm(*queue_state, *cb);
+            }
+        }
+    }
+}
+
 namespace {
 struct EventValidator {
     const ValidationStateTracker& state_tracker;
@@ -443,7 +449,7 @@ bool BestPractices::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindI
             }
             sparse_images.insert(image_state.get());
             if (image_state->sparse_residency) {
-                if (!image_state->get_sparse_reqs_called || image_state->sparse_requirements.empty()) {
+                if (!image_state->get_sparse_reqs_called || image_state->SparseRequirements().empty()) {
                     // For now just warning if sparse image binding occurs without calling to get reqs first
                     skip |=
                         LogWarning("BestPractices-vkQueueBindSparse-image-requirements2", image_state->Handle(), error_obj.location,
@@ -468,7 +474,7 @@ bool BestPractices::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindI
             }
             sparse_images.insert(image_state.get());
             if (image_state->sparse_residency) {
-                if (!image_state->get_sparse_reqs_called || image_state->sparse_requirements.empty()) {
+                if (!image_state->get_sparse_reqs_called || image_state->SparseRequirements().empty()) {
                     // For now just warning if sparse image binding occurs without calling to get reqs first
                     skip |= LogWarning("BestPractices-vkQueueBindSparse-image-opaque-requirements2", image_state->Handle(),
                                        error_obj.location,
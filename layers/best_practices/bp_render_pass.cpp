@@ -679,7 +679,7 @@ void BestPractices::PostRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
     // TODO - move this logic to the Render Pass state as cb->has_draw_cmd should stay true for lifetime of command buffer
     cb_state->has_draw_cmd = false;
     auto& render_pass_state = cb_state->render_pass_state;
-    render_pass_state.touchesAttachments.clear();
+    render_pass_state.touchesAttachments.Reset();
     render_pass_state.earlyClearAttachments.clear();
     render_pass_state.numDrawCallsDepthOnly = 0;
     render_pass_state.numDrawCallsDepthEqualCompare = 0;
@@ -836,12 +836,7 @@ bool BestPractices::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, cons
                 continue;
             }
 
-            auto itr = std::find_if(render_pass_state.touchesAttachments.begin(), render_pass_state.touchesAttachments.end(),
-                                    [i](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == i; });
-            uint32_t untouched_aspects = bandwidth_aspects;
-            if (itr != render_pass_state.touchesAttachments.end()) {
-                untouched_aspects &= ~itr->aspects;
-            }
+            const uint32_t untouched_aspects = bandwidth_aspects & ~render_pass_state.touchesAttachments.Get(i);
 
             if (untouched_aspects) {
                 skip |= LogPerformanceWarning(
@@ -859,17 +854,8 @@ bool BestPractices::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, cons
 }
 
 void BestPractices::RecordAttachmentAccess(bp_state::CommandBuffer& cb_state, uint32_t fb_attachment, VkImageAspectFlags aspects) {
-    auto& rp_state = cb_state.render_pass_state;
     // Called when we have a partial clear attachment, or a normal draw call which accesses an attachment.
-    auto itr =
-        std::find_if(rp_state.touchesAttachments.begin(), rp_state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
-    if (itr != rp_state.touchesAttachments.end()) {
-        itr->aspects |= aspects;
-    } else {
-        rp_state.touchesAttachments.push_back({fb_attachment, aspects});
-    }
+    cb_state.render_pass_state.touchesAttachments.Add(fb_attachment, aspects);
 }
 
 void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cmd_state, uint32_t fb_attachment,
@@ -878,18 +864,7 @@ void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cm
     auto& rp_state = cmd_state.render_pass_state;
     // If we observe a full clear before any other access to a frame buffer attachment,
     // we have candidate for redundant clear attachments.
-    auto itr =
-        std::find_if(rp_state.touchesAttachments.begin(), rp_state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
-    uint32_t new_aspects = aspects;
-    if (itr != rp_state.touchesAttachments.end()) {
-        new_aspects = aspects & ~itr->aspects;
-        itr->aspects |= aspects;
-    } else {
-        rp_state.touchesAttachments.push_back({fb_attachment, aspects});
-    }
-
+    const VkImageAspectFlags new_aspects = rp_state.touchesAttachments.Add(fb_attachment, aspects);
     if (new_aspects == 0) {
         return;
     }
@@ -897,7 +872,13 @@ void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cm
     if (cmd_state.IsSeconary()) {
         // The first command might be a clear, but might not be the first in the render pass, defer any checks until
         // CmdExecuteCommands.
-        rp_state.earlyClearAttachments.push_back(
-            {fb_attachment, color_attachment, new_aspects, std::vector<VkClearRect>{pRects, pRects + rectCount}});
+        rp_state.earlyClearAttachments.emplace_back();
+        auto& early_clear = rp_state.earlyClearAttachments.back();
+        early_clear.framebufferAttachment = fb_attachment;
+        early_clear.colorAttachment = color_attachment;
+        early_clear.aspects = new_aspects;
+        for (uint32_t i = 0; i < rectCount; ++i) {
+            early_clear.rects.emplace_back(pRects[i]);
+        }
     }
 }
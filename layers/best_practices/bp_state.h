@@ -122,6 +122,74 @@ struct AttachmentInfo {
     VkImageAspectFlags aspects;
 };
 
+// Aspects accessed per framebuffer attachment, as one bit per attachment index for each of the color, depth and stencil
+// aspects so the render pass heuristics are a few bit operations per draw or clear. The attachments past
+// kMaxTrackedAttachments fall back to a list.
+class AttachmentAccess {
+  public:
+    static constexpr uint32_t kMaxTrackedAttachments = 64;
+
+    VkImageAspectFlags Get(uint32_t attachment) const {
+        if (attachment < kMaxTrackedAttachments) {
+            const uint64_t bit = uint64_t(1) << attachment;
+            return ((color_ & bit) ? VK_IMAGE_ASPECT_COLOR_BIT : 0) | ((depth_ & bit) ? VK_IMAGE_ASPECT_DEPTH_BIT : 0) |
+                   ((stencil_ & bit) ? VK_IMAGE_ASPECT_STENCIL_BIT : 0);
+        }
+        for (const AttachmentInfo& info : overflow_) {
+            if (info.framebufferAttachment == attachment) {
+                return info.aspects;
+            }
+        }
+        return 0;
+    }
+
+    // Returns the aspects that were not accessed before
+    VkImageAspectFlags Add(uint32_t attachment, VkImageAspectFlags aspects) {
+        const VkImageAspectFlags new_aspects = aspects & ~Get(attachment);
+        if (new_aspects == 0) {
+            return 0;
+        }
+        if (attachment < kMaxTrackedAttachments) {
+            const uint64_t bit = uint64_t(1) << attachment;
+            if (new_aspects & VK_IMAGE_ASPECT_COLOR_BIT) color_ |= bit;
+            if (new_aspects & VK_IMAGE_ASPECT_DEPTH_BIT) depth_ |= bit;
+            if (new_aspects & VK_IMAGE_ASPECT_STENCIL_BIT) stencil_ |= bit;
+            return new_aspects;
+        }
+        for (AttachmentInfo& info : overflow_) {
+            if (info.framebufferAttachment == attachment) {
+                info.aspects |= new_aspects;
+                return new_aspects;
+            }
+        }
+        overflow_.emplace_back(AttachmentInfo{attachment, new_aspects});
+        return new_aspects;
+    }
+
+    AttachmentAccess& operator|=(const AttachmentAccess& other) {
+        color_ |= other.color_;
+        depth_ |= other.depth_;
+        stencil_ |= other.stencil_;
+        for (const AttachmentInfo& info : other.overflow_) {
+            Add(info.framebufferAttachment, info.aspects);
+        }
+        return *this;
+    }
+
+    void Reset() {
+        color_ = 0;
+        depth_ = 0;
+        stencil_ = 0;
+        overflow_.clear();
+    }
+
+  private:
+    uint64_t color_ = 0;
+    uint64_t depth_ = 0;
+    uint64_t stencil_ = 0;
+    std::vector<AttachmentInfo> overflow_;
+};
+
 // used to track state regarding render pass heuristic checks
 struct RenderPassState {
     bool depthAttachment = false;
@@ -136,12 +204,12 @@ struct RenderPassState {
         uint32_t framebufferAttachment;
         uint32_t colorAttachment;
         VkImageAspectFlags aspects;
-        std::vector<VkClearRect> rects;
+        small_vector<VkClearRect, 1, uint32_t> rects;
     };
 
-    std::vector<ClearInfo> earlyClearAttachments;
-    std::vector<AttachmentInfo> touchesAttachments;
-    std::vector<AttachmentInfo> nextDrawTouchesAttachments;
+    small_vector<ClearInfo, 4, uint32_t> earlyClearAttachments;
+    AttachmentAccess touchesAttachments;
+    AttachmentAccess nextDrawTouchesAttachments;
     bool drawTouchAttachments = false;
 };
 
@@ -198,6 +266,17 @@ class CommandBuffer : public vvl::CommandBuffer {
     bool uses_vertex_buffer = false;
     uint32_t small_indexed_draw_call_count = 0;
 
+    // With async_submit_validation, the Arm index buffer analysis of vkCmdDrawIndexed is done on the queue thread when the
+    // command buffer is submitted instead of when the draw is recorded
+    struct DeferredIndexedDraw {
+        std::shared_ptr<const vvl::Buffer> index_buffer;
+        VkIndexType index_type;
+        bool primitive_restart_enable;
+        uint32_t index_count;
+        uint32_t first_index;
+    };
+    std::vector<DeferredIndexedDraw> deferred_indexed_draws;
+
     // This function used to not be empty. It has been left empty because
     // the logic to decide to call this function is not simple, so adding this
     // function back could tedious.
@@ -232,6 +311,6 @@ class Pipeline : public vvl::Pipeline {
              std::shared_ptr<const vvl::PipelineCache>&& pipe_cache, std::shared_ptr<const vvl::RenderPass>&& rpstate,
              std::shared_ptr<const vvl::PipelineLayout>&& layout, ShaderModuleUniqueIds* shader_unique_id_map);
 
-    const std::vector<AttachmentInfo> access_framebuffer_attachments;
+    const AttachmentAccess access_framebuffer_attachments;
 };
 }  // namespace bp_state
\ No newline at end of file
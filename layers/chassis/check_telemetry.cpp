@@ -0,0 +1,195 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/check_telemetry.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "utils/hash_util.h"
+
+namespace vvl {
+
+static std::atomic<uint64_t> check_telemetry_id{1};
+
+thread_local CheckFamily CheckTelemetry::current_family = CheckFamily::Count;
+
+const char *CheckFamilyName(CheckFamily family) {
+    switch (family) {
+        case CheckFamily::ActionState:
+            return "ActionState";
+        case CheckFamily::Descriptors:
+            return "Descriptors";
+        case CheckFamily::ShaderStage:
+            return "ShaderStage";
+        case CheckFamily::SpirvStateless:
+            return "SpirvStateless";
+        case CheckFamily::BestPracticesDraw:
+            return "BestPracticesDraw";
+        case CheckFamily::SyncQueueSubmit:
+            return "SyncQueueSubmit";
+        case CheckFamily::GpuAvInstrumentation:
+            return "GpuAvInstrumentation";
+        case CheckFamily::DebugPrintfInstrumentation:
+            return "DebugPrintfInstrumentation";
+        case CheckFamily::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+CheckTelemetry::CheckTelemetry(const std::string &output_file, uint32_t present_interval)
+    : output_file_(output_file), present_interval_(present_interval), id_(check_telemetry_id.fetch_add(1)) {}
+
+void CheckTelemetry::FamilyCounters::Merge(const FamilyCounters &other) {
+    runs += other.runs;
+    total_ns += other.total_ns;
+    max_ns = std::max(max_ns, other.max_ns);
+    vuid_hits += other.vuid_hits;
+}
+
+CheckTelemetry::ThreadCounters &CheckTelemetry::GetThreadCounters() {
+    struct Cache {
+        uint64_t id = 0;
+        ThreadCounters *counters = nullptr;
+    };
+    // A thread only takes the lock the first time it records for a device, or when it switches between devices
+    thread_local Cache cache;
+    if (cache.id != id_) {
+        std::lock_guard<std::mutex> guard(threads_lock_);
+        ThreadCounters *&counters = thread_counters_[std::this_thread::get_id()];
+        if (!counters) {
+            counters_.emplace_back(std::make_unique<ThreadCounters>());
+            counters = counters_.back().get();
+        }
+        cache.id = id_;
+        cache.counters = counters;
+    }
+    return *cache.counters;
+}
+
+void CheckTelemetry::RecordVuid(std::string_view vuid) {
+    const uint32_t message_id = hash_util::VuidHash(vuid);
+    const uint32_t family = static_cast<uint32_t>(current_family);
+    ThreadCounters &counters = GetThreadCounters();
+    std::lock_guard<std::mutex> guard(counters.lock);
+    VuidCounters &vuid_counters = counters.vuids[message_id];
+    if (vuid_counters.vuid.empty()) {
+        vuid_counters.vuid = vuid;
+    }
+    vuid_counters.hits[family]++;
+    if (family < kCheckFamilyCount) {
+        counters.families[family].vuid_hits++;
+    }
+}
+
+void CheckTelemetry::RecordCheck(CheckFamily family, uint64_t nanoseconds) {
+    ThreadCounters &counters = GetThreadCounters();
+    std::lock_guard<std::mutex> guard(counters.lock);
+    FamilyCounters &family_counters = counters.families[static_cast<uint32_t>(family)];
+    family_counters.runs++;
+    family_counters.total_ns += nanoseconds;
+    family_counters.max_ns = std::max(family_counters.max_ns, nanoseconds);
+}
+
+void CheckTelemetry::EndFrame() {
+    if (present_interval_ != 0 && (presents_.fetch_add(1, std::memory_order_relaxed) + 1) % present_interval_ == 0) {
+        WriteReport();
+    }
+}
+
+void CheckTelemetry::WriteReport() {
+    std::lock_guard<std::mutex> report_guard(report_lock_);
+    std::array<FamilyCounters, kCheckFamilyCount> families;
+    vvl::unordered_map<uint32_t, VuidCounters> vuids;
+    {
+        std::lock_guard<std::mutex> guard(threads_lock_);
+        for (const auto &thread_counters : counters_) {
+            std::lock_guard<std::mutex> counters_guard(thread_counters->lock);
+            for (uint32_t i = 0; i < kCheckFamilyCount; ++i) {
+                families[i].Merge(thread_counters->families[i]);
+            }
+            for (const auto &[message_id, counters] : thread_counters->vuids) {
+                VuidCounters &merged = vuids[message_id];
+                if (merged.vuid.empty()) {
+                    merged.vuid = counters.vuid;
+                }
+                for (uint32_t i = 0; i <= kCheckFamilyCount; ++i) {
+                    merged.hits[i] += counters.hits[i];
+                }
+            }
+        }
+    }
+
+    // Most expensive families and most reported VUIDs first
+    std::vector<uint32_t> sorted_families;
+    for (uint32_t i = 0; i < kCheckFamilyCount; ++i) {
+        if (families[i].runs != 0) {
+            sorted_families.emplace_back(i);
+        }
+    }
+    std::sort(sorted_families.begin(), sorted_families.end(),
+              [&families](uint32_t a, uint32_t b) { return families[a].total_ns > families[b].total_ns; });
+    std::vector<std::pair<uint64_t, const VuidCounters *>> sorted_vuids;
+    sorted_vuids.reserve(vuids.size());
+    for (const auto &[message_id, counters] : vuids) {
+        uint64_t hits = 0;
+        for (const uint64_t family_hits : counters.hits) {
+            hits += family_hits;
+        }
+        sorted_vuids.emplace_back(hits, &counters);
+    }
+    std::sort(sorted_vuids.begin(), sorted_vuids.end(), [](const auto &a, const auto &b) {
+        return a.first != b.first ? a.first > b.first : a.second->vuid < b.second->vuid;
+    });
+
+    std::ofstream out(output_file_);
+    if (!out) {
+        printf("Validation Setting Warning - could not open %s to write the check telemetry\n", output_file_.c_str());
+        return;
+    }
+
+    // The time of a family includes the families it calls (ActionState includes Descriptors), a VUID only counts for the
+    // innermost one
+    out << "{\n\"families\": [\n";
+    bool first = true;
+    for (const uint32_t i : sorted_families) {
+        const FamilyCounters &counters = families[i];
+        out << (first ? "" : ",\n") << "{\"family\": \"" << CheckFamilyName(static_cast<CheckFamily>(i))
+            << "\", \"runs\": " << counters.runs << ", \"total_ns\": " << counters.total_ns
+            << ", \"mean_ns\": " << counters.total_ns / counters.runs << ", \"max_ns\": " << counters.max_ns
+            << ", \"vuid_hits\": " << counters.vuid_hits << "}";
+        first = false;
+    }
+    out << "\n],\n\"vuids\": [\n";
+    first = true;
+    for (const auto &[hits, counters] : sorted_vuids) {
+        out << (first ? "" : ",\n") << "{\"vuid\": \"" << counters->vuid << "\", \"hits\": " << hits << ", \"families\": {";
+        bool first_family = true;
+        for (uint32_t i = 0; i < kCheckFamilyCount; ++i) {
+            if (counters->hits[i] == 0) continue;
+            out << (first_family ? "" : ", ") << "\"" << CheckFamilyName(static_cast<CheckFamily>(i)) << "\": " << counters->hits[i];
+            first_family = false;
+        }
+        out << "}}";
+        first = false;
+    }
+    out << "\n]\n}\n";
+}
+
+}  // namespace vvl
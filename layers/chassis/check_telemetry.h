@@ -0,0 +1,136 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// The expensive checks whose cost is measured, each is the function of a validation object named in the comment
+enum class CheckFamily : uint32_t {
+    ActionState,                 // CoreChecks::ValidateActionState, the bound state of each draw, dispatch and trace rays
+    Descriptors,                 // CoreChecks::ValidateDrawState, the descriptors of a set used by an action command
+    ShaderStage,                 // CoreChecks::ValidateShaderStage, a stage of a pipeline or a shader object
+    SpirvStateless,              // CoreChecks::ValidateSpirvStateless, the checks of a shader that need no other state
+    BestPracticesDraw,           // BestPractices::ValidateCmdDrawType
+    SyncQueueSubmit,             // SyncValidator::ValidateQueueSubmit, the hazards between the submitted command buffers
+    GpuAvInstrumentation,        // gpuav::Validator::InstrumentShader
+    DebugPrintfInstrumentation,  // debug_printf::Validator::InstrumentShader
+    Count,
+};
+constexpr uint32_t kCheckFamilyCount = static_cast<uint32_t>(CheckFamily::Count);
+
+const char *CheckFamilyName(CheckFamily family);
+
+// Counts how often each VUID is reported, and how often each check family runs and how long it takes, for a device.
+// A VUID reported while a family runs is also counted for that family, so the report tells which checks cost the most
+// compared with what they find, to choose the validation settings of a project.
+//
+// Like EntryPointTimings, every thread records into its own counters, which are merged when the report is written. The
+// counters of a thread have a lock of their own, only contended while a report is written, so the report can also be written
+// while the device is in use (every present_interval presents) and not only at device destruction.
+class CheckTelemetry {
+  public:
+    // present_interval is the number of presents between two reports, zero only writes it at device destruction
+    CheckTelemetry(const std::string &output_file, uint32_t present_interval);
+
+    // Every Log* call counts, even when the message is filtered out afterwards: it is what the check found
+    void RecordVuid(std::string_view vuid);
+    void RecordCheck(CheckFamily family, uint64_t nanoseconds);
+
+    // Called after each vkQueuePresentKHR
+    void EndFrame();
+    void WriteReport();
+
+    // Family of the innermost CheckTimer of the thread, Count outside of them
+    static thread_local CheckFamily current_family;
+
+  private:
+    struct FamilyCounters {
+        uint64_t runs = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+        uint64_t vuid_hits = 0;
+
+        void Merge(const FamilyCounters &other);
+    };
+    struct VuidCounters {
+        std::string vuid;
+        // Last one is the hits outside of any family
+        std::array<uint64_t, kCheckFamilyCount + 1> hits{};
+    };
+    struct ThreadCounters {
+        std::mutex lock;
+        std::array<FamilyCounters, kCheckFamilyCount> families;
+        // Keyed by the message id of the VUID (hash_util::VuidHash)
+        vvl::unordered_map<uint32_t, VuidCounters> vuids;
+    };
+    ThreadCounters &GetThreadCounters();
+
+    const std::string output_file_;
+    const uint32_t present_interval_;
+    // Unique over the process lifetime, so a thread local cache can't mistake a new device for a destroyed one
+    const uint64_t id_;
+    std::atomic<uint64_t> presents_{0};
+
+    std::mutex threads_lock_;
+    std::unordered_map<std::thread::id, ThreadCounters *> thread_counters_;
+    std::vector<std::unique_ptr<ThreadCounters>> counters_;
+    // Only one report is written at a time
+    std::mutex report_lock_;
+};
+
+// Times a check family for the check telemetry, does nothing but a null check when it is disabled
+class CheckTimer {
+  public:
+    CheckTimer(CheckTelemetry *telemetry, CheckFamily family) : telemetry_(telemetry), family_(family) {
+        if (telemetry_) {
+            previous_family_ = CheckTelemetry::current_family;
+            CheckTelemetry::current_family = family_;
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~CheckTimer() {
+        if (telemetry_) {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            telemetry_->RecordCheck(family_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            CheckTelemetry::current_family = previous_family_;
+        }
+    }
+    CheckTimer(const CheckTimer &) = delete;
+    CheckTimer &operator=(const CheckTimer &) = delete;
+
+  private:
+    CheckTelemetry *telemetry_;
+    const CheckFamily family_;
+    CheckFamily previous_family_ = CheckFamily::Count;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace vvl
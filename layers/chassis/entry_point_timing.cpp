@@ -0,0 +1,177 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/entry_point_timing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+#include "generated/chassis.h"
+
+static std::atomic<uint64_t> entry_point_timings_id{1};
+
+EntryPointTimings::EntryPointTimings(const EntryPointTimingSettings &settings)
+    : settings_(settings), id_(entry_point_timings_id.fetch_add(1)) {}
+
+void EntryPointTimings::Histogram::Add(uint64_t nanoseconds) {
+    count++;
+    total_ns += nanoseconds;
+    max_ns = std::max(max_ns, nanoseconds);
+    uint32_t bucket = 0;
+    while ((bucket + 1 < kBucketCount) && (nanoseconds >> (bucket + 1)) != 0) {
+        bucket++;
+    }
+    buckets[bucket]++;
+}
+
+void EntryPointTimings::Histogram::Merge(const Histogram &other) {
+    count += other.count;
+    total_ns += other.total_ns;
+    max_ns = std::max(max_ns, other.max_ns);
+    for (uint32_t i = 0; i < kBucketCount; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+EntryPointTimings::ThreadHistograms &EntryPointTimings::GetThreadHistograms() {
+    struct Cache {
+        uint64_t id = 0;
+        ThreadHistograms *histograms = nullptr;
+    };
+    // A thread only takes the lock the first time it records for a device, or when it switches between devices
+    thread_local Cache cache;
+    if (cache.id != id_) {
+        std::lock_guard<std::mutex> guard(threads_lock_);
+        ThreadHistograms *&histograms = thread_histograms_[std::this_thread::get_id()];
+        if (!histograms) {
+            histograms_.emplace_back(std::make_unique<ThreadHistograms>());
+            histograms = histograms_.back().get();
+        }
+        cache.id = id_;
+        cache.histograms = histograms;
+    }
+    return *cache.histograms;
+}
+
+const char *LayerObjectTypeName(uint32_t object_type) {
+    switch (static_cast<LayerObjectTypeId>(object_type)) {
+        case LayerObjectTypeInstance:
+            return "Instance";
+        case LayerObjectTypeDevice:
+            return "Device";
+        case LayerObjectTypeThreading:
+            return "Threading";
+        case LayerObjectTypeParameterValidation:
+            return "ParameterValidation";
+        case LayerObjectTypeObjectTracker:
+            return "ObjectTracker";
+        case LayerObjectTypeCoreValidation:
+            return "CoreValidation";
+        case LayerObjectTypeBestPractices:
+            return "BestPractices";
+        case LayerObjectTypeGpuAssisted:
+            return "GpuAssisted";
+        case LayerObjectTypeDebugPrintf:
+            return "DebugPrintf";
+        case LayerObjectTypeSyncValidation:
+            return "SyncValidation";
+        default:
+            return "Unknown";
+    }
+}
+
+static const char *PhaseName(uint32_t phase) {
+    switch (static_cast<EntryPointPhase>(phase)) {
+        case EntryPointPhase::PreCallValidate:
+            return "PreCallValidate";
+        case EntryPointPhase::PreCallRecord:
+            return "PreCallRecord";
+        case EntryPointPhase::PostCallRecord:
+            return "PostCallRecord";
+    }
+    return "Unknown";
+}
+
+void EntryPointTimings::WriteReport() const {
+    ThreadHistograms merged;
+    for (const auto &thread_histograms : histograms_) {
+        for (const auto &[key, histogram] : *thread_histograms) {
+            merged[key].Merge(histogram);
+        }
+    }
+    // Most expensive first
+    std::vector<std::pair<Key, const Histogram *>> sorted;
+    sorted.reserve(merged.size());
+    for (const auto &[key, histogram] : merged) {
+        sorted.emplace_back(key, &histogram);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto &a, const auto &b) { return a.second->total_ns > b.second->total_ns; });
+
+    std::ofstream out(settings_.output_file);
+    if (!out) {
+        printf("Validation Setting Warning - could not open %s to write the entry point timing\n", settings_.output_file.c_str());
+        return;
+    }
+
+    if (settings_.chrome_trace) {
+        // One track per validation object, its entry points laid out back to back by total time
+        out << "{\"traceEvents\":[\n";
+        std::array<uint64_t, LayerObjectTypeMaxEnum> track_time_us{};
+        bool first = true;
+        for (uint32_t object_type = 0; object_type < LayerObjectTypeMaxEnum; ++object_type) {
+            out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << object_type
+                << ",\"args\":{\"name\":\"" << LayerObjectTypeName(object_type) << "\"}}";
+            first = false;
+        }
+        for (const auto &[key, histogram] : sorted) {
+            const uint32_t object_type = key & 0xF;
+            if (object_type >= LayerObjectTypeMaxEnum) continue;
+            const uint64_t duration_us = std::max<uint64_t>(histogram->total_ns / 1000, 1);
+            out << ",\n{\"name\":\"" << vvl::String(static_cast<vvl::Func>(key >> 8)) << " " << PhaseName((key >> 4) & 0xF)
+                << "\",\"cat\":\"" << LayerObjectTypeName(object_type) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << object_type
+                << ",\"ts\":" << track_time_us[object_type] << ",\"dur\":" << duration_us << ",\"args\":{\"count\":" << histogram->count
+                << ",\"max_ns\":" << histogram->max_ns << "}}";
+            track_time_us[object_type] += duration_us;
+        }
+        out << "\n]}\n";
+        return;
+    }
+
+    out << "{\n\"bucket_unit\": \"log2_ns\",\n\"entry_points\": [\n";
+    bool first = true;
+    for (const auto &[key, histogram] : sorted) {
+        out << (first ? "" : ",\n") << "{\"function\": \"" << vvl::String(static_cast<vvl::Func>(key >> 8)) << "\", \"object\": \""
+            << LayerObjectTypeName(key & 0xF) << "\", \"phase\": \"" << PhaseName((key >> 4) & 0xF)
+            << "\", \"count\": " << histogram->count << ", \"total_ns\": " << histogram->total_ns
+            << ", \"mean_ns\": " << histogram->total_ns / histogram->count << ", \"max_ns\": " << histogram->max_ns
+            << ", \"buckets\": [";
+        // Trailing empty buckets are dropped
+        uint32_t last_bucket = kBucketCount;
+        while (last_bucket > 0 && histogram->buckets[last_bucket - 1] == 0) {
+            last_bucket--;
+        }
+        for (uint32_t i = 0; i < last_bucket; ++i) {
+            out << (i ? ", " : "") << histogram->buckets[i];
+        }
+        out << "]}";
+        first = false;
+    }
+    out << "\n]\n}\n";
+}
@@ -0,0 +1,151 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "chassis/frame_budget.h"
+#include "containers/custom_containers.h"
+#include "error_message/error_location.h"
+#include "utils/lock_profile.h"
+#include "utils/trace_markers.h"
+
+struct EntryPointTimingSettings {
+    bool enabled = false;
+    bool chrome_trace = false;  // Write Chrome trace events instead of the JSON histograms
+    std::string output_file = "vvl_entry_point_timing.json";
+    // Scoped trace markers of the layer hot paths, see utils/trace_markers.h
+    bool trace_markers = false;
+    std::string trace_file = "vvl_trace.json";
+    // Contention of the locks shared by the threads, see utils/lock_profile.h
+    bool lock_contention_report = false;
+    std::string lock_contention_report_file = "vvl_lock_contention.json";
+    // Memory footprint of the state objects, see chassis/memory_report.h
+    bool memory_report = false;
+    std::string memory_report_file = "vvl_memory_report.json";
+    uint32_t memory_report_interval = 100;
+    // Allocate the layer arenas from the VkAllocationCallbacks of vkCreateInstance, see utils/arena_allocator.h
+    bool app_allocation_callbacks = false;
+    // Layer CPU time allowed per frame before the expensive checks get sampled, zero disables it. See chassis/frame_budget.h
+    uint32_t frame_budget_us = 0;
+    uint32_t frame_budget_sample_rate = 16;
+    // VUID hits, runs and time of the check families, see chassis/check_telemetry.h
+    bool check_telemetry = false;
+    std::string check_telemetry_file = "vvl_check_telemetry.json";
+    uint32_t check_telemetry_interval = 0;
+};
+
+// Name of a LayerObjectTypeId for the reports
+const char *LayerObjectTypeName(uint32_t object_type);
+
+enum class EntryPointPhase : uint32_t {
+    PreCallValidate,
+    PreCallRecord,
+    PostCallRecord,
+};
+
+// Latency histograms for each (entry point, validation object, phase) of a device.
+//
+// Every thread records into its own set of histograms, so recording takes no lock and shares no cache lines with other
+// threads. The per thread histograms are merged only when the report is written at device destruction.
+class EntryPointTimings {
+  public:
+    // Bucket i counts the calls that took [2^i, 2^(i+1)) nanoseconds
+    static constexpr uint32_t kBucketCount = 32;
+
+    struct Histogram {
+        uint64_t count = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+        std::array<uint64_t, kBucketCount> buckets{};
+
+        void Add(uint64_t nanoseconds);
+        void Merge(const Histogram &other);
+    };
+
+    explicit EntryPointTimings(const EntryPointTimingSettings &settings);
+
+    void Record(vvl::Func function, uint32_t object_type, EntryPointPhase phase, uint64_t nanoseconds) {
+        GetThreadHistograms()[MakeKey(function, object_type, phase)].Add(nanoseconds);
+    }
+
+    // Must only be called once no other thread records anymore (device destruction)
+    void WriteReport() const;
+
+  private:
+    // [31 .. 8] function | [7 .. 4] phase | [3 .. 0] validation object type
+    using Key = uint32_t;
+    static Key MakeKey(vvl::Func function, uint32_t object_type, EntryPointPhase phase) {
+        return (static_cast<uint32_t>(function) << 8) | (static_cast<uint32_t>(phase) << 4) | (object_type & 0xF);
+    }
+    using ThreadHistograms = vvl::unordered_map<Key, Histogram>;
+    ThreadHistograms &GetThreadHistograms();
+
+    const EntryPointTimingSettings settings_;
+    // Unique over the process lifetime, so a thread local cache can't mistake a new device for a destroyed one
+    const uint64_t id_;
+
+    std::mutex threads_lock_;
+    std::unordered_map<std::thread::id, ThreadHistograms *> thread_histograms_;
+    std::vector<std::unique_ptr<ThreadHistograms>> histograms_;
+};
+
+// Times one call of a validation object hook, for the entry point timings and the frame budget. Does nothing but null checks
+// when both are disabled.
+class EntryPointTimer {
+  public:
+    template <typename LayerData, typename Intercept, typename ReportObject>
+    EntryPointTimer(const LayerData &layer_data, const Intercept &intercept, EntryPointPhase phase, const ReportObject &report_obj)
+        : timings_(layer_data.entry_point_timings.get()), frame_budget_(layer_data.frame_budget.get()) {
+        if (timings_ || frame_budget_) {
+            function_ = report_obj.location.function;
+            object_type_ = static_cast<uint32_t>(intercept.container_type);
+            phase_ = phase;
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~EntryPointTimer() {
+        if (timings_ || frame_budget_) {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            const uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+            if (timings_) {
+                timings_->Record(function_, object_type_, phase_, nanoseconds);
+            }
+            if (frame_budget_) {
+                frame_budget_->Spend(nanoseconds);
+            }
+        }
+    }
+    EntryPointTimer(const EntryPointTimer &) = delete;
+    EntryPointTimer &operator=(const EntryPointTimer &) = delete;
+
+  private:
+    EntryPointTimings *timings_;
+    vvl::FrameBudget *frame_budget_;
+    vvl::Func function_ = vvl::Func::Empty;
+    uint32_t object_type_ = 0;
+    EntryPointPhase phase_ = EntryPointPhase::PreCallValidate;
+    std::chrono::steady_clock::time_point start_;
+};
@@ -0,0 +1,56 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/frame_budget.h"
+
+#include <cinttypes>
+
+#include "generated/chassis.h"
+
+namespace vvl {
+
+void FrameBudget::EndFrame(const ValidationObject &logger, VkQueue queue, const Location &loc) {
+    // Hooks still running on other threads are counted in the next frame
+    const uint64_t spent_ns = spent_ns_.exchange(0, std::memory_order_relaxed);
+    const uint64_t skipped_checks = skipped_checks_.exchange(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> guard(frame_lock_);
+    frame_++;
+    if (spent_ns > budget_ns_) {
+        // Only the first frame of a run is logged, an app over budget would otherwise get a message every frame
+        if (sampled_frames_ == 0) {
+            logger.LogInfo("WARNING-frame-budget", queue, loc,
+                           "Frame %" PRIu64 " spent %.3f ms in the layer, over the frame budget of %.3f ms. Until a frame is "
+                           "back within the budget, descriptor validation, synchronization validation of submitted command "
+                           "buffers and best practices draw checks only run for 1 out of %" PRIu32
+                           " command buffers or action commands (the sampling rate).",
+                           frame_, spent_ns / 1e6, budget_ns_ / 1e6, sample_rate_);
+        }
+        sampled_frames_++;
+        sampled_skipped_checks_ += skipped_checks;
+    } else if (sampled_frames_ > 0) {
+        logger.LogInfo("WARNING-frame-budget", queue, loc,
+                       "Frame %" PRIu64 " is back within the frame budget of %.3f ms. The %" PRIu64
+                       " previous frames were over budget, %" PRIu64 " checks were skipped with a sampling rate of 1 in %" PRIu32
+                       ".",
+                       frame_, budget_ns_ / 1e6, sampled_frames_, sampled_skipped_checks_ + skipped_checks, sample_rate_);
+        sampled_frames_ = 0;
+        sampled_skipped_checks_ = 0;
+    }
+}
+
+}  // namespace vvl
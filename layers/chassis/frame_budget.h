@@ -0,0 +1,72 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include <vulkan/vulkan.h>
+
+class ValidationObject;
+struct Location;
+
+namespace vvl {
+
+// Caps the CPU time the layer spends in each frame, frames being delimited by vkQueuePresentKHR.
+//
+// EntryPointTimer adds the time of every validation object hook to the current frame. Once the frame is over budget, the
+// expensive checks that only look for errors, and don't update any state, are sampled until the next present: they run
+// for one command buffer or action command out of sample_rate and are skipped for the others. State tracking is never
+// skipped, so a sampled frame can miss errors but can't report false ones.
+class FrameBudget {
+  public:
+    FrameBudget(uint32_t budget_us, uint32_t sample_rate)
+        : budget_ns_(uint64_t(budget_us) * 1000), sample_rate_(std::max(sample_rate, 1u)) {}
+
+    void Spend(uint64_t nanoseconds) { spent_ns_.fetch_add(nanoseconds, std::memory_order_relaxed); }
+
+    // sample_key identifies the unit being sampled, the index of a command in its command buffer or of a command buffer
+    // in a submission. Returns false if the check must be skipped.
+    bool ShouldValidate(uint64_t sample_key) {
+        if (spent_ns_.load(std::memory_order_relaxed) <= budget_ns_ || sample_key % sample_rate_ == 0) {
+            return true;
+        }
+        skipped_checks_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Called after each vkQueuePresentKHR. Logs when the layer starts sampling checks and when a frame is back within
+    // the budget.
+    void EndFrame(const ValidationObject &logger, VkQueue queue, const Location &loc);
+
+  private:
+    const uint64_t budget_ns_;
+    const uint32_t sample_rate_;
+
+    std::atomic<uint64_t> spent_ns_{0};
+    std::atomic<uint64_t> skipped_checks_{0};
+
+    std::mutex frame_lock_;
+    uint64_t frame_ = 0;
+    // Consecutive frames over budget, and the checks they skipped
+    uint64_t sampled_frames_ = 0;
+    uint64_t sampled_skipped_checks_ = 0;
+};
+
+}  // namespace vvl
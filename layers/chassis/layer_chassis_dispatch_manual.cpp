@@ -758,6 +758,158 @@ void *BuildUnwrappedUpdateTemplateBuffer(ValidationObject *layer_data, uint64_t
     return (void *)unwrapped_data;
 }
 
+// Arrays reused by the vkUpdateDescriptorSets calls of a thread. The writes are unwrapped into them in one pass, instead of a
+// safe struct per write that allocates each of its descriptor arrays.
+struct UpdateDescriptorSetsScratch {
+    std::vector<VkWriteDescriptorSet> writes;
+    std::vector<VkCopyDescriptorSet> copies;
+    std::vector<VkDescriptorImageInfo> image_infos;
+    std::vector<VkDescriptorBufferInfo> buffer_infos;
+    std::vector<VkBufferView> texel_buffer_views;
+    // Copies of the pNext chains with handles unwrapped, freed after the call
+    std::vector<void *> pnext_chains;
+    bool in_use = false;
+};
+
+enum class WriteDescriptorArray { None, ImageInfo, BufferInfo, TexelBufferView };
+
+// The array of a write the driver reads, the others can be garbage
+static WriteDescriptorArray GetWriteDescriptorArray(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        case VK_DESCRIPTOR_TYPE_SAMPLE_WEIGHT_IMAGE_QCOM:
+        case VK_DESCRIPTOR_TYPE_BLOCK_MATCH_IMAGE_QCOM:
+            return WriteDescriptorArray::ImageInfo;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return WriteDescriptorArray::BufferInfo;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return WriteDescriptorArray::TexelBufferView;
+        default:
+            return WriteDescriptorArray::None;
+    }
+}
+
+static void UnwrapDescriptorUpdates(ValidationObject *layer_data, UpdateDescriptorSetsScratch &scratch,
+                                    uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                    uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    // Sized before any pointer into the arrays is taken, they don't move afterwards
+    size_t image_info_count = 0;
+    size_t buffer_info_count = 0;
+    size_t texel_buffer_view_count = 0;
+    for (uint32_t i = 0; i < descriptorWriteCount; ++i) {
+        switch (GetWriteDescriptorArray(pDescriptorWrites[i].descriptorType)) {
+            case WriteDescriptorArray::ImageInfo:
+                image_info_count += pDescriptorWrites[i].pImageInfo ? pDescriptorWrites[i].descriptorCount : 0;
+                break;
+            case WriteDescriptorArray::BufferInfo:
+                buffer_info_count += pDescriptorWrites[i].pBufferInfo ? pDescriptorWrites[i].descriptorCount : 0;
+                break;
+            case WriteDescriptorArray::TexelBufferView:
+                texel_buffer_view_count += pDescriptorWrites[i].pTexelBufferView ? pDescriptorWrites[i].descriptorCount : 0;
+                break;
+            case WriteDescriptorArray::None:
+                break;
+        }
+    }
+    scratch.writes.resize(descriptorWriteCount);
+    scratch.copies.resize(descriptorCopyCount);
+    scratch.image_infos.resize(image_info_count);
+    scratch.buffer_infos.resize(buffer_info_count);
+    scratch.texel_buffer_views.resize(texel_buffer_view_count);
+
+    VkDescriptorImageInfo *image_info = scratch.image_infos.data();
+    VkDescriptorBufferInfo *buffer_info = scratch.buffer_infos.data();
+    VkBufferView *texel_buffer_view = scratch.texel_buffer_views.data();
+    for (uint32_t i = 0; i < descriptorWriteCount; ++i) {
+        const VkWriteDescriptorSet &src = pDescriptorWrites[i];
+        VkWriteDescriptorSet &dst = scratch.writes[i];
+        dst = src;
+        dst.dstSet = layer_data->Unwrap(src.dstSet);
+        dst.pImageInfo = nullptr;
+        dst.pBufferInfo = nullptr;
+        dst.pTexelBufferView = nullptr;
+        if (src.pNext) {
+            void *pnext_chain = vku::SafePnextCopy(src.pNext);
+            WrapPnextChainHandles(layer_data, pnext_chain);
+            scratch.pnext_chains.push_back(pnext_chain);
+            dst.pNext = pnext_chain;
+        }
+        switch (GetWriteDescriptorArray(src.descriptorType)) {
+            case WriteDescriptorArray::ImageInfo:
+                if (src.pImageInfo) {
+                    dst.pImageInfo = image_info;
+                    for (uint32_t j = 0; j < src.descriptorCount; ++j, ++image_info) {
+                        image_info->sampler = layer_data->Unwrap(src.pImageInfo[j].sampler);
+                        image_info->imageView = layer_data->Unwrap(src.pImageInfo[j].imageView);
+                        image_info->imageLayout = src.pImageInfo[j].imageLayout;
+                    }
+                }
+                break;
+            case WriteDescriptorArray::BufferInfo:
+                if (src.pBufferInfo) {
+                    dst.pBufferInfo = buffer_info;
+                    for (uint32_t j = 0; j < src.descriptorCount; ++j, ++buffer_info) {
+                        *buffer_info = src.pBufferInfo[j];
+                        buffer_info->buffer = layer_data->Unwrap(src.pBufferInfo[j].buffer);
+                    }
+                }
+                break;
+            case WriteDescriptorArray::TexelBufferView:
+                if (src.pTexelBufferView) {
+                    dst.pTexelBufferView = texel_buffer_view;
+                    for (uint32_t j = 0; j < src.descriptorCount; ++j, ++texel_buffer_view) {
+                        *texel_buffer_view = layer_data->Unwrap(src.pTexelBufferView[j]);
+                    }
+                }
+                break;
+            case WriteDescriptorArray::None:
+                break;
+        }
+    }
+    for (uint32_t i = 0; i < descriptorCopyCount; ++i) {
+        VkCopyDescriptorSet &dst = scratch.copies[i];
+        dst = pDescriptorCopies[i];
+        dst.srcSet = layer_data->Unwrap(pDescriptorCopies[i].srcSet);
+        dst.dstSet = layer_data->Unwrap(pDescriptorCopies[i].dstSet);
+    }
+}
+
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    thread_local UpdateDescriptorSetsScratch thread_scratch;
+    // The layer itself can update descriptor sets while the scratch of the thread is used, that call gets its own arrays
+    UpdateDescriptorSetsScratch nested_scratch;
+    UpdateDescriptorSetsScratch &scratch = thread_scratch.in_use ? nested_scratch : thread_scratch;
+    scratch.in_use = true;
+
+    if (pDescriptorWrites || pDescriptorCopies) {
+        UnwrapDescriptorUpdates(layer_data, scratch, pDescriptorWrites ? descriptorWriteCount : 0, pDescriptorWrites,
+                                pDescriptorCopies ? descriptorCopyCount : 0, pDescriptorCopies);
+    }
+    layer_data->device_dispatch_table.UpdateDescriptorSets(
+        device, descriptorWriteCount, pDescriptorWrites ? scratch.writes.data() : nullptr, descriptorCopyCount,
+        pDescriptorCopies ? scratch.copies.data() : nullptr);
+
+    for (void *pnext_chain : scratch.pnext_chains) {
+        vku::FreePnextChain(pnext_chain);
+    }
+    // Only the capacity is kept for the next call
+    scratch.pnext_chains.clear();
+    scratch.in_use = false;
+}
+
 void DispatchUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
                                              VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void *pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
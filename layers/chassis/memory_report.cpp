@@ -0,0 +1,242 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chassis/memory_report.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "chassis/entry_point_timing.h"
+#include "generated/chassis.h"
+#include "utils/arena_allocator.h"
+
+namespace vvl {
+
+static_assert(LayerObjectTypeMaxEnum <= 16, "MemoryReport::kMaxObjectTypes is too small");
+static_assert(DeviceMemoryStats::kMaxMemoryTypes == VK_MAX_MEMORY_TYPES, "DeviceMemoryStats::kMaxMemoryTypes mismatch");
+static_assert(DeviceMemoryStats::kMaxMemoryHeaps == VK_MAX_MEMORY_HEAPS, "DeviceMemoryStats::kMaxMemoryHeaps mismatch");
+static_assert(DeviceMemoryStats::kSizeBucketCount < 255, "size buckets are stored + 1 in a uint8_t");
+
+const char *MemoryCategoryName(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::Image:
+            return "Image";
+        case MemoryCategory::Buffer:
+            return "Buffer";
+        case MemoryCategory::DescriptorSet:
+            return "DescriptorSet";
+        case MemoryCategory::CommandBuffer:
+            return "CommandBuffer";
+        case MemoryCategory::SyncMaps:
+            return "SyncMaps";
+        case MemoryCategory::ShaderModule:
+            return "ShaderModule";
+        case MemoryCategory::GpuAV:
+            return "GpuAV";
+        case MemoryCategory::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+void DeviceMemoryStats::AtomicCounters::Add(uint64_t size, bool small) {
+    live_allocations.fetch_add(1, std::memory_order_relaxed);
+    const uint64_t bytes = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (bytes > peak && !peak_live_bytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+    }
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (small) {
+        small_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void DeviceMemoryStats::AtomicCounters::Remove(uint64_t size) {
+    live_allocations.fetch_sub(1, std::memory_order_relaxed);
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+DeviceMemoryStats::Counters DeviceMemoryStats::AtomicCounters::Load() const {
+    Counters counters;
+    counters.live_allocations = live_allocations.load(std::memory_order_relaxed);
+    counters.live_bytes = live_bytes.load(std::memory_order_relaxed);
+    counters.peak_live_bytes = peak_live_bytes.load(std::memory_order_relaxed);
+    counters.total_allocations = total_allocations.load(std::memory_order_relaxed);
+    counters.small_allocations = small_allocations.load(std::memory_order_relaxed);
+    return counters;
+}
+
+uint32_t DeviceMemoryStats::SizeBucket(uint64_t size) {
+    const uint32_t high = static_cast<uint32_t>(size >> 32);
+    if (high != 0) {
+        return 32 + static_cast<uint32_t>(MostSignificantBit(high));
+    }
+    return static_cast<uint32_t>(std::max(MostSignificantBit(static_cast<uint32_t>(size)), 0));
+}
+
+void DeviceMemoryStats::RecordAllocation(uint32_t memory_type, uint32_t memory_heap, uint64_t size, bool small) {
+    if (memory_type < kMaxMemoryTypes) {
+        memory_types_[memory_type].Add(size, small);
+    }
+    if (memory_heap < kMaxMemoryHeaps) {
+        memory_heaps_[memory_heap].Add(size, small);
+    }
+
+    // The new size is counted before the one leaving the window is removed, a concurrent reader never sees the window
+    // with fewer allocations than it has
+    const uint32_t bucket = SizeBucket(size);
+    recent_sizes_[bucket].fetch_add(1, std::memory_order_relaxed);
+    const uint32_t slot = size_window_next_.fetch_add(1, std::memory_order_relaxed) % kSizeWindow;
+    const uint8_t evicted = size_window_[slot].exchange(static_cast<uint8_t>(bucket + 1), std::memory_order_relaxed);
+    if (evicted != 0) {
+        recent_sizes_[evicted - 1].fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void DeviceMemoryStats::RecordFree(uint32_t memory_type, uint32_t memory_heap, uint64_t size) {
+    if (memory_type < kMaxMemoryTypes) {
+        memory_types_[memory_type].Remove(size);
+    }
+    if (memory_heap < kMaxMemoryHeaps) {
+        memory_heaps_[memory_heap].Remove(size);
+    }
+}
+
+DeviceMemoryStats::Counters DeviceMemoryStats::GetMemoryType(uint32_t memory_type) const {
+    return memory_type < kMaxMemoryTypes ? memory_types_[memory_type].Load() : Counters{};
+}
+
+DeviceMemoryStats::Counters DeviceMemoryStats::GetMemoryHeap(uint32_t memory_heap) const {
+    return memory_heap < kMaxMemoryHeaps ? memory_heaps_[memory_heap].Load() : Counters{};
+}
+
+DeviceMemoryStats::Snapshot DeviceMemoryStats::GetSnapshot() const {
+    Snapshot snapshot;
+    for (uint32_t i = 0; i < kMaxMemoryTypes; ++i) {
+        snapshot.memory_types[i] = memory_types_[i].Load();
+    }
+    for (uint32_t i = 0; i < kMaxMemoryHeaps; ++i) {
+        snapshot.memory_heaps[i] = memory_heaps_[i].Load();
+    }
+    for (uint32_t i = 0; i < kSizeBucketCount; ++i) {
+        snapshot.recent_sizes[i] = recent_sizes_[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+MemoryReport::MemoryReport(const std::string &output_file, uint32_t sample_interval)
+    : output_file_(output_file), sample_interval_(std::max(sample_interval, 1u)) {}
+
+bool MemoryReport::SampleDue(uint32_t object_type) {
+    if (object_type >= kMaxObjectTypes) {
+        return false;
+    }
+    return (submit_counts_[object_type].fetch_add(1, std::memory_order_relaxed) + 1) % sample_interval_ == 0;
+}
+
+void MemoryReport::Record(uint32_t object_type, const MemoryUsage &usage) {
+    if (object_type >= kMaxObjectTypes) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    sample_count_++;
+    ObjectReport &report = objects_[object_type];
+    report.sampled = true;
+    uint64_t total_bytes = 0;
+    for (uint32_t i = 0; i < kMemoryCategoryCount; ++i) {
+        const MemoryUsage::Entry &entry = usage.categories[i];
+        report.current[i] = entry;
+        report.peak[i].objects = std::max(report.peak[i].objects, entry.objects);
+        report.peak[i].bytes = std::max(report.peak[i].bytes, entry.bytes);
+        total_bytes += entry.bytes;
+    }
+    report.peak_total_bytes = std::max(report.peak_total_bytes, total_bytes);
+}
+
+void MemoryReport::RecordDeviceMemory(const DeviceMemoryStats::Snapshot &snapshot) {
+    std::lock_guard<std::mutex> guard(lock_);
+    device_memory_ = snapshot;
+}
+
+static void WriteDeviceMemoryCounters(std::ostream &out, const char *index_name,
+                                      const DeviceMemoryStats::Counters *counters, uint32_t count) {
+    bool first = true;
+    for (uint32_t i = 0; i < count; ++i) {
+        const DeviceMemoryStats::Counters &entry = counters[i];
+        if (entry.total_allocations == 0) continue;
+        out << (first ? "\n" : ",\n") << "  {\"" << index_name << "\": " << i
+            << ", \"live_allocations\": " << entry.live_allocations << ", \"live_bytes\": " << entry.live_bytes
+            << ", \"peak_live_bytes\": " << entry.peak_live_bytes << ", \"total_allocations\": " << entry.total_allocations
+            << ", \"small_allocations\": " << entry.small_allocations << "}";
+        first = false;
+    }
+}
+
+void MemoryReport::WriteReport() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::ofstream out(output_file_);
+    if (!out) {
+        printf("Validation Setting Warning - could not open %s to write the memory report\n", output_file_.c_str());
+        return;
+    }
+
+    // The peaks of each category are taken independently, their sum can be above peak_total_bytes
+    out << "{\n\"samples\": " << sample_count_ << ",\n\"objects\": [\n";
+    bool first_object = true;
+    for (uint32_t object_type = 0; object_type < kMaxObjectTypes; ++object_type) {
+        const ObjectReport &report = objects_[object_type];
+        if (!report.sampled) continue;
+        out << (first_object ? "" : ",\n") << "{\"object\": \"" << LayerObjectTypeName(object_type)
+            << "\", \"peak_total_bytes\": " << report.peak_total_bytes << ", \"categories\": [";
+        bool first_category = true;
+        for (uint32_t i = 0; i < kMemoryCategoryCount; ++i) {
+            if (report.peak[i].objects == 0 && report.peak[i].bytes == 0) continue;
+            out << (first_category ? "\n" : ",\n") << "  {\"category\": \"" << MemoryCategoryName(static_cast<MemoryCategory>(i))
+                << "\", \"objects\": " << report.current[i].objects << ", \"bytes\": " << report.current[i].bytes
+                << ", \"peak_objects\": " << report.peak[i].objects << ", \"peak_bytes\": " << report.peak[i].bytes << "}";
+            first_category = false;
+        }
+        out << "]}";
+        first_object = false;
+    }
+    // The arenas are shared by all the devices, their values are the ones at the time of the report
+    out << "\n],\n\"arenas\": [";
+    for (uint32_t i = 0; i < kArenaCount; ++i) {
+        const ArenaStats stats = arena::GetStats(static_cast<Arena>(i));
+        out << (i == 0 ? "\n" : ",\n") << "  {\"arena\": \"" << ArenaName(static_cast<Arena>(i)) << "\", \"bytes\": " << stats.bytes
+            << ", \"peak_bytes\": " << stats.peak_bytes << ", \"allocations\": " << stats.allocations
+            << ", \"total_allocations\": " << stats.total_allocations << ", \"pooled_allocations\": " << stats.pooled_allocations
+            << ", \"pool_bytes\": " << stats.pool_bytes << "}";
+    }
+    out << "\n]";
+    if (device_memory_) {
+        out << ",\n\"device_memory\": {\n\"memory_types\": [";
+        WriteDeviceMemoryCounters(out, "memory_type", device_memory_->memory_types.data(), DeviceMemoryStats::kMaxMemoryTypes);
+        out << "],\n\"memory_heaps\": [";
+        WriteDeviceMemoryCounters(out, "memory_heap", device_memory_->memory_heaps.data(), DeviceMemoryStats::kMaxMemoryHeaps);
+        // Bucket i is the allocations of [2^i, 2^(i+1)) bytes
+        out << "],\n\"recent_size_log2_histogram\": [";
+        for (uint32_t i = 0; i < DeviceMemoryStats::kSizeBucketCount; ++i) {
+            out << (i == 0 ? "" : ", ") << device_memory_->recent_sizes[i];
+        }
+        out << "]\n}";
+    }
+    out << "\n}\n";
+}
+
+}  // namespace vvl
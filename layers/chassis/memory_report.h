@@ -0,0 +1,176 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+enum class MemoryCategory : uint32_t {
+    Image,
+    Buffer,
+    DescriptorSet,
+    CommandBuffer,
+    SyncMaps,
+    ShaderModule,
+    GpuAV,
+    Count,
+};
+constexpr uint32_t kMemoryCategoryCount = static_cast<uint32_t>(MemoryCategory::Count);
+
+// Estimated host memory held by the state objects of one validation object at a point in time.
+//
+// The estimates are the object sizes plus the capacity of their larger containers, they don't try to follow every heap
+// allocation but are meant to tell which subsystem is the one growing.
+struct MemoryUsage {
+    struct Entry {
+        uint64_t objects = 0;
+        uint64_t bytes = 0;
+    };
+    std::array<Entry, kMemoryCategoryCount> categories{};
+
+    void Add(MemoryCategory category, size_t bytes, uint64_t objects = 1) {
+        Entry &entry = categories[static_cast<uint32_t>(category)];
+        entry.objects += objects;
+        entry.bytes += bytes;
+    }
+
+    // For data shared by several state objects (a spirv::Module used by a shader module and its pipelines), only the
+    // first visit adds its size
+    bool FirstVisit(const void *shared_data) { return visited_.insert(shared_data).second; }
+
+    template <typename T, typename Allocator>
+    static size_t VectorBytes(const std::vector<T, Allocator> &v) {
+        return v.capacity() * sizeof(T);
+    }
+    // Node based and open addressing maps differ, a pointer of overhead per entry is a fair middle
+    template <typename Map>
+    static size_t MapBytes(const Map &map) {
+        return map.size() * (sizeof(typename Map::value_type) + sizeof(void *));
+    }
+
+  private:
+    vvl::unordered_set<const void *> visited_;
+};
+
+// Device memory (vkAllocateMemory) of a device, aggregated per memory type and per heap.
+//
+// Updated with relaxed atomics on every allocation and free, so the checks that look at the totals are O(1) and don't walk the
+// device memory states. The histogram only covers the sizes of the last kSizeWindow allocations, an application that changes
+// its allocation pattern (level streaming for example) shows up there instead of being averaged with its whole history.
+class DeviceMemoryStats {
+  public:
+    // Same as VK_MAX_MEMORY_TYPES and VK_MAX_MEMORY_HEAPS, checked in the .cpp
+    static constexpr uint32_t kMaxMemoryTypes = 32;
+    static constexpr uint32_t kMaxMemoryHeaps = 16;
+    // Bucket i counts the sizes in [2^i, 2^(i+1)), bucket 0 also counts the 0 sized ones
+    static constexpr uint32_t kSizeBucketCount = 64;
+    static constexpr uint32_t kSizeWindow = 1024;
+
+    struct Counters {
+        uint64_t live_allocations = 0;
+        uint64_t live_bytes = 0;
+        uint64_t peak_live_bytes = 0;
+        uint64_t total_allocations = 0;
+        uint64_t small_allocations = 0;
+    };
+    struct Snapshot {
+        std::array<Counters, kMaxMemoryTypes> memory_types{};
+        std::array<Counters, kMaxMemoryHeaps> memory_heaps{};
+        std::array<uint32_t, kSizeBucketCount> recent_sizes{};
+    };
+
+    void RecordAllocation(uint32_t memory_type, uint32_t memory_heap, uint64_t size, bool small);
+    void RecordFree(uint32_t memory_type, uint32_t memory_heap, uint64_t size);
+
+    Counters GetMemoryType(uint32_t memory_type) const;
+    Counters GetMemoryHeap(uint32_t memory_heap) const;
+    Snapshot GetSnapshot() const;
+
+    static uint32_t SizeBucket(uint64_t size);
+
+  private:
+    struct AtomicCounters {
+        std::atomic<uint64_t> live_allocations{0};
+        std::atomic<uint64_t> live_bytes{0};
+        std::atomic<uint64_t> peak_live_bytes{0};
+        std::atomic<uint64_t> total_allocations{0};
+        std::atomic<uint64_t> small_allocations{0};
+
+        void Add(uint64_t size, bool small);
+        void Remove(uint64_t size);
+        Counters Load() const;
+    };
+
+    std::array<AtomicCounters, kMaxMemoryTypes> memory_types_;
+    std::array<AtomicCounters, kMaxMemoryHeaps> memory_heaps_;
+    std::array<std::atomic<uint32_t>, kSizeBucketCount> recent_sizes_{};
+    // Size bucket + 1 of the allocations in the window, 0 for a slot not used yet
+    std::array<std::atomic<uint8_t>, kSizeWindow> size_window_{};
+    std::atomic<uint32_t> size_window_next_{0};
+};
+
+// High water marks of the memory footprint of each validation object of a device, written to a file at device destruction.
+//
+// Validation objects sample their usage every sample_interval queue submissions, and once more when the device is
+// destroyed. Sampling walks all the state objects, so it is only done when the memory_report setting is enabled.
+class MemoryReport {
+  public:
+    MemoryReport(const std::string &output_file, uint32_t sample_interval);
+
+    // True once every sample_interval calls, counted per validation object
+    bool SampleDue(uint32_t object_type);
+    void Record(uint32_t object_type, const MemoryUsage &usage);
+    // Device memory allocations, recorded by the validation object that tracks them at device destruction
+    void RecordDeviceMemory(const DeviceMemoryStats::Snapshot &snapshot);
+
+    // Must only be called once no other thread samples anymore (device destruction)
+    void WriteReport() const;
+
+  private:
+    // Same bound as LayerObjectTypeMaxEnum, checked in the .cpp
+    static constexpr uint32_t kMaxObjectTypes = 16;
+
+    struct ObjectReport {
+        bool sampled = false;
+        MemoryUsage::Entry current[kMemoryCategoryCount]{};
+        MemoryUsage::Entry peak[kMemoryCategoryCount]{};
+        uint64_t peak_total_bytes = 0;
+    };
+
+    const std::string output_file_;
+    const uint32_t sample_interval_;
+    std::array<std::atomic<uint32_t>, kMaxObjectTypes> submit_counts_{};
+
+    mutable std::mutex lock_;
+    uint64_t sample_count_ = 0;
+    std::array<ObjectReport, kMaxObjectTypes> objects_{};
+    std::optional<DeviceMemoryStats::Snapshot> device_memory_;
+};
+
+const char *MemoryCategoryName(MemoryCategory category);
+
+}  // namespace vvl
@@ -0,0 +1,188 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace vvl {
+
+// Fixed width bitset with the interface of std::bitset, for the masks compared in the hot paths (the stage/access masks of
+// syncval).
+//
+// Unlike std::bitset everything but count() is constexpr, so the masks built from the generated tables are compile time
+// constants instead of globals initialized at load time. The operations are loops over a fixed number of 64-bit words that
+// compilers unroll and turn into SSE2/NEON loads and ANDs, and Intersects() does the AND and the test of the result in one
+// pass instead of materializing (a & b) first.
+template <size_t N>
+class bitset {
+  public:
+    static constexpr size_t kWordCount = (N + 63) / 64;
+
+    constexpr bitset() noexcept : words_{} {}
+    constexpr bitset(uint64_t value) noexcept : words_{} { words_[0] = value & WordMask(0); }
+
+    constexpr size_t size() const noexcept { return N; }
+
+    constexpr bool test(size_t pos) const {
+        assert(pos < N);
+        return (words_[pos / 64] >> (pos % 64)) & 1;
+    }
+    constexpr bool operator[](size_t pos) const { return test(pos); }
+
+    constexpr bool any() const noexcept {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            bits |= words_[i];
+        }
+        return bits != 0;
+    }
+    constexpr bool none() const noexcept { return !any(); }
+    constexpr bool all() const noexcept { return *this == ~bitset(); }
+    size_t count() const noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            result += std::bitset<64>(words_[i]).count();
+        }
+        return result;
+    }
+
+    // Same as (*this & other).any()
+    constexpr bool Intersects(const bitset &other) const noexcept {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            bits |= words_[i] & other.words_[i];
+        }
+        return bits != 0;
+    }
+
+    constexpr bitset &set() noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] = WordMask(i);
+        }
+        return *this;
+    }
+    constexpr bitset &set(size_t pos, bool value = true) {
+        assert(pos < N);
+        const uint64_t bit = uint64_t(1) << (pos % 64);
+        if (value) {
+            words_[pos / 64] |= bit;
+        } else {
+            words_[pos / 64] &= ~bit;
+        }
+        return *this;
+    }
+    constexpr bitset &reset() noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] = 0;
+        }
+        return *this;
+    }
+    constexpr bitset &reset(size_t pos) { return set(pos, false); }
+
+    constexpr bitset &operator&=(const bitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr bitset &operator|=(const bitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr bitset &operator^=(const bitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr bitset operator~() const noexcept {
+        bitset result;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            result.words_[i] = ~words_[i] & WordMask(i);
+        }
+        return result;
+    }
+
+    constexpr bitset &operator<<=(size_t shift) noexcept {
+        if (shift >= N) {
+            return reset();
+        }
+        const size_t word_shift = shift / 64;
+        const size_t bit_shift = shift % 64;
+        for (size_t i = kWordCount; i-- > 0;) {
+            uint64_t word = 0;
+            if (i >= word_shift) {
+                word = words_[i - word_shift] << bit_shift;
+                if (bit_shift != 0 && i > word_shift) {
+                    word |= words_[i - word_shift - 1] >> (64 - bit_shift);
+                }
+            }
+            words_[i] = word;
+        }
+        words_[kWordCount - 1] &= WordMask(kWordCount - 1);
+        return *this;
+    }
+    constexpr bitset &operator>>=(size_t shift) noexcept {
+        if (shift >= N) {
+            return reset();
+        }
+        const size_t word_shift = shift / 64;
+        const size_t bit_shift = shift % 64;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            uint64_t word = 0;
+            if (i + word_shift < kWordCount) {
+                word = words_[i + word_shift] >> bit_shift;
+                if (bit_shift != 0 && i + word_shift + 1 < kWordCount) {
+                    word |= words_[i + word_shift + 1] << (64 - bit_shift);
+                }
+            }
+            words_[i] = word;
+        }
+        return *this;
+    }
+    constexpr bitset operator<<(size_t shift) const noexcept { return bitset(*this) <<= shift; }
+    constexpr bitset operator>>(size_t shift) const noexcept { return bitset(*this) >>= shift; }
+
+    constexpr bool operator==(const bitset &other) const noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            if (words_[i] != other.words_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    constexpr bool operator!=(const bitset &other) const noexcept { return !(*this == other); }
+
+    friend constexpr bitset operator&(const bitset &a, const bitset &b) noexcept { return bitset(a) &= b; }
+    friend constexpr bitset operator|(const bitset &a, const bitset &b) noexcept { return bitset(a) |= b; }
+    friend constexpr bitset operator^(const bitset &a, const bitset &b) noexcept { return bitset(a) ^= b; }
+
+  private:
+    // The bits past N are always 0
+    static constexpr uint64_t WordMask(size_t word) {
+        return (word + 1 < kWordCount || N % 64 == 0) ? ~uint64_t(0) : (uint64_t(1) << (N % 64)) - 1;
+    }
+
+    uint64_t words_[kWordCount];
+};
+
+}  // namespace vvl
@@ -20,6 +20,7 @@
 
 #include <cmath>
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 #include <memory>
@@ -814,9 +815,26 @@ class small_unordered_map : public small_container<Key, typename vvl::unordered_
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, vvl::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
+// Incremented each time a layer_data instance is freed, a new instance can then get the dispatch key of the freed one
+inline std::atomic<uint64_t> layer_data_generation{0};
+
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
+    // Almost every call of a thread is for the same device, the last lookup of the thread avoids searching the map, and
+    // hashing the key once there are more than 2 instances and devices
+    struct LastLookup {
+        const void *map = nullptr;
+        void *key = nullptr;
+        DATA_T *data = nullptr;
+        uint64_t generation = 0;
+    };
+    thread_local LastLookup last;
+    const uint64_t generation = layer_data_generation.load(std::memory_order_acquire);
+    if (last.key == data_key && last.map == &layer_data_map && last.generation == generation) {
+        return last.data;
+    }
+
     /* TODO: We probably should lock here, or have caller lock */
     DATA_T *&got = layer_data_map[data_key];
 
@@ -824,6 +842,7 @@ DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2>
         got = new DATA_T;
     }
 
+    last = {&layer_data_map, data_key, got, generation};
     return got;
 }
 
@@ -831,6 +850,7 @@ template <typename DATA_T>
 void FreeLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
     delete layer_data_map[data_key];
     layer_data_map.erase(data_key);
+    layer_data_generation.fetch_add(1, std::memory_order_release);
 }
 
 // For the given data key, look up the layer_data instance from given layer_data_map
@@ -0,0 +1,210 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "utils/lock_profile.h"
+
+namespace vvl {
+
+// Dense, index addressed table used to map the unique IDs handed out by handle wrapping back to the driver handles.
+//
+// The unique ID itself encodes where the value lives:
+//
+//   [63 .. 32] generation | [31 .. 0] slot index
+//
+// Lookups (find) never take a lock, they are a couple of atomic loads into a chunk that is never freed or moved while the
+// table is alive. Insertion and removal are much rarer (object create/destroy) and serialize on a single mutex which only
+// guards the free list.
+//
+// Once a slot is released, the next ID handed out for that slot gets a bumped generation, so a stale ID (use after
+// destroy) will not alias the new object living in the same slot.
+//
+// Each slot also holds a tag that the validation objects can set on the live ID (see ObjectLifetimes::ObjectTag), so that
+// checking an object is tracked by them is a comparison next to the slot rather than a lookup of their own maps.
+//
+// The find/pop/end interface mirrors vku::concurrent::unordered_map so call sites can use "iter->second" as before.
+class HandleTable {
+  public:
+    static constexpr uint32_t kChunkShift = 12;
+    static constexpr uint32_t kChunkSize = 1u << kChunkShift;
+    static constexpr uint32_t kMaxChunks = 1u << 16;
+    static constexpr uint64_t kMaxSlots = uint64_t(kChunkSize) * kMaxChunks;
+
+    class FindResult {
+      public:
+        FindResult(bool found, uint64_t value) : result_(found, value) {}
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const { return result_.first == other.result_.first; }
+        bool operator!=(const FindResult &other) const { return result_.first != other.result_.first; }
+        // Make -> act kind of like an iterator.
+        std::pair<bool, uint64_t> *operator->() { return &result_; }
+        const std::pair<bool, uint64_t> *operator->() const { return &result_; }
+
+      private:
+        // (found, stored value)
+        std::pair<bool, uint64_t> result_;
+    };
+
+    HandleTable() = default;
+    HandleTable(const HandleTable &) = delete;
+    HandleTable &operator=(const HandleTable &) = delete;
+    ~HandleTable() {
+        for (auto &chunk : chunks_) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    // Store value and return the new, never zero, unique ID that refers to it
+    uint64_t Insert(uint64_t value) {
+        uint64_t unique_id = 0;
+        {
+            std::lock_guard<decltype(free_list_lock_)> guard(free_list_lock_);
+            if (!free_list_.empty()) {
+                unique_id = free_list_.back();
+                free_list_.pop_back();
+            } else {
+                const uint64_t slot = next_slot_++;
+                assert(slot < kMaxSlots);
+                const uint32_t chunk_index = static_cast<uint32_t>(slot >> kChunkShift);
+                if (chunks_[chunk_index].load(std::memory_order_relaxed) == nullptr) {
+                    chunks_[chunk_index].store(new Entry[kChunkSize], std::memory_order_release);
+                }
+                unique_id = MakeId(1, slot);
+            }
+        }
+        Entry &entry = GetEntry(SlotOf(unique_id));
+        entry.value.store(value, std::memory_order_relaxed);
+        entry.tag.store(0, std::memory_order_relaxed);
+        // Publishing the ID is what makes the value visible to find()
+        entry.id.store(unique_id, std::memory_order_release);
+        return unique_id;
+    }
+
+    FindResult find(uint64_t unique_id) const {
+        const Entry *entry = TryGetEntry(unique_id);
+        if (!entry || entry->id.load(std::memory_order_acquire) != unique_id) {
+            return end();
+        }
+        const uint64_t value = entry->value.load(std::memory_order_acquire);
+        // If the slot got released (and possibly reused) while reading the value, treat it as not found
+        if (entry->id.load(std::memory_order_acquire) != unique_id) {
+            return end();
+        }
+        return FindResult(true, value);
+    }
+
+    bool contains(uint64_t unique_id) const { return find(unique_id) != end(); }
+
+    // Remove the ID and return what it mapped to
+    FindResult pop(uint64_t unique_id) {
+        Entry *entry = TryGetEntry(unique_id);
+        if (!entry) {
+            return end();
+        }
+        const uint64_t value = entry->value.load(std::memory_order_acquire);
+        uint64_t expected = unique_id;
+        // Only one thread can retire a given ID, the value can't change until the slot is back on the free list
+        if (!entry->id.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+            return end();
+        }
+        Release(unique_id);
+        return FindResult(true, value);
+    }
+
+    void erase(uint64_t unique_id) { pop(unique_id); }
+
+    // Tags are only set on a live ID, a stale ID or a handle that isn't an ID of this table is left untouched
+    void SetTag(uint64_t unique_id, uint64_t tag) {
+        Entry *entry = TryGetEntry(unique_id);
+        if (entry && entry->id.load(std::memory_order_acquire) == unique_id) {
+            entry->tag.store(tag, std::memory_order_release);
+        }
+    }
+
+    // Only clears the tag that was set by the caller
+    void ClearTag(uint64_t unique_id, uint64_t tag) {
+        Entry *entry = TryGetEntry(unique_id);
+        if (entry && entry->id.load(std::memory_order_acquire) == unique_id) {
+            entry->tag.compare_exchange_strong(tag, 0, std::memory_order_acq_rel);
+        }
+    }
+
+    bool HasTag(uint64_t unique_id, uint64_t tag) const {
+        const Entry *entry = TryGetEntry(unique_id);
+        if (!entry || entry->id.load(std::memory_order_acquire) != unique_id) {
+            return false;
+        }
+        const bool tagged = entry->tag.load(std::memory_order_acquire) == tag;
+        // Same as find(), the slot could have been reused while reading the tag
+        return tagged && entry->id.load(std::memory_order_acquire) == unique_id;
+    }
+
+  private:
+    struct Entry {
+        std::atomic<uint64_t> id{0};
+        std::atomic<uint64_t> value{0};
+        std::atomic<uint64_t> tag{0};
+    };
+
+    static constexpr uint64_t MakeId(uint64_t generation, uint64_t slot) { return (generation << 32) | slot; }
+    static constexpr uint64_t SlotOf(uint64_t unique_id) { return unique_id & 0xFFFFFFFFull; }
+    static constexpr uint64_t GenerationOf(uint64_t unique_id) { return unique_id >> 32; }
+
+    Entry &GetEntry(uint64_t slot) const {
+        Entry *chunk = chunks_[slot >> kChunkShift].load(std::memory_order_acquire);
+        assert(chunk);
+        return chunk[slot & (kChunkSize - 1)];
+    }
+
+    Entry *TryGetEntry(uint64_t unique_id) const {
+        const uint64_t slot = SlotOf(unique_id);
+        if (unique_id == 0 || slot >= kMaxSlots) {
+            return nullptr;
+        }
+        Entry *chunk = chunks_[slot >> kChunkShift].load(std::memory_order_acquire);
+        return chunk ? &chunk[slot & (kChunkSize - 1)] : nullptr;
+    }
+
+    void Release(uint64_t unique_id) {
+        uint64_t generation = (GenerationOf(unique_id) + 1) & 0xFFFFFFFFull;
+        // Generation 0 is skipped so that slot 0 can never produce a VK_NULL_HANDLE ID
+        if (generation == 0) {
+            generation = 1;
+        }
+        std::lock_guard<decltype(free_list_lock_)> guard(free_list_lock_);
+        free_list_.emplace_back(MakeId(generation, SlotOf(unique_id)));
+    }
+
+    std::array<std::atomic<Entry *>, kMaxChunks> chunks_{};
+
+    ProfiledMutex<std::mutex, LockSite::HandleTable> free_list_lock_;
+    std::vector<uint64_t> free_list_;
+    uint64_t next_slot_ = 0;
+};
+
+}  // namespace vvl
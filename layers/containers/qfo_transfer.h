@@ -145,6 +145,46 @@ template <typename TransferBarrier>
 using GlobalQFOTransferBarrierMap =
     vvl::concurrent_unordered_map<typename TransferBarrier::HandleType, QFOTransferBarrierSet<TransferBarrier>>;
 
+// GlobalQFOTransferBarrierMap::find() returns a copy of the set of a handle. Batches the lookups and updates of all the barriers
+// of a command buffer, so that the set of each handle is copied once and written back once.
+template <typename TransferBarrier>
+class QFOTransferBarrierSetBatch {
+  public:
+    using HandleType = typename TransferBarrier::HandleType;
+    using GlobalMap = GlobalQFOTransferBarrierMap<TransferBarrier>;
+    using Set = QFOTransferBarrierSet<TransferBarrier>;
+
+    explicit QFOTransferBarrierSetBatch(const GlobalMap &global_map) : global_map_(global_map) {}
+
+    // Pending release barriers of handle, empty if there are none
+    Set &Get(HandleType handle) {
+        auto [it, inserted] = sets_.try_emplace(handle);
+        if (inserted) {
+            const auto found = global_map_.find(handle);
+            if (found != global_map_.cend()) {
+                it->second = found->second;
+            }
+        }
+        return it->second;
+    }
+
+    // global_map must be the map the batch was created from
+    void WriteBack(GlobalMap &global_map) const {
+        assert(&global_map == &global_map_);
+        for (const auto &[handle, set] : sets_) {
+            if (set.empty()) {
+                global_map.erase(handle);
+            } else {
+                global_map.insert_or_assign(handle, set);
+            }
+        }
+    }
+
+  private:
+    const GlobalMap &global_map_;
+    vvl::unordered_map<HandleType, Set> sets_;
+};
+
 // Submit queue uses the Scoreboard to track all release/acquire operations in a batch.
 template <typename TransferBarrier>
 using QFOTransferCBScoreboard =
@@ -27,6 +27,7 @@
 #include <string>
 #include <sstream>
 #include <utility>
+#include <vector>
 #include <cstdint>
 #include "custom_containers.h"
 
@@ -1433,6 +1434,241 @@ class small_range_map {
     std::array<bool, N> in_use_;
 };
 
+// A std::map backed "ImplMap" for range_map, that keeps a flat, sorted index of the stored ranges next to the tree.
+//
+// The tree stays the source of truth, so iterator stability (and with it the split, overwrite_range and infill_update_range
+// semantics) is exactly the one of the plain std::map backend. What changes is lower_bound/upper_bound: once the index is
+// built they search a contiguous array of range begins and jump straight to the stored tree iterator instead of chasing
+// tree nodes.
+//
+// Any insert/erase drops the index. It is only rebuilt once kRebuildLookups lookups happened without an intervening change,
+// so mutation heavy use (command buffer recording) doesn't pay for rebuilds, while lookup heavy use on a stable map (hazard
+// detection at submit time) runs on the flat path.
+//
+// clear() keeps the tree nodes (and whatever storage their mapped values own) for reuse by later inserts, so a map which is
+// repeatedly cleared and refilled, like the access map of a command buffer that is reset and re-recorded, doesn't go back to
+// the heap entry by entry.
+//
+// Allocator is the allocator of the tree nodes.
+//
+// Assumes RangeKey::index_type is unsigned and that stored keys are non-empty, non-overlapping ranges (as range_map ensures)
+template <typename Key, typename T, typename RangeKey = range<Key>,
+          typename Allocator = std::allocator<std::pair<const RangeKey, T>>, size_t kMinIndexSize = 32,
+          uint32_t kRebuildLookups = 4>
+class flat_indexed_range_map {
+    using TreeMap = std::map<RangeKey, T, std::less<RangeKey>, Allocator>;
+
+  public:
+    using mapped_type = T;
+    using key_type = RangeKey;
+    using value_type = typename TreeMap::value_type;
+    using index_type = typename key_type::index_type;
+    using size_type = typename TreeMap::size_type;
+    using iterator = typename TreeMap::iterator;
+    using const_iterator = typename TreeMap::const_iterator;
+    using node_type = typename TreeMap::node_type;
+
+    flat_indexed_range_map() = default;
+    // Indexed iterators refer to the source tree, so copies and moves always start without an index
+    flat_indexed_range_map(const flat_indexed_range_map &other) : map_(other.map_) {}
+    flat_indexed_range_map(flat_indexed_range_map &&other) : map_(std::move(other.map_)) { other.invalidate_index(); }
+    flat_indexed_range_map &operator=(const flat_indexed_range_map &other) {
+        map_ = other.map_;
+        invalidate_index();
+        return *this;
+    }
+    flat_indexed_range_map &operator=(flat_indexed_range_map &&other) {
+        map_ = std::move(other.map_);
+        invalidate_index();
+        other.invalidate_index();
+        return *this;
+    }
+
+    iterator begin() { return map_.begin(); }
+    const_iterator begin() const { return map_.begin(); }
+    const_iterator cbegin() const { return map_.cbegin(); }
+    iterator end() { return map_.end(); }
+    const_iterator end() const { return map_.end(); }
+    const_iterator cend() const { return map_.cend(); }
+
+    bool empty() const { return map_.empty(); }
+    size_type size() const { return map_.size(); }
+
+    iterator find(const key_type &key) { return map_.find(key); }
+    const_iterator find(const key_type &key) const { return map_.find(key); }
+
+    iterator lower_bound(const key_type &key) {
+        if (use_index(key)) {
+            return indexed_bound<false>(key);
+        }
+        return map_.lower_bound(key);
+    }
+    const_iterator lower_bound(const key_type &key) const {
+        if (use_index(key)) {
+            return indexed_bound<false>(key);
+        }
+        return map_.lower_bound(key);
+    }
+
+    iterator upper_bound(const key_type &key) {
+        if (use_index(key)) {
+            return indexed_bound<true>(key);
+        }
+        return map_.upper_bound(key);
+    }
+    const_iterator upper_bound(const key_type &key) const {
+        if (use_index(key)) {
+            return indexed_bound<true>(key);
+        }
+        return map_.upper_bound(key);
+    }
+
+    void clear() {
+        invalidate_index();
+        while (!map_.empty()) {
+            spare_nodes_.emplace_back(map_.extract(map_.begin()));
+        }
+    }
+
+    // Release the nodes kept by clear()
+    void shrink_to_fit() { spare_nodes_ = std::vector<node_type>(); }
+
+    iterator erase(const_iterator pos) {
+        invalidate_index();
+        return map_.erase(pos);
+    }
+    iterator erase(iterator pos) {
+        invalidate_index();
+        return map_.erase(pos);
+    }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert(Value &&value) {
+        invalidate_index();
+        return map_.insert(std::forward<Value>(value));
+    }
+
+    template <typename Value>
+    iterator insert(const_iterator hint, Value &&value) {
+        invalidate_index();
+        if (!spare_nodes_.empty()) {
+            return insert_spare_node(hint, std::forward<Value>(value));
+        }
+        return map_.insert(hint, std::forward<Value>(value));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&...args) {
+        invalidate_index();
+        return map_.emplace(std::forward<Args>(args)...);
+    }
+
+    template <typename Value>
+    iterator emplace_hint(const_iterator hint, Value &&value) {
+        invalidate_index();
+        if (!spare_nodes_.empty()) {
+            return insert_spare_node(hint, std::forward<Value>(value));
+        }
+        return map_.emplace_hint(hint, std::forward<Value>(value));
+    }
+
+    // Build the index now, after which const lookups only read the map and can be made from several threads at once
+    void prepare_concurrent_lookups() const {
+        if (!index_valid_) {
+            build_index();
+        }
+    }
+
+    // For configuration/debug/test use
+    bool index_valid() const { return index_valid_; }
+
+  private:
+    // The tail of the search is a plain count over this many entries, which compilers turn into vector compares
+    static constexpr size_t kLinearSearchSize = 8;
+
+    template <typename Value>
+    iterator insert_spare_node(const_iterator hint, Value &&value) {
+        node_type node = std::move(spare_nodes_.back());
+        spare_nodes_.pop_back();
+        node.key() = value.first;
+        node.mapped() = std::forward<Value>(value).second;
+        return map_.insert(hint, std::move(node));
+    }
+
+    void invalidate_index() {
+        if (index_valid_) {
+            // Keep the capacity, the next rebuild is likely to need about the same
+            begins_.clear();
+            entries_.clear();
+            index_valid_ = false;
+        }
+        lookups_since_change_ = 0;
+    }
+
+    // The index is lazily (re)built even from const lookups, it never changes what the map holds.
+    // Like the rest of the map, this is not safe for concurrent use of the same map from different threads.
+    bool use_index(const key_type &key) const {
+        if (index_valid_) {
+            return key.valid();
+        }
+        if ((map_.size() < kMinIndexSize) || (++lookups_since_change_ < kRebuildLookups)) {
+            return false;
+        }
+        build_index();
+        return key.valid();
+    }
+
+    void build_index() const {
+        auto &map = const_cast<TreeMap &>(map_);
+        begins_.reserve(map.size());
+        entries_.reserve(map.size());
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            begins_.emplace_back(it->first.begin);
+            entries_.emplace_back(it);
+        }
+        index_valid_ = true;
+    }
+
+    // Index of the first entry with begin >= value. Halves the window without data dependent branches and then finishes
+    // with a linear count, which is what makes the lookup cheap compared to the std::map descent.
+    size_t search_begins(const index_type &value) const {
+        const index_type *base = begins_.data();
+        size_t length = begins_.size();
+        while (length > kLinearSearchSize) {
+            const size_t half = length / 2;
+            base = (base[half - 1] < value) ? base + half : base;
+            length -= half;
+        }
+        size_t count = 0;
+        for (size_t i = 0; i < length; ++i) {
+            count += (base[i] < value) ? 1 : 0;
+        }
+        return static_cast<size_t>(base - begins_.data()) + count;
+    }
+
+    // Matches std::map::lower_bound/upper_bound with the range operator <, given begins are unique because the stored
+    // ranges are non-empty and don't overlap
+    template <bool kUpper>
+    iterator indexed_bound(const key_type &key) const {
+        size_t index = search_begins(key.begin);
+        if ((index < begins_.size()) && (begins_[index] == key.begin)) {
+            const index_type &end = entries_[index]->first.end;
+            const bool entry_is_before = kUpper ? !(key.end < end) : (end < key.end);
+            if (entry_is_before) {
+                ++index;
+            }
+        }
+        return (index < entries_.size()) ? entries_[index] : const_cast<TreeMap &>(map_).end();
+    }
+
+    TreeMap map_;
+    std::vector<node_type> spare_nodes_;
+    mutable std::vector<index_type> begins_;
+    mutable std::vector<iterator> entries_;
+    mutable uint32_t lookups_since_change_ = 0;
+    mutable bool index_valid_ = false;
+};
+
 // Forward index iterator, tracking an index value and the appropos lower bound
 // returns an index_type, lower_bound pair.  Supports ++,  offset, and seek affecting the index,
 // lower bound updates as needed. As the index may specify a range for which no entry exist, dereferenced
@@ -0,0 +1,425 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/lock_profile.h"
+
+namespace vvl {
+
+// Epoch based reclamation for state objects that are handed out as raw (borrowed) pointers.
+//
+// A thread reading borrowed pointers holds a Guard, which publishes the global epoch it started at in a slot only that
+// thread writes to. Retire() stamps the object with the current epoch and only releases it once every guard that could
+// have seen it is gone, so a lookup pays no atomic reference count traffic on the object itself.
+//
+// Threads get a slot index on first use. Past kMaxThreads concurrently alive threads the extra ones fall back to a shared
+// counter, which blocks all reclamation while they have a guard, but stays correct.
+class StateEpoch {
+  public:
+    static constexpr uint32_t kMaxThreads = 128;
+    // Retired objects are only scanned for once this many are waiting, destroying objects is usually bursty
+    static constexpr size_t kReclaimThreshold = 64;
+
+    class Guard {
+      public:
+        explicit Guard(StateEpoch &epoch) : epoch_(epoch) { epoch_.Enter(); }
+        ~Guard() { epoch_.Exit(); }
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+      private:
+        StateEpoch &epoch_;
+    };
+
+    StateEpoch() = default;
+    StateEpoch(const StateEpoch &) = delete;
+    StateEpoch &operator=(const StateEpoch &) = delete;
+
+    // Keep the object alive until no guard entered before this call is left
+    void Retire(std::shared_ptr<void> &&object) {
+        if (!object) {
+            return;
+        }
+        std::deque<Retired> to_release;
+        {
+            std::lock_guard<std::mutex> guard(retired_lock_);
+            const uint64_t retire_epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+            retired_.emplace_back(Retired{retire_epoch, std::move(object)});
+            if (retired_.size() >= kReclaimThreshold) {
+                CollectReclaimable(to_release);
+            }
+        }
+        // Releasing the last reference can cascade into other state objects, so do it with no lock held
+    }
+
+    // Release everything that is not borrowed anymore, regardless of kReclaimThreshold
+    void Reclaim() {
+        std::deque<Retired> to_release;
+        std::lock_guard<std::mutex> guard(retired_lock_);
+        CollectReclaimable(to_release);
+    }
+
+    size_t RetiredCount() const {
+        std::lock_guard<std::mutex> guard(retired_lock_);
+        return retired_.size();
+    }
+
+  private:
+    static constexpr uint64_t kInactive = std::numeric_limits<uint64_t>::max();
+
+    struct Retired {
+        uint64_t epoch;
+        std::shared_ptr<void> object;
+    };
+
+    // Own cache line per thread, so entering a guard never bounces a line between threads
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch{kInactive};
+        // Only touched by the owning thread, guards can nest (a hook calling into another hook)
+        uint32_t depth = 0;
+    };
+
+    // Process wide index, recycled when the thread exits
+    struct ThreadIndex {
+        struct Registry {
+            std::mutex lock;
+            std::vector<uint32_t> free_indices;
+            uint32_t next_index = 0;
+        };
+        static Registry &GetRegistry() {
+            static Registry registry;
+            return registry;
+        }
+        ThreadIndex() {
+            Registry &registry = GetRegistry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            if (!registry.free_indices.empty()) {
+                value = registry.free_indices.back();
+                registry.free_indices.pop_back();
+            } else {
+                value = registry.next_index++;
+            }
+        }
+        ~ThreadIndex() {
+            Registry &registry = GetRegistry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            registry.free_indices.emplace_back(value);
+        }
+        uint32_t value = 0;
+    };
+
+    static uint32_t CurrentThreadIndex() {
+        thread_local ThreadIndex index;
+        return index.value;
+    }
+
+    void Enter() {
+        const uint32_t index = CurrentThreadIndex();
+        if (index >= kMaxThreads) {
+            overflow_readers_.fetch_add(1, std::memory_order_seq_cst);
+            return;
+        }
+        Slot &slot = slots_[index];
+        if (slot.depth++ == 0) {
+            // The store must be visible before any lookup done under the guard, Retire() pairs with it
+            slot.epoch.store(global_epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    void Exit() {
+        const uint32_t index = CurrentThreadIndex();
+        if (index >= kMaxThreads) {
+            overflow_readers_.fetch_sub(1, std::memory_order_seq_cst);
+            return;
+        }
+        Slot &slot = slots_[index];
+        if (--slot.depth == 0) {
+            slot.epoch.store(kInactive, std::memory_order_release);
+        }
+    }
+
+    // retired_lock_ must be held
+    void CollectReclaimable(std::deque<Retired> &to_release) {
+        if (overflow_readers_.load(std::memory_order_seq_cst) != 0) {
+            return;
+        }
+        uint64_t min_active = kInactive;
+        for (const Slot &slot : slots_) {
+            min_active = std::min(min_active, slot.epoch.load(std::memory_order_seq_cst));
+        }
+        // Retired in increasing epoch order, a guard that started after an object was retired can't have found it
+        while (!retired_.empty() && retired_.front().epoch < min_active) {
+            to_release.emplace_back(std::move(retired_.front()));
+            retired_.pop_front();
+        }
+    }
+
+    std::atomic<uint64_t> global_epoch_{0};
+    std::array<Slot, kMaxThreads> slots_{};
+    std::atomic<uint32_t> overflow_readers_{0};
+
+    mutable std::mutex retired_lock_;
+    std::deque<Retired> retired_;
+};
+
+// Concurrent map of state objects, with the same interface as vku::concurrent::unordered_map, plus find_borrowed() which
+// returns the raw pointer without copying the shared_ptr out of the map.
+//
+// A borrowed pointer is only valid while the caller holds a StateEpoch::Guard and as long as whoever removes entries
+// (pop) hands the value to the same StateEpoch's Retire().
+//
+// The number of buckets (each with its own lock) is picked at construction from the hardware thread count, with
+// 1 << MinBucketsLog2 as the lower bound. find_borrowed() also goes through a small direct mapped per-thread cache, so a
+// thread looking up the same handles over and over (pipelines, buffers and descriptor sets while recording draws) mostly
+// doesn't touch the bucket locks at all. Cached entries are dropped whenever anything is removed from the map.
+template <typename Key, typename T, int MinBucketsLog2 = 2>
+class ConcurrentStateMap {
+  public:
+    using Element = typename T::element_type;
+
+    class FindResult {
+      public:
+        FindResult(bool found, T value) : result_(found, std::move(value)) {}
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const { return result_.first == other.result_.first; }
+        bool operator!=(const FindResult &other) const { return result_.first != other.result_.first; }
+        // Make -> act kind of like an iterator.
+        std::pair<bool, T> *operator->() { return &result_; }
+        const std::pair<bool, T> *operator->() const { return &result_; }
+
+      private:
+        // (found, copy of the stored value)
+        std::pair<bool, T> result_;
+    };
+
+    ConcurrentStateMap()
+        : buckets_log2_(ComputeBucketsLog2()),
+          buckets_(new Bucket[size_t(1) << buckets_log2_]),
+          removal_generation_(ThreadCache::NewMapGeneration()) {}
+    ConcurrentStateMap(const ConcurrentStateMap &) = delete;
+    ConcurrentStateMap &operator=(const ConcurrentStateMap &) = delete;
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<BucketMutex> lock(bucket.lock);
+        auto [it, inserted] = bucket.map.try_emplace(key);
+        if (inserted) {
+            size_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            BumpRemovalGeneration();
+        }
+        it->second = T(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<BucketMutex> lock(bucket.lock);
+        const bool inserted = bucket.map.insert(std::make_pair(key, T(std::forward<Args>(args)...))).second;
+        if (inserted) {
+            size_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return inserted;
+    }
+
+    size_t erase(const Key &key) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<BucketMutex> lock(bucket.lock);
+        const size_t erased = bucket.map.erase(key);
+        if (erased) {
+            size_.fetch_sub(erased, std::memory_order_relaxed);
+            BumpRemovalGeneration();
+        }
+        return erased;
+    }
+
+    bool contains(const Key &key) const {
+        const Bucket &bucket = GetBucket(key);
+        std::shared_lock<BucketMutex> lock(bucket.lock);
+        return bucket.map.count(key) != 0;
+    }
+
+    FindResult find(const Key &key) const {
+        const Bucket &bucket = GetBucket(key);
+        std::shared_lock<BucketMutex> lock(bucket.lock);
+        const auto it = bucket.map.find(key);
+        if (it == bucket.map.end()) {
+            return end();
+        }
+        return FindResult(true, it->second);
+    }
+
+    // No reference is added, see the class comment for how long the pointer stays valid
+    Element *find_borrowed(const Key &key) const {
+        const uint64_t key_bits = KeyBits(key);
+        // Loaded before the lookup, so a removal racing with it makes the cached entry stale rather than wrong
+        const uint64_t generation = removal_generation_.load(std::memory_order_acquire);
+        typename ThreadCache::Entry &cached = ThreadCache::Get(this, key_bits);
+        if (cached.map == this && cached.key == key_bits && cached.generation == generation) {
+            return static_cast<Element *>(cached.value);
+        }
+
+        const Bucket &bucket = GetBucket(key);
+        Element *value = nullptr;
+        {
+            std::shared_lock<BucketMutex> lock(bucket.lock);
+            const auto it = bucket.map.find(key);
+            if (it == bucket.map.end()) {
+                return nullptr;
+            }
+            value = it->second.get();
+        }
+        cached = {this, key_bits, generation, value};
+        return value;
+    }
+
+    FindResult pop(const Key &key) {
+        Bucket &bucket = GetBucket(key);
+        std::unique_lock<BucketMutex> lock(bucket.lock);
+        auto it = bucket.map.find(key);
+        if (it == bucket.map.end()) {
+            return end();
+        }
+        FindResult result(true, std::move(it->second));
+        bucket.map.erase(it);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        BumpRemovalGeneration();
+        return result;
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
+        std::vector<std::pair<const Key, T>> ret;
+        for (size_t i = 0; i < BucketCount(); ++i) {
+            const Bucket &bucket = buckets_[i];
+            std::shared_lock<BucketMutex> lock(bucket.lock);
+            for (const auto &entry : bucket.map) {
+                if (!f || f(entry.second)) {
+                    ret.emplace_back(entry.first, entry.second);
+                }
+            }
+        }
+        return ret;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < BucketCount(); ++i) {
+            Bucket &bucket = buckets_[i];
+            std::unique_lock<BucketMutex> lock(bucket.lock);
+            size_.fetch_sub(bucket.map.size(), std::memory_order_relaxed);
+            bucket.map.clear();
+        }
+        BumpRemovalGeneration();
+    }
+
+    // Both are a single atomic load, GetStateMap() checks empty() on every lookup of instance scope objects
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+    size_t BucketCount() const { return size_t(1) << buckets_log2_; }
+
+  private:
+    static constexpr uint32_t kMaxBucketsLog2 = 6;
+
+    using BucketMutex = ProfiledMutex<std::shared_mutex, LockSite::StateMap>;
+    struct alignas(64) Bucket {
+        mutable BucketMutex lock;
+        vvl::unordered_map<Key, T> map;
+    };
+
+    // Direct mapped, shared by all maps on the thread. Entries are only trusted if they were filled for the same map and
+    // the map did not remove anything since.
+    struct ThreadCache {
+        static constexpr uint32_t kEntriesLog2 = 6;
+        struct Entry {
+            const void *map = nullptr;
+            uint64_t key = 0;
+            uint64_t generation = 0;
+            void *value = nullptr;
+        };
+
+        static Entry &Get(const void *map, uint64_t key_bits) {
+            thread_local std::array<Entry, size_t(1) << kEntriesLog2> entries{};
+            const uint64_t hash = (key_bits ^ reinterpret_cast<uintptr_t>(map)) * 0x9E3779B97F4A7C15ull;
+            return entries[hash >> (64 - kEntriesLog2)];
+        }
+
+        // Each map starts at its own generation, so a map allocated at the address of a destroyed one can't match the
+        // entries the old one left behind
+        static uint64_t NewMapGeneration() {
+            static std::atomic<uint64_t> next_base{1};
+            return next_base.fetch_add(uint64_t(1) << 32, std::memory_order_relaxed);
+        }
+    };
+
+    static uint32_t ComputeBucketsLog2() {
+        // A few buckets per hardware thread keeps the chance of two threads hitting the same lock low
+        const uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+        uint32_t log2 = MinBucketsLog2;
+        while (log2 < kMaxBucketsLog2 && (1u << log2) < threads * 4) {
+            ++log2;
+        }
+        return log2;
+    }
+
+    static uint64_t KeyBits(const Key &key) {
+        if constexpr (std::is_pointer_v<Key>) {
+            return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+        } else {
+            return static_cast<uint64_t>(key);
+        }
+    }
+
+    const Bucket &GetBucket(const Key &key) const { return buckets_[BucketOf(key)]; }
+    Bucket &GetBucket(const Key &key) { return buckets_[BucketOf(key)]; }
+
+    size_t BucketOf(const Key &key) const {
+        const uint64_t u64 = KeyBits(key);
+        uint32_t hash = static_cast<uint32_t>(u64 >> 32) + static_cast<uint32_t>(u64);
+        hash ^= (hash >> buckets_log2_) ^ (hash >> (2 * buckets_log2_));
+        return hash & (BucketCount() - 1);
+    }
+
+    void BumpRemovalGeneration() { removal_generation_.fetch_add(1, std::memory_order_acq_rel); }
+
+    const uint32_t buckets_log2_;
+    std::unique_ptr<Bucket[]> buckets_;
+    std::atomic<size_t> size_{0};
+    // Written on every removal only, on its own cache line so lookups don't bounce with the size updates
+    alignas(64) std::atomic<uint64_t> removal_generation_;
+};
+
+}  // namespace vvl
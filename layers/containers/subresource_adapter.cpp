@@ -117,6 +117,9 @@ uint32_t RangeEncoder::LowerBoundWithStartImpl3(VkImageAspectFlags aspect_mask,
 }
 
 void RangeEncoder::PopulateFunctionPointers() {
+    // Encode/Decode handle this case inline, the function pointers are still set for completeness
+    single_aspect_single_mip_ = (limits_.aspect_index == 1) && (limits_.mipLevel == 1);
+
     // Select the encode/decode specialists
     if (limits_.aspect_index == 1) {
         // One aspect use simplified encode/decode math
@@ -167,7 +170,10 @@ RangeEncoder::RangeEncoder(const VkImageSubresourceRange& full_range, const Aspe
       aspect_size_(mip_size_ * full_range.levelCount),
       aspect_bits_(param->AspectBits()),
       encode_function_(nullptr),
-      decode_function_(nullptr) {
+      decode_function_(nullptr),
+      lower_bound_function_(nullptr),
+      lower_bound_with_start_function_(nullptr),
+      single_aspect_single_mip_(false) {
     // Only valid to create an encoder for a *whole* image (i.e. base must be zero, and the specified limits_.selected_aspects
     // *must* be equal to the traits aspect mask. (Encoder range assumes zero bases)
     assert(full_range.aspectMask == limits_.aspectMask);
@@ -89,6 +89,7 @@ class RangeEncoder {
           decode_function_(nullptr),
           lower_bound_function_(nullptr),
           lower_bound_with_start_function_(nullptr),
+          single_aspect_single_mip_(false),
           aspect_base_{0, 0, 0} {}
 
     // Create the encoder suitable to the full range (aspect mask *must* be canonical)
@@ -106,10 +107,21 @@ class RangeEncoder {
                (range.aspectMask & limits_.aspectMask);
     }
 
-    inline IndexType Encode(const Subresource& pos) const { return (this->*(encode_function_))(pos); }
+    // Single aspect, single mip images (most color targets and textures) are encoded inline, the index is the array layer
+    inline IndexType Encode(const Subresource& pos) const {
+        if (single_aspect_single_mip_) {
+            return pos.arrayLayer;
+        }
+        return (this->*(encode_function_))(pos);
+    }
     inline IndexType Encode(const VkImageSubresource& subres) const { return Encode(Subresource(*this, subres)); }
 
-    Subresource Decode(const IndexType& index) const { return (this->*decode_function_)(index); }
+    Subresource Decode(const IndexType& index) const {
+        if (single_aspect_single_mip_) {
+            return Subresource(aspect_bits_[0], 0, static_cast<uint32_t>(index), 0);
+        }
+        return (this->*decode_function_)(index);
+    }
 
     inline Subresource BeginSubresource(const VkImageSubresourceRange& range) const {
         if (!InRange(range)) {
@@ -129,6 +141,9 @@ class RangeEncoder {
     // Suitable for getting a starting value from a range
     inline uint32_t LowerBoundFromMask(VkImageAspectFlags mask) const {
         assert(mask & limits_.aspectMask);
+        if (limits_.aspect_index == 1) {
+            return 0;
+        }
         return (this->*(lower_bound_function_))(mask);
     }
 
@@ -136,12 +151,16 @@ class RangeEncoder {
     // Suitable for seeking the *next* value for a range
     inline uint32_t LowerBoundFromMask(VkImageAspectFlags mask, uint32_t start) const {
         if (start < limits_.aspect_index) {
+            if (limits_.aspect_index == 1) {
+                return (mask & aspect_bits_[0]) ? 0 : limits_.aspect_index;
+            }
             return (this->*(lower_bound_with_start_function_))(mask, start);
         }
         return limits_.aspect_index;
     }
 
     inline IndexType AspectSize() const { return aspect_size_; }
+    inline bool SingleAspectSingleMip() const { return single_aspect_single_mip_; }
     inline IndexType MipSize() const { return mip_size_; }
     inline const Subresource& Limits() const { return limits_; }
     inline const VkImageSubresourceRange& FullRange() const { return full_range_; }
@@ -251,6 +270,7 @@ class RangeEncoder {
     Subresource (RangeEncoder::*decode_function_)(const IndexType&) const;
     uint32_t (RangeEncoder::*lower_bound_function_)(VkImageAspectFlags aspect_mask) const;
     uint32_t (RangeEncoder::*lower_bound_with_start_function_)(VkImageAspectFlags aspect_mask, uint32_t start) const;
+    bool single_aspect_single_mip_;
     IndexType aspect_base_[kMaxSupportedAspect];
 };
 
@@ -757,6 +777,28 @@ class BothRangeMap {
         }
     }
 
+    void clear() {
+        if (SmallMode()) {
+            small_map_->clear();
+        } else {
+            assert(BigMode());
+            big_map_->clear();
+        }
+    }
+
+    // Empty map for a new limit, reconstructed in place in the same storage
+    void Reset(index_type limit) {
+        if (big_map_) {
+            big_map_->~BigMap();
+        }
+        if (small_map_) {
+            small_map_->~SmallMap();
+        }
+        mode_ = ComputeMode(limit);
+        big_map_ = MakeBigMap();
+        small_map_ = MakeSmallMap(limit);
+    }
+
     inline bool SmallMode() const { return BothRangeMapMode::kSmall == mode_; }
     inline bool BigMode() const { return BothRangeMapMode::kBig == mode_; }
     inline bool Tristate() const { return BothRangeMapMode::kTristate == mode_; }
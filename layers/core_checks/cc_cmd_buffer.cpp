@@ -383,7 +383,8 @@ bool CoreChecks::ValidateCmdBindIndexBuffer(const vvl::CommandBuffer &cb_state,
     const bool is_2 = loc.function == Func::vkCmdBindIndexBuffer2KHR;
     const char *vuid;
 
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    const auto borrow_guard = BorrowGuard();
+    const auto *buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;  // if using nullDescriptors
     const LogObjectList objlist(cb_state.Handle(), buffer);
 
@@ -425,7 +426,8 @@ bool CoreChecks::PreCallValidateCmdBindIndexBuffer2KHR(VkCommandBuffer commandBu
     skip |= ValidateCmdBindIndexBuffer(*cb_state, buffer, offset, indexType, error_obj.location);
 
     if (size != VK_WHOLE_SIZE && buffer != VK_NULL_HANDLE) {
-        auto buffer_state = Get<vvl::Buffer>(buffer);
+        const auto borrow_guard = BorrowGuard();
+        const auto *buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         if (!buffer_state) return skip;  // if using nullDescriptors
 
         const VkDeviceSize offset_align = static_cast<VkDeviceSize>(GetIndexAlignment(indexType));
@@ -451,8 +453,9 @@ bool CoreChecks::PreCallValidateCmdBindVertexBuffers(VkCommandBuffer commandBuff
 
     bool skip = false;
     skip |= ValidateCmd(*cb_state, error_obj.location);
+    const auto borrow_guard = BorrowGuard();
     for (uint32_t i = 0; i < bindingCount; ++i) {
-        auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
+        const auto *buffer_state = GetBorrowed<vvl::Buffer>(pBuffers[i]);
         if (!buffer_state) continue;  // if using nullDescriptors
 
         const LogObjectList objlist(commandBuffer, buffer_state->Handle());
@@ -866,6 +869,63 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         }
     }
 
+    // Validate initial layout uses vs. the primary cmd buffer state
+    // Novel Valid usage: "UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001"
+    // initial layout usage of secondary command buffers resources must match parent command buffer
+    //
+    // This is the part that grows with the number of images each secondary touches, and it only reads the command buffer
+    // states, so the secondaries are compared on the validation worker pool. The mismatches are reported in the loop below, the
+    // errors stay in pCommandBuffers order.
+    struct InitialLayoutMismatch {
+        VkImage image;
+        ImageSubresourceLayoutMap::RangeType range;
+        VkImageLayout sub_layout;
+        VkImageLayout cb_layout;
+        const char *layout_type;
+    };
+    std::vector<std::vector<InitialLayoutMismatch>> layout_mismatches(commandBuffersCount);
+    vvl::ParallelFor(validation_worker_pool.get(), commandBuffersCount, [&](uint32_t i) {
+        const auto &sub_cb_state = *GetRead<vvl::CommandBuffer>(pCommandBuffers[i]);
+        for (const auto &sub_layout_map_entry : sub_cb_state.image_layout_map) {
+            const auto image = sub_layout_map_entry.first;
+
+            const auto cb_subres_map = cb_state.GetImageSubresourceLayoutMap(image);
+            // Const getter can be null in which case we have nothing to check against for this image...
+            if (!cb_subres_map) continue;
+
+            const auto &sub_layout_map = sub_layout_map_entry.second.map->GetLayoutMap();
+            const auto &cb_layout_map = cb_subres_map->GetLayoutMap();
+            for (sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> iter(sub_layout_map, cb_layout_map,
+                                                                                                      0);
+                 !iter->range.empty(); ++iter) {
+                VkImageLayout cb_layout = kInvalidLayout, sub_layout = kInvalidLayout;
+                const char *layout_type;
+
+                if (!iter->pos_A->valid || !iter->pos_B->valid) continue;
+
+                // pos_A denotes the sub CB map in the parallel iterator
+                sub_layout = iter->pos_A->lower_bound->second.initial_layout;
+                if (VK_IMAGE_LAYOUT_UNDEFINED == sub_layout) continue;  // secondary doesn't care about current or initial
+
+                // pos_B denotes the main CB map in the parallel iterator
+                const auto &cb_layout_state = iter->pos_B->lower_bound->second;
+                if (cb_layout_state.current_layout != kInvalidLayout) {
+                    layout_type = "current";
+                    cb_layout = cb_layout_state.current_layout;
+                } else if (cb_layout_state.initial_layout != kInvalidLayout) {
+                    layout_type = "initial";
+                    cb_layout = cb_layout_state.initial_layout;
+                } else {
+                    continue;
+                }
+                if (sub_layout != cb_layout) {
+                    layout_mismatches[i].emplace_back(
+                        InitialLayoutMismatch{image, iter->range, sub_layout, cb_layout, layout_type});
+                }
+            }
+        }
+    });
+
     for (uint32_t i = 0; i < commandBuffersCount; i++) {
         const auto &sub_cb_state = *GetRead<vvl::CommandBuffer>(pCommandBuffers[i]);
         const Location cb_loc = error_obj.location.dot(Field::pCommandBuffers, i);
@@ -1275,57 +1335,20 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
                              "cannot be submitted with a query in flight and "
                              "inherited queries not supported on this device.");
         }
-        // Validate initial layout uses vs. the primary cmd buffer state
-        // Novel Valid usage: "UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001"
-        // initial layout usage of secondary command buffers resources must match parent command buffer
-        for (const auto &sub_layout_map_entry : sub_cb_state.image_layout_map) {
-            const auto image = sub_layout_map_entry.first;
-
-            const auto cb_subres_map = cb_state.GetImageSubresourceLayoutMap(image);
-            // Const getter can be null in which case we have nothing to check against for this image...
-            if (!cb_subres_map) continue;
-
-            const auto &sub_layout_map = sub_layout_map_entry.second.map->GetLayoutMap();
-            const auto &cb_layout_map = cb_subres_map->GetLayoutMap();
-            for (sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> iter(sub_layout_map, cb_layout_map,
-                                                                                                      0);
-                 !iter->range.empty(); ++iter) {
-                VkImageLayout cb_layout = kInvalidLayout, sub_layout = kInvalidLayout;
-                const char *layout_type;
-
-                if (!iter->pos_A->valid || !iter->pos_B->valid) continue;
-
-                // pos_A denotes the sub CB map in the parallel iterator
-                sub_layout = iter->pos_A->lower_bound->second.initial_layout;
-                if (VK_IMAGE_LAYOUT_UNDEFINED == sub_layout) continue;  // secondary doesn't care about current or initial
-
-                // pos_B denotes the main CB map in the parallel iterator
-                const auto &cb_layout_state = iter->pos_B->lower_bound->second;
-                if (cb_layout_state.current_layout != kInvalidLayout) {
-                    layout_type = "current";
-                    cb_layout = cb_layout_state.current_layout;
-                } else if (cb_layout_state.initial_layout != kInvalidLayout) {
-                    layout_type = "initial";
-                    cb_layout = cb_layout_state.initial_layout;
-                } else {
-                    continue;
-                }
-                if (sub_layout != cb_layout) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index = iter->range.begin; index < iter->range.end; index++) {
-                        const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                        const auto image_state = Get<vvl::Image>(image);
-                        if (!image_state) continue;
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        // VU being worked on https://gitlab.khronos.org/vulkan/vulkan/-/issues/2456
-                        skip |= LogError("UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001", objlist, cb_loc,
-                                         "was executed using %s (subresource: aspectMask 0x%x array layer %" PRIu32
-                                         ", mip level %" PRIu32 ") which expects layout %s--instead, image %s layout is %s.",
-                                         FormatHandle(image).c_str(), subresource.aspectMask, subresource.arrayLayer,
-                                         subresource.mipLevel, string_VkImageLayout(sub_layout), layout_type,
-                                         string_VkImageLayout(cb_layout));
-                    }
-                }
+        for (const InitialLayoutMismatch &mismatch : layout_mismatches[i]) {
+            const auto image_state = Get<vvl::Image>(mismatch.image);
+            if (!image_state) continue;
+            // We can report all the errors for the intersected range directly
+            for (auto index = mismatch.range.begin; index < mismatch.range.end; index++) {
+                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
+                const auto subresource = image_state->subresource_encoder.Decode(index);
+                // VU being worked on https://gitlab.khronos.org/vulkan/vulkan/-/issues/2456
+                skip |= LogError("UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001", objlist, cb_loc,
+                                 "was executed using %s (subresource: aspectMask 0x%x array layer %" PRIu32 ", mip level %" PRIu32
+                                 ") which expects layout %s--instead, image %s layout is %s.",
+                                 FormatHandle(mismatch.image).c_str(), subresource.aspectMask, subresource.arrayLayer,
+                                 subresource.mipLevel, string_VkImageLayout(mismatch.sub_layout), mismatch.layout_type,
+                                 string_VkImageLayout(mismatch.cb_layout));
             }
         }
 
@@ -1602,8 +1625,9 @@ bool CoreChecks::PreCallValidateCmdBindVertexBuffers2(VkCommandBuffer commandBuf
 
     bool skip = false;
     skip |= ValidateCmd(*cb_state, error_obj.location);
+    const auto borrow_guard = BorrowGuard();
     for (uint32_t i = 0; i < bindingCount; ++i) {
-        auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
+        const auto *buffer_state = GetBorrowed<vvl::Buffer>(pBuffers[i]);
         if (!buffer_state) continue;  // if using nullDescriptors
 
         const LogObjectList objlist(commandBuffer, pBuffers[i]);
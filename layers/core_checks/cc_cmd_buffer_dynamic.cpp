@@ -195,12 +195,82 @@ bool CoreChecks::ValidateDynamicStateIsSet(const LastBound& last_bound_state, co
     return false;
 }
 
+// Superset of the states checked by ValidateGraphicsDynamicStateSetStatus() without a pipeline. The conditions on the draw state
+// (depth test enabled, shaders bound, ...) are left out, so this only depends on the device and must be kept in sync with it.
+CBDynamicFlags CoreChecks::GetShaderObjectDynamicStates() const {
+    CBDynamicFlags states;
+    if (!enabled_features.shaderObject) {
+        return states;
+    }
+    for (CBDynamicState state :
+         {CB_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE, CB_DYNAMIC_STATE_CULL_MODE, CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE,
+          CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE, CB_DYNAMIC_STATE_STENCIL_TEST_ENABLE, CB_DYNAMIC_STATE_DEPTH_BIAS_ENABLE,
+          CB_DYNAMIC_STATE_POLYGON_MODE_EXT, CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT, CB_DYNAMIC_STATE_SAMPLE_MASK_EXT,
+          CB_DYNAMIC_STATE_DEPTH_COMPARE_OP, CB_DYNAMIC_STATE_DEPTH_BIAS, CB_DYNAMIC_STATE_DEPTH_BOUNDS,
+          CB_DYNAMIC_STATE_STENCIL_COMPARE_MASK, CB_DYNAMIC_STATE_STENCIL_WRITE_MASK, CB_DYNAMIC_STATE_STENCIL_REFERENCE,
+          CB_DYNAMIC_STATE_STENCIL_OP, CB_DYNAMIC_STATE_FRONT_FACE, CB_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+          CB_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY, CB_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE, CB_DYNAMIC_STATE_VERTEX_INPUT_EXT}) {
+        states.set(state);
+    }
+    // Sample locations can only be enabled with the extension
+    if (IsExtEnabled(device_extensions.vk_ext_sample_locations)) states.set(CB_DYNAMIC_STATE_SAMPLE_LOCATIONS_EXT);
+    if (enabled_features.depthBounds) states.set(CB_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE);
+    if (enabled_features.depthClipEnable) states.set(CB_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT);
+    if (enabled_features.depthClipControl) states.set(CB_DYNAMIC_STATE_DEPTH_CLIP_NEGATIVE_ONE_TO_ONE_EXT);
+    if (enabled_features.depthClamp) states.set(CB_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT);
+    if (enabled_features.alphaToOne) states.set(CB_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT);
+    if (IsExtEnabled(device_extensions.vk_ext_conservative_rasterization)) {
+        states.set(CB_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT);
+        states.set(CB_DYNAMIC_STATE_EXTRA_PRIMITIVE_OVERESTIMATION_SIZE_EXT);
+    }
+    if (IsExtEnabled(device_extensions.vk_nv_fragment_coverage_to_color)) {
+        states.set(CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_ENABLE_NV);
+        states.set(CB_DYNAMIC_STATE_COVERAGE_TO_COLOR_LOCATION_NV);
+    }
+    if (enabled_features.shadingRateImage) states.set(CB_DYNAMIC_STATE_SHADING_RATE_IMAGE_ENABLE_NV);
+    if (enabled_features.representativeFragmentTest) states.set(CB_DYNAMIC_STATE_REPRESENTATIVE_FRAGMENT_TEST_ENABLE_NV);
+    if (enabled_features.coverageReductionMode) states.set(CB_DYNAMIC_STATE_COVERAGE_REDUCTION_MODE_NV);
+    if (IsExtEnabled(device_extensions.vk_nv_framebuffer_mixed_samples)) {
+        states.set(CB_DYNAMIC_STATE_COVERAGE_MODULATION_MODE_NV);
+        states.set(CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_ENABLE_NV);
+        states.set(CB_DYNAMIC_STATE_COVERAGE_MODULATION_TABLE_NV);
+    }
+    if (IsExtEnabled(device_extensions.vk_ext_provoking_vertex)) states.set(CB_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT);
+    // Logic op can only be enabled with the feature
+    if (enabled_features.logicOp) {
+        states.set(CB_DYNAMIC_STATE_LOGIC_OP_ENABLE_EXT);
+        states.set(CB_DYNAMIC_STATE_LOGIC_OP_EXT);
+    }
+    if (enabled_features.pipelineFragmentShadingRate) states.set(CB_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
+    if (enabled_features.attachmentFeedbackLoopDynamicState) states.set(CB_DYNAMIC_STATE_ATTACHMENT_FEEDBACK_LOOP_ENABLE_EXT);
+    // A tessellation or geometry shader object can't be created without the feature
+    if (enabled_features.tessellationShader) states.set(CB_DYNAMIC_STATE_TESSELLATION_DOMAIN_ORIGIN_EXT);
+    if (enabled_features.geometryShader && enabled_features.geometryStreams) {
+        states.set(CB_DYNAMIC_STATE_RASTERIZATION_STREAM_EXT);
+    }
+    if (enabled_features.exclusiveScissor) {
+        states.set(CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_ENABLE_NV);
+        states.set(CB_DYNAMIC_STATE_EXCLUSIVE_SCISSOR_NV);
+    }
+    if (IsExtEnabled(device_extensions.vk_nv_clip_space_w_scaling)) states.set(CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_ENABLE_NV);
+    if (IsExtEnabled(device_extensions.vk_nv_viewport_swizzle)) states.set(CB_DYNAMIC_STATE_VIEWPORT_SWIZZLE_NV);
+    return states;
+}
+
 // Goal to move all of ValidateGraphicsDynamicStatePipelineSetStatus() and ValidateDrawDynamicStateShaderObject() here and remove
 // them
 bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const {
     bool skip = false;
     const vvl::CommandBuffer& cb_state = last_bound_state.cb_state;
     const bool has_pipeline = last_bound_state.pipeline_state != nullptr;
+
+    // Most draws have every state they need set already, which only takes comparing two masks
+    const CBDynamicFlags& required_states =
+        has_pipeline ? last_bound_state.pipeline_state->dynamic_state : shader_object_dynamic_states;
+    if ((required_states & ~cb_state.dynamic_state_status.cb).none()) {
+        return skip;
+    }
+
     const bool vertex_shader_bound = has_pipeline || last_bound_state.IsValidShaderBound(ShaderObjectStage::VERTEX);
     const bool fragment_shader_bound = has_pipeline || last_bound_state.IsValidShaderBound(ShaderObjectStage::FRAGMENT);
     const bool geom_shader_bound = has_pipeline || last_bound_state.IsValidShaderBound(ShaderObjectStage::GEOMETRY);
@@ -404,6 +474,11 @@ bool CoreChecks::ValidateGraphicsDynamicStatePipelineSetStatus(const LastBound&
                          DynamicStatesCommandsToString(unset_status_pipeline).c_str());
     }
 
+    // Nothing else to check when the command buffer set every dynamic state of the pipeline
+    if ((pipeline.dynamic_state & ~cb_state.dynamic_state_status.cb).none()) {
+        return skip;
+    }
+
     // build the mask of what has been set in the Pipeline, but yet to be set in the Command Buffer
     const CBDynamicFlags state_status_cb = ~((cb_state.dynamic_state_status.cb ^ pipeline.dynamic_state) & pipeline.dynamic_state);
 
@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -679,6 +680,67 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
     return skip;
 }
 
+// Copies with thousands of regions made the pairwise source/destination overlap check quadratic.
+// For non sparse buffers the destination regions are a single list of ranges in the bound memory, sorted once so that each
+// source region can rule out any overlap with a binary search. Only the regions that may overlap go through the pairwise
+// check, which reports the errors.
+class CopyBufferOverlapFilter {
+  public:
+    template <typename RegionType>
+    CopyBufferOverlapFilter(const vvl::Buffer &src_buffer_state, const vvl::Buffer &dst_buffer_state, uint32_t region_count,
+                            const RegionType *regions) {
+        const MEM_BINDING *src_binding = src_buffer_state.sparse ? nullptr : src_buffer_state.Binding();
+        const MEM_BINDING *dst_binding = dst_buffer_state.sparse ? nullptr : dst_buffer_state.Binding();
+        if (!src_binding || !dst_binding) {
+            // Sparse buffers aren't filtered, and an unbound buffer can't overlap anything
+            filter_all_ = src_buffer_state.sparse || dst_buffer_state.sparse;
+            no_overlap_ = !filter_all_;
+            return;
+        }
+        if (src_binding->memory_state != dst_binding->memory_state) {
+            no_overlap_ = true;
+            return;
+        }
+        src_memory_offset_ = src_binding->memory_offset;
+        dst_ranges_.reserve(region_count);
+        for (uint32_t i = 0; i < region_count; ++i) {
+            if (regions[i].size == 0) {
+                // Empty ranges have their own intersection rules, leave it all to the pairwise check
+                filter_all_ = true;
+                return;
+            }
+            const VkDeviceSize begin = dst_binding->memory_offset + regions[i].dstOffset;
+            dst_ranges_.emplace_back(begin, begin + regions[i].size);
+        }
+        std::sort(dst_ranges_.begin(), dst_ranges_.end());
+        // Running maximum of the range ends, the ranges are sorted by their begin only
+        for (size_t i = 1; i < dst_ranges_.size(); ++i) {
+            dst_ranges_[i].second = std::max(dst_ranges_[i].second, dst_ranges_[i - 1].second);
+        }
+    }
+
+    bool MayOverlap(VkDeviceSize src_offset, VkDeviceSize size) const {
+        if (no_overlap_) return false;
+        if (filter_all_ || size == 0) return true;
+        const VkDeviceSize begin = src_memory_offset_ + src_offset;
+        const VkDeviceSize end = begin + size;
+        // First destination range starting at or after the end of the source range, only the ones before can overlap
+        auto it = std::lower_bound(dst_ranges_.begin(), dst_ranges_.end(), end,
+                                   [](const std::pair<VkDeviceSize, VkDeviceSize> &range, VkDeviceSize value) {
+                                       return range.first < value;
+                                   });
+        if (it == dst_ranges_.begin()) return false;
+        return std::prev(it)->second > begin;
+    }
+
+  private:
+    bool no_overlap_ = false;
+    bool filter_all_ = false;
+    VkDeviceSize src_memory_offset_ = 0;
+    // {begin, max end of all ranges up to this one} in memory space
+    std::vector<std::pair<VkDeviceSize, VkDeviceSize>> dst_ranges_;
+};
+
 template <typename RegionType>
 bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buffer &src_buffer_state,
                                              const vvl::Buffer &dst_buffer_state, uint32_t regionCount, const RegionType *pRegions,
@@ -693,6 +755,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
 
     const LogObjectList src_objlist(cb, dst_buffer_state.Handle());
     const LogObjectList dst_objlist(cb, dst_buffer_state.Handle());
+    const CopyBufferOverlapFilter overlap_filter(src_buffer_state, dst_buffer_state, regionCount, pRegions);
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const RegionType region = pRegions[i];
@@ -732,7 +795,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
         }
 
         // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (!skip && !are_buffers_sparse) {
+        if (!skip && !are_buffers_sparse && overlap_filter.MayOverlap(region.srcOffset, region.size)) {
             auto src_region = sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size};
             for (uint32_t j = 0; j < regionCount; j++) {
                 auto dst_region =
@@ -1922,31 +1985,43 @@ bool CoreChecks::ValidateImageBounds(const HandleT handle, const vvl::Image &ima
     bool skip = false;
     const VkImageCreateInfo *image_info = &(image_state.create_info);
 
+    // Streaming uploads use thousands of regions, most of them going to the same few subresources
+    const bool is_blocked_image = vkuFormatIsBlockedImage(image_info->format);
+    const VkExtent3D block_extent = is_blocked_image ? vkuFormatTexelBlockExtent(image_info->format) : VkExtent3D{1, 1, 1};
+    VkImageSubresourceLayers cached_subresource = {};
+    VkExtent3D cached_image_extent = {};
+    bool has_cached_extent = false;
+
     for (uint32_t i = 0; i < regionCount; i++) {
-        const Location region_loc = loc.dot(Field::pRegions, i);
-        const RegionType region = pRegions[i];
+        const RegionType &region = pRegions[i];
         VkExtent3D extent = GetExtent(region);
         VkOffset3D offset = GetOffset(region, is_src);
         VkImageSubresourceLayers subresource_layout = GetImageSubresource(region, is_src);
 
-        VkExtent3D image_extent = image_state.GetEffectiveSubresourceExtent(subresource_layout);
-
-        // If we're using a blocked image format, valid extent is rounded up to multiple of block size (per
-        // vkspec.html#_common_operation)
-        if (vkuFormatIsBlockedImage(image_info->format)) {
-            auto block_extent = vkuFormatTexelBlockExtent(image_info->format);
-            if (image_extent.width % block_extent.width) {
-                image_extent.width += (block_extent.width - (image_extent.width % block_extent.width));
-            }
-            if (image_extent.height % block_extent.height) {
-                image_extent.height += (block_extent.height - (image_extent.height % block_extent.height));
-            }
-            if (image_extent.depth % block_extent.depth) {
-                image_extent.depth += (block_extent.depth - (image_extent.depth % block_extent.depth));
+        if (!has_cached_extent || cached_subresource.mipLevel != subresource_layout.mipLevel ||
+            cached_subresource.aspectMask != subresource_layout.aspectMask) {
+            cached_subresource = subresource_layout;
+            cached_image_extent = image_state.GetEffectiveSubresourceExtent(subresource_layout);
+            has_cached_extent = true;
+
+            // If we're using a blocked image format, valid extent is rounded up to multiple of block size (per
+            // vkspec.html#_common_operation)
+            if (is_blocked_image) {
+                if (cached_image_extent.width % block_extent.width) {
+                    cached_image_extent.width += (block_extent.width - (cached_image_extent.width % block_extent.width));
+                }
+                if (cached_image_extent.height % block_extent.height) {
+                    cached_image_extent.height += (block_extent.height - (cached_image_extent.height % block_extent.height));
+                }
+                if (cached_image_extent.depth % block_extent.depth) {
+                    cached_image_extent.depth += (block_extent.depth - (cached_image_extent.depth % block_extent.depth));
+                }
             }
         }
+        VkExtent3D image_extent = cached_image_extent;
 
         if (0 != ExceedsBounds(&offset, &extent, &image_extent)) {
+            const Location region_loc = loc.dot(Field::pRegions, i);
             const LogObjectList objlist(handle, image_state.Handle());
             skip |= LogError(vuid, objlist, region_loc,
                              "exceeds image bounds\n"
@@ -1970,14 +2045,14 @@ bool CoreChecks::ValidateBufferBounds(VkCommandBuffer cb, const vvl::Image &imag
     const VkDeviceSize buffer_size = buff_state.create_info.size;
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        const Location region_loc = loc.dot(Field::pRegions, i);
-        const RegionType region = pRegions[i];
+        const RegionType &region = pRegions[i];
         const VkDeviceSize buffer_copy_size =
             GetBufferSizeFromCopyImage(region, image_state.create_info.format, image_state.create_info.arrayLayers);
         // This blocks against invalid VkBufferCopyImage that already have been caught elsewhere
         if (buffer_copy_size != 0) {
             const VkDeviceSize max_buffer_copy = buffer_copy_size + region.bufferOffset;
             if (buffer_size < max_buffer_copy) {
+                const Location region_loc = loc.dot(Field::pRegions, i);
                 const LogObjectList objlist(cb, buff_state.Handle());
                 skip |= LogError(vuid, objlist, region_loc,
                                  "is trying to copy %" PRIu64 " bytes plus %" PRIu64
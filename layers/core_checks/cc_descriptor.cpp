@@ -30,6 +30,7 @@
 #include "generated/spirv_grammar_helper.h"
 #include "drawdispatch/descriptor_validator.h"
 #include "drawdispatch/drawdispatch_vuids.h"
+#include "utils/trace_markers.h"
 
 using DescriptorSet = vvl::DescriptorSet;
 using DescriptorSetLayout = vvl::DescriptorSetLayout;
@@ -269,18 +270,11 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
                     uint32_t cur_dyn_offset = total_dynamic_descriptors;
                     // offset into this descriptor set
                     uint32_t set_dyn_offset = 0;
-                    const auto binding_count = dsl->GetBindingCount();
                     const auto &limits = phys_dev_props.limits;
-                    for (uint32_t i = 0; i < binding_count; i++) {
-                        const auto *binding = dsl->GetDescriptorSetLayoutBindingPtrFromIndex(i);
-                        // skip checking binding if not needed
-                        if (vvl::IsDynamicDescriptor(binding->descriptorType) == false) {
-                            continue;
-                        }
-
+                    for (const auto &dynamic_binding : dsl->GetDynamicBindings()) {
                         // If a descriptor set has only binding 0 and 2 the binding_index will be 0 and 2
-                        const uint32_t binding_index = binding->binding;
-                        const uint32_t descriptorCount = binding->descriptorCount;
+                        const uint32_t binding_index = dynamic_binding.binding;
+                        const uint32_t descriptorCount = dynamic_binding.count;
 
                         // Need to loop through each descriptor count inside the binding
                         // if descriptorCount is zero the binding with a dynamic descriptor type does not count
@@ -294,7 +288,7 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
                             }
 
                             // Validate alignment with limit
-                            if ((binding->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) &&
+                            if ((dynamic_binding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) &&
                                 (SafeModulo(offset, limits.minUniformBufferOffsetAlignment) != 0)) {
                                 const char *vuid = is_2 ? "VUID-VkBindDescriptorSetsInfoKHR-pDynamicOffsets-01971"
                                                         : "VUID-vkCmdBindDescriptorSets-pDynamicOffsets-01971";
@@ -304,7 +298,7 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
                                                  "device limit minUniformBufferOffsetAlignment %" PRIu64 ".",
                                                  offset, limits.minUniformBufferOffsetAlignment);
                             }
-                            if ((binding->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) &&
+                            if ((dynamic_binding.type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) &&
                                 (SafeModulo(offset, limits.minStorageBufferOffsetAlignment) != 0)) {
                                 const char *vuid = is_2 ? "VUID-VkBindDescriptorSetsInfoKHR-pDynamicOffsets-01972"
                                                         : "VUID-vkCmdBindDescriptorSets-pDynamicOffsets-01972";
@@ -315,45 +309,41 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
                                                  offset, limits.minStorageBufferOffsetAlignment);
                             }
 
-                            auto *descriptor = descriptor_set->GetDescriptorFromDynamicOffsetIndex(set_dyn_offset);
-                            ASSERT_AND_CONTINUE(descriptor);
-                            // Currently only GeneralBuffer are dynamic and need to be checked
-                            if (descriptor->GetClass() == vvl::DescriptorClass::GeneralBuffer) {
-                                const auto *buffer_descriptor = static_cast<const vvl::BufferDescriptor *>(descriptor);
-                                const VkDeviceSize bound_range = buffer_descriptor->GetRange();
-                                const VkDeviceSize bound_offset = buffer_descriptor->GetOffset();
-                                // NOTE: null / invalid buffers may show up here, errors are raised elsewhere for this.
-                                auto buffer_state = buffer_descriptor->GetBufferState();
-
-                                // Validate offset didn't go over buffer
-                                if ((bound_range == VK_WHOLE_SIZE) && (offset > 0)) {
-                                    const LogObjectList objlist(cb_state.Handle(), pDescriptorSets[set_idx],
-                                                                buffer_descriptor->GetBuffer());
-                                    const char *vuid = is_2 ? "VUID-VkBindDescriptorSetsInfoKHR-pDescriptorSets-06715"
-                                                            : "VUID-vkCmdBindDescriptorSets-pDescriptorSets-06715";
-                                    skip |= LogError(vuid, objlist, loc.dot(Field::pDynamicOffsets, cur_dyn_offset),
-                                                     "is %" PRIu32
-                                                     ", but must be zero since "
-                                                     "the buffer descriptor's range is VK_WHOLE_SIZE in descriptorSet #%" PRIu32
-                                                     " binding #%" PRIu32
-                                                     " "
-                                                     "descriptor[%" PRIu32 "].",
-                                                     offset, set_idx, binding_index, j);
-
-                                } else if (buffer_state && (bound_range != VK_WHOLE_SIZE) &&
-                                           ((offset + bound_range + bound_offset) > buffer_state->create_info.size)) {
-                                    const LogObjectList objlist(cb_state.Handle(), pDescriptorSets[set_idx],
-                                                                buffer_descriptor->GetBuffer());
-                                    const char *vuid = is_2 ? "VUID-VkBindDescriptorSetsInfoKHR-pDescriptorSets-01979"
-                                                            : "VUID-vkCmdBindDescriptorSets-pDescriptorSets-01979";
-                                    skip |=
-                                        LogError(vuid, objlist, loc.dot(Field::pDynamicOffsets, cur_dyn_offset),
-                                                 "is %" PRIu32 ", which when added to the buffer descriptor's range (%" PRIu64
-                                                 ") and offset (%" PRIu64 ") is greater than the size of the buffer (%" PRIu64
-                                                 ") in descriptorSet #%" PRIu32 " binding #%" PRIu32 " descriptor[%" PRIu32 "].",
-                                                 offset, bound_range, bound_offset, buffer_state->create_info.size, set_idx,
-                                                 binding_index, j);
-                                }
+                            const auto *buffer_descriptor = descriptor_set->GetDynamicBufferDescriptor(set_dyn_offset);
+                            ASSERT_AND_CONTINUE(buffer_descriptor);
+                            const VkDeviceSize bound_range = buffer_descriptor->GetRange();
+                            const VkDeviceSize bound_offset = buffer_descriptor->GetOffset();
+                            // NOTE: null / invalid buffers may show up here, errors are raised elsewhere for this.
+                            auto buffer_state = buffer_descriptor->GetBufferState();
+
+                            // Validate offset didn't go over buffer
+                            if ((bound_range == VK_WHOLE_SIZE) && (offset > 0)) {
+                                const LogObjectList objlist(cb_state.Handle(), pDescriptorSets[set_idx],
+                                                            buffer_descriptor->GetBuffer());
+                                const char *vuid = is_2 ? "VUID-VkBindDescriptorSetsInfoKHR-pDescriptorSets-06715"
+                                                        : "VUID-vkCmdBindDescriptorSets-pDescriptorSets-06715";
+                                skip |= LogError(vuid, objlist, loc.dot(Field::pDynamicOffsets, cur_dyn_offset),
+                                                 "is %" PRIu32
+                                                 ", but must be zero since "
+                                                 "the buffer descriptor's range is VK_WHOLE_SIZE in descriptorSet #%" PRIu32
+                                                 " binding #%" PRIu32
+                                                 " "
+                                                 "descriptor[%" PRIu32 "].",
+                                                 offset, set_idx, binding_index, j);
+
+                            } else if (buffer_state && (bound_range != VK_WHOLE_SIZE) &&
+                                       ((offset + bound_range + bound_offset) > buffer_state->create_info.size)) {
+                                const LogObjectList objlist(cb_state.Handle(), pDescriptorSets[set_idx],
+                                                            buffer_descriptor->GetBuffer());
+                                const char *vuid = is_2 ? "VUID-VkBindDescriptorSetsInfoKHR-pDescriptorSets-01979"
+                                                        : "VUID-vkCmdBindDescriptorSets-pDescriptorSets-01979";
+                                skip |=
+                                    LogError(vuid, objlist, loc.dot(Field::pDynamicOffsets, cur_dyn_offset),
+                                             "is %" PRIu32 ", which when added to the buffer descriptor's range (%" PRIu64
+                                             ") and offset (%" PRIu64 ") is greater than the size of the buffer (%" PRIu64
+                                             ") in descriptorSet #%" PRIu32 " binding #%" PRIu32 " descriptor[%" PRIu32 "].",
+                                             offset, bound_range, bound_offset, buffer_state->create_info.size, set_idx,
+                                             binding_index, j);
                             }
                             cur_dyn_offset++;
                             set_dyn_offset++;
@@ -798,6 +788,8 @@ bool CoreChecks::PreCallValidateGetDescriptorSetLayoutSupportKHR(VkDevice device
 bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, uint32_t set_index, const BindingVariableMap &bindings,
                                    const std::vector<uint32_t> &dynamic_offsets, const vvl::CommandBuffer &cb_state,
                                    const Location &loc, const vvl::DrawDispatchVuid &vuids) const {
+    VVL_TRACE_SCOPE("CoreChecks::ValidateDrawState");
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::Descriptors);
     bool result = false;
     VkFramebuffer framebuffer = cb_state.activeFramebuffer ? cb_state.activeFramebuffer->VkHandle() : VK_NULL_HANDLE;
     // NOTE: GPU-AV needs non-const state objects to do lazy updates of descriptor state of only the dynamically used
@@ -1372,11 +1364,21 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
                                               uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies,
                                               const Location &loc) const {
     bool skip = false;
+    // Level loads write thousands of descriptors in one call, borrow the state objects for the whole call instead of copying
+    // a shared_ptr per lookup
+    const auto borrow_guard = BorrowGuard();
+    // Writes are usually grouped by set, only look the set up again when it changes
+    VkDescriptorSet last_dst_set = VK_NULL_HANDLE;
+    const vvl::DescriptorSet *set_node = nullptr;
     // Validate Write updates
     for (uint32_t i = 0; i < descriptorWriteCount; i++) {
         const Location write_loc = loc.dot(Field::pDescriptorWrites, i);
         auto dst_set = pDescriptorWrites[i].dstSet;
-        if (const auto set_node = Get<vvl::DescriptorSet>(dst_set)) {
+        if (dst_set != last_dst_set) {
+            last_dst_set = dst_set;
+            set_node = GetBorrowed<vvl::DescriptorSet>(dst_set);
+        }
+        if (set_node) {
             skip |= ValidateWriteUpdate(*set_node, pDescriptorWrites[i], write_loc, false);
         }
 
@@ -1384,7 +1386,8 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
             vku::FindStructInPNextChain<VkWriteDescriptorSetAccelerationStructureKHR>(pDescriptorWrites[i].pNext);
         if (acceleration_structure_khr) {
             for (uint32_t j = 0; j < acceleration_structure_khr->accelerationStructureCount; ++j) {
-                auto as_state = Get<vvl::AccelerationStructureKHR>(acceleration_structure_khr->pAccelerationStructures[j]);
+                const auto *as_state =
+                    GetBorrowed<vvl::AccelerationStructureKHR>(acceleration_structure_khr->pAccelerationStructures[j]);
                 if (as_state && (as_state->create_info.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR &&
                                  (as_state->create_info.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR &&
                                   as_state->create_info.type != VK_ACCELERATION_STRUCTURE_TYPE_GENERIC_KHR))) {
@@ -1401,7 +1404,8 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
             vku::FindStructInPNextChain<VkWriteDescriptorSetAccelerationStructureNV>(pDescriptorWrites[i].pNext);
         if (acceleration_structure_nv) {
             for (uint32_t j = 0; j < acceleration_structure_nv->accelerationStructureCount; ++j) {
-                auto as_state = Get<vvl::AccelerationStructureNV>(acceleration_structure_nv->pAccelerationStructures[j]);
+                const auto *as_state =
+                    GetBorrowed<vvl::AccelerationStructureNV>(acceleration_structure_nv->pAccelerationStructures[j]);
                 if (as_state && (as_state->create_info.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV &&
                                  as_state->create_info.info.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_NV)) {
                     const LogObjectList objlist(dst_set, as_state->Handle());
@@ -1421,105 +1425,144 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
     return skip;
 }
 
-vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker &device_data, VkDescriptorSet descriptorSet,
-                                                  const vvl::DescriptorUpdateTemplate *template_state, const void *pData,
-                                                  VkDescriptorSetLayout push_layout) {
-    auto const &create_info = template_state->create_info;
-    inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
-    inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
-    inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
-    desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
-    VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
-                                              ? create_info.descriptorSetLayout
-                                              : push_layout;
-    auto ds_layout_state = device_data.Get<vvl::DescriptorSetLayout>(effective_dsl);
-    if (!ds_layout_state) return;
+std::shared_ptr<const vvl::DescriptorUpdateTemplate::DecodedLayout> vvl::DescriptorUpdateTemplate::GetDecodedLayout(
+    const vvl::DescriptorSetLayout &layout) const {
+    {
+        std::lock_guard<std::mutex> guard(decoded_layout_lock_);
+        if (decoded_layout_ && decoded_layout_->layout_def.get() == layout.GetLayoutDef()) {
+            return decoded_layout_;
+        }
+    }
+
+    auto decoded = std::make_shared<DecodedLayout>();
+    decoded->layout_def = layout.GetLayoutId();
+    const auto &layout_def = *decoded->layout_def;
 
     // Create a WriteDescriptorSet struct for each template update entry
     for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        auto binding_count = ds_layout_state->GetDescriptorCountFromBinding(create_info.pDescriptorUpdateEntries[i].dstBinding);
-        auto binding_being_updated = create_info.pDescriptorUpdateEntries[i].dstBinding;
-        auto dst_array_element = create_info.pDescriptorUpdateEntries[i].dstArrayElement;
-
-        desc_writes.reserve(desc_writes.size() + create_info.pDescriptorUpdateEntries[i].descriptorCount);
-        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
-            desc_writes.emplace_back();
-            auto &write_entry = desc_writes.back();
-
-            size_t offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
-            char *update_entry = (char *)(pData) + offset;
+        const auto &update_entry = create_info.pDescriptorUpdateEntries[i];
+        auto binding_count = layout_def.GetDescriptorCountFromBinding(update_entry.dstBinding);
+        auto binding_being_updated = update_entry.dstBinding;
+        auto dst_array_element = update_entry.dstArrayElement;
 
+        decoded->writes.reserve(decoded->writes.size() + update_entry.descriptorCount);
+        for (uint32_t j = 0; j < update_entry.descriptorCount; j++) {
             if (dst_array_element >= binding_count) {
                 dst_array_element = 0;
-                binding_being_updated = ds_layout_state->GetNextValidBinding(binding_being_updated);
+                binding_being_updated = layout_def.GetNextValidBinding(binding_being_updated);
             }
 
-            write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            write_entry.pNext = NULL;
-            write_entry.dstSet = descriptorSet;
+            decoded->offsets.emplace_back(update_entry.offset + j * update_entry.stride);
+            decoded->entries.emplace_back(i);
+
+            VkWriteDescriptorSet write_entry = vku::InitStructHelper();
             write_entry.dstBinding = binding_being_updated;
             write_entry.dstArrayElement = dst_array_element;
             write_entry.descriptorCount = 1;
-            write_entry.descriptorType = create_info.pDescriptorUpdateEntries[i].descriptorType;
-
-            switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
-                case VK_DESCRIPTOR_TYPE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                    write_entry.pImageInfo = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
-                    break;
+            write_entry.descriptorType = update_entry.descriptorType;
 
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                    write_entry.pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
-                    break;
-
-                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                    write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
-                    break;
-                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
-                    VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[i];
-                    inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
-                    inline_info->pNext = nullptr;
-                    inline_info->dataSize = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info->pData = update_entry;
-                    write_entry.pNext = inline_info;
+            switch (update_entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
                     // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlock structure
-                    write_entry.descriptorCount = inline_info->dataSize;
+                    write_entry.descriptorCount = update_entry.descriptorCount;
                     // skip the rest of the array, they just represent bytes in the update
-                    j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    break;
-                }
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
-                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[i];
-                    inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
-                    inline_info_khr->pNext = nullptr;
-                    inline_info_khr->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
-                    write_entry.pNext = inline_info_khr;
+                    j = update_entry.descriptorCount;
+                    decoded->has_extended_infos = true;
                     break;
-                }
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
-                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[i];
-                    inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
-                    inline_info_nv->pNext = nullptr;
-                    inline_info_nv->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
-                    write_entry.pNext = inline_info_nv;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    decoded->has_extended_infos = true;
                     break;
-                }
                 default:
-                    assert(false);
                     break;
             }
+
+            decoded->writes.emplace_back(write_entry);
             dst_array_element++;
         }
     }
+
+    std::lock_guard<std::mutex> guard(decoded_layout_lock_);
+    decoded_layout_ = decoded;
+    return decoded;
+}
+
+vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker &device_data, VkDescriptorSet descriptorSet,
+                                                  const vvl::DescriptorUpdateTemplate *template_state, const void *pData,
+                                                  VkDescriptorSetLayout push_layout) {
+    auto const &create_info = template_state->create_info;
+    VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
+                                              ? create_info.descriptorSetLayout
+                                              : push_layout;
+    auto ds_layout_state = device_data.Get<vvl::DescriptorSetLayout>(effective_dsl);
+    if (!ds_layout_state) return;
+
+    const auto decoded = template_state->GetDecodedLayout(*ds_layout_state);
+    desc_writes = decoded->writes;
+    if (decoded->has_extended_infos) {
+        inline_infos.resize(create_info.descriptorUpdateEntryCount);
+        inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
+        inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
+    }
+
+    for (size_t i = 0; i < desc_writes.size(); i++) {
+        auto &write_entry = desc_writes[i];
+        const uint32_t entry_index = decoded->entries[i];
+        char *update_entry = (char *)(pData) + decoded->offsets[i];
+        write_entry.dstSet = descriptorSet;
+
+        switch (write_entry.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                write_entry.pImageInfo = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                write_entry.pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
+                break;
+            case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
+                VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[entry_index];
+                inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
+                inline_info->pNext = nullptr;
+                inline_info->dataSize = create_info.pDescriptorUpdateEntries[entry_index].descriptorCount;
+                inline_info->pData = update_entry;
+                write_entry.pNext = inline_info;
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
+                VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[entry_index];
+                inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+                inline_info_khr->pNext = nullptr;
+                inline_info_khr->accelerationStructureCount = create_info.pDescriptorUpdateEntries[entry_index].descriptorCount;
+                inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
+                write_entry.pNext = inline_info_khr;
+                break;
+            }
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
+                VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[entry_index];
+                inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
+                inline_info_nv->pNext = nullptr;
+                inline_info_nv->accelerationStructureCount = create_info.pDescriptorUpdateEntries[entry_index].descriptorCount;
+                inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
+                write_entry.pNext = inline_info_nv;
+                break;
+            }
+            default:
+                assert(false);
+                break;
+        }
+    }
 }
 
 std::string vvl::DescriptorSet::StringifySetAndLayout() const {
@@ -1584,31 +1627,27 @@ bool CoreChecks::ValidateBufferUsage(const vvl::Buffer &buffer_state, VkDescript
     return skip;
 }
 
-bool CoreChecks::ValidateBufferUpdate(const VkDescriptorBufferInfo &buffer_info, VkDescriptorType type,
-                                      const Location &buffer_info_loc) const {
+bool CoreChecks::ValidateBufferUpdate(const vvl::Buffer &buffer_state, const VkDescriptorBufferInfo &buffer_info,
+                                      VkDescriptorType type, const Location &buffer_info_loc) const {
     bool skip = false;
-    // Invalid handles should be caught by the object tracker, but lets make sure not to crash anyways.
-    const auto buffer_state = Get<vvl::Buffer>(buffer_info.buffer);
-    ASSERT_AND_RETURN_SKIP(buffer_state);
-
-    skip |= ValidateMemoryIsBoundToBuffer(device, *buffer_state, buffer_info_loc.dot(Field::buffer),
+    skip |= ValidateMemoryIsBoundToBuffer(device, buffer_state, buffer_info_loc.dot(Field::buffer),
                                           "VUID-VkWriteDescriptorSet-descriptorType-00329");
-    skip |= ValidateBufferUsage(*buffer_state, type, buffer_info_loc.dot(Field::buffer));
+    skip |= ValidateBufferUsage(buffer_state, type, buffer_info_loc.dot(Field::buffer));
 
-    if (buffer_info.offset >= buffer_state->create_info.size) {
+    if (buffer_info.offset >= buffer_state.create_info.size) {
         skip |= LogError("VUID-VkDescriptorBufferInfo-offset-00340", buffer_info.buffer, buffer_info_loc.dot(Field::offset),
                          "(%" PRIu64 ") is greater than or equal to buffer size (%" PRIu64 ").", buffer_info.offset,
-                         buffer_state->create_info.size);
+                         buffer_state.create_info.size);
     }
     if (buffer_info.range != VK_WHOLE_SIZE) {
         if (buffer_info.range == 0) {
             skip |= LogError("VUID-VkDescriptorBufferInfo-range-00341", buffer_info.buffer, buffer_info_loc.dot(Field::range),
                              "is not VK_WHOLE_SIZE and is zero.");
         }
-        if (buffer_info.range > (buffer_state->create_info.size - buffer_info.offset)) {
+        if (buffer_info.range > (buffer_state.create_info.size - buffer_info.offset)) {
             skip |= LogError("VUID-VkDescriptorBufferInfo-range-00342", buffer_info.buffer, buffer_info_loc.dot(Field::range),
                              "(%" PRIu64 ") is larger than buffer size (%" PRIu64 ") + offset (%" PRIu64 ").", buffer_info.range,
-                             buffer_state->create_info.size, buffer_info.offset);
+                             buffer_state.create_info.size, buffer_info.offset);
         }
     }
 
@@ -1619,12 +1658,12 @@ bool CoreChecks::ValidateBufferUpdate(const VkDescriptorBufferInfo &buffer_info,
                 LogError("VUID-VkWriteDescriptorSet-descriptorType-00332", buffer_info.buffer, buffer_info_loc.dot(Field::range),
                          "(%" PRIu64 ") is greater than maxUniformBufferRange (%" PRIu32 ") for descriptorType %s.",
                          buffer_info.range, max_ub_range, string_VkDescriptorType(type));
-        } else if (buffer_info.range == VK_WHOLE_SIZE && (buffer_state->create_info.size - buffer_info.offset) > max_ub_range) {
+        } else if (buffer_info.range == VK_WHOLE_SIZE && (buffer_state.create_info.size - buffer_info.offset) > max_ub_range) {
             skip |=
                 LogError("VUID-VkWriteDescriptorSet-descriptorType-00332", buffer_info.buffer, buffer_info_loc.dot(Field::range),
                          "is VK_WHOLE_SIZE, but the effective range [size (%" PRIu64 ") - offset (%" PRIu64 ") = %" PRIu64
                          "] is greater than maxUniformBufferRange (%" PRIu32 ") for descriptorType %s.",
-                         buffer_state->create_info.size, buffer_info.offset, buffer_state->create_info.size - buffer_info.offset,
+                         buffer_state.create_info.size, buffer_info.offset, buffer_state.create_info.size - buffer_info.offset,
                          max_ub_range, string_VkDescriptorType(type));
         }
     } else if (VK_DESCRIPTOR_TYPE_STORAGE_BUFFER == type || VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC == type) {
@@ -1634,12 +1673,12 @@ bool CoreChecks::ValidateBufferUpdate(const VkDescriptorBufferInfo &buffer_info,
                 LogError("VUID-VkWriteDescriptorSet-descriptorType-00333", buffer_info.buffer, buffer_info_loc.dot(Field::range),
                          "(%" PRIu64 ") is greater than maxStorageBufferRange (%" PRIu32 ") for descriptorType %s.",
                          buffer_info.range, max_sb_range, string_VkDescriptorType(type));
-        } else if (buffer_info.range == VK_WHOLE_SIZE && (buffer_state->create_info.size - buffer_info.offset) > max_sb_range) {
+        } else if (buffer_info.range == VK_WHOLE_SIZE && (buffer_state.create_info.size - buffer_info.offset) > max_sb_range) {
             skip |=
                 LogError("VUID-VkWriteDescriptorSet-descriptorType-00333", buffer_info.buffer, buffer_info_loc.dot(Field::range),
                          "is VK_WHOLE_SIZE, but the effective range [size (%" PRIu64 ") - offset (%" PRIu64 ") = %" PRIu64
                          "] is greater than maxStorageBufferRange (%" PRIu32 ") for descriptorType %s.",
-                         buffer_state->create_info.size, buffer_info.offset, buffer_state->create_info.size - buffer_info.offset,
+                         buffer_state.create_info.size, buffer_info.offset, buffer_state.create_info.size - buffer_info.offset,
                          max_sb_range, string_VkDescriptorType(type));
         }
     }
@@ -1944,6 +1983,27 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                                            const Location &write_loc, bool push) const {
     using ImageSamplerDescriptor = vvl::ImageSamplerDescriptor;
     bool skip = false;
+    const auto borrow_guard = BorrowGuard();
+    // The descriptors of a write often all use the same sampler (a bindless array of textures) or buffer (suballocated
+    // uniform buffers), so keep the last lookup of each
+    VkSampler last_sampler = VK_NULL_HANDLE;
+    const vvl::Sampler *last_sampler_state = nullptr;
+    auto get_sampler = [this, &last_sampler, &last_sampler_state](VkSampler sampler) {
+        if (sampler != last_sampler) {
+            last_sampler = sampler;
+            last_sampler_state = GetBorrowed<vvl::Sampler>(sampler);
+        }
+        return last_sampler_state;
+    };
+    VkBuffer last_buffer = VK_NULL_HANDLE;
+    const vvl::Buffer *last_buffer_state = nullptr;
+    auto get_buffer = [this, &last_buffer, &last_buffer_state](VkBuffer buffer) {
+        if (buffer != last_buffer) {
+            last_buffer = buffer;
+            last_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
+        }
+        return last_buffer_state;
+    };
 
     switch (update.descriptorType) {
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: {
@@ -1963,7 +2023,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                 }
                 auto image_layout = update.pImageInfo[di].imageLayout;
                 auto sampler = update.pImageInfo[di].sampler;
-                auto iv_state = Get<vvl::ImageView>(image_view);
+                const auto *iv_state = GetBorrowed<vvl::ImageView>(image_view);
                 ASSERT_AND_CONTINUE(iv_state);
 
                 const auto *image_state = iv_state->image_state.get();
@@ -1971,7 +2031,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
 
                 if (IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
                     if (desc.IsImmutableSampler()) {
-                        auto sampler_state = Get<vvl::Sampler>(desc.GetSampler());
+                        const auto *sampler_state = get_sampler(desc.GetSampler());
                         if (iv_state && sampler_state) {
                             if (iv_state->samplerConversion != sampler_state->samplerConversion) {
                                 const LogObjectList objlist(update.dstSet, desc.GetSampler(), iv_state->Handle());
@@ -2008,8 +2068,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                 }
 
                 // Verify portability
-                if (auto sampler_state = Get<vvl::Sampler>(sampler)) {
-                    if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
+                if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
+                    if (const auto *sampler_state = get_sampler(sampler)) {
                         if ((VK_FALSE == enabled_features.mutableComparisonSamplers) &&
                             (VK_FALSE != sampler_state->create_info.compareEnable)) {
                             skip |= LogError("VUID-VkDescriptorImageInfo-mutableComparisonSamplers-04450", device, write_loc,
@@ -2025,7 +2085,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
             for (uint32_t di = 0; di < update.descriptorCount && !iter.AtEnd(); ++di, ++iter) {
                 const auto &desc = *iter;
                 if (!desc.IsImmutableSampler()) {
-                    if (!ValidateSampler(update.pImageInfo[di].sampler)) {
+                    if (!get_sampler(update.pImageInfo[di].sampler)) {
                         const LogObjectList objlist(update.dstSet, update.pImageInfo[di].sampler);
                         skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-00325", objlist, write_loc,
                                          "Attempted write update to sampler descriptor with invalid sample (%s).",
@@ -2046,7 +2106,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
             for (uint32_t di = 0; di < update.descriptorCount; ++di) {
                 const VkImageView image_view = update.pImageInfo[di].imageView;
                 auto image_layout = update.pImageInfo[di].imageLayout;
-                if (auto iv_state = Get<vvl::ImageView>(image_view)) {
+                if (const auto *iv_state = GetBorrowed<vvl::ImageView>(image_view)) {
                     skip |=
                         ValidateImageUpdate(*iv_state, image_layout, update.descriptorType, write_loc.dot(Field::pImageInfo, di));
                 }
@@ -2060,7 +2120,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                 if (buffer_view == VK_NULL_HANDLE) {
                     continue;
                 }
-                auto bv_state = Get<vvl::BufferView>(buffer_view);
+                const auto *bv_state = GetBorrowed<vvl::BufferView>(buffer_view);
                 if (!bv_state) {
                     skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-02994", device, write_loc,
                                      "Attempted write update to texel buffer descriptor with invalid buffer view (%s).",
@@ -2068,7 +2128,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                     break;
                 }
                 auto buffer = bv_state->create_info.buffer;
-                auto buffer_state = Get<vvl::Buffer>(buffer);
+                const auto *buffer_state = get_buffer(buffer);
                 // Verify that buffer underlying the view hasn't been destroyed prematurely
                 if (!buffer_state) {
                     skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-02994", device, write_loc,
@@ -2087,8 +2147,11 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
             for (uint32_t di = 0; di < update.descriptorCount; ++di) {
                 if (update.pBufferInfo[di].buffer) {
-                    skip |=
-                        ValidateBufferUpdate(update.pBufferInfo[di], update.descriptorType, write_loc.dot(Field::pBufferInfo, di));
+                    // Invalid handles should be caught by the object tracker, but lets make sure not to crash anyways.
+                    const auto *buffer_state = get_buffer(update.pBufferInfo[di].buffer);
+                    ASSERT_AND_CONTINUE(buffer_state);
+                    skip |= ValidateBufferUpdate(*buffer_state, update.pBufferInfo[di], update.descriptorType,
+                                                 write_loc.dot(Field::pBufferInfo, di));
                 }
             }
             break;
@@ -2100,7 +2163,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
             for (uint32_t di = 0; di < update.descriptorCount; ++di) {
                 VkAccelerationStructureNV as = acc_info->pAccelerationStructures[di];
                 // nullDescriptor feature allows this to be VK_NULL_HANDLE
-                if (auto as_state = Get<vvl::AccelerationStructureNV>(as)) {
+                if (const auto *as_state = GetBorrowed<vvl::AccelerationStructureNV>(as)) {
                     skip |= VerifyBoundMemoryIsValid(
                         as_state->MemState(), LogObjectList(as), as_state->Handle(),
                         write_loc.pNext(Struct::VkWriteDescriptorSetAccelerationStructureNV, Field::pAccelerationStructures, di),
@@ -2171,45 +2234,12 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
                 const auto buffer_state_starts = GetBuffersByAddress(start + offset);
 
                 if (!buffer_state_starts.empty()) {
-                    const auto bindings = set_layout->GetBindings();
-                    const auto pSetLayoutSize = set_layout->GetLayoutSizeInBytes();
-                    VkDeviceSize setLayoutSize = 0;
-
-                    if (pSetLayoutSize == nullptr) {
-                        const auto pool = cb_state.command_pool;
-                        DispatchGetDescriptorSetLayoutSizeEXT(pool->dev_data.device, set_layout->VkHandle(), &setLayoutSize);
-                    } else {
-                        setLayoutSize = *pSetLayoutSize;
-                    }
-
-                    if (setLayoutSize > 0) {
-                        // It looks like enough to check last binding in set
-                        for (uint32_t j = 0; j < set_layout->GetBindingCount(); j++) {
-                            const VkDescriptorBindingFlags flags = set_layout->GetDescriptorBindingFlagsFromIndex(j);
-                            const bool vdc = (flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) != 0;
-
-                            if (vdc) {
-                                // If a binding is VARIABLE_DESCRIPTOR_COUNT, the effective setLayoutSize we
-                                // must validate is just the offset of the last binding.
-                                const auto pool = cb_state.command_pool;
-                                uint32_t binding = set_layout->GetDescriptorSetLayoutBindingPtrFromIndex(j)->binding;
-                                DispatchGetDescriptorSetLayoutBindingOffsetEXT(pool->dev_data.device, set_layout->VkHandle(),
-                                                                               binding, &setLayoutSize);
-
-                                // If the descriptor set only consists of VARIABLE_DESCRIPTOR_COUNT bindings, the
-                                // offset may be 0. In this case, treat the descriptor set layout as size 1,
-                                // so we validate that the offset is sensible.
-                                if (set_layout->GetBindingCount() == 1) {
-                                    setLayoutSize = 1;
-                                }
-
-                                // There can only be one binding with VARIABLE_COUNT.
-                                break;
-                            }
-                        }
-                    }
-
-                    if (setLayoutSize > 0) {
+                    const auto *descriptor_buffer_layout = set_layout->GetDescriptorBufferLayout();
+                    if (!descriptor_buffer_layout) {
+                        // The layout has no size in a descriptor buffer, 09006 or 08060 was reported above
+                        valid_binding = true;
+                    } else if (descriptor_buffer_layout->required_size > 0) {
+                        const VkDeviceSize setLayoutSize = descriptor_buffer_layout->required_size;
                         const auto buffer_state_ends = GetBuffersByAddress(start + offset + setLayoutSize - 1);
                         if (!buffer_state_ends.empty()) {
                             valid_binding = true;
@@ -3433,12 +3463,11 @@ bool CoreChecks::ValidateCmdPushDescriptorSet(const vvl::CommandBuffer &cb_state
                     LogError(vuid, objlist, loc, "Set index %" PRIu32 " does not match push descriptor set layout index for %s.",
                              set, FormatHandle(layout).c_str());
             } else {
-                // Create an empty proxy in order to use the existing descriptor set update validation
+                // Use an empty proxy in order to use the existing descriptor set update validation
                 // TODO move the validation (like this) that doesn't need descriptor set state to the DSL object so we
-                // don't have to do this. Note we need to const_cast<>(this) because GPU-AV needs a non-const version of
-                // the state tracker. The proxy here could get away with const.
-                vvl::DescriptorSet proxy_ds(VK_NULL_HANDLE, nullptr, dsl, 0, const_cast<CoreChecks *>(this));
-                skip |= ValidatePushDescriptorsUpdate(proxy_ds, descriptorWriteCount, pDescriptorWrites, loc);
+                // don't need a proxy at all
+                skip |= ValidatePushDescriptorsUpdate(cb_state.GetPushDescriptorValidationSet(dsl), descriptorWriteCount,
+                                                      pDescriptorWrites, loc);
             }
         }
     } else {
@@ -3663,12 +3692,11 @@ bool CoreChecks::ValidateCmdPushDescriptorSetWithTemplate(VkCommandBuffer comman
                              "does not point to a valid layout, it possible the "
                              "VkDescriptorUpdateTemplateCreateInfo::descriptorSetLayout was accidentally destroy.");
         } else {
-            // Create an empty proxy in order to use the existing descriptor set update validation
-            vvl::DescriptorSet proxy_ds(VK_NULL_HANDLE, nullptr, dsl, 0, const_cast<CoreChecks *>(this));
             // Decode the template into a set of write updates
             vvl::DecodedTemplateUpdate decoded_template(*this, VK_NULL_HANDLE, template_state.get(), pData, dsl->VkHandle());
-            // Validate the decoded update against the proxy_ds
-            skip |= ValidatePushDescriptorsUpdate(proxy_ds, static_cast<uint32_t>(decoded_template.desc_writes.size()),
+            // Validate the decoded update against an empty proxy, in order to use the existing descriptor set update validation
+            skip |= ValidatePushDescriptorsUpdate(cb_state->GetPushDescriptorValidationSet(dsl),
+                                                  static_cast<uint32_t>(decoded_template.desc_writes.size()),
                                                   decoded_template.desc_writes.data(), loc);
         }
     }
@@ -450,6 +450,8 @@ void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const L
         });
 
     AdjustValidatorOptions(device_extensions, enabled_features, spirv_val_options, &spirv_val_option_hash);
+    shader_object_dynamic_states = GetShaderObjectDynamicStates();
+    InitSpirvSupport();
 
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
@@ -479,12 +481,45 @@ void CoreChecks::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const L
     }
 }
 
+bool CoreChecks::IsInterceptNeeded(std::string_view hook) const {
+    // Overrides that return right away when their checks are disabled, nothing else runs in them
+    static const vvl::unordered_set<std::string_view> query_hooks = {
+        "PreCallValidateCreateQueryPool",
+        "PreCallValidateDestroyQueryPool",
+        "PreCallValidateGetQueryPoolResults",
+        "PreCallValidateResetQueryPool",
+        "PreCallValidateResetQueryPoolEXT",
+        "PreCallValidateCmdBeginQuery",
+        "PreCallRecordCmdBeginQuery",
+        "PreCallValidateCmdEndQuery",
+        "PreCallRecordCmdEndQuery",
+        "PreCallValidateCmdBeginQueryIndexedEXT",
+        "PreCallRecordCmdBeginQueryIndexedEXT",
+        "PreCallValidateCmdEndQueryIndexedEXT",
+        "PreCallRecordCmdEndQueryIndexedEXT",
+        "PreCallValidateCmdResetQueryPool",
+        "PreCallRecordCmdResetQueryPool",
+        "PreCallValidateCmdWriteTimestamp",
+        "PreCallValidateCmdWriteTimestamp2",
+        "PreCallValidateCmdWriteTimestamp2KHR",
+        "PreCallRecordCmdCopyQueryPoolResults",
+    };
+    if (disabled[query_validation] && query_hooks.count(hook)) {
+        return false;
+    }
+    if (disabled[object_in_use] && hook == "PreCallValidateResetDescriptorPool") {
+        return false;
+    }
+    return true;
+}
+
 void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                             const RecordObject &record_obj) {
     if (!device) return;
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
+    WaitForDeferredSpirvValidations();
     if (core_validation_cache) {
         Location loc(Func::vkDestroyDevice);
         size_t validation_cache_size = 0;
@@ -640,26 +675,6 @@ bool CoreChecks::PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR(VkPhy
                                                                   error_obj);
 }
 
-// Access helper functions for external modules
-VkFormatProperties3KHR CoreChecks::GetPDFormatProperties(const VkFormat format) const {
-    VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
-    VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-
-    if (has_format_feature2) {
-        DispatchGetPhysicalDeviceFormatProperties2Helper(physical_device, format, &fmt_props_2);
-        fmt_props_3.linearTilingFeatures |= fmt_props_2.formatProperties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures |= fmt_props_2.formatProperties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures |= fmt_props_2.formatProperties.bufferFeatures;
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-        fmt_props_3.linearTilingFeatures = format_properties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures = format_properties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures = format_properties.bufferFeatures;
-    }
-    return fmt_props_3;
-}
-
 VkResult CoreChecks::CoreLayerCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator,
                                                        VkValidationCacheEXT *pValidationCache) {
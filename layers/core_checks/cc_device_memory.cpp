@@ -357,14 +357,10 @@ bool CoreChecks::IgnoreAllocationSize(const VkMemoryAllocateInfo &allocate_info)
 }
 
 bool CoreChecks::HasExternalMemoryImportSupport(const vvl::Buffer &buffer, VkExternalMemoryHandleTypeFlagBits handle_type) const {
-    VkPhysicalDeviceExternalBufferInfo info = vku::InitStructHelper();
-    info.flags = buffer.create_info.flags;
     // TODO - Add VkBufferUsageFlags2CreateInfoKHR support
-    info.usage = buffer.create_info.usage;
-    info.handleType = handle_type;
-    VkExternalBufferProperties properties = vku::InitStructHelper();
-    DispatchGetPhysicalDeviceExternalBufferProperties(physical_device, &info, &properties);
-    return (properties.externalMemoryProperties.externalMemoryFeatures & VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT) != 0;
+    const VkExternalMemoryProperties properties =
+        GetExternalBufferProperties(buffer.create_info.flags, buffer.create_info.usage, handle_type);
+    return (properties.externalMemoryFeatures & VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT) != 0;
 }
 
 bool CoreChecks::HasExternalMemoryImportSupport(const vvl::Image &image, VkExternalMemoryHandleTypeFlagBits handle_type) const {
@@ -768,6 +764,16 @@ bool CoreChecks::PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory memor
     return skip;
 }
 
+void CoreChecks::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAllocator,
+                                         const RecordObject &record_obj) {
+    // The buffers bound to this memory are no longer bound, a cached shader binding table could use one of them
+    {
+        WriteLockGuard guard(good_shader_binding_tables_lock_);
+        good_shader_binding_tables_.clear();
+    }
+    StateTracker::PreCallRecordFreeMemory(device, mem, pAllocator, record_obj);
+}
+
 bool CoreChecks::ValidateInsertMemoryRange(const VulkanTypedHandle &typed_handle, const vvl::DeviceMemory &mem_info,
                                            VkDeviceSize memoryOffset, const Location &loc) const {
     bool skip = false;
@@ -868,17 +874,15 @@ bool CoreChecks::ValidateBindBufferMemory(VkBuffer buffer, VkDeviceMemory memory
         // Validate VkExportMemoryAllocateInfo's VUs that can't be checked during vkAllocateMemory
         // because they require buffer information.
         if (mem_info->IsExport()) {
-            VkPhysicalDeviceExternalBufferInfo external_info = vku::InitStructHelper();
-            external_info.flags = buffer_state->create_info.flags;
+            const VkBufferCreateFlags buffer_flags = buffer_state->create_info.flags;
             // TODO: for now, there is no VkBufferUsageFlags2KHR flag that exceeds 32-bit but should be revisited later
-            external_info.usage = VkBufferUsageFlags(buffer_state->usage);
-            VkExternalBufferProperties external_properties = vku::InitStructHelper();
+            const VkBufferUsageFlags buffer_usage = VkBufferUsageFlags(buffer_state->usage);
+            VkExternalMemoryProperties external_properties = {};
             bool export_supported = true;
 
             auto validate_export_handle_types = [&](VkExternalMemoryHandleTypeFlagBits flag) {
-                external_info.handleType = flag;
-                DispatchGetPhysicalDeviceExternalBufferProperties(physical_device, &external_info, &external_properties);
-                const auto external_features = external_properties.externalMemoryProperties.externalMemoryFeatures;
+                external_properties = GetExternalBufferProperties(buffer_flags, buffer_usage, flag);
+                const auto external_features = external_properties.externalMemoryFeatures;
                 if ((external_features & VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT) == 0) {
                     export_supported = false;
                     const LogObjectList objlist(buffer, memory);
@@ -887,8 +891,8 @@ bool CoreChecks::ValidateBindBufferMemory(VkBuffer buffer, VkDeviceMemory memory
                                      "set, which does not support VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT with the buffer "
                                      "create flags (%s) and usage flags (%s).",
                                      FormatHandle(memory).c_str(), string_VkExternalMemoryHandleTypeFlagBits(flag),
-                                     string_VkBufferCreateFlags(external_info.flags).c_str(),
-                                     string_VkBufferUsageFlags(external_info.usage).c_str());
+                                     string_VkBufferCreateFlags(buffer_flags).c_str(),
+                                     string_VkBufferUsageFlags(buffer_usage).c_str());
                 }
                 if ((external_features & VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT) != 0) {
                     if (!mem_info->IsDedicatedBuffer()) {
@@ -898,15 +902,15 @@ bool CoreChecks::ValidateBindBufferMemory(VkBuffer buffer, VkDeviceMemory memory
                                          "set, which requires dedicated allocation for the buffer created with flags (%s) and "
                                          "usage flags (%s), but the memory is allocated without dedicated allocation support.",
                                          FormatHandle(memory).c_str(), string_VkExternalMemoryHandleTypeFlagBits(flag),
-                                         string_VkBufferCreateFlags(external_info.flags).c_str(),
-                                         string_VkBufferUsageFlags(external_info.usage).c_str());
+                                         string_VkBufferCreateFlags(buffer_flags).c_str(),
+                                         string_VkBufferUsageFlags(buffer_usage).c_str());
                     }
                 }
             };
             IterateFlags<VkExternalMemoryHandleTypeFlagBits>(mem_info->export_handle_types, validate_export_handle_types);
 
             // The types of external memory handles must be compatible
-            const auto compatible_types = external_properties.externalMemoryProperties.compatibleHandleTypes;
+            const auto compatible_types = external_properties.compatibleHandleTypes;
             if (export_supported && (mem_info->export_handle_types & compatible_types) != mem_info->export_handle_types) {
                 const LogObjectList objlist(buffer, memory);
                 skip |= LogError("VUID-VkExportMemoryAllocateInfo-handleTypes-00656", objlist, loc.dot(Field::memory),
@@ -915,8 +919,8 @@ bool CoreChecks::ValidateBindBufferMemory(VkBuffer buffer, VkDeviceMemory memory
                                  "flags (%s) and usage flags (%s).",
                                  FormatHandle(memory).c_str(),
                                  string_VkExternalMemoryHandleTypeFlags(mem_info->export_handle_types).c_str(),
-                                 string_VkBufferCreateFlags(external_info.flags).c_str(),
-                                 string_VkBufferUsageFlags(external_info.usage).c_str());
+                                 string_VkBufferCreateFlags(buffer_flags).c_str(),
+                                 string_VkBufferUsageFlags(buffer_usage).c_str());
             }
         }
 
@@ -1371,85 +1375,86 @@ bool CoreChecks::PreCallValidateUnmapMemory2KHR(VkDevice device, const VkMemoryU
     return skip;
 }
 
-bool CoreChecks::ValidateMemoryIsMapped(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                        const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateMappedMemoryRanges(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
+                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    for (uint32_t i = 0; i < mem_range_count; ++i) {
-        const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
-        ASSERT_AND_CONTINUE(mem_info);
-        // Makes sure the memory is already mapped
-        if (mem_info->mapped_range.size == 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", mem_ranges[i].memory, memory_range_loc,
-                             "Attempting to use memory (%s) that is not currently host mapped.",
-                             FormatHandle(mem_ranges[i].memory).c_str());
-        }
-
-        if (mem_ranges[i].size == VK_WHOLE_SIZE) {
-            if (mem_info->mapped_range.offset > mem_ranges[i].offset) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00686", mem_ranges[i].memory, memory_range_loc.dot(Field::offset),
-                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
-                                 mem_ranges[i].offset, mem_info->mapped_range.offset);
-            }
-        } else {
-            if (mem_info->mapped_range.offset > mem_ranges[i].offset) {
-                skip |=
-                    LogError("VUID-VkMappedMemoryRange-size-00685", mem_ranges[i].memory, memory_range_loc.dot(Field::offset),
-                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is not VK_WHOLE_SIZE).",
-                             mem_ranges[i].offset, mem_info->mapped_range.offset);
-            }
-            const uint64_t data_end = (mem_info->mapped_range.size == VK_WHOLE_SIZE)
-                                          ? mem_info->allocate_info.allocationSize
-                                          : (mem_info->mapped_range.offset + mem_info->mapped_range.size);
-            if ((data_end < (mem_ranges[i].offset + mem_ranges[i].size))) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", mem_ranges[i].memory, memory_range_loc,
-                                 "size (%" PRIu64 ") plus offset (%" PRIu64
-                                 ") "
-                                 "exceed the Memory Object's upper-bound (%" PRIu64 ").",
-                                 mem_ranges[i].size, mem_ranges[i].offset, data_end);
-            }
-        }
-    }
-    return skip;
-}
+    const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
+    const auto borrow_guard = BorrowGuard();
+
+    // Streaming allocators flush many ranges of the same memory object in one call, so the memory state (and its mapping)
+    // is only looked up again when the memory of the range changes
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    const vvl::DeviceMemory *mem_info = nullptr;
+    VkDeviceSize allocation_size = 0;
+    VkDeviceSize mapping_offset = 0;
+    VkDeviceSize mapping_size = 0;
+    VkDeviceSize mapping_end = 0;
 
-bool CoreChecks::ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                                       const ErrorObject &error_obj) const {
-    bool skip = false;
     for (uint32_t i = 0; i < mem_range_count; ++i) {
         const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
-        const VkDeviceSize offset = mem_ranges[i].offset;
-        const VkDeviceSize size = mem_ranges[i].size;
+        const VkMappedMemoryRange &range = mem_ranges[i];
 
-        if (SafeModulo(offset, atom_size) != 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", mem_ranges->memory, memory_range_loc.dot(Field::offset),
+        if (SafeModulo(range.offset, atom_size) != 0) {
+            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", range.memory, memory_range_loc.dot(Field::offset),
                              "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64 ").",
-                             offset, atom_size);
+                             range.offset, atom_size);
+        }
+
+        if (!mem_info || range.memory != memory) {
+            memory = range.memory;
+            mem_info = GetBorrowed<vvl::DeviceMemory>(memory);
+            ASSERT_AND_CONTINUE(mem_info);
+            allocation_size = mem_info->allocate_info.allocationSize;
+            mapping_offset = mem_info->mapped_range.offset;
+            mapping_size = mem_info->mapped_range.size;
+            mapping_end = (mapping_size == VK_WHOLE_SIZE) ? allocation_size : mapping_offset + mapping_size;
         }
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
-        ASSERT_AND_CONTINUE(mem_info);
 
-        const auto allocation_size = mem_info->allocate_info.allocationSize;
-        if (size == VK_WHOLE_SIZE) {
-            const auto mapping_offset = mem_info->mapped_range.offset;
-            const auto mapping_size = mem_info->mapped_range.size;
-            const auto mapping_end = ((mapping_size == VK_WHOLE_SIZE) ? allocation_size : mapping_offset + mapping_size);
+        if (range.size == VK_WHOLE_SIZE) {
             if (SafeModulo(mapping_end, atom_size) != 0 && mapping_end != allocation_size) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", mem_ranges->memory, memory_range_loc.dot(Field::size),
+                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", range.memory, memory_range_loc.dot(Field::size),
                                  "is VK_WHOLE_SIZE and the mapping end (%" PRIu64 " = %" PRIu64 " + %" PRIu64
                                  ") not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
                                  ") and not equal to the end of the memory object (%" PRIu64 ").",
                                  mapping_end, mapping_offset, mapping_size, atom_size, allocation_size);
             }
         } else {
-            const auto range_end = size + offset;
-            if (range_end != allocation_size && SafeModulo(size, atom_size) != 0) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", mem_ranges->memory, memory_range_loc.dot(Field::size),
+            const auto range_end = range.size + range.offset;
+            if (range_end != allocation_size && SafeModulo(range.size, atom_size) != 0) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", range.memory, memory_range_loc.dot(Field::size),
                                  "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
                                  ") and offset + size (%" PRIu64 " + %" PRIu64 " = %" PRIu64
                                  ") not equal to the memory size (%" PRIu64 ").",
-                                 size, atom_size, offset, size, range_end, allocation_size);
+                                 range.size, atom_size, range.offset, range.size, range_end, allocation_size);
+            }
+        }
+
+        // Makes sure the memory is already mapped
+        if (mapping_size == 0) {
+            skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", range.memory, memory_range_loc,
+                             "Attempting to use memory (%s) that is not currently host mapped.",
+                             FormatHandle(range.memory).c_str());
+        }
+
+        if (range.size == VK_WHOLE_SIZE) {
+            if (mapping_offset > range.offset) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00686", range.memory, memory_range_loc.dot(Field::offset),
+                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
+                                 range.offset, mapping_offset);
+            }
+        } else {
+            if (mapping_offset > range.offset) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", range.memory, memory_range_loc.dot(Field::offset),
+                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64
+                                 ") (and size is not VK_WHOLE_SIZE).",
+                                 range.offset, mapping_offset);
+            }
+            if ((mapping_end < (range.offset + range.size))) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", range.memory, memory_range_loc,
+                                 "size (%" PRIu64 ") plus offset (%" PRIu64
+                                 ") "
+                                 "exceed the Memory Object's upper-bound (%" PRIu64 ").",
+                                 range.size, range.offset, mapping_end);
             }
         }
     }
@@ -1460,8 +1465,7 @@ bool CoreChecks::PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_
                                                         const VkMappedMemoryRange *pMemoryRanges,
                                                         const ErrorObject &error_obj) const {
     bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
+    skip |= ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
     return skip;
 }
 
@@ -1469,8 +1473,7 @@ bool CoreChecks::PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, ui
                                                              const VkMappedMemoryRange *pMemoryRanges,
                                                              const ErrorObject &error_obj) const {
     bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
+    skip |= ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
     return skip;
 }
 
@@ -2250,7 +2253,7 @@ bool CoreChecks::ValidateSparseImageMemoryBind(vvl::Image const *image_state, Vk
     skip |=
         ValidateImageSubresourceSparseImageMemoryBind(*image_state, bind.subresource, bind_loc, memory_loc.dot(Field::subresource));
 
-    for (auto const &requirements : image_state->sparse_requirements) {
+    for (auto const &requirements : image_state->SparseRequirements()) {
         VkExtent3D const &granularity = requirements.formatProperties.imageGranularity;
         if (SafeModulo(bind.offset.x, granularity.width) != 0) {
             skip |= LogError("VUID-VkSparseImageMemoryBind-offset-01107", image_state->Handle(),
@@ -33,7 +33,8 @@ using vvl::GetDrawDispatchVuid;
 bool CoreChecks::ValidateGraphicsIndexedCmd(const vvl::CommandBuffer &cb_state, const Location &loc) const {
     bool skip = false;
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
-    const auto buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
+    const auto borrow_guard = BorrowGuard();
+    const auto *buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
     if (!buffer_state && !enabled_features.maintenance6 && !enabled_features.nullDescriptor) {
         skip |= LogError(vuid.index_binding_07312, cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS), loc,
                          "Index buffer object has not been bound to this command buffer.");
@@ -205,13 +206,14 @@ bool CoreChecks::ValidateCmdDrawIndexedBufferSize(const vvl::CommandBuffer &cb_s
         return skip;
     }
     const auto &index_buffer_binding = cb_state.index_buffer_binding;
-    if (const auto buffer_state = Get<vvl::Buffer>(index_buffer_binding.buffer)) {
-        const uint32_t index_size = GetIndexAlignment(index_buffer_binding.index_type);
+    const auto borrow_guard = BorrowGuard();
+    if (const auto *buffer_state = GetBorrowed<vvl::Buffer>(index_buffer_binding.buffer)) {
         // This doesn't exactly match the pseudocode of the VUID, but the binding size is the *bound* size, such that the offset
         // has already been accounted for (subtracted from the buffer size), and is consistent with the use of
         // BufferBinding::size for vertex buffer bindings (which record the *bound* size, not the size of the bound buffer)
-        VkDeviceSize end_offset = static_cast<VkDeviceSize>(index_size * (firstIndex + indexCount));
-        if (end_offset > index_buffer_binding.size) {
+        if (uint64_t(firstIndex) + indexCount > index_buffer_binding.max_index_count) {
+            const uint32_t index_size = GetIndexAlignment(index_buffer_binding.index_type);
+            const VkDeviceSize end_offset = VkDeviceSize(index_size) * (uint64_t(firstIndex) + indexCount);
             LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS);
             objlist.add(buffer_state->Handle());
             skip |= LogError(first_index_vuid, objlist, loc,
@@ -298,7 +300,8 @@ bool CoreChecks::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, V
     if (skip) return skip;  // basic validation failed, might have null pointers
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    const auto borrow_guard = BorrowGuard();
+    const auto *buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     ASSERT_AND_RETURN_SKIP(buffer_state);
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
@@ -347,7 +350,8 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer commandBu
 
     skip |= ValidateGraphicsIndexedCmd(cb_state, error_obj.location);
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    const auto borrow_guard = BorrowGuard();
+    const auto *buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     ASSERT_AND_RETURN_SKIP(buffer_state);
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
@@ -1236,10 +1240,27 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
     return skip;
 }
 
+bool CoreChecks::SampleActionCommand(const vvl::CommandBuffer &cb_state, uint32_t sample_rate) const {
+    if (sample_rate <= 1) {
+        return true;
+    }
+    // Only counted at record time, so this is the index of the action command being validated
+    const uint64_t index = cb_state.action_command_count;
+    if (core_settings.draw_sampling_mode == DrawSamplingMode::EveryNth) {
+        return index % sample_rate == 0;
+    }
+    uint64_t hash = HandleToUint64(cb_state.VkHandle()) ^ (index * 0x9E3779B97F4A7C15ull);
+    hash ^= hash >> 31;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 29;
+    return hash % sample_rate == 0;
+}
+
 // Action command == vkCmdDraw*, vkCmdDispatch*, vkCmdTraceRays*
 // This is the main logic shared by all action commands
 bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const VkPipelineBindPoint bind_point,
                                      const Location &loc) const {
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::ActionState);
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     const auto &last_bound_state = cb_state.lastBound[lv_bind_point];
@@ -1254,25 +1275,36 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                         string_VkPipelineBindPoint(bind_point));
     }
 
-    if (!pipeline) {
+    // Most apps issue many action commands in a row with the same bound state. If the pipeline (or shader objects), dynamic
+    // state, vertex buffers and render pass instance are the same as for the last action command recorded with this bind
+    // point, the checks of those against each other would give the same result again and can be skipped.
+    // When the draw state checks are sampled, the last action command may have been skipped, so the sampled ones always run
+    // the full checks and the others none.
+    const bool draw_state_validated = core_settings.draw_state_sample_rate > 1
+                                          ? !SampleActionCommand(cb_state, core_settings.draw_state_sample_rate)
+                                          : last_bound_state.IsDrawStateValidated(loc.function);
+
+    if (!pipeline && !draw_state_validated) {
         skip |= ValidateShaderObjectBoundShader(last_bound_state, bind_point, vuid);
         if (skip) return skip;  // if shaders are bound wrong, likely to give false positives after
     }
 
     if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-        skip |= ValidateDrawDynamicState(last_bound_state, vuid);
-        skip |= ValidateDrawPrimitivesGeneratedQuery(last_bound_state, vuid);
-        skip |= ValidateDrawProtectedMemory(last_bound_state, vuid);
-        skip |= ValidateDrawDualSourceBlend(last_bound_state, vuid);
-
-        if (pipeline) {
-            skip |= ValidateDrawPipeline(last_bound_state, *pipeline, vuid);
-        } else {
-            skip |= ValidateDrawShaderObject(last_bound_state, vuid);
+        if (!draw_state_validated) {
+            skip |= ValidateDrawDynamicState(last_bound_state, vuid);
+            skip |= ValidateDrawDualSourceBlend(last_bound_state, vuid);
+
+            if (pipeline) {
+                skip |= ValidateDrawPipeline(last_bound_state, *pipeline, vuid);
+            } else {
+                skip |= ValidateDrawShaderObject(last_bound_state, vuid);
+            }
         }
 
+        skip |= ValidateDrawPrimitivesGeneratedQuery(last_bound_state, vuid);
+        skip |= ValidateDrawProtectedMemory(last_bound_state, vuid);
     } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
-        if (pipeline) {
+        if (pipeline && !draw_state_validated) {
             skip |= ValidateTraceRaysDynamicStateSetStatus(last_bound_state, *pipeline, vuid);
         }
         if (!cb_state.unprotected) {
@@ -1281,13 +1313,18 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
         }
     }
 
-    if (pipeline) {
-        skip |= ValidateActionStateDescriptorsPipeline(last_bound_state, bind_point, *pipeline, vuid);
-    } else if (last_bound_state.cb_state.descriptor_buffer_binding_info.empty()) {
-        // TODO - VkPipeline have VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT (descriptor_buffer_mode) to know if using descriptor
-        // buffers, but VK_EXT_shader_object has no flag. For now, if the command buffer ever calls vkCmdBindDescriptorBuffersEXT,
-        // we just assume things are bound until we add some form of GPU side tracking for descriptor buffers
-        skip |= ValidateActionStateDescriptorsShaderObject(last_bound_state, bind_point, vuid);
+    // Descriptor validation is the most expensive part, it can be sampled and past the frame budget it only runs for a sample
+    // of the commands
+    if (SampleActionCommand(cb_state, core_settings.descriptor_sample_rate) && SampleBudgetedCheck(cb_state.command_count)) {
+        if (pipeline) {
+            skip |= ValidateActionStateDescriptorsPipeline(last_bound_state, bind_point, *pipeline, vuid);
+        } else if (last_bound_state.cb_state.descriptor_buffer_binding_info.empty()) {
+            // TODO - VkPipeline have VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT (descriptor_buffer_mode) to know if using
+            // descriptor buffers, but VK_EXT_shader_object has no flag. For now, if the command buffer ever calls
+            // vkCmdBindDescriptorBuffersEXT, we just assume things are bound until we add some form of GPU side tracking for
+            // descriptor buffers
+            skip |= ValidateActionStateDescriptorsShaderObject(last_bound_state, bind_point, vuid);
+        }
     }
 
     skip |= ValidateActionStatePushConstant(last_bound_state, pipeline, vuid);
@@ -1304,6 +1341,19 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bo
     bool skip = false;
     const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
 
+    // Same pipeline and same bound descriptor sets as the last action command, the sets were already found to be compatible
+    // and only their contents need to be checked again. Not when the descriptor checks are sampled, the last action command
+    // may not have been checked.
+    const bool descriptors_sampled = core_settings.descriptor_sample_rate > 1 || frame_budget;
+    if (!descriptors_sampled && last_bound_state.IsDescriptorBindingValidated(vuid.function)) {
+        if (!pipeline.descriptor_buffer_mode) {
+            for (const auto &set_binding_pair : pipeline.active_slots) {
+                skip |= ValidateActionStateDescriptorSet(last_bound_state, set_binding_pair.first, set_binding_pair.second, vuid);
+            }
+        }
+        return skip;
+    }
+
     for (const auto &ds : last_bound_state.per_set) {
         // TODO - This currently implicitly is checking for VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT being set
         if (pipeline.descriptor_buffer_mode) {
@@ -1374,34 +1424,47 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bo
                                  FormatHandle(set_handle).c_str(), set_index, FormatHandle(*pipeline_layout).c_str(),
                                  error_string.c_str());
             } else {  // Valid set is bound and layout compatible, validate that it's updated
-                // Pull the set node
-                const auto *descriptor_set = set_info.bound_descriptor_set.get();
-                ASSERT_AND_CONTINUE(descriptor_set);
-                // Validate the draw-time state for this descriptor set
-                // We can skip validating the descriptor set if "nothing" has changed since the last validation.
-                // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-                // any dynamic descriptors, always revalidate rather than caching the values. We currently only
-                // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
-                // binding_req_map which could potentially be expensive.
-                bool need_validate =
-                    // Revalidate each time if the set has dynamic offsets
-                    set_info.dynamicOffsets.size() > 0 ||
-                    // Revalidate if descriptor set (or contents) has changed
-                    set_info.validated_set != descriptor_set ||
-                    set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                    (!disabled[image_layout_validation] &&
-                     set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
-
-                if (need_validate) {
-                    skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets,
-                                              cb_state, vuid.loc(), vuid);
-                }
+                skip |= ValidateActionStateDescriptorSet(last_bound_state, set_index, set_binding_pair.second, vuid);
             }
         }
     }
     return skip;
 }
 
+bool CoreChecks::ValidateActionStateDescriptorSet(const LastBound &last_bound_state, uint32_t set_index,
+                                                  const BindingVariableMap &binding_req_map,
+                                                  const vvl::DrawDispatchVuid &vuid) const {
+    const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
+    // A missing set was already reported when the bindings were found to be incompatible
+    if (set_index >= last_bound_state.per_set.size()) {
+        return false;
+    }
+    const auto &set_info = last_bound_state.per_set[set_index];
+    // Pull the set node
+    const auto *descriptor_set = set_info.bound_descriptor_set.get();
+    if (!descriptor_set) {
+        return false;
+    }
+    // Validate the draw-time state for this descriptor set
+    // We can skip validating the descriptor set if "nothing" has changed since the last validation.
+    // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
+    // any dynamic descriptors, always revalidate rather than caching the values. We currently only
+    // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
+    // binding_req_map which could potentially be expensive.
+    bool need_validate =
+        // Revalidate each time if the set has dynamic offsets
+        set_info.dynamicOffsets.size() > 0 ||
+        // Revalidate if descriptor set (or contents) has changed
+        set_info.validated_set != descriptor_set || set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
+        (!disabled[image_layout_validation] &&
+         set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
+
+    if (need_validate) {
+        return ValidateDrawState(*descriptor_set, set_index, binding_req_map, set_info.dynamicOffsets, cb_state, vuid.loc(), vuid);
+    }
+    return false;
+}
+
 bool CoreChecks::ValidateActionStateDescriptorsShaderObject(const LastBound &last_bound_state, const VkPipelineBindPoint bind_point,
                                                             const vvl::DrawDispatchVuid &vuid) const {
     bool skip = false;
@@ -1651,14 +1714,15 @@ bool CoreChecks::ValidateDrawProtectedMemory(const LastBound &last_bound_state,
 
     // Verify vertex & index buffer for unprotected command buffer.
     // Because vertex & index buffer is read only, it doesn't need to care protected command buffer case.
+    const auto borrow_guard = BorrowGuard();
     for (const auto &vertex_buffer_binding : cb_state.current_vertex_buffer_binding_info) {
-        if (const auto buffer_state = Get<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
+        if (const auto *buffer_state = GetBorrowed<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
             skip |= ValidateProtectedBuffer(cb_state, *buffer_state, vuid.loc(), vuid.unprotected_command_buffer_02707,
                                             " (Buffer is the vertex buffer)");
         }
     }
 
-    if (const auto buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer)) {
+    if (const auto *buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer)) {
         skip |= ValidateProtectedBuffer(cb_state, *buffer_state, vuid.loc(), vuid.unprotected_command_buffer_02707,
                                         " (Buffer is the index buffer)");
     }
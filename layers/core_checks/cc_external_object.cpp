@@ -25,22 +25,72 @@
 #include "state_tracker/fence_state.h"
 #include "state_tracker/semaphore_state.h"
 
-static bool CanSemaphoreExportFromImported(VkPhysicalDevice physical_device, VkExternalSemaphoreHandleTypeFlagBits export_type,
-                                           VkExternalSemaphoreHandleTypeFlagBits imported_type) {
-    VkPhysicalDeviceExternalSemaphoreInfo semaphore_info = vku::InitStructHelper();
-    semaphore_info.handleType = export_type;
-    VkExternalSemaphoreProperties semaphore_properties = vku::InitStructHelper();
-    DispatchGetPhysicalDeviceExternalSemaphoreProperties(physical_device, &semaphore_info, &semaphore_properties);
-    return (imported_type & semaphore_properties.exportFromImportedHandleTypes) != 0;
+// Lookup in one of the external properties caches, query is only called on a miss
+template <typename Map, typename Query>
+static typename Map::mapped_type GetCachedExternalProperties(std::shared_mutex &lock, Map &cache,
+                                                             const typename Map::key_type &key, const Query &query) {
+    {
+        ReadLockGuard guard(lock);
+        const auto it = cache.find(key);
+        if (it != cache.end()) {
+            return it->second;
+        }
+    }
+    const typename Map::mapped_type properties = query();
+    WriteLockGuard guard(lock);
+    // Only the buffer key can take many values, an application going through many of them only keeps the recent ones
+    if (cache.size() >= 1024) {
+        cache.clear();
+    }
+    cache.emplace(key, properties);
+    return properties;
+}
+
+VkExternalMemoryProperties CoreChecks::GetExternalBufferProperties(VkBufferCreateFlags flags, VkBufferUsageFlags usage,
+                                                                   VkExternalMemoryHandleTypeFlagBits handle_type) const {
+    const auto query = [&]() {
+        VkPhysicalDeviceExternalBufferInfo info = vku::InitStructHelper();
+        info.flags = flags;
+        info.usage = usage;
+        info.handleType = handle_type;
+        VkExternalBufferProperties properties = vku::InitStructHelper();
+        DispatchGetPhysicalDeviceExternalBufferProperties(physical_device, &info, &properties);
+        return properties.externalMemoryProperties;
+    };
+    return GetCachedExternalProperties(external_properties_cache_lock_, external_buffer_properties_cache_,
+                                       ExternalBufferPropertiesKey{flags, usage, handle_type}, query);
+}
+
+VkExternalSemaphoreProperties CoreChecks::GetExternalSemaphoreProperties(VkExternalSemaphoreHandleTypeFlagBits handle_type) const {
+    const auto query = [&]() {
+        VkPhysicalDeviceExternalSemaphoreInfo info = vku::InitStructHelper();
+        info.handleType = handle_type;
+        VkExternalSemaphoreProperties properties = vku::InitStructHelper();
+        DispatchGetPhysicalDeviceExternalSemaphoreProperties(physical_device, &info, &properties);
+        return properties;
+    };
+    return GetCachedExternalProperties(external_properties_cache_lock_, external_semaphore_properties_cache_, handle_type, query);
+}
+
+VkExternalFenceProperties CoreChecks::GetExternalFenceProperties(VkExternalFenceHandleTypeFlagBits handle_type) const {
+    const auto query = [&]() {
+        VkPhysicalDeviceExternalFenceInfo info = vku::InitStructHelper();
+        info.handleType = handle_type;
+        VkExternalFenceProperties properties = vku::InitStructHelper();
+        DispatchGetPhysicalDeviceExternalFenceProperties(physical_device, &info, &properties);
+        return properties;
+    };
+    return GetCachedExternalProperties(external_properties_cache_lock_, external_fence_properties_cache_, handle_type, query);
+}
+
+bool CoreChecks::CanSemaphoreExportFromImported(VkExternalSemaphoreHandleTypeFlagBits export_type,
+                                                VkExternalSemaphoreHandleTypeFlagBits imported_type) const {
+    return (imported_type & GetExternalSemaphoreProperties(export_type).exportFromImportedHandleTypes) != 0;
 }
 
-static bool CanFenceExportFromImported(VkPhysicalDevice physical_device, VkExternalFenceHandleTypeFlagBits export_type,
-                                       VkExternalFenceHandleTypeFlagBits imported_type) {
-    VkPhysicalDeviceExternalFenceInfo fence_info = vku::InitStructHelper();
-    fence_info.handleType = export_type;
-    VkExternalFenceProperties fence_properties = vku::InitStructHelper();
-    DispatchGetPhysicalDeviceExternalFenceProperties(physical_device, &fence_info, &fence_properties);
-    return (imported_type & fence_properties.exportFromImportedHandleTypes) != 0;
+bool CoreChecks::CanFenceExportFromImported(VkExternalFenceHandleTypeFlagBits export_type,
+                                            VkExternalFenceHandleTypeFlagBits imported_type) const {
+    return (imported_type & GetExternalFenceProperties(export_type).exportFromImportedHandleTypes) != 0;
 }
 
 bool CoreChecks::PreCallValidateGetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR *pGetFdInfo, int *pFd,
@@ -121,7 +171,7 @@ bool CoreChecks::PreCallValidateGetSemaphoreFdKHR(VkDevice device, const VkSemap
     }
 
     if (sem_state->Scope() != vvl::Semaphore::kInternal && sem_state->HasImportedHandleType() &&
-        !CanSemaphoreExportFromImported(physical_device, pGetFdInfo->handleType, sem_state->ImportedHandleType())) {
+        !CanSemaphoreExportFromImported(pGetFdInfo->handleType, sem_state->ImportedHandleType())) {
         skip |= LogError("VUID-VkSemaphoreGetFdInfoKHR-semaphore-01133", sem_state->Handle(), info_loc.dot(Field::handleType),
                          "(%s) cannot be exported from semaphore with imported payload with handle type %s",
                          string_VkExternalSemaphoreHandleTypeFlagBits(pGetFdInfo->handleType),
@@ -170,7 +220,7 @@ bool CoreChecks::PreCallValidateGetFenceFdKHR(VkDevice device, const VkFenceGetF
         }
 
         if (fence_state->Scope() != vvl::Fence::kInternal && fence_state->HasImportedHandleType() &&
-            !CanFenceExportFromImported(physical_device, pGetFdInfo->handleType, fence_state->ImportedHandleType())) {
+            !CanFenceExportFromImported(pGetFdInfo->handleType, fence_state->ImportedHandleType())) {
             skip |= LogError("VUID-VkFenceGetFdInfoKHR-fence-01455", fence_state->Handle(), info_loc.dot(Field::handleType),
                              "(%s) cannot be exported from fence with imported payload with handle type %s",
                              string_VkExternalFenceHandleTypeFlagBits(pGetFdInfo->handleType),
@@ -240,7 +290,7 @@ bool CoreChecks::PreCallValidateGetSemaphoreWin32HandleKHR(VkDevice device,
         }
 
         if (sem_state->Scope() != vvl::Semaphore::kInternal && sem_state->HasImportedHandleType() &&
-            !CanSemaphoreExportFromImported(physical_device, pGetWin32HandleInfo->handleType, sem_state->ImportedHandleType())) {
+            !CanSemaphoreExportFromImported(pGetWin32HandleInfo->handleType, sem_state->ImportedHandleType())) {
             skip |= LogError("VUID-VkSemaphoreGetWin32HandleInfoKHR-semaphore-01128", sem_state->Handle(),
                              error_obj.location.dot(Field::pGetWin32HandleInfo).dot(Field::handleType),
                              "(%s) cannot be exported from semaphore with imported payload with handle type %s",
@@ -271,7 +321,7 @@ bool CoreChecks::PreCallValidateGetFenceWin32HandleKHR(VkDevice device, const Vk
         }
 
         if (fence_state->Scope() != vvl::Fence::kInternal && fence_state->HasImportedHandleType() &&
-            !CanFenceExportFromImported(physical_device, pGetWin32HandleInfo->handleType, fence_state->ImportedHandleType())) {
+            !CanFenceExportFromImported(pGetWin32HandleInfo->handleType, fence_state->ImportedHandleType())) {
             skip |= LogError("VUID-VkFenceGetWin32HandleInfoKHR-fence-01450", fence_state->Handle(),
                              error_obj.location.dot(Field::pGetWin32HandleInfo).dot(Field::handleType),
                              "(%s) cannot be exported from fence with imported payload with handle type %s",
@@ -167,6 +167,63 @@ bool CoreChecks::ValidateImageAlignmentControlCreateInfo(const VkImageCreateInfo
     return skip;
 }
 
+VkResult CoreChecks::GetImageFormatProperties(const VkPhysicalDeviceImageFormatInfo2 &image_format_info,
+                                              VkImageFormatProperties &image_format_properties) const {
+    const bool has_properties2 = IsExtEnabled(instance_extensions.vk_khr_get_physical_device_properties2);
+
+    ImageFormatPropertiesKey key{image_format_info.format, image_format_info.type, image_format_info.tiling,
+                                 image_format_info.usage, image_format_info.flags, false, 0, false, {}};
+    bool cacheable = true;
+    // Without vkGetPhysicalDeviceImageFormatProperties2 the pNext chain is not part of the query
+    for (auto *info = reinterpret_cast<const VkBaseInStructure *>(image_format_info.pNext); info && has_properties2;
+         info = info->pNext) {
+        if (info->sType == VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO) {
+            key.has_stencil_usage = true;
+            key.stencil_usage = reinterpret_cast<const VkImageStencilUsageCreateInfo *>(info)->stencilUsage;
+        } else if (info->sType == VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO) {
+            const auto *format_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(info);
+            key.has_view_formats = true;
+            if (format_list->pViewFormats) {
+                key.view_formats.assign(format_list->pViewFormats, format_list->pViewFormats + format_list->viewFormatCount);
+            }
+        } else {
+            cacheable = false;
+            break;
+        }
+    }
+
+    if (cacheable) {
+        ReadLockGuard guard(image_format_properties_cache_lock_);
+        const auto it = image_format_properties_cache_.find(key);
+        if (it != image_format_properties_cache_.end()) {
+            image_format_properties = it->second.properties;
+            return it->second.result;
+        }
+    }
+
+    VkResult result;
+    if (has_properties2) {
+        VkImageFormatProperties2 image_format_properties2 = vku::InitStructHelper();
+        result = DispatchGetPhysicalDeviceImageFormatProperties2Helper(physical_device, &image_format_info,
+                                                                       &image_format_properties2);
+        image_format_properties = image_format_properties2.imageFormatProperties;
+    } else {
+        result = DispatchGetPhysicalDeviceImageFormatProperties(physical_device, image_format_info.format, image_format_info.type,
+                                                                image_format_info.tiling, image_format_info.usage,
+                                                                image_format_info.flags, &image_format_properties);
+    }
+
+    if (cacheable) {
+        WriteLockGuard guard(image_format_properties_cache_lock_);
+        // The same few shapes are expected, an application going through many of them only keeps the recent ones
+        if (image_format_properties_cache_.size() >= 1024) {
+            image_format_properties_cache_.clear();
+        }
+        image_format_properties_cache_[std::move(key)] = {result, image_format_properties};
+    }
+    return result;
+}
+
 bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
                                             const VkAllocationCallbacks *pAllocator, VkImage *pImage,
                                             const ErrorObject &error_obj) const {
@@ -255,14 +312,7 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
     // Exit early if any thing is not succesful
     VkResult result = VK_SUCCESS;
     if (pCreateInfo->tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        if (IsExtEnabled(instance_extensions.vk_khr_get_physical_device_properties2)) {
-            result = DispatchGetPhysicalDeviceImageFormatProperties2Helper(physical_device, &image_format_info,
-                                                                           &image_format_properties);
-        } else {
-            result = DispatchGetPhysicalDeviceImageFormatProperties(physical_device, pCreateInfo->format, pCreateInfo->imageType,
-                                                                    pCreateInfo->tiling, pCreateInfo->usage, pCreateInfo->flags,
-                                                                    &image_format_properties.imageFormatProperties);
-        }
+        result = GetImageFormatProperties(image_format_info, image_format_properties.imageFormatProperties);
 
         // 1. vkGetPhysicalDeviceImageFormatProperties[2] only success code is VK_SUCCESS
         // 2. If call returns an error, then "imageCreateImageFormatPropertiesList" is defined to be the empty list
@@ -1650,6 +1700,13 @@ bool CoreChecks::ValidateImageViewFormatFeatures(const vvl::Image &image_state,
     // Pass in image_usage here instead of extracting it from image_state in case there's a chained VkImageViewUsageCreateInfo
     bool skip = false;
 
+    // The views of an image (one per mip level for example) usually all have the same format and usage, which only depend on
+    // the image and the physical device, so once passed the format properties don't need to be queried again
+    const uint64_t validated_key = (static_cast<uint64_t>(view_format) << 32) | image_usage;
+    if (validated_key != 0 && image_state.validated_view_format_features.load(std::memory_order_relaxed) == validated_key) {
+        return skip;
+    }
+
     VkFormatFeatureFlags2KHR tiling_features = 0;
     const VkImageTiling image_tiling = image_state.create_info.tiling;
 
@@ -1794,6 +1851,9 @@ bool CoreChecks::ValidateImageViewFormatFeatures(const vvl::Image &image_state,
         }
     }
 
+    if (!skip && validated_key != 0) {
+        image_state.validated_view_format_features.store(validated_key, std::memory_order_relaxed);
+    }
     return skip;
 }
 // Returns whether two formats have identical components (compares the size and type of each component)
@@ -169,28 +169,50 @@ static GlobalImageLayoutRangeMap *GetLayoutRangeMap(GlobalImageLayoutMap &map, c
     return &(*layout_map);
 }
 
-// Helper to update the Global or Overlay layout map
-struct GlobalLayoutUpdater {
-    bool update(VkImageLayout &dst, const image_layout_map::ImageSubresourceLayoutMap::LayoutEntry &src) const {
-        if (src.current_layout != image_layout_map::kInvalidLayout && dst != src.current_layout) {
-            dst = src.current_layout;
-            return true;
+// Merge-join the sorted expected ranges of an image against the layouts left by earlier command buffers of the submission
+// (overlay) and the global layouts. on_mismatch(range, expected_layout, current_layout) is called for each range that is not in
+// the layout the command buffer expects, the walk stops when it returns true.
+template <typename MismatchFunc>
+static void ForEachImageLayoutMismatch(const vvl::Image &image_state,
+                                       const image_layout_map::ImageSubresourceLayoutMap::LayoutRanges &expected,
+                                       const GlobalImageLayoutRangeMap &overlay_map, const GlobalImageLayoutRangeMap &global_map,
+                                       MismatchFunc &&on_mismatch) {
+    auto pos = expected.begin();
+    const auto end = expected.end();
+    sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(overlay_map, global_map,
+                                                                                        pos->range.begin);
+    while (pos != end) {
+        if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
+
+        VkImageLayout image_layout = kInvalidLayout;
+        if (current_layout->pos_A->valid) {  // pos_A denotes the overlay map in the parallel iterator
+            image_layout = current_layout->pos_A->lower_bound->second;
+        } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
+            image_layout = current_layout->pos_B->lower_bound->second;
         }
-        return false;
-    }
-
-    std::optional<VkImageLayout> insert(const image_layout_map::ImageSubresourceLayoutMap::LayoutEntry &src) const {
-        std::optional<VkImageLayout> result;
-        if (src.current_layout != image_layout_map::kInvalidLayout) {
-            result.emplace(src.current_layout);
+        const VkImageLayout initial_layout = pos->layout;
+        const auto intersected_range = pos->range & current_layout->range;
+        if (image_layout != initial_layout) {
+            const auto aspect_mask = image_state.subresource_encoder.Decode(intersected_range.begin).aspectMask;
+            if (!ImageLayoutMatches(aspect_mask, image_layout, initial_layout) &&
+                on_mismatch(intersected_range, initial_layout, image_layout)) {
+                return;
+            }
+        }
+        if (pos->range.includes(intersected_range.end)) {
+            current_layout.seek(intersected_range.end);
+        } else {
+            ++pos;
+            if (pos != end) {
+                current_layout.seek(pos->range.begin);
+            }
         }
-        return result;
     }
-};
+}
 
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::CommandBuffer &cb_state,
-                                            GlobalImageLayoutMap &overlayLayoutMap) const {
+                                            GlobalImageLayoutMap &overlayLayoutMap, bool matches_global_layouts) const {
     if (disabled[image_layout_validation]) return false;
     bool skip = false;
     // Iterate over the layout maps for each referenced image
@@ -198,81 +220,85 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
     for (const auto &layout_map_entry : cb_state.image_layout_map) {
         const auto image = layout_map_entry.first;
         const auto image_state = Get<vvl::Image>(image);
-        if (!image_state) continue;
+        if (!image_state || !layout_map_entry.second.map) continue;
 
-        const auto &layout_map = layout_map_entry.second.map->GetLayoutMap();
-        // Validate the initial_uses for each subresource referenced
-        if (layout_map.empty()) continue;
+        const auto &submit_layouts = layout_map_entry.second.map->GetSubmitLayouts();
+        if (submit_layouts.expected.empty() && submit_layouts.transitions.empty()) continue;
 
-        auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
         const auto *global_map = image_state->layout_range_map.get();
         ASSERT_AND_CONTINUE(global_map);
-        auto global_map_guard = global_map->ReadLock();
 
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
-
-        auto pos = layout_map.begin();
-        const auto end = layout_map.end();
-        sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(*overlay_map, *global_map,
-                                                                                            pos->first.begin);
-        while (pos != end) {
-            VkImageLayout initial_layout = pos->second.initial_layout;
-            if (initial_layout == image_layout_map::kInvalidLayout) {
-                continue;
-            }
-
-            VkImageLayout image_layout = kInvalidLayout;
-
-            if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
-            if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
-                image_layout = current_layout->pos_A->lower_bound->second;
-            } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
-                image_layout = current_layout->pos_B->lower_bound->second;
-            }
-            const auto intersected_range = pos->first & current_layout->range;
-            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != initial_layout) {
-                const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
-                const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
-                        skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
-                                         "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
-                                         ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
-                                         FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(), subresource.aspectMask,
-                                         subresource.arrayLayer, subresource.mipLevel, string_VkImageLayout(initial_layout),
-                                         string_VkImageLayout(image_layout));
-                    }
-                }
-            }
-            if (pos->first.includes(intersected_range.end)) {
-                current_layout.seek(intersected_range.end);
-            } else {
-                ++pos;
-                if (pos != end) {
-                    current_layout.seek(pos->first.begin);
-                }
+        // Only images transitioned earlier in the submission have an overlay. Without one, an image of a command buffer
+        // that already matched the global layouts has nothing left to check.
+        const auto &expected = submit_layouts.expected;
+        if (!expected.empty()) {
+            const auto overlay_it = overlayLayoutMap.find(image_state.get());
+            const bool has_overlay = overlay_it != overlayLayoutMap.end() && overlay_it->second;
+            if (has_overlay || !matches_global_layouts) {
+                const GlobalImageLayoutRangeMap *overlay_map = has_overlay ? &(*overlay_it->second) : &empty_map;
+                auto global_map_guard = global_map->ReadLock();
+                ForEachImageLayoutMismatch(
+                    *image_state, expected, *overlay_map, *global_map,
+                    [&](const auto intersected_range, VkImageLayout initial_layout, VkImageLayout image_layout) {
+                        // We can report all the errors for the intersected range directly
+                        for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
+                            const auto subresource = image_state->subresource_encoder.Decode(index);
+                            const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
+                            skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
+                                             "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
+                                             ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
+                                             FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(),
+                                             subresource.aspectMask, subresource.arrayLayer, subresource.mipLevel,
+                                             string_VkImageLayout(initial_layout), string_VkImageLayout(image_layout));
+                        }
+                        return false;
+                    });
             }
         }
+
         // Update all layout set operations (which will be a subset of the initial_layouts)
-        sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
+        if (!submit_layouts.transitions.empty()) {
+            GetLayoutRangeMap(overlayLayoutMap, *image_state)->SetLayouts(submit_layouts.transitions);
+        }
     }
 
     return skip;
 }
 
+// Same walk as ValidateCmdBufImageLayouts without an overlay, the pre-submit layouts don't change while a submission is
+// validated so this can run for all the command buffers of a submission at the same time
+bool CoreChecks::CmdBufImageLayoutsMatchGlobal(const vvl::CommandBuffer &cb_state) const {
+    if (disabled[image_layout_validation]) return true;
+    const GlobalImageLayoutRangeMap empty_map(1);
+    bool matches = true;
+    for (const auto &layout_map_entry : cb_state.image_layout_map) {
+        const auto image_state = Get<vvl::Image>(layout_map_entry.first);
+        if (!image_state || !layout_map_entry.second.map) continue;
+
+        const auto &expected = layout_map_entry.second.map->GetSubmitLayouts().expected;
+        const auto *global_map = image_state->layout_range_map.get();
+        if (expected.empty() || !global_map) continue;
+
+        auto global_map_guard = global_map->ReadLock();
+        ForEachImageLayoutMismatch(*image_state, expected, empty_map, *global_map,
+                                   [&matches](const auto &, VkImageLayout, VkImageLayout) {
+                                       matches = false;
+                                       return true;
+                                   });
+        if (!matches) break;
+    }
+    return matches;
+}
+
 void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
     for (const auto &layout_map_entry : cb_state.image_layout_map) {
         const auto image = layout_map_entry.first;
         const auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id && layout_map_entry.second.map) {
+            const auto &transitions = layout_map_entry.second.map->GetSubmitLayouts().transitions;
+            if (transitions.empty()) continue;
             auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(), GlobalLayoutUpdater());
+            image_state->layout_range_map->SetLayouts(transitions);
         }
     }
 }
@@ -821,30 +847,35 @@ bool CoreChecks::VerifyClearImageLayout(const vvl::CommandBuffer &cb_state, cons
     return skip;
 }
 
-bool CoreChecks::UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer &cb_state, const Location &image_loc,
-                                                   const ImageBarrier &img_barrier, const vvl::CommandBuffer::ImageLayoutMap &current_map,
+bool CoreChecks::UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer &cb_state, const vvl::Image &image_state,
+                                                   const Location &image_loc, const ImageBarrier &img_barrier,
+                                                   const vvl::CommandBuffer::ImageLayoutMap &current_map,
                                                    vvl::CommandBuffer::ImageLayoutMap &layout_updates) const {
     bool skip = false;
-    auto image_state = Get<vvl::Image>(img_barrier.image);
-    ASSERT_AND_RETURN_SKIP(image_state);
 
     std::shared_ptr<ImageSubresourceLayoutMap> write_subresource_map;
-    auto iter = layout_updates.find(image_state->VkHandle());
+    auto iter = layout_updates.find(image_state.VkHandle());
     bool new_write = false;
     if (iter == layout_updates.end()) {
-        write_subresource_map = std::make_shared<ImageSubresourceLayoutMap>(*image_state);
+        write_subresource_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
         new_write = true;
-        layout_updates.emplace(image_state->VkHandle(), vvl::CommandBuffer::LayoutState{image_state->GetId(), write_subresource_map});
-    } else if (iter->second.id != image_state->GetId()) {
-        write_subresource_map = std::make_shared<ImageSubresourceLayoutMap>(*image_state);
+        layout_updates.emplace(image_state.VkHandle(), vvl::CommandBuffer::LayoutState{image_state.GetId(), write_subresource_map});
+    } else if (iter->second.id != image_state.GetId()) {
+        write_subresource_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
         iter->second.map = write_subresource_map;
         new_write = true;
     } else {
         write_subresource_map = iter->second.map;
     }
-    const auto &current_subresource_map = current_map.find(image_state->VkHandle());
-    const auto read_subresource_map =
-        (new_write && current_subresource_map != current_map.end()) ? current_subresource_map->second.map : write_subresource_map;
+    std::shared_ptr<ImageSubresourceLayoutMap> read_subresource_map = write_subresource_map;
+    if (new_write) {
+        const auto current_subresource_map = current_map.find(image_state.VkHandle());
+        if (current_subresource_map != current_map.end()) {
+            read_subresource_map = current_subresource_map->second.map;
+        }
+    }
+    const auto old_layout = NormalizeSynchronization2Layout(img_barrier.subresourceRange.aspectMask, img_barrier.oldLayout);
+    const VkImageSubresourceRange barrier_isr = image_state.NormalizeSubresourceRange(img_barrier.subresourceRange);
     // Validate aspects in isolation.
     // This is required when handling separate depth-stencil layouts.
     for (uint32_t aspect_index = 0; aspect_index < 32; aspect_index++) {
@@ -852,10 +883,9 @@ bool CoreChecks::UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer &cb_
         if ((img_barrier.subresourceRange.aspectMask & test_aspect) == 0) {
             continue;
         }
-        auto old_layout = NormalizeSynchronization2Layout(img_barrier.subresourceRange.aspectMask, img_barrier.oldLayout);
 
         LayoutUseCheckAndMessage layout_check(old_layout, test_aspect);
-        auto normalized_isr = image_state->NormalizeSubresourceRange(img_barrier.subresourceRange);
+        auto normalized_isr = barrier_isr;
         normalized_isr.aspectMask = test_aspect;
         skip |=
             read_subresource_map->AnyInRange(normalized_isr, [this, read_subresource_map, &cb_state, &layout_check, &image_loc,
@@ -902,13 +932,16 @@ bool CoreChecks::FindLayouts(const vvl::Image &image_state, std::vector<VkImageL
     return true;
 }
 
-void CoreChecks::RecordTransitionImageLayout(vvl::CommandBuffer &cb_state, const ImageBarrier &mem_barrier) {
+void CoreChecks::RecordTransitionImageLayout(vvl::CommandBuffer &cb_state, const ImageBarrier &mem_barrier,
+                                             std::shared_ptr<const vvl::Image> &image_state) {
     if (enabled_features.synchronization2) {
         if (mem_barrier.oldLayout == mem_barrier.newLayout) {
             return;
         }
     }
-    auto image_state = Get<vvl::Image>(mem_barrier.image);
+    if (!image_state || image_state->VkHandle() != mem_barrier.image) {
+        image_state = Get<vvl::Image>(mem_barrier.image);
+    }
     ASSERT_AND_RETURN(image_state);
 
     auto normalized_isr = image_state->NormalizeSubresourceRange(mem_barrier.subresourceRange);
@@ -939,18 +972,20 @@ void CoreChecks::RecordTransitionImageLayout(vvl::CommandBuffer &cb_state, const
 
 void CoreChecks::TransitionImageLayouts(vvl::CommandBuffer &cb_state, uint32_t barrier_count,
                                         const VkImageMemoryBarrier2 *image_barriers) {
+    std::shared_ptr<const vvl::Image> image_state;
     for (uint32_t i = 0; i < barrier_count; i++) {
         const ImageBarrier barrier(image_barriers[i]);
-        RecordTransitionImageLayout(cb_state, barrier);
+        RecordTransitionImageLayout(cb_state, barrier, image_state);
     }
 }
 
 void CoreChecks::TransitionImageLayouts(vvl::CommandBuffer &cb_state, uint32_t barrier_count,
                                         const VkImageMemoryBarrier *image_barriers, VkPipelineStageFlags src_stage_mask,
                                         VkPipelineStageFlags dst_stage_mask) {
+    std::shared_ptr<const vvl::Image> image_state;
     for (uint32_t i = 0; i < barrier_count; i++) {
         const ImageBarrier barrier(image_barriers[i], src_stage_mask, dst_stage_mask);
-        RecordTransitionImageLayout(cb_state, barrier);
+        RecordTransitionImageLayout(cb_state, barrier, image_state);
     }
 }
 
@@ -1009,6 +1044,12 @@ bool CoreChecks::ValidateHostCopyCurrentLayout(const VkImageLayout expected_layo
     CheckState check_state(expected_layout, subres_range.aspectMask);
 
     auto guard = image_state.layout_range_map->ReadLock();
+    // Every subresource is in the same layout, so they all match
+    const VkImageLayout uniform_layout = image_state.layout_range_map->UniformLayout();
+    if (uniform_layout != image_layout_map::kInvalidLayout &&
+        ImageLayoutMatches(subres_range.aspectMask, uniform_layout, expected_layout)) {
+        return false;
+    }
     image_state.layout_range_map->AnyInRange(range_gen, [&check_state](const Map::key_type &range, const VkImageLayout &layout) {
         bool mismatch = false;
         if (!ImageLayoutMatches(check_state.aspect_mask, layout, check_state.expected_layout)) {
@@ -43,22 +43,29 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                      pPipelines, error_obj, pipeline_states, chassis_state);
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
-        const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
-        skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), create_info_loc);
-        skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
 
-        // From dumping traces, we found almost all apps only create one pipeline at a time. To greatly simplify the logic, only
-        // check the stateless validation in the pNext chain for the first pipeline. (The core issue is because we parse the SPIR-V
-        // at state tracking time, and we state track pipelines first)
-        if (i == 0) {
-            uint32_t stage_count = std::min(pCreateInfos[0].stageCount, kCommonMaxGraphicsShaderStages);
-            for (uint32_t stage = 0; stage < stage_count; stage++) {
-                if (chassis_state.stateless_data[stage].pipeline_pnext_module) {
-                    skip |= ValidateSpirvStateless(
-                        *chassis_state.stateless_data[stage].pipeline_pnext_module, chassis_state.stateless_data[stage],
-                        create_info_loc.dot(Field::pStages, stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
-                }
+    // The create infos are independent of each other, large batches get spread over the validation worker pool
+    std::atomic<bool> pipeline_skip{false};
+    vvl::ParallelFor(validation_worker_pool.get(), count, [&](uint32_t i) {
+        const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
+        if (ValidateGraphicsPipeline(*pipeline_states[i].get(), create_info_loc) |
+            ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc)) {
+            pipeline_skip.store(true, std::memory_order_relaxed);
+        }
+    });
+    skip |= pipeline_skip.load(std::memory_order_relaxed);
+
+    // From dumping traces, we found almost all apps only create one pipeline at a time. To greatly simplify the logic, only
+    // check the stateless validation in the pNext chain for the first pipeline. (The core issue is because we parse the SPIR-V
+    // at state tracking time, and we state track pipelines first)
+    if (count > 0) {
+        const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, 0);
+        uint32_t stage_count = std::min(pCreateInfos[0].stageCount, kCommonMaxGraphicsShaderStages);
+        for (uint32_t stage = 0; stage < stage_count; stage++) {
+            if (chassis_state.stateless_data[stage].pipeline_pnext_module) {
+                skip |= ValidateSpirvStateless(
+                    *chassis_state.stateless_data[stage].pipeline_pnext_module, chassis_state.stateless_data[stage],
+                    create_info_loc.dot(Field::pStages, stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
             }
         }
     }
@@ -1061,7 +1068,7 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
                     for (uint32_t binding_index = 0; binding_index < binding_count; binding_index++) {
                         const auto &pre_raster_binding = pre_raster_bindings[binding_index];
                         const auto &fs_binding = fs_bindings[binding_index];
-                        if (!CompareDescriptorSetLayoutBinding(*pre_raster_binding.ptr(), *fs_binding.ptr())) {
+                        if (!CompareDescriptorSetLayoutBinding(pre_raster_binding, fs_binding)) {
                             const char *vuid = only_libs ? "VUID-VkGraphicsPipelineCreateInfo-pLibraries-06613"
                                                          : "VUID-VkGraphicsPipelineCreateInfo-flags-06612";
                             LogObjectList objlist(pre_raster_info.layout->Handle(), frag_shader_info.layout->Handle());
@@ -1122,7 +1129,9 @@ bool CoreChecks::ValidateGraphicsPipelineLibrary(const vvl::Pipeline &pipeline,
                              "Fragment Shader has a valid VkPipelineMultisampleStateCreateInfo, but Fragment Output Interface has "
                              "a pMultisampleState of NULL.");
         } else if (frag_shader_info.ms_state && frag_output_info.ms_state) {
-            if (!ComparePipelineMultisampleStateCreateInfo(*frag_shader_info.ms_state, *frag_output_info.ms_state)) {
+            // Interned states are identical when they are the same object
+            if (frag_shader_info.ms_state != frag_output_info.ms_state &&
+                !ComparePipelineMultisampleStateCreateInfo(*frag_shader_info.ms_state, *frag_output_info.ms_state)) {
                 const char *vuid =
                     (frag_shader_info.init == GPLInitType::gpl_flags)   ? "VUID-VkGraphicsPipelineCreateInfo-flags-06633"
                     : (frag_output_info.init == GPLInitType::gpl_flags) ? "VUID-VkGraphicsPipelineCreateInfo-pLibraries-06634"
@@ -4104,12 +4113,17 @@ bool CoreChecks::ValidateDrawPipelineVertexAttribute(const vvl::CommandBuffer &c
         return skip;
     }
 
-    const auto &vertex_attribute_descriptions = pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT)
-                                                    ? cb_state.dynamic_state_value.vertex_attribute_descriptions
-                                                    : pipeline.vertex_input_state->vertex_attribute_descriptions;
+    const bool dynamic_vertex_input = pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT);
+    const auto &vertex_attribute_descriptions = dynamic_vertex_input ? cb_state.dynamic_state_value.vertex_attribute_descriptions
+                                                                     : pipeline.vertex_input_state->vertex_attribute_descriptions;
+    const auto &vertex_attribute_requirements = dynamic_vertex_input ? cb_state.dynamic_state_value.vertex_attribute_requirements
+                                                                     : pipeline.vertex_input_state->vertex_attribute_requirements;
+    assert(vertex_attribute_descriptions.size() == vertex_attribute_requirements.size());
+    const auto borrow_guard = BorrowGuard();
     // Verify vertex attribute address alignment
     for (uint32_t i = 0; i < vertex_attribute_descriptions.size(); i++) {
         const auto &attribute_description = vertex_attribute_descriptions[i];
+        const auto &attribute_requirements = vertex_attribute_requirements[i];
         const uint32_t vertex_binding = attribute_description.binding;
 
         const auto &vertex_binding_map_it = cb_state.current_vertex_buffer_binding_info.find(vertex_binding);
@@ -4126,7 +4140,7 @@ bool CoreChecks::ValidateDrawPipelineVertexAttribute(const vvl::CommandBuffer &c
                              vertex_binding, i);
             break;
         }
-        auto const buffer_state = Get<vvl::Buffer>(vertex_binding_map_it->second.buffer);
+        const auto *buffer_state = GetBorrowed<vvl::Buffer>(vertex_binding_map_it->second.buffer);
         if (!buffer_state) {
             const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
             skip |= LogError(vuid.vertex_binding_attribute_02721, objlist, vuid.loc(),
@@ -4139,7 +4153,7 @@ bool CoreChecks::ValidateDrawPipelineVertexAttribute(const vvl::CommandBuffer &c
         const VkFormat attribute_format = attribute_description.format;
         const VkDeviceSize vertex_buffer_stride = vertex_binding_map_it->second.stride;
         if (pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE)) {
-            const VkDeviceSize attribute_binding_extent = attribute_offset + vkuFormatElementSize(attribute_format);
+            const VkDeviceSize attribute_binding_extent = attribute_requirements.extent;
             if (vertex_buffer_stride != 0 && vertex_buffer_stride < attribute_binding_extent) {
                 const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
                 skip |= LogError("VUID-vkCmdBindVertexBuffers2-pStrides-06209", objlist, vuid.loc(),
@@ -4154,11 +4168,7 @@ bool CoreChecks::ValidateDrawPipelineVertexAttribute(const vvl::CommandBuffer &c
         // Use 1 as vertex/instance index to use buffer stride as well
         const VkDeviceSize attrib_address = vertex_buffer_offset + vertex_buffer_stride + attribute_offset;
 
-        VkDeviceSize vtx_attrib_req_alignment = vkuFormatElementSize(attribute_format);
-        if (vkuFormatElementIsTexel(attribute_format)) {
-            vtx_attrib_req_alignment = SafeDivision(vtx_attrib_req_alignment, vkuFormatComponentCount(attribute_format));
-        }
-
+        const VkDeviceSize vtx_attrib_req_alignment = attribute_requirements.alignment;
         if (SafeModulo(attrib_address, vtx_attrib_req_alignment) != 0) {
             const LogObjectList objlist(buffer_state->Handle(), pipeline.Handle());
             skip |= LogError(vuid.vertex_binding_attribute_02721, objlist, vuid.loc(),
@@ -4218,15 +4228,12 @@ bool CoreChecks::ValidateDrawPipelineVertexBinding(const vvl::CommandBuffer &cb_
     bool skip = false;
     if (!pipeline.vertex_input_state) return skip;
 
-    vvl::unordered_set<uint32_t> bound_pipeline_bindings;
-    for (const auto &description : pipeline.vertex_input_state->binding_descriptions) {
-        bound_pipeline_bindings.insert(description.binding);
-    }
-
+    const bool dynamic_vertex_input = pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT);
+    const auto &pipeline_bindings = pipeline.vertex_input_state->binding_to_index_map;
+    const auto borrow_guard = BorrowGuard();
     for (const auto &vertex_buffer_binding : cb_state.current_vertex_buffer_binding_info) {
         // Only validate the bindings from the last bound pipeline (unlesss it used VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)
-        if (!pipeline.IsDynamic(CB_DYNAMIC_STATE_VERTEX_INPUT_EXT) &&
-            bound_pipeline_bindings.find(vertex_buffer_binding.first) == bound_pipeline_bindings.end()) {
+        if (!dynamic_vertex_input && pipeline_bindings.find(vertex_buffer_binding.first) == pipeline_bindings.end()) {
             continue;
         }
 
@@ -4238,7 +4245,7 @@ bool CoreChecks::ValidateDrawPipelineVertexBinding(const vvl::CommandBuffer &cb_
                                  " is VK_NULL_HANDLE. (Most likely you forgot to call vkCmdBindVertexBuffers)",
                                  vertex_buffer_binding.first);
             }
-        } else if (!Get<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
+        } else if (!GetBorrowed<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
             const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
             skip |= LogError(vuid.vertex_binding_04007, objlist, vuid.loc(),
                              "Vertex binding %" PRIu32 " is not a valid VkBuffer. (Check the buffer set in vkCmdBindVertexBuffers)",
@@ -30,12 +30,7 @@
 
 static QueryState GetLocalQueryState(const QueryMap *localQueryToStateMap, VkQueryPool queryPool, uint32_t queryIndex,
                                      uint32_t perfPass) {
-    QueryObject query = QueryObject(queryPool, queryIndex, perfPass);
-
-    auto iter = localQueryToStateMap->find(query);
-    if (iter != localQueryToStateMap->end()) return iter->second;
-
-    return QUERYSTATE_UNKNOWN;
+    return localQueryToStateMap->GetQueryState(queryPool, queryIndex, perfPass);
 }
 
 bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator,
@@ -46,14 +41,8 @@ bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool qu
     const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
-    bool completed_by_get_results = true;
-    for (uint32_t i = 0; i < query_pool_state->create_info.queryCount; ++i) {
-        auto state = query_pool_state->GetQueryState(i, 0);
-        if (state != QUERYSTATE_AVAILABLE) {
-            completed_by_get_results = false;
-            break;
-        }
-    }
+    const bool completed_by_get_results =
+        query_pool_state->AreQueriesInState(0, query_pool_state->create_info.queryCount, 0, QUERYSTATE_AVAILABLE);
     if (!completed_by_get_results) {
         skip |= ValidateObjectNotInUse(query_pool_state.get(), error_obj.location, "VUID-vkDestroyQueryPool-queryPool-00793");
     }
@@ -1528,9 +1517,7 @@ void CoreChecks::PostCallRecordGetQueryPoolResults(VkDevice device, VkQueryPool
     ASSERT_AND_RETURN(query_pool_state);
 
     if ((flags & VK_QUERY_RESULT_PARTIAL_BIT) == 0) {
-        for (uint32_t i = firstQuery; i < queryCount; ++i) {
-            query_pool_state->SetQueryState(i, 0, QUERYSTATE_AVAILABLE);
-        }
+        query_pool_state->SetQueryStates(firstQuery, queryCount, 0, QUERYSTATE_AVAILABLE);
     }
 }
 
@@ -37,8 +37,8 @@ struct CommandBufferSubmitState {
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
     std::vector<VkCommandBuffer> current_cmds;
     GlobalImageLayoutMap overlay_image_layout_map;
-    std::vector<std::string> cmdbuf_label_stack;
-    std::string last_closed_cmdbuf_label;
+    std::vector<vvl::CommandBuffer::LabelId> cmdbuf_label_stack;
+    vvl::CommandBuffer::LabelId last_closed_cmdbuf_label;
     bool found_unbalanced_cmdbuf_label;
 
     // The "local" prefix is about tracking state within a *single* queue submission
@@ -48,6 +48,12 @@ struct CommandBufferSubmitState {
     EventMap local_event_signal_info;
     vvl::unordered_map<VkVideoSessionKHR, vvl::VideoSessionDeviceState> local_video_session_state{};
 
+    // Command buffers whose queue_submit_functions are run on the queue thread (async_submit_validation)
+    std::vector<std::shared_ptr<const vvl::CommandBuffer>> deferred_cbs;
+
+    // Command buffers of the submission whose expected image layouts all match the layouts from before the submission
+    vvl::unordered_set<const vvl::CommandBuffer *> global_layouts_match;
+
     CommandBufferSubmitState(const CoreChecks &c, const vvl::Queue *q) : core(c), queue_state(q) {
         // Queue label state is updated during PostRecord phase.
         // Copy state to be able to track labels during validation.
@@ -56,9 +62,32 @@ struct CommandBufferSubmitState {
         found_unbalanced_cmdbuf_label = queue_state->found_unbalanced_cmdbuf_label;
     }
 
+    // With a worker pool, the expected layouts of every command buffer are compared with the pre-submit layouts in parallel, as
+    // those don't change until the submission is recorded. Validate() then chains the command buffers in order with their
+    // transitions, and for the ones that matched only the images transitioned earlier in the submission are checked again.
+    void PrevalidateImageLayouts(const std::vector<VkCommandBuffer> &command_buffers) {
+        vvl::WorkerPool *worker_pool = core.validation_worker_pool.get();
+        if (!worker_pool || command_buffers.size() < 2 || core.disabled[image_layout_validation]) {
+            return;
+        }
+        std::vector<const vvl::CommandBuffer *> matches(command_buffers.size(), nullptr);
+        vvl::ParallelFor(worker_pool, static_cast<uint32_t>(command_buffers.size()), [&](uint32_t i) {
+            auto cb_state = core.GetRead<vvl::CommandBuffer>(command_buffers[i]);
+            if (cb_state && core.CmdBufImageLayoutsMatchGlobal(*cb_state)) {
+                matches[i] = cb_state.get();
+            }
+        });
+        for (const vvl::CommandBuffer *cb_state : matches) {
+            if (cb_state) {
+                global_layouts_match.insert(cb_state);
+            }
+        }
+    }
+
     bool Validate(const Location &loc, const vvl::CommandBuffer &cb_state, uint32_t perf_pass) {
         bool skip = false;
-        skip |= core.ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
+        skip |= core.ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map,
+                                                global_layouts_match.count(&cb_state) != 0);
         const VkCommandBuffer cmd = cb_state.VkHandle();
         current_cmds.push_back(cmd);
         skip |= core.ValidatePrimaryCommandBufferState(
@@ -73,8 +102,14 @@ struct CommandBufferSubmitState {
         }
 
         // Call submit-time functions to validate or update local mirrors of state (to preserve const-ness at validate time)
-        for (auto &function : cb_state.queue_submit_functions) {
-            skip |= function(core, *queue_state, cb_state);
+        if (core.enabled[async_submit_validation]) {
+            if (!cb_state.queue_submit_functions.empty()) {
+                deferred_cbs.emplace_back(cb_state.shared_from_this());
+            }
+        } else {
+            for (auto &function : cb_state.queue_submit_functions) {
+                skip |= function(core, *queue_state, cb_state);
+            }
         }
         for (auto &function : cb_state.eventUpdates) {
             skip |= function(const_cast<vvl::CommandBuffer &>(cb_state), /*do_validate*/ true, local_event_signal_info,
@@ -99,6 +134,24 @@ struct CommandBufferSubmitState {
         return skip;
     }
 
+    // Hand the submit time functions of the command buffers validated so far to the queue thread.
+    // Their errors are reported from there and don't affect the skip result of this submission.
+    void DeferValidation() {
+        if (deferred_cbs.empty()) {
+            return;
+        }
+        // Queueing work for the queue thread doesn't change the queue state seen by validation
+        const_cast<vvl::Queue *>(queue_state)->DeferValidation([&core = core, queue_state = queue_state, cbs = std::move(deferred_cbs)]() {
+            for (const auto &cb_state : cbs) {
+                auto guard = cb_state->ReadLock();
+                for (auto &function : cb_state->queue_submit_functions) {
+                    function(core, *queue_state, *cb_state);
+                }
+            }
+        });
+        deferred_cbs.clear();
+    }
+
 private:
     bool ValidateCmdBufLabelMatching(const Location &loc, const vvl::CommandBuffer &cb_state) {
         bool skip = false;
@@ -109,7 +162,7 @@ private:
         }
         for (const auto &command : cb_state.GetLabelCommands()) {
             if (command.begin) {
-                cmdbuf_label_stack.push_back(command.label_name);
+                cmdbuf_label_stack.push_back(command.label_id);
             } else {
                 if (cmdbuf_label_stack.empty()) {
                     found_unbalanced_cmdbuf_label = true;
@@ -121,11 +174,11 @@ private:
         }
         if (found_unbalanced_cmdbuf_label) {
             std::string previous_debug_region;
-            if (last_closed_cmdbuf_label.empty()) {
+            if (last_closed_cmdbuf_label == vvl::CommandBuffer::kEmptyLabelId) {
                 previous_debug_region = "There are no previous debug regions before the invalid command.";
             } else {
-                previous_debug_region =
-                    std::string("The previous debug region before the invalid command is '") + last_closed_cmdbuf_label + "'.";
+                previous_debug_region = std::string("The previous debug region before the invalid command is '") +
+                                        vvl::CommandBuffer::GetLabelName(last_closed_cmdbuf_label) + "'.";
             }
             skip |= core.LogError("VUID-vkCmdEndDebugUtilsLabelEXT-commandBuffer-01912", cb_state.Handle(), loc,
                                   "(%s) contains vkCmdEndDebugUtilsLabelEXT that does not have a matching "
@@ -149,6 +202,15 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
     auto queue_state = Get<vvl::Queue>(queue);
     CommandBufferSubmitState cb_submit_state(*this, queue_state.get());
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_state->queue_family_properties.queueFlags);
+    {
+        std::vector<VkCommandBuffer> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo &submit = pSubmits[submit_idx];
+            command_buffers.insert(command_buffers.end(), submit.pCommandBuffers,
+                                   submit.pCommandBuffers + submit.commandBufferCount);
+        }
+        cb_submit_state.PrevalidateImageLayouts(command_buffers);
+    }
 
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -256,6 +318,8 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         }
     }
 
+    cb_submit_state.DeferValidation();
+
     return skip;
 }
 
@@ -317,6 +381,16 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
     auto queue_state = Get<vvl::Queue>(queue);
     CommandBufferSubmitState cb_submit_state(*this, queue_state.get());
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_state->queue_family_properties.queueFlags);
+    {
+        std::vector<VkCommandBuffer> command_buffers;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo2KHR &submit = pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit.commandBufferInfoCount; i++) {
+                command_buffers.push_back(submit.pCommandBufferInfos[i].commandBuffer);
+            }
+        }
+        cb_submit_state.PrevalidateImageLayouts(command_buffers);
+    }
 
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
@@ -389,6 +463,8 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
         }
     }
 
+    cb_submit_state.DeferValidation();
+
     return skip;
 }
 
@@ -499,7 +575,7 @@ bool CoreChecks::ValidateQueueFamilyIndices(const Location &loc, const vvl::Comm
     }
 
     // Ensure that any bound images or buffers created with SHARING_MODE_CONCURRENT have access to the current queue family
-    for (const auto &state_object : cb_state.object_bindings) {
+    for (const auto &[state_object, link] : cb_state.object_bindings) {
         switch (state_object->Type()) {
             case kVulkanObjectTypeImage: {
                 auto image_state = static_cast<const vvl::Image *>(state_object.get());
@@ -146,136 +146,226 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureHandleNV(VkDevice device
     return skip;
 }
 
-bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList &objlist, uint32_t infoCount,
-                                                               const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
-                                                               uint32_t info_i, const ErrorObject &error_obj) const {
-    using sparse_container::range;
-
-    bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
-
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-    if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state && dst_as_state) {
-        const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
-                           : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
-                               : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
-        skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
-                                                       info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                                       info_i_loc.dot(Field::dstAccelerationStructure), vuid);
-    }
-
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
+namespace {
+
+// The resources of the builds of one command that must not share memory with each other
+enum class BuildResource : uint8_t { Src = 0, Dst = 1, Scratch = 2 };
+
+// Finds the pairs of build resources that have some memory in common, by sorting their memory ranges and sweeping them
+// once. The pairwise overlap checks, which look up the bound memory of both resources, then only run on those pairs.
+class BuildOverlapCandidates {
+  public:
+    // Pairs of resources of info_a and info_b (info_a <= info_b), overlap_mask has the bit Bit(resource_a, resource_b) set
+    // for each pair of their resources that may overlap
+    struct Candidate {
+        uint32_t info_a;
+        uint32_t info_b;
+        uint16_t overlap_mask;
+    };
 
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+    static constexpr uint16_t Bit(BuildResource resource_a, BuildResource resource_b) {
+        return uint16_t(1u << (uint32_t(resource_a) * 3 + uint32_t(resource_b)));
+    }
 
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
+    void Add(uint32_t info, BuildResource resource, const vvl::Bindable &bindable,
+             const sparse_container::range<VkDeviceSize> &resource_range) {
+        for (const auto &[memory, memory_ranges] : bindable.GetBoundMemoryRange(resource_range)) {
+            for (const auto &memory_range : memory_ranges) {
+                // Inverted ranges never intersect, empty ones still intersect the ranges including their beginning
+                if (memory_range.begin > memory_range.end) continue;
+                const VkDeviceSize end = std::max(memory_range.end, memory_range.begin + 1);
+                intervals_.emplace_back(Interval{memory, memory_range.begin, end, info, resource});
+            }
+        }
+    }
 
-        // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
-        // memory that is going to be updated by this cmd
-        if (dst_as_state && other_src_as_state) {
-            if (other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
-                const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
-                                   : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
-                                       : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
-
-                skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                               info_i_loc.dot(Field::dstAccelerationStructure), *other_src_as_state,
-                                                               other_info_j_loc.dot(Field::srcAccelerationStructure), vuid);
+    // Returns the candidates sorted by info_a, then info_b
+    std::vector<Candidate> Sweep() {
+        std::sort(intervals_.begin(), intervals_.end(), [](const Interval &a, const Interval &b) {
+            return a.memory != b.memory ? CastToUint64(a.memory) < CastToUint64(b.memory) : a.begin < b.begin;
+        });
+
+        std::vector<Candidate> candidates;
+        std::vector<const Interval *> active;
+        for (const Interval &interval : intervals_) {
+            active.erase(std::remove_if(active.begin(), active.end(),
+                                        [&interval](const Interval *other) {
+                                            return other->memory != interval.memory || other->end <= interval.begin;
+                                        }),
+                         active.end());
+            for (const Interval *other : active) {
+                const Interval *a = other;
+                const Interval *b = &interval;
+                if (a->info > b->info || (a->info == b->info && a->resource > b->resource)) {
+                    std::swap(a, b);
+                }
+                if (a->info == b->info && a->resource == b->resource) continue;
+                candidates.emplace_back(Candidate{a->info, b->info, Bit(a->resource, b->resource)});
             }
+            active.emplace_back(&interval);
         }
 
-        // Validate that there is no destination acceleration structures' memory overlaps
-        if (dst_as_state && other_dst_as_state) {
-            const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
-                               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
-                                   : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
-
-            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                           info_i_loc.dot(Field::dstAccelerationStructure), *other_dst_as_state,
-                                                           other_info_j_loc.dot(Field::dstAccelerationStructure), vuid);
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+            return a.info_a != b.info_a ? a.info_a < b.info_a : a.info_b < b.info_b;
+        });
+        std::vector<Candidate> merged;
+        for (const Candidate &candidate : candidates) {
+            if (!merged.empty() && merged.back().info_a == candidate.info_a && merged.back().info_b == candidate.info_b) {
+                merged.back().overlap_mask |= candidate.overlap_mask;
+            } else {
+                merged.emplace_back(candidate);
+            }
         }
+        return merged;
     }
 
-    return skip;
-}
+  private:
+    struct Interval {
+        VkDeviceMemory memory;
+        VkDeviceSize begin;
+        VkDeviceSize end;
+        uint32_t info;
+        BuildResource resource;
+    };
+    std::vector<Interval> intervals_;
+};
 
-bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
-    const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, uint32_t info_i,
-    const VkAccelerationStructureBuildRangeInfoKHR *range_infos, const ErrorObject &error_obj) const {
-    using sparse_container::range;
+}  // namespace
 
+bool CoreChecks::ValidateAccelerationStructuresBuildMemoryAliasing(
+    const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos, const ErrorObject &error_obj) const {
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+    const Func function = error_obj.location.function;
     const rt::BuildType rt_build_type =
-        error_obj.location.function == Func::vkBuildAccelerationStructuresKHR ? rt::BuildType::Host : rt::BuildType::Device;
-
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-    // Cannot compute scratch buffer size from the CPU with indirect calls,
-    // so cannot perform validation
-    vvl::span<vvl::Buffer *const> info_scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
-    const VkDeviceSize assumed_scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, range_infos);
-
-    if (dst_as_state) {
-        vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
-        skip |= ValidateScratchMemoryNoOverlap(error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress,
-                                               assumed_scratch_size, info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                                               info_in_mode_update ? src_as_state.get() : nullptr,
-                                               info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                               info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
-    }
-
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
-
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j + info_i + 1);
+        function == Func::vkBuildAccelerationStructuresKHR ? rt::BuildType::Host : rt::BuildType::Device;
+    // Cannot compute scratch buffer size from the CPU with indirect calls, and host builds have no scratch buffer
+    const bool validate_scratches = rt_build_type == rt::BuildType::Device && ppBuildRangeInfos;
+
+    // Look up the resources of each build once
+    struct BuildResources {
+        std::shared_ptr<const vvl::AccelerationStructureKHR> src_as_state;
+        std::shared_ptr<const vvl::AccelerationStructureKHR> dst_as_state;
+        BuffersByAddress scratches;
+        VkDeviceSize scratch_size = 0;
+        bool update = false;
+    };
+    std::vector<BuildResources> builds(infoCount);
+    BuildOverlapCandidates overlap_candidates;
+
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        BuildResources &build = builds[info_i];
+        build.update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+        build.dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+        // The source acceleration structure is only read by updates
+        if (build.update) {
+            build.src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
+        }
 
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
+        // Same ranges as the ones checked by ValidateAccelStructsMemoryDoNotOverlap and ValidateScratchMemoryNoOverlap
+        for (const auto &[as_state, resource] : {std::make_pair(build.src_as_state.get(), BuildResource::Src),
+                                                 std::make_pair(build.dst_as_state.get(), BuildResource::Dst)}) {
+            if (as_state && as_state->buffer_state) {
+                overlap_candidates.Add(info_i, resource, *as_state->buffer_state,
+                                       sparse_container::range<VkDeviceSize>(as_state->create_info.offset,
+                                                                             as_state->create_info.size));
+            }
+        }
+        if (validate_scratches) {
+            build.scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
+            if (!build.scratches.empty()) {
+                build.scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, ppBuildRangeInfos[info_i]);
+            }
+            for (vvl::Buffer *const scratch : build.scratches) {
+                const VkDeviceSize scratch_offset = info.scratchData.deviceAddress - scratch->deviceAddress;
+                overlap_candidates.Add(info_i, BuildResource::Scratch, *scratch,
+                                       sparse_container::range<VkDeviceSize>(scratch_offset, scratch_offset + build.scratch_size));
+            }
+        }
+    }
 
-        const bool other_info_in_update_mode = other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+    constexpr uint16_t src_dst = BuildOverlapCandidates::Bit(BuildResource::Src, BuildResource::Dst);
+    constexpr uint16_t dst_src = BuildOverlapCandidates::Bit(BuildResource::Dst, BuildResource::Src);
+    constexpr uint16_t dst_dst = BuildOverlapCandidates::Bit(BuildResource::Dst, BuildResource::Dst);
+    constexpr uint16_t scratch_src = BuildOverlapCandidates::Bit(BuildResource::Scratch, BuildResource::Src);
+    constexpr uint16_t scratch_dst = BuildOverlapCandidates::Bit(BuildResource::Scratch, BuildResource::Dst);
+    constexpr uint16_t scratch_scratch = BuildOverlapCandidates::Bit(BuildResource::Scratch, BuildResource::Scratch);
+    // Within one build, resources are ordered
+    constexpr uint16_t src_scratch = BuildOverlapCandidates::Bit(BuildResource::Src, BuildResource::Scratch);
+    constexpr uint16_t dst_scratch = BuildOverlapCandidates::Bit(BuildResource::Dst, BuildResource::Scratch);
+
+    const char *vuid_03668 = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
+                             : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
+                                 : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
+    const char *vuid_03701 = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
+                             : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
+                                 : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
+    const char *vuid_03702 = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
+                             : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
+                                 : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
+
+    for (const auto &[info_i, info_j, overlap_mask] : overlap_candidates.Sweep()) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        const BuildResources &build = builds[info_i];
+        const BuildResources &other_build = builds[info_j];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location info_j_loc = error_obj.location.dot(Field::pInfos, info_j);
+
+        if (info_i == info_j) {
+            if ((overlap_mask & src_dst) && info.srcAccelerationStructure != info.dstAccelerationStructure) {
+                skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *build.src_as_state,
+                                                               info_i_loc.dot(Field::srcAccelerationStructure),
+                                                               *build.dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure),
+                                                               vuid_03668);
+            }
+            if ((overlap_mask & (src_scratch | dst_scratch)) && build.dst_as_state) {
+                vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
+                skip |= ValidateScratchMemoryNoOverlap(
+                    error_obj.location, objlist, build.scratches, info.scratchData.deviceAddress, build.scratch_size,
+                    info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress), build.src_as_state.get(),
+                    info_i_loc.dot(Field::srcAccelerationStructure), *build.dst_as_state,
+                    info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
+            }
+            continue;
+        }
 
-        if (other_dst_as_state) {
-            auto other_info_scratches = GetBuffersByAddress(other_info->scratchData.deviceAddress);
-            const VkDeviceSize assumed_other_scratch_size = rt::ComputeScratchSize(rt_build_type, device, *other_info, range_infos);
+        // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
+        // memory that is going to be updated by this cmd
+        if (overlap_mask & dst_src) {
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *build.dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure),
+                                                           *other_build.src_as_state,
+                                                           info_j_loc.dot(Field::srcAccelerationStructure), vuid_03701);
+        }
 
-            const Location other_scratch_loc = other_info_j_loc.dot(Field::scratchData);
-            const Location other_scratch_address_loc = other_scratch_loc.dot(Field::deviceAddress);
+        // Validate that there is no destination acceleration structures' memory overlaps
+        if (overlap_mask & dst_dst) {
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *build.dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure),
+                                                           *other_build.dst_as_state,
+                                                           info_j_loc.dot(Field::dstAccelerationStructure), vuid_03702);
+        }
 
+        // Validate that scratch buffer's memory does not overlap the other destination acceleration structure's memory, or
+        // its source acceleration structure's memory if build mode is update, or its scratch buffers' memory.
+        // Here validation is pessimistic: if one buffer associated to pInfos[info_j].scratchData.deviceAddress has an
+        // overlap, an error will be logged.
+        if ((overlap_mask & (scratch_src | scratch_dst | scratch_scratch)) && other_build.dst_as_state) {
+            const VkAccelerationStructureBuildGeometryInfoKHR &other_info = pInfos[info_j];
+            const Location other_scratch_address_loc = info_j_loc.dot(Field::scratchData).dot(Field::deviceAddress);
             skip |= ValidateScratchMemoryNoOverlap(
-                error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress, assumed_scratch_size,
-                info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                other_info_in_update_mode ? other_src_as_state.get() : nullptr,
-                other_info_j_loc.dot(Field::srcAccelerationStructure), *other_dst_as_state,
-                other_info_j_loc.dot(Field::dstAccelerationStructure), other_info_scratches, other_info->scratchData.deviceAddress,
-                assumed_other_scratch_size, &other_scratch_address_loc);
+                error_obj.location, objlist, build.scratches, info.scratchData.deviceAddress, build.scratch_size,
+                info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress), other_build.src_as_state.get(),
+                info_j_loc.dot(Field::srcAccelerationStructure), *other_build.dst_as_state,
+                info_j_loc.dot(Field::dstAccelerationStructure), other_build.scratches, other_info.scratchData.deviceAddress,
+                other_build.scratch_size, &other_scratch_address_loc);
         }
     }
 
@@ -888,13 +978,10 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, commandBuffer);
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, ppBuildRangeInfos[info_i], info_loc);
-
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
-        skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i,
-                                                                                 ppBuildRangeInfos[info_i], error_obj);
     }
 
+    skip |= ValidateAccelerationStructuresBuildMemoryAliasing(commandBuffer, infoCount, pInfos, ppBuildRangeInfos, error_obj);
+
     return skip;
 }
 
@@ -906,6 +993,9 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
     skip |= ValidateDeferredOperation(device, deferredOperation, error_obj.location.dot(Field::deferredOperation),
                                       "VUID-vkBuildAccelerationStructuresKHR-deferredOperation-03678");
 
+    std::vector<VkDeviceSize> scratch_sizes(infoCount);
+    std::vector<sparse_container::range<uint64_t>> scratch_addr_ranges(infoCount);
+
     for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
         const Location info_loc = error_obj.location.dot(Field::pInfos, info_i);
         auto src_as_state = Get<vvl::AccelerationStructureKHR>(info->srcAccelerationStructure);
@@ -963,34 +1053,10 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, info_i, error_obj);
         const VkDeviceSize scratch_i_size = rt::ComputeScratchSize(rt::BuildType::Host, device, *info, ppBuildRangeInfos[info_i]);
         auto scratch_i_host_addr = reinterpret_cast<uint64_t>(info->scratchData.hostAddress);
-        const sparse_container::range<uint64_t> scratch_addr_range(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
-
-        assert(infoCount > info_i);
-        for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-            const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j + info_i + 1);
-            const VkDeviceSize other_scratch_size =
-                rt::ComputeScratchSize(rt::BuildType::Host, device, *other_info, ppBuildRangeInfos[other_info_j]);
-            auto other_scratch_host_addr = reinterpret_cast<uint64_t>(other_info->scratchData.hostAddress);
-            const sparse_container::range<uint64_t> other_scratch_addr_range(other_scratch_host_addr,
-                                                                             other_scratch_host_addr + other_scratch_size);
-
-            if (scratch_addr_range.intersects(other_scratch_addr_range)) {
-                std::string info_i_scratch_str = info_loc.dot(Field::scratchData).Fields();
-                std::string other_info_j_scratch_str = other_info_j_loc.dot(Field::scratchData).Fields();
-                skip |= LogError(
-                    "VUID-vkBuildAccelerationStructuresKHR-scratchData-03704", device, info_loc.dot(Field::scratchData),
-                    "overlaps with %s on host address range %s.\n"
-                    "%s.hostAddress is %p and assumed scratch size is %" PRIu64
-                    ".\n"
-                    "%s.hostAddress is %p and assumed scratch size is %" PRIu64 ".",
-                    other_info_j_scratch_str.c_str(), string_range_hex(scratch_addr_range & other_scratch_addr_range).c_str(),
-                    info_i_scratch_str.c_str(), info->scratchData.hostAddress, scratch_i_size, other_info_j_scratch_str.c_str(),
-                    other_info->scratchData.hostAddress, other_scratch_size);
-            }
-        }
+        scratch_sizes[info_i] = scratch_i_size;
+        scratch_addr_ranges[info_i] = sparse_container::range<uint64_t>(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
 
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, LogObjectList());
 
@@ -1068,6 +1134,56 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
     }
+
+    skip |= ValidateAccelerationStructuresBuildMemoryAliasing(LogObjectList(), infoCount, pInfos, nullptr, error_obj);
+
+    // Sort the scratch host ranges by address, so that only the ranges that start before the end of another one need to be
+    // compared with it
+    std::vector<uint32_t> sorted_scratches(infoCount);
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        sorted_scratches[info_i] = info_i;
+    }
+    std::sort(sorted_scratches.begin(), sorted_scratches.end(), [&scratch_addr_ranges](uint32_t a, uint32_t b) {
+        return scratch_addr_ranges[a].begin < scratch_addr_ranges[b].begin;
+    });
+    std::vector<std::pair<uint32_t, uint32_t>> overlapping_scratches;
+    std::vector<uint32_t> active_scratches;
+    for (uint32_t info_i : sorted_scratches) {
+        const sparse_container::range<uint64_t> &scratch_addr_range = scratch_addr_ranges[info_i];
+        // Empty ranges still intersect the ranges including their beginning
+        active_scratches.erase(std::remove_if(active_scratches.begin(), active_scratches.end(),
+                                              [&](uint32_t info_j) {
+                                                  const sparse_container::range<uint64_t> &other = scratch_addr_ranges[info_j];
+                                                  return std::max(other.end, other.begin + 1) <= scratch_addr_range.begin;
+                                              }),
+                               active_scratches.end());
+        for (uint32_t info_j : active_scratches) {
+            if (scratch_addr_range.intersects(scratch_addr_ranges[info_j])) {
+                overlapping_scratches.emplace_back(std::min(info_i, info_j), std::max(info_i, info_j));
+            }
+        }
+        active_scratches.emplace_back(info_i);
+    }
+    std::sort(overlapping_scratches.begin(), overlapping_scratches.end());
+
+    for (const auto &[info_i, other_info_j] : overlapping_scratches) {
+        const Location info_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+        const sparse_container::range<uint64_t> &scratch_addr_range = scratch_addr_ranges[info_i];
+        const sparse_container::range<uint64_t> &other_scratch_addr_range = scratch_addr_ranges[other_info_j];
+        std::string info_i_scratch_str = info_loc.dot(Field::scratchData).Fields();
+        std::string other_info_j_scratch_str = other_info_j_loc.dot(Field::scratchData).Fields();
+        skip |= LogError("VUID-vkBuildAccelerationStructuresKHR-scratchData-03704", device, info_loc.dot(Field::scratchData),
+                         "overlaps with %s on host address range %s.\n"
+                         "%s.hostAddress is %p and assumed scratch size is %" PRIu64
+                         ".\n"
+                         "%s.hostAddress is %p and assumed scratch size is %" PRIu64 ".",
+                         other_info_j_scratch_str.c_str(), string_range_hex(scratch_addr_range & other_scratch_addr_range).c_str(),
+                         info_i_scratch_str.c_str(), pInfos[info_i].scratchData.hostAddress, scratch_sizes[info_i],
+                         other_info_j_scratch_str.c_str(), pInfos[other_info_j].scratchData.hostAddress,
+                         scratch_sizes[other_info_j]);
+    }
+
     return skip;
 }
 
@@ -1123,12 +1239,12 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(VkComm
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, commandBuffer);
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, nullptr, info_loc);
     }
+
+    skip |= ValidateAccelerationStructuresBuildMemoryAliasing(commandBuffer, infoCount, pInfos, nullptr, error_obj);
     return skip;
 }
 
@@ -1969,6 +2085,17 @@ bool CoreChecks::ValidateRaytracingShaderBindingTable(VkCommandBuffer commandBuf
         return skip;
     }
 
+    // The version is read first, a buffer created or destroyed while validating then only makes the entry stale
+    const ShaderBindingTableKey key{binding_table.deviceAddress, binding_table.size, binding_table.stride};
+    const uint32_t address_ranges_version = buffer_device_address_ranges_version;
+    {
+        ReadLockGuard guard(good_shader_binding_tables_lock_);
+        const auto it = good_shader_binding_tables_.find(key);
+        if (it != good_shader_binding_tables_.end() && it->second == address_ranges_version) {
+            return skip;
+        }
+    }
+
     const auto buffer_states = GetBuffersByAddress(binding_table.deviceAddress);
     if (buffer_states.empty()) {
         skip |= LogError("VUID-VkStridedDeviceAddressRegionKHR-size-04631", commandBuffer, table_loc.dot(Field::deviceAddress),
@@ -2038,6 +2165,15 @@ bool CoreChecks::ValidateRaytracingShaderBindingTable(VkCommandBuffer commandBuf
                                                                   LogObjectList(commandBuffer), binding_table.deviceAddress);
     }
 
+    if (!skip) {
+        WriteLockGuard guard(good_shader_binding_tables_lock_);
+        // Tables are few, growing past this means addresses keep changing and the old entries are stale
+        if (good_shader_binding_tables_.size() >= 1024) {
+            good_shader_binding_tables_.clear();
+        }
+        good_shader_binding_tables_[key] = address_ranges_version;
+    }
+
     return skip;
 }
 
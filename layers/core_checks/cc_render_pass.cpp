@@ -367,6 +367,12 @@ bool CoreChecks::ValidateRenderPassCompatibility(const VulkanTypedHandle &rp1_ob
                                                  const Location &loc, const char *vuid) const {
     bool skip = false;
 
+    // The common compatible case, the detailed walk below is only needed to find out what differs
+    if (rp1_state.compatibility_fingerprint != 0 &&
+        rp1_state.compatibility_fingerprint == rp2_state.compatibility_fingerprint) {
+        return skip;
+    }
+
     // createInfo flags must be identical for the renderpasses to be compatible.
     if (rp1_state.create_info.flags != rp2_state.create_info.flags) {
         const LogObjectList objlist(rp1_object, rp1_state.Handle(), rp2_object, rp2_state.Handle());
@@ -1028,9 +1034,25 @@ bool CoreChecks::VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBegi
     auto render_pass_state = Get<vvl::RenderPass>(begin_info.renderPass);
     ASSERT_AND_RETURN_SKIP(render_pass_state);
     const auto *render_pass_create_info = &render_pass_state->create_info;
-    for (uint32_t i = 0; i < render_pass_attachment_begin_info->attachmentCount; ++i) {
+    const auto *ms_render_to_single_sample =
+        vku::FindStructInPNextChain<VkMultisampledRenderToSingleSampledInfoEXT>(begin_info.pNext);
+    const bool render_to_single_sampled =
+        ms_render_to_single_sample && ms_render_to_single_sample->multisampledRenderToSingleSampledEnable;
+
+    const uint32_t attachment_count = render_pass_attachment_begin_info->attachmentCount;
+    small_vector<std::shared_ptr<const vvl::ImageView>, 8> attachment_views(attachment_count);
+    bool all_views_valid = true;
+    for (uint32_t i = 0; i < attachment_count; ++i) {
+        attachment_views[i] = Get<vvl::ImageView>(render_pass_attachment_begin_info->pAttachments[i]);
+        all_views_valid &= attachment_views[i] != nullptr;
+    }
+    // Only depends on immutable state of the framebuffer, render pass and views, the same begin passing again is a lookup
+    const bool cached = all_views_valid && framebuffer_state->imageless_attachment_cache.Contains(
+                                               render_pass_state, attachment_views.data(), attachment_count,
+                                               render_to_single_sampled);
+    for (uint32_t i = 0; i < attachment_count && !cached; ++i) {
         const Location attachment_loc = begin_info_loc.pNext(Struct::VkRenderPassAttachmentBeginInfo, Field::pAttachments, i);
-        auto image_view_state = Get<vvl::ImageView>(render_pass_attachment_begin_info->pAttachments[i]);
+        const auto &image_view_state = attachment_views[i];
         ASSERT_AND_CONTINUE(image_view_state);
 
         const VkImageViewCreateInfo *image_view_create_info = &image_view_state->create_info;
@@ -1145,11 +1167,7 @@ bool CoreChecks::VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBegi
         }
 
         const VkSampleCountFlagBits attachment_samples = render_pass_create_info->pAttachments[i].samples;
-        const auto *ms_render_to_single_sample =
-            vku::FindStructInPNextChain<VkMultisampledRenderToSingleSampledInfoEXT>(begin_info.pNext);
-        const bool single_sample_enabled = ms_render_to_single_sample &&
-                                           ms_render_to_single_sample->multisampledRenderToSingleSampledEnable &&
-                                           (attachment_samples == VK_SAMPLE_COUNT_1_BIT);
+        const bool single_sample_enabled = render_to_single_sampled && (attachment_samples == VK_SAMPLE_COUNT_1_BIT);
         if (attachment_samples != image_create_info->samples && !single_sample_enabled) {
             skip |= LogError("VUID-VkRenderPassBeginInfo-framebuffer-09047", objlist, attachment_loc,
                              "internal VkImage was created with %s samples, "
@@ -1183,6 +1201,10 @@ bool CoreChecks::VerifyFramebufferAndRenderPassImageViews(const VkRenderPassBegi
                              "was created with viewType of VK_IMAGE_VIEW_TYPE_3D.");
         }
     }
+    if (!cached && all_views_valid && !skip) {
+        framebuffer_state->imageless_attachment_cache.Insert(render_pass_state, attachment_views.data(), attachment_count,
+                                                             render_to_single_sampled);
+    }
 
     if (enabled_features.externalFormatResolve && !android_external_format_resolve_null_color_attachment_prop) {
         for (const auto [i, subpass] : vvl::enumerate(render_pass_create_info->pSubpasses, render_pass_create_info->subpassCount)) {
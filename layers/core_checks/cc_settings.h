@@ -0,0 +1,37 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Which action commands run a sampled family of draw time checks
+enum class DrawSamplingMode {
+    EveryNth,  // Every Nth action command of each command buffer
+    Hash,      // Action commands whose hash of (command buffer, action command index) falls under 1/N
+};
+
+// Deterministic sampling of the draw time checks of ValidateActionState, for long running tests where checking a fraction
+// of the draws gives enough coverage over many frames. A sample rate of N runs the family for 1 out of N action commands,
+// 1 runs it for every action command. Sampled action commands get the full checks of the family.
+struct CoreChecksSettings {
+    DrawSamplingMode draw_sampling_mode = DrawSamplingMode::EveryNth;
+    // Dynamic state, pipeline and shader object checks against the render pass instance and vertex buffers
+    uint32_t draw_state_sample_rate = 1;
+    // Descriptor set compatibility and contents, the DescriptorValidator
+    uint32_t descriptor_sample_rate = 1;
+};
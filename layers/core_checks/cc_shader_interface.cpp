@@ -484,14 +484,65 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(const spirv::Module &modul
     return skip;
 }
 
-bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
-                                                const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
+bool CoreChecks::IsGoodStageInterface(const std::shared_ptr<const spirv::Module> &producer_spirv,
+                                      const spirv::EntryPoint &producer_entrypoint,
+                                      const std::shared_ptr<const spirv::Module> &consumer_spirv,
+                                      const spirv::EntryPoint &consumer_entrypoint) const {
+    if (disabled[shader_validation_caching]) {
+        return false;
+    }
+    ReadLockGuard guard(good_stage_interfaces_lock_);
+    const auto it = good_stage_interfaces_.find(StageInterfaceKey{&producer_entrypoint, &consumer_entrypoint});
+    // An expired module means the entry point addresses were reused by another module
+    return it != good_stage_interfaces_.end() && it->second.producer.lock() == producer_spirv &&
+           it->second.consumer.lock() == consumer_spirv;
+}
+
+void CoreChecks::AddGoodStageInterface(const std::shared_ptr<const spirv::Module> &producer_spirv,
+                                       const spirv::EntryPoint &producer_entrypoint,
+                                       const std::shared_ptr<const spirv::Module> &consumer_spirv,
+                                       const spirv::EntryPoint &consumer_entrypoint) const {
+    if (disabled[shader_validation_caching]) {
+        return;
+    }
+    WriteLockGuard guard(good_stage_interfaces_lock_);
+    if (good_stage_interfaces_.size() >= good_stage_interfaces_prune_size_) {
+        for (auto it = good_stage_interfaces_.begin(); it != good_stage_interfaces_.end();) {
+            if (it->second.producer.expired() || it->second.consumer.expired()) {
+                it = good_stage_interfaces_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        good_stage_interfaces_prune_size_ = std::max(good_stage_interfaces_prune_size_, good_stage_interfaces_.size() * 2);
+    }
+    good_stage_interfaces_[StageInterfaceKey{&producer_entrypoint, &consumer_entrypoint}] = {producer_spirv, consumer_spirv};
+}
+
+bool CoreChecks::ValidateInterfaceBetweenStages(const std::shared_ptr<const spirv::Module> &producer_spirv,
+                                                const spirv::EntryPoint &producer_entrypoint,
+                                                const std::shared_ptr<const spirv::Module> &consumer_spirv,
+                                                const spirv::EntryPoint &consumer_entrypoint,
                                                 const Location &create_info_loc) const {
     bool skip = false;
 
     if (producer_entrypoint.has_passthrough) {
         return skip;  // PassthroughNV doesn't have to do Location matching
     }
+    if (IsGoodStageInterface(producer_spirv, producer_entrypoint, consumer_spirv, consumer_entrypoint)) {
+        return skip;
+    }
+
+    const spirv::Module &producer = *producer_spirv;
+    const spirv::Module &consumer = *consumer_spirv;
+    // Set along with every message, the stage pair is only cached if nothing was reported
+    bool reported = false;
+    const auto finish = [&]() {
+        if (!reported) {
+            AddGoodStageInterface(producer_spirv, producer_entrypoint, consumer_spirv, consumer_entrypoint);
+        }
+        return skip;
+    };
 
     const VkShaderStageFlagBits producer_stage = producer_entrypoint.stage;
     const VkShaderStageFlagBits consumer_stage = consumer_entrypoint.stage;
@@ -545,6 +596,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                 if ((component_info.output_type != component_info.input_type) ||
                     (component_info.output_width != component_info.input_width)) {
                     const LogObjectList objlist(producer.handle(), consumer.handle());
+                    reported = true;
                     skip |= LogError("VUID-RuntimeSpirv-OpEntryPoint-07754", objlist, create_info_loc,
                                      "(SPIR-V Interface) Type mismatch on Location %" PRIu32 " Component %" PRIu32
                                      ", between\n\n%s stage:\n%s%s\n\n%s stage:\n%s%s\n\n",
@@ -581,6 +633,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                     const uint32_t input_vec_size = input_var->base_type.Word(3);
                     if (output_vec_size > input_vec_size) {
                         const LogObjectList objlist(producer.handle(), consumer.handle());
+                        reported = true;
                         skip |= LogError("VUID-RuntimeSpirv-maintenance4-06817", objlist, create_info_loc,
                                          "(SPIR-V Interface) starting at Location %" PRIu32 " Component %" PRIu32
                                          " the Output (%s) has a Vec%" PRIu32 " while Input (%s) as a Vec%" PRIu32
@@ -598,6 +651,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                 // Don't give any warning if maintenance4 with vectors
                 if (!enabled_features.maintenance4 && (output_var->base_type.Opcode() != spv::OpTypeVector)) {
                     const LogObjectList objlist(producer.handle(), consumer.handle());
+                    reported = true;
                     skip |= LogPerformanceWarning("WARNING-Shader-OutputNotConsumed", objlist, create_info_loc,
                                                   "(SPIR-V Interface) %s declared to output location %" PRIu32 " Component %" PRIu32
                                                   " but is not an Input declared by %s.",
@@ -612,6 +666,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                     break;  // When going inbetween Tessellation or Geometry, array size can be different
                 }
                 const LogObjectList objlist(producer.handle(), consumer.handle());
+                reported = true;
                 skip |= LogError("VUID-RuntimeSpirv-OpEntryPoint-08743", objlist, create_info_loc,
                                  "(SPIR-V Interface) %s declared input at Location %" PRIu32 " Component %" PRIu32
                                  " %sbut it is not an Output declared in %s",
@@ -624,7 +679,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
 
     // Need to check the BuiltIn interface (if not going into Fragment)
     if (consumer_stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        return skip;
+        return finish();
     }
 
     std::vector<uint32_t> input_builtins_block;
@@ -645,7 +700,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
     bool mismatch = false;
     if (input_builtins_block.empty() || output_builtins_block.empty()) {
         // TODO - Nothing about this in spec, need to add language to confirm this is correct
-        return skip;
+        return finish();
     } else if (input_builtins_block.size() != output_builtins_block.size()) {
         mismatch = true;
     } else {
@@ -673,10 +728,11 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
         }
         msg << "}\n";
         const LogObjectList objlist(producer.handle(), consumer.handle());
+        reported = true;
         skip |= LogError("VUID-RuntimeSpirv-OpVariable-08746", objlist, create_info_loc,
                          "(SPIR-V Interface) Mismatch in BuiltIn blocks:\n %s", msg.str().c_str());
     }
-    return skip;
+    return finish();
 }
 
 bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
@@ -912,8 +968,8 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
             break;
         }
         if (consumer_spirv && producer_spirv && consumer.entrypoint && producer.entrypoint) {
-            skip |= ValidateInterfaceBetweenStages(*producer_spirv.get(), *producer.entrypoint, *consumer_spirv.get(),
-                                                   *consumer.entrypoint, create_info_loc);
+            skip |= ValidateInterfaceBetweenStages(producer_spirv, *producer.entrypoint, consumer_spirv, *consumer.entrypoint,
+                                                   create_info_loc);
         }
     }
 
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "core_validation.h"
 #include "state_tracker/shader_object_state.h"
 #include "state_tracker/shader_module.h"
@@ -402,6 +404,16 @@ bool CoreChecks::PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT sh
     return skip;
 }
 
+void CoreChecks::PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    // A new shader object could reuse the address of this one
+    {
+        WriteLockGuard guard(good_bound_shader_objects_lock_);
+        good_bound_shader_objects_.clear();
+    }
+    StateTracker::PreCallRecordDestroyShaderEXT(device, shader, pAllocator, record_obj);
+}
+
 bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
                                                   const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders,
                                                   const ErrorObject& error_obj) const {
@@ -615,8 +627,23 @@ bool CoreChecks::ValidateDrawShaderObject(const LastBound& last_bound_state, con
                          FormatHandle(cb_state.activeRenderPass->Handle()).c_str());
     }
 
-    skip |= ValidateDrawShaderObjectLinking(last_bound_state, vuid);
-    skip |= ValidateDrawShaderObjectPushConstantAndLayout(last_bound_state, vuid);
+    BoundShaderObjects bound_shaders;
+    std::copy(std::begin(last_bound_state.shader_object_states), std::end(last_bound_state.shader_object_states),
+              bound_shaders.shaders.begin());
+    bool known_good = false;
+    if (!disabled[shader_validation_caching]) {
+        ReadLockGuard guard(good_bound_shader_objects_lock_);
+        known_good = good_bound_shader_objects_.find(bound_shaders) != good_bound_shader_objects_.end();
+    }
+    if (!known_good) {
+        bool shaders_skip = ValidateDrawShaderObjectLinking(last_bound_state, vuid);
+        shaders_skip |= ValidateDrawShaderObjectPushConstantAndLayout(last_bound_state, vuid);
+        if (!shaders_skip && !disabled[shader_validation_caching]) {
+            WriteLockGuard guard(good_bound_shader_objects_lock_);
+            good_bound_shader_objects_.insert(bound_shaders);
+        }
+        skip |= shaders_skip;
+    }
     skip |= ValidateDrawShaderObjectMesh(last_bound_state, vuid);
 
     return skip;
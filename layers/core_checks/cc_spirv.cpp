@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <sstream>
@@ -2131,6 +2132,7 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
 // Validate the VkPipelineShaderStageCreateInfo from the various pipeline types or a Shader Object
 bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const vvl::Pipeline *pipeline,
                                      const Location &loc) const {
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::ShaderStage);
     bool skip = false;
     const VkShaderStageFlagBits stage = stage_state.GetStage();
 
@@ -2151,6 +2153,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
     }
 
     const spirv::Module &module_state = *stage_state.spirv_state.get();
+    skip |= JoinDeferredSpirvValidation(module_state);
     if (!module_state.valid_spirv) return skip;  // checked elsewhere
 
     if (!stage_state.entrypoint) {
@@ -2171,9 +2174,11 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         // setup the call back if the optimizer fails
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module_state, &stage, loc, this](
+        bool optimizer_reported = false;
+        spvtools::MessageConsumer consumer = [&skip, &optimizer_reported, &module_state, &stage, loc, this](
                                                  spv_message_level_t level, const char *source, const spv_position_t &position,
                                                  const char *message) {
+            optimizer_reported = true;
             skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
                              "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
                              FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message);
@@ -2183,11 +2188,11 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need to
         // use those values to apply to the spec constants
         auto const &specialization_info = stage_state.GetSpecializationInfo();
+        std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
         if (specialization_info != nullptr && specialization_info->mapEntryCount > 0 &&
             specialization_info->pMapEntries != nullptr) {
             // Gather the specialization-constant values.
             auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-            std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
             id_value_map.reserve(specialization_info->mapEntryCount);
 
             // spirv-val makes sure every OpSpecConstant has a OpDecoration.
@@ -2273,50 +2278,88 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
         optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
 
-        // Apply the specialization-constant values and revalidate the shader module is valid.
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, spirv_val_options, true);
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            auto const spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
+        SpecializationKey specialization_key{&entrypoint, {id_value_map.begin(), id_value_map.end()}};
+        std::sort(specialization_key.values.begin(), specialization_key.values.end());
+        auto good_specialization = FindGoodSpecialization(stage_state.spirv_state, specialization_key);
+        // Specializations accepted by the previous runs of the application are in the validation cache file
+        ValidationCache *cache = good_specialization ? nullptr : CastFromHandle<ValidationCache *>(core_validation_cache);
+        const uint64_t cache_hash = cache ? SpecializationCacheHash(module_state, specialization_key, spirv_environment) : 0;
+        if (cache) {
+            if (const auto cached = cache->FindSpecialization(cache_hash)) {
+                good_specialization = SpecializationResult{stage_state.spirv_state, cached->local_size_x, cached->local_size_y,
+                                                           cached->local_size_z, cached->total_workgroup_shared_memory};
+                AddGoodSpecialization(std::move(specialization_key), *good_specialization);
+            }
+        }
+        if (good_specialization) {
+            local_size_x = good_specialization->local_size_x;
+            local_size_y = good_specialization->local_size_y;
+            local_size_z = good_specialization->local_size_z;
+            total_workgroup_shared_memory = good_specialization->total_workgroup_shared_memory;
+        } else {
+            // Apply the specialization-constant values and revalidate the shader module is valid.
+            std::vector<uint32_t> specialized_spirv;
+            auto const optimized =
+                optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, spirv_val_options, true);
+            if (optimized) {
+                spv_context ctx = spvContextCreate(spirv_environment);
+                spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+                spv_diagnostic diag = nullptr;
+                auto const spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
+                if (spv_valid != SPV_SUCCESS) {
+                    const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
+                                                : "VUID-VkShaderCreateInfoEXT-pCode-08460";
+                    std::string name = pipeline ? FormatHandle(module_state.handle()) : "shader object";
+                    skip |= LogError(vuid, device, loc,
+                                     "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s",
+                                     name.c_str(), string_VkShaderStageFlagBits(stage),
+                                     diag && diag->error ? diag->error : "(no error text)");
+                }
+
+                // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if
+                // an input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
+                // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow
+                // under "static use" rules and need to be validated still.
+                //
+                // The local size is evaluated from the original module when its spec constants only go through simple integer
+                // operations, and the workgroup memory is the same as long as no array length is a spec constant.
+                if (module_state.static_data_.has_spec_constant_workgroup_memory ||
+                    !module_state.EvaluateLocalSize(entrypoint, id_value_map, local_size_x, local_size_y, local_size_z)) {
+                    // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
+                    // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with
+                    // different spec constant values.
+                    spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
+
+                    const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
+                    assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
+
+                    spec_mod.FindLocalSize(*spec_entrypoint, local_size_x, local_size_y, local_size_z);
+
+                    total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
+                } else {
+                    total_workgroup_shared_memory = module_state.CalculateWorkgroupSharedMemory();
+                }
+                if (spv_valid == SPV_SUCCESS && !optimizer_reported) {
+                    if (cache) {
+                        cache->InsertSpecialization(
+                            cache_hash, {local_size_x, local_size_y, local_size_z, total_workgroup_shared_memory});
+                    }
+                    AddGoodSpecialization(std::move(specialization_key),
+                                          {stage_state.spirv_state, local_size_x, local_size_y, local_size_z,
+                                           total_workgroup_shared_memory});
+                }
+
+                spvDiagnosticDestroy(diag);
+                spvContextDestroy(ctx);
+            } else {
+                // Should never get here, but better then asserting
                 const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
                                             : "VUID-VkShaderCreateInfoEXT-pCode-08460";
-                std::string name = pipeline ? FormatHandle(module_state.handle()) : "shader object";
                 skip |= LogError(vuid, device, loc,
-                                 "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s", name.c_str(),
-                                 string_VkShaderStageFlagBits(stage), diag && diag->error ? diag->error : "(no error text)");
+                                 "%s shader (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
+                                 FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage));
             }
 
-            // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
-            // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
-            // spec constant values.
-            spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
-
-            // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
-            // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
-            // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
-            // "static use" rules and need to be validated still.
-
-            const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
-            assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
-
-            spec_mod.FindLocalSize(*spec_entrypoint, local_size_x, local_size_y, local_size_z);
-
-            total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
-
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
-        } else {
-            // Should never get here, but better then asserting
-            const char *vuid = pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
-                                        : "VUID-VkShaderCreateInfoEXT-pCode-08460";
-            skip |= LogError(vuid, device, loc,
-                             "%s shader (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
-                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage));
         }
 
         if (skip) {
@@ -2404,6 +2447,53 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
     return skip;
 }
 
+std::optional<CoreChecks::SpecializationResult> CoreChecks::FindGoodSpecialization(
+    const std::shared_ptr<const spirv::Module> &module_state, const SpecializationKey &key) const {
+    if (disabled[shader_validation_caching]) {
+        return std::nullopt;
+    }
+    ReadLockGuard guard(good_specializations_lock_);
+    const auto it = good_specializations_.find(key);
+    // An expired module means the entry point address was reused by another module
+    if (it == good_specializations_.end() || it->second.module.lock() != module_state) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void CoreChecks::AddGoodSpecialization(SpecializationKey &&key, const SpecializationResult &result) const {
+    if (disabled[shader_validation_caching]) {
+        return;
+    }
+    WriteLockGuard guard(good_specializations_lock_);
+    if (good_specializations_.size() >= good_specializations_prune_size_) {
+        for (auto it = good_specializations_.begin(); it != good_specializations_.end();) {
+            if (it->second.module.expired()) {
+                it = good_specializations_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        good_specializations_prune_size_ = std::max(good_specializations_prune_size_, good_specializations_.size() * 2);
+    }
+    good_specializations_[std::move(key)] = result;
+}
+
+uint64_t CoreChecks::SpecializationCacheHash(const spirv::Module &module_state, const SpecializationKey &key,
+                                            spv_target_env spirv_environment) const {
+    // Only what is the same from one run to the next, not the entry point address of the in memory key
+    uint64_t hash = hash_util::ValidationCacheHash(module_state.words_.data(), module_state.words_.size() * sizeof(uint32_t));
+    hash = hash_util::ValidationCacheHash(key.entrypoint->name.data(), key.entrypoint->name.size(), hash);
+    std::vector<uint32_t> key_words = {static_cast<uint32_t>(spirv_environment),
+                                       static_cast<uint32_t>(key.entrypoint->execution_model)};
+    for (const auto &[id, value] : key.values) {
+        key_words.emplace_back(id);
+        key_words.emplace_back(static_cast<uint32_t>(value.size()));
+        key_words.insert(key_words.end(), value.begin(), value.end());
+    }
+    return hash_util::ValidationCacheHash(key_words.data(), key_words.size() * sizeof(uint32_t), hash);
+}
+
 uint32_t CoreChecks::CalcShaderStageCount(const vvl::Pipeline &pipeline, VkShaderStageFlagBits stageBit) const {
     uint32_t total = 0;
     for (const auto &stage_ci : pipeline.shader_stages_ci) {
@@ -2461,6 +2551,9 @@ void CoreChecks::PreCallRecordCreateShaderModule(VkDevice device, const VkShader
     ValidationStateTracker::PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj,
                                                             chassis_state);
     chassis_state.skip |= ValidateSpirvStateless(*chassis_state.module_state, chassis_state.stateless_data, record_obj.location);
+    if (CanDeferSpirvValidation(*pCreateInfo)) {
+        chassis_state.skip |= DeferSpirvValidation(*pCreateInfo, chassis_state, record_obj.location.dot(Field::pCreateInfo));
+    }
 }
 
 void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
@@ -2468,12 +2561,15 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
                                                const RecordObject &record_obj, chassis::ShaderObject &chassis_state) {
     ValidationStateTracker::PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                           chassis_state);
-    for (uint32_t i = 0; i < createInfoCount; ++i) {
-        if (chassis_state.module_states[i]) {
-            chassis_state.skip |= ValidateSpirvStateless(*chassis_state.module_states[i], chassis_state.stateless_data[i],
-                                                         record_obj.location.dot(Field::pCreateInfos, i));
-        }
-    }
+    std::atomic<bool> skip{false};
+    vvl::ParallelFor(validation_worker_pool.get(), createInfoCount, [&](uint32_t i) {
+        if (chassis_state.module_states[i] &&
+            ValidateSpirvStateless(*chassis_state.module_states[i], chassis_state.stateless_data[i],
+                                   record_obj.location.dot(Field::pCreateInfos, i))) {
+            skip.store(true, std::memory_order_relaxed);
+        }
+    });
+    chassis_state.skip |= skip.load(std::memory_order_relaxed);
 }
 
 bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc, ValidationCache *cache) const {
@@ -2516,8 +2612,8 @@ bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &
     return skip;
 }
 
-bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &create_info,
-                                                const Location &create_info_loc) const {
+bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &create_info, const Location &create_info_loc,
+                                                bool defer_spirv_val) const {
     bool skip = false;
 
     if (disabled[shader_validation]) {
@@ -2534,7 +2630,7 @@ bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &
     } else if (SafeModulo(create_info.codeSize, 4) != 0) {
         skip |= LogError("VUID-VkShaderModuleCreateInfo-codeSize-08735", device, create_info_loc.dot(Field::codeSize),
                          "(%zu) must be a multiple of 4.", create_info.codeSize);
-    } else {
+    } else if (!defer_spirv_val) {
         // if pCode is garbage, don't pass along to spirv-val
 
         const auto validation_cache_ci = vku::FindStructInPNextChain<VkShaderModuleValidationCacheCreateInfoEXT>(create_info.pNext);
@@ -2555,7 +2651,120 @@ bool CoreChecks::ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo &
 bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                    const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                    const ErrorObject &error_obj) const {
-    return ValidateShaderModuleCreateInfo(*pCreateInfo, error_obj.location.dot(Field::pCreateInfo));
+    // With async_spirv_validation, spirv-val is started by PreCallRecordCreateShaderModule once the module is parsed
+    return ValidateShaderModuleCreateInfo(*pCreateInfo, error_obj.location.dot(Field::pCreateInfo),
+                                          CanDeferSpirvValidation(*pCreateInfo));
+}
+
+// Only the modules checked against the default validation cache are deferred, a cache of the application could be destroyed
+// once vkCreateShaderModule returns
+bool CoreChecks::CanDeferSpirvValidation(const VkShaderModuleCreateInfo &create_info) const {
+    return enabled[async_spirv_validation] && validation_worker_pool && !disabled[shader_validation] && create_info.pCode &&
+           create_info.pCode[0] == spv::MagicNumber && SafeModulo(create_info.codeSize, 4) == 0 &&
+           !vku::FindStructInPNextChain<VkShaderModuleValidationCacheCreateInfoEXT>(create_info.pNext);
+}
+
+bool CoreChecks::DeferSpirvValidation(const VkShaderModuleCreateInfo &create_info, chassis::CreateShaderModule &chassis_state,
+                                      const Location &create_info_loc) {
+    ValidationCache *cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    spv_const_binary_t binary{create_info.pCode, create_info.codeSize / sizeof(uint32_t)};
+    const std::shared_ptr<spirv::Module> &module_state = chassis_state.module_state;
+    // The module of the pipelines is not the SPIR-V of the application when its decoration groups were flattened
+    if (!module_state || !module_state->valid_spirv || chassis_state.stateless_data.has_group_decoration) {
+        return RunSpirvValidation(binary, create_info_loc, cache);
+    }
+
+    uint32_t hash = 0;
+    if (cache) {
+        hash = hash_util::ShaderHash(create_info.pCode, create_info.codeSize);
+        if (cache->Contains(hash)) {
+            return false;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> guard(deferred_spirv_val_lock_);
+        // The same SPIR-V was already handed to vkCreateShaderModule and shares its spirv::Module
+        if (module_state->deferred_validation) {
+            return false;
+        }
+        module_state->deferred_validation = std::make_shared<spirv::DeferredValidation>();
+        module_state->deferred_validation->cache_hash = hash;
+        deferred_spirv_val_pending_++;
+    }
+    std::shared_ptr<const spirv::Module> task_module = module_state;
+    validation_worker_pool->Post([this, task_module]() { RunDeferredSpirvValidation(*task_module); });
+    return false;
+}
+
+// Run by a worker, or by the first pipeline using the module if no worker took the task yet
+void CoreChecks::RunDeferredSpirvValidation(const spirv::Module &module_state) const {
+    spirv::DeferredValidation &deferred = *module_state.deferred_validation;
+    {
+        std::lock_guard<std::mutex> guard(deferred_spirv_val_lock_);
+        if (deferred.started) {
+            return;
+        }
+        deferred.started = true;
+    }
+
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    spv_context ctx = spvContextCreate(spirv_environment);
+    spv_const_binary_t binary{module_state.words_.data(), module_state.words_.size()};
+    spv_diagnostic diag = nullptr;
+    const spv_result_t spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
+    if (spv_valid == SPV_SUCCESS && core_validation_cache) {
+        CastFromHandle<ValidationCache *>(core_validation_cache)->Insert(deferred.cache_hash);
+    }
+    {
+        std::lock_guard<std::mutex> guard(deferred_spirv_val_lock_);
+        deferred.result = spv_valid;
+        if (spv_valid != SPV_SUCCESS) {
+            deferred.diagnostic = diag && diag->error ? diag->error : "(no error text)";
+        }
+        deferred.done = true;
+        deferred_spirv_val_pending_--;
+        // Under the lock, the pool is shared with other devices and this one can be destroyed as soon as the count is 0
+        deferred_spirv_val_done_.notify_all();
+    }
+
+    spvDiagnosticDestroy(diag);
+    spvContextDestroy(ctx);
+}
+
+bool CoreChecks::JoinDeferredSpirvValidation(const spirv::Module &module_state) const {
+    if (!module_state.deferred_validation) {
+        return false;
+    }
+    RunDeferredSpirvValidation(module_state);
+
+    spirv::DeferredValidation &deferred = *module_state.deferred_validation;
+    std::string diagnostic;
+    spv_result_t spv_valid = SPV_SUCCESS;
+    {
+        std::unique_lock<std::mutex> guard(deferred_spirv_val_lock_);
+        deferred_spirv_val_done_.wait(guard, [&deferred]() { return deferred.done; });
+        if (deferred.reported || deferred.result == SPV_SUCCESS) {
+            return false;
+        }
+        deferred.reported = true;
+        spv_valid = deferred.result;
+        diagnostic = deferred.diagnostic;
+    }
+
+    // Reported against the creation of the module, like the synchronous spirv-val
+    const Location create_info_loc(Func::vkCreateShaderModule, Field::pCreateInfo);
+    const char *vuid = "VUID-VkShaderModuleCreateInfo-pCode-08737";
+    if (spv_valid == SPV_WARNING) {
+        return LogWarning(vuid, module_state.handle(), create_info_loc.dot(Field::pCode),
+                          "(spirv-val produced a warning, found when the module was first used):\n%s", diagnostic.c_str());
+    }
+    return LogError(vuid, module_state.handle(), create_info_loc.dot(Field::pCode),
+                    "(spirv-val produced an error, found when the module was first used):\n%s", diagnostic.c_str());
+}
+
+void CoreChecks::WaitForDeferredSpirvValidations() const {
+    std::unique_lock<std::mutex> guard(deferred_spirv_val_lock_);
+    deferred_spirv_val_done_.wait(guard, [this]() { return deferred_spirv_val_pending_ == 0; });
 }
 
 bool CoreChecks::PreCallValidateGetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule,
@@ -2883,6 +3092,7 @@ bool CoreChecks::ValidateSpirvStateless(const spirv::Module &module_state, const
                                         const Location &loc) const {
     bool skip = false;
     if (!module_state.valid_spirv) return skip;
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::SpirvStateless);
 
     skip |= ValidateShaderClock(module_state, stateless_data, loc);
     skip |= ValidateAtomicsTypes(module_state, stateless_data, loc);
@@ -2891,17 +3101,18 @@ bool CoreChecks::ValidateSpirvStateless(const spirv::Module &module_state, const
     if (enabled_features.transformFeedback) {
         skip |= ValidateTransformFeedbackDecorations(module_state, loc);
     }
+    skip |= ValidateShaderCapabilitiesAndExtensions(module_state, loc);
 
     // The following tries to limit the number of passes through the shader module.
     // It save a good amount of memory and complex state tracking to just check these in a 2nd pass
     for (const spirv::Instruction &insn : module_state.GetInstructions()) {
-        skip |= ValidateShaderCapabilitiesAndExtensions(insn, loc);
         skip |= ValidateTexelOffsetLimits(module_state, insn, loc);
         skip |= ValidateMemoryScope(module_state, insn, loc);
         skip |= ValidateSubgroupRotateClustered(module_state, insn, loc);
     }
 
-    for (const auto &entry_point : module_state.static_data_.entry_points) {
+    for (const auto &entry_point_slot : module_state.static_data_.entry_points) {
+        const auto entry_point = module_state.GetEntryPoint(*entry_point_slot);
         skip |= ValidateShaderStageGroupNonUniform(module_state, stateless_data, entry_point->stage, loc);
         skip |= ValidateShaderStageInputOutputLimits(module_state, *entry_point, stateless_data, loc);
         skip |= ValidateShaderFloatControl(module_state, *entry_point, stateless_data, loc);
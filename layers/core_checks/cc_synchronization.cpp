@@ -143,9 +143,13 @@ bool SemaphoreSubmitState::ValidateWaitSemaphore(const Location &wait_semaphore_
         case VK_SEMAPHORE_TYPE_TIMELINE: {
             uint64_t bad_value = 0;
             std::string where;
-            TimelineMaxDiffCheck exceeds_max_diff(value, core.phys_dev_props_core12.maxTimelineSemaphoreValueDifference);
+            const uint64_t max_diff = core.phys_dev_props_core12.maxTimelineSemaphoreValueDifference;
+            TimelineMaxDiffCheck exceeds_max_diff(value, max_diff);
             const VkSemaphore handle = semaphore_state.VkHandle();
-            if (CheckSemaphoreValue(semaphore_state, where, bad_value, exceeds_max_diff)) {
+            auto find_pending = [&semaphore_state, value, max_diff]() {
+                return semaphore_state.LastOpOutsideRange(value, max_diff);
+            };
+            if (CheckSemaphoreValue(semaphore_state, where, bad_value, exceeds_max_diff, find_pending)) {
                 const auto &vuid = GetQueueSubmitVUID(wait_semaphore_loc, SubmitError::kTimelineSemMaxDiff);
                 skip |= core.LogError(vuid, handle, wait_semaphore_loc,
                                       "value (%" PRIu64 ") exceeds limit regarding %s semaphore %s value (%" PRIu64 ").", value,
@@ -209,7 +213,8 @@ bool SemaphoreSubmitState::ValidateSignalSemaphore(const Location &signal_semaph
                 // exact value ordering cannot be determined until execution time
                 return !is_pending && value < payload;
             };
-            if (CheckSemaphoreValue(semaphore_state, where, bad_value, must_be_greater)) {
+            auto find_conflicting = [&semaphore_state, value]() { return semaphore_state.ConflictingSignal(value); };
+            if (CheckSemaphoreValue(semaphore_state, where, bad_value, must_be_greater, find_conflicting)) {
                 const auto &vuid = GetQueueSubmitVUID(signal_semaphore_loc, SubmitError::kTimelineSemSmallValue);
                 skip |= core.LogError(
                     vuid, objlist, signal_semaphore_loc,
@@ -217,8 +222,12 @@ bool SemaphoreSubmitState::ValidateSignalSemaphore(const Location &signal_semaph
                     core.FormatHandle(queue).c_str(), where.c_str(), core.FormatHandle(handle).c_str(), bad_value);
                 break;
             }
-            TimelineMaxDiffCheck exceeds_max_diff(value, core.phys_dev_props_core12.maxTimelineSemaphoreValueDifference);
-            if (CheckSemaphoreValue(semaphore_state, where, bad_value, exceeds_max_diff)) {
+            const uint64_t max_diff = core.phys_dev_props_core12.maxTimelineSemaphoreValueDifference;
+            TimelineMaxDiffCheck exceeds_max_diff(value, max_diff);
+            auto find_pending = [&semaphore_state, value, max_diff]() {
+                return semaphore_state.LastOpOutsideRange(value, max_diff);
+            };
+            if (CheckSemaphoreValue(semaphore_state, where, bad_value, exceeds_max_diff, find_pending)) {
                 const auto &vuid = GetQueueSubmitVUID(signal_semaphore_loc, SubmitError::kTimelineSemMaxDiff);
                 skip |= core.LogError(vuid, objlist, signal_semaphore_loc,
                                       "value (%" PRIu64 ") exceeds limit regarding %s semaphore %s value (%" PRIu64 ").", value,
@@ -446,9 +455,7 @@ bool CoreChecks::PreCallValidateCreateFence(VkDevice device, const VkFenceCreate
         bool export_supported = true;
         // Check export support
         auto check_export_support = [&](VkExternalFenceHandleTypeFlagBits flag) {
-            VkPhysicalDeviceExternalFenceInfo external_info = vku::InitStructHelper();
-            external_info.handleType = flag;
-            DispatchGetPhysicalDeviceExternalFenceProperties(physical_device, &external_info, &external_properties);
+            external_properties = GetExternalFenceProperties(flag);
             if ((external_properties.externalFenceFeatures & VK_EXTERNAL_FENCE_FEATURE_EXPORTABLE_BIT) == 0) {
                 export_supported = false;
                 skip |= LogError("VUID-VkExportFenceCreateInfo-handleTypes-01446", device,
@@ -498,9 +505,7 @@ bool CoreChecks::PreCallValidateCreateSemaphore(VkDevice device, const VkSemapho
         bool export_supported = true;
         // Check export support
         auto check_export_support = [&](VkExternalSemaphoreHandleTypeFlagBits flag) {
-            VkPhysicalDeviceExternalSemaphoreInfo external_info = vku::InitStructHelper();
-            external_info.handleType = flag;
-            DispatchGetPhysicalDeviceExternalSemaphoreProperties(physical_device, &external_info, &external_properties);
+            external_properties = GetExternalSemaphoreProperties(flag);
             if ((external_properties.externalSemaphoreFeatures & VK_EXTERNAL_SEMAPHORE_FEATURE_EXPORTABLE_BIT) == 0) {
                 export_supported = false;
                 skip |= LogError("VUID-VkExportSemaphoreCreateInfo-handleTypes-01124", device,
@@ -676,55 +681,40 @@ struct RenderPassDepState {
     uint32_t active_subpass;
     const VkRenderPass rp_handle;
     const VkPipelineStageFlags2KHR disabled_features;
-    const std::vector<uint32_t> &self_dependencies;
-    const vku::safe_VkSubpassDependency2 *dependencies;
+    const vvl::RenderPass::SelfDependencySummary &self_dependencies;
 
     RenderPassDepState(const CoreChecks &c, const std::string &v, uint32_t subpass, const VkRenderPass handle,
                        const DeviceFeatures &features, const DeviceExtensions &device_extensions,
-                       const std::vector<uint32_t> &self_deps, const vku::safe_VkSubpassDependency2 *deps)
+                       const vvl::RenderPass::SelfDependencySummary &self_deps)
         : core(c),
           vuid(v),
           active_subpass(subpass),
           rp_handle(handle),
           disabled_features(sync_utils::DisabledPipelineStages(features, device_extensions)),
-          self_dependencies(self_deps),
-          dependencies(deps) {}
-
-    VkMemoryBarrier2 GetSubPassDepBarrier(const vku::safe_VkSubpassDependency2 &dep) const {
-        // "If a VkMemoryBarrier2 is included in the pNext chain, srcStageMask, dstStageMask,
-        // srcAccessMask, and dstAccessMask parameters are ignored. The synchronization and
-        // access scopes instead are defined by the parameters of VkMemoryBarrier2."
-        if (const auto override_barrier = vku::FindStructInPNextChain<VkMemoryBarrier2>(dep.pNext)) {
-            return *override_barrier;
-        }
-
-        VkMemoryBarrier2 barrier = vku::InitStructHelper();
-        barrier.srcStageMask = dep.srcStageMask;
-        barrier.dstStageMask = dep.dstStageMask;
-        barrier.srcAccessMask = dep.srcAccessMask;
-        barrier.dstAccessMask = dep.dstAccessMask;
-        return barrier;
-    }
+          self_dependencies(self_deps) {}
 
     bool ValidateStage(const Location &barrier_loc, VkPipelineStageFlags2 src_stage_mask,
                        VkPipelineStageFlags2 dst_stage_mask) const {
-        // Look for srcStageMask + dstStageMask superset in any self-dependency
-        for (const auto self_dep_index : self_dependencies) {
-            const auto subpass_dep = GetSubPassDepBarrier(dependencies[self_dep_index]);
-
+        const auto barrier_src_stages =
+            sync_utils::ExpandPipelineStages(src_stage_mask, sync_utils::kAllQueueTypes, disabled_features);
+        const auto barrier_dst_stages =
+            sync_utils::ExpandPipelineStages(dst_stage_mask, sync_utils::kAllQueueTypes, disabled_features);
+        auto is_subset = [this, barrier_src_stages, barrier_dst_stages](VkPipelineStageFlags2 subpass_src_stage_mask,
+                                                                         VkPipelineStageFlags2 subpass_dst_stage_mask) {
             const auto subpass_src_stages =
-                sync_utils::ExpandPipelineStages(subpass_dep.srcStageMask, sync_utils::kAllQueueTypes, disabled_features);
-            const auto barrier_src_stages =
-                sync_utils::ExpandPipelineStages(src_stage_mask, sync_utils::kAllQueueTypes, disabled_features);
-
+                sync_utils::ExpandPipelineStages(subpass_src_stage_mask, sync_utils::kAllQueueTypes, disabled_features);
             const auto subpass_dst_stages =
-                sync_utils::ExpandPipelineStages(subpass_dep.dstStageMask, sync_utils::kAllQueueTypes, disabled_features);
-            const auto barrier_dst_stages =
-                sync_utils::ExpandPipelineStages(dst_stage_mask, sync_utils::kAllQueueTypes, disabled_features);
-
-            const bool is_subset = (barrier_src_stages == (subpass_src_stages & barrier_src_stages)) &&
-                                   (barrier_dst_stages == (subpass_dst_stages & barrier_dst_stages));
-            if (is_subset) return false;  // subset is found, return skip value (false)
+                sync_utils::ExpandPipelineStages(subpass_dst_stage_mask, sync_utils::kAllQueueTypes, disabled_features);
+            return (barrier_src_stages == (subpass_src_stages & barrier_src_stages)) &&
+                   (barrier_dst_stages == (subpass_dst_stages & barrier_dst_stages));
+        };
+        // Look for srcStageMask + dstStageMask superset in any self-dependency, none can be if their union isn't
+        if (is_subset(self_dependencies.src_stage_mask, self_dependencies.dst_stage_mask)) {
+            for (const auto &subpass_dep : self_dependencies.dependencies) {
+                if (is_subset(subpass_dep.src_stage_mask, subpass_dep.dst_stage_mask)) {
+                    return false;  // subset is found, return skip value (false)
+                }
+            }
         }
         return core.LogError(vuid, rp_handle, barrier_loc.dot(Field::srcStageMask),
                              "(%s) and dstStageMask (%s) is not a subset of subpass dependency's srcStageMask and dstStageMask for "
@@ -735,12 +725,18 @@ struct RenderPassDepState {
     }
 
     bool ValidateAccess(const Location &barrier_loc, VkAccessFlags2 src_access_mask, VkAccessFlags2 dst_access_mask) const {
-        // Look for srcAccessMask + dstAccessMask superset in any self-dependency
-        for (const auto self_dep_index : self_dependencies) {
-            const auto subpass_dep = GetSubPassDepBarrier(dependencies[self_dep_index]);
-            const bool is_subset = (src_access_mask == (subpass_dep.srcAccessMask & src_access_mask)) &&
-                                   (dst_access_mask == (subpass_dep.dstAccessMask & dst_access_mask));
-            if (is_subset) return false;  // subset is found, return skip value (false)
+        auto is_subset = [src_access_mask, dst_access_mask](VkAccessFlags2 subpass_src_access_mask,
+                                                            VkAccessFlags2 subpass_dst_access_mask) {
+            return (src_access_mask == (subpass_src_access_mask & src_access_mask)) &&
+                   (dst_access_mask == (subpass_dst_access_mask & dst_access_mask));
+        };
+        // Look for srcAccessMask + dstAccessMask superset in any self-dependency, none can be if their union isn't
+        if (is_subset(self_dependencies.src_access_mask, self_dependencies.dst_access_mask)) {
+            for (const auto &subpass_dep : self_dependencies.dependencies) {
+                if (is_subset(subpass_dep.src_access_mask, subpass_dep.dst_access_mask)) {
+                    return false;  // subset is found, return skip value (false)
+                }
+            }
         }
         return core.LogError(vuid, rp_handle, barrier_loc.dot(Field::srcAccessMask),
                              "(%s) and dstAccessMask (%s) is not a subset of subpass dependency's srcAccessMask and dstAccessMask "
@@ -750,9 +746,8 @@ struct RenderPassDepState {
     }
 
     bool ValidateDependencyFlag(const Location &dep_flags_loc, VkDependencyFlags dependency_flags) const {
-        for (const auto self_dep_index : self_dependencies) {
-            const auto &subpass_dep = dependencies[self_dep_index];
-            const bool match = subpass_dep.dependencyFlags == dependency_flags;
+        for (const auto &subpass_dep : self_dependencies.dependencies) {
+            const bool match = subpass_dep.dependency_flags == dependency_flags;
             if (match) return false;  // match is found, return skip value (false)
         }
         return core.LogError(vuid, rp_handle, dep_flags_loc,
@@ -798,9 +793,9 @@ bool CoreChecks::ValidateRenderPassPipelineBarriers(const Location &outer_loc, c
     bool skip = false;
     const auto &rp_state = cb_state.activeRenderPass;
     RenderPassDepState state(*this, "VUID-vkCmdPipelineBarrier-None-07889", cb_state.GetActiveSubpass(), rp_state->VkHandle(),
-                             enabled_features, device_extensions, rp_state->self_dependencies[cb_state.GetActiveSubpass()],
-                             rp_state->create_info.pDependencies);
-    if (state.self_dependencies.empty()) {
+                             enabled_features, device_extensions,
+                             rp_state->self_dependency_summaries[cb_state.GetActiveSubpass()]);
+    if (state.self_dependencies.dependencies.empty()) {
         skip |= LogError("VUID-vkCmdPipelineBarrier-None-07889", state.rp_handle, outer_loc,
                          "Barriers cannot be set during subpass %" PRIu32 " of %s with no self-dependency specified.",
                          state.active_subpass, FormatHandle(state.rp_handle).c_str());
@@ -858,10 +853,10 @@ bool CoreChecks::ValidateRenderPassPipelineBarriers(const Location &outer_loc, c
         return skip;
     }
     RenderPassDepState state(*this, "VUID-vkCmdPipelineBarrier2-None-07889", cb_state.GetActiveSubpass(), rp_state->VkHandle(),
-                             enabled_features, device_extensions, rp_state->self_dependencies[cb_state.GetActiveSubpass()],
-                             rp_state->create_info.pDependencies);
+                             enabled_features, device_extensions,
+                             rp_state->self_dependency_summaries[cb_state.GetActiveSubpass()]);
 
-    if (state.self_dependencies.empty()) {
+    if (state.self_dependencies.dependencies.empty()) {
         skip |= LogError(state.vuid, state.rp_handle, outer_loc,
                          "Barriers cannot be set during subpass %" PRIu32 " of %s with no self-dependency specified.",
                          state.active_subpass, FormatHandle(rp_state->Handle()).c_str());
@@ -1370,10 +1365,7 @@ bool CoreChecks::PreCallValidateSignalSemaphore(VkDevice device, const VkSemapho
                          FormatHandle(pSignalInfo->semaphore).c_str(), current_payload);
         return skip;
     }
-    auto exceeds_pending = [pSignalInfo](const vvl::Semaphore::OpType op_type, uint64_t payload, bool is_pending) {
-        return is_pending && op_type == vvl::Semaphore::OpType::kSignal && pSignalInfo->value >= payload;
-    };
-    auto last_op = semaphore_state->LastOp(exceeds_pending);
+    auto last_op = semaphore_state->LastPendingSignalAtOrBelow(pSignalInfo->value);
     if (last_op) {
         skip |= LogError("VUID-VkSemaphoreSignalInfo-value-03259", pSignalInfo->semaphore, signal_loc.dot(Field::value),
                          "(%" PRIu64 ") must be less than value of any pending signal operation (%" PRIu64 ") for semaphore %s.",
@@ -1383,8 +1375,7 @@ bool CoreChecks::PreCallValidateSignalSemaphore(VkDevice device, const VkSemapho
 
     uint64_t bad_value = 0;
     const char *where = nullptr;
-    TimelineMaxDiffCheck exceeds_max_diff(pSignalInfo->value, phys_dev_props_core12.maxTimelineSemaphoreValueDifference);
-    last_op = semaphore_state->LastOp(exceeds_max_diff);
+    last_op = semaphore_state->LastOpOutsideRange(pSignalInfo->value, phys_dev_props_core12.maxTimelineSemaphoreValueDifference);
     if (last_op) {
         bad_value = last_op->payload;
         if (last_op->payload == semaphore_state->CurrentPayload()) {
@@ -1567,7 +1558,7 @@ std::vector<uint32_t> GetUsedAttachments(const vvl::CommandBuffer &cb_state) {
 
 // Verify image barriers are compatible with the images they reference.
 bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl::CommandBuffer &cb_state,
-                                          const ImageBarrier &img_barrier,
+                                          const vvl::Image &image_state, const ImageBarrier &img_barrier,
                                           vvl::CommandBuffer::ImageLayoutMap &layout_updates_state) const {
     bool skip = false;
     using sync_vuid_maps::GetImageBarrierVUID;
@@ -1576,14 +1567,11 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
     const auto &current_map = cb_state.GetImageSubresourceLayoutMap();
 
     {
-        auto image_state = Get<vvl::Image>(img_barrier.image);
-        ASSERT_AND_RETURN_SKIP(image_state);
-
         auto image_loc = barrier_loc.dot(Field::image);
 
         if ((img_barrier.srcQueueFamilyIndex != img_barrier.dstQueueFamilyIndex) ||
             (img_barrier.oldLayout != img_barrier.newLayout)) {
-            VkImageUsageFlags usage_flags = image_state->create_info.usage;
+            VkImageUsageFlags usage_flags = image_state.create_info.usage;
             skip |= ValidateBarrierLayoutToImageUsage(barrier_loc.dot(Field::oldLayout), img_barrier.image, img_barrier.oldLayout,
                                                       usage_flags);
             skip |= ValidateBarrierLayoutToImageUsage(barrier_loc.dot(Field::newLayout), img_barrier.image, img_barrier.newLayout,
@@ -1591,7 +1579,7 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
         }
 
         // Make sure layout is able to be transitioned, currently only presented shared presentable images are locked
-        if (image_state->layout_locked) {
+        if (image_state.layout_locked) {
             // TODO: waiting for VUID https://gitlab.khronos.org/vulkan/vulkan/-/merge_requests/5078
             skip |= LogError("UNASSIGNED-barrier-shared-presentable", img_barrier.image, image_loc,
                              "(%s) is a shared presentable and attempting to transition from layout %s to layout %s, but image has "
@@ -1600,7 +1588,7 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
                              string_VkImageLayout(img_barrier.newLayout));
         }
 
-        const VkImageCreateInfo &image_create_info = image_state->create_info;
+        const VkImageCreateInfo &image_create_info = image_state.create_info;
         const VkFormat image_format = image_create_info.format;
         const VkImageAspectFlags aspect_mask = img_barrier.subresourceRange.aspectMask;
         const bool has_depth_mask = (aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0;
@@ -1663,7 +1651,8 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
         if (img_barrier.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
             // TODO: Set memory invalid which is in mem_tracker currently
         } else if (!IsQueueFamilyExternal(img_barrier.srcQueueFamilyIndex)) {
-            skip |= UpdateCommandBufferImageLayoutMap(cb_state, image_loc, img_barrier, current_map, layout_updates_state);
+            skip |= UpdateCommandBufferImageLayoutMap(cb_state, image_state, image_loc, img_barrier, current_map,
+                                                      layout_updates_state);
         }
 
         if (enabled_features.dynamicRenderingLocalRead && cb_state.activeRenderPass) {
@@ -1708,7 +1697,7 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
                 skip |= LogError(vuid, img_barrier.image, image_loc, "(%s) has color format %s, but its aspectMask is %s.",
                                  FormatHandle(img_barrier.image).c_str(), string_VkFormat(image_format),
                                  string_VkImageAspectFlags(aspect_mask).c_str());
-            } else if (!image_state->disjoint) {
+            } else if (!image_state.disjoint) {
                 const auto &vuid = GetImageBarrierVUID(barrier_loc, ImageError::kNotColorAspectNonDisjoint);
                 skip |= LogError(vuid, img_barrier.image, image_loc, "(%s) has color format %s, but its aspectMask is %s.",
                                  FormatHandle(img_barrier.image).c_str(), string_VkFormat(image_format),
@@ -1716,7 +1705,7 @@ bool CoreChecks::ValidateBarriersToImages(const Location &barrier_loc, const vvl
             }
         }
 
-        if ((vkuFormatIsMultiplane(image_format)) && (image_state->disjoint == true)) {
+        if ((vkuFormatIsMultiplane(image_format)) && (image_state.disjoint == true)) {
             if (!IsValidPlaneAspect(image_format, aspect_mask) && ((aspect_mask & VK_IMAGE_ASPECT_COLOR_BIT) == 0)) {
                 const auto &vuid = GetImageBarrierVUID(barrier_loc, ImageError::kBadMultiplanarAspect);
                 skip |= LogError(vuid, img_barrier.image, image_loc, "(%s) has Multiplane format %s, but its aspectMask is %s.",
@@ -1947,32 +1936,26 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const vvl::CommandBuffer &cb_
     const auto &cb_barriers = cb_state.GetQFOBarrierSets(TransferBarrier());
     const char *barrier_name = TransferBarrier::BarrierName();
     const char *handle_name = TransferBarrier::HandleName();
+    // Check the global pending release barriers
+    QFOTransferBarrierSetBatch<TransferBarrier> pending_releases(global_release_barriers);
     // No release should have an extant duplicate (WARNING)
     for (const auto &release : cb_barriers.release) {
-        // Check the global pending release barriers
-        const auto set_it = global_release_barriers.find(release.handle);
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            const auto found = set_for_handle.find(release);
-            if (found != set_for_handle.cend()) {
-                skip |= LogWarning(TransferBarrier::DuplicateQFOSubmitted(), cb_state.Handle(), loc,
-                                   "%s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
-                                   " to dstQueueFamilyIndex %" PRIu32
-                                   " duplicates existing barrier queued for execution, without intervening acquire operation.",
-                                   barrier_name, handle_name, FormatHandle(found->handle).c_str(), found->srcQueueFamilyIndex,
-                                   found->dstQueueFamilyIndex);
-            }
+        const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = pending_releases.Get(release.handle);
+        const auto found = set_for_handle.find(release);
+        if (found != set_for_handle.cend()) {
+            skip |= LogWarning(TransferBarrier::DuplicateQFOSubmitted(), cb_state.Handle(), loc,
+                               "%s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
+                               " to dstQueueFamilyIndex %" PRIu32
+                               " duplicates existing barrier queued for execution, without intervening acquire operation.",
+                               barrier_name, handle_name, FormatHandle(found->handle).c_str(), found->srcQueueFamilyIndex,
+                               found->dstQueueFamilyIndex);
         }
         skip |= ValidateAndUpdateQFOScoreboard(cb_state, "releasing", release, &scoreboards->release, loc);
     }
     // Each acquire must have a matching release (ERROR)
     for (const auto &acquire : cb_barriers.acquire) {
-        const auto set_it = global_release_barriers.find(acquire.handle);
-        bool matching_release_found = false;
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            matching_release_found = set_for_handle.find(acquire) != set_for_handle.cend();
-        }
+        const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = pending_releases.Get(acquire.handle);
+        const bool matching_release_found = set_for_handle.find(acquire) != set_for_handle.cend();
         if (!matching_release_found) {
             skip |= LogError(TransferBarrier::MissingQFOReleaseInSubmit(), cb_state.Handle(), loc,
                              "in submitted command buffer %s acquiring ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
@@ -2000,32 +1983,21 @@ bool CoreChecks::ValidateQueuedQFOTransfers(const vvl::CommandBuffer &cb_state,
 template <typename TransferBarrier>
 void RecordQueuedQFOTransferBarriers(QFOTransferBarrierSets<TransferBarrier> &cb_barriers,
                                      GlobalQFOTransferBarrierMap<TransferBarrier> &global_release_barriers) {
+    // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
+    QFOTransferBarrierSetBatch<TransferBarrier> pending_releases(global_release_barriers);
+
     // Add release barriers from this submit to the global map
     for (const auto &release : cb_barriers.release) {
-        // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
-        // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
-        // copy back after updating.
-        auto iter = global_release_barriers.find(release.handle);
-        iter->second.insert(release);
-        global_release_barriers.insert_or_assign(release.handle, iter->second);
+        pending_releases.Get(release.handle).insert(release);
     }
 
     // Erase acquired barriers from this submit from the global map -- essentially marking releases as consumed
     for (const auto &acquire : cb_barriers.acquire) {
-        // NOTE: We're not using [] because we don't want to create entries for missing releases
-        auto set_it = global_release_barriers.find(acquire.handle);
-        if (set_it != global_release_barriers.end()) {
-            QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            set_for_handle.erase(acquire);
-            if (set_for_handle.empty()) {  // Clean up empty sets
-                global_release_barriers.erase(acquire.handle);
-            } else {
-                // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
-                // copy back after updating.
-                global_release_barriers.insert_or_assign(acquire.handle, set_for_handle);
-            }
-        }
+        pending_releases.Get(acquire.handle).erase(acquire);
     }
+
+    // Empty sets are cleaned up, which also doesn't create entries for missing releases
+    pending_releases.WriteBack(global_release_barriers);
 }
 
 void CoreChecks::RecordQueuedQFOTransfers(vvl::CommandBuffer &cb_state) {
@@ -2320,7 +2292,7 @@ bool CoreChecks::ValidateBufferBarrier(const LogObjectList &objects, const Locat
 }
 
 bool CoreChecks::ValidateImageBarrier(const LogObjectList &objects, const Location &barrier_loc, const vvl::CommandBuffer &cb_state,
-                                      const ImageBarrier &mem_barrier) const {
+                                      const ImageBarrier &mem_barrier, const vvl::Image *image_data) const {
     bool skip = false;
 
     skip |= ValidateQFOTransferBarrierUniqueness(barrier_loc, cb_state, mem_barrier, cb_state.qfo_transfer_image_barriers);
@@ -2360,7 +2332,7 @@ bool CoreChecks::ValidateImageBarrier(const LogObjectList &objects, const Locati
         }
     }
 
-    if (auto image_data = Get<vvl::Image>(mem_barrier.image)) {
+    if (image_data) {
         auto image_loc = barrier_loc.dot(Field::image);
         // TODO - use LocationVuidAdapter
         const auto &vuid_no_memory = sync_vuid_maps::GetImageBarrierVUID(barrier_loc, sync_vuid_maps::ImageError::kNoMemory);
@@ -2391,6 +2363,8 @@ bool CoreChecks::ValidateBarriers(const Location &outer_loc, const vvl::CommandB
     // Tracks duplicate layout transition for image barriers.
     // Keeps state between ValidateBarriersToImages calls.
     vvl::CommandBuffer::ImageLayoutMap layout_updates_state;
+    // Consecutive barriers are often for the mip levels or layers of one image, which is then only looked up once
+    std::shared_ptr<const vvl::Image> image_state;
 
     for (uint32_t i = 0; i < memBarrierCount; ++i) {
         const Location barrier_loc = outer_loc.dot(Struct::VkMemoryBarrier, Field::pMemoryBarriers, i);
@@ -2401,9 +2375,13 @@ bool CoreChecks::ValidateBarriers(const Location &outer_loc, const vvl::CommandB
         const Location barrier_loc = outer_loc.dot(Struct::VkImageMemoryBarrier, Field::pImageMemoryBarriers, i);
         const ImageBarrier barrier(pImageMemBarriers[i], src_stage_mask, dst_stage_mask);
         const OwnershipTransferOp transfer_op = barrier.TransferOp(cb_state.command_pool->queueFamilyIndex);
+        if (!image_state || image_state->VkHandle() != barrier.image) {
+            image_state = Get<vvl::Image>(barrier.image);
+        }
         skip |= ValidateMemoryBarrier(objects, barrier_loc, cb_state, barrier, transfer_op);
-        skip |= ValidateImageBarrier(objects, barrier_loc, cb_state, barrier);
-        skip |= ValidateBarriersToImages(barrier_loc, cb_state, barrier, layout_updates_state);
+        skip |= ValidateImageBarrier(objects, barrier_loc, cb_state, barrier, image_state.get());
+        ASSERT_AND_CONTINUE(image_state);
+        skip |= ValidateBarriersToImages(barrier_loc, cb_state, *image_state, barrier, layout_updates_state);
     }
     for (uint32_t i = 0; i < bufferBarrierCount; ++i) {
         const Location barrier_loc = outer_loc.dot(Struct::VkBufferMemoryBarrier, Field::pBufferMemoryBarriers, i);
@@ -2422,6 +2400,8 @@ bool CoreChecks::ValidateDependencyInfo(const LogObjectList &objects, const Loca
     // Tracks duplicate layout transition for image barriers.
     // Keeps state between ValidateBarriersToImages calls.
     vvl::CommandBuffer::ImageLayoutMap layout_updates_state;
+    // Consecutive barriers are often for the mip levels or layers of one image, which is then only looked up once
+    std::shared_ptr<const vvl::Image> image_state;
 
     for (uint32_t i = 0; i < dep_info.memoryBarrierCount; ++i) {
         const Location barrier_loc = dep_info_loc.dot(Struct::VkMemoryBarrier2, Field::pMemoryBarriers, i);
@@ -2432,9 +2412,13 @@ bool CoreChecks::ValidateDependencyInfo(const LogObjectList &objects, const Loca
         const Location barrier_loc = dep_info_loc.dot(Struct::VkImageMemoryBarrier2, Field::pImageMemoryBarriers, i);
         const ImageBarrier barrier(dep_info.pImageMemoryBarriers[i]);
         const OwnershipTransferOp transfer_op = barrier.TransferOp(cb_state.command_pool->queueFamilyIndex);
+        if (!image_state || image_state->VkHandle() != barrier.image) {
+            image_state = Get<vvl::Image>(barrier.image);
+        }
         skip |= ValidateMemoryBarrier(objects, barrier_loc, cb_state, barrier, transfer_op);
-        skip |= ValidateImageBarrier(objects, barrier_loc, cb_state, barrier);
-        skip |= ValidateBarriersToImages(barrier_loc, cb_state, barrier, layout_updates_state);
+        skip |= ValidateImageBarrier(objects, barrier_loc, cb_state, barrier, image_state.get());
+        ASSERT_AND_CONTINUE(image_state);
+        skip |= ValidateBarriersToImages(barrier_loc, cb_state, *image_state, barrier, layout_updates_state);
     }
     for (uint32_t i = 0; i < dep_info.bufferMemoryBarrierCount; ++i) {
         const Location barrier_loc = dep_info_loc.dot(Struct::VkBufferMemoryBarrier2, Field::pBufferMemoryBarriers, i);
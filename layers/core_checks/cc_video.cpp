@@ -85,7 +85,7 @@ bool CoreChecks::IsBufferCompatibleWithVideoProfile(const vvl::Buffer &buffer_st
 bool CoreChecks::IsImageCompatibleWithVideoProfile(const vvl::Image &image_state,
                                                    const std::shared_ptr<const vvl::VideoProfileDesc> &video_profile) const {
     return (image_state.create_info.flags & VK_IMAGE_CREATE_VIDEO_PROFILE_INDEPENDENT_BIT_KHR) ||
-           image_state.supported_video_profiles.find(video_profile) != image_state.supported_video_profiles.end();
+           image_state.GetSupportedVideoProfiles().find(video_profile) != image_state.GetSupportedVideoProfiles().end();
 }
 
 void CoreChecks::EnqueueVerifyVideoSessionInitialized(vvl::CommandBuffer &cb_state, vvl::VideoSession &vs_state,
@@ -863,11 +863,14 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
         }
 
         // All physical devices and queue families are required to be able to present to any native window on Android
-        if (!IsExtEnabled(instance_extensions.vk_khr_android_surface)) {
+        if (!IsExtEnabled(instance_extensions.vk_khr_android_surface) &&
+            swapchain_data->present_queue_family_index.load(std::memory_order_relaxed) != queue_state->queue_family_index) {
             auto surface_state = Get<vvl::Surface>(swapchain_data->create_info.surface);
             if (surface_state && !surface_state->GetQueueSupport(physical_device, queue_state->queue_family_index)) {
                 skip |= LogError("VUID-vkQueuePresentKHR-pSwapchains-01292", pPresentInfo->pSwapchains[i], swapchain_loc,
                                  "image on queue that cannot present to this surface.");
+            } else if (surface_state) {
+                swapchain_data->present_queue_family_index.store(queue_state->queue_family_index, std::memory_order_relaxed);
             }
         }
     }
@@ -1116,30 +1119,35 @@ bool CoreChecks::ValidateAcquireNextImage(VkDevice device, VkSwapchainKHR swapch
         const uint32_t acquired_images = swapchain_data->acquired_images;
         const uint32_t swapchain_image_count = static_cast<uint32_t>(swapchain_data->images.size());
 
-        VkSurfaceCapabilitiesKHR surface_caps{};
-        if (swapchain_data->surface) {
-            surface_caps = swapchain_data->surface->GetSurfaceCapabilities(physical_device, nullptr);
-        } else if (IsExtEnabled(instance_extensions.vk_google_surfaceless_query)) {
-            surface_caps = physical_device_state->surfaceless_query_state.capabilities.surfaceCapabilities;
-        }
-        auto min_image_count = surface_caps.minImageCount;
-        const VkSwapchainPresentModesCreateInfoEXT *present_modes_ci =
-            vku::FindStructInPNextChain<VkSwapchainPresentModesCreateInfoEXT>(swapchain_data->create_info.pNext);
-        if (present_modes_ci) {
-            auto surface_state = Get<vvl::Surface>(swapchain_data->create_info.surface);
-            ASSERT_AND_RETURN_SKIP(surface_state);
-            // If a SwapchainPresentModesCreateInfo struct was included, min_image_count becomes the max of the
-            // minImageCount values returned via VkSurfaceCapabilitiesKHR for each of the present modes in
-            // SwapchainPresentModesCreateInfo
-            VkSurfaceCapabilitiesKHR surface_capabilities{};
-            min_image_count = 0;
-            for (uint32_t i = 0; i < present_modes_ci->presentModeCount; i++) {
-                surface_capabilities =
-                    surface_state->GetPresentModeSurfaceCapabilities(physical_device, present_modes_ci->pPresentModes[i]);
-                if (surface_capabilities.minImageCount > min_image_count) {
-                    min_image_count = surface_capabilities.minImageCount;
+        // The surface capabilities may not be cached by the surface, only query them for the first acquire
+        uint32_t min_image_count = swapchain_data->min_image_count.load(std::memory_order_relaxed);
+        if (min_image_count == vvl::Swapchain::kUnknownMinImageCount) {
+            VkSurfaceCapabilitiesKHR surface_caps{};
+            if (swapchain_data->surface) {
+                surface_caps = swapchain_data->surface->GetSurfaceCapabilities(physical_device, nullptr);
+            } else if (IsExtEnabled(instance_extensions.vk_google_surfaceless_query)) {
+                surface_caps = physical_device_state->surfaceless_query_state.capabilities.surfaceCapabilities;
+            }
+            min_image_count = surface_caps.minImageCount;
+            const VkSwapchainPresentModesCreateInfoEXT *present_modes_ci =
+                vku::FindStructInPNextChain<VkSwapchainPresentModesCreateInfoEXT>(swapchain_data->create_info.pNext);
+            if (present_modes_ci) {
+                auto surface_state = Get<vvl::Surface>(swapchain_data->create_info.surface);
+                ASSERT_AND_RETURN_SKIP(surface_state);
+                // If a SwapchainPresentModesCreateInfo struct was included, min_image_count becomes the max of the
+                // minImageCount values returned via VkSurfaceCapabilitiesKHR for each of the present modes in
+                // SwapchainPresentModesCreateInfo
+                VkSurfaceCapabilitiesKHR surface_capabilities{};
+                min_image_count = 0;
+                for (uint32_t i = 0; i < present_modes_ci->presentModeCount; i++) {
+                    surface_capabilities =
+                        surface_state->GetPresentModeSurfaceCapabilities(physical_device, present_modes_ci->pPresentModes[i]);
+                    if (surface_capabilities.minImageCount > min_image_count) {
+                        min_image_count = surface_capabilities.minImageCount;
+                    }
                 }
             }
+            swapchain_data->min_image_count.store(min_image_count, std::memory_order_relaxed);
         }
         const bool too_many_already_acquired = acquired_images > swapchain_image_count - min_image_count;
         if (timeout == vvl::kU64Max && too_many_already_acquired) {
@@ -20,6 +20,10 @@
 
 #pragma once
 
+#include <array>
+#include <bitset>
+#include <condition_variable>
+
 #include "state_tracker/image_layout_map.h"
 #include "state_tracker/cmd_buffer_state.h"
 #include "error_message/error_location.h"
@@ -35,6 +39,8 @@ struct DrawDispatchVuid;
 
 namespace spirv {
 struct StatelessData;
+struct EntryPoint;
+struct Module;
 }  // namespace spirv
 
 struct SubpassLayout;
@@ -64,6 +70,172 @@ class CoreChecks : public ValidationStateTracker {
     spvtools::ValidatorOptions spirv_val_options;
     uint32_t spirv_val_option_hash;
 
+    // Background spirv-val of the shader modules (async_spirv_validation). The pending tasks use spirv_val_options and
+    // core_validation_cache, so the device waits for them before it is destroyed.
+    mutable std::mutex deferred_spirv_val_lock_;
+    mutable std::condition_variable deferred_spirv_val_done_;
+    mutable uint32_t deferred_spirv_val_pending_ = 0;
+
+    // Every dynamic state a draw with shader objects can require with the enabled features and extensions, also set once.
+    // When the command buffer has set all of them, none of the ValidateGraphicsDynamicStateSetStatus checks can fail.
+    CBDynamicFlags shader_object_dynamic_states;
+
+    // Capabilities and SPIR-V extensions whose requirements the device meets, also set once. Indexed by the dense index
+    // generated in spirv_validation_helper.cpp, so a module is checked by comparing the bits of its declarations with them.
+    static constexpr uint32_t kMaxSpirvCapabilities = 256;
+    static constexpr uint32_t kMaxSpirvExtensions = 128;
+    using SpirvCapabilityBits = std::bitset<kMaxSpirvCapabilities>;
+    using SpirvExtensionBits = std::bitset<kMaxSpirvExtensions>;
+    SpirvCapabilityBits supported_spirv_capabilities;
+    SpirvExtensionBits supported_spirv_extensions;
+
+    // Stage pairs whose interfaces matched without any message. Pipelines built from the same SPIR-V share its spirv::Module,
+    // so a stage pair reused by many pipelines is only compared once. As in the validation cache, only good results are stored.
+    struct StageInterfaceKey {
+        const spirv::EntryPoint* producer;
+        const spirv::EntryPoint* consumer;
+        bool operator==(const StageInterfaceKey& rhs) const { return producer == rhs.producer && consumer == rhs.consumer; }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << producer << consumer;
+            return hc.Value();
+        }
+    };
+    // The entry points are only the same if their modules are still alive
+    struct StageInterfaceModules {
+        std::weak_ptr<const spirv::Module> producer;
+        std::weak_ptr<const spirv::Module> consumer;
+    };
+    mutable vvl::unordered_map<StageInterfaceKey, StageInterfaceModules, hash_util::HasHashMember<StageInterfaceKey>>
+        good_stage_interfaces_;
+    mutable size_t good_stage_interfaces_prune_size_ = 1024;
+    mutable std::shared_mutex good_stage_interfaces_lock_;
+
+    // Entry points whose specialization was accepted by spirv-opt and spirv-val, with what was read from the specialized SPIR-V.
+    // Pipeline permutations reuse a module with the same specialization constant values, and specializing it is the most
+    // expensive step of creating a pipeline. Only good results are stored, like for the stage interfaces.
+    struct SpecializationKey {
+        const spirv::EntryPoint* entrypoint;
+        // <constant id, value>, sorted by id
+        std::vector<std::pair<uint32_t, std::vector<uint32_t>>> values;
+        bool operator==(const SpecializationKey& rhs) const { return entrypoint == rhs.entrypoint && values == rhs.values; }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << entrypoint;
+            for (const auto& [id, value] : values) {
+                hc << id;
+                hc.Combine(value);
+            }
+            return hc.Value();
+        }
+    };
+    struct SpecializationResult {
+        std::weak_ptr<const spirv::Module> module;
+        uint32_t local_size_x;
+        uint32_t local_size_y;
+        uint32_t local_size_z;
+        uint32_t total_workgroup_shared_memory;
+    };
+    mutable vvl::unordered_map<SpecializationKey, SpecializationResult, hash_util::HasHashMember<SpecializationKey>>
+        good_specializations_;
+    mutable size_t good_specializations_prune_size_ = 1024;
+    mutable std::shared_mutex good_specializations_lock_;
+
+    // Combinations of bound shader objects that passed the draw time linking, push constant and set layout checks. These only
+    // depend on the shaders, so a renderer rebinding the same few combinations only checks each of them once. Shader objects
+    // are compared by address, the whole set is cleared when one is destroyed.
+    struct BoundShaderObjects {
+        std::array<const vvl::ShaderObject*, kShaderObjectStageCount> shaders;
+        bool operator==(const BoundShaderObjects& rhs) const { return shaders == rhs.shaders; }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            for (const vvl::ShaderObject* shader : shaders) {
+                hc << shader;
+            }
+            return hc.Value();
+        }
+    };
+    mutable vvl::unordered_set<BoundShaderObjects, hash_util::HasHashMember<BoundShaderObjects>> good_bound_shader_objects_;
+    mutable std::shared_mutex good_bound_shader_objects_lock_;
+
+    // Shader binding table regions whose buffers passed validation, with the buffer_device_address_ranges_version they were
+    // found with. A path tracer traces rays many times per frame against the same tables. Buffers being created or destroyed
+    // changes the version, freeing memory clears the whole cache, since it can unbind the memory of a buffer in a region.
+    struct ShaderBindingTableKey {
+        VkDeviceAddress address;
+        VkDeviceSize size;
+        VkDeviceSize stride;
+        bool operator==(const ShaderBindingTableKey& rhs) const {
+            return address == rhs.address && size == rhs.size && stride == rhs.stride;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << address << size << stride;
+            return hc.Value();
+        }
+    };
+    mutable vvl::unordered_map<ShaderBindingTableKey, uint32_t, hash_util::HasHashMember<ShaderBindingTableKey>>
+        good_shader_binding_tables_;
+    mutable std::shared_mutex good_shader_binding_tables_lock_;
+
+    // Results of the vkGetPhysicalDeviceImageFormatProperties[2] queries of image creation, which only depend on the physical
+    // device. Render target allocators create many images of the same few shapes. Only the create infos whose pNext chain
+    // has no other image format info than a view format list or a stencil usage are cached, the other structs are rare.
+    struct ImageFormatPropertiesKey {
+        VkFormat format;
+        VkImageType type;
+        VkImageTiling tiling;
+        VkImageUsageFlags usage;
+        VkImageCreateFlags flags;
+        bool has_stencil_usage;
+        VkImageUsageFlags stencil_usage;
+        bool has_view_formats;
+        std::vector<VkFormat> view_formats;
+        bool operator==(const ImageFormatPropertiesKey& rhs) const {
+            return format == rhs.format && type == rhs.type && tiling == rhs.tiling && usage == rhs.usage && flags == rhs.flags &&
+                   has_stencil_usage == rhs.has_stencil_usage && stencil_usage == rhs.stencil_usage &&
+                   has_view_formats == rhs.has_view_formats && view_formats == rhs.view_formats;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << format << type << tiling << usage << flags << has_stencil_usage << stencil_usage << has_view_formats;
+            hc.Combine(view_formats);
+            return hc.Value();
+        }
+    };
+    struct ImageFormatPropertiesResult {
+        VkResult result;
+        VkImageFormatProperties properties;
+    };
+    mutable vvl::unordered_map<ImageFormatPropertiesKey, ImageFormatPropertiesResult,
+                               hash_util::HasHashMember<ImageFormatPropertiesKey>>
+        image_format_properties_cache_;
+    mutable std::shared_mutex image_format_properties_cache_lock_;
+
+    // Results of the vkGetPhysicalDeviceExternal{Buffer,Semaphore,Fence}Properties queries of the external object checks,
+    // which only depend on the physical device. A compositor importing and exporting many handles uses the same few
+    // handle types (and buffer create parameters) every time.
+    struct ExternalBufferPropertiesKey {
+        VkBufferCreateFlags flags;
+        VkBufferUsageFlags usage;
+        VkExternalMemoryHandleTypeFlagBits handle_type;
+        bool operator==(const ExternalBufferPropertiesKey& rhs) const {
+            return flags == rhs.flags && usage == rhs.usage && handle_type == rhs.handle_type;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << flags << usage << handle_type;
+            return hc.Value();
+        }
+    };
+    mutable vvl::unordered_map<ExternalBufferPropertiesKey, VkExternalMemoryProperties,
+                               hash_util::HasHashMember<ExternalBufferPropertiesKey>>
+        external_buffer_properties_cache_;
+    mutable vvl::unordered_map<VkExternalSemaphoreHandleTypeFlagBits, VkExternalSemaphoreProperties>
+        external_semaphore_properties_cache_;
+    mutable vvl::unordered_map<VkExternalFenceHandleTypeFlagBits, VkExternalFenceProperties> external_fence_properties_cache_;
+    mutable std::shared_mutex external_properties_cache_lock_;
+
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
     ReadLockGuard ReadLock() const override;
@@ -97,6 +269,7 @@ class CoreChecks : public ValidationStateTracker {
                                    const char* vuid) const;
     bool ValidateDynamicStateIsSet(const LastBound& last_bound_state, const CBDynamicFlags& state_status_cb,
                                    CBDynamicState dynamic_state, const vvl::DrawDispatchVuid& vuid) const;
+    CBDynamicFlags GetShaderObjectDynamicStates() const;
     bool ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateGraphicsDynamicStatePipelineSetStatus(const LastBound& last_bound_state, const vvl::Pipeline& pipeline,
                                                        const vvl::DrawDispatchVuid& vuid) const;
@@ -175,7 +348,7 @@ class CoreChecks : public ValidationStateTracker {
                                const BufferBarrier& barrier) const;
 
     bool ValidateImageBarrier(const LogObjectList& objlist, const Location& barrier_loc, const vvl::CommandBuffer& cb_state,
-                              const ImageBarrier& barrier) const;
+                              const ImageBarrier& barrier, const vvl::Image* image_state) const;
 
     bool ValidateBarriers(const Location& loc, const vvl::CommandBuffer& cb_state, VkPipelineStageFlags src_stage_mask,
                           VkPipelineStageFlags dst_stage_mask, uint32_t memBarrierCount, const VkMemoryBarrier* pMemBarriers,
@@ -230,10 +403,8 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateGraphicsPipelineBindPoint(const vvl::CommandBuffer& cb_state, const vvl::Pipeline& pipeline,
                                            const Location& loc) const;
     bool ValidatePipelineBindPoint(const vvl::CommandBuffer& cb_state, VkPipelineBindPoint bind_point, const Location& loc) const;
-    bool ValidateMemoryIsMapped(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                const ErrorObject& error_obj) const;
-    bool ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                               const ErrorObject& error_obj) const;
+    bool ValidateMappedMemoryRanges(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
+                                    const ErrorObject& error_obj) const;
     bool ValidateSecondaryCommandBufferState(const vvl::CommandBuffer& cb_state, const vvl::CommandBuffer& sub_cb_state,
                                              const Location& cb_loc) const;
     bool ValidateInheritanceInfoFramebuffer(VkCommandBuffer primaryBuffer, const vvl::CommandBuffer& cb_state,
@@ -467,7 +638,17 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateDepthStencilResolve(const VkRenderPassCreateInfo2* pCreateInfo, const ErrorObject& error_obj) const;
 
     // Prototypes for CoreChecks accessor functions
-    VkFormatProperties3KHR GetPDFormatProperties(const VkFormat format) const;
+    VkResult GetImageFormatProperties(const VkPhysicalDeviceImageFormatInfo2& image_format_info,
+                                      VkImageFormatProperties& image_format_properties) const;
+    // The returned structs have no pNext chain
+    VkExternalMemoryProperties GetExternalBufferProperties(VkBufferCreateFlags flags, VkBufferUsageFlags usage,
+                                                           VkExternalMemoryHandleTypeFlagBits handle_type) const;
+    VkExternalSemaphoreProperties GetExternalSemaphoreProperties(VkExternalSemaphoreHandleTypeFlagBits handle_type) const;
+    VkExternalFenceProperties GetExternalFenceProperties(VkExternalFenceHandleTypeFlagBits handle_type) const;
+    bool CanSemaphoreExportFromImported(VkExternalSemaphoreHandleTypeFlagBits export_type,
+                                        VkExternalSemaphoreHandleTypeFlagBits imported_type) const;
+    bool CanFenceExportFromImported(VkExternalFenceHandleTypeFlagBits export_type,
+                                    VkExternalFenceHandleTypeFlagBits imported_type) const;
     const VkPhysicalDeviceMemoryProperties* GetPhysicalDeviceMemoryProperties();
 
     bool FormatRequiresYcbcrConversionExplicitly(const VkFormat format) const;
@@ -534,8 +715,12 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateDrawShaderObjectPushConstantAndLayout(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateDrawShaderObjectMesh(const LastBound& last_bound_state, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateActionState(const vvl::CommandBuffer& cb_state, const VkPipelineBindPoint bind_point, const Location& loc) const;
+    // True if the action command being validated runs a family of checks sampled at sample_rate, see CoreChecksSettings
+    bool SampleActionCommand(const vvl::CommandBuffer& cb_state, uint32_t sample_rate) const;
     bool ValidateActionStateDescriptorsPipeline(const LastBound& last_bound_state, const VkPipelineBindPoint bind_point,
                                                 const vvl::Pipeline& pipeline, const vvl::DrawDispatchVuid& vuid) const;
+    bool ValidateActionStateDescriptorSet(const LastBound& last_bound_state, uint32_t set_index,
+                                          const BindingVariableMap& binding_req_map, const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateActionStateDescriptorsShaderObject(const LastBound& last_bound_state, const VkPipelineBindPoint bind_point,
                                                     const vvl::DrawDispatchVuid& vuid) const;
     bool ValidateActionStatePushConstant(const LastBound& last_bound_state, const vvl::Pipeline* pipeline,
@@ -595,7 +780,7 @@ class CoreChecks : public ValidationStateTracker {
     // Descriptor Set Validation Functions
     bool ValidateSampler(VkSampler) const;
     bool ValidateBufferUsage(const vvl::Buffer& buffer_state, VkDescriptorType type, const Location& buffer_loc) const;
-    bool ValidateBufferUpdate(const VkDescriptorBufferInfo& buffer_info, VkDescriptorType type,
+    bool ValidateBufferUpdate(const vvl::Buffer& buffer_state, const VkDescriptorBufferInfo& buffer_info, VkDescriptorType type,
                               const Location& buffer_info_loc) const;
     bool ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount,
                                       const VkCopyDescriptorSet* pDescriptorCopies, const Location& loc) const;
@@ -685,11 +870,23 @@ class CoreChecks : public ValidationStateTracker {
     bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
     bool ValidateSpirvStateless(const spirv::Module& module_state, const spirv::StatelessData& stateless_data,
                                 const Location& loc) const;
-    bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
+    bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc,
+                                        bool defer_spirv_val = false) const;
+    bool CanDeferSpirvValidation(const VkShaderModuleCreateInfo& create_info) const;
+    bool DeferSpirvValidation(const VkShaderModuleCreateInfo& create_info, chassis::CreateShaderModule& chassis_state,
+                              const Location& create_info_loc);
+    void RunDeferredSpirvValidation(const spirv::Module& module_state) const;
+    bool JoinDeferredSpirvValidation(const spirv::Module& module_state) const;
+    void WaitForDeferredSpirvValidations() const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                            const ErrorObject& error_obj) const override;
     bool ValidateShaderStage(const ShaderStageState& stage_state, const vvl::Pipeline* pipeline, const Location& loc) const;
+    std::optional<SpecializationResult> FindGoodSpecialization(const std::shared_ptr<const spirv::Module>& module_state,
+                                                               const SpecializationKey& key) const;
+    void AddGoodSpecialization(SpecializationKey&& key, const SpecializationResult& result) const;
+    uint64_t SpecializationCacheHash(const spirv::Module& module_state, const SpecializationKey& key,
+                                     spv_target_env spirv_environment) const;
     bool ValidatePointSizeShaderState(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                       const vvl::Pipeline& pipeline, VkShaderStageFlagBits stage, const Location& loc) const;
     bool ValidatePrimitiveRateShaderState(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
@@ -697,7 +894,10 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateTexelOffsetLimits(const spirv::Module& module_state, const spirv::Instruction& insn, const Location& loc) const;
 
     // Auto-generated helper functions
-    bool ValidateShaderCapabilitiesAndExtensions(const spirv::Instruction& insn, const Location& loc) const;
+    void InitSpirvSupport();
+    bool ValidateShaderCapabilitiesAndExtensions(const spirv::Module& module_state, const Location& loc) const;
+    bool ValidateShaderCapability(uint32_t capability, const Location& loc) const;
+    bool ValidateShaderExtension(const std::string& extension_name, const Location& loc) const;
     VkFormat CompatibleSpirvImageFormat(uint32_t spirv_image_format) const;
 
     bool ValidateShaderStageInputOutputLimits(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
@@ -743,9 +943,18 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidatePrimitiveTopology(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                    const vvl::Pipeline& pipeline, const Location& loc) const;
     bool ValidateSpecializations(const vku::safe_VkSpecializationInfo* spec, const Location& loc) const;
-    bool ValidateInterfaceBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
-                                        const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
-                                        const Location& create_info_loc) const;
+    bool ValidateInterfaceBetweenStages(const std::shared_ptr<const spirv::Module>& producer_spirv,
+                                        const spirv::EntryPoint& producer_entrypoint,
+                                        const std::shared_ptr<const spirv::Module>& consumer_spirv,
+                                        const spirv::EntryPoint& consumer_entrypoint, const Location& create_info_loc) const;
+    bool IsGoodStageInterface(const std::shared_ptr<const spirv::Module>& producer_spirv,
+                              const spirv::EntryPoint& producer_entrypoint,
+                              const std::shared_ptr<const spirv::Module>& consumer_spirv,
+                              const spirv::EntryPoint& consumer_entrypoint) const;
+    void AddGoodStageInterface(const std::shared_ptr<const spirv::Module>& producer_spirv,
+                               const spirv::EntryPoint& producer_entrypoint,
+                               const std::shared_ptr<const spirv::Module>& consumer_spirv,
+                               const spirv::EntryPoint& consumer_entrypoint) const;
     bool ValidateFsOutputsAgainstRenderPass(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                             const vvl::Pipeline& pipeline, uint32_t subpass_index,
                                             const Location& create_info_loc) const;
@@ -905,14 +1114,15 @@ class CoreChecks : public ValidationStateTracker {
 
     void TransitionBeginRenderPassLayouts(vvl::CommandBuffer& cb_state, const vvl::RenderPass& render_pass_state);
 
-    bool UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer& cb_state, const Location& image_loc,
-                                           const ImageBarrier& img_barrier, const vvl::CommandBuffer::ImageLayoutMap& current_map,
+    bool UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer& cb_state, const vvl::Image& image_state,
+                                           const Location& image_loc, const ImageBarrier& img_barrier,
+                                           const vvl::CommandBuffer::ImageLayoutMap& current_map,
                                            vvl::CommandBuffer::ImageLayoutMap& layout_updates) const;
 
     bool ValidateBarrierLayoutToImageUsage(const Location& layout_loc, VkImage image, VkImageLayout layout,
                                            VkImageUsageFlags usage) const;
 
-    bool ValidateBarriersToImages(const Location& barrier_loc, const vvl::CommandBuffer& cb_state,
+    bool ValidateBarriersToImages(const Location& barrier_loc, const vvl::CommandBuffer& cb_state, const vvl::Image& image_state,
                                   const ImageBarrier& image_barrier, vvl::CommandBuffer::ImageLayoutMap& layout_updates_state) const;
 
     void RecordQueuedQFOTransfers(vvl::CommandBuffer& cb_state);
@@ -921,7 +1131,10 @@ class CoreChecks : public ValidationStateTracker {
     void TransitionImageLayouts(vvl::CommandBuffer& cb_state, uint32_t barrier_count, const VkImageMemoryBarrier* image_barriers,
                                 VkPipelineStageFlags src_stage_mask, VkPipelineStageFlags dst_stage_mask);
 
-    void RecordTransitionImageLayout(vvl::CommandBuffer& cb_state, const ImageBarrier& image_barrier);
+    // image_state holds the image of the previous barrier of the command, which is often the same image (one barrier per mip
+    // level or layer) and then isn't looked up again
+    void RecordTransitionImageLayout(vvl::CommandBuffer& cb_state, const ImageBarrier& image_barrier,
+                                     std::shared_ptr<const vvl::Image>& image_state);
     void RecordBarriers(Func func_name, vvl::CommandBuffer& cb_state, VkPipelineStageFlags src_stage_mask,
                         VkPipelineStageFlags dst_stage_mask, uint32_t bufferBarrierCount,
                         const VkBufferMemoryBarrier* pBufferMemBarriers, uint32_t imageMemBarrierCount,
@@ -1000,8 +1213,11 @@ class CoreChecks : public ValidationStateTracker {
     void PreCallRecordCmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo,
                                     const RecordObject& record_obj) override;
 
+    // matches_global_layouts is set when CmdBufImageLayoutsMatchGlobal() already passed for this submission, only the images
+    // transitioned by earlier command buffers of the submission are then checked
     bool ValidateCmdBufImageLayouts(const Location& loc, const vvl::CommandBuffer& cb_state,
-                                    GlobalImageLayoutMap& overlayLayoutMap) const;
+                                    GlobalImageLayoutMap& overlayLayoutMap, bool matches_global_layouts) const;
+    bool CmdBufImageLayoutsMatchGlobal(const vvl::CommandBuffer& cb_state) const;
 
     void UpdateCmdBufImageLayouts(const vvl::CommandBuffer& cb_state);
 
@@ -1291,6 +1507,7 @@ class CoreChecks : public ValidationStateTracker {
                                      const VkAllocationCallbacks* pAllocator, VkDevice* pDevice,
                                      const ErrorObject& error_obj) const override;
     void PostCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    bool IsInterceptNeeded(std::string_view hook) const override;
     bool PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                         VkDeviceSize dataSize, const void* pData, const ErrorObject& error_obj) const override;
     bool PreCallValidateGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue,
@@ -1338,6 +1555,8 @@ class CoreChecks : public ValidationStateTracker {
                                        const ErrorObject& error_obj) const override;
     bool PreCallValidateFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator,
                                    const ErrorObject& error_obj) const override;
+    void PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks* pAllocator,
+                                 const RecordObject& record_obj) override;
     bool PreCallValidateCreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
                                     VkFence* pFence, const ErrorObject& error_obj) const override;
     bool PreCallValidateCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
@@ -1471,6 +1690,8 @@ class CoreChecks : public ValidationStateTracker {
                                          const ErrorObject& error_obj) const override;
     bool PreCallValidateDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
                                          const ErrorObject& error_obj) const override;
+    void PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                       const RecordObject& record_obj) override;
     bool PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits* pStages,
                                           const VkShaderEXT* pShaders, const ErrorObject& error_obj) const override;
     bool PreCallValidateGetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t* pDataSize, void* pData,
@@ -1520,12 +1741,12 @@ class CoreChecks : public ValidationStateTracker {
                                      const Location& info_loc) const;
     bool CommonBuildAccelerationStructureValidation(const VkAccelerationStructureBuildGeometryInfoKHR& info,
                                                     const Location& info_loc, LogObjectList object_list) const;
-    bool ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t infoCount,
-                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, uint32_t info_i,
-                                                       const ErrorObject& error_obj) const;
-    bool ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
-        const LogObjectList& objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
-        uint32_t info_i, const VkAccelerationStructureBuildRangeInfoKHR* range_infos, const ErrorObject& error_obj) const;
+    // Validates the memory aliasing of the source, destination and scratch resources of all the builds of one command.
+    // ppBuildRangeInfos can be null when the scratch sizes are not known on the host, then scratch buffers are not checked.
+    bool ValidateAccelerationStructuresBuildMemoryAliasing(const LogObjectList& objlist, uint32_t infoCount,
+                                                           const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
+                                                           const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos,
+                                                           const ErrorObject& error_obj) const;
     bool PreCallValidateCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                           const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                           const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos,
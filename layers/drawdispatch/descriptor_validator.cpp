@@ -69,6 +69,38 @@ vvl::DescriptorValidator::DescriptorValidator(ValidationStateTracker &dev, vvl::
                                               uint32_t set_index_, VkFramebuffer fb, const Location &l)
     : dev_state(dev), cb_state(cb), descriptor_set(set), set_index(set_index_), framebuffer(fb), loc(l), vuids(GetDrawDispatchVuid(loc.function)) {}
 
+vvl::DescriptorValidationCache::Key vvl::DescriptorValidator::GetCacheKey(const DescriptorBindingInfo &binding_info) const {
+    hash_util::HashCombiner requirement_hash;
+    for (const auto &requirement : binding_info.second) {
+        requirement_hash << requirement.revalidate_hash;
+    }
+    // Only the attachment feedback loop checks look at the bound graphics pipeline
+    const uint64_t pipeline_generation =
+        cb_state.active_attachments.empty() ? 0 : cb_state.lastBound[BindPoint_Graphics].pipeline_generation;
+
+    DescriptorValidationCache::Key key;
+    key.cb_id = cb_state.GetId();
+    key.render_state_generation = cb_state.render_state_generation;
+    key.image_layout_change_count = cb_state.image_layout_change_count;
+    key.pipeline_generation = pipeline_generation;
+    key.requirement_hash = requirement_hash.Value();
+    key.command = loc.function;
+    key.set_index = set_index;
+    key.binding = binding_info.first;
+    return key;
+}
+
+// Returns the entry for key, after dropping everything that was validated before objects referenced by the set changed.
+// The cache lock must be held.
+static vvl::DescriptorValidationCache::Entry &GetCacheEntry(vvl::DescriptorValidationCache &cache, uint64_t invalidate_count,
+                                                            const vvl::DescriptorValidationCache::Key &key) {
+    if (cache.invalidate_count != invalidate_count || cache.entries.size() >= vvl::DescriptorValidationCache::kMaxEntries) {
+        cache.entries.clear();
+        cache.invalidate_count = invalidate_count;
+    }
+    return cache.entries[key];
+}
+
 template <typename T>
 bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &binding_info, const T &binding) const {
     bool skip = false;
@@ -90,6 +122,20 @@ bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &
 bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &binding_info, const vvl::DescriptorBinding &binding) const {
     using DescriptorClass = vvl::DescriptorClass;
     bool skip = false;
+
+    // Nothing to do if the whole binding was already validated for the same use, with the same set contents
+    DescriptorValidationCache &cache = descriptor_set.GetValidationCache();
+    const DescriptorValidationCache::Key cache_key = GetCacheKey(binding_info);
+    const uint64_t invalidate_count = descriptor_set.GetInvalidateCount();
+    uint64_t update_count = 0;
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        if (GetCacheEntry(cache, invalidate_count, cache_key).all_validated) {
+            return skip;
+        }
+        update_count = cache.update_count;
+    }
+
     switch (binding.descriptor_class) {
         case DescriptorClass::InlineUniform:
             // Can't validate the descriptor because it may not have been updated.
@@ -115,6 +161,16 @@ bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &bind
         default:
             break;
     }
+
+    // Only remember bindings where the call was not skipped, so an error the application asked to skip for is reported again
+    if (!skip) {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        if (cache.invalidate_count == invalidate_count && cache.update_count == update_count) {
+            auto &entry = GetCacheEntry(cache, invalidate_count, cache_key);
+            entry.all_validated = true;
+            entry.validated_indices.clear();
+        }
+    }
     return skip;
 }
 
@@ -137,12 +193,37 @@ bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &
     return skip;
 }
 
-bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &binding_info, const std::vector<uint32_t> &indices) {
+bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &binding_info, const std::vector<uint32_t> &used_indices) {
     using DescriptorClass = vvl::DescriptorClass;
     bool skip = false;
     auto binding_ptr = descriptor_set.GetBinding(binding_info.first);
     ASSERT_AND_RETURN_SKIP(binding_ptr);
     auto &binding = *binding_ptr;
+
+    // Only look at the descriptors that were not already validated for the same use, with the same set contents
+    DescriptorValidationCache &cache = descriptor_set.GetValidationCache();
+    const DescriptorValidationCache::Key cache_key = GetCacheKey(binding_info);
+    const uint64_t invalidate_count = descriptor_set.GetInvalidateCount();
+    uint64_t update_count = 0;
+    std::vector<uint32_t> indices;
+    {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        const auto &entry = GetCacheEntry(cache, invalidate_count, cache_key);
+        if (entry.all_validated) {
+            return skip;
+        }
+        update_count = cache.update_count;
+        indices.reserve(used_indices.size());
+        for (const uint32_t index : used_indices) {
+            if (index >= entry.validated_indices.size() || !entry.validated_indices[index]) {
+                indices.emplace_back(index);
+            }
+        }
+    }
+    if (indices.empty()) {
+        return skip;
+    }
+
     switch (binding.descriptor_class) {
         case DescriptorClass::InlineUniform:
             // Can't validate the descriptor because it may not have been updated.
@@ -180,6 +261,19 @@ bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &bind
         default:
             break;
     }
+
+    if (!skip) {
+        std::lock_guard<std::mutex> guard(cache.lock);
+        if (cache.invalidate_count == invalidate_count && cache.update_count == update_count) {
+            auto &entry = GetCacheEntry(cache, invalidate_count, cache_key);
+            if (!entry.all_validated) {
+                entry.validated_indices.resize(binding.count, false);
+                for (const uint32_t index : indices) {
+                    entry.validated_indices[index] = true;
+                }
+            }
+        }
+    }
     return skip;
 }
 
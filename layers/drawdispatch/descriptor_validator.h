@@ -19,6 +19,7 @@
 // TODO - Should only need generated/chassis.h
 // Because of FormatHandle, we need to include all of state_tracker.h
 #include "state_tracker/state_tracker.h"
+#include "state_tracker/descriptor_sets.h"
 
 class ValidationStateTracker;
 struct DescriptorRequirement;
@@ -52,7 +53,8 @@ class DescriptorValidator {
     }
 
     bool ValidateBinding(const DescriptorBindingInfo& binding_info, const vvl::DescriptorBinding& binding) const;
-    bool ValidateBinding(const DescriptorBindingInfo& binding_info, const std::vector<uint32_t> &indices);
+    // Only the descriptors in used_indices are validated
+    bool ValidateBinding(const DescriptorBindingInfo& binding_info, const std::vector<uint32_t> &used_indices);
 
  private:
     template <typename T>
@@ -82,6 +84,9 @@ class DescriptorValidator {
 
     std::string DescribeDescriptor(const DescriptorBindingInfo& binding_info, uint32_t index) const;
 
+    // Everything outside of the descriptor set the result of validating binding_info depends on
+    DescriptorValidationCache::Key GetCacheKey(const DescriptorBindingInfo& binding_info) const;
+
     ValidationStateTracker& dev_state;
     vvl::CommandBuffer& cb_state;
     vvl::DescriptorSet& descriptor_set;
@@ -118,8 +118,8 @@ struct LocationCapture {
     const Location& Get() const { return capture.back(); }
 
   protected:
-    // TODO: Optimize this for "new" minimization
-    using CaptureStore = small_vector<Location, 2>;
+    // Deep enough for most create info walks, so capturing a Location doesn't allocate
+    using CaptureStore = small_vector<Location, 8>;
     const Location* Capture(const Location& loc, CaptureStore::size_type depth);
     CaptureStore capture;
 };
@@ -0,0 +1,301 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "error_message/log_file_writer.h"
+
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "vk_layer_config.h"
+
+// Binary log format, all integers are little endian:
+//   header:  "VVLBLOG\0", uint32 version
+//   string:  uint8 kBinaryString, uint32 size, bytes. Strings are numbered from 0 in the order they are written.
+//   reset:   uint8 kBinaryResetStrings, the following strings are numbered from 0 again
+//   message: uint8 kBinaryMessage, uint32 severity, uint32 type, int32 message id number, uint32 VUID string,
+//            uint32 message string, uint32 object count, then per object uint64 handle, uint32 object type, uint32 name string
+//            (kNoString for no name)
+// Keep scripts/decode_binary_log.py in sync.
+namespace {
+enum BinaryRecord : uint8_t {
+    kBinaryString = 1,
+    kBinaryResetStrings = 2,
+    kBinaryMessage = 3,
+};
+constexpr char kBinaryMagic[8] = {'V', 'V', 'L', 'B', 'L', 'O', 'G', '\0'};
+constexpr uint32_t kBinaryVersion = 1;
+constexpr uint32_t kNoString = vvl::kU32Max;
+
+void AppendU32(std::string &out, uint32_t value) {
+    for (uint32_t i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+void AppendU64(std::string &out, uint64_t value) {
+    AppendU32(out, static_cast<uint32_t>(value));
+    AppendU32(out, static_cast<uint32_t>(value >> 32));
+}
+
+// The handlers can't take a lock, so the live writers are kept in a fixed table of atomics
+constexpr uint32_t kMaxLiveWriters = 16;
+std::atomic<LogFileWriter *> live_writers[kMaxLiveWriters];
+std::once_flag handlers_installed;
+
+void FlushAtExit() { LogFileWriter::FlushAll(true, false); }
+
+#if defined(_WIN32)
+LPTOP_LEVEL_EXCEPTION_FILTER previous_exception_filter = nullptr;
+
+LONG WINAPI UnhandledExceptionHandler(EXCEPTION_POINTERS *exception_info) {
+    LogFileWriter::FlushAll(false, false);
+    return previous_exception_filter ? previous_exception_filter(exception_info) : EXCEPTION_CONTINUE_SEARCH;
+}
+#else
+constexpr int kFatalSignals[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT};
+constexpr uint32_t kFatalSignalCount = sizeof(kFatalSignals) / sizeof(kFatalSignals[0]);
+struct sigaction previous_signal_actions[kFatalSignalCount];
+
+void FatalSignalHandler(int signal_number) {
+    LogFileWriter::FlushAll(false, true);
+    // Let the handler that was installed before (by default, the one terminating the process) handle the signal
+    for (uint32_t i = 0; i < kFatalSignalCount; ++i) {
+        if (kFatalSignals[i] == signal_number) {
+            sigaction(signal_number, &previous_signal_actions[i], nullptr);
+        }
+    }
+    raise(signal_number);
+}
+#endif
+
+void InstallHandlers() {
+    std::atexit(FlushAtExit);
+#if defined(_WIN32)
+    previous_exception_filter = SetUnhandledExceptionFilter(UnhandledExceptionHandler);
+#else
+    struct sigaction action = {};
+    action.sa_handler = FatalSignalHandler;
+    sigemptyset(&action.sa_mask);
+    for (uint32_t i = 0; i < kFatalSignalCount; ++i) {
+        sigaction(kFatalSignals[i], &action, &previous_signal_actions[i]);
+    }
+#endif
+}
+}  // namespace
+
+LogFileWriter::LogFileWriter(FILE *file, bool binary) : file_(file), binary_(binary) {
+    if (binary_) {
+        pending_.append(kBinaryMagic, sizeof(kBinaryMagic));
+        AppendU32(pending_, kBinaryVersion);
+    }
+    std::call_once(handlers_installed, InstallHandlers);
+    for (auto &slot : live_writers) {
+        LogFileWriter *expected = nullptr;
+        if (slot.compare_exchange_strong(expected, this)) {
+            break;
+        }
+    }
+    thread_ = std::thread(&LogFileWriter::OutputThread, this);
+}
+
+LogFileWriter::~LogFileWriter() {
+    for (auto &slot : live_writers) {
+        LogFileWriter *expected = this;
+        slot.compare_exchange_strong(expected, nullptr);
+    }
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+    }
+    message_available_.notify_one();
+    // Messages still pending are written before the thread exits
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    fclose(file_);
+}
+
+std::string LogFileWriter::FormatText(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                      VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                      const VkDebugUtilsMessengerCallbackDataEXT &callback_data) {
+    std::ostringstream msg_buffer;
+    char msg_severity[30];
+    char msg_type[30];
+
+    PrintMessageSeverity(message_severity, msg_severity);
+    PrintMessageType(message_type, msg_type);
+
+    msg_buffer << callback_data.pMessageIdName << "(" << msg_severity << " / " << msg_type
+               << "): msgNum: " << callback_data.messageIdNumber << " - " << callback_data.pMessage << "\n";
+    msg_buffer << "    Objects: " << callback_data.objectCount << "\n";
+    for (uint32_t obj = 0; obj < callback_data.objectCount; ++obj) {
+        msg_buffer << "        [" << obj << "] " << std::hex << std::showbase << callback_data.pObjects[obj].objectHandle
+                   << ", type: " << std::dec << std::noshowbase << callback_data.pObjects[obj].objectType
+                   << ", name: " << (callback_data.pObjects[obj].pObjectName ? callback_data.pObjects[obj].pObjectName : "NULL")
+                   << "\n";
+    }
+    return msg_buffer.str();
+}
+
+void LogFileWriter::Write(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity, VkDebugUtilsMessageTypeFlagsEXT message_type,
+                          const VkDebugUtilsMessengerCallbackDataEXT &callback_data) {
+    std::string text;
+    if (!binary_) {
+        text = FormatText(message_severity, message_type, callback_data);
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_available_.wait(lock, [this] { return pending_.size() < kMaxPendingBytes; });
+    if (binary_) {
+        AppendBinaryMessage(message_severity, message_type, callback_data);
+    } else {
+        pending_.append(text);
+    }
+    lock.unlock();
+    message_available_.notify_one();
+}
+
+void LogFileWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    drained_.wait(lock, [this] { return pending_.empty() && !busy_; });
+}
+
+uint32_t LogFileWriter::InternString(const char *string) {
+    if (!string) {
+        return kNoString;
+    }
+    auto found = strings_.find(string);
+    if (found != strings_.end()) {
+        return found->second;
+    }
+    const size_t size = strlen(string);
+    const uint32_t index = static_cast<uint32_t>(strings_.size());
+    strings_.emplace(string, index);
+    string_bytes_ += size;
+    pending_.push_back(static_cast<char>(kBinaryString));
+    AppendU32(pending_, static_cast<uint32_t>(size));
+    pending_.append(string, size);
+    return index;
+}
+
+void LogFileWriter::AppendBinaryMessage(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                        VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                        const VkDebugUtilsMessengerCallbackDataEXT &callback_data) {
+    // A reset between the strings of a message would invalidate the indices taken before it, so the table is reset before
+    // interning them if they could overflow it
+    size_t string_bytes = strlen(callback_data.pMessageIdName) + strlen(callback_data.pMessage);
+    for (uint32_t obj = 0; obj < callback_data.objectCount; ++obj) {
+        const char *name = callback_data.pObjects[obj].pObjectName;
+        string_bytes += name ? strlen(name) : 0;
+    }
+    if (string_bytes_ + string_bytes > kMaxStringTableBytes) {
+        pending_.push_back(static_cast<char>(kBinaryResetStrings));
+        strings_.clear();
+        string_bytes_ = 0;
+    }
+
+    // The string records have to come before the message referencing them
+    const uint32_t vuid = InternString(callback_data.pMessageIdName);
+    const uint32_t message = InternString(callback_data.pMessage);
+    small_vector<uint32_t, 4, uint32_t> object_names;
+    for (uint32_t obj = 0; obj < callback_data.objectCount; ++obj) {
+        object_names.emplace_back(InternString(callback_data.pObjects[obj].pObjectName));
+    }
+
+    pending_.push_back(static_cast<char>(kBinaryMessage));
+    AppendU32(pending_, static_cast<uint32_t>(message_severity));
+    AppendU32(pending_, message_type);
+    AppendU32(pending_, static_cast<uint32_t>(callback_data.messageIdNumber));
+    AppendU32(pending_, vuid);
+    AppendU32(pending_, message);
+    AppendU32(pending_, callback_data.objectCount);
+    for (uint32_t obj = 0; obj < callback_data.objectCount; ++obj) {
+        AppendU64(pending_, callback_data.pObjects[obj].objectHandle);
+        AppendU32(pending_, static_cast<uint32_t>(callback_data.pObjects[obj].objectType));
+        AppendU32(pending_, object_names[obj]);
+    }
+}
+
+void LogFileWriter::OutputThread() {
+    std::string writing;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        message_available_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) {
+            fflush(file_);
+            return;
+        }
+        writing.swap(pending_);
+        busy_ = true;
+        lock.unlock();
+        space_available_.notify_all();
+
+        fwrite(writing.data(), 1, writing.size(), file_);
+        fflush(file_);
+        writing.clear();
+
+        lock.lock();
+        busy_ = false;
+        drained_.notify_all();
+    }
+}
+
+void LogFileWriter::WritePending(bool in_signal_handler) {
+    std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+    if (!in_signal_handler && !lock.try_lock()) {
+        return;
+    }
+    if (pending_.empty()) {
+        return;
+    }
+#if defined(_WIN32)
+    _write(_fileno(file_), pending_.data(), static_cast<unsigned int>(pending_.size()));
+#else
+    [[maybe_unused]] const ssize_t written = write(fileno(file_), pending_.data(), pending_.size());
+#endif
+    pending_.clear();
+}
+
+void LogFileWriter::FlushAll(bool at_exit, bool in_signal_handler) {
+    for (auto &slot : live_writers) {
+        LogFileWriter *writer = slot.load();
+        if (!writer) {
+            continue;
+        }
+#if !defined(_WIN32)
+        // At exit the output thread is still running, unlike on Windows where the other threads are already terminated when
+        // the layer is unloaded
+        if (at_exit) {
+            writer->Flush();
+            continue;
+        }
+#else
+        (void)at_exit;
+#endif
+        // The output thread may be in the middle of a write, these messages can come before the end of the ones it writes
+        writer->WritePending(in_signal_handler);
+    }
+}
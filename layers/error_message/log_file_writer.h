@@ -0,0 +1,94 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/custom_containers.h"
+
+// Writes the messages of the log_filename callback to the file on a separate thread.
+//
+// The callback runs with debug_output_mutex held, which used to include a fprintf and a fflush per message. Now it only
+// appends the message to a buffer. The buffer is bounded: when the output thread falls kMaxPendingBytes behind, the logging
+// threads wait for it instead of growing the buffer.
+//
+// Pending messages are written when the writer is destroyed, at exit and from the fatal signal (or unhandled exception)
+// handler, so a crash doesn't lose the last messages, which are often the ones explaining it.
+//
+// In the binary format each VUID, message text and object name is written once and referenced by index afterwards. The log of
+// a noisy run, which repeats the same messages every frame, is a fraction of the text size.
+// scripts/decode_binary_log.py renders it as the text the log would have had.
+class LogFileWriter {
+  public:
+    static constexpr size_t kMaxPendingBytes = 8 * 1024 * 1024;
+    // Past this size the string table is reset, the strings are then written again on their next use
+    static constexpr size_t kMaxStringTableBytes = 16 * 1024 * 1024;
+
+    // Takes ownership of file
+    LogFileWriter(FILE *file, bool binary);
+    ~LogFileWriter();
+    LogFileWriter(const LogFileWriter &) = delete;
+    LogFileWriter &operator=(const LogFileWriter &) = delete;
+
+    void Write(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity, VkDebugUtilsMessageTypeFlagsEXT message_type,
+               const VkDebugUtilsMessengerCallbackDataEXT &callback_data);
+    // Block until every message written so far is in the file
+    void Flush();
+
+    // The text of a message in the log
+    static std::string FormatText(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                  VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                  const VkDebugUtilsMessengerCallbackDataEXT &callback_data);
+
+    // Used by the exit and crash handlers
+    static void FlushAll(bool at_exit, bool in_signal_handler);
+
+  private:
+    void OutputThread();
+    // Write the pending messages from the calling thread, the lock isn't taken in a signal handler
+    void WritePending(bool in_signal_handler);
+    uint32_t InternString(const char *string);
+    void AppendBinaryMessage(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                             VkDebugUtilsMessageTypeFlagsEXT message_type,
+                             const VkDebugUtilsMessengerCallbackDataEXT &callback_data);
+
+    FILE *file_;
+    const bool binary_;
+
+    std::mutex mutex_;
+    std::condition_variable message_available_;
+    // Signaled when the output thread took the pending messages
+    std::condition_variable space_available_;
+    std::condition_variable drained_;
+    std::string pending_;
+    // Set while the output thread writes messages it took out of pending_
+    bool busy_ = false;
+    bool stop_ = false;
+
+    // Binary format string table, guarded by mutex_
+    vvl::unordered_map<std::string, uint32_t> strings_;
+    size_t string_bytes_ = 0;
+
+    std::thread thread_;
+};
@@ -16,8 +16,13 @@
  */
 #include "logging.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <csignal>
 #include <cstring>
+#include <deque>
+#include <optional>
+#include <thread>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -26,6 +31,8 @@
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include "generated/vk_validation_error_messages.h"
 #include "error_location.h"
+#include "log_file_writer.h"
+#include "utils/arena_allocator.h"
 #include "utils/hash_util.h"
 
 [[maybe_unused]] const char *kVUIDUndefined = "VUID_Undefined";
@@ -90,23 +97,59 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     SetDebugUtilsSeverityFlags(callbacks);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
-    auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == duplicate_message_count_map.end()) {
-        duplicate_message_count_map.emplace(vuid_hash, 1);
-        return false;
-    } else {
-        if (vuid_count_it->second >= duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
+DuplicateMessageCounter::DuplicateMessageCounter() : slots_(std::make_unique<Slot[]>(kSlotCount)) {}
+
+DuplicateMessageCounter::Slot *DuplicateMessageCounter::FindSlot(uint32_t message_id, bool insert) const {
+    const uint64_t key = uint64_t(message_id) + 1;
+    // message ids are already hashes
+    for (uint32_t probe = 0; probe < kMaxProbes; ++probe) {
+        Slot &slot = slots_[(message_id + probe) % kSlotCount];
+        uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+        if (slot_key == key) {
+            return &slot;
+        }
+        if (slot_key == 0) {
+            if (!insert) {
+                return nullptr;
+            }
+            if (slot.key.compare_exchange_strong(slot_key, key, std::memory_order_acq_rel) || slot_key == key) {
+                return &slot;
+            }
         }
     }
+    return nullptr;
 }
 
-bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const {
+bool DuplicateMessageCounter::CountAndCheckLimit(uint32_t message_id, uint32_t limit) {
+    if (Slot *slot = FindSlot(message_id, true)) {
+        uint32_t count = slot->count.load(std::memory_order_relaxed);
+        do {
+            if (count >= limit) {
+                return true;
+            }
+        } while (!slot->count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(overflow_lock_);
+    uint32_t &count = overflow_counts_[message_id];
+    if (count >= limit) {
+        return true;
+    }
+    count++;
+    return false;
+}
+
+bool DuplicateMessageCounter::IsOverLimit(uint32_t message_id, uint32_t limit) const {
+    if (const Slot *slot = FindSlot(message_id, false)) {
+        return slot->count.load(std::memory_order_relaxed) >= limit;
+    }
+    std::lock_guard<std::mutex> guard(overflow_lock_);
+    auto it = overflow_counts_.find(message_id);
+    return it != overflow_counts_.end() && it->second >= limit;
+}
+
+bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid,
+                              uint32_t message_id_number) const {
     bool bail = false;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
@@ -138,10 +181,9 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
 
         std::string object_label = {};
         // Look for any debug utils or marker names to use for this object
-        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
-        object_label = GetUtilsObjectNameNoLock(objects.object_list[i].handle);
+        object_label = GetUtilsObjectName(objects.object_list[i].handle);
         if (object_label.empty()) {
-            object_label = GetMarkerObjectNameNoLock(objects.object_list[i].handle);
+            object_label = GetMarkerObjectName(objects.object_list[i].handle);
         }
         if (!object_label.empty()) {
             object_labels.push_back(std::move(object_label));
@@ -167,8 +209,6 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         object_name_infos.push_back(object_name_info);
     }
 
-    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
-
     VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
     callback_data.flags = 0;
     callback_data.pMessageIdName = text_vuid;
@@ -269,26 +309,22 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
 }
 
 void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
     if (pNameInfo->pObjectName) {
-        debug_utils_object_name_map[pNameInfo->objectHandle] = pNameInfo->pObjectName;
+        debug_utils_object_name_map.insert_or_assign(pNameInfo->objectHandle, pNameInfo->pObjectName);
     } else {
         debug_utils_object_name_map.erase(pNameInfo->objectHandle);
     }
 }
 
 void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
     if (pNameInfo->pObjectName) {
-        debug_object_name_map[pNameInfo->object] = pNameInfo->pObjectName;
+        debug_object_name_map.insert_or_assign(pNameInfo->object, pNameInfo->pObjectName);
     } else {
         debug_object_name_map.erase(pNameInfo->object);
     }
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
-std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
+std::string DebugReport::GetUtilsObjectName(const uint64_t object) const {
     std::string label = "";
     const auto utils_name_iter = debug_utils_object_name_map.find(object);
     if (utils_name_iter != debug_utils_object_name_map.end()) {
@@ -297,9 +333,7 @@ std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
     return label;
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
-std::string DebugReport::GetMarkerObjectNameNoLock(const uint64_t object) const {
+std::string DebugReport::GetMarkerObjectName(const uint64_t object) const {
     std::string label = "";
     const auto marker_name_iter = debug_object_name_map.find(object);
     if (marker_name_iter != debug_object_name_map.end()) {
@@ -309,10 +343,9 @@ std::string DebugReport::GetMarkerObjectNameNoLock(const uint64_t object) const
 }
 
 std::string DebugReport::FormatHandle(const char *handle_type_name, uint64_t handle) const {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    std::string handle_name = GetUtilsObjectNameNoLock(handle);
+    std::string handle_name = GetUtilsObjectName(handle);
     if (handle_name.empty()) {
-        handle_name = GetMarkerObjectNameNoLock(handle);
+        handle_name = GetMarkerObjectName(handle);
     }
 
     std::ostringstream str;
@@ -339,7 +372,7 @@ static LoggingLabelState *GetLoggingLabelState(Map *map, typename Map::key_type
 }
 
 void DebugReport::BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     if (nullptr != label_info && nullptr != label_info->pLabelName) {
         auto *label_state = GetLoggingLabelState(&debug_utils_queue_labels, queue, /* insert */ true);
         assert(label_state);
@@ -351,7 +384,7 @@ void DebugReport::BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLab
 }
 
 void DebugReport::EndQueueDebugUtilsLabel(VkQueue queue) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_queue_labels, queue, /* insert */ false);
     if (label_state) {
         // Pop the normal item
@@ -365,7 +398,7 @@ void DebugReport::EndQueueDebugUtilsLabel(VkQueue queue) {
 }
 
 void DebugReport::InsertQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_queue_labels, queue, /* insert */ true);
 
     // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
@@ -373,7 +406,7 @@ void DebugReport::InsertQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLa
 }
 
 void DebugReport::BeginCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     if (nullptr != label_info && nullptr != label_info->pLabelName) {
         auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ true);
         assert(label_state);
@@ -385,7 +418,7 @@ void DebugReport::BeginCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const
 }
 
 void DebugReport::EndCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ false);
     if (label_state) {
         // Pop the normal item
@@ -399,7 +432,7 @@ void DebugReport::EndCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
 }
 
 void DebugReport::InsertCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ true);
     assert(label_state);
 
@@ -409,7 +442,7 @@ void DebugReport::InsertCmdDebugUtilsLabel(VkCommandBuffer command_buffer, const
 
 // Current tracking beyond a single command buffer scope is incorrect, and even when it is we need to be able to clean up
 void DebugReport::ResetCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     auto *label_state = GetLoggingLabelState(&debug_utils_cmd_buffer_labels, command_buffer, /* insert */ false);
     if (label_state) {
         label_state->labels.clear();
@@ -418,7 +451,7 @@ void DebugReport::ResetCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
 }
 
 void DebugReport::EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    std::unique_lock<OutputMutex> lock(debug_output_mutex);
     debug_utils_cmd_buffer_labels.erase(command_buffer);
 }
 
@@ -427,7 +460,7 @@ VKAPI_ATTR void LayerDebugUtilsDestroyInstance(DebugReport *debug_report) { dele
 template <typename TCreateInfo, typename TCallback>
 static void LayerCreateCallback(DebugCallbackStatusFlags callback_status, DebugReport *debug_report, const TCreateInfo *create_info,
                                 TCallback *callback) {
-    std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
+    std::unique_lock<DebugReport::OutputMutex> lock(debug_report->debug_output_mutex);
 
     debug_report->debug_callback_list.emplace_back(VkLayerDbgFunctionState());
     auto &callback_state = debug_report->debug_callback_list.back();
@@ -527,69 +560,40 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
-bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
+// Does not need debug_output_mutex, so muted messages don't serialize the threads logging them.
+bool DebugReport::LogMsgEnabled(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity,
                                 VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(active_severities & severity) || !(active_types & type)) {
+    if (!(active_severities.load(std::memory_order_relaxed) & severity) || !(active_types.load(std::memory_order_relaxed) & type)) {
         return false;
     }
     // If message is in filter list, bail out very early
-    const uint32_t message_id = hash_util::VuidHash(vuid_text);
     if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
         return false;
     }
-    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(static_cast<int32_t>(message_id))) {
+    if ((duplicate_message_limit > 0) && duplicate_message_counter.CountAndCheckLimit(message_id, duplicate_message_limit)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
     return true;
 }
 
-bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
-                         const char *format, va_list argptr) {
-    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
-
+bool DebugReport::IsMessageMuted(VkFlags msg_flags, std::string_view vuid_text) const {
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT type;
-
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    // Avoid logging cost if msg is to be ignored
-    if (!LogMsgEnabled(vuid_text, severity, type)) {
-        return false;
+    if (!(active_severities.load(std::memory_order_relaxed) & severity) || !(active_types.load(std::memory_order_relaxed) & type)) {
+        return true;
     }
-
-    // Best guess at an upper bound for message length. At least some of the extra space
-    // should get used to store the VUID URL and text in the common case, without additional allocations.
-    std::string str_plus_spec_text(1024, '\0');
-
-    // vsnprintf() returns the number of characters that *would* have been printed, if there was
-    // enough space. If we have a huge message, reallocate the string and try again.
-    int result;
-    size_t old_size = str_plus_spec_text.size();
-    // The va_list will be destroyed by the call to vsnprintf(), so use a copy in case we need
-    // to try again.
-    va_list arg_copy;
-    va_copy(arg_copy, argptr);
-    result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, arg_copy);
-    va_end(arg_copy);
-
-    assert(result >= 0);
-    if (result < 0) {
-        str_plus_spec_text = "Message generation failure";
-    } else if (static_cast<size_t>(result) <= old_size) {
-        // Shrink the string to exactly fit the successfully printed string
-        str_plus_spec_text.resize(result);
-    } else {
-        // Grow buffer to fit needed size. Note that the input size to vsnprintf() must
-        // include space for the trailing '\0' character, but the return value DOES NOT
-        // include the `\0' character.
-        str_plus_spec_text.resize(result + 1);
-        // consume the va_list passed to us by the caller
-        result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, argptr);
-        // remove the `\0' character from the string
-        str_plus_spec_text.resize(result);
+    const uint32_t message_id = hash_util::VuidHash(vuid_text);
+    if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
+        return true;
     }
+    return (duplicate_message_limit > 0) && duplicate_message_counter.IsOverLimit(message_id, duplicate_message_limit);
+}
 
+// Prefix the message with the location and append the spec text of the VUID. This only reads static tables, so it does
+// not need debug_output_mutex.
+static void AddLocationAndSpecText(const Location *loc, std::string_view vuid_text, std::string &str_plus_spec_text) {
     // TODO - make Location a reference once old LogError is gone
     if (loc) {
         str_plus_spec_text = loc->Message() + " " + str_plus_spec_text;
@@ -597,17 +601,16 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
 
     // Append the spec error text to the error message, unless it contains a word treated as special
     if ((vuid_text.find("VUID-") != std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        // The generated table is sorted by VUID
+        const vuid_spec_text_pair *table_end = vuid_spec_text + sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        const vuid_spec_text_pair *entry = std::lower_bound(
+            vuid_spec_text, table_end, vuid_text,
+            [](const vuid_spec_text_pair &pair, std::string_view vuid) { return std::string_view(pair.vuid) < vuid; });
         const char *spec_text = nullptr;
         std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
+        if (entry != table_end && vuid_text == entry->vuid) {
+            spec_text = entry->spec_text;
+            spec_type = entry->url_id;
         }
 
         // Construct and append the specification text and link to the appropriate version of the spec
@@ -652,8 +655,157 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
             str_plus_spec_text.append(")");
         }
     }
+}
+
+bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                         const char *format, va_list argptr) {
+    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
 
-    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+
+    DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+    // Avoid logging cost if msg is to be ignored
+    const uint32_t message_id = hash_util::VuidHash(vuid_text);
+    if (!LogMsgEnabled(message_id, severity, type)) {
+        return false;
+    }
+    // In deferred mode only the format arguments are consumed here, everything else happens on the output thread
+    const bool deferred = message_format_settings.deferred_output;
+    std::unique_lock<OutputMutex> lock(debug_output_mutex, std::defer_lock);
+    if (!deferred) {
+        lock.lock();
+    }
+
+    // Best guess at an upper bound for message length. At least some of the extra space
+    // should get used to store the VUID URL and text in the common case, without additional allocations.
+    std::string str_plus_spec_text(1024, '\0');
+
+    // vsnprintf() returns the number of characters that *would* have been printed, if there was
+    // enough space. If we have a huge message, reallocate the string and try again.
+    int result;
+    size_t old_size = str_plus_spec_text.size();
+    // The va_list will be destroyed by the call to vsnprintf(), so use a copy in case we need
+    // to try again.
+    va_list arg_copy;
+    va_copy(arg_copy, argptr);
+    result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, arg_copy);
+    va_end(arg_copy);
+
+    assert(result >= 0);
+    if (result < 0) {
+        str_plus_spec_text = "Message generation failure";
+    } else if (static_cast<size_t>(result) <= old_size) {
+        // Shrink the string to exactly fit the successfully printed string
+        str_plus_spec_text.resize(result);
+    } else {
+        // Grow buffer to fit needed size. Note that the input size to vsnprintf() must
+        // include space for the trailing '\0' character, but the return value DOES NOT
+        // include the `\0' character.
+        str_plus_spec_text.resize(result + 1);
+        // consume the va_list passed to us by the caller
+        result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, argptr);
+        // remove the `\0' character from the string
+        str_plus_spec_text.resize(result);
+    }
+
+    if (deferred) {
+        QueueDeferredMessage(msg_flags, objects, loc, vuid_text, message_id, std::move(str_plus_spec_text));
+        return false;
+    }
+
+    AddLocationAndSpecText(loc, vuid_text, str_plus_spec_text);
+    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data(), message_id);
+}
+
+// A message that passed filtering, waiting for the output thread to be finished and delivered to the callbacks
+struct DeferredMessage {
+    VkFlags msg_flags;
+    LogObjectList objects;
+    std::optional<LocationCapture> loc;
+    std::string vuid;
+    uint32_t message_id;
+    std::string text;
+};
+
+using DeferredMessages = std::deque<DeferredMessage, vvl::ArenaAllocator<DeferredMessage, vvl::Arena::ErrorMessage>>;
+
+struct DeferredMessageQueue {
+    std::mutex mutex;
+    std::condition_variable message_available;
+    std::condition_variable drained;
+    DeferredMessages messages;
+    // Set while the output thread delivers messages it already took out of the queue
+    bool busy = false;
+    bool stop = false;
+    std::thread thread;
+};
+
+DebugReport::DebugReport() : deferred_queue(std::make_unique<DeferredMessageQueue>()) {}
+
+DebugReport::~DebugReport() {
+    {
+        std::lock_guard<std::mutex> guard(deferred_queue->mutex);
+        deferred_queue->stop = true;
+    }
+    deferred_queue->message_available.notify_one();
+    // Messages still in the queue are delivered before the thread exits
+    if (deferred_queue->thread.joinable()) {
+        deferred_queue->thread.join();
+    }
+}
+
+void DebugReport::QueueDeferredMessage(VkFlags msg_flags, const LogObjectList &objects, const Location *loc,
+                                       std::string_view vuid_text, uint32_t message_id, std::string &&text) {
+    DeferredMessage message{msg_flags, objects, std::nullopt, std::string(vuid_text), message_id, std::move(text)};
+    // The Location chain lives on the stack of the caller, so it has to be captured
+    if (loc) {
+        message.loc.emplace(*loc);
+    }
+
+    std::unique_lock<std::mutex> lock(deferred_queue->mutex);
+    if (!deferred_queue->thread.joinable()) {
+        deferred_queue->thread = std::thread(&DebugReport::DeferredOutputThread, this);
+    }
+    deferred_queue->messages.emplace_back(std::move(message));
+    lock.unlock();
+    deferred_queue->message_available.notify_one();
+}
+
+LogFileWriter *DebugReport::CreateLogFileWriter(FILE *file) {
+    log_file_writer = std::make_unique<LogFileWriter>(file, message_format_settings.binary_log);
+    return log_file_writer.get();
+}
+
+void DebugReport::FlushDeferredMessages() {
+    std::unique_lock<std::mutex> lock(deferred_queue->mutex);
+    deferred_queue->drained.wait(lock, [this] { return deferred_queue->messages.empty() && !deferred_queue->busy; });
+}
+
+void DebugReport::DeferredOutputThread() {
+    DeferredMessageQueue &queue = *deferred_queue;
+    std::unique_lock<std::mutex> queue_lock(queue.mutex);
+    while (true) {
+        queue.message_available.wait(queue_lock, [&queue] { return queue.stop || !queue.messages.empty(); });
+        if (queue.messages.empty()) {
+            return;
+        }
+        DeferredMessages batch;
+        batch.swap(queue.messages);
+        queue.busy = true;
+        queue_lock.unlock();
+
+        for (DeferredMessage &message : batch) {
+            AddLocationAndSpecText(message.loc ? &message.loc->Get() : nullptr, message.vuid, message.text);
+            std::unique_lock<OutputMutex> lock(debug_output_mutex);
+            // The return value of the callbacks can't be used to skip the call anymore
+            DebugLogMsg(message.msg_flags, message.objects, message.text.c_str(), message.vuid.c_str(), message.message_id);
+        }
+
+        queue_lock.lock();
+        queue.busy = false;
+        queue.drained.notify_all();
+    }
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
@@ -673,24 +825,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUt
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                     VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
-    std::ostringstream msg_buffer;
-    char msg_severity[30];
-    char msg_type[30];
-
-    PrintMessageSeverity(message_severity, msg_severity);
-    PrintMessageType(message_type, msg_type);
-
-    msg_buffer << callback_data->pMessageIdName << "(" << msg_severity << " / " << msg_type
-        << "): msgNum: " << callback_data->messageIdNumber << " - " << callback_data->pMessage << "\n";
-    msg_buffer << "    Objects: " << callback_data->objectCount << "\n";
-    for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
-        msg_buffer << "        [" << obj << "] " << std::hex << std::showbase
-            << HandleToUint64(callback_data->pObjects[obj].objectHandle) << ", type: " << std::dec << std::noshowbase
-            << callback_data->pObjects[obj].objectType
-            << ", name: " << (callback_data->pObjects[obj].pObjectName ? callback_data->pObjects[obj].pObjectName : "NULL")
-            << "\n";
-    }
-    const std::string tmp = msg_buffer.str();
+    const std::string tmp = LogFileWriter::FormatText(message_severity, message_type, *callback_data);
     const char *cstr = tmp.c_str();
     fprintf((FILE *)user_data, "%s", cstr);
     fflush((FILE *)user_data);
@@ -702,6 +837,19 @@ VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogCallback(VkDebugUtilsMessageSeverityF
     return false;
 }
 
+VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogFileCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                        VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                        const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                        void *user_data) {
+    static_cast<LogFileWriter *>(user_data)->Write(message_severity, message_type, *callback_data);
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    LOGCONSOLE("%s", LogFileWriter::FormatText(message_severity, message_type, *callback_data).c_str());
+#endif
+
+    return false;
+}
+
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerWin32DebugOutputMsg(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                             VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                             const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
@@ -18,7 +18,9 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -31,6 +33,7 @@
 #include "containers/custom_containers.h"
 #include "generated/vk_layer_dispatch_table.h"
 #include "generated/vk_object_types.h"
+#include "utils/lock_profile.h"
 
 #if defined __ANDROID__
 #include <android/log.h>
@@ -182,16 +185,55 @@ struct Location;
 struct MessageFormatSettings {
     bool display_application_name = false;
     std::string application_name;
+    // Format and deliver messages on a separate thread, LogMsg only has to filter and print the format arguments
+    bool deferred_output = false;
+    // The log_filename file is written in the binary format of LogFileWriter
+    bool binary_log = false;
+};
+
+struct DeferredMessageQueue;
+class LogFileWriter;
+
+// Number of times each message id was logged, for duplicate_message_limit.
+// Lookups are lock free, a message over the limit costs a probe of the table and an atomic load. Ids that don't fit in the
+// table fall back to a locked map.
+class DuplicateMessageCounter {
+  public:
+    DuplicateMessageCounter();
+
+    // Returns true if the message was already logged limit times, otherwise counts it
+    bool CountAndCheckLimit(uint32_t message_id, uint32_t limit);
+    // Returns true if the message was already logged limit times
+    bool IsOverLimit(uint32_t message_id, uint32_t limit) const;
+
+  private:
+    static constexpr uint32_t kSlotCount = 4096;
+    static constexpr uint32_t kMaxProbes = 32;
+    struct Slot {
+        // message id + 1, zero for a free slot
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint32_t> count{0};
+    };
+    Slot *FindSlot(uint32_t message_id, bool insert) const;
+
+    std::unique_ptr<Slot[]> slots_;
+    mutable std::mutex overflow_lock_;
+    vvl::unordered_map<uint32_t, uint32_t> overflow_counts_;
 };
 
 class DebugReport {
   public:
+    DebugReport();
+    ~DebugReport();
+
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
-    // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
+    // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values.
+    // Only written while the instance is created, read without debug_output_mutex afterwards.
     vvl::unordered_set<uint32_t> filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
-    mutable std::mutex debug_output_mutex;
+    using OutputMutex = vvl::ProfiledMutex<std::mutex, vvl::LockSite::DebugOutput>;
+    mutable OutputMutex debug_output_mutex;
     uint32_t duplicate_message_limit = 0;
     const void *instance_pnext_chain{};
     bool force_default_log_callback{false};
@@ -200,8 +242,9 @@ class DebugReport {
 
     void SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo);
     void SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo);
-    std::string GetUtilsObjectNameNoLock(const uint64_t object) const;
-    std::string GetMarkerObjectNameNoLock(const uint64_t object) const;
+    // The object names don't need debug_output_mutex, so formatting handles doesn't serialize the threads being validated
+    std::string GetUtilsObjectName(const uint64_t object) const;
+    std::string GetMarkerObjectName(const uint64_t object) const;
 
     void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks);
     void RemoveDebugUtilsCallback(uint64_t callback);
@@ -221,6 +264,13 @@ class DebugReport {
 
     bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                 const char *format, va_list argptr);
+    // True if a message with these flags and VUID would not be delivered (filtered, no callback wants it, or over the
+    // duplicate limit). Doesn't lock, validation can use it to skip checks whose only outcome is a muted message.
+    bool IsMessageMuted(VkFlags msg_flags, std::string_view vuid_text) const;
+    // Block until every message queued in deferred output mode has been delivered
+    void FlushDeferredMessages();
+    // Writer of the log_filename file, owned by the debug report so it outlives the messenger writing to it
+    LogFileWriter *CreateLogFileWriter(FILE *file);
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -233,19 +283,26 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
-    bool UpdateLogMsgCounts(int32_t vuid_hash) const;
-    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const;
-    bool LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
-                       VkDebugUtilsMessageTypeFlagsEXT type);
-
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
-    mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    // message_id is hash_util::VuidHash of text_vuid, computed once per message by LogMsg
+    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid,
+                     uint32_t message_id) const;
+    bool LogMsgEnabled(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type);
+    void QueueDeferredMessage(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                              uint32_t message_id, std::string &&text);
+    void DeferredOutputThread();
+
+    // Written with debug_output_mutex held, read by LogMsgEnabled without it
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
+    DuplicateMessageCounter duplicate_message_counter;
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
-    vvl::unordered_map<uint64_t, std::string> debug_object_name_map;
-    vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
+    vvl::concurrent_unordered_map<uint64_t, std::string, 4> debug_object_name_map;
+    vvl::concurrent_unordered_map<uint64_t, std::string, 4> debug_utils_object_name_map;
+
+    std::unique_ptr<DeferredMessageQueue> deferred_queue;
+    std::unique_ptr<LogFileWriter> log_file_writer;
 };
 
 template DebugReport *GetLayerDataPtr<DebugReport>(void *data_key, std::unordered_map<void *, DebugReport *> &data_map);
@@ -260,7 +317,9 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(DebugReport *debug_report, bool de
 
 template <typename T>
 static inline void LayerDestroyCallback(DebugReport *debug_report, T callback) {
-    std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
+    // Messages logged before the callback was destroyed still have to reach it
+    debug_report->FlushDeferredMessages();
+    std::unique_lock<DebugReport::OutputMutex> lock(debug_report->debug_output_mutex);
     debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
 }
 
@@ -278,6 +337,12 @@ VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogCallback(VkDebugUtilsMessageSeverityF
                                                     VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data);
 
+// user_data is the LogFileWriter of the log_filename file
+VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogFileCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                        VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                        const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                        void *user_data);
+
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerWin32DebugOutputMsg(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                             VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                             const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
@@ -27,7 +27,7 @@
 
 namespace gpuav {
 
-void BindValidationCmdsCommonDescSet(const LockedSharedPtr<CommandBuffer, WriteLockGuard> &cmd_buffer_state,
+void BindValidationCmdsCommonDescSet(const LockedSharedPtr<CommandBuffer, RecordingWriteLockGuard> &cmd_buffer_state,
                                      VkPipelineBindPoint bind_point, VkPipelineLayout pipeline_layout, uint32_t cmd_index,
                                      uint32_t error_logger_index) {
     assert(cmd_index < cst::indices_count);
@@ -47,6 +47,14 @@ void RestorablePipelineState::Create(vvl::CommandBuffer &cb_state, VkPipelineBin
     LastBound &last_bound = cb_state.lastBound[lv_bind_point];
     if (last_bound.pipeline_state) {
         pipeline_ = last_bound.pipeline_state->VkHandle();
+        // Restore what vkCmdBindPipeline actually bound
+        auto gpuav = static_cast<Validator *>(&cb_state.dev_data);
+        if (gpuav->gpuav_settings.async_pipeline_instrumentation) {
+            if (const VkPipeline instrumented_pipeline = gpuav->GetInstrumentedPipeline(pipeline_);
+                instrumented_pipeline != VK_NULL_HANDLE) {
+                pipeline_ = instrumented_pipeline;
+            }
+        }
 
     } else {
         assert(shader_objects_.empty());
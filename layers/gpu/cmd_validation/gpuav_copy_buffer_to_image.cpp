@@ -48,7 +48,8 @@ struct SharedCopyBufferToImageValidationResources final {
             return;
         }
 
-        // Allocate buffer memory pool that will be used to create the buffers holding copy regions
+        // Allocate buffer memory pool that will be used to create the buffers holding copy regions too large for the command
+        // buffer chunks
         VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         buffer_info.size = 4096;  // Dummy value
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
@@ -178,7 +179,7 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Vk
     uint32_t max_texels_count_in_regions = copy_buffer_to_img_info->pRegions[0].imageExtent.width *
                                            copy_buffer_to_img_info->pRegions[0].imageExtent.height *
                                            copy_buffer_to_img_info->pRegions[0].imageExtent.depth;
-    gpu::DeviceMemoryBlock copy_src_regions_mem_block;
+    gpu::BufferRange copy_src_regions;
     {
         // Needs to be kept in sync with copy_buffer_to_image.comp
         struct BufferImageCopy {
@@ -193,39 +194,42 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Vk
             uint32_t image_extent[4];
         };
 
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         const VkDeviceSize uniform_block_constants_byte_size = (4 +  // image extent
                                                                 1 +  // block size
                                                                 1 +  // gpu copy regions count
                                                                 2    // pad
                                                                 ) *
                                                                sizeof(uint32_t);
-        buffer_info.size = uniform_block_constants_byte_size + sizeof(BufferImageCopy) * copy_buffer_to_img_info->regionCount;
-        buffer_info.usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-        uint32_t mem_type_index = 0;
-        vmaFindMemoryTypeIndexForBufferInfo(gpuav.vma_allocator_, &buffer_info, &alloc_info, &mem_type_index);
-
-        alloc_info.pool = shared_copy_validation_resources.copy_regions_pool;
-        VkResult result = vmaCreateBuffer(gpuav.vma_allocator_, &buffer_info, &alloc_info, &copy_src_regions_mem_block.buffer,
-                                          &copy_src_regions_mem_block.allocation, nullptr);
-        if (result != VK_SUCCESS) {
+        const VkDeviceSize copy_src_regions_byte_size =
+            uniform_block_constants_byte_size + sizeof(BufferImageCopy) * copy_buffer_to_img_info->regionCount;
+        // Depth texture streaming records hundreds of these copies per frame, so the regions come out of the command buffer
+        // chunks instead of being their own VMA allocation. Only the copies with more regions than a chunk holds need one
+        if (copy_src_regions_byte_size <= gpuav.cmd_buffer_chunk_pool_->ChunkSize()) {
+            copy_src_regions = cb_state->per_command_allocator.Allocate(copy_src_regions_byte_size);
+        } else {
+            VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+            buffer_info.size = copy_src_regions_byte_size;
+            buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+            VmaAllocationCreateInfo alloc_info = {};
+            alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+            alloc_info.pool = shared_copy_validation_resources.copy_regions_pool;
+            gpu::DeviceMemoryBlock copy_src_regions_mem_block;
+            VmaAllocationInfo alloc_result = {};
+            if (vmaCreateBuffer(gpuav.vma_allocator_, &buffer_info, &alloc_info, &copy_src_regions_mem_block.buffer,
+                                &copy_src_regions_mem_block.allocation, &alloc_result) == VK_SUCCESS) {
+                cb_state->gpu_resources_manager.ManageDeviceMemoryBlock(copy_src_regions_mem_block);
+                copy_src_regions.buffer = copy_src_regions_mem_block.buffer;
+                copy_src_regions.size = copy_src_regions_byte_size;
+                copy_src_regions.mapped_ptr = alloc_result.pMappedData;
+            }
+        }
+        if (copy_src_regions.IsNull()) {
             gpuav.InternalError(cmd_buffer, loc, "Unable to allocate device memory for GPU copy of pRegions. Aborting GPU-AV.",
                                 true);
             return;
         }
-        cb_state->gpu_resources_manager.ManageDeviceMemoryBlock(copy_src_regions_mem_block);
 
-        uint32_t *gpu_regions_u32_ptr = nullptr;
-        result = vmaMapMemory(gpuav.vma_allocator_, copy_src_regions_mem_block.allocation,
-                              reinterpret_cast<void **>(&gpu_regions_u32_ptr));
-
-        if (result != VK_SUCCESS) {
-            gpuav.InternalError(cmd_buffer, loc, "Unable to map device memory for GPU copy of pRegions. Aborting GPU-AV.", true);
-            return;
-        }
+        auto *gpu_regions_u32_ptr = static_cast<uint32_t *>(copy_src_regions.mapped_ptr);
 
         const uint32_t block_size = image_state->create_info.format == VK_FORMAT_D32_SFLOAT ? 4 : 5;
         uint32_t gpu_regions_count = 0;
@@ -270,7 +274,6 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Vk
 
         if (gpu_regions_count == 0) {
             // Nothing to validate
-            vmaUnmapMemory(gpuav.vma_allocator_, copy_src_regions_mem_block.allocation);
             return;
         }
 
@@ -282,8 +285,6 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Vk
         gpu_regions_u32_ptr[5] = gpu_regions_count;
         gpu_regions_u32_ptr[6] = 0;
         gpu_regions_u32_ptr[7] = 0;
-
-        vmaUnmapMemory(gpuav.vma_allocator_, copy_src_regions_mem_block.allocation);
     }
 
     // Update descriptor set
@@ -302,9 +303,9 @@ void InsertCopyBufferToImageValidation(Validator &gpuav, const Location &loc, Vk
         descriptor_buffer_infos[0].offset = 0;
         descriptor_buffer_infos[0].range = VK_WHOLE_SIZE;
         // Copy regions buffer
-        descriptor_buffer_infos[1].buffer = copy_src_regions_mem_block.buffer;
-        descriptor_buffer_infos[1].offset = 0;
-        descriptor_buffer_infos[1].range = VK_WHOLE_SIZE;
+        descriptor_buffer_infos[1].buffer = copy_src_regions.buffer;
+        descriptor_buffer_infos[1].offset = copy_src_regions.offset;
+        descriptor_buffer_infos[1].range = copy_src_regions.size;
 
         std::array<VkWriteDescriptorSet, descriptor_buffer_infos.size()> desc_writes = {};
         for (const auto [i, desc_buffer_info] : vvl::enumerate(descriptor_buffer_infos.data(), descriptor_buffer_infos.size())) {
@@ -192,6 +192,46 @@ void DestroyRenderPassMappedResources(Validator &gpuav, VkRenderPass render_pass
     }
 }
 
+// Draws sourcing their parameters from the same buffers share one descriptor set for the whole command buffer,
+// only the push constants and the error logger index change from one validated draw to the next.
+static VkDescriptorSet GetDrawValidationDescriptorSet(Validator &gpuav, CommandBuffer &cb_state,
+                                                      SharedDrawValidationResources &shared_draw_resources,
+                                                      VkBuffer indirect_buffer, VkBuffer count_buffer) {
+    auto &count_buffer_to_desc_set = cb_state.draw_validation_desc_sets[indirect_buffer];
+    for (const auto &[cached_count_buffer, cached_desc_set] : count_buffer_to_desc_set) {
+        if (cached_count_buffer == count_buffer) {
+            return cached_desc_set;
+        }
+    }
+
+    const VkDescriptorSet draw_validation_desc_set =
+        cb_state.gpu_resources_manager.GetManagedDescriptorSet(shared_draw_resources.ds_layout);
+    if (draw_validation_desc_set == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+    }
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos;
+    buffer_infos.emplace_back(VkDescriptorBufferInfo{indirect_buffer, 0, VK_WHOLE_SIZE});
+    if (count_buffer) {
+        buffer_infos.emplace_back(VkDescriptorBufferInfo{count_buffer, 0, VK_WHOLE_SIZE});
+    }
+
+    std::vector<VkWriteDescriptorSet> desc_writes{};
+    for (size_t i = 0; i < buffer_infos.size(); ++i) {
+        VkWriteDescriptorSet &desc_write = desc_writes.emplace_back();
+        desc_write = vku::InitStructHelper();
+        desc_write.dstBinding = uint32_t(i);
+        desc_write.descriptorCount = 1;
+        desc_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        desc_write.pBufferInfo = &buffer_infos[i];
+        desc_write.dstSet = draw_validation_desc_set;
+    }
+    DispatchUpdateDescriptorSets(gpuav.device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, NULL);
+
+    count_buffer_to_desc_set.emplace_back(count_buffer, draw_validation_desc_set);
+    return draw_validation_desc_set;
+}
+
 void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, VkCommandBuffer cmd_buffer, VkBuffer indirect_buffer,
                                   VkDeviceSize indirect_offset, uint32_t draw_count, VkBuffer count_buffer,
                                   VkDeviceSize count_buffer_offset, uint32_t stride) {
@@ -228,31 +268,13 @@ void InsertIndirectDrawValidation(Validator &gpuav, const Location &loc, VkComma
         }
     }
 
-    const VkDescriptorSet draw_validation_desc_set =
-        cb_state->gpu_resources_manager.GetManagedDescriptorSet(shared_draw_resources.ds_layout);
+    const VkDescriptorSet draw_validation_desc_set = GetDrawValidationDescriptorSet(gpuav, *cb_state, shared_draw_resources,
+                                                                                    indirect_buffer, count_buffer);
     if (draw_validation_desc_set == VK_NULL_HANDLE) {
         gpuav.InternalError(cmd_buffer, loc, "Unable to allocate descriptor set. Aborting GPU-AV.");
         return;
     }
 
-    std::vector<VkDescriptorBufferInfo> buffer_infos;
-    buffer_infos.emplace_back(VkDescriptorBufferInfo{indirect_buffer, 0, VK_WHOLE_SIZE});
-    if (count_buffer) {
-        buffer_infos.emplace_back(VkDescriptorBufferInfo{count_buffer, 0, VK_WHOLE_SIZE});
-    }
-
-    std::vector<VkWriteDescriptorSet> desc_writes{};
-    for (size_t i = 0; i < buffer_infos.size(); ++i) {
-        VkWriteDescriptorSet &desc_write = desc_writes.emplace_back();
-        desc_write = vku::InitStructHelper();
-        desc_write.dstBinding = uint32_t(i);
-        desc_write.descriptorCount = 1;
-        desc_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        desc_write.pBufferInfo = &buffer_infos[i];
-        desc_write.dstSet = draw_validation_desc_set;
-    }
-    DispatchUpdateDescriptorSets(gpuav.device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, NULL);
-
     // Insert a draw that can examine some device memory right before the draw we're validating (Pre Draw Validation)
     //
     // NOTE that this validation does not attempt to abort invalid api calls as most other validation does. A crash
@@ -25,10 +25,19 @@ struct GpuAVSettings {
     bool validate_descriptors = true;
     bool warn_on_robust_oob = true;
     bool validate_bda = true;
+    // Minimum number of ranges reserved in each command buffer buffer device address table
     uint32_t max_bda_in_use = 10000;
     bool validate_ray_query = true;
     bool cache_instrumented_shaders = true;
     bool select_instrumented_shaders = false;
+    // Instrument shader modules on a worker thread, the first pipeline using the module waits for it
+    bool async_shader_instrumentation = false;
+    // With async_shader_instrumentation, pipelines don't wait either: they are created with the original shaders and an
+    // instrumented variant is created on a worker thread, then bound in their place once ready
+    bool async_pipeline_instrumentation = false;
+    // After a submission, only the first error record of each command, shader instruction and error is decoded and logged. The
+    // same error from other invocations is dropped.
+    bool deduplicate_errors = false;
 
     bool buffers_validation_enabled = true;
     bool validate_indirect_draws_buffers = true;
@@ -51,6 +60,8 @@ struct GpuAVSettings {
         // Because of those 2 settings, cannot really have an "enabled" parameter to pass to this method
         cache_instrumented_shaders = false;
         select_instrumented_shaders = false;
+        async_shader_instrumentation = false;
+        async_pipeline_instrumentation = false;
     }
     bool IsBufferValidationEnabled() const {
         return validate_indirect_draws_buffers || validate_indirect_dispatches_buffers || validate_indirect_trace_rays_buffers ||
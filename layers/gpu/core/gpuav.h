@@ -20,6 +20,7 @@
 #include "gpu/descriptor_validation/gpuav_descriptor_set.h"
 #include "gpu/resources/gpu_resources.h"
 #include "gpu/instrumentation/gpu_shader_instrumentor.h"
+#include "gpu/spirv/link.h"
 
 #include <unordered_map>
 #include <memory>
@@ -336,9 +337,14 @@ class Validator : public gpu::GpuShaderInstrumentor {
     std::optional<DescriptorHeap> desc_heap_{};  // optional only to defer construction
     gpu::SharedResourcesManager shared_resources_manager;
     bool bda_validation_possible = false;
+    // Bumped every time a queue retires a batch. The GPU may have marked more descriptors as used in the descriptor set output
+    // states since a scan done with an older value.
+    std::atomic<uint64_t> retired_batches_{0};
 
   private:
     std::string instrumented_shader_cache_path_{};
+    // The instrumentation functions linked into the shaders, parsed once for the device
+    spirv::LinkLibraryCache link_libraries_;
 };
 
 }  // namespace gpuav
@@ -16,7 +16,6 @@
  */
 
 #include <cmath>
-#include <fstream>
 #include "utils/cast_utils.h"
 #include "state_tracker/shader_stage_state.h"
 #include "utils/hash_util.h"
@@ -106,6 +105,11 @@ void Validator::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderM
     } else {
         shader_id = unique_shader_module_id_++;
     }
+    if (StartAsyncInstrumentation(chassis_state.module_state, shader_id, record_obj.location)) {
+        // The driver gets the original SPIR-V, pipelines using this module will swap in the instrumented one
+        chassis_state.unique_shader_id = shader_id;
+        return;
+    }
     const bool pass = InstrumentShader(vvl::make_span(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)), shader_id,
                                        record_obj.location, chassis_state.instrumented_spirv);
     if (pass) {
@@ -127,10 +131,10 @@ void Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createIn
         if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfos[i].pNext)) continue;
         if (gpuav_settings.cache_instrumented_shaders) {
             const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
-            if (instrumented_shaders_cache_.IsSpirvCached(i, chassis_state.unique_shader_ids[i], chassis_state)) {
+            chassis_state.unique_shader_ids[i] = shader_hash;
+            if (instrumented_shaders_cache_.IsSpirvCached(i, shader_hash, chassis_state)) {
                 continue;
             }
-            chassis_state.unique_shader_ids[i] = shader_hash;
         } else {
             chassis_state.unique_shader_ids[i] = unique_shader_module_id_++;
         }
@@ -154,22 +158,10 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
 
     shared_resources_manager.Clear();
 
-    if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders_cache_.IsEmpty()) {
-        std::ofstream file_stream(instrumented_shader_cache_path_, std::ofstream::out | std::ofstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings);
-            file_stream.write(reinterpret_cast<const char *>(&shader_cache_hash), sizeof(shader_cache_hash));
-            uint32_t datasize = static_cast<uint32_t>(instrumented_shaders_cache_.spirv_shaders_.size());
-            file_stream.write(reinterpret_cast<char *>(&datasize), sizeof(uint32_t));
-            for (auto &record : instrumented_shaders_cache_.spirv_shaders_) {
-                // Hash of shader
-                file_stream.write(reinterpret_cast<const char *>(&record.first), sizeof(uint32_t));
-                const size_t spirv_dwords_count = record.second.size();
-                file_stream.write(reinterpret_cast<const char *>(&spirv_dwords_count), sizeof(uint32_t));
-                file_stream.write(reinterpret_cast<const char *>(record.second.data()), spirv_dwords_count * sizeof(uint32_t));
-            }
-            file_stream.close();
-        }
+    // Background instrumentations still add to the cache
+    FinishAsyncInstrumentations();
+    if (gpuav_settings.cache_instrumented_shaders) {
+        instrumented_shaders_cache_.Save();
     }
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
@@ -254,6 +246,14 @@ void Validator::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkP
                                               VkPipeline pipeline, const RecordObject &record_obj) {
     BaseClass::PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
 
+    if (gpuav_settings.async_pipeline_instrumentation) {
+        // Swap in the instrumented variant, state tracking keeps pointing at the application pipeline
+        const VkPipeline instrumented_pipeline = GetInstrumentedPipeline(pipeline);
+        if (instrumented_pipeline != VK_NULL_HANDLE) {
+            DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, instrumented_pipeline);
+        }
+    }
+
     UpdateBoundPipeline(*this, commandBuffer, pipelineBindPoint, pipeline, record_obj.location);
 }
 
@@ -15,8 +15,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
-#include <fstream>
+#include <thread>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
 #include <unistd.h>
 #endif
@@ -243,29 +244,56 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
         desc_heap_.emplace(*this, num_descs);
     }
 
-    VkBufferCreateInfo error_buffer_ci = vku::InitStructHelper();
-    error_buffer_ci.size = glsl::kErrorBufferByteSize;
-    error_buffer_ci.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_create_info = {};
-    alloc_create_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    uint32_t mem_type_index;
-    VkResult result = vmaFindMemoryTypeIndexForBufferInfo(vma_allocator_, &error_buffer_ci, &alloc_create_info, &mem_type_index);
-    if (result != VK_SUCCESS) {
-        InternalError(device, loc, "Unable to find memory type index. Aborting GPU-AV.");
-        return;
+    // Every class of internal buffers gets its own pool of fixed size blocks, with a memory type matching how it is accessed
+    {
+        // Read back on the CPU after every submission, cached memory makes those reads cheap
+        VmaAllocationCreateInfo alloc_create_info = {};
+        alloc_create_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        alloc_create_info.preferredFlags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        // Holds the error output buffers of a few dozen command buffers
+        constexpr VkDeviceSize kOutputBlockSize = 8 * 1024 * 1024;
+        const VmaPoolCreateFlags flags = gpuav_settings.vma_linear_output ? VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT : 0;
+        if (output_buffer_pool_.Create(vma_allocator_, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, alloc_create_info, kOutputBlockSize,
+                                       flags) != VK_SUCCESS) {
+            InternalError(device, loc, "Unable to create VMA memory pool. Aborting GPU-AV.");
+            return;
+        }
     }
-    VmaPoolCreateInfo vma_pool_ci = {};
-    vma_pool_ci.memoryTypeIndex = mem_type_index;
-    vma_pool_ci.blockSize = 0;
-    vma_pool_ci.maxBlockCount = 0;
-    if (gpuav_settings.vma_linear_output) {
-        vma_pool_ci.flags = VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
+    {
+        // Only written on the CPU, and flushed manually
+        VmaAllocationCreateInfo alloc_create_info = {};
+        alloc_create_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        constexpr VkDeviceSize kDescriptorStateBlockSize = 16 * 1024 * 1024;
+        const VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        if (descriptor_state_pool_.Create(vma_allocator_, usage, alloc_create_info, kDescriptorStateBlockSize) != VK_SUCCESS) {
+            InternalError(device, loc, "Unable to create VMA memory pool for descriptor state. Aborting GPU-AV.");
+            return;
+        }
+        if (gpuav_settings.validate_bda) {
+            constexpr VkDeviceSize kBdaRangesBlockSize = 4 * 1024 * 1024;
+            if (bda_ranges_pool_.Create(vma_allocator_, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, alloc_create_info,
+                                        kBdaRangesBlockSize) != VK_SUCCESS) {
+                InternalError(device, loc, "Unable to create VMA memory pool for buffer device address ranges. Aborting GPU-AV.");
+                return;
+            }
+        }
     }
-    result = vmaCreatePool(vma_allocator_, &vma_pool_ci, &output_buffer_pool_);
-    if (result != VK_SUCCESS) {
-        InternalError(device, loc, "Unable to create VMA memory pool. Aborting GPU-AV.");
-        return;
+
+    // Enough for a few hundred draws worth of bindless state per chunk
+    constexpr VkDeviceSize kCmdBufferChunkSize = 256 * 1024;
+    {
+        // Only written on the CPU, so write combined memory is fine
+        VmaAllocationCreateInfo alloc_create_info = {};
+        alloc_create_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        if (cmd_buffer_chunk_memory_pool_.Create(vma_allocator_, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, alloc_create_info,
+                                                 16 * kCmdBufferChunkSize) != VK_SUCCESS) {
+            InternalError(device, loc, "Unable to create VMA memory pool for command buffers data. Aborting GPU-AV.");
+            return;
+        }
     }
+    cmd_buffer_chunk_pool_ = std::make_unique<gpu::BufferChunkPool>(vma_allocator_, kCmdBufferChunkSize,
+                                                                    phys_dev_props.limits.minStorageBufferOffsetAlignment,
+                                                                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &cmd_buffer_chunk_memory_pool_);
 
     if (gpuav_settings.cache_instrumented_shaders) {
         auto tmp_path = GetTempFilePath();
@@ -275,27 +303,15 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
 #endif
         instrumented_shader_cache_path_ += ".bin";
 
-        std::ifstream file_stream(instrumented_shader_cache_path_, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings);
-            char inst_shader_hash[sizeof(shader_cache_hash)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (std::memcmp(inst_shader_hash, reinterpret_cast<char *>(&shader_cache_hash), sizeof(shader_cache_hash)) == 0) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t spirv_dwords_count;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&spirv_dwords_count), sizeof(uint32_t));
-                    shader_code.resize(spirv_dwords_count);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * spirv_dwords_count);
-                    instrumented_shaders_cache_.Add(hash, std::move(shader_code));
-                }
-            }
-            file_stream.close();
-        }
+        // Shaders instrumented with other settings or by another version of the instrumentation are not reused
+        const ShaderCacheHash shader_cache_hash(gpuav_settings);
+        instrumented_shaders_cache_.Load(instrumented_shader_cache_path_, &shader_cache_hash, sizeof(shader_cache_hash));
+    }
+
+    if (gpuav_settings.async_shader_instrumentation) {
+        // Leave half of the cores to the application, it is usually busy loading at the same time
+        const uint32_t worker_count = std::max(1u, std::thread::hardware_concurrency() / 2);
+        instrumentation_pool_ = vvl::WorkerPool::Shared(worker_count);
     }
 
     // Create command indices buffer
@@ -304,11 +320,10 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
         buffer_info.size = cst::indices_count * sizeof(uint32_t);
         VmaAllocationCreateInfo alloc_info = {};
-        assert(output_buffer_pool_);
-        alloc_info.pool = output_buffer_pool_;
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        result = vmaCreateBuffer(vma_allocator_, &buffer_info, &alloc_info, &indices_buffer_.buffer, &indices_buffer_.allocation,
-                                 nullptr);
+        output_buffer_pool_.Select(alloc_info, buffer_info.size);
+        VkResult result = vmaCreateBuffer(vma_allocator_, &buffer_info, &alloc_info, &indices_buffer_.buffer,
+                                          &indices_buffer_.allocation, nullptr);
         if (result != VK_SUCCESS) {
             InternalError(device, loc, "Unable to allocate device memory for command indices. Aborting GPU-AV.", true);
             return;
@@ -17,10 +17,13 @@
 
 #include "gpu/debug_printf/debug_printf.h"
 #include "spirv-tools/instrument.hpp"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include "generated/layer_chassis_dispatch.h"
 #include "state_tracker/shader_stage_state.h"
 #include "chassis/chassis_modification_state.h"
+#include "utils/trace_markers.h"
 
 namespace debug_printf {
 
@@ -40,13 +43,6 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
     verbose = printf_settings.verbose;
     use_stdout = printf_settings.to_stdout;
 
-    // This option was published when Debug PrintF came out, leave to not break people's flow
-    // Deprecated right after the 1.3.280 SDK release
-    if (!GetEnvironment("DEBUG_PRINTF_TO_STDOUT").empty()) {
-        InternalWarning(device, loc, "DEBUG_PRINTF_TO_STDOUT was set, this is deprecated, please use VK_LAYER_PRINTF_TO_STDOUT");
-        use_stdout = true;
-    }
-
     const uint32_t kDebugOutputPrintfStream = 3;  // from instrument.hpp
     VkDescriptorSetLayoutBinding binding = {kDebugOutputPrintfStream, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
                                             kShaderStageAllGraphics | VK_SHADER_STAGE_COMPUTE_BIT | kShaderStageAllRayTracing,
@@ -70,11 +66,18 @@ void Validator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
         InternalError(device, loc, "Debug Printf requires vertexPipelineStoresAndAtomics.");
         return;
     }
+
+    // Every action command gets its own printf_buffer_size output block, carve them out of large mapped chunks instead of
+    // creating and mapping a buffer per command
+    const VkDeviceSize alignment = phys_dev_props.limits.minStorageBufferOffsetAlignment;
+    const VkDeviceSize output_block_size = (printf_settings.buffer_size + alignment - 1) / alignment * alignment;
+    constexpr VkDeviceSize kMinChunkSize = 256 * 1024;
+    cmd_buffer_chunk_pool_ = std::make_unique<gpu::BufferChunkPool>(vma_allocator_, std::max(kMinChunkSize, output_block_size),
+                                                                    alignment, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
 }
 
-// Free the device memory and descriptor set associated with a command buffer.
+// Free the descriptor set associated with a command buffer, the output block goes away with CommandBuffer::output_allocator
 void Validator::DestroyBuffer(BufferInfo &buffer_info) {
-    vmaDestroyBuffer(vma_allocator_, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
     if (buffer_info.desc_set != VK_NULL_HANDLE) {
         desc_set_manager_->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
     }
@@ -84,6 +87,8 @@ void Validator::DestroyBuffer(BufferInfo &buffer_info) {
 bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, uint32_t unique_shader_id, const Location &loc,
                                  std::vector<uint32_t> &out_instrumented_spirv) {
     if (input[0] != spv::MagicNumber) return false;
+    VVL_TRACE_SCOPE("debug_printf::Validator::InstrumentShader");
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::DebugPrintfInstrumentation);
 
     // Load original shader SPIR-V
     out_instrumented_spirv.clear();
@@ -120,6 +125,8 @@ bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, uint32_
         optimizer.Run(out_instrumented_spirv.data(), out_instrumented_spirv.size(), &out_instrumented_spirv, opt_options);
     if (!pass) {
         InternalError(device, loc, "Failure to instrument shader in spirv-opt. Proceeding with non-instrumented shader.");
+    } else if (auto format_strings = ParseShaderFormatStrings(input)) {
+        shader_format_strings_.insert_or_assign(unique_shader_id, std::move(format_strings));
     }
     return pass;
 }
@@ -256,18 +263,54 @@ std::vector<Substring> Validator::ParseFormatString(const std::string &format_st
             begin = pos + 1;
         }
     }
+
+    // Unsigned 64 bit values
+    for (Substring &substring : parsed_strings) {
+        for (const char *ul_string : {"%ul", "%lu", "%lx"}) {
+            const size_t ul_pos = substring.string.find(ul_string);
+            if (ul_pos != std::string::npos) {
+                substring.string.replace(ul_pos + 1, 2, ul_string[2] == 'u' ? PRIu64 : PRIx64);
+                substring.is_64bit = true;
+                break;
+            }
+        }
+    }
     return parsed_strings;
 }
 
-std::string Validator::FindFormatString(const std::vector<spirv::Instruction> &instructions, uint32_t string_id) {
-    std::string format_string;
-    for (const spirv::Instruction &insn : instructions) {
-        if (insn.Opcode() == spv::OpString && insn.Word(1) == string_id) {
-            format_string = insn.GetAsString(2);
+std::shared_ptr<const ShaderFormatStrings> Validator::ParseShaderFormatStrings(const vvl::span<const uint32_t> &spirv) {
+    // The OpString are in the debug section, before the NonSemantic.DebugPrintf instructions using them
+    vvl::unordered_map<uint32_t, const char *> strings;
+    uint32_t printf_set_id = 0;
+    std::shared_ptr<ShaderFormatStrings> format_strings;
+    if (spirv.size() <= 5) {
+        return format_strings;
+    }
+    for (const uint32_t *it = spirv.data() + 5, *end = spirv.data() + spirv.size(); it < end;) {
+        const uint32_t length = *it >> 16;
+        if (length == 0 || length > uint32_t(end - it)) {
             break;
         }
+        const uint32_t opcode = *it & 0x0ffffu;
+        if (opcode == spv::OpString && length >= 3) {
+            strings.emplace(it[1], reinterpret_cast<const char *>(&it[2]));
+        } else if (opcode == spv::OpExtInstImport && length >= 3 &&
+                   strcmp(reinterpret_cast<const char *>(&it[2]), "NonSemantic.DebugPrintf") == 0) {
+            printf_set_id = it[1];
+        } else if (opcode == spv::OpExtInst && length >= 6 && printf_set_id != 0 && it[3] == printf_set_id) {
+            // Operands are the format string ID, then the values
+            const uint32_t string_id = it[5];
+            auto string_it = strings.find(string_id);
+            if (string_it != strings.end() && (!format_strings || format_strings->count(string_id) == 0)) {
+                if (!format_strings) {
+                    format_strings = std::make_shared<ShaderFormatStrings>();
+                }
+                format_strings->emplace(string_id, ParseFormatString(string_it->second));
+            }
+        }
+        it += length;
     }
-    return format_string;
+    return format_strings;
 }
 
 // GCC and clang don't like using variables as format strings in sprintf.
@@ -304,46 +347,34 @@ void Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueu
         }
 
         // without the instrumented spirv, there is nothing valuable to print out
-        if (!tracker_info || tracker_info->instrumented_spirv.empty()) {
+        if (!tracker_info || !tracker_info->instrumented_spirv || tracker_info->instrumented_spirv->empty()) {
             InternalWarning(queue, loc, "Can't find instructions from any handles in shader_map");
             return;
         }
 
-        std::vector<spirv::Instruction> instructions;
-        spirv::GenerateInstructions(tracker_info->instrumented_spirv, instructions);
-
-        // Search through the shader source for the printf format string for this invocation
-        const std::string format_string = FindFormatString(instructions, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
+        // The format string of this invocation, already broken into strings with 1 or 0 value
+        static const std::vector<Substring> kNoSubstrings;
+        const std::vector<Substring> *format_substrings = &kNoSubstrings;
+        auto format_strings_it = shader_format_strings_.find(debug_record->shader_id);
+        if (format_strings_it != shader_format_strings_.end()) {
+            auto substrings_it = format_strings_it->second->find(debug_record->format_string_id);
+            if (substrings_it != format_strings_it->second->end()) {
+                format_substrings = &substrings_it->second;
+            }
+        }
         void *values = static_cast<void *>(&debug_record->values);
         // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
+        for (const Substring &substring : *format_substrings) {
             std::string temp_string;
             size_t needed = 0;
-            std::vector<std::string> format_strings = {"%ul", "%lu", "%lx"};
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (const auto &ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
-                }
-            }
-            if (ul_pos != std::string::npos) {
+            if (substring.is_64bit) {
                 // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
+                const uint64_t longval = *static_cast<uint64_t *>(values);
                 values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
-                }
                 // +1 for null terminator
-                needed = std::snprintf(nullptr, 0, substring.string.c_str(), substring.longval) + 1;
+                needed = std::snprintf(nullptr, 0, substring.string.c_str(), longval) + 1;
                 temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str(), substring.longval);
+                std::snprintf(&temp_string[0], needed, substring.string.c_str(), longval);
             } else {
                 if (substring.needs_value) {
                     switch (substring.type) {
@@ -378,7 +409,7 @@ void Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueu
 
         if (verbose) {
             std::string debug_info_message =
-                GenerateDebugInfoMessage(command_buffer, instructions, debug_record->instruction_position, tracker_info,
+                GenerateDebugInfoMessage(command_buffer, debug_record->instruction_position, tracker_info,
                                          buffer_info.pipeline_bind_point, operation_index);
             if (use_stdout) {
                 std::cout << "WARNING-DEBUG-PRINTF " << shader_message.str() << "\n" << debug_info_message;
@@ -396,14 +427,22 @@ void Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueu
         }
         index += debug_record->size;
     }
-    if ((index - spvtools::kDebugOutputDataOffset) != expect) {
-        InternalWarning(queue, loc,
-                        "Debug Printf message was truncated, likely due to a buffer size that was too small for the message");
+    const uint32_t written = index - spvtools::kDebugOutputDataOffset;
+    if (written != expect) {
+        // Once a message does not fit, every following one is dropped too
+        std::stringstream ss;
+        ss << "Debug Printf dropped " << (expect - written) * sizeof(uint32_t) << " of " << expect * sizeof(uint32_t)
+           << " bytes of messages because the buffer is too small, printf_buffer_size is " << printf_settings.buffer_size
+           << " and this command needed at least " << (expect + spvtools::kDebugOutputDataOffset) * sizeof(uint32_t) << ".";
+        InternalWarning(queue, loc, ss.str().c_str());
     }
-    memset(debug_output_buffer, 0, 4 * (debug_output_buffer[spvtools::kDebugOutputSizeOffset] + spvtools::kDebugOutputDataOffset));
+    // The size word counts what the shaders attempted to write, which can go past the end of the buffer
+    const size_t clear_size = std::min(size_t(printf_settings.buffer_size),
+                                       sizeof(uint32_t) * (size_t(expect) + spvtools::kDebugOutputDataOffset));
+    memset(debug_output_buffer, 0, clear_size);
 }
 
-// For the given command buffer, map its debug data buffers and read their contents for analysis.
+// For the given command buffer, read the contents of its (persistently mapped) debug data buffers for analysis.
 void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     auto *device_state = static_cast<Validator *>(&dev_data);
     if (has_draw_cmd || has_trace_rays_cmd || has_dispatch_cmd) {
@@ -413,8 +452,6 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *data;
-
             uint32_t operation_index = 0;
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 operation_index = draw_index;
@@ -429,11 +466,8 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(device_state->vma_allocator_, buffer_info.output_mem_block.allocation, (void **)&data);
-            if (result == VK_SUCCESS) {
-                device_state->AnalyzeAndGenerateMessage(VkHandle(), queue, buffer_info, operation_index, (uint32_t *)data, loc);
-                vmaUnmapMemory(device_state->vma_allocator_, buffer_info.output_mem_block.allocation);
-            }
+            auto *data = static_cast<uint32_t *>(buffer_info.output_range.mapped_ptr);
+            device_state->AnalyzeAndGenerateMessage(VkHandle(), queue, buffer_info, operation_index, data, loc);
         }
     }
 }
@@ -649,32 +683,22 @@ void Validator::AllocateDebugPrintfResources(const VkCommandBuffer cmd_buffer, c
     }
 
     // Allocate memory for the output block that the gpu will use to return values for printf
-    DeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = printf_settings.buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    result = vmaCreateBuffer(vma_allocator_, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
-    if (result != VK_SUCCESS) {
+    const gpu::BufferRange output_block = cb_state->output_allocator.Allocate(printf_settings.buffer_size);
+    if (output_block.IsNull()) {
+        desc_set_manager_->PutBackDescriptorSet(desc_pool, desc_sets[0]);
         InternalError(cmd_buffer, loc, "Unable to allocate device memory.");
         return;
     }
 
     // Clear the output block to zeros so that only printf values from the gpu will be present
-    uint32_t *data;
-    result = vmaMapMemory(vma_allocator_, output_block.allocation, reinterpret_cast<void **>(&data));
-    if (result == VK_SUCCESS) {
-        memset(data, 0, printf_settings.buffer_size);
-        vmaUnmapMemory(vma_allocator_, output_block.allocation);
-    }
+    memset(output_block.mapped_ptr, 0, printf_settings.buffer_size);
 
     VkWriteDescriptorSet desc_writes = vku::InitStructHelper();
     const uint32_t desc_count = 1;
 
     // Write the descriptor
     output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.offset = output_block.offset;
 
     desc_writes.descriptorCount = 1;
     desc_writes.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -716,7 +740,7 @@ std::shared_ptr<vvl::CommandBuffer> Validator::CreateCmdBufferState(VkCommandBuf
 
 CommandBuffer::CommandBuffer(Validator &dp, VkCommandBuffer handle, const VkCommandBufferAllocateInfo *pCreateInfo,
                              const vvl::CommandPool *pool)
-    : gpu_tracker::CommandBuffer(dp, handle, pCreateInfo, pool) {}
+    : gpu_tracker::CommandBuffer(dp, handle, pCreateInfo, pool), output_allocator(dp.cmd_buffer_chunk_pool_.get()) {}
 
 CommandBuffer::~CommandBuffer() { Destroy(); }
 
@@ -737,6 +761,7 @@ void CommandBuffer::ResetCBState() {
         debug_printf->DestroyBuffer(buffer_info);
     }
     buffer_infos.clear();
+    output_allocator.Reset();
 }
 
 }  // namespace debug_printf
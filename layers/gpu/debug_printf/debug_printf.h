@@ -24,28 +24,28 @@ namespace debug_printf {
 
 class Validator;
 
-struct DeviceMemoryBlock {
-    VkBuffer buffer;
-    VmaAllocation allocation;
-};
-
 struct BufferInfo {
-    DeviceMemoryBlock output_mem_block;
+    // Suballocated from CommandBuffer::output_allocator
+    gpu::BufferRange output_range;
     VkDescriptorSet desc_set;
     VkDescriptorPool desc_pool;
     VkPipelineBindPoint pipeline_bind_point;
-    BufferInfo(DeviceMemoryBlock output_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
+    BufferInfo(gpu::BufferRange output_range, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
                VkPipelineBindPoint pipeline_bind_point)
-        : output_mem_block(output_mem_block), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
+        : output_range(output_range), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
 };
 
 enum vartype { varsigned, varunsigned, varfloat };
+// Piece of a format string with at most one value, ready to be passed to snprintf
 struct Substring {
     std::string string;
     bool needs_value;
     vartype type;
-    uint64_t longval = 0;
+    // %ul, %lu and %lx were already replaced by the PRIx64/PRIu64 of the platform, the value takes 2 words
+    bool is_64bit = false;
 };
+// Parsed format strings of the debugPrintfEXT calls of a shader, by OpString ID
+using ShaderFormatStrings = vvl::unordered_map<uint32_t, std::vector<Substring>>;
 
 struct OutputRecord {
     uint32_t size;
@@ -58,6 +58,8 @@ struct OutputRecord {
 class CommandBuffer : public gpu_tracker::CommandBuffer {
   public:
     std::vector<BufferInfo> buffer_infos;
+    // Printf output blocks of the recorded commands, handed back to the pool on reset
+    gpu::BufferLinearAllocator output_allocator;
 
     CommandBuffer(Validator& dp, VkCommandBuffer handle, const VkCommandBufferAllocateInfo* create_info,
                   const vvl::CommandPool* pool);
@@ -95,7 +97,8 @@ class Validator : public gpu::GpuShaderInstrumentor {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     std::vector<Substring> ParseFormatString(const std::string& format_string);
-    std::string FindFormatString(const std::vector<spirv::Instruction>& instructions, uint32_t string_id);
+    // Parses the format strings of all the debugPrintfEXT calls of the shader
+    std::shared_ptr<const ShaderFormatStrings> ParseShaderFormatStrings(const vvl::span<const uint32_t>& spirv);
     void AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo& buffer_info, uint32_t operation_index,
                                    uint32_t* const debug_output_buffer, const Location& loc);
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
@@ -184,5 +187,9 @@ class Validator : public gpu::GpuShaderInstrumentor {
   private:
     bool verbose = false;
     bool use_stdout = false;
+    // Format strings are parsed when the shader is instrumented, not for each message. By unique shader ID, only for the
+    // shaders calling debugPrintfEXT. IDs are never reused and pipelines can outlive their shader modules, so the entries are
+    // kept as long as the device.
+    vvl::concurrent_unordered_map<uint32_t, std::shared_ptr<const ShaderFormatStrings>> shader_format_strings_;
 };
 }  // namespace debug_printf
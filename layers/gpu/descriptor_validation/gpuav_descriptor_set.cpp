@@ -21,6 +21,8 @@
 #include "gpu/resources/gpuav_subclasses.h"
 #include "gpu/shaders/gpu_shaders_constants.h"
 
+#include <algorithm>
+
 using vvl::DescriptorClass;
 
 namespace gpuav {
@@ -94,6 +96,7 @@ VkDeviceAddress DescriptorSet::GetLayoutState() {
 
     VmaAllocationCreateInfo alloc_info{};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    gv_dev->descriptor_state_pool_.Select(alloc_info, buffer_info.size);
     VkResult result =
         vmaCreateBuffer(gv_dev->vma_allocator_, &buffer_info, &alloc_info, &layout_.buffer, &layout_.allocation, nullptr);
     if (result != VK_SUCCESS) {
@@ -257,21 +260,126 @@ static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc) {
     return glsl::DescriptorState(desc_class, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
 }
 
+// Fills |data| for descriptors [first, last) of the binding
 template <typename Binding>
-void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    for (uint32_t di = 0; di < binding.count; di++) {
+void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t first, uint32_t last) {
+    for (uint32_t di = first; di < last; di++) {
         if (!binding.updated[di]) {
-            data[index++] = glsl::DescriptorState();
+            data[di] = glsl::DescriptorState();
         } else {
-            data[index++] = GetInData(binding.descriptors[di]);
+            data[di] = GetInData(binding.descriptors[di]);
         }
     }
 }
 
 // Inline Uniforms are currently treated as a single descriptor. Writes to any offsets cause the whole range to be valid.
 template <>
-void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    data[index++] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
+void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t, uint32_t) {
+    data[0] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
+}
+
+// Shader instrumentation is tracking inline uniform blocks as scalars, they take a single descriptor in the GPU state
+static uint32_t StateDescriptorCount(const vvl::DescriptorBinding &binding) {
+    return (binding.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) ? 1 : binding.count;
+}
+
+uint32_t DescriptorSet::GetStateDescriptorCount() const {
+    uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
+    for (const auto &binding : bindings_) {
+        descriptor_count += StateDescriptorCount(*binding);
+    }
+    return descriptor_count;
+}
+
+uint32_t DescriptorSet::GetStateIndex(uint32_t binding, uint32_t array_element) const {
+    uint32_t index = 0;
+    for (const auto &binding_state : bindings_) {
+        if (binding_state->binding == binding) {
+            return binding_state->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT ? index : index + array_element;
+        }
+        index += StateDescriptorCount(*binding_state);
+    }
+    return index;
+}
+
+void DescriptorSet::MarkDirty(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
+    auto guard = Lock();
+    const uint32_t version = ++current_version_;
+    // Nothing to track until the GPU state was created once
+    if (!last_used_state_) {
+        return;
+    }
+    // Simpler to do a full copy than to keep track of every write of a set being rewritten over and over
+    constexpr size_t kMaxDirtyRanges = 4096;
+    if (dirty_ranges_.size() >= kMaxDirtyRanges) {
+        dirty_ranges_.clear();
+        dirty_ranges_base_version_ = version;
+        return;
+    }
+    const uint32_t start = GetStateIndex(binding, array_element);
+    // Inline uniform blocks count bytes, but are a single descriptor in the GPU state
+    const bool inline_uniform = GetLayout()->GetTypeFromBinding(binding) == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT;
+    dirty_ranges_.emplace_back(DirtyRange{version, start, inline_uniform ? 1 : descriptor_count});
+}
+
+template <typename Func>
+bool DescriptorSet::ForEachDirtyRange(uint32_t version, uint32_t descriptor_count, Func &&func) const {
+    if (version < dirty_ranges_base_version_) {
+        return false;
+    }
+    for (const DirtyRange &range : dirty_ranges_) {
+        if (range.version <= version || range.start >= descriptor_count) {
+            continue;
+        }
+        // Writes that go past the end of a binding spill over into the next ones, which are also next in the GPU state
+        func(range.start, std::min(range.count, descriptor_count - range.start));
+    }
+    return true;
+}
+
+// Rebuilds the CPU copy for descriptors [start, start + count)
+void DescriptorSet::UpdateInData(uint32_t start, uint32_t count) {
+    const uint32_t end = start + count;
+    uint32_t index = 0;
+    for (uint32_t i = 0; i < bindings_.size() && index < end; i++) {
+        const auto &binding = *bindings_[i];
+        const uint32_t binding_count = StateDescriptorCount(binding);
+        const uint32_t binding_end = index + binding_count;
+        if (binding_end > start) {
+            const uint32_t first = (start > index) ? start - index : 0;
+            const uint32_t last = std::min(end, binding_end) - index;
+            glsl::DescriptorState *data = &in_data_[index];
+            switch (binding.descriptor_class) {
+                case DescriptorClass::InlineUniform:
+                    FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::GeneralBuffer:
+                    FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::TexelBuffer:
+                    FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::Mutable:
+                    FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::PlainSampler:
+                    FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::ImageSampler:
+                    FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::Image:
+                    FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, first, last);
+                    break;
+                case DescriptorClass::AccelerationStructure:
+                    FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, first, last);
+                    break;
+                default:
+                    assert(false);
+            }
+        }
+        index = binding_end;
+    }
 }
 
 std::shared_ptr<DescriptorSet::State> DescriptorSet::GetCurrentState() {
@@ -281,96 +389,108 @@ std::shared_ptr<DescriptorSet::State> DescriptorSet::GetCurrentState() {
     if (last_used_state_ && last_used_state_->version == cur_version) {
         return last_used_state_;
     }
-    auto next_state = std::make_shared<State>();
-    next_state->set = VkHandle();
-    next_state->version = cur_version;
-    next_state->allocator = gv_dev->vma_allocator_;
 
-    uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
-    if (GetBindingCount() > 0) {
-        for (const auto &binding : *this) {
-            // Shader instrumentation is tracking inline uniform blocks as scalars. Don't try to validate inline uniform
-            // blocks
-            if (binding->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
-                descriptor_count++;
-            } else {
-                descriptor_count += binding->count;
-            }
-        }
-    }
+    const uint32_t descriptor_count = (GetBindingCount() > 0) ? GetStateDescriptorCount() : 0;
     if (descriptor_count == 0) {
         // no descriptors case, return a dummy state object
+        auto next_state = std::make_shared<State>();
+        next_state->set = VkHandle();
+        next_state->version = cur_version;
+        next_state->allocator = gv_dev->vma_allocator_;
         last_used_state_ = next_state;
         return last_used_state_;
     }
 
-    VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
-    buffer_info.size = descriptor_count * sizeof(glsl::DescriptorState);
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
-
-    // The descriptor state buffer can be very large (4mb+ in some games). Allocating it as HOST_CACHED
-    // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-    VmaAllocationCreateInfo alloc_info{};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    VkResult result =
-        vmaCreateBuffer(next_state->allocator, &buffer_info, &alloc_info, &next_state->buffer, &next_state->allocation, nullptr);
-    if (result != VK_SUCCESS) {
-        return nullptr;
+    // Bring the CPU copy up to date, only looking at what was written since
+    const bool rebuild_in_data =
+        in_data_.size() != descriptor_count ||
+        !ForEachDirtyRange(in_data_version_, descriptor_count, [this](uint32_t start, uint32_t count) { UpdateInData(start, count); });
+    if (rebuild_in_data) {
+        in_data_.resize(descriptor_count);
+        UpdateInData(0, descriptor_count);
+    }
+    in_data_version_ = cur_version;
+
+    // A state can only be modified once no command buffer references it anymore (so it can't be in flight either).
+    // Try in order: the current one, the one before it, and only then make a new one.
+    std::shared_ptr<State> next_state;
+    if (last_used_state_ && last_used_state_->buffer != VK_NULL_HANDLE && last_used_state_.use_count() == 1) {
+        next_state = last_used_state_;
+    } else if (spare_state_ && spare_state_->buffer != VK_NULL_HANDLE && spare_state_.use_count() == 1) {
+        next_state = std::move(spare_state_);
     }
+
     glsl::DescriptorState *data{nullptr};
-    result = vmaMapMemory(next_state->allocator, next_state->allocation, reinterpret_cast<void **>(&data));
-    assert(result == VK_SUCCESS);
-    uint32_t index = 0;
-    for (uint32_t i = 0; i < bindings_.size(); i++) {
-        const auto &binding = *bindings_[i];
-        switch (binding.descriptor_class) {
-            case DescriptorClass::InlineUniform:
-                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::GeneralBuffer:
-                FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::TexelBuffer:
-                FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Mutable:
-                FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::PlainSampler:
-                FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::ImageSampler:
-                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Image:
-                FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::AccelerationStructure:
-                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, index);
-                break;
-            default:
-                assert(false);
+    VkResult result = VK_SUCCESS;
+    if (next_state) {
+        result = vmaMapMemory(next_state->allocator, next_state->allocation, reinterpret_cast<void **>(&data));
+        assert(result == VK_SUCCESS);
+        const bool updated = ForEachDirtyRange(next_state->version, descriptor_count, [&](uint32_t start, uint32_t count) {
+            memcpy(&data[start], &in_data_[start], count * sizeof(glsl::DescriptorState));
+            vmaFlushAllocation(next_state->allocator, next_state->allocation, start * sizeof(glsl::DescriptorState),
+                               count * sizeof(glsl::DescriptorState));
+        });
+        if (!updated) {
+            memcpy(data, in_data_.data(), descriptor_count * sizeof(glsl::DescriptorState));
+            result = vmaFlushAllocation(next_state->allocator, next_state->allocation, 0, VK_WHOLE_SIZE);
+            assert(result == VK_SUCCESS);
+        }
+        vmaUnmapMemory(next_state->allocator, next_state->allocation);
+        next_state->version = cur_version;
+    } else {
+        next_state = std::make_shared<State>();
+        next_state->set = VkHandle();
+        next_state->version = cur_version;
+        next_state->allocator = gv_dev->vma_allocator_;
+
+        VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
+        buffer_info.size = descriptor_count * sizeof(glsl::DescriptorState);
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+        // The descriptor state buffer can be very large (4mb+ in some games). Allocating it as HOST_CACHED
+        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
+        VmaAllocationCreateInfo alloc_info{};
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        gv_dev->descriptor_state_pool_.Select(alloc_info, buffer_info.size);
+        result = vmaCreateBuffer(next_state->allocator, &buffer_info, &alloc_info, &next_state->buffer, &next_state->allocation,
+                                 nullptr);
+        if (result != VK_SUCCESS) {
+            return nullptr;
+        }
+        result = vmaMapMemory(next_state->allocator, next_state->allocation, reinterpret_cast<void **>(&data));
+        assert(result == VK_SUCCESS);
+        memcpy(data, in_data_.data(), static_cast<size_t>(buffer_info.size));
+
+        VkBufferDeviceAddressInfo buffer_device_address_info = vku::InitStructHelper();
+        buffer_device_address_info.buffer = next_state->buffer;
+
+        // We cannot rely on device_extensions here, since we may be enabling BDA support even
+        // though the application has not requested it.
+        if (gv_dev->api_version >= VK_API_VERSION_1_2) {
+            next_state->device_addr = DispatchGetBufferDeviceAddress(gv_dev->device, &buffer_device_address_info);
+        } else {
+            next_state->device_addr = DispatchGetBufferDeviceAddressKHR(gv_dev->device, &buffer_device_address_info);
         }
+        assert(next_state->device_addr != 0);
+
+        // Flush the descriptor state buffer before unmapping so that the new state is visible to the GPU
+        result = vmaFlushAllocation(next_state->allocator, next_state->allocation, 0, VK_WHOLE_SIZE);
+        // No good way to handle this error, we should still try to unmap.
+        assert(result == VK_SUCCESS);
+        vmaUnmapMemory(next_state->allocator, next_state->allocation);
     }
-    VkBufferDeviceAddressInfo buffer_device_address_info = vku::InitStructHelper();
-    buffer_device_address_info.buffer = next_state->buffer;
 
-    // We cannot rely on device_extensions here, since we may be enabling BDA support even
-    // though the application has not requested it.
-    if (gv_dev->api_version >= VK_API_VERSION_1_2) {
-        next_state->device_addr = DispatchGetBufferDeviceAddress(gv_dev->device, &buffer_device_address_info);
-    } else {
-        next_state->device_addr = DispatchGetBufferDeviceAddressKHR(gv_dev->device, &buffer_device_address_info);
+    if (next_state != last_used_state_) {
+        spare_state_ = std::move(last_used_state_);
+        last_used_state_ = next_state;
     }
-    assert(next_state->device_addr != 0);
 
-    // Flush the descriptor state buffer before unmapping so that the new state is visible to the GPU
-    result = vmaFlushAllocation(next_state->allocator, next_state->allocation, 0, VK_WHOLE_SIZE);
-    // No good way to handle this error, we should still try to unmap.
-    assert(result == VK_SUCCESS);
-    vmaUnmapMemory(next_state->allocator, next_state->allocation);
+    // Only ranges newer than the oldest state that could be reused are still needed
+    const uint32_t oldest_version = spare_state_ ? std::min(spare_state_->version, cur_version) : cur_version;
+    dirty_ranges_.erase(std::remove_if(dirty_ranges_.begin(), dirty_ranges_.end(),
+                                       [oldest_version](const DirtyRange &range) { return range.version <= oldest_version; }),
+                        dirty_ranges_.end());
 
-    last_used_state_ = next_state;
     return next_state;
 }
 
@@ -410,6 +530,7 @@ std::shared_ptr<DescriptorSet::State> DescriptorSet::GetOutputState(Validator &g
     // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
     VmaAllocationCreateInfo alloc_info{};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    gpuav.descriptor_state_pool_.Select(alloc_info, buffer_info.size);
     VkResult result =
         vmaCreateBuffer(next_state->allocator, &buffer_info, &alloc_info, &next_state->buffer, &next_state->allocation, nullptr);
     assert(result == VK_SUCCESS);
@@ -451,9 +572,22 @@ std::shared_ptr<DescriptorSet::State> DescriptorSet::GetOutputState(Validator &g
     return next_state;
 }
 
-std::map<uint32_t, std::vector<uint32_t>> DescriptorSet::State::UsedDescriptors(const DescriptorSet &set,
-                                                                                uint32_t shader_set) const {
-    std::map<uint32_t, std::vector<uint32_t>> used_descs;
+std::shared_ptr<const DescriptorSet::State::UsedDescriptorMap> DescriptorSet::State::UsedDescriptors(
+    const DescriptorSet &set, uint32_t shader_set, uint64_t retired_batches) const {
+    std::lock_guard<std::mutex> guard(used_scans_lock_);
+    auto scan = std::find_if(used_scans_.begin(), used_scans_.end(),
+                             [shader_set](const UsedScan &used_scan) { return used_scan.shader_set == shader_set; });
+    if (scan != used_scans_.end() && scan->retired_batches == retired_batches) {
+        return scan->used_descs;
+    }
+
+    auto used_descs = std::make_shared<UsedDescriptorMap>();
+    if (scan == used_scans_.end()) {
+        scan = used_scans_.insert(used_scans_.end(), UsedScan{shader_set, retired_batches, used_descs});
+    } else {
+        scan->retired_batches = retired_batches;
+        scan->used_descs = used_descs;
+    }
     if (!allocation) {
         return used_descs;
     }
@@ -472,7 +606,7 @@ std::map<uint32_t, std::vector<uint32_t>> DescriptorSet::State::UsedDescriptors(
         for (uint32_t i = 0; i < count; i++) {
             uint32_t pos = start + i;
             if (data[pos] == shader_set) {
-                auto map_result = used_descs.emplace(binding, std::vector<uint32_t>());
+                auto map_result = used_descs->emplace(binding, std::vector<uint32_t>());
                 map_result.first->second.emplace_back(i);
             }
         }
@@ -487,25 +621,34 @@ DescriptorSet::State::~State() { vmaDestroyBuffer(allocator, buffer, allocation)
 
 void DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     vvl::DescriptorSet::PerformPushDescriptorsUpdate(write_count, write_descs);
+    // Push descriptors are small, just redo the whole set
+    auto guard = Lock();
     current_version_++;
+    dirty_ranges_.clear();
+    dirty_ranges_base_version_ = current_version_.load();
 }
 
 void DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &write_desc) {
     vvl::DescriptorSet::PerformWriteUpdate(write_desc);
-    current_version_++;
+    MarkDirty(write_desc.dstBinding, write_desc.dstArrayElement, write_desc.descriptorCount);
 }
 
 void DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &copy_desc, const vvl::DescriptorSet &src_set) {
     vvl::DescriptorSet::PerformCopyUpdate(copy_desc, src_set);
-    current_version_++;
+    MarkDirty(copy_desc.dstBinding, copy_desc.dstArrayElement, copy_desc.descriptorCount);
 }
 
+// If max_descriptors_ is 0, GPU-AV aborted during vkCreateDevice(). We still need to
+// support calls into this class as no-ops if this happens.
 DescriptorHeap::DescriptorHeap(Validator &gpu_dev, uint32_t max_descriptors)
-    : max_descriptors_(max_descriptors), allocator_(gpu_dev.vma_allocator_) {
-    // If max_descriptors_ is 0, GPU-AV aborted during vkCreateDevice(). We still need to
-    // support calls into this class as no-ops if this happens.
-    if (max_descriptors_ == 0) {
-        return;
+    : max_descriptors_(max_descriptors),
+      device_(gpu_dev.device),
+      api_version_(gpu_dev.api_version),
+      allocator_(gpu_dev.vma_allocator_) {}
+
+bool DescriptorHeap::AllocateGpuState() {
+    if (gpu_heap_state_) {
+        return true;
     }
 
     VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
@@ -514,28 +657,38 @@ DescriptorHeap::DescriptorHeap(Validator &gpu_dev, uint32_t max_descriptors)
 
     VmaAllocationCreateInfo alloc_info{};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    [[maybe_unused]] VkResult result;
-    result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &buffer_, &allocation_, nullptr);
-    assert(result == VK_SUCCESS);
+    VkResult result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &buffer_, &allocation_, nullptr);
+    if (result != VK_SUCCESS) {
+        assert(false);
+        return false;
+    }
 
     result = vmaMapMemory(allocator_, allocation_, reinterpret_cast<void **>(&gpu_heap_state_));
-    assert(result == VK_SUCCESS);
+    if (result != VK_SUCCESS) {
+        assert(false);
+        vmaDestroyBuffer(allocator_, buffer_, allocation_);
+        buffer_ = VK_NULL_HANDLE;
+        allocation_ = nullptr;
+        gpu_heap_state_ = nullptr;
+        return false;
+    }
     memset(gpu_heap_state_, 0, static_cast<size_t>(buffer_info.size));
 
     auto buffer_device_address_info = vku::InitStruct<VkBufferDeviceAddressInfo>();
     buffer_device_address_info.buffer = buffer_;
     // We cannot rely on device_extensions here, since we may be enabling BDA support even
     // though the application has not requested it.
-    if (gpu_dev.api_version >= VK_API_VERSION_1_2) {
-        device_address_ = DispatchGetBufferDeviceAddress(gpu_dev.device, &buffer_device_address_info);
+    if (api_version_ >= VK_API_VERSION_1_2) {
+        device_address_ = DispatchGetBufferDeviceAddress(device_, &buffer_device_address_info);
     } else {
-        device_address_ = DispatchGetBufferDeviceAddressKHR(gpu_dev.device, &buffer_device_address_info);
+        device_address_ = DispatchGetBufferDeviceAddressKHR(device_, &buffer_device_address_info);
     }
     assert(device_address_ != 0);
+    return true;
 }
 
 DescriptorHeap::~DescriptorHeap() {
-    if (max_descriptors_ > 0) {
+    if (gpu_heap_state_) {
         vmaUnmapMemory(allocator_, allocation_);
         gpu_heap_state_ = nullptr;
         vmaDestroyBuffer(allocator_, buffer_, allocation_);
@@ -551,7 +704,7 @@ DescriptorId DescriptorHeap::NextId(const VulkanTypedHandle &handle) {
     // NOTE: valid ids are in the range [1, max_descriptors_] (inclusive)
     // 0 is the invalid id.
     auto guard = Lock();
-    if (alloc_map_.size() >= max_descriptors_) {
+    if (alloc_map_.size() >= max_descriptors_ || !AllocateGpuState()) {
         return 0;
     }
     do {
@@ -566,7 +719,8 @@ DescriptorId DescriptorHeap::NextId(const VulkanTypedHandle &handle) {
 }
 
 void DescriptorHeap::DeleteId(DescriptorId id) {
-    if (max_descriptors_ > 0) {
+    // Ids are only handed out once the GPU heap state exists
+    if (id != 0) {
         auto guard = Lock();
         // Note: We don't mess with next_id_ here because ids should be signed in LRU order.
         gpu_heap_state_[id / 32] &= ~(1u << (id & 31));
@@ -574,4 +728,13 @@ void DescriptorHeap::DeleteId(DescriptorId id) {
     }
 }
 
+VkDeviceAddress DescriptorHeap::GetDeviceAddress() {
+    if (max_descriptors_ == 0) {
+        return 0;
+    }
+    auto guard = Lock();
+    AllocateGpuState();
+    return device_address_;
+}
+
 }  // namespace gpuav
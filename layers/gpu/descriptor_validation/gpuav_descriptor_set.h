@@ -19,12 +19,16 @@
 
 #include <atomic>
 #include <mutex>
+#include <vector>
 #include "state_tracker/descriptor_sets.h"
 #include "vma/vma.h"
 
 namespace gpuav {
 
 class Validator;
+namespace glsl {
+struct DescriptorState;
+}  // namespace glsl
 
 class DescriptorSet : public vvl::DescriptorSet {
   public:
@@ -43,7 +47,22 @@ class DescriptorSet : public vvl::DescriptorSet {
         VkBuffer buffer{VK_NULL_HANDLE};
         VkDeviceAddress device_addr{0};
 
-        std::map<uint32_t, std::vector<uint32_t>> UsedDescriptors(const DescriptorSet &set, uint32_t shader_set) const;
+        // Used array elements, by binding
+        using UsedDescriptorMap = std::map<uint32_t, std::vector<uint32_t>>;
+        // The output state is shared by every command buffer binding the set, and each of them used to scan all of it (a
+        // word per descriptor) when post processed. Now it is scanned once per retired batch and set index, and the
+        // command buffers of the batch share the result.
+        std::shared_ptr<const UsedDescriptorMap> UsedDescriptors(const DescriptorSet &set, uint32_t shader_set,
+                                                                 uint64_t retired_batches) const;
+
+      private:
+        struct UsedScan {
+            uint32_t shader_set;
+            uint64_t retired_batches;
+            std::shared_ptr<const UsedDescriptorMap> used_descs;
+        };
+        mutable std::mutex used_scans_lock_;
+        mutable std::vector<UsedScan> used_scans_;
     };
     void PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) override;
     void PerformWriteUpdate(const VkWriteDescriptorSet &) override;
@@ -62,16 +81,42 @@ class DescriptorSet : public vvl::DescriptorSet {
         VkBuffer buffer{VK_NULL_HANDLE};
         VkDeviceAddress device_addr{0};
     };
+    // Descriptors [start, start + count) of the GPU state changed with |version|
+    struct DirtyRange {
+        uint32_t version;
+        uint32_t start;
+        uint32_t count;
+    };
     std::lock_guard<std::mutex> Lock() const { return std::lock_guard<std::mutex>(state_lock_); }
 
+    uint32_t GetStateDescriptorCount() const;
+    uint32_t GetStateIndex(uint32_t binding, uint32_t array_element) const;
+    void MarkDirty(uint32_t binding, uint32_t array_element, uint32_t descriptor_count);
+    void UpdateInData(uint32_t start, uint32_t count);
+    // Calls |func| for every range modified after |version|, returns false if they are not all known anymore
+    template <typename Func>
+    bool ForEachDirtyRange(uint32_t version, uint32_t descriptor_count, Func &&func) const;
+
     Layout layout_;
     std::atomic<uint32_t> current_version_{0};
     std::shared_ptr<State> last_used_state_;
+    // State created before last_used_state_, reused (and brought up to date) once no command buffer references it.
+    // Avoids allocating and filling a whole new buffer every time a bindless set is updated between submissions
+    std::shared_ptr<State> spare_state_;
     std::shared_ptr<State> output_state_;
+    // CPU copy of the GPU descriptor state at |in_data_version_|, only the dirty ranges are rebuilt
+    std::vector<glsl::DescriptorState> in_data_;
+    uint32_t in_data_version_{0};
+    // Ranges written since the oldest state that can still be reused
+    std::vector<DirtyRange> dirty_ranges_;
+    // Ranges older than this were dropped, states with an older version get a full copy
+    uint32_t dirty_ranges_base_version_{0};
     mutable std::mutex state_lock_;
 };
 
 typedef uint32_t DescriptorId;
+// The GPU copy of the heap state can hold millions of descriptors, it is only allocated by the first descriptor or the first
+// command buffer using descriptor validation so devices that never get there don't pay for it.
 class DescriptorHeap {
   public:
     DescriptorHeap(Validator &, uint32_t max_descriptors);
@@ -79,14 +124,18 @@ class DescriptorHeap {
     DescriptorId NextId(const VulkanTypedHandle &handle);
     void DeleteId(DescriptorId id);
 
-    VkDeviceAddress GetDeviceAddress() const { return device_address_; }
+    VkDeviceAddress GetDeviceAddress();
 
   private:
     std::lock_guard<std::mutex> Lock() const { return std::lock_guard<std::mutex>(lock_); }
+    // Requires lock_, returns false if the GPU heap state can't be allocated
+    bool AllocateGpuState();
 
     mutable std::mutex lock_;
 
     const uint32_t max_descriptors_;
+    const VkDevice device_;
+    const uint32_t api_version_;
     DescriptorId next_id_{1};
     vvl::unordered_map<DescriptorId, VulkanTypedHandle> alloc_map_;
 
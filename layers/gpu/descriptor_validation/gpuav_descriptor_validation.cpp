@@ -81,33 +81,20 @@ void UpdateBoundDescriptors(Validator &gpuav, VkCommandBuffer cb, VkPipelineBind
 
     // Figure out how much memory we need for the input block based on how many sets and bindings there are
     // and how big each of the bindings is
-
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
     assert(number_of_sets <= glsl::kDebugInputBindlessMaxDescSets);
-    buffer_info.size = sizeof(glsl::BindlessStateBuffer);
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = VK_NULL_HANDLE;
     DescBindingInfo di_buffers = {};
 
-    // Allocate buffer for device addresses of the input buffer for each descriptor set.  This is the buffer written to each
+    // Buffer for device addresses of the input buffer for each descriptor set.  This is the buffer written to each
     // draw's descriptor set.
-    VkResult result = vmaCreateBuffer(gpuav.vma_allocator_, &buffer_info, &alloc_info, &di_buffers.bindless_state_buffer,
-                                      &di_buffers.bindless_state_buffer_allocation, nullptr);
-    if (result != VK_SUCCESS) {
+    // This happens for every bind/draw, so it comes out of the command buffer chunks instead of being its own VMA allocation
+    di_buffers.bindless_state = cb_state->per_command_allocator.Allocate(sizeof(glsl::BindlessStateBuffer));
+    if (di_buffers.bindless_state.IsNull()) {
         gpuav.InternalError(cb_state->Handle(), loc, "Unable to allocate device memory. Device could become unstable.", true);
         return;
     }
-    glsl::BindlessStateBuffer *bindless_state{nullptr};
-    result =
-        vmaMapMemory(gpuav.vma_allocator_, di_buffers.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
-    if (result != VK_SUCCESS) {
-        gpuav.InternalError(cb_state->Handle(), loc, "Unable to map device memory. Device could become unstable.", true);
-        return;
-    }
-    memset(bindless_state, 0, static_cast<size_t>(buffer_info.size));
-    cb_state->current_bindless_buffer = di_buffers.bindless_state_buffer;
+    auto *bindless_state = static_cast<glsl::BindlessStateBuffer *>(di_buffers.bindless_state.mapped_ptr);
+    memset(bindless_state, 0, sizeof(glsl::BindlessStateBuffer));
+    cb_state->current_bindless_buffer = di_buffers.bindless_state;
 
     bindless_state->global_state = gpuav.desc_heap_->GetDeviceAddress();
     for (uint32_t i = 0; i < last_bound.per_set.size(); i++) {
@@ -133,7 +120,7 @@ void UpdateBoundDescriptors(Validator &gpuav, VkCommandBuffer cb, VkPipelineBind
                 bindless_state->desc_sets[i].in_data = desc_set_state.gpu_state->device_addr;
                 desc_set_state.output_state = desc_set_state.state->GetOutputState(gpuav);
                 if (!desc_set_state.output_state) {
-                    goto exit;
+                    return;
                 }
                 bindless_state->desc_sets[i].out_data = desc_set_state.output_state->device_addr;
             }
@@ -141,22 +128,14 @@ void UpdateBoundDescriptors(Validator &gpuav, VkCommandBuffer cb, VkPipelineBind
         }
     }
     cb_state->di_input_buffer_list.emplace_back(di_buffers);
-exit:
-    vmaUnmapMemory(gpuav.vma_allocator_, di_buffers.bindless_state_buffer_allocation);
 }
 
-// For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
-[[nodiscard]] bool UpdateBindlessStateBuffer(Validator &gpuav, CommandBuffer &cb_state, VmaAllocator vma_allocator) {
+// For the given command buffer, update the status of any update after bind descriptors in its debug data buffers
+[[nodiscard]] bool UpdateBindlessStateBuffer(Validator &gpuav, CommandBuffer &cb_state) {
     for (auto &cmd_info : cb_state.di_input_buffer_list) {
-        glsl::BindlessStateBuffer *bindless_state{nullptr};
-        [[maybe_unused]] VkResult result;
-        result = vmaMapMemory(vma_allocator, cmd_info.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
-        assert(result == VK_SUCCESS);
-        if (result != VK_SUCCESS) {
-            gpuav.InternalError(gpuav.device, Location(vvl::Func::vkMapMemory),
-                                "Unable to map device memory allocated for error output buffer. Aborting GPU-AV.", true);
-            return false;
-        }
+        // Memory is persistently mapped and coherent
+        auto *bindless_state = static_cast<glsl::BindlessStateBuffer *>(cmd_info.bindless_state.mapped_ptr);
+        assert(bindless_state);
         for (size_t i = 0; i < cmd_info.descriptor_set_buffers.size(); i++) {
             auto &set_buffer = cmd_info.descriptor_set_buffers[i];
             bindless_state->desc_sets[i].layout_data = set_buffer.state->GetLayoutState();
@@ -167,13 +146,11 @@ exit:
             if (!set_buffer.output_state) {
                 set_buffer.output_state = set_buffer.state->GetOutputState(gpuav);
                 if (!set_buffer.output_state) {
-                    vmaUnmapMemory(vma_allocator, cmd_info.bindless_state_buffer_allocation);
                     return false;
                 }
                 bindless_state->desc_sets[i].out_data = set_buffer.output_state->device_addr;
             }
         }
-        vmaUnmapMemory(vma_allocator, cmd_info.bindless_state_buffer_allocation);
     }
     return true;
 }
@@ -183,6 +160,8 @@ exit:
     // Some applications repeatedly call vkCmdBindDescriptorSets() with the same descriptor sets, avoid
     // checking them multiple times.
     vvl::unordered_set<VkDescriptorSet> validated_desc_sets;
+    auto gpuav = static_cast<Validator *>(&dev_data);
+    const uint64_t retired_batches = gpuav->retired_batches_.load();
     for (auto [di_info_i, di_info] : vvl::enumerate(di_input_buffer_list)) {
         Location draw_loc(vvl::Func::vkCmdDraw);
         // For each descriptor set ...
@@ -199,16 +178,15 @@ exit:
                 std::stringstream error;
                 error << "In CommandBuffer::ValidateBindlessDescriptorSets, di_info[" << di_info_i << "].descriptor_set_buffers["
                       << i << "].output_state was null. This should not happen. GPU-AV is in a bad state, aborting.";
-                auto gpuav = static_cast<Validator *>(&dev_data);
                 gpuav->InternalError(gpuav->device, Location(vvl::Func::vkQueueSubmit), error.str().c_str());
                 return false;
             }
 
             vvl::DescriptorValidator context(state_, *this, *set.state, i, VK_NULL_HANDLE /*framebuffer*/, draw_loc);
             const uint32_t shader_set = glsl::kDescriptorSetWrittenMask | i;
-            auto used_descs = set.output_state->UsedDescriptors(*set.state, shader_set);
+            auto used_descs = set.output_state->UsedDescriptors(*set.state, shader_set, retired_batches);
             // For each used binding ...
-            for (const auto &u : used_descs) {
+            for (const auto &u : *used_descs) {
                 auto iter = set.binding_req.find(u.first);
                 vvl::DescriptorBindingInfo binding_info;
                 binding_info.first = u.first;
@@ -29,5 +29,5 @@ class Validator;
 void UpdateBoundPipeline(Validator& gpuav, VkCommandBuffer cb, VkPipelineBindPoint pipeline_bind_point, VkPipeline pipeline,
                          const Location& loc);
 void UpdateBoundDescriptors(Validator& gpuav, VkCommandBuffer cb, VkPipelineBindPoint pipeline_bind_point, const Location& loc);
-[[nodiscard]] bool UpdateBindlessStateBuffer(Validator& gpuav, CommandBuffer& cb_state, VmaAllocator vma_allocator);
+[[nodiscard]] bool UpdateBindlessStateBuffer(Validator& gpuav, CommandBuffer& cb_state);
 }  // namespace gpuav
@@ -61,25 +61,6 @@ struct LayoutUseCheckAndMessage {
     }
 };
 
-// Helper to update the Global or Overlay layout map
-struct GlobalLayoutUpdater {
-    bool update(VkImageLayout &dst, const image_layout_map::ImageSubresourceLayoutMap::LayoutEntry &src) const {
-        if (src.current_layout != image_layout_map::kInvalidLayout && dst != src.current_layout) {
-            dst = src.current_layout;
-            return true;
-        }
-        return false;
-    }
-
-    std::optional<VkImageLayout> insert(const image_layout_map::ImageSubresourceLayoutMap::LayoutEntry &src) const {
-        std::optional<VkImageLayout> result;
-        if (src.current_layout != image_layout_map::kInvalidLayout) {
-            result.emplace(src.current_layout);
-        }
-        return result;
-    }
-};
-
 namespace gpuav {
 
 static void RecordTransitionImageLayout(Validator &gpuav, vvl::CommandBuffer &cb_state,
@@ -253,8 +234,12 @@ void UpdateCmdBufImageLayouts(Validator &gpuav, const vvl::CommandBuffer &cb_sta
         }
         auto image_state = gpuav.Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id) {
+            const auto &transitions = subres_map->GetSubmitLayouts().transitions;
+            if (transitions.empty()) {
+                continue;
+            }
             auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            image_state->layout_range_map->SetLayouts(transitions);
         }
     }
 }
@@ -0,0 +1,259 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu/instrumentation/gpu_shader_cache.h"
+
+#include "chassis/chassis_modification_state.h"
+#include "utils/vk_layer_utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gpu {
+
+// Read only view of the whole cache file
+struct SpirvCache::MappedFile {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+
+    ~MappedFile() {
+        if (!data) {
+            return;
+        }
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<uint8_t *>(data), size);
+#endif
+    }
+
+    static std::unique_ptr<MappedFile> Open(const std::string &path) {
+        auto mapped = std::make_unique<MappedFile>();
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) {
+            return nullptr;
+        }
+        // The view keeps the mapping alive
+        void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view) {
+            return nullptr;
+        }
+        mapped->data = static_cast<const uint8_t *>(view);
+        mapped->size = static_cast<size_t>(file_size.QuadPart);
+#else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat file_stat {};
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+            close(fd);
+            return nullptr;
+        }
+        void *view = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps the file alive
+        close(fd);
+        if (view == MAP_FAILED) {
+            return nullptr;
+        }
+        mapped->data = static_cast<const uint8_t *>(view);
+        mapped->size = static_cast<size_t>(file_stat.st_size);
+#endif
+        return mapped;
+    }
+};
+
+// File layout, all fields are 32-bit words
+//   magic | version | key size in bytes | entry count | key (padded to 4 bytes)
+//   repeated entry count times: hash | SPIR-V dword count | SPIR-V
+static constexpr size_t kHeaderWords = 4;
+
+static size_t PaddedKeyWords(size_t key_size) { return (key_size + sizeof(uint32_t) - 1) / sizeof(uint32_t); }
+
+SpirvCache::SpirvCache() = default;
+SpirvCache::~SpirvCache() = default;
+
+bool SpirvCache::Load(const std::string &path, const void *key, size_t key_size) {
+    WriteLockGuard guard(lock_);
+    path_ = path;
+    key_.assign(static_cast<const uint8_t *>(key), static_cast<const uint8_t *>(key) + key_size);
+    mapped_shaders_.clear();
+    mapped_file_ = MappedFile::Open(path);
+    if (!mapped_file_) {
+        return false;
+    }
+
+    // mmap'd memory is page aligned
+    const uint32_t *words = reinterpret_cast<const uint32_t *>(mapped_file_->data);
+    const size_t word_count = mapped_file_->size / sizeof(uint32_t);
+    const size_t key_words = PaddedKeyWords(key_size);
+    if (word_count < kHeaderWords + key_words || words[0] != kFileMagic || words[1] != kFileVersion || words[2] != key_size ||
+        std::memcmp(words + kHeaderWords, key, key_size) != 0) {
+        mapped_file_.reset();
+        return false;
+    }
+
+    const uint32_t entry_count = words[3];
+    size_t offset = kHeaderWords + key_words;
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        if (word_count - offset < 2) {
+            break;
+        }
+        const uint32_t hash = words[offset];
+        const uint32_t spirv_dwords_count = words[offset + 1];
+        offset += 2;
+        // A truncated file (power loss, full disk, etc) keeps the entries before the damage
+        if (word_count - offset < spirv_dwords_count) {
+            break;
+        }
+        mapped_shaders_.emplace(hash, vvl::make_span(words + offset, spirv_dwords_count));
+        offset += spirv_dwords_count;
+    }
+    return true;
+}
+
+bool SpirvCache::Save() {
+    WriteLockGuard guard(lock_);
+    if (path_.empty() || added_shaders_.empty()) {
+        return true;
+    }
+
+    // Write everything next to the real file and move it in place, so another process loading the cache at the same time
+    // either sees the old or the new content
+#if defined(_WIN32)
+    const std::string tmp_path = path_ + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+#else
+    const std::string tmp_path = path_ + "." + std::to_string(getpid()) + ".tmp";
+#endif
+    std::ofstream file_stream(tmp_path, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+    if (!file_stream) {
+        return false;
+    }
+
+    const uint32_t key_size = static_cast<uint32_t>(key_.size());
+    const uint32_t entry_count = static_cast<uint32_t>(mapped_shaders_.size() + added_shaders_.size());
+    const uint32_t header[kHeaderWords] = {kFileMagic, kFileVersion, key_size, entry_count};
+    file_stream.write(reinterpret_cast<const char *>(header), sizeof(header));
+    std::vector<uint8_t> padded_key(PaddedKeyWords(key_.size()) * sizeof(uint32_t), 0);
+    std::copy(key_.begin(), key_.end(), padded_key.begin());
+    file_stream.write(reinterpret_cast<const char *>(padded_key.data()), padded_key.size());
+
+    auto write_entry = [&file_stream](uint32_t hash, const uint32_t *spirv, size_t spirv_dwords_count) {
+        const uint32_t entry_header[2] = {hash, static_cast<uint32_t>(spirv_dwords_count)};
+        file_stream.write(reinterpret_cast<const char *>(entry_header), sizeof(entry_header));
+        file_stream.write(reinterpret_cast<const char *>(spirv), spirv_dwords_count * sizeof(uint32_t));
+    };
+    for (const auto &[hash, spirv] : mapped_shaders_) {
+        write_entry(hash, spirv.data(), spirv.size());
+    }
+    for (const auto &[hash, spirv] : added_shaders_) {
+        write_entry(hash, spirv.data(), spirv.size());
+    }
+    file_stream.close();
+    if (file_stream.fail()) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    // Windows can't replace a file that is still mapped
+    mapped_shaders_.clear();
+    mapped_file_.reset();
+    added_shaders_.clear();
+
+#if defined(_WIN32)
+    const bool moved = MoveFileExA(tmp_path.c_str(), path_.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool moved = std::rename(tmp_path.c_str(), path_.c_str()) == 0;
+#endif
+    if (!moved) {
+        std::remove(tmp_path.c_str());
+    }
+    return moved;
+}
+
+void SpirvCache::Add(uint32_t hash, std::vector<uint32_t> spirv) {
+    WriteLockGuard guard(lock_);
+    if (mapped_shaders_.find(hash) != mapped_shaders_.end()) {
+        return;
+    }
+    added_shaders_.emplace(hash, std::move(spirv));
+}
+
+vvl::span<const uint32_t> SpirvCache::Get(uint32_t spirv_hash) const {
+    ReadLockGuard guard(lock_);
+    if (auto it = mapped_shaders_.find(spirv_hash); it != mapped_shaders_.end()) {
+        return it->second;
+    }
+    if (auto it = added_shaders_.find(spirv_hash); it != added_shaders_.end()) {
+        return vvl::make_span(it->second.data(), it->second.size());
+    }
+    return {};
+}
+
+bool SpirvCache::IsEmpty() const {
+    ReadLockGuard guard(lock_);
+    return mapped_shaders_.empty() && added_shaders_.empty();
+}
+
+bool SpirvCache::IsSpirvCached(uint32_t spirv_hash, chassis::CreateShaderModule &chassis_state) const {
+    const vvl::span<const uint32_t> spirv = Get(spirv_hash);
+    if (spirv.empty()) {
+        return false;
+    }
+    chassis_state.instrumented_spirv.assign(spirv.begin(), spirv.end());
+    chassis_state.instrumented_create_info.codeSize = chassis_state.instrumented_spirv.size() * sizeof(uint32_t);
+    chassis_state.instrumented_create_info.pCode = chassis_state.instrumented_spirv.data();
+    chassis_state.unique_shader_id = spirv_hash;
+    return true;
+}
+
+bool SpirvCache::IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::ShaderObject &chassis_state) const {
+    const vvl::span<const uint32_t> spirv = Get(spirv_hash);
+    if (spirv.empty()) {
+        return false;
+    }
+    chassis_state.instrumented_create_info[index].codeSize = spirv.size() * sizeof(uint32_t);
+    chassis_state.instrumented_create_info[index].pCode = spirv.data();
+    return true;
+}
+
+}  // namespace gpu
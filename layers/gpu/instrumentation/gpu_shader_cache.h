@@ -0,0 +1,80 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "containers/custom_containers.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace chassis {
+struct CreateShaderModule;
+struct ShaderObject;
+}  // namespace chassis
+
+namespace gpu {
+
+// Cache of instrumented SPIR-V, keyed by the hash of the original SPIR-V.
+//
+// The cache can be backed by a file which is memory mapped when loaded, so previously instrumented shaders are served
+// straight out of the mapping and the instrumentation passes only run once across runs. The file starts with a format
+// version and a caller provided key (the GPU-AV settings and the instrumentation shaders git hash), if either does not
+// match the whole file is ignored and gets rewritten on Save().
+//
+// Entries are never removed and their storage never moves, so the spans handed out are valid for the cache lifetime.
+class SpirvCache {
+  public:
+    SpirvCache();
+    ~SpirvCache();
+    SpirvCache(const SpirvCache &) = delete;
+    SpirvCache &operator=(const SpirvCache &) = delete;
+
+    // Returns false if the file does not exist or was written with a different format version or key
+    bool Load(const std::string &path, const void *key, size_t key_size);
+    // Writes the cache back to the path given to Load (no-op if nothing was added), meant for device destruction since it
+    // releases the entries (and the mapping) afterwards.
+    // The file is replaced atomically so concurrent processes never observe a partially written cache.
+    bool Save();
+
+    void Add(uint32_t hash, std::vector<uint32_t> spirv);
+    // Returns an empty span if not found
+    vvl::span<const uint32_t> Get(uint32_t spirv_hash) const;
+    bool IsEmpty() const;
+    bool IsSpirvCached(uint32_t spirv_hash, chassis::CreateShaderModule &chassis_state) const;
+    bool IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::ShaderObject &chassis_state) const;
+
+    static constexpr uint32_t kFileMagic = 0x43535656;  // "VVSC"
+    static constexpr uint32_t kFileVersion = 1;
+
+  private:
+    struct MappedFile;
+
+    mutable std::shared_mutex lock_;
+    std::string path_;
+    std::vector<uint8_t> key_;
+    std::unique_ptr<MappedFile> mapped_file_;
+    // Entries pointing into the mapped file, read only once loaded
+    vvl::unordered_map<uint32_t, vvl::span<const uint32_t>> mapped_shaders_;
+    // Entries instrumented by this run, written out by Save()
+    vvl::unordered_map<uint32_t, std::vector<uint32_t>> added_shaders_;
+};
+
+}  // namespace gpu
@@ -19,7 +19,9 @@
 
 #include "gpu/core/gpu_state_tracker.h"
 #include "chassis/chassis_modification_state.h"
+#include "chassis/memory_report.h"
 
+#include <algorithm>
 #include <regex>
 
 namespace gpu {
@@ -130,40 +132,6 @@ static VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical
     return vmaCreateAllocator(&allocator_info, pAllocator);
 }
 
-void SpirvCache::Add(uint32_t hash, std::vector<uint32_t> spirv) { spirv_shaders_.emplace(hash, std::move(spirv)); }
-
-std::vector<uint32_t> *SpirvCache::Get(uint32_t spirv_hash) {
-    auto it = spirv_shaders_.find(spirv_hash);
-    if (it != spirv_shaders_.end()) {
-        return &it->second;
-    }
-    return nullptr;
-}
-
-bool SpirvCache::IsSpirvCached(uint32_t spirv_hash, chassis::CreateShaderModule &chassis_state) const {
-    auto it = spirv_shaders_.find(spirv_hash);
-    if (it != spirv_shaders_.end()) {
-        const std::vector<uint32_t> &spirv = it->second;
-        chassis_state.instrumented_create_info.codeSize = spirv.size() * sizeof(uint32_t);
-        chassis_state.instrumented_create_info.pCode = spirv.data();
-        chassis_state.instrumented_spirv = spirv;
-        chassis_state.unique_shader_id = spirv_hash;
-        return true;
-    }
-    return false;
-}
-
-bool SpirvCache::IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::ShaderObject &chassis_state) const {
-    auto it = spirv_shaders_.find(spirv_hash);
-    if (it != spirv_shaders_.end()) {
-        const std::vector<uint32_t> &spirv = it->second;
-        chassis_state.instrumented_create_info[index].codeSize = spirv.size() * sizeof(uint32_t);
-        chassis_state.instrumented_create_info[index].pCode = spirv.data();
-        return true;
-    }
-    return false;
-}
-
 ReadLockGuard GpuShaderInstrumentor::ReadLock() const {
     if (fine_grained_locking) {
         return ReadLockGuard(validation_object_mutex, std::defer_lock);
@@ -332,19 +300,36 @@ void GpuShaderInstrumentor::PreCallRecordDestroyDevice(VkDevice device, const Vk
                                                        const RecordObject &record_obj) {
     indices_buffer_.Destroy(vma_allocator_);
 
+    FinishAsyncInstrumentations();
     Cleanup();
 
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
     // State Tracker can end up making vma calls through callbacks - don't destroy allocator until ST is done
-    if (output_buffer_pool_) {
-        vmaDestroyPool(vma_allocator_, output_buffer_pool_);
-    }
+    // Command buffers are all destroyed at this point, so every chunk is back in the pool
+    cmd_buffer_chunk_pool_.reset();
+    output_buffer_pool_.Destroy(vma_allocator_);
+    descriptor_state_pool_.Destroy(vma_allocator_);
+    bda_ranges_pool_.Destroy(vma_allocator_);
+    cmd_buffer_chunk_memory_pool_.Destroy(vma_allocator_);
     if (vma_allocator_) {
         vmaDestroyAllocator(vma_allocator_);
     }
     desc_set_manager_.reset();
 }
 
+void GpuShaderInstrumentor::AddMemoryUsage(vvl::MemoryUsage &usage) const {
+    BaseClass::AddMemoryUsage(usage);
+    if (!vma_allocator_) {
+        return;
+    }
+    // Device memory of the internal buffers (error output, descriptor state, BDA ranges, ...), all allocated through VMA.
+    // Usually host visible, so on unified memory systems it competes with the layer host allocations.
+    VmaTotalStatistics stats{};
+    vmaCalculateStatistics(vma_allocator_, &stats);
+    usage.Add(vvl::MemoryCategory::GpuAV, static_cast<size_t>(stats.total.statistics.blockBytes),
+              stats.total.statistics.allocationCount);
+}
+
 void GpuShaderInstrumentor::ReserveBindingSlot(VkPhysicalDevice physicalDevice, VkPhysicalDeviceLimits &limits,
                                                const Location &loc) {
     // There is an implicit layer that can cause this call to return 0 for maxBoundDescriptorSets - Ignore such calls
@@ -504,7 +489,8 @@ void GpuShaderInstrumentor::PostCallRecordCreateShadersEXT(VkDevice device, uint
 
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         shader_map_.insert_or_assign(chassis_state.unique_shader_ids[i], VK_NULL_HANDLE, VK_NULL_HANDLE, pShaders[i],
-                                     chassis_state.instrumented_spirv[i]);
+                                     std::make_shared<const std::vector<uint32_t>>(std::move(chassis_state.instrumented_spirv[i])),
+                                     std::make_shared<ShaderDebugInfo>());
     }
 }
 
@@ -517,6 +503,156 @@ void GpuShaderInstrumentor::PreCallRecordDestroyShaderEXT(VkDevice device, VkSha
     BaseClass::PreCallRecordDestroyShaderEXT(device, shader, pAllocator, record_obj);
 }
 
+void GpuShaderInstrumentor::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                             const VkAllocationCallbacks *pAllocator,
+                                                             const RecordObject &record_obj) {
+    if (instrumentation_pool_) {
+        if (auto module_state = Get<vvl::ShaderModule>(shaderModule)) {
+            ReleaseAsyncInstrumentation(module_state->gpu_validation_shader_id);
+        }
+    }
+    BaseClass::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator, record_obj);
+}
+
+bool GpuShaderInstrumentor::StartAsyncInstrumentation(std::shared_ptr<const spirv::Module> module_state,
+                                                      uint32_t unique_shader_id, const Location &loc) {
+    if (!instrumentation_pool_ || !module_state) {
+        return false;
+    }
+    std::shared_ptr<AsyncInstrumentation> async;
+    {
+        std::lock_guard<std::mutex> guard(async_instrumentations_lock_);
+        auto it = async_instrumentations_.find(unique_shader_id);
+        if (it != async_instrumentations_.end()) {
+            // Same SPIR-V already being instrumented
+            it->second->module_refs++;
+            return true;
+        }
+        async = std::make_shared<AsyncInstrumentation>();
+        async_instrumentations_.emplace(unique_shader_id, async);
+    }
+
+    instrumentation_pool_->Post(
+        [this, async, module_state, unique_shader_id, loc]() {
+            std::vector<uint32_t> instrumented_spirv;
+            const bool pass = InstrumentShader(module_state->words_, unique_shader_id, loc, instrumented_spirv);
+            if (pass && gpuav_settings.cache_instrumented_shaders) {
+                instrumented_shaders_cache_.Add(unique_shader_id, instrumented_spirv);
+            }
+            {
+                std::lock_guard<std::mutex> guard(async->lock);
+                async->pass = pass;
+                async->instrumented_spirv = std::move(instrumented_spirv);
+                async->done = true;
+            }
+            async->done_cv.notify_all();
+        },
+        instrumentation_tasks_);
+    return true;
+}
+
+VkShaderModule GpuShaderInstrumentor::JoinAsyncInstrumentation(uint32_t unique_shader_id, const Location &loc) {
+    std::shared_ptr<AsyncInstrumentation> async;
+    {
+        std::lock_guard<std::mutex> guard(async_instrumentations_lock_);
+        auto it = async_instrumentations_.find(unique_shader_id);
+        if (it == async_instrumentations_.end()) {
+            return VK_NULL_HANDLE;
+        }
+        async = it->second;
+    }
+
+    std::unique_lock<std::mutex> lock(async->lock);
+    async->done_cv.wait(lock, [&async]() { return async->done; });
+    if (!async->pass) {
+        return VK_NULL_HANDLE;
+    }
+    if (async->instrumented_module == VK_NULL_HANDLE) {
+        VkShaderModuleCreateInfo create_info = vku::InitStructHelper();
+        create_info.pCode = async->instrumented_spirv.data();
+        create_info.codeSize = async->instrumented_spirv.size() * sizeof(uint32_t);
+        if (DispatchCreateShaderModule(device, &create_info, nullptr, &async->instrumented_module) != VK_SUCCESS) {
+            async->pass = false;
+            async->instrumented_module = VK_NULL_HANDLE;
+            InternalWarning(device, loc, "Unable to create the instrumented shader module, using the non-instrumented one.");
+            return VK_NULL_HANDLE;
+        }
+        // The driver has its own copy now
+        async->instrumented_spirv = std::vector<uint32_t>();
+    }
+    return async->instrumented_module;
+}
+
+void GpuShaderInstrumentor::ReleaseAsyncInstrumentation(uint32_t unique_shader_id) {
+    std::shared_ptr<AsyncInstrumentation> async;
+    {
+        std::lock_guard<std::mutex> guard(async_instrumentations_lock_);
+        auto it = async_instrumentations_.find(unique_shader_id);
+        if (it == async_instrumentations_.end() || --it->second->module_refs != 0) {
+            return;
+        }
+        async = std::move(it->second);
+        async_instrumentations_.erase(it);
+    }
+    // Pipelines don't reference the shader modules they were created with, so the instrumented module can go with the last
+    // application module. A still running instrumentation only touches its own (now orphaned) state.
+    std::lock_guard<std::mutex> guard(async->lock);
+    if (async->instrumented_module != VK_NULL_HANDLE) {
+        DispatchDestroyShaderModule(device, async->instrumented_module, nullptr);
+        async->instrumented_module = VK_NULL_HANDLE;
+    }
+}
+
+bool GpuShaderInstrumentor::IsAsyncInstrumentationDone(uint32_t unique_shader_id) {
+    std::shared_ptr<AsyncInstrumentation> async;
+    {
+        std::lock_guard<std::mutex> guard(async_instrumentations_lock_);
+        auto it = async_instrumentations_.find(unique_shader_id);
+        if (it == async_instrumentations_.end()) {
+            return true;
+        }
+        async = it->second;
+    }
+    std::lock_guard<std::mutex> guard(async->lock);
+    return async->done;
+}
+
+void GpuShaderInstrumentor::FinishAsyncInstrumentations() {
+    // The pool outlives the device when other devices use it, only the tasks of this one are waited on
+    if (instrumentation_pool_) {
+        instrumentation_tasks_.Wait();
+    }
+    instrumentation_pool_.reset();
+    for (const auto &entry : async_pipelines_.snapshot()) {
+        const VkPipeline instrumented_pipeline = entry.second->instrumented_pipeline.load(std::memory_order_acquire);
+        if (instrumented_pipeline != VK_NULL_HANDLE) {
+            DispatchDestroyPipeline(device, instrumented_pipeline, nullptr);
+        }
+    }
+    async_pipelines_.clear();
+    std::lock_guard<std::mutex> guard(async_instrumentations_lock_);
+    for (auto &entry : async_instrumentations_) {
+        if (entry.second->instrumented_module != VK_NULL_HANDLE) {
+            DispatchDestroyShaderModule(device, entry.second->instrumented_module, nullptr);
+        }
+    }
+    async_instrumentations_.clear();
+}
+
+VkPipeline GpuShaderInstrumentor::WaitAsyncPipeline(AsyncPipeline &async) {
+    std::unique_lock<std::mutex> lock(async.lock);
+    async.done_cv.wait(lock, [&async]() { return async.done; });
+    return async.instrumented_pipeline.load(std::memory_order_acquire);
+}
+
+VkPipeline GpuShaderInstrumentor::GetInstrumentedPipeline(VkPipeline pipeline) const {
+    auto it = async_pipelines_.find(pipeline);
+    if (it == async_pipelines_.end()) {
+        return VK_NULL_HANDLE;
+    }
+    return it->second->instrumented_pipeline.load(std::memory_order_acquire);
+}
+
 void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                                  const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                                  const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
@@ -588,7 +724,7 @@ void GpuShaderInstrumentor::PostCallRecordCreateGraphicsPipelines(VkDevice devic
                                                      pipeline_states, chassis_state);
     UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, chassis_state.modified_create_infos.data());
     PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, chassis_state.modified_create_infos.data(),
-                                    chassis_state.passed_in_shader_stage_ci);
+                                    chassis_state.passed_in_shader_stage_ci, record_obj.location);
 }
 
 void GpuShaderInstrumentor::PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -600,7 +736,7 @@ void GpuShaderInstrumentor::PostCallRecordCreateComputePipelines(VkDevice device
                                                     pipeline_states, chassis_state);
     UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, chassis_state.modified_create_infos.data());
     PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, chassis_state.modified_create_infos.data(),
-                                    chassis_state.passed_in_shader_stage_ci);
+                                    chassis_state.passed_in_shader_stage_ci, record_obj.location);
 }
 
 void GpuShaderInstrumentor::PostCallRecordCreateRayTracingPipelinesNV(
@@ -611,7 +747,7 @@ void GpuShaderInstrumentor::PostCallRecordCreateRayTracingPipelinesNV(
                                                          record_obj, pipeline_states, chassis_state);
     UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, chassis_state.modified_create_infos.data());
     PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, chassis_state.modified_create_infos.data(),
-                                    chassis_state.passed_in_shader_stage_ci);
+                                    chassis_state.passed_in_shader_stage_ci, record_obj.location);
 }
 
 void GpuShaderInstrumentor::PostCallRecordCreateRayTracingPipelinesKHR(
@@ -622,7 +758,7 @@ void GpuShaderInstrumentor::PostCallRecordCreateRayTracingPipelinesKHR(
                                                           pPipelines, record_obj, pipeline_states, chassis_state);
     UtilCopyCreatePipelineFeedbackData(count, pCreateInfos, chassis_state.modified_create_infos.data());
     PostCallRecordPipelineCreations(count, pCreateInfos, pAllocator, pPipelines, chassis_state.modified_create_infos.data(),
-                                    chassis_state.passed_in_shader_stage_ci);
+                                    chassis_state.passed_in_shader_stage_ci, record_obj.location);
 }
 
 // Remove all the shader trackers associated with this destroyed pipeline.
@@ -632,9 +768,32 @@ void GpuShaderInstrumentor::PreCallRecordDestroyPipeline(VkDevice device, VkPipe
     for (const auto &entry : to_erase) {
         shader_map_.erase(entry.first);
     }
+    if (instrumentation_pool_) {
+        auto async = async_pipelines_.pop(pipeline);
+        if (async != async_pipelines_.end()) {
+            const VkPipeline instrumented_pipeline = WaitAsyncPipeline(*async->second);
+            if (instrumented_pipeline != VK_NULL_HANDLE) {
+                DispatchDestroyPipeline(device, instrumented_pipeline, nullptr);
+            }
+        }
+    }
     BaseClass::PreCallRecordDestroyPipeline(device, pipeline, pAllocator, record_obj);
 }
 
+void GpuShaderInstrumentor::PreCallRecordDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache,
+                                                              const VkAllocationCallbacks *pAllocator,
+                                                              const RecordObject &record_obj) {
+    // Instrumented pipelines might still be getting created with this cache
+    if (instrumentation_pool_ && pipelineCache != VK_NULL_HANDLE) {
+        const auto pending = async_pipelines_.snapshot(
+            [pipelineCache](const std::shared_ptr<AsyncPipeline> &async) { return async->pipeline_cache == pipelineCache; });
+        for (const auto &entry : pending) {
+            WaitAsyncPipeline(*entry.second);
+        }
+    }
+    BaseClass::PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator, record_obj);
+}
+
 template <typename CreateInfo>
 VkShaderModule GetShaderModule(const CreateInfo &create_info, VkShaderStageFlagBits stage) {
     for (uint32_t i = 0; i < create_info.stageCount; ++i) {
@@ -666,6 +825,119 @@ void SetShaderModule(vku::safe_VkComputePipelineCreateInfo &create_info,
     create_info.stage.module = shader_module;
 }
 
+// Point every stage using old_module to new_module
+template <typename SafeType>
+void ReplaceShaderModule(SafeType &create_info, VkShaderModule old_module, VkShaderModule new_module) {
+    for (uint32_t i = 0; i < create_info.stageCount; ++i) {
+        if (create_info.pStages[i].module == old_module) {
+            create_info.pStages[i].module = new_module;
+        }
+    }
+}
+
+template <>
+void ReplaceShaderModule(vku::safe_VkComputePipelineCreateInfo &create_info, VkShaderModule old_module,
+                         VkShaderModule new_module) {
+    if (create_info.stage.module == old_module) {
+        create_info.stage.module = new_module;
+    }
+}
+
+template <typename SafeType>
+bool UsesShaderModule(const SafeType &create_info, VkShaderModule module) {
+    for (uint32_t i = 0; i < create_info.stageCount; ++i) {
+        if (create_info.pStages[i].module == module) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <>
+bool UsesShaderModule(const vku::safe_VkComputePipelineCreateInfo &create_info, VkShaderModule module) {
+    return create_info.stage.module == module;
+}
+
+// The instrumented variant is created on its own, it can't derive from a pipeline of the application batch and has to be
+// compiled even if the application asked not to
+template <typename SafeType>
+void PrepareAsyncPipelineCreateInfo(SafeType &create_info) {
+    create_info.flags &= ~(VK_PIPELINE_CREATE_DERIVATIVE_BIT | VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT);
+    create_info.basePipelineHandle = VK_NULL_HANDLE;
+    create_info.basePipelineIndex = -1;
+    if (auto flags2 = const_cast<VkPipelineCreateFlags2CreateInfoKHR *>(
+            vku::FindStructInPNextChain<VkPipelineCreateFlags2CreateInfoKHR>(create_info.pNext))) {
+        flags2->flags &=
+            ~(VK_PIPELINE_CREATE_2_DERIVATIVE_BIT_KHR | VK_PIPELINE_CREATE_2_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_KHR);
+    }
+}
+
+static VkResult CreateAsyncPipeline(VkDevice device, VkPipelineCache pipeline_cache,
+                                    vku::safe_VkGraphicsPipelineCreateInfo &create_info, VkPipeline *pipeline) {
+    PrepareAsyncPipelineCreateInfo(create_info);
+    return DispatchCreateGraphicsPipelines(device, pipeline_cache, 1, create_info.ptr(), nullptr, pipeline);
+}
+
+static VkResult CreateAsyncPipeline(VkDevice device, VkPipelineCache pipeline_cache,
+                                    vku::safe_VkComputePipelineCreateInfo &create_info, VkPipeline *pipeline) {
+    PrepareAsyncPipelineCreateInfo(create_info);
+    return DispatchCreateComputePipelines(device, pipeline_cache, 1, create_info.ptr(), nullptr, pipeline);
+}
+
+static VkResult CreateAsyncPipeline(VkDevice, VkPipelineCache, vku::safe_VkRayTracingPipelineCreateInfoCommon &, VkPipeline *) {
+    // Never deferred, see CanDeferPipelineInstrumentation
+    assert(false);
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+}
+
+// Only graphics and compute pipelines get their instrumented variant in the background. The application queries the shader
+// group handles of ray tracing pipelines out of its own pipeline, and libraries are what gets linked.
+static bool CanDeferPipelineInstrumentation(const vvl::Pipeline &pipeline) {
+    const bool supported_type =
+        pipeline.pipeline_type == VK_PIPELINE_BIND_POINT_GRAPHICS || pipeline.pipeline_type == VK_PIPELINE_BIND_POINT_COMPUTE;
+    return supported_type && !(pipeline.create_flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR);
+}
+
+template <typename SafeCreateInfo>
+void GpuShaderInstrumentor::StartAsyncPipeline(VkPipeline pipeline, VkPipelineCache pipeline_cache, SafeCreateInfo create_info,
+                                               std::vector<std::pair<VkShaderModule, uint32_t>> pending_modules,
+                                               const Location &loc) {
+    auto async = std::make_shared<AsyncPipeline>();
+    async->pipeline_cache = pipeline_cache;
+    async_pipelines_.insert_or_assign(pipeline, async);
+
+    // The shader instrumentations were posted when their modules were created, so they are already being worked on (or
+    // done) by the time a worker picks this up and waiting on them can't starve the pool
+    instrumentation_pool_->Post(
+        [this, async, create_info = std::move(create_info), pending_modules = std::move(pending_modules), loc]() mutable {
+            bool replaced = false;
+            for (const auto &[module, unique_shader_id] : pending_modules) {
+                const VkShaderModule instrumented_module = JoinAsyncInstrumentation(unique_shader_id, loc);
+                if (instrumented_module != VK_NULL_HANDLE) {
+                    ReplaceShaderModule(create_info, module, instrumented_module);
+                    replaced = true;
+                }
+            }
+            VkPipeline instrumented_pipeline = VK_NULL_HANDLE;
+            if (replaced &&
+                CreateAsyncPipeline(device, async->pipeline_cache, create_info, &instrumented_pipeline) != VK_SUCCESS) {
+                instrumented_pipeline = VK_NULL_HANDLE;
+                InternalWarning(device, loc, "Unable to create the instrumented pipeline, using the non-instrumented one.");
+            }
+            // Drop the references taken in PostCallRecord, the instrumented modules are not needed past pipeline creation
+            for (const auto &[module, unique_shader_id] : pending_modules) {
+                ReleaseAsyncInstrumentation(unique_shader_id);
+            }
+            {
+                std::lock_guard<std::mutex> guard(async->lock);
+                async->instrumented_pipeline.store(instrumented_pipeline, std::memory_order_release);
+                async->done = true;
+            }
+            async->done_cv.notify_all();
+        },
+        instrumentation_tasks_);
+}
+
 template <typename CreateInfo, typename StageInfo>
 StageInfo &GetShaderStageCI(CreateInfo &ci, VkShaderStageFlagBits stage) {
     static StageInfo null_stage{};
@@ -694,6 +966,18 @@ bool GpuShaderInstrumentor::CheckForGpuAvEnabled(const void *pNext) {
     return false;
 }
 
+// When linking graphics pipeline libraries, the library stages were already instrumented (or replaced) when the library itself
+// was created, and that is what gets linked. There is nothing left to do for them in the linked pipeline.
+static bool IsStageFromLibrary(const vvl::Pipeline &pipeline, VkShaderStageFlagBits stage) {
+    if (pipeline.pipeline_type != VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        return false;
+    }
+    if (stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+        return pipeline.fragment_shader_state && !pipeline.OwnsSubState(pipeline.fragment_shader_state);
+    }
+    return pipeline.pre_raster_state && !pipeline.OwnsSubState(pipeline.pre_raster_state);
+}
+
 // Examine the pipelines to see if they use the debug descriptor set binding index.
 // If any do, create new non-instrumented shader modules and use them to replace the instrumented
 // shaders in the pipeline.  Return the (possibly) modified create infos to the caller.
@@ -725,6 +1009,9 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
         if (replace_shaders) {
             for (uint32_t i = 0; i < static_cast<uint32_t>(pipe->stage_states.size()); ++i) {
                 const auto &stage = pipe->stage_states[i];
+                if (IsStageFromLibrary(*pipe, stage.GetStage())) {
+                    continue;
+                }
                 const auto &spirv_state = stage.spirv_state;
 
                 VkShaderModule shader_module;
@@ -744,9 +1031,27 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
             //
             // This also could be because safe_VkShaderModuleCreateInfo is passed in the pNext of VkPipelineShaderStageCreateInfo
             for (const auto &stage_state : pipe->stage_states) {
+                if (IsStageFromLibrary(*pipe, stage_state.GetStage())) {
+                    continue;
+                }
                 auto module_state = std::const_pointer_cast<vvl::ShaderModule>(stage_state.module_state);
                 ASSERT_AND_CONTINUE(module_state);
-                if (module_state->Handle()) continue;
+                if (module_state->Handle()) {
+                    // Shader modules instrumented in the background are only waited on now
+                    if (instrumentation_pool_) {
+                        if (gpuav_settings.async_pipeline_instrumentation && CanDeferPipelineInstrumentation(*pipe) &&
+                            !IsAsyncInstrumentationDone(module_state->gpu_validation_shader_id)) {
+                            // Keep the application module, PostCallRecord queues the instrumented variant
+                            continue;
+                        }
+                        const VkShaderModule instrumented_module =
+                            JoinAsyncInstrumentation(module_state->gpu_validation_shader_id, record_obj.location);
+                        if (instrumented_module != VK_NULL_HANDLE) {
+                            ReplaceShaderModule(new_pipeline_ci, module_state->VkHandle(), instrumented_module);
+                        }
+                    }
+                    continue;
+                }
 
                 const VkShaderStageFlagBits stage = stage_state.GetStage();
                 // Now find the corresponding VkShaderModuleCreateInfo
@@ -778,8 +1083,9 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
                 if (gpuav_settings.cache_instrumented_shaders) {
                     unique_shader_id =
                         hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
-                    if (const auto spirv = instrumented_shaders_cache_.Get(unique_shader_id)) {
-                        instrumented_spirv = *spirv;
+                    const vvl::span<const uint32_t> spirv = instrumented_shaders_cache_.Get(unique_shader_id);
+                    if (!spirv.empty()) {
+                        instrumented_spirv.assign(spirv.begin(), spirv.end());
                         cached = true;
                     }
                 } else {
@@ -818,7 +1124,7 @@ template <typename CreateInfo, typename SafeCreateInfo>
 void GpuShaderInstrumentor::PostCallRecordPipelineCreations(const uint32_t count, const CreateInfo *pCreateInfos,
                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                             const SafeCreateInfo &modified_create_infos,
-                                                            bool passed_in_shader_stage_ci) {
+                                                            bool passed_in_shader_stage_ci, const Location &loc) {
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
         auto pipeline_state = Get<vvl::Pipeline>(pPipelines[pipeline]);
         if (!pipeline_state) continue;
@@ -828,27 +1134,63 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreations(const uint32_t count
             for (auto &stage_state : pipeline_state->stage_states) {
                 auto &module_state = stage_state.module_state;
 
-                if (pipeline_state->active_slots.find(desc_set_bind_index_) != pipeline_state->active_slots.end() ||
-                    (pipeline_layout->set_layouts.size() > desc_set_bind_index_)) {
+                if (!IsStageFromLibrary(*pipeline_state, stage_state.GetStage()) &&
+                    (pipeline_state->active_slots.find(desc_set_bind_index_) != pipeline_state->active_slots.end() ||
+                     (pipeline_layout->set_layouts.size() > desc_set_bind_index_))) {
                     auto *modified_ci = reinterpret_cast<const CreateInfo *>(modified_create_infos[pipeline].ptr());
                     auto uninstrumented_module = GetShaderModule(*modified_ci, stage_state.GetStage());
                     assert(uninstrumented_module != module_state->VkHandle());
                     DispatchDestroyShaderModule(device, uninstrumented_module, pAllocator);
                 }
 
-                std::vector<unsigned int> code;
-                // Save the shader binary
-                // The core_validation ShaderModule tracker saves the binary too, but discards it when the ShaderModule
-                // is destroyed.  Applications may destroy ShaderModules after they are placed in a pipeline and before
-                // the pipeline is used, so we have to keep another copy.
-                if (module_state && module_state->spirv) code = module_state->spirv->words_;
+                // Keep the shader binary alive
+                // The core_validation ShaderModule tracker drops its reference when the ShaderModule is destroyed. Applications
+                // may destroy ShaderModules after they are placed in a pipeline and before the pipeline is used, so we hold onto
+                // the SPIR-V ourselves. Pipelines sharing a shader (every pipeline linked with the same library) share it too.
+                std::shared_ptr<const std::vector<uint32_t>> code;
+                if (module_state && module_state->spirv) {
+                    code = std::shared_ptr<const std::vector<uint32_t>>(module_state->spirv, &module_state->spirv->words_);
+                }
 
                 VkShaderModule shader_module_handle = module_state->VkHandle();
                 if (shader_module_handle == VK_NULL_HANDLE && passed_in_shader_stage_ci) {
                     shader_module_handle = kPipelineStageInfoHandle;
                 }
                 shader_map_.insert_or_assign(module_state->gpu_validation_shader_id, pipeline_state->VkHandle(),
-                                             shader_module_handle, VK_NULL_HANDLE, std::move(code));
+                                             shader_module_handle, VK_NULL_HANDLE, std::move(code),
+                                             std::make_shared<ShaderDebugInfo>());
+            }
+        }
+
+        if (instrumentation_pool_ && gpuav_settings.async_pipeline_instrumentation &&
+            CanDeferPipelineInstrumentation(*pipeline_state)) {
+            // Modules PreCallRecord did not wait for are still in the create info
+            const auto &modified_ci = modified_create_infos[pipeline];
+            std::vector<std::pair<VkShaderModule, uint32_t>> pending_modules;
+            {
+                std::lock_guard<std::mutex> guard(async_instrumentations_lock_);
+                for (const auto &stage_state : pipeline_state->stage_states) {
+                    const auto &module_state = stage_state.module_state;
+                    if (!module_state || !module_state->Handle() || !UsesShaderModule(modified_ci, module_state->VkHandle())) {
+                        continue;
+                    }
+                    auto it = async_instrumentations_.find(module_state->gpu_validation_shader_id);
+                    if (it == async_instrumentations_.end()) {
+                        continue;
+                    }
+                    // The application can destroy its module right away, keep the instrumentation until the variant exists
+                    it->second->module_refs++;
+                    pending_modules.emplace_back(module_state->VkHandle(), module_state->gpu_validation_shader_id);
+                }
+            }
+            if (!pending_modules.empty()) {
+                // An externally synchronized cache can't be used from a worker thread
+                VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+                if (pipeline_state->pipeline_cache &&
+                    !(pipeline_state->pipeline_cache->create_info.flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT)) {
+                    pipeline_cache = pipeline_state->pipeline_cache->VkHandle();
+                }
+                StartAsyncPipeline(pipeline_state->VkHandle(), pipeline_cache, modified_ci, std::move(pending_modules), loc);
             }
         }
     }
@@ -883,44 +1225,81 @@ void GpuShaderInstrumentor::InternalWarning(LogObjectList objlist, const Locatio
     LogWarning(vuid, objlist, loc, "Internal Warning: %s", specific_message);
 }
 
-// The lock (debug_output_mutex) is held by the caller,
-// because the latter has code paths that make multiple calls of this function,
-// and all such calls have to access the same debug reporting state to ensure consistency of output information.
-static std::string LookupDebugUtilsNameNoLock(const DebugReport *debug_report, const uint64_t object) {
-    auto object_label = debug_report->GetUtilsObjectNameNoLock(object);
+static std::string LookupDebugUtilsName(const DebugReport *debug_report, const uint64_t object) {
+    auto object_label = debug_report->GetUtilsObjectName(object);
     if (object_label != "") {
         object_label = "(" + object_label + ")";
     }
     return object_label;
 }
 
-// Read the contents of the SPIR-V OpSource instruction and any following continuation instructions.
-// Split the single string into a vector of strings, one for each line, for easier processing.
-static void ReadOpSource(const std::vector<spirv::Instruction> &instructions, const uint32_t reported_file_id,
-                         std::vector<std::string> &opsource_lines) {
-    for (size_t i = 0; i < instructions.size(); i++) {
-        const spirv::Instruction &insn = instructions[i];
-        if ((insn.Opcode() == spv::OpSource) && (insn.Length() >= 5) && (insn.Word(3) == reported_file_id)) {
-            std::istringstream in_stream;
-            std::string cur_line;
-            in_stream.str(insn.GetAsString(4));
-            while (std::getline(in_stream, cur_line)) {
-                opsource_lines.push_back(cur_line);
+// Split the string of an OpSource or OpSourceContinued into lines
+static void AppendSourceLines(const char *source, std::vector<std::string> &source_lines) {
+    std::istringstream in_stream(source);
+    std::string cur_line;
+    while (std::getline(in_stream, cur_line)) {
+        source_lines.push_back(cur_line);
+    }
+}
+
+void ShaderDebugInfo::Decode(const std::vector<uint32_t> &spirv) {
+    std::call_once(decoded_, [this, &spirv]() {
+        // The header is 5 words, and we rather not report the SPIR-V debug info than crash on a truncated module
+        if (spirv.size() <= 5) {
+            return;
+        }
+        uint32_t instruction_position = 0;
+        bool in_debug_section = true;
+        // File of the last OpSource, where the OpSourceContinued following it go
+        File *continued_file = nullptr;
+        for (const uint32_t *it = spirv.data() + 5, *end = spirv.data() + spirv.size(); it < end; instruction_position++) {
+            const uint32_t length = *it >> 16;
+            if (length == 0 || length > uint32_t(end - it)) {
+                break;
             }
+            const spirv::Instruction insn(it);
+            it += length;
 
-            for (size_t k = i + 1; k < instructions.size(); k++) {
-                const spirv::Instruction &continue_insn = instructions[k];
-                if (continue_insn.Opcode() != spv::OpSourceContinued) {
-                    break;
+            const uint32_t opcode = insn.Opcode();
+            if (opcode != spv::OpSourceContinued) {
+                continued_file = nullptr;
+            }
+            if (opcode == spv::OpLine) {
+                lines_.emplace_back(Line{instruction_position, insn.Word(1), insn.Word(2), insn.Word(3)});
+            } else if (opcode == spv::OpFunction) {
+                in_debug_section = false;
+            } else if (opcode == spv::OpString && in_debug_section && insn.Length() >= 3) {
+                File &file = files_[insn.Word(1)];
+                // Only the first OpString of an ID is used
+                if (!file.found_string) {
+                    file.found_string = true;
+                    file.name = insn.GetAsString(2);
                 }
-                in_stream.str(continue_insn.GetAsString(1));
-                while (std::getline(in_stream, cur_line)) {
-                    opsource_lines.push_back(cur_line);
+            } else if (opcode == spv::OpSource && insn.Length() >= 5) {
+                File &file = files_[insn.Word(3)];
+                // Only the first OpSource of a file is used
+                if (file.source_lines.empty()) {
+                    AppendSourceLines(insn.GetAsString(4), file.source_lines);
+                    continued_file = &file;
                 }
+            } else if (opcode == spv::OpSourceContinued && continued_file) {
+                AppendSourceLines(insn.GetAsString(1), continued_file->source_lines);
             }
-            break;
         }
-    }
+        lines_.shrink_to_fit();
+    });
+}
+
+const ShaderDebugInfo::Line *ShaderDebugInfo::FindLine(uint32_t instruction_position) const {
+    // SPIR-V can only be iterated in the forward direction, the OpLine were recorded once in order of position
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), instruction_position,
+                               [](uint32_t position, const Line &line) { return position < line.instruction_position; });
+    return it == lines_.begin() ? nullptr : &*std::prev(it);
+}
+
+const ShaderDebugInfo::File *ShaderDebugInfo::FindFile(uint32_t file_id) const {
+    auto it = files_.find(file_id);
+    return it == files_.end() ? nullptr : &it->second;
 }
 
 // The task here is to search the OpSource content to find the #line directive with the
@@ -968,25 +1347,25 @@ static bool GetLineAndFilename(const std::string &string, uint32_t *linenumber,
 }
 
 // Where we build up the error message with all the useful debug information about where the error occured
-std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(
-    VkCommandBuffer commandBuffer, const std::vector<spirv::Instruction> &instructions, uint32_t instruction_position,
-    const gpu::GpuAssistedShaderTracker *tracker_info, VkPipelineBindPoint pipeline_bind_point, uint32_t operation_index) const {
+std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(VkCommandBuffer commandBuffer, uint32_t instruction_position,
+                                                            const gpu::GpuAssistedShaderTracker *tracker_info,
+                                                            VkPipelineBindPoint pipeline_bind_point,
+                                                            uint32_t operation_index) const {
     std::ostringstream ss;
-    if (instructions.empty() || !tracker_info) {
+    if (!tracker_info || !tracker_info->instrumented_spirv || tracker_info->instrumented_spirv->empty() ||
+        !tracker_info->debug_info) {
         ss << "[Internal Error] - Can't get instructions from shader_map\n";
         return ss.str();
     }
 
     ss << std::hex << std::showbase;
     if (tracker_info->shader_module == VK_NULL_HANDLE && tracker_info->shader_object == VK_NULL_HANDLE) {
-        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
         ss << "[Internal Error] - Unable to locate shader/pipeline handles used in command buffer "
-           << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
+           << LookupDebugUtilsName(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
            << ")\n";
         assert(true);
     } else {
-        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
-        ss << "Command buffer " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(commandBuffer)) << "("
+        ss << "Command buffer " << LookupDebugUtilsName(debug_report, HandleToUint64(commandBuffer)) << "("
            << HandleToUint64(commandBuffer) << ")\n";
 
         ss << std::dec << std::noshowbase;
@@ -1005,15 +1384,15 @@ std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(
         ss << std::hex << std::noshowbase;
 
         if (tracker_info->shader_module == VK_NULL_HANDLE) {
-            ss << "Shader Object " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(tracker_info->shader_object)) << "("
+            ss << "Shader Object " << LookupDebugUtilsName(debug_report, HandleToUint64(tracker_info->shader_object)) << "("
                << HandleToUint64(tracker_info->shader_object) << ")\n";
         } else {
-            ss << "Pipeline " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(tracker_info->pipeline)) << "("
+            ss << "Pipeline " << LookupDebugUtilsName(debug_report, HandleToUint64(tracker_info->pipeline)) << "("
                << HandleToUint64(tracker_info->pipeline) << ")\n";
             if (tracker_info->shader_module == gpu::kPipelineStageInfoHandle) {
                 ss << "Shader Module was passed in via VkPipelineShaderStageCreateInfo::pNext\n";
             } else {
-                ss << "Shader Module " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(tracker_info->shader_module))
+                ss << "Shader Module " << LookupDebugUtilsName(debug_report, HandleToUint64(tracker_info->shader_module))
                    << "(" << HandleToUint64(tracker_info->shader_module) << ")\n";
             }
         }
@@ -1022,23 +1401,14 @@ std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(
     ss << std::dec << std::noshowbase;
     ss << "SPIR-V Instruction Index = " << instruction_position << "\n";
 
+    ShaderDebugInfo &debug_info = *tracker_info->debug_info;
+    debug_info.Decode(*tracker_info->instrumented_spirv);
+
     // Find the OpLine just before the failing instruction indicated by the debug info.
-    // SPIR-V can only be iterated in the forward direction due to its opcode/length encoding.
-    uint32_t index = 0;
-    uint32_t reported_file_id = 0;
-    uint32_t reported_line_number = 0;
-    uint32_t reported_column_number = 0;
-    for (const spirv::Instruction &insn : instructions) {
-        if (insn.Opcode() == spv::OpLine) {
-            reported_file_id = insn.Word(1);
-            reported_line_number = insn.Word(2);
-            reported_column_number = insn.Word(3);
-        }
-        if (index == instruction_position) {
-            break;
-        }
-        index++;
-    }
+    const ShaderDebugInfo::Line *reported_line = debug_info.FindLine(instruction_position);
+    const uint32_t reported_file_id = reported_line ? reported_line->file_id : 0;
+    const uint32_t reported_line_number = reported_line ? reported_line->line : 0;
+    const uint32_t reported_column_number = reported_line ? reported_line->column : 0;
 
     if (reported_file_id == 0) {
         ss << "Unable to find SPIR-V OpLine for source information.  Build shader with debug info to get source information.\n";
@@ -1053,37 +1423,29 @@ std::string GpuShaderInstrumentor::GenerateDebugInfoMessage(
     }
 
     // Create message with file information obtained from the OpString pointed to by the discovered OpLine.
-    bool found_opstring = false;
+    const ShaderDebugInfo::File *reported_file = debug_info.FindFile(reported_file_id);
     std::string reported_filename;
-    for (const spirv::Instruction &insn : instructions) {
-        if (insn.Opcode() == spv::OpString && insn.Length() >= 3 && insn.Word(1) == reported_file_id) {
-            found_opstring = true;
-            reported_filename = insn.GetAsString(2);
-            if (reported_filename.empty()) {
-                ss << prefix << "at line " << reported_line_number;
-            } else {
-                ss << prefix << "in file " << reported_filename << " at line " << reported_line_number;
-            }
-            if (reported_column_number > 0) {
-                ss << ", column " << reported_column_number;
-            }
-            ss << "\n";
-            break;
+    if (reported_file && reported_file->found_string) {
+        reported_filename = reported_file->name;
+        if (reported_filename.empty()) {
+            ss << prefix << "at line " << reported_line_number;
+        } else {
+            ss << prefix << "in file " << reported_filename << " at line " << reported_line_number;
         }
-        // OpString can only be in the debug section, so can break early if not found
-        if (insn.Opcode() == spv::OpFunction) break;
-    }
-
-    if (!found_opstring) {
+        if (reported_column_number > 0) {
+            ss << ", column " << reported_column_number;
+        }
+        ss << "\n";
+    } else {
         ss << "Unable to find SPIR-V OpString from OpLine instruction.\n";
         ss << "File ID = " << reported_file_id << ", Line Number = " << reported_line_number
            << ", Column = " << reported_column_number << "\n";
     }
 
     // Create message to display source code line containing error.
-    // Read the source code and split it up into separate lines.
-    std::vector<std::string> opsource_lines;
-    ReadOpSource(instructions, reported_file_id, opsource_lines);
+    // The source code was split up into separate lines when decoding the debug info.
+    static const std::vector<std::string> kNoSourceLines;
+    const std::vector<std::string> &opsource_lines = reported_file ? reported_file->source_lines : kNoSourceLines;
     // Find the line in the OpSource content that corresponds to the reported error file and line.
     if (!opsource_lines.empty()) {
         uint32_t saved_line_number = 0;
@@ -19,9 +19,16 @@
 #include "containers/custom_containers.h"
 #include "generated/chassis.h"
 #include "gpu/core/gpu_state_tracker.h"
+#include "gpu/instrumentation/gpu_shader_cache.h"
 #include "gpu/resources/gpu_resources.h"
+#include "utils/worker_pool.h"
 #include "vma/vma.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace gpuav {
@@ -42,24 +49,44 @@ static const VkShaderModule kPipelineStageInfoHandle = CastFromUint64<VkShaderMo
 // We set a reasonable max because we have to pad the pipeline layout with dummy descriptor set layouts.
 static const uint32_t kMaxAdjustedBoundDescriptorSet = 33;
 
-class SpirvCache {
+// Source locations of a shader, decoded from its OpLine, OpString and OpSource instructions the first time one of its errors
+// (or verbose printf) is reported, and reused by the following ones. Nothing is decoded for the shaders that never report.
+class ShaderDebugInfo {
   public:
-    void Add(uint32_t hash, std::vector<uint32_t> spirv);
-    std::vector<uint32_t> *Get(uint32_t spirv_hash);
-    bool IsEmpty() { return spirv_shaders_.empty(); }
-    bool IsSpirvCached(uint32_t spirv_hash, chassis::CreateShaderModule &chassis_state) const;
-    bool IsSpirvCached(uint32_t index, uint32_t spirv_hash, chassis::ShaderObject &chassis_state) const;
+    struct Line {
+        uint32_t instruction_position;
+        uint32_t file_id;
+        uint32_t line;
+        uint32_t column;
+    };
+    struct File {
+        bool found_string = false;
+        std::string name;
+        // Content of the OpSource (and OpSourceContinued) of the file, one string per line
+        std::vector<std::string> source_lines;
+    };
+
+    // Thread safe, the first call decodes the SPIR-V and the others wait for it
+    void Decode(const std::vector<uint32_t> &spirv);
+    // Last OpLine at or before the instruction, null if there is none
+    const Line *FindLine(uint32_t instruction_position) const;
+    const File *FindFile(uint32_t file_id) const;
 
   private:
-    friend class gpuav::Validator;
-    vvl::unordered_map<uint32_t, std::vector<uint32_t>> spirv_shaders_{};
+    std::once_flag decoded_;
+    // Sorted by instruction position
+    std::vector<Line> lines_;
+    vvl::unordered_map<uint32_t, File> files_;
 };
 
 struct GpuAssistedShaderTracker {
     VkPipeline pipeline;
     VkShaderModule shader_module;
     VkShaderEXT shader_object;
-    std::vector<uint32_t> instrumented_spirv;
+    // Shared, rather than copied, since the same shader can be tracked for many pipelines (shaders coming from pipeline
+    // libraries end up in every pipeline linked with them)
+    std::shared_ptr<const std::vector<uint32_t>> instrumented_spirv;
+    std::shared_ptr<ShaderDebugInfo> debug_info;
 };
 
 // Interface common to both GPU-AV and DebugPrintF.
@@ -77,6 +104,7 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     void PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                     const RecordObject &record_obj) override;
+    void AddMemoryUsage(vvl::MemoryUsage &usage) const override;
 
     void ReserveBindingSlot(VkPhysicalDevice physicalDevice, VkPhysicalDeviceLimits &limits, const Location &loc);
     void PostCallRecordGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
@@ -111,6 +139,8 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
                                         const RecordObject &record_obj, chassis::ShaderObject &chassis_state) override;
     void PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks *pAllocator,
                                        const RecordObject &record_obj) override;
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks *pAllocator,
+                                          const RecordObject &record_obj) override;
 
     void PreCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                               const VkGraphicsPipelineCreateInfo *pCreateInfos,
@@ -156,14 +186,16 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
                                                     chassis::CreateRayTracingPipelinesKHR &chassis_state) override;
     void PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator,
                                       const RecordObject &record_obj) override;
+    void PreCallRecordDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks *pAllocator,
+                                           const RecordObject &record_obj) override;
 
     void InternalError(LogObjectList objlist, const Location &loc, const char *const specific_message, bool vma_fail = false) const;
     void InternalWarning(LogObjectList objlist, const Location &loc, const char *const specific_message) const;
     bool CheckForGpuAvEnabled(const void *pNext);
 
-    std::string GenerateDebugInfoMessage(VkCommandBuffer commandBuffer, const std::vector<spirv::Instruction> &instructions,
-                                         uint32_t instruction_position, const gpu::GpuAssistedShaderTracker *tracker_info,
-                                         VkPipelineBindPoint pipeline_bind_point, uint32_t operation_index) const;
+    std::string GenerateDebugInfoMessage(VkCommandBuffer commandBuffer, uint32_t instruction_position,
+                                         const gpu::GpuAssistedShaderTracker *tracker_info, VkPipelineBindPoint pipeline_bind_point,
+                                         uint32_t operation_index) const;
 
   protected:
     std::shared_ptr<vvl::Queue> CreateQueue(VkQueue q, uint32_t family_index, uint32_t queue_index, VkDeviceQueueCreateFlags flags,
@@ -177,7 +209,8 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     template <typename CreateInfo, typename SafeCreateInfo>
     void PostCallRecordPipelineCreations(const uint32_t count, const CreateInfo *pCreateInfos,
                                          const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
-                                         const SafeCreateInfo &modified_create_infos, bool passed_in_shader_stage_ci);
+                                         const SafeCreateInfo &modified_create_infos, bool passed_in_shader_stage_ci,
+                                         const Location &loc);
 
     // GPU-AV and DebugPrint are going to have a different way to do the actual shader instrumentation logic
     // Returns if shader was instrumented successfully or not
@@ -186,8 +219,52 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
 
     VkDescriptorSetLayout GetDebugDescriptorSetLayout() { return debug_desc_layout_; }
 
+    // Shader module instrumentation running on instrumentation_pool_.
+    // The application module is handed to the driver as is, the first pipeline using it waits for the instrumentation and
+    // creates the instrumented module, which then replaces the application one in every pipeline create info.
+    struct AsyncInstrumentation {
+        std::mutex lock;
+        std::condition_variable done_cv;
+        bool done = false;
+        bool pass = false;
+        std::vector<uint32_t> instrumented_spirv;
+        VkShaderModule instrumented_module = VK_NULL_HANDLE;
+        // Application shader modules sharing this instrumentation (identical SPIR-V when caching), guarded by
+        // async_instrumentations_lock_
+        uint32_t module_refs = 1;
+    };
+    // Returns false if there is no instrumentation pool and the shader has to be instrumented in place
+    bool StartAsyncInstrumentation(std::shared_ptr<const spirv::Module> module_state, uint32_t unique_shader_id,
+                                   const Location &loc);
+    // Returns the instrumented module to use instead of the application one, or VK_NULL_HANDLE if there is none
+    VkShaderModule JoinAsyncInstrumentation(uint32_t unique_shader_id, const Location &loc);
+    void ReleaseAsyncInstrumentation(uint32_t unique_shader_id);
+    // Returns true if there is no instrumentation running for this shader
+    bool IsAsyncInstrumentationDone(uint32_t unique_shader_id);
+    // Waits for all the queued instrumentations and pipelines, destroys the instrumented modules and pipelines
+    void FinishAsyncInstrumentations();
+
+    // Pipeline created while the instrumentation of some of its shader modules was still running
+    // (gpuav_async_pipeline_instrumentation). Instead of waiting, the application pipeline is created with the original
+    // modules and a copy of the create info is used on instrumentation_pool_ to create the instrumented variant, going
+    // through the application pipeline cache. Once ready, the variant is bound in place of the application pipeline.
+    struct AsyncPipeline {
+        std::mutex lock;
+        std::condition_variable done_cv;
+        bool done = false;
+        VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+        std::atomic<VkPipeline> instrumented_pipeline{VK_NULL_HANDLE};
+    };
+    template <typename SafeCreateInfo>
+    void StartAsyncPipeline(VkPipeline pipeline, VkPipelineCache pipeline_cache, SafeCreateInfo create_info,
+                            std::vector<std::pair<VkShaderModule, uint32_t>> pending_modules, const Location &loc);
+    // Waits for the instrumented variant, returns VK_NULL_HANDLE if it could not be created
+    VkPipeline WaitAsyncPipeline(AsyncPipeline &async);
+
   public:
     VkPipelineLayout GetDebugPipelineLayout() { return debug_pipeline_layout_; }
+    // Pipeline to bind instead of the application one, VK_NULL_HANDLE if there is none (yet)
+    VkPipeline GetInstrumentedPipeline(VkPipeline pipeline) const;
 
     // When aborting we will disconnect all future chassis calls.
     // If we are deep into a call stack, we can use this to return up to the chassis call.
@@ -201,12 +278,27 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     // The descriptor slot we will be injecting our error buffer into
     uint32_t desc_set_bind_index_ = 0;
     VmaAllocator vma_allocator_ = {};
-    VmaPool output_buffer_pool_ = VK_NULL_HANDLE;
+    // Error output buffers and other small buffers read back after each submission
+    BufferPool output_buffer_pool_;
+    // Descriptor (binding layout and descriptor state) buffers, written on the CPU and read by the instrumentation
+    BufferPool descriptor_state_pool_;
+    // Buffer device address ranges snapshots
+    BufferPool bda_ranges_pool_;
+    // Memory of the cmd_buffer_chunk_pool_ chunks
+    BufferPool cmd_buffer_chunk_memory_pool_;
     std::unique_ptr<DescriptorSetManager> desc_set_manager_;
+    // Backs the small per command data command buffers suballocate while recording
+    std::unique_ptr<BufferChunkPool> cmd_buffer_chunk_pool_;
     vvl::concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map_;
     std::vector<VkDescriptorSetLayoutBinding> instrumentation_bindings_;
     SpirvCache instrumented_shaders_cache_;
     DeviceMemoryBlock indices_buffer_{};
+    // Only set with gpuav_async_shader_instrumentation, the pool is shared with the rest of the process
+    std::shared_ptr<vvl::WorkerPool> instrumentation_pool_;
+    vvl::TaskGroup instrumentation_tasks_;
+    std::mutex async_instrumentations_lock_;
+    vvl::unordered_map<uint32_t, std::shared_ptr<AsyncInstrumentation>> async_instrumentations_;
+    vvl::concurrent_unordered_map<VkPipeline, std::shared_ptr<AsyncPipeline>> async_pipelines_;
 
   private:
     void Cleanup();
@@ -25,6 +25,7 @@
 #include "gpu/spirv/module.h"
 #include "state_tracker/shader_stage_state.h"
 #include "state_tracker/shader_instruction.h"
+#include "utils/trace_markers.h"
 #include "spirv-tools/optimizer.hpp"
 
 #include <fstream>
@@ -49,6 +50,8 @@ static bool GpuValidateShader(const std::vector<uint32_t> &input, bool SetRelaxB
 bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, uint32_t unique_shader_id, const Location &loc,
                                  std::vector<uint32_t> &out_instrumented_spirv) {
     if (input[0] != spv::MagicNumber) return false;
+    VVL_TRACE_SCOPE("gpuav::Validator::InstrumentShader");
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::GpuAvInstrumentation);
 
     const spvtools::MessageConsumer gpu_console_message_consumer =
         [this, loc](spv_message_level_t level, const char *, const spv_position_t &position, const char *message) -> void {
@@ -79,7 +82,7 @@ bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, uint32_
     spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
 
     // Use the unique_shader_id as a shader ID so we can look up its handle later in the shader_map.
-    spirv::Module module(binaries[0], unique_shader_id, desc_set_bind_index_);
+    spirv::Module module(binaries[0], unique_shader_id, desc_set_bind_index_, link_libraries_, validation_worker_pool.get());
 
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
     if (gpuav_settings.validate_descriptors) {
@@ -153,7 +156,7 @@ bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, uint32_
     return true;
 }
 
-void SetupShaderInstrumentationResources(Validator &gpuav, LockedSharedPtr<CommandBuffer, WriteLockGuard> &cmd_buffer,
+void SetupShaderInstrumentationResources(Validator &gpuav, LockedSharedPtr<CommandBuffer, RecordingWriteLockGuard> &cmd_buffer,
                                          VkPipelineBindPoint bind_point, const Location &loc) {
     if (bind_point != VK_PIPELINE_BIND_POINT_GRAPHICS && bind_point != VK_PIPELINE_BIND_POINT_COMPUTE &&
         bind_point != VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
@@ -246,10 +249,10 @@ void SetupShaderInstrumentationResources(Validator &gpuav, LockedSharedPtr<Comma
 
         // Current bindless buffer
         VkDescriptorBufferInfo di_input_desc_buffer_info = {};
-        if (cmd_buffer->current_bindless_buffer != VK_NULL_HANDLE) {
-            di_input_desc_buffer_info.range = VK_WHOLE_SIZE;
-            di_input_desc_buffer_info.buffer = cmd_buffer->current_bindless_buffer;
-            di_input_desc_buffer_info.offset = 0;
+        if (!cmd_buffer->current_bindless_buffer.IsNull()) {
+            di_input_desc_buffer_info.range = cmd_buffer->current_bindless_buffer.size;
+            di_input_desc_buffer_info.buffer = cmd_buffer->current_bindless_buffer.buffer;
+            di_input_desc_buffer_info.offset = cmd_buffer->current_bindless_buffer.offset;
 
             VkWriteDescriptorSet wds = vku::InitStructHelper();
             wds.dstBinding = glsl::kBindingInstBindlessDescriptor;
@@ -676,13 +679,8 @@ bool LogInstrumentationError(Validator &gpuav, VkCommandBuffer cmd_buffer, const
         }
 
         // If we somehow can't find our state, we can still report our error message
-        std::vector<::spirv::Instruction> instructions;
-        if (tracker_info) {
-            ::spirv::GenerateInstructions(tracker_info->instrumented_spirv, instructions);
-        }
-        std::string debug_info_message =
-            gpuav.GenerateDebugInfoMessage(cmd_buffer, instructions, error_record[gpuav::glsl::kHeaderInstructionIdOffset],
-                                           tracker_info, pipeline_bind_point, operation_index);
+        std::string debug_info_message = gpuav.GenerateDebugInfoMessage(
+            cmd_buffer, error_record[gpuav::glsl::kHeaderInstructionIdOffset], tracker_info, pipeline_bind_point, operation_index);
 
         // TODO - Need to unify with debug printf
         std::string stage_message;
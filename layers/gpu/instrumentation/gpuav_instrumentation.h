@@ -21,7 +21,8 @@
 
 namespace gpuav {
 
-void SetupShaderInstrumentationResources(Validator& gpuav, LockedSharedPtr<gpuav::CommandBuffer, WriteLockGuard>& cmd_buffer,
+void SetupShaderInstrumentationResources(Validator& gpuav,
+                                         LockedSharedPtr<gpuav::CommandBuffer, RecordingWriteLockGuard>& cmd_buffer,
                                          VkPipelineBindPoint bind_point, const Location& loc);
 void SetupShaderInstrumentationResources(Validator& gpuav, VkCommandBuffer cmd_buffer, VkPipelineBindPoint bind_point,
                                          const Location& loc);
@@ -135,6 +135,31 @@ void DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDe
     return;
 }
 
+void DescriptorSetManager::PutBackDescriptorSets(VkDescriptorPool desc_pool, const std::vector<VkDescriptorSet> &desc_sets) {
+    if (desc_sets.empty()) {
+        return;
+    }
+    auto guard = Lock();
+
+    auto iter = desc_pool_map_.find(desc_pool);
+    assert(iter != desc_pool_map_.end());
+    if (iter == desc_pool_map_.end()) {
+        return;
+    }
+
+    VkResult result =
+        DispatchFreeDescriptorSets(device, desc_pool, static_cast<uint32_t>(desc_sets.size()), desc_sets.data());
+    assert(result == VK_SUCCESS);
+    if (result != VK_SUCCESS) {
+        return;
+    }
+    iter->second.used -= static_cast<uint32_t>(desc_sets.size());
+    if (iter->second.used == 0) {
+        DispatchDestroyDescriptorPool(device, desc_pool, nullptr);
+        desc_pool_map_.erase(iter);
+    }
+}
+
 void SharedResourcesManager::Clear() {
     for (auto &[key, value] : shared_validation_resources_map_) {
         auto &[object, destructor] = value;
@@ -143,9 +168,139 @@ void SharedResourcesManager::Clear() {
     shared_validation_resources_map_.clear();
 }
 
+VkResult BufferPool::Create(VmaAllocator allocator, VkBufferUsageFlags usage, const VmaAllocationCreateInfo &alloc_ci,
+                            VkDeviceSize pool_block_size, VmaPoolCreateFlags flags) {
+    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+    buffer_ci.size = pool_block_size;
+    buffer_ci.usage = usage;
+    uint32_t mem_type_index = 0;
+    VkResult result = vmaFindMemoryTypeIndexForBufferInfo(allocator, &buffer_ci, &alloc_ci, &mem_type_index);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    VmaPoolCreateInfo pool_ci = {};
+    pool_ci.memoryTypeIndex = mem_type_index;
+    pool_ci.blockSize = pool_block_size;
+    pool_ci.maxBlockCount = 0;
+    pool_ci.flags = flags;
+    result = vmaCreatePool(allocator, &pool_ci, &pool);
+    if (result != VK_SUCCESS) {
+        pool = VK_NULL_HANDLE;
+        return result;
+    }
+    block_size = pool_block_size;
+    return VK_SUCCESS;
+}
+
+void BufferPool::Destroy(VmaAllocator allocator) {
+    if (pool != VK_NULL_HANDLE) {
+        vmaDestroyPool(allocator, pool);
+        pool = VK_NULL_HANDLE;
+    }
+    block_size = 0;
+}
+
+BufferChunkPool::~BufferChunkPool() {
+    // Every command buffer is gone by now, so all the chunks have been handed back
+    for (const Chunk &chunk : free_chunks_) {
+        vmaUnmapMemory(vma_allocator_, chunk.allocation);
+        vmaDestroyBuffer(vma_allocator_, chunk.buffer, chunk.allocation);
+    }
+    free_chunks_.clear();
+}
+
+bool BufferChunkPool::Acquire(Chunk &out_chunk) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!free_chunks_.empty()) {
+            out_chunk = free_chunks_.back();
+            free_chunks_.pop_back();
+            return true;
+        }
+    }
+
+    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+    buffer_info.size = chunk_size_;
+    buffer_info.usage = usage_;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    if (memory_pool_) {
+        memory_pool_->Select(alloc_info, chunk_size_);
+    }
+    Chunk chunk;
+    VkResult result = vmaCreateBuffer(vma_allocator_, &buffer_info, &alloc_info, &chunk.buffer, &chunk.allocation, nullptr);
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+    result = vmaMapMemory(vma_allocator_, chunk.allocation, reinterpret_cast<void **>(&chunk.mapped_ptr));
+    if (result != VK_SUCCESS) {
+        vmaDestroyBuffer(vma_allocator_, chunk.buffer, chunk.allocation);
+        return false;
+    }
+    out_chunk = chunk;
+    return true;
+}
+
+void BufferChunkPool::Release(const Chunk &chunk) {
+    std::lock_guard<std::mutex> guard(lock_);
+    free_chunks_.emplace_back(chunk);
+}
+
+BufferRange BufferLinearAllocator::Allocate(VkDeviceSize size) {
+    if (!pool_ || size > pool_->ChunkSize()) {
+        assert(false);
+        return {};
+    }
+
+    const VkDeviceSize alignment = pool_->Alignment();
+    VkDeviceSize offset = (offset_ + alignment - 1) / alignment * alignment;
+    if (chunks_.empty() || offset + size > pool_->ChunkSize()) {
+        BufferChunkPool::Chunk chunk;
+        if (!pool_->Acquire(chunk)) {
+            return {};
+        }
+        chunks_.emplace_back(chunk);
+        offset = 0;
+    }
+    offset_ = offset + size;
+
+    const BufferChunkPool::Chunk &chunk = chunks_.back();
+    BufferRange range;
+    range.buffer = chunk.buffer;
+    range.offset = offset;
+    range.size = size;
+    range.mapped_ptr = chunk.mapped_ptr + offset;
+    return range;
+}
+
+void BufferLinearAllocator::Reset() {
+    for (const BufferChunkPool::Chunk &chunk : chunks_) {
+        pool_->Release(chunk);
+    }
+    chunks_.clear();
+    offset_ = 0;
+}
+
 VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout) {
-    std::pair<VkDescriptorPool, VkDescriptorSet> descriptor;
-    descriptor_set_manager_.GetDescriptorSet(&descriptor.first, desc_set_layout, &descriptor.second);
+    DescriptorSetCache &cache = cached_descriptors_[desc_set_layout];
+    if (cache.sets.empty()) {
+        VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+        std::vector<VkDescriptorSet> desc_sets;
+        const VkResult result =
+            descriptor_set_manager_.GetDescriptorSets(cache.next_batch_size, &desc_pool, desc_set_layout, &desc_sets);
+        if (result != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+        cache.next_batch_size = std::min(cache.next_batch_size * 2, kMaxDescriptorSetBatchSize);
+        cache.sets.reserve(desc_sets.size());
+        for (VkDescriptorSet desc_set : desc_sets) {
+            cache.sets.emplace_back(desc_pool, desc_set);
+        }
+    }
+
+    const std::pair<VkDescriptorPool, VkDescriptorSet> descriptor = cache.sets.back();
+    cache.sets.pop_back();
     descriptors_.emplace_back(descriptor);
     return descriptor.second;
 }
@@ -153,10 +308,22 @@ VkDescriptorSet GpuResourcesManager::GetManagedDescriptorSet(VkDescriptorSetLayo
 void GpuResourcesManager::ManageDeviceMemoryBlock(gpu::DeviceMemoryBlock mem_block) { mem_blocks_.emplace_back(mem_block); }
 
 void GpuResourcesManager::DestroyResources() {
+    // Hand back used and still cached sets, one call per pool
+    vvl::unordered_map<VkDescriptorPool, std::vector<VkDescriptorSet>> sets_per_pool;
     for (auto &[desc_pool, desc_set] : descriptors_) {
-        descriptor_set_manager_.PutBackDescriptorSet(desc_pool, desc_set);
+        sets_per_pool[desc_pool].emplace_back(desc_set);
+    }
+    for (auto &[desc_set_layout, cache] : cached_descriptors_) {
+        for (auto &[desc_pool, desc_set] : cache.sets) {
+            sets_per_pool[desc_pool].emplace_back(desc_set);
+        }
+    }
+    for (auto &[desc_pool, desc_sets] : sets_per_pool) {
+        descriptor_set_manager_.PutBackDescriptorSets(desc_pool, desc_sets);
     }
     descriptors_.clear();
+    // Some layouts (ex. the per command buffer instrumentation one) are recreated after a reset, so nothing is kept
+    cached_descriptors_.clear();
 
     for (auto &mem_block : mem_blocks_) {
         mem_block.Destroy(vma_allocator_);
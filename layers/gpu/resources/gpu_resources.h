@@ -20,8 +20,10 @@
 #include "containers/custom_containers.h"
 #include "error_message/logging.h"
 #include "generated/error_location_helper.h"
+#include "utils/lock_profile.h"
 #include "vma/vma.h"
 
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <utility>
@@ -39,9 +41,12 @@ class DescriptorSetManager {
     VkResult GetDescriptorSets(uint32_t count, VkDescriptorPool *out_pool, VkDescriptorSetLayout ds_layout,
                                std::vector<VkDescriptorSet> *out_desc_sets);
     void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set);
+    // All |desc_sets| must come from |desc_pool|, freed with a single lock and vkFreeDescriptorSets call
+    void PutBackDescriptorSets(VkDescriptorPool desc_pool, const std::vector<VkDescriptorSet> &desc_sets);
 
   private:
-    std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
+    using Mutex = vvl::ProfiledMutex<std::mutex, vvl::LockSite::DescriptorSetManager>;
+    std::unique_lock<Mutex> Lock() const { return std::unique_lock<Mutex>(lock_); }
 
     struct PoolTracker {
         uint32_t size;
@@ -50,7 +55,7 @@ class DescriptorSetManager {
     VkDevice device;
     uint32_t num_bindings_in_set;
     vvl::unordered_map<VkDescriptorPool, PoolTracker> desc_pool_map_;
-    mutable std::mutex lock_;
+    mutable Mutex lock_;
 };
 
 struct DeviceMemoryBlock {
@@ -66,20 +71,111 @@ struct DeviceMemoryBlock {
     bool IsNull() { return buffer == VK_NULL_HANDLE; }
 };
 
+// VMA custom pool of fixed size blocks, dedicated to one class of internal buffers (error output, descriptor state, etc).
+// Each class gets a memory type picked for how it is accessed, and its buffers neither trigger a vkAllocateMemory of their
+// own nor grow the (much bigger) VMA default blocks. Buffers too large to share a block keep going through VMA directly.
+struct BufferPool {
+    VmaPool pool = VK_NULL_HANDLE;
+    VkDeviceSize block_size = 0;
+
+    // alloc_ci describes the memory properties every buffer of the pool needs (and prefers)
+    VkResult Create(VmaAllocator allocator, VkBufferUsageFlags usage, const VmaAllocationCreateInfo &alloc_ci,
+                    VkDeviceSize block_size, VmaPoolCreateFlags flags = 0);
+    void Destroy(VmaAllocator allocator);
+    // Route an allocation of the given size to the pool, if it makes sense
+    void Select(VmaAllocationCreateInfo &alloc_ci, VkDeviceSize size) const {
+        if (pool != VK_NULL_HANDLE && size <= block_size / 2) {
+            alloc_ci.pool = pool;
+        }
+    }
+};
+
+// A range suballocated out of a larger, persistently mapped, buffer
+struct BufferRange {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void *mapped_ptr = nullptr;
+    bool IsNull() const { return buffer == VK_NULL_HANDLE; }
+};
+
+// Device wide pool of large host visible buffers, mapped once at creation.
+// Instead of creating (and mapping) a VMA buffer for every small per command data (ex. the bindless state of each draw),
+// command buffers take whole chunks from here with a BufferLinearAllocator, and hand them back when they are reset or destroyed.
+// Chunks are recycled as-is, so memory stays with the pool for the device lifetime.
+class BufferChunkPool {
+  public:
+    struct Chunk {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        uint8_t *mapped_ptr = nullptr;
+    };
+
+    BufferChunkPool(VmaAllocator vma_allocator, VkDeviceSize chunk_size, VkDeviceSize alignment, VkBufferUsageFlags usage,
+                    const BufferPool *memory_pool = nullptr)
+        : vma_allocator_(vma_allocator), chunk_size_(chunk_size), alignment_(alignment), usage_(usage), memory_pool_(memory_pool) {}
+    ~BufferChunkPool();
+
+    VkDeviceSize ChunkSize() const { return chunk_size_; }
+    VkDeviceSize Alignment() const { return alignment_; }
+
+    // Returns false if a new chunk was needed and could not be allocated
+    bool Acquire(Chunk &out_chunk);
+    void Release(const Chunk &chunk);
+
+  private:
+    VmaAllocator vma_allocator_;
+    const VkDeviceSize chunk_size_;
+    const VkDeviceSize alignment_;
+    const VkBufferUsageFlags usage_;
+    // Where the chunks memory comes from, VMA default pools if null
+    const BufferPool *memory_pool_;
+    std::mutex lock_;
+    std::vector<Chunk> free_chunks_;
+};
+
+// Per command buffer bump allocator on top of BufferChunkPool, not thread safe (guarded by the command buffer lock)
+class BufferLinearAllocator {
+  public:
+    explicit BufferLinearAllocator(BufferChunkPool *pool) : pool_(pool) {}
+    ~BufferLinearAllocator() { Reset(); }
+
+    // Returned range is aligned to the pool alignment, null if it could not be allocated
+    BufferRange Allocate(VkDeviceSize size);
+    // Hands all chunks back to the pool, every range allocated so far becomes invalid
+    void Reset();
+
+  private:
+    BufferChunkPool *pool_;
+    std::vector<BufferChunkPool::Chunk> chunks_;
+    // Offset in the last chunk
+    VkDeviceSize offset_ = 0;
+};
+
 class GpuResourcesManager {
   public:
     GpuResourcesManager(VmaAllocator vma_allocator, DescriptorSetManager &descriptor_set_manager)
         : vma_allocator_(vma_allocator), descriptor_set_manager_(descriptor_set_manager) {}
 
+    // Sets are taken out of the DescriptorSetManager in batches and cached per layout, so only every so often a draw/dispatch
+    // has to go through the DescriptorSetManager lock. Every set is handed back by DestroyResources()
     VkDescriptorSet GetManagedDescriptorSet(VkDescriptorSetLayout desc_set_layout);
     void ManageDeviceMemoryBlock(gpu::DeviceMemoryBlock mem_block);
 
     void DestroyResources();
 
   private:
+    struct DescriptorSetCache {
+        std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>> sets;
+        // Grows with every batch, so command buffers recording a handful of draws don't eat up descriptor pools
+        uint32_t next_batch_size = 4;
+    };
+    static constexpr uint32_t kMaxDescriptorSetBatchSize = 64;
+
     VmaAllocator vma_allocator_;
     DescriptorSetManager &descriptor_set_manager_;
     std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>> descriptors_;
+    vvl::unordered_map<VkDescriptorSetLayout, DescriptorSetCache> cached_descriptors_;
     std::vector<gpu::DeviceMemoryBlock> mem_blocks_;
 };
 
@@ -17,12 +17,17 @@
 
 #include "gpu/resources/gpuav_subclasses.h"
 
+#include <algorithm>
+#include <array>
+
 #include "gpu/core/gpuav.h"
 #include "gpu/core/gpuav_constants.h"
 #include "gpu/descriptor_validation/gpuav_image_layout.h"
 #include "gpu/error_message/gpuav_vuids.h"
 #include "gpu/descriptor_validation/gpuav_descriptor_validation.h"
 #include "gpu/shaders/gpu_error_header.h"
+#include "chassis/memory_report.h"
+#include "utils/hash_util.h"
 
 namespace gpuav {
 
@@ -123,17 +128,20 @@ CommandBuffer::CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkC
                              const vvl::CommandPool *pool)
     : gpu_tracker::CommandBuffer(gpuav, handle, pCreateInfo, pool),
       gpu_resources_manager(gpuav.vma_allocator_, *gpuav.desc_set_manager_),
+      per_command_allocator(gpuav.cmd_buffer_chunk_pool_.get()),
       state_(gpuav) {
     AllocateResources();
 }
 
-static bool AllocateErrorLogsBuffer(Validator &gpuav, gpu::DeviceMemoryBlock &error_logs_mem, const Location &loc) {
+// The buffer is left mapped, it is read back after every submission
+static bool AllocateErrorLogsBuffer(Validator &gpuav, gpu::DeviceMemoryBlock &error_logs_mem, uint32_t *&output_buffer_ptr,
+                                    const Location &loc) {
     VkBufferCreateInfo buffer_info = vku::InitStructHelper();
     buffer_info.size = glsl::kErrorBufferByteSize;
     buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
     VmaAllocationCreateInfo alloc_info = {};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = gpuav.output_buffer_pool_;
+    gpuav.output_buffer_pool_.Select(alloc_info, buffer_info.size);
     VkResult result = vmaCreateBuffer(gpuav.vma_allocator_, &buffer_info, &alloc_info, &error_logs_mem.buffer,
                                       &error_logs_mem.allocation, nullptr);
     if (result != VK_SUCCESS) {
@@ -141,15 +149,14 @@ static bool AllocateErrorLogsBuffer(Validator &gpuav, gpu::DeviceMemoryBlock &er
         return false;
     }
 
-    uint32_t *output_buffer_ptr;
     result = vmaMapMemory(gpuav.vma_allocator_, error_logs_mem.allocation, reinterpret_cast<void **>(&output_buffer_ptr));
     if (result == VK_SUCCESS) {
         memset(output_buffer_ptr, 0, glsl::kErrorBufferByteSize);
         if (gpuav.gpuav_settings.validate_descriptors) {
             output_buffer_ptr[cst::stream_output_flags_offset] = cst::inst_buffer_oob_enabled;
         }
-        vmaUnmapMemory(gpuav.vma_allocator_, error_logs_mem.allocation);
     } else {
+        output_buffer_ptr = nullptr;
         gpuav.InternalError(gpuav.device, loc, "Unable to map device memory allocated for error output buffer. Aborting GPU-AV.",
                             true);
         return false;
@@ -181,7 +188,8 @@ void CommandBuffer::AllocateResources() {
     }
 
     // Error output buffer
-    if (!AllocateErrorLogsBuffer(*gpuav, error_output_buffer_, Location(Func::vkAllocateCommandBuffers))) {
+    if (!AllocateErrorLogsBuffer(*gpuav, error_output_buffer_, error_output_buffer_ptr_,
+                                 Location(Func::vkAllocateCommandBuffers))) {
         return;
     }
 
@@ -192,7 +200,7 @@ void CommandBuffer::AllocateResources() {
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
         VmaAllocationCreateInfo alloc_info = {};
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = gpuav->output_buffer_pool_;
+        gpuav->output_buffer_pool_.Select(alloc_info, buffer_info.size);
         result = vmaCreateBuffer(gpuav->vma_allocator_, &buffer_info, &alloc_info, &cmd_errors_counts_buffer_.buffer,
                                  &cmd_errors_counts_buffer_.allocation, nullptr);
         if (result != VK_SUCCESS) {
@@ -201,8 +209,15 @@ void CommandBuffer::AllocateResources() {
             return;
         }
 
+        result = vmaMapMemory(gpuav->vma_allocator_, cmd_errors_counts_buffer_.allocation,
+                              reinterpret_cast<void **>(&cmd_errors_counts_buffer_ptr_));
+        if (result != VK_SUCCESS) {
+            cmd_errors_counts_buffer_ptr_ = nullptr;
+            gpuav->InternalError(gpuav->device, Location(Func::vkAllocateCommandBuffers),
+                                 "Unable to map device memory for commands errors counts buffer. Aborting GPU-AV.", true);
+            return;
+        }
         ClearCmdErrorsCountsBuffer();
-        if (gpuav->aborted_) return;
     }
 
     // BDA snapshot
@@ -210,10 +225,15 @@ void CommandBuffer::AllocateResources() {
         VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
         VmaAllocationCreateInfo alloc_info = {};
+        // The table is sized off the ranges in use when recording starts, with room to grow, instead of a fixed upper bound.
+        // Command buffers are (re)allocated at every begin, so the table follows the application as it creates more buffers.
+        const size_t ranges_in_use_count = gpuav->GetBufferAddressRanges(nullptr, 0).second;
+        bda_ranges_snapshot_capacity_ = std::max(size_t(gpuav->gpuav_settings.max_bda_in_use), 2 * ranges_in_use_count);
         buffer_info.size = GetBdaRangesBufferByteSize();
         // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
         // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        gpuav->bda_ranges_pool_.Select(alloc_info, buffer_info.size);
         result = vmaCreateBuffer(gpuav->vma_allocator_, &buffer_info, &alloc_info, &bda_ranges_snapshot_.buffer,
                                  &bda_ranges_snapshot_.allocation, nullptr);
         if (result != VK_SUCCESS) {
@@ -342,19 +362,19 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // QWord 4 | Range 2 end
     // QWord 5 | ...
 
-    const size_t max_recordable_ranges =
-        static_cast<size_t>((GetBdaRangesBufferByteSize() - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress)));
     auto bda_ranges = reinterpret_cast<ValidationStateTracker::BufferAddressRange *>(bda_table_ptr + 1);
     const auto [ranges_to_update_count, total_address_ranges_count] =
-        gpuav->GetBufferAddressRanges(bda_ranges, max_recordable_ranges);
+        gpuav->GetBufferAddressRanges(bda_ranges, bda_ranges_snapshot_capacity_);
     bda_table_ptr[0] = ranges_to_update_count;
 
-    if (total_address_ranges_count > size_t(gpuav->gpuav_settings.max_bda_in_use)) {
+    // The table is bound at record time, it can't be swapped for a bigger one once the command buffer has been recorded
+    if (total_address_ranges_count > bda_ranges_snapshot_capacity_) {
         std::ostringstream problem_string;
         problem_string << "Number of buffer device addresses ranges in use (" << total_address_ranges_count
-                       << ") is greater than khronos_validation.gpuav_max_buffer_device_addresses ("
-                       << gpuav->gpuav_settings.max_bda_in_use
-                       << "). Truncating buffer device address table could result in invalid validation. Aborting GPU-AV.";
+                       << ") is greater than the buffer device address table capacity the command buffer was recorded with ("
+                       << bda_ranges_snapshot_capacity_
+                       << "). Re-record the command buffer or increase khronos_validation.gpuav_max_buffer_device_addresses. "
+                          "Truncating buffer device address table could result in invalid validation. Aborting GPU-AV.";
         gpuav->InternalError(gpuav->device, Location(vvl::Func::vkQueueSubmit), problem_string.str().c_str());
         return false;
     }
@@ -370,9 +390,8 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
 }
 
 VkDeviceSize CommandBuffer::GetBdaRangesBufferByteSize() const {
-    auto gpuav = static_cast<Validator *>(&dev_data);
-    return (1                                           // 1 QWORD for the number of address ranges
-            + 2 * gpuav->gpuav_settings.max_bda_in_use  // 2 QWORDS per address range
+    return (1                                    // 1 QWORD for the number of address ranges
+            + 2 * bda_ranges_snapshot_capacity_  // 2 QWORDS per address range
             ) *
            8;
 }
@@ -396,23 +415,43 @@ void CommandBuffer::Reset() {
     AllocateResources();
 }
 
+void CommandBuffer::AddMemoryUsage(vvl::MemoryUsage &usage) const {
+    vvl::CommandBuffer::AddMemoryUsage(usage);
+    auto guard = ReadLock();
+    // Host side only, the device memory is accounted for by the validator
+    size_t bytes = vvl::MemoryUsage::VectorBytes(di_input_buffer_list) + vvl::MemoryUsage::VectorBytes(per_command_error_loggers) +
+                   vvl::MemoryUsage::MapBytes(draw_validation_desc_sets);
+    for (const auto &[buffer, desc_sets] : draw_validation_desc_sets) {
+        bytes += vvl::MemoryUsage::VectorBytes(desc_sets);
+    }
+    usage.Add(vvl::MemoryCategory::GpuAV, bytes);
+}
+
 void CommandBuffer::ResetCBState() {
     auto gpuav = static_cast<Validator *>(&dev_data);
     // Free the device memory and descriptor set(s) associated with a command buffer.
 
     gpu_resources_manager.DestroyResources();
-    per_command_error_loggers.clear();
+    draw_validation_desc_sets.clear();
+    ClearRetainingCapacity(per_command_error_loggers);
 
-    for (auto &buffer_info : di_input_buffer_list) {
-        vmaDestroyBuffer(gpuav->vma_allocator_, buffer_info.bindless_state_buffer, buffer_info.bindless_state_buffer_allocation);
-    }
-    di_input_buffer_list.clear();
-    current_bindless_buffer = VK_NULL_HANDLE;
+    ClearRetainingCapacity(di_input_buffer_list);
+    current_bindless_buffer = {};
+    per_command_allocator.Reset();
 
+    if (error_output_buffer_ptr_) {
+        vmaUnmapMemory(gpuav->vma_allocator_, error_output_buffer_.allocation);
+        error_output_buffer_ptr_ = nullptr;
+    }
     error_output_buffer_.Destroy(gpuav->vma_allocator_);
+    if (cmd_errors_counts_buffer_ptr_) {
+        vmaUnmapMemory(gpuav->vma_allocator_, cmd_errors_counts_buffer_.allocation);
+        cmd_errors_counts_buffer_ptr_ = nullptr;
+    }
     cmd_errors_counts_buffer_.Destroy(gpuav->vma_allocator_);
     bda_ranges_snapshot_.Destroy(gpuav->vma_allocator_);
     bda_ranges_snapshot_version_ = 0;
+    bda_ranges_snapshot_capacity_ = 0;
 
     if (validation_cmd_desc_pool_ != VK_NULL_HANDLE && validation_cmd_desc_set_ != VK_NULL_HANDLE) {
         gpuav->desc_set_manager_->PutBackDescriptorSet(validation_cmd_desc_pool_, validation_cmd_desc_set_);
@@ -436,23 +475,14 @@ void CommandBuffer::ResetCBState() {
 }
 
 void CommandBuffer::ClearCmdErrorsCountsBuffer() const {
-    auto gpuav = static_cast<Validator *>(&dev_data);
-    uint32_t *cmd_errors_counts_buffer_ptr = nullptr;
-    VkResult result = vmaMapMemory(gpuav->vma_allocator_, cmd_errors_counts_buffer_.allocation,
-                                   reinterpret_cast<void **>(&cmd_errors_counts_buffer_ptr));
-    if (result != VK_SUCCESS) {
-        gpuav->InternalError(gpuav->device, Location(vvl::Func::vkAllocateCommandBuffers),
-                             "Unable to map device memory for commands errors counts buffer. Aborting GPU-AV.", true);
-        return;
-    }
-    std::memset(cmd_errors_counts_buffer_ptr, 0, static_cast<size_t>(GetCmdErrorsCountsBufferByteSize()));
-    vmaUnmapMemory(gpuav->vma_allocator_, cmd_errors_counts_buffer_.allocation);
+    assert(cmd_errors_counts_buffer_ptr_);
+    std::memset(cmd_errors_counts_buffer_ptr_, 0, static_cast<size_t>(GetCmdErrorsCountsBufferByteSize()));
 }
 
 bool CommandBuffer::PreProcess() {
     auto gpuav = static_cast<Validator *>(&dev_data);
 
-    bool succeeded = UpdateBindlessStateBuffer(*gpuav, *this, state_.vma_allocator_);
+    bool succeeded = UpdateBindlessStateBuffer(*gpuav, *this);
     if (!succeeded) {
         return false;
     }
@@ -465,9 +495,9 @@ bool CommandBuffer::PreProcess() {
     return !per_command_error_loggers.empty() || has_build_as_cmd;
 }
 
-bool CommandBuffer::NeedsPostProcess() { return !error_output_buffer_.IsNull(); }
+bool CommandBuffer::NeedsPostProcess() { return !error_output_buffer_.IsNull() && error_output_buffer_ptr_; }
 
-// For the given command buffer, map its debug data buffers and read their contents for analysis.
+// For the given command buffer, read the contents of its (persistently mapped) debug data buffers for analysis.
 void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     // CommandBuffer::Destroy can happen on an other thread,
     // so when getting here after acquiring command buffer's lock,
@@ -478,50 +508,60 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
 
     auto gpuav = static_cast<Validator *>(&dev_data);
     bool skip = false;
-    uint32_t *error_output_buffer_ptr = nullptr;
-    VkResult result =
-        vmaMapMemory(gpuav->vma_allocator_, error_output_buffer_.allocation, reinterpret_cast<void **>(&error_output_buffer_ptr));
-    assert(result == VK_SUCCESS);
-    if (result == VK_SUCCESS) {
-        // The second word in the debug output buffer is the number of words that would have
-        // been written by the shader instrumentation, if there was enough room in the buffer we provided.
-        // The number of words actually written by the shaders is determined by the size of the buffer
-        // we provide via the descriptor. So, we process only the number of words that can fit in the
-        // buffer.
-        const uint32_t total_words = error_output_buffer_ptr[cst::stream_output_size_offset];
-        // A zero here means that the shader instrumentation didn't write anything.
-        if (total_words != 0) {
-            uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
-            assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
-            uint32_t *const error_records_end =
-                error_output_buffer_ptr + (glsl::kErrorBufferByteSize - cst::stream_output_data_offset);
-
-            uint32_t *error_record_ptr = error_records_start;
-            uint32_t record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
-            assert(record_size == glsl::kErrorRecordSize);
-
-            while (record_size > 0 && (error_record_ptr + record_size) <= error_records_end) {
-                const uint32_t error_logger_i = error_record_ptr[glsl::kHeaderCommandResourceIdOffset];
-                assert(error_logger_i < per_command_error_loggers.size());
+    uint32_t *const error_output_buffer_ptr = error_output_buffer_ptr_;
+    // The second word in the debug output buffer is the number of words that would have
+    // been written by the shader instrumentation, if there was enough room in the buffer we provided.
+    // The number of words actually written by the shaders is determined by the size of the buffer
+    // we provide via the descriptor. So, we process only the number of words that can fit in the
+    // buffer.
+    // It doubles as the "any error" flag: a zero here means that the shader instrumentation didn't write anything, and since
+    // the per command errors counts are only bumped right before logging an error they are still all zero too. That is the
+    // common case, which then only costs reading this word.
+    const uint32_t total_words = error_output_buffer_ptr[cst::stream_output_size_offset];
+    if (total_words != 0) {
+        uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
+        assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
+        uint32_t *const error_records_end = error_output_buffer_ptr + (glsl::kErrorBufferByteSize - cst::stream_output_data_offset);
+
+        uint32_t *error_record_ptr = error_records_start;
+        uint32_t record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
+        assert(record_size == glsl::kErrorRecordSize);
+
+        // With deduplicate_errors, the records already logged: < command, shader id, instruction id, error group, sub code >
+        using ErrorKey = std::array<uint32_t, 5>;
+        vvl::unordered_set<ErrorKey, hash_util::IsOrderedContainer<ErrorKey>> logged_errors;
+        const bool deduplicate_errors = gpuav->gpuav_settings.deduplicate_errors;
+
+        while (record_size > 0 && (error_record_ptr + record_size) <= error_records_end) {
+            const uint32_t error_logger_i = error_record_ptr[glsl::kHeaderCommandResourceIdOffset];
+            assert(error_logger_i < per_command_error_loggers.size());
+            const ErrorKey error_key = {error_logger_i, error_record_ptr[glsl::kHeaderShaderIdOffset],
+                                        error_record_ptr[glsl::kHeaderInstructionIdOffset],
+                                        error_record_ptr[glsl::kHeaderErrorGroupOffset],
+                                        error_record_ptr[glsl::kHeaderErrorSubCodeOffset]};
+            // Decoding a record walks the instrumented SPIR-V, a duplicate is skipped before that
+            if (!deduplicate_errors || logged_errors.insert(error_key).second) {
                 auto &error_logger = per_command_error_loggers[error_logger_i];
                 const LogObjectList objlist(queue, VkHandle());
                 skip |= error_logger(*gpuav, error_record_ptr, objlist);
-
-                // Next record
-                error_record_ptr += record_size;
-                record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
             }
 
-            // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
-            assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
-            memset(&error_output_buffer_ptr[cst::stream_output_data_offset], 0,
-                   glsl::kErrorBufferByteSize - cst::stream_output_data_offset * sizeof(uint32_t));
+            // Next record
+            error_record_ptr += record_size;
+            record_size = error_record_ptr[glsl::kHeaderErrorRecordSizeOffset];
         }
+
+        // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
+        // Past what was written the buffer is still zeroed from the previous clear.
+        assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
+        const size_t data_byte_size = glsl::kErrorBufferByteSize - cst::stream_output_data_offset * sizeof(uint32_t);
+        memset(&error_output_buffer_ptr[cst::stream_output_data_offset], 0,
+               std::min(data_byte_size, size_t(total_words) * sizeof(uint32_t)));
         error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
-        vmaUnmapMemory(gpuav->vma_allocator_, error_output_buffer_.allocation);
+
+        ClearCmdErrorsCountsBuffer();
     }
 
-    ClearCmdErrorsCountsBuffer();
     if (gpuav->aborted_) return;
 
     // If instrumentation found an error, skip post processing. Errors detected by instrumentation are usually
@@ -544,4 +584,12 @@ vvl::PreSubmitResult Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submis
     return gpu_tracker::Queue::PreSubmit(std::move(submissions));
 }
 
+void Queue::Retire(vvl::QueueSubmission &submission) {
+    if (submission.end_batch) {
+        // Before the command buffers of the batch are post processed
+        static_cast<Validator &>(shader_instrumentor_).retired_batches_.fetch_add(1);
+    }
+    gpu_tracker::Queue::Retire(submission);
+}
+
 }  // namespace gpuav
\ No newline at end of file
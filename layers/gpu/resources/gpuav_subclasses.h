@@ -51,8 +51,8 @@ struct DescSetState {
 };
 
 struct DescBindingInfo {
-    VkBuffer bindless_state_buffer;
-    VmaAllocation bindless_state_buffer_allocation;
+    // glsl::BindlessStateBuffer, suballocated from CommandBuffer::per_command_allocator
+    gpu::BufferRange bindless_state;
     // Hold a buffer for each descriptor set
     // Note: The index here is from vkCmdBindDescriptorSets::firstSet
     std::vector<DescSetState> descriptor_set_buffers;
@@ -73,7 +73,7 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
   public:
     // per vkCmdBindDescriptorSet() state
     std::vector<DescBindingInfo> di_input_buffer_list;
-    VkBuffer current_bindless_buffer = VK_NULL_HANDLE;
+    gpu::BufferRange current_bindless_buffer;
     uint32_t draw_index = 0;
     uint32_t compute_index = 0;
     uint32_t trace_rays_index = 0;
@@ -122,12 +122,18 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
 
     void Destroy() final;
     void Reset() final;
+    void AddMemoryUsage(vvl::MemoryUsage &usage) const final;
 
     gpu::GpuResourcesManager gpu_resources_manager;
+    // Indirect draw validation descriptor sets, keyed by indirect buffer then count buffer.
+    // GPU driven renderers issue many indirect draws out of the same buffers, a single set written once is shared by all of them
+    vvl::unordered_map<VkBuffer, std::vector<std::pair<VkBuffer, VkDescriptorSet>>> draw_validation_desc_sets;
+    // For small, per command, host written data. Reset along with the command buffer
+    gpu::BufferLinearAllocator per_command_allocator;
     // Using stdext::inplace_function over std::function to allocate memory in place
     using ErrorLoggerFunc =
         stdext::inplace_function<bool(Validator &gpuav, const uint32_t *error_record, const LogObjectList &objlist), 128>;
-    std::vector<ErrorLoggerFunc> per_command_error_loggers;
+    std::vector<ErrorLoggerFunc, vvl::ArenaAllocator<ErrorLoggerFunc, vvl::Arena::GpuAV>> per_command_error_loggers;
 
   private:
     void AllocateResources();
@@ -147,12 +153,16 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
 
     // Buffer storing GPU-AV errors
     gpu::DeviceMemoryBlock error_output_buffer_ = {};
+    uint32_t *error_output_buffer_ptr_ = nullptr;
     // Buffer storing an error count per validated commands.
     // Used to limit the number of errors a single command can emit.
     gpu::DeviceMemoryBlock cmd_errors_counts_buffer_ = {};
+    uint32_t *cmd_errors_counts_buffer_ptr_ = nullptr;
     // Buffer storing a snapshot of buffer device address ranges
     gpu::DeviceMemoryBlock bda_ranges_snapshot_ = {};
     uint32_t bda_ranges_snapshot_version_ = 0;
+    // Number of ranges the snapshot can hold
+    size_t bda_ranges_snapshot_capacity_ = 0;
 };
 
 class Queue : public gpu_tracker::Queue {
@@ -162,6 +172,7 @@ class Queue : public gpu_tracker::Queue {
 
   protected:
     vvl::PreSubmitResult PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) override;
+    void Retire(vvl::QueueSubmission &submission) override;
 };
 
 class Buffer : public vvl::Buffer {
@@ -219,7 +219,9 @@ uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block, Instructi
                                                     const InjectionData& injection_data) {
     const Constant& set_constant = module_.type_manager_.GetConstantUInt32(descriptor_set_);
     const Constant& binding_constant = module_.type_manager_.GetConstantUInt32(descriptor_binding_);
-    const uint32_t descriptor_index_id = CastToUint32(descriptor_index_id_, block);  // might be int32
+    // The zero constant is only created here, AnalyzeInstruction() must not add anything to the module
+    const uint32_t descriptor_index_id = (descriptor_index_id_ == 0) ? module_.type_manager_.GetConstantZeroUint32().Id()
+                                                                     : CastToUint32(descriptor_index_id_, block);  // might be int32
 
     if (image_inst_) {
         // Get Texel buffer offset
@@ -244,28 +246,7 @@ uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block, Instructi
                 }
             }
         } else {
-            // if not a direct read/write/fetch, will be a OpSampledImage
-            // "All OpSampledImage instructions must be in the same block in which their Result <id> are consumed"
-            // the simple way around this is to add a OpCopyObject to be consumed by the target instruction
-            uint32_t image_id = target_instruction_->Operand(0);
-            const Instruction* sampled_image_inst = block.function_.FindInstruction(image_id);
-            // TODO - Add tests to understand what else can be here other then OpSampledImage
-            if (sampled_image_inst->Opcode() == spv::OpSampledImage) {
-                const uint32_t type_id = sampled_image_inst->TypeId();
-                const uint32_t copy_id = module_.TakeNextId();
-                const_cast<Instruction*>(target_instruction_)->ReplaceOperandId(image_id, copy_id);
-
-                // incase the OpSampledImage is shared, copy the previous OpCopyObject
-                auto copied = copy_object_map_.find(image_id);
-                if (copied != copy_object_map_.end()) {
-                    image_id = copied->second;
-                    block.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id}, inst_it);
-                } else {
-                    copy_object_map_.emplace(image_id, copy_id);
-                    // slower, but need to guarantee it is placed after a OpSampledImage
-                    block.function_.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id}, image_id);
-                }
-            }
+            CopySampledImage(block, inst_it);
         }
     } else {
         // For now, only do bounds check for non-aggregate types
@@ -296,6 +277,56 @@ uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block, Instructi
     return function_result;
 }
 
+// Buffer accesses through the same OpAccessChain check the same descriptor and byte range.
+// Image accesses only depend on the descriptor, unless it is a texel buffer where the texel offset is also checked.
+CheckKey BindlessDescriptorPass::GetCheckKey() const {
+    if (!image_inst_) {
+        return access_chain_inst_ ? CheckKey{access_chain_inst_->ResultId(), 0, 0, 0} : CheckKey{};
+    }
+    const Type* image_type = module_.type_manager_.FindTypeById(image_inst_->TypeId());
+    if (!image_type || image_type->spv_type_ != SpvType::kImage || image_type->inst_.Operand(1) == spv::DimBuffer) {
+        return {};
+    }
+    // The last word keeps these apart from the buffer keys above
+    return {descriptor_index_id_, descriptor_set_, descriptor_binding_, 1};
+}
+
+// if not a direct read/write/fetch, will be a OpSampledImage
+void BindlessDescriptorPass::CopySampledImage(BasicBlock& block, InstructionIt* inst_it) {
+    // "All OpSampledImage instructions must be in the same block in which their Result <id> are consumed"
+    // the simple way around this is to add a OpCopyObject to be consumed by the target instruction
+    uint32_t image_id = target_instruction_->Operand(0);
+    const Instruction* sampled_image_inst = block.function_.FindInstruction(image_id);
+    // TODO - Add tests to understand what else can be here other then OpSampledImage
+    if (sampled_image_inst->Opcode() == spv::OpSampledImage) {
+        const uint32_t type_id = sampled_image_inst->TypeId();
+        const uint32_t copy_id = module_.TakeNextId();
+        const_cast<Instruction*>(target_instruction_)->ReplaceOperandId(image_id, copy_id);
+
+        // incase the OpSampledImage is shared, copy the previous OpCopyObject
+        auto copied = copy_object_map_.find(image_id);
+        if (copied != copy_object_map_.end()) {
+            image_id = copied->second;
+            block.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id}, inst_it);
+        } else {
+            copy_object_map_.emplace(image_id, copy_id);
+            // slower, but need to guarantee it is placed after a OpSampledImage
+            block.function_.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id}, image_id);
+        }
+    }
+}
+
+// Same as what CreateFunctionCall() does to the target instruction, without the check itself
+void BindlessDescriptorPass::PrepareReusedCheck(BasicBlock& block) {
+    if (!image_inst_) {
+        return;
+    }
+    const uint32_t opcode = target_instruction_->Opcode();
+    if (opcode != spv::OpImageRead && opcode != spv::OpImageFetch && opcode != spv::OpImageWrite) {
+        CopySampledImage(block, nullptr);
+    }
+}
+
 void BindlessDescriptorPass::Reset() {
     access_chain_inst_ = nullptr;
     var_inst_ = nullptr;
@@ -352,7 +383,7 @@ bool BindlessDescriptorPass::AnalyzeInstruction(const Function& function, const
         if (pointer_type->inst_.IsArray() && access_chain_inst_->Length() >= 6) {
             descriptor_index_id_ = access_chain_inst_->Operand(1);
         } else {
-            descriptor_index_id_ = module_.type_manager_.GetConstantZeroUint32().Id();
+            descriptor_index_id_ = 0;  // zero index
         }
 
     } else {
@@ -402,7 +433,7 @@ bool BindlessDescriptorPass::AnalyzeInstruction(const Function& function, const
             }
             var_inst_ = &variable->inst_;
         } else {
-            descriptor_index_id_ = module_.type_manager_.GetConstantZeroUint32().Id();
+            descriptor_index_id_ = 0;  // zero index
         }
     }
 
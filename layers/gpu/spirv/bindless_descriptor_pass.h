@@ -34,8 +34,12 @@ class BindlessDescriptorPass : public Pass {
 
   private:
     bool AnalyzeInstruction(const Function& function, const Instruction& inst) final;
+    std::unique_ptr<Pass> Clone() const final { return std::make_unique<BindlessDescriptorPass>(*this); }
     uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) final;
     void Reset() final;
+    CheckKey GetCheckKey() const final;
+    void PrepareReusedCheck(BasicBlock& block) final;
+    void CopySampledImage(BasicBlock& block, InstructionIt* inst_it);
 
     uint32_t FindTypeByteSize(uint32_t type_id, uint32_t matrix_stride = 0, bool col_major = false, bool in_matrix = false);
     uint32_t GetLastByte(BasicBlock& block, InstructionIt* inst_it);
@@ -58,6 +58,9 @@ uint32_t BufferDeviceAddressPass::CreateFunctionCall(BasicBlock& block, Instruct
     return function_result;
 }
 
+// Accesses through the same pointer check the same address and type length
+CheckKey BufferDeviceAddressPass::GetCheckKey() const { return {target_instruction_->Operand(0), type_length_, 0, 0}; }
+
 void BufferDeviceAddressPass::Reset() {
     target_instruction_ = nullptr;
     access_opcode_ = 0;
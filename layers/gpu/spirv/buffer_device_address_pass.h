@@ -33,8 +33,10 @@ class BufferDeviceAddressPass : public Pass {
 
   private:
     bool AnalyzeInstruction(const Function& function, const Instruction& inst) final;
+    std::unique_ptr<Pass> Clone() const final { return std::make_unique<BufferDeviceAddressPass>(*this); }
     uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) final;
     void Reset() final;
+    CheckKey GetCheckKey() const final;
 
     uint32_t link_function_id = 0;
     uint32_t GetLinkFunctionId();
@@ -94,11 +94,7 @@ void Instruction::AppendWord(uint32_t word) {
     UpdateDebugInfo();
 }
 
-void Instruction::ToBinary(std::vector<uint32_t>& out) {
-    for (auto word : words_) {
-        out.push_back(word);
-    }
-}
+void Instruction::ToBinary(std::vector<uint32_t>& out) { out.insert(out.end(), words_.begin(), words_.end()); }
 
 void Instruction::ReplaceResultId(uint32_t new_result_id) {
     words_[result_id_index_] = new_result_id;
@@ -140,13 +136,9 @@ void Instruction::ReplaceOperandId(uint32_t old_word, uint32_t new_word) {
 
 // The main challenge with linking to functions from 2 modules is the IDs overlap.
 // TODO - Use the new generated operand to find the IDs.
-void Instruction::ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swap_map) {
-    auto swap = [this, &id_swap_map](uint32_t index) {
-        uint32_t old_id = words_[index];
-        uint32_t new_id = id_swap_map[old_id];
-        assert(new_id != 0);
-        words_[index] = new_id;
-    };
+std::vector<uint32_t> Instruction::LinkedIdWords() const {
+    std::vector<uint32_t> id_words;
+    auto swap = [&id_words](uint32_t index) { id_words.push_back(index); };
 
     auto swap_to_end = [this, swap](uint32_t start_index) {
         for (uint32_t i = start_index; i < Length(); i++) {
@@ -284,7 +276,15 @@ void Instruction::ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swa
         default:
             assert(false && "Need to add support for new instruction");
     }
+    return id_words;
+}
 
+void Instruction::ReplaceLinkedIds(const std::vector<uint32_t>& id_words, const std::vector<uint32_t>& id_map) {
+    for (uint32_t index : id_words) {
+        const uint32_t new_id = id_map[words_[index]];
+        assert(new_id != 0);
+        words_[index] = new_id;
+    }
     UpdateDebugInfo();
 }
 
@@ -18,6 +18,7 @@
 #include <stddef.h>
 #include <vector>
 #include "containers/custom_containers.h"
+#include "utils/arena_allocator.h"
 #include <spirv/unified1/spirv.hpp>
 
 struct OperandInfo;
@@ -58,12 +59,20 @@ struct Instruction {
     void ReplaceResultId(uint32_t new_result_id);
     // searchs all operands to replace ID if found
     void ReplaceOperandId(uint32_t old_word, uint32_t new_word);
-    void ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swap_map);
+    // Indices of the words holding the IDs an instruction of a linked function references (ignores Result ID)
+    std::vector<uint32_t> LinkedIdWords() const;
+    // id_words comes from LinkedIdWords() of the same instruction, id_map is indexed by the IDs of the linked module
+    void ReplaceLinkedIds(const std::vector<uint32_t>& id_words, const std::vector<uint32_t>& id_map);
 
     bool IsArray() const { return (Opcode() == spv::OpTypeArray || Opcode() == spv::OpTypeRuntimeArray); }
 
     void ToBinary(std::vector<uint32_t>& out);
 
+    // A large shader is parsed into hundreds of thousands of instructions, which are carved out of the pools of the GPU-AV
+    // arena rather than allocated one at a time from the heap
+    static void* operator new(size_t size) { return vvl::arena::Allocate(vvl::Arena::GpuAV, size, alignof(Instruction)); }
+    static void operator delete(void* ptr, size_t size) { vvl::arena::Free(vvl::Arena::GpuAV, ptr, size, alignof(Instruction)); }
+
     // Store minimal extra data
     uint32_t result_id_index_ = 0;
     uint32_t type_id_index_ = 0;
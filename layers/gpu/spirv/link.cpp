@@ -0,0 +1,63 @@
+/* Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "link.h"
+#include <spirv/unified1/spirv.hpp>
+#include "generated/spirv_grammar_helper.h"
+#include "type_manager.h"
+
+namespace gpuav {
+namespace spirv {
+
+LinkLibrary::LinkLibrary(const LinkInfo& info) : bound(info.words[3]) {
+    uint32_t offset = 5;  // skip header
+    bool in_function = false;
+    while (offset < info.word_count) {
+        auto inst = std::make_unique<Instruction>(&info.words[offset]);
+        const uint32_t opcode = inst->Opcode();
+        offset += inst->Length();
+
+        std::vector<uint32_t> id_words;
+        if (opcode == spv::OpFunction) {
+            // Its words are swapped one by one for the function ID and type of the module
+            in_function = true;
+        } else if (in_function) {
+            if (inst->ResultId() != 0) {
+                function_result_ids.push_back(inst->ResultId());
+            }
+            id_words = inst->LinkedIdWords();
+        } else if (ConstantOperation(opcode) || opcode == spv::OpVariable || opcode == spv::OpDecorate ||
+                   opcode == spv::OpMemberDecorate || opcode == spv::OpTypePointer || opcode == spv::OpTypeStruct ||
+                   opcode == spv::OpTypeFunction) {
+            // The other declarations are types found (or created) by value in the module
+            id_words = inst->LinkedIdWords();
+        }
+
+        auto& list = in_function ? function : declarations;
+        list.push_back({std::move(inst), std::move(id_words)});
+    }
+}
+
+const LinkLibrary& LinkLibraryCache::Get(const LinkInfo& info) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto& library = libraries_[info.words];
+    if (!library) {
+        library = std::make_unique<const LinkLibrary>(info);
+    }
+    return *library;
+}
+
+}  // namespace spirv
+}  // namespace gpuav
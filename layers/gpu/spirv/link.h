@@ -15,6 +15,11 @@
 #pragma once
 
 #include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "containers/custom_containers.h"
+#include "instruction.h"
 
 namespace gpuav {
 namespace spirv {
@@ -39,5 +44,40 @@ struct LinkInfo {
     const char* opname;
 };
 
+// The SPIR-V module of a LinkInfo, parsed the first time a shader of the device links its function and then shared by the others.
+// Linking copies the instructions and relocates their IDs with a table indexed by the IDs of the library, instead of parsing
+// the words again and swapping IDs through a map for each instrumented shader.
+struct LinkLibrary {
+    struct LinkedInstruction {
+        std::unique_ptr<Instruction> inst;
+        // From Instruction::LinkedIdWords(), empty for the instructions whose IDs are never relocated
+        std::vector<uint32_t> id_words;
+    };
+
+    explicit LinkLibrary(const LinkInfo& info);
+
+    // Largest ID of the library, plus one
+    uint32_t bound = 0;
+    // Everything prior to the OpFunction
+    std::vector<LinkedInstruction> declarations;
+    // The function, from OpFunction to OpFunctionEnd
+    std::vector<LinkedInstruction> function;
+    // Result IDs defined in the function (not the OpFunction itself), in order. They are relocated to a contiguous range of
+    // new IDs, the N-th one being the start of the range plus N.
+    std::vector<uint32_t> function_result_ids;
+};
+
+// Held by the device, the instructions of the libraries are allocated from the GPU-AV arena which can be backed by the
+// allocation callbacks of the instance. Thread safe, the shaders are instrumented on any thread.
+class LinkLibraryCache {
+  public:
+    const LinkLibrary& Get(const LinkInfo& info);
+
+  private:
+    std::mutex lock_;
+    // Keyed by LinkInfo::words
+    vvl::unordered_map<const uint32_t*, std::unique_ptr<const LinkLibrary>> libraries_;
+};
+
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
@@ -24,8 +24,13 @@
 namespace gpuav {
 namespace spirv {
 
-Module::Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set)
-    : type_manager_(*this), shader_id_(shader_id), output_buffer_descriptor_set_(output_buffer_descriptor_set) {
+Module::Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set,
+               LinkLibraryCache& link_libraries, vvl::WorkerPool* worker_pool)
+    : type_manager_(*this),
+      worker_pool_(worker_pool),
+      shader_id_(shader_id),
+      output_buffer_descriptor_set_(output_buffer_descriptor_set),
+      link_libraries_(link_libraries) {
     uint32_t instruction_count = 0;
     std::vector<uint32_t>::const_iterator it = words.cbegin();
     header_.magic_number = *it++;
@@ -242,8 +247,30 @@ uint32_t Module::TakeNextId() {
 }
 
 // walk through each list and append the buffer
+static size_t WordCount(const InstructionList& instructions) {
+    size_t count = 0;
+    for (const auto& inst : instructions) {
+        count += inst->Length();
+    }
+    return count;
+}
+
 void Module::ToBinary(std::vector<uint32_t>& out) {
+    // Size the binary up front, the instructions are then copied in one after the other
+    size_t word_count = sizeof(ModuleHeader) / sizeof(uint32_t);
+    for (const InstructionList* instructions :
+         {&capabilities_, &extensions_, &ext_inst_imports_, &memory_model_, &entry_points_, &execution_modes_, &debug_source_,
+          &debug_name_, &debug_module_processed_, &annotations_, &types_values_constants_}) {
+        word_count += WordCount(*instructions);
+    }
+    for (const auto& function : functions_) {
+        word_count += WordCount(function->pre_block_inst_) + WordCount(function->post_block_inst_);
+        for (const auto& block : function->blocks_) {
+            word_count += WordCount(block->instructions_);
+        }
+    }
     out.clear();
+    out.reserve(word_count);
     out.push_back(header_.magic_number);
     out.push_back(header_.version);
     out.push_back(header_.generator);
@@ -291,13 +318,14 @@ void Module::ToBinary(std::vector<uint32_t>& out) {
 // Takes the current module and injects the function into it
 // This is done by first apply any new Types/Constants/Variables and then copying in the instructions of the Function
 void Module::LinkFunction(const LinkInfo& info) {
+    const LinkLibrary& library = link_libraries_.Get(info);
     // track the incoming SSA IDs with what they are in the module
-    // < old_id, new_id >
-    vvl::unordered_map<uint32_t, uint32_t> id_swap_map;
+    // id_map[old_id] = new_id
+    std::vector<uint32_t> id_map(library.bound, 0);
     const uint32_t function_type_id = TakeNextId();
 
-    // Track all decorations and add after when have full id_swap_map
-    InstructionList decorations;
+    // Track all decorations and add after when have full id_map
+    std::vector<const LinkLibrary::LinkedInstruction*> decorations;
 
     // We need to apply variable to the Entry Point interface if using SPIR-V 1.4+
     std::vector<uint32_t> interface_variable_ids;
@@ -311,16 +339,14 @@ void Module::LinkFunction(const LinkInfo& info) {
     }
 
     // find all constant and types, add any the module doesn't have
-    uint32_t offset = 5;  // skip header
-    while (offset < info.word_count) {
-        const uint32_t* inst_word = &info.words[offset];
-        const uint32_t opcode = *inst_word & 0x0ffffu;
-        const uint32_t length = *inst_word >> 16;
-        if (opcode == spv::OpFunction) {
-            break;
+    for (const LinkLibrary::LinkedInstruction& linked : library.declarations) {
+        const uint32_t opcode = linked.inst->Opcode();
+        if (opcode == spv::OpDecorate || opcode == spv::OpMemberDecorate) {
+            decorations.push_back(&linked);
+            continue;
         }
 
-        auto new_inst = std::make_unique<Instruction>(inst_word);
+        auto new_inst = std::make_unique<Instruction>(*linked.inst);
         uint32_t old_result_id = new_inst->ResultId();
 
         SpvType spv_type = GetSpvType(opcode);
@@ -355,44 +381,43 @@ void Module::LinkFunction(const LinkInfo& info) {
                     break;
                 }
                 case SpvType::kArray: {
-                    const Type* element_type = type_manager_.FindTypeById(id_swap_map[new_inst->Word(2)]);
-                    const Constant* element_length = type_manager_.FindConstantById(id_swap_map[new_inst->Word(3)]);
+                    const Type* element_type = type_manager_.FindTypeById(id_map[new_inst->Word(2)]);
+                    const Constant* element_length = type_manager_.FindConstantById(id_map[new_inst->Word(3)]);
                     type_id = type_manager_.GetTypeArray(*element_type, *element_length).Id();
                     break;
                 }
                 case SpvType::kRuntimeArray: {
-                    const Type* element_type = type_manager_.FindTypeById(id_swap_map[new_inst->Word(2)]);
+                    const Type* element_type = type_manager_.FindTypeById(id_map[new_inst->Word(2)]);
                     type_id = type_manager_.GetTypeRuntimeArray(*element_type).Id();
                     break;
                 }
                 case SpvType::kVector: {
-                    const Type* component_type = type_manager_.FindTypeById(id_swap_map[new_inst->Word(2)]);
+                    const Type* component_type = type_manager_.FindTypeById(id_map[new_inst->Word(2)]);
                     uint32_t component_count = new_inst->Word(3);
                     type_id = type_manager_.GetTypeVector(*component_type, component_count).Id();
                     break;
                 }
                 case SpvType::kMatrix: {
-                    const Type* column_type = type_manager_.FindTypeById(id_swap_map[new_inst->Word(2)]);
+                    const Type* column_type = type_manager_.FindTypeById(id_map[new_inst->Word(2)]);
                     uint32_t column_count = new_inst->Word(3);
                     type_id = type_manager_.GetTypeMatrix(*column_type, column_count).Id();
                     break;
                 }
                 case SpvType::kSampledImage: {
-                    const Type* image_type = type_manager_.FindTypeById(id_swap_map[new_inst->Word(2)]);
+                    const Type* image_type = type_manager_.FindTypeById(id_map[new_inst->Word(2)]);
                     type_id = type_manager_.GetTypeSampledImage(*image_type).Id();
                     break;
                 }
                 case SpvType::kPointer: {
-                    auto it = id_swap_map.find(new_inst->ResultId());
-                    if (it != id_swap_map.end()) {
+                    if (id_map[new_inst->ResultId()] != 0) {
                         // already had a OpTypeForwardPointer, so will automatically need a new a new OpTypePointer
-                        type_id = it->second;  // id_swap_map will just update with same value
+                        type_id = id_map[new_inst->ResultId()];  // id_map will just update with same value
                         new_inst->ReplaceResultId(type_id);
-                        new_inst->ReplaceLinkedId(id_swap_map);
+                        new_inst->ReplaceLinkedIds(linked.id_words, id_map);
                         type_manager_.AddType(std::move(new_inst), spv_type).Id();
                     } else {
                         spv::StorageClass storage_class = spv::StorageClass(new_inst->Word(2));
-                        const Type* pointer_type = type_manager_.FindTypeById(id_swap_map[new_inst->Word(3)]);
+                        const Type* pointer_type = type_manager_.FindTypeById(id_map[new_inst->Word(3)]);
                         type_id = type_manager_.GetTypePointer(storage_class, *pointer_type).Id();
                     }
                     break;
@@ -412,7 +437,7 @@ void Module::LinkFunction(const LinkInfo& info) {
                     // likely won't match anything neither
                     type_id = (spv_type == SpvType::kFunction) ? function_type_id : TakeNextId();
                     new_inst->ReplaceResultId(type_id);
-                    new_inst->ReplaceLinkedId(id_swap_map);
+                    new_inst->ReplaceLinkedIds(linked.id_words, id_map);
                     type_manager_.AddType(std::move(new_inst), spv_type).Id();
                     break;
                 }
@@ -420,10 +445,10 @@ void Module::LinkFunction(const LinkInfo& info) {
                     break;
             }
 
-            id_swap_map[old_result_id] = type_id;
+            id_map[old_result_id] = type_id;
 
         } else if (ConstantOperation(opcode)) {
-            const Type& type = *type_manager_.FindTypeById(id_swap_map[new_inst->TypeId()]);
+            const Type& type = *type_manager_.FindTypeById(id_map[new_inst->TypeId()]);
             const Constant* constant = nullptr;
             // for simplicity, just create a new constant for things other than 32-bit OpConstant as there are rarely-to-none
             // composite/null/true/false constants in linked functions. The extra logic to try and find them is much larger and cost
@@ -445,22 +470,20 @@ void Module::LinkFunction(const LinkInfo& info) {
             if (!constant) {
                 const uint32_t new_result_id = TakeNextId();
                 new_inst->ReplaceResultId(new_result_id);
-                new_inst->ReplaceLinkedId(id_swap_map);
+                new_inst->ReplaceLinkedIds(linked.id_words, id_map);
                 constant = &type_manager_.AddConstant(std::move(new_inst), type);
             }
-            id_swap_map[old_result_id] = constant->Id();
+            id_map[old_result_id] = constant->Id();
         } else if (opcode == spv::OpVariable) {
             // Add in all variables outside of functions
             const uint32_t new_result_id = TakeNextId();
             interface_variable_ids.push_back(new_result_id);
-            id_swap_map[old_result_id] = new_result_id;
+            id_map[old_result_id] = new_result_id;
             new_inst->ReplaceResultId(new_result_id);
-            new_inst->ReplaceLinkedId(id_swap_map);
+            new_inst->ReplaceLinkedIds(linked.id_words, id_map);
 
             const Type* type = type_manager_.FindTypeById(new_inst->TypeId());
             type_manager_.AddVariable(std::move(new_inst), *type);
-        } else if (opcode == spv::OpDecorate || opcode == spv::OpMemberDecorate) {
-            decorations.push_back(std::move(new_inst));
         } else if (opcode == spv::OpCapability) {
             spv::Capability capability = spv::Capability(new_inst->Word(1));
             // Shader is required and we want to remove Linkage from final shader
@@ -471,23 +494,16 @@ void Module::LinkFunction(const LinkInfo& info) {
         } else if (opcode == spv::OpExtension) {
             extensions_.push_back(std::move(new_inst));
         }
-
-        offset += length;
     }
 
-    // because flow-control instructions (ex. OpBranch) do forward references to IDs, do an initial loop to get all OpLabel to have
-    // in id_swap_map
-    uint32_t offset_copy = offset;
-    while (offset_copy < info.word_count) {
-        const uint32_t* inst_word = &info.words[offset_copy];
-        const uint32_t opcode = *inst_word & 0x0ffffu;
-        const uint32_t length = *inst_word >> 16;
-        if (opcode == spv::OpLabel) {
-            Instruction inst(inst_word);
-            uint32_t new_result_id = TakeNextId();
-            id_swap_map[inst.ResultId()] = new_result_id;
-        }
-        offset_copy += length;
+    // because flow-control instructions (ex. OpBranch) do forward references to IDs, all the IDs of the function are relocated
+    // before copying it, to a range of new IDs in the order the library defines them
+    const uint32_t function_id_count = static_cast<uint32_t>(library.function_result_ids.size());
+    const uint32_t function_id_base = header_.bound;
+    header_.bound += function_id_count;
+    assert(header_.bound < 0x3FFFFF);  // SPIR-V limit.
+    for (uint32_t i = 0; i < function_id_count; i++) {
+        id_map[library.function_result_ids[i]] = function_id_base + i;
     }
 
     {
@@ -500,33 +516,25 @@ void Module::LinkFunction(const LinkInfo& info) {
 
     // Add function and copy all instructions to it, while adjusting any IDs
     auto& new_function = functions_.emplace_back(std::make_unique<Function>(*this));
-    while (offset < info.word_count) {
-        const uint32_t* inst_word = &info.words[offset];
-        auto new_inst = std::make_unique<Instruction>(inst_word);
-        const uint32_t opcode = new_inst->Opcode();
-        const uint32_t length = new_inst->Length();
+    for (const LinkLibrary::LinkedInstruction& linked : library.function) {
+        auto new_inst = std::make_unique<Instruction>(*linked.inst);
 
-        if (opcode == spv::OpFunction) {
-            new_inst->words_[1] = id_swap_map[new_inst->words_[1]];
+        if (new_inst->Opcode() == spv::OpFunction) {
+            new_inst->words_[1] = id_map[new_inst->words_[1]];
             new_inst->words_[2] = info.function_id;
             new_inst->words_[4] = function_type_id;
-        } else if (opcode == spv::OpLabel) {
-            uint32_t new_result_id = id_swap_map[new_inst->ResultId()];
-            new_inst->ReplaceResultId(new_result_id);
+            new_inst->UpdateDebugInfo();
         } else {
-            uint32_t result_id = new_inst->ResultId();
+            const uint32_t result_id = new_inst->ResultId();
             if (result_id != 0) {
-                uint32_t new_result_id = TakeNextId();
-                id_swap_map[result_id] = new_result_id;
-                new_inst->ReplaceResultId(new_result_id);
+                new_inst->ReplaceResultId(id_map[result_id]);
             }
-            new_inst->ReplaceLinkedId(id_swap_map);
+            new_inst->ReplaceLinkedIds(linked.id_words, id_map);
         }
 
         // To make simpler, just put everything in a single list as we have no need to do any modifications to the CFG logic for the
         // linked function
         new_function->pre_block_inst_.emplace_back(std::move(new_inst));
-        offset += length;
     }
 
     // if 2 OpTypeRuntimeArray are combined, we can't have ArrayStride twice
@@ -537,15 +545,17 @@ void Module::LinkFunction(const LinkInfo& info) {
         }
     }
 
-    for (auto& decoration : decorations) {
-        if (decoration->Word(2) == spv::DecorationLinkageAttributes) {
+    for (const LinkLibrary::LinkedInstruction* linked : decorations) {
+        if (linked->inst->Word(2) == spv::DecorationLinkageAttributes) {
             continue;  // remove linkage info
-        } else if (decoration->Word(2) == spv::DecorationDescriptorSet) {
+        }
+        auto decoration = std::make_unique<Instruction>(*linked->inst);
+        if (decoration->Word(2) == spv::DecorationDescriptorSet) {
             // only should be one DescriptorSet to update
             decoration->words_[3] = output_buffer_descriptor_set_;
         }
 
-        decoration->ReplaceLinkedId(id_swap_map);
+        decoration->ReplaceLinkedIds(linked->id_words, id_map);
 
         if (decoration->Word(2) == spv::DecorationArrayStride) {
             if (!array_strides.insert(decoration->Word(1)).second) {
@@ -22,6 +22,10 @@
 #include "function_basic_block.h"
 #include "type_manager.h"
 
+namespace vvl {
+class WorkerPool;
+}  // namespace vvl
+
 namespace gpuav {
 namespace spirv {
 
@@ -37,7 +41,8 @@ struct ModuleHeader {
 // There are other helper classes that are charge of handling the various parts of the module.
 class Module {
   public:
-    Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set);
+    Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set,
+           LinkLibraryCache& link_libraries, vvl::WorkerPool* worker_pool = nullptr);
 
     // Memory that holds all the actual SPIR-V data, replicate the "Logical Layout of a Module" of SPIR-V.
     // Divided into sections to make easier to modify each part at different times, but still keeps it simple to write out all the
@@ -59,6 +64,9 @@ class Module {
     // Handles all types and constants
     TypeManager type_manager_;
 
+    // Optional, the passes analyze the functions on it before instrumenting them
+    vvl::WorkerPool* const worker_pool_;
+
     // When adding a new instruction with result ID, will need to grab the next ID
     uint32_t TakeNextId();
 
@@ -86,6 +94,8 @@ class Module {
     // Will replace the "OpDecorate DescriptorSet" for the output buffer in the incoming linked module
     // This allows anything to be set in the GLSL for the set value, as we change it at runtime
     const uint32_t output_buffer_descriptor_set_;
+    // Shared by the modules of the device, LinkFunction copies from there
+    LinkLibraryCache& link_libraries_;
 };
 
 }  // namespace spirv
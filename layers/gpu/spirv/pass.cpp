@@ -17,6 +17,7 @@
 #include "module.h"
 #include "type_manager.h"
 #include "gpu/shaders/gpu_error_codes.h"
+#include "utils/worker_pool.h"
 #include <spirv/unified1/spirv.hpp>
 
 namespace gpuav {
@@ -346,7 +347,31 @@ BasicBlockIt Pass::InjectConditionalFunctionCheck(Function* function, BasicBlock
     original_block.instructions_.erase(inst_it, original_block.instructions_.end());
 
     // Go back to original Block and add function call and branch from the bool result
-    const uint32_t function_result = CreateFunctionCall(original_block, nullptr, injection_data);
+    // Anything outside of the current merge block chain might not be dominated by the previous checks
+    if (original_label != available_checks_label_) {
+        available_checks_.clear();
+    }
+    available_checks_label_ = merge_block_label;
+
+    const CheckKey check_key = GetCheckKey();
+    const bool reusable = check_key != CheckKey{};
+    uint32_t function_result = 0;
+    if (reusable) {
+        for (const auto& [key, result_id] : available_checks_) {
+            if (key == check_key) {
+                function_result = result_id;
+                break;
+            }
+        }
+    }
+    if (function_result != 0) {
+        PrepareReusedCheck(original_block);
+    } else {
+        function_result = CreateFunctionCall(original_block, nullptr, injection_data);
+        if (reusable) {
+            available_checks_.emplace_back(check_key, function_result);
+        }
+    }
 
     original_block.CreateInstruction(spv::OpSelectionMerge, {merge_block_label, spv::SelectionControlMaskNone});
     original_block.CreateInstruction(spv::OpBranchConditional, {function_result, valid_block_label, invalid_block_label});
@@ -372,9 +397,39 @@ InstructionIt Pass::FindTargetInstruction(BasicBlock& block) const {
     return block.instructions_.end();
 }
 
+bool Pass::NeedsInstrumentation(const Function& function) {
+    for (const auto& block : function.blocks_) {
+        if (block->loop_header_) {
+            continue;
+        }
+        for (const auto& inst : block->instructions_) {
+            if (AnalyzeInstruction(function, *inst)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void Pass::Run() {
     // Can safely loop function list as there is no injecting of new Functions until linking time
-    for (const auto& function : module_.functions_) {
+    const uint32_t function_count = static_cast<uint32_t>(module_.functions_.size());
+    // With a worker pool, the functions are first analyzed in parallel and only the ones with something to instrument are then
+    // instrumented, in order. Instrumenting a function doesn't change what is found in the others, and the IDs, types and
+    // constants are created in the same order as on a single thread, so the instrumented shader is the same.
+    std::vector<uint8_t> needs_instrumentation(function_count, 1);
+    if (module_.worker_pool_ && function_count > 1) {
+        vvl::ParallelFor(module_.worker_pool_, function_count, [this, &needs_instrumentation](uint32_t i) {
+            std::unique_ptr<Pass> analysis = Clone();
+            needs_instrumentation[i] = analysis->NeedsInstrumentation(*module_.functions_[i]) ? 1 : 0;
+        });
+    }
+
+    for (uint32_t function_index = 0; function_index < function_count; function_index++) {
+        if (!needs_instrumentation[function_index]) {
+            continue;
+        }
+        const auto& function = module_.functions_[function_index];
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             if ((*block_it)->loop_header_) {
                 continue;  // Currently can't properly handle injecting CFG logic into a loop header block
@@ -15,6 +15,10 @@
 #pragma once
 
 #include <stdint.h>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
 #include <spirv/unified1/spirv.hpp>
 #include "function_basic_block.h"
 
@@ -31,6 +35,9 @@ struct InjectionData {
     uint32_t inst_position_id;
 };
 
+// Identifies what a check depends on (ex. the pointer being accessed), all zero means it can't be reused
+using CheckKey = std::array<uint32_t, 4>;
+
 // Common helpers for all passes
 class Pass {
   public:
@@ -60,13 +67,23 @@ class Pass {
     void InjectFunctionCheck(BasicBlockIt block_it, InstructionIt* inst_it, const InjectionData& injection_data);
 
     // Each pass decides if the instruction should needs to have its function check injected
+    // Must only read the module, Run() calls it from several threads (on copies of the pass) before instrumenting anything
     virtual bool AnalyzeInstruction(const Function& function, const Instruction& inst) = 0;
+    // A copy of the pass for analyzing a function on another thread
+    virtual std::unique_ptr<Pass> Clone() const = 0;
     // A callback from the function injection logic.
     // Each pass creates a OpFunctionCall and returns its result id.
     // If |inst_it| is not null, it will update it to instruction post OpFunctionCall
     virtual uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) = 0;
     // clear values incase multiple injections are made
     virtual void Reset() = 0;
+    // Identifies what the check for the current target instruction depends on.
+    // Passes return a non-zero key only when two checks with the same key are guaranteed to give the same answer.
+    // Called after AnalyzeInstruction() and before CreateFunctionCall()
+    virtual CheckKey GetCheckKey() const { return {}; }
+    // Called instead of CreateFunctionCall() when the result of an earlier check is reused, for anything the target instruction
+    // still needs in |block| to be valid
+    virtual void PrepareReusedCheck(BasicBlock& block) { (void)block; }
 
     // If this is false, we assume through other means (such as robustness) we won't crash on bad values and go
     //     PassFunction(original_value)
@@ -104,6 +121,14 @@ class Pass {
 
   private:
     InstructionIt FindTargetInstruction(BasicBlock& block) const;
+    // True if AnalyzeInstruction() will find something to instrument in the function
+    bool NeedsInstrumentation(const Function& function);
+
+    // Conditional checks split a block into a chain of merge blocks, each one dominated by every check made before it in the
+    // chain. This is the list of check results available in the merge block with |available_checks_label_|, so a redundant
+    // check (ex. sampling the same bindless texture multiple times in a block) becomes a branch on the earlier result.
+    uint32_t available_checks_label_ = 0;
+    std::vector<std::pair<CheckKey, uint32_t>> available_checks_;
 };
 
 }  // namespace spirv
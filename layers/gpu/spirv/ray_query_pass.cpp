@@ -16,6 +16,8 @@
 #include "ray_query_pass.h"
 #include "module.h"
 #include <spirv/unified1/spirv.hpp>
+#include <cmath>
+#include <cstring>
 
 #include "generated/instrumentation_ray_query_comp.h"
 
@@ -56,12 +58,102 @@ uint32_t RayQueryPass::CreateFunctionCall(BasicBlock& block, InstructionIt* inst
 
 void RayQueryPass::Reset() { target_instruction_ = nullptr; }
 
+// Returns the 32-bit float value of a scalar constant
+static bool GetConstantFloat(const TypeManager& type_manager, uint32_t id, float& value) {
+    const Constant* constant = type_manager.FindConstantById(id);
+    if (!constant || constant->type_.spv_type_ != SpvType::kFloat || constant->type_.inst_.Word(2) != 32) {
+        return false;
+    }
+    if (constant->inst_.Opcode() == spv::OpConstantNull) {
+        value = 0.0f;
+        return true;
+    }
+    if (constant->inst_.Opcode() != spv::OpConstant) {
+        return false;
+    }
+    const uint32_t bits = constant->inst_.Word(3);
+    std::memcpy(&value, &bits, sizeof(float));
+    return true;
+}
+
+static bool IsConstantFiniteFloat(const TypeManager& type_manager, uint32_t id, float& value) {
+    return GetConstantFloat(type_manager, id, value) && std::isfinite(value);
+}
+
+static bool IsConstantFiniteVec3(const TypeManager& type_manager, uint32_t id) {
+    const Constant* constant = type_manager.FindConstantById(id);
+    if (!constant) {
+        return false;
+    }
+    if (constant->inst_.Opcode() == spv::OpConstantNull) {
+        return true;
+    }
+    // OpConstantComposite | type | result | x | y | z
+    if (constant->inst_.Opcode() != spv::OpConstantComposite || constant->inst_.Length() != 6) {
+        return false;
+    }
+    float unused;
+    for (uint32_t i = 3; i < 6; i++) {
+        if (!IsConstantFiniteFloat(type_manager, constant->inst_.Word(i), unused)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The same checks done in inst_ray_query_comp, but done at instrumentation time when every operand is a constant.
+// Specialization constants are not known until pipeline creation so they are never considered.
+bool RayQueryPass::IsConstantRayValid(const Instruction& inst) const {
+    const TypeManager& type_manager = module_.type_manager_;
+
+    const Constant* flags_constant = type_manager.FindConstantById(inst.Operand(2));
+    if (!flags_constant || flags_constant->type_.spv_type_ != SpvType::kInt) {
+        return false;
+    }
+    uint32_t ray_flags = 0;
+    if (flags_constant->inst_.Opcode() == spv::OpConstant) {
+        ray_flags = flags_constant->inst_.Word(3);
+    } else if (flags_constant->inst_.Opcode() != spv::OpConstantNull) {
+        return false;
+    }
+
+    float ray_tmin = 0.0f;
+    float ray_tmax = 0.0f;
+    if (!IsConstantFiniteFloat(type_manager, inst.Operand(5), ray_tmin) ||
+        !IsConstantFiniteFloat(type_manager, inst.Operand(7), ray_tmax)) {
+        return false;
+    }
+    if (!IsConstantFiniteVec3(type_manager, inst.Operand(4)) || !IsConstantFiniteVec3(type_manager, inst.Operand(6))) {
+        return false;
+    }
+    if (ray_tmin < 0.0f || ray_tmax < 0.0f || ray_tmax < ray_tmin) {
+        return false;
+    }
+
+    const uint32_t both_skip = spv::RayFlagsSkipTrianglesKHRMask | spv::RayFlagsSkipAABBsKHRMask;
+    const uint32_t skip_cull_mask = ray_flags & (spv::RayFlagsSkipTrianglesKHRMask | spv::RayFlagsCullBackFacingTrianglesKHRMask |
+                                                 spv::RayFlagsCullFrontFacingTrianglesKHRMask);
+    const uint32_t opaque_mask = ray_flags & (spv::RayFlagsOpaqueKHRMask | spv::RayFlagsNoOpaqueKHRMask |
+                                              spv::RayFlagsCullOpaqueKHRMask | spv::RayFlagsCullNoOpaqueKHRMask);
+    if ((ray_flags & both_skip) == both_skip) {
+        return false;
+    }
+    if ((skip_cull_mask & (skip_cull_mask - 1)) != 0 || (opaque_mask & (opaque_mask - 1)) != 0) {
+        return false;
+    }
+    return true;
+}
+
 bool RayQueryPass::AnalyzeInstruction(const Function& function, const Instruction& inst) {
     (void)function;
     const uint32_t opcode = inst.Opcode();
     if (opcode != spv::OpRayQueryInitializeKHR) {
         return false;
     }
+    // Nothing can go wrong at runtime, so no need to pay for the check
+    if (IsConstantRayValid(inst)) {
+        return false;
+    }
     target_instruction_ = &inst;
     return true;
 }
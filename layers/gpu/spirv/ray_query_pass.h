@@ -31,9 +31,12 @@ class RayQueryPass : public Pass {
 
   private:
     bool AnalyzeInstruction(const Function& function, const Instruction& inst) final;
+    std::unique_ptr<Pass> Clone() const final { return std::make_unique<RayQueryPass>(*this); }
     uint32_t CreateFunctionCall(BasicBlock& block, InstructionIt* inst_it, const InjectionData& injection_data) final;
     void Reset() final;
 
+    bool IsConstantRayValid(const Instruction& inst) const;
+
     uint32_t link_function_id = 0;
     uint32_t GetLinkFunctionId();
 };
@@ -19,21 +19,6 @@
 namespace gpuav {
 namespace spirv {
 
-// Simplest way to check if same type is see if items line up.
-// Even if types have an RefId, it should be the same unless there are already duplicated types.
-bool Type::operator==(Type const& other) const {
-    if ((spv_type_ != other.spv_type_) || (inst_.Length() != other.inst_.Length())) {
-        return false;
-    }
-    // word[1] is the result ID which might be different
-    for (uint32_t i = 2; i < inst_.Length(); i++) {
-        if (inst_.words_[i] != other.inst_.words_[i]) {
-            return false;
-        }
-    }
-    return true;
-}
-
 // return %A in:
 //   %B = OpTypePointer Input %A
 //   %C = OpVariable %B Input
@@ -43,11 +28,77 @@ const Type* Variable::PointerType(TypeManager& type_manager_) const {
     return type_manager_.FindTypeById(type_id);
 }
 
+template <typename T>
+static void SetById(std::vector<const T*>& table, uint32_t id, const T* object) {
+    if (id >= table.size()) {
+        table.resize(id + 1, nullptr);
+    }
+    table[id] = object;
+}
+
+template <typename T>
+static const T* FindById(const std::vector<const T*>& table, uint32_t id) {
+    return (id < table.size()) ? table[id] : nullptr;
+}
+
+// Simplest way to check if same type is see if items line up.
+// Even if types have an RefId, it should be the same unless there are already duplicated types.
+void TypeManager::BuildTypeKey(const Instruction& inst, InstructionKey& key) const {
+    key.clear();
+    // word[1] is the result ID which might be different
+    key.push_back(inst.Word(0));
+    for (uint32_t i = 2; i < inst.Length(); i++) {
+        key.push_back(inst.Word(i));
+    }
+    // Types made of structurally equal types are the same
+    switch (inst.Opcode()) {
+        case spv::OpTypeVector:
+        case spv::OpTypeMatrix:
+        case spv::OpTypeArray:
+        case spv::OpTypeRuntimeArray:
+        case spv::OpTypeSampledImage:
+            key[1] = CanonicalTypeId(key[1]);
+            break;
+        case spv::OpTypePointer:
+            key[2] = CanonicalTypeId(key[2]);
+            break;
+        default:
+            break;
+    }
+}
+
+void TypeManager::BuildConstantKey(const Instruction& inst, InstructionKey& key) const {
+    key.clear();
+    key.push_back(inst.Word(0));
+    key.push_back(inst.TypeId());
+    for (uint32_t i = 3; i < inst.Length(); i++) {
+        key.push_back(inst.Word(i));
+    }
+}
+
+const Type* TypeManager::FindType(const InstructionKey& key) const {
+    auto it = type_map_.find(key);
+    return (it == type_map_.end()) ? nullptr : it->second;
+}
+
+const Constant* TypeManager::FindConstant(const InstructionKey& key) const {
+    auto it = constant_map_.find(key);
+    return (it == constant_map_.end()) ? nullptr : it->second;
+}
+
 const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType spv_type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
-    id_to_type_[inst->ResultId()] = std::make_unique<Type>(spv_type, *inst);
-    const Type* new_type = id_to_type_[inst->ResultId()].get();
+    const Type* new_type = &types_.emplace_back(spv_type, *inst);
+    const uint32_t id = inst->ResultId();
+    SetById(id_to_type_, id, new_type);
+
+    BuildTypeKey(*inst, lookup_key_);
+    const Type* canonical_type = type_map_.try_emplace(lookup_key_, new_type).first->second;
+    if (id >= canonical_type_ids_.size()) {
+        canonical_type_ids_.resize(id + 1, 0);
+    }
+    canonical_type_ids_[id] = canonical_type->Id();
 
     switch (spv_type) {
         case SpvType::kVoid:
@@ -66,40 +117,18 @@ const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType
             acceleration_structure_type = new_type;
             break;
         case SpvType::kInt:
-            int_types_.push_back(new_type);
-            break;
         case SpvType::kFloat:
-            float_types_.push_back(new_type);
-            break;
         case SpvType::kVector:
-            vector_types_.push_back(new_type);
-            break;
         case SpvType::kMatrix:
-            matrix_types_.push_back(new_type);
-            break;
         case SpvType::kImage:
-            image_types_.push_back(new_type);
-            break;
         case SpvType::kSampledImage:
-            sampled_image_types_.push_back(new_type);
-            break;
         case SpvType::kArray:
-            array_types_.push_back(new_type);
-            break;
         case SpvType::kRuntimeArray:
-            runtime_array_types_.push_back(new_type);
-            break;
         case SpvType::kPointer:
-            pointer_types_.push_back(new_type);
-            break;
         case SpvType::kForwardPointer:
-            forward_pointer_types_.push_back(new_type);
-            break;
         case SpvType::kFunction:
-            function_types_.push_back(new_type);
-            break;
         case SpvType::kStruct:
-            break;  // don't track structs currently
+            break;  // found through type_map_
         default:
             assert(false && "unsupported SpvType");
             break;
@@ -108,10 +137,7 @@ const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType
     return *new_type;
 }
 
-const Type* TypeManager::FindTypeById(uint32_t id) const {
-    auto type = id_to_type_.find(id);
-    return (type == id_to_type_.end()) ? nullptr : type->second.get();
-}
+const Type* TypeManager::FindTypeById(uint32_t id) const { return FindById(id_to_type_, id); }
 
 const Type& TypeManager::GetTypeVoid() {
     if (void_type) {
@@ -169,27 +195,22 @@ const Type& TypeManager::GetTypeAccelerationStructure() {
 }
 
 const Type& TypeManager::GetTypeInt(uint32_t bit_width, bool is_signed) {
-    for (const auto type : int_types_) {
-        const auto& words = type->inst_.words_;
-        const bool int_is_signed = words[3] != 0;
-        if (words[2] == bit_width && int_is_signed == is_signed) {
-            return *type;
-        }
+    const uint32_t signed_word = is_signed ? 1 : 0;
+    lookup_key_.assign({(4u << 16) | spv::OpTypeInt, bit_width, signed_word});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    const uint32_t signed_word = is_signed ? 1 : 0;
     auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeInt);
     new_inst->Fill({type_id, bit_width, signed_word});
     return AddType(std::move(new_inst), SpvType::kInt);
 }
 
 const Type& TypeManager::GetTypeFloat(uint32_t bit_width) {
-    for (const auto type : float_types_) {
-        const auto& words = type->inst_.words_;
-        if ((words[2] == bit_width)) {
-            return *type;
-        }
+    lookup_key_.assign({(3u << 16) | spv::OpTypeFloat, bit_width});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -199,13 +220,9 @@ const Type& TypeManager::GetTypeFloat(uint32_t bit_width) {
 }
 
 const Type& TypeManager::GetTypeArray(const Type& element_type, const Constant& length) {
-    for (const auto type : array_types_) {
-        const Type* this_element_type = FindTypeById(type->inst_.Word(2));
-        if (this_element_type && (*this_element_type == element_type)) {
-            if (type->inst_.Word(3) == length.Id()) {
-                return *type;
-            }
-        }
+    lookup_key_.assign({(4u << 16) | spv::OpTypeArray, CanonicalTypeId(element_type.Id()), length.Id()});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -215,11 +232,9 @@ const Type& TypeManager::GetTypeArray(const Type& element_type, const Constant&
 }
 
 const Type& TypeManager::GetTypeRuntimeArray(const Type& element_type) {
-    for (const auto type : runtime_array_types_) {
-        const Type* this_element_type = FindTypeById(type->inst_.Word(2));
-        if (this_element_type && (*this_element_type == element_type)) {
-            return *type;
-        }
+    lookup_key_.assign({(3u << 16) | spv::OpTypeRuntimeArray, CanonicalTypeId(element_type.Id())});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -229,16 +244,9 @@ const Type& TypeManager::GetTypeRuntimeArray(const Type& element_type) {
 }
 
 const Type& TypeManager::GetTypeVector(const Type& component_type, uint32_t component_count) {
-    for (const auto type : vector_types_) {
-        const auto& words = type->inst_.words_;
-        if (words[3] != component_count) {
-            continue;
-        }
-
-        const Type* vector_component_type = FindTypeById(words[2]);
-        if (vector_component_type && (*vector_component_type == component_type)) {
-            return *type;
-        }
+    lookup_key_.assign({(4u << 16) | spv::OpTypeVector, CanonicalTypeId(component_type.Id()), component_count});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -248,16 +256,9 @@ const Type& TypeManager::GetTypeVector(const Type& component_type, uint32_t comp
 }
 
 const Type& TypeManager::GetTypeMatrix(const Type& column_type, uint32_t column_count) {
-    for (const auto type : matrix_types_) {
-        const auto& words = type->inst_.words_;
-        if (words[3] != column_count) {
-            continue;
-        }
-
-        const Type* matrix_column_type = FindTypeById(words[2]);
-        if (matrix_column_type && (*matrix_column_type == column_type)) {
-            return *type;
-        }
+    lookup_key_.assign({(4u << 16) | spv::OpTypeMatrix, CanonicalTypeId(column_type.Id()), column_count});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -267,12 +268,9 @@ const Type& TypeManager::GetTypeMatrix(const Type& column_type, uint32_t column_
 }
 
 const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
-    for (const auto type : sampled_image_types_) {
-        const auto& words = type->inst_.words_;
-        const Type* this_image_type = FindTypeById(words[2]);
-        if (this_image_type && (*this_image_type == image_type)) {
-            return *type;
-        }
+    lookup_key_.assign({(3u << 16) | spv::OpTypeSampledImage, CanonicalTypeId(image_type.Id())});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -282,16 +280,9 @@ const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
 }
 
 const Type& TypeManager::GetTypePointer(spv::StorageClass storage_class, const Type& pointer_type) {
-    for (const auto type : pointer_types_) {
-        const auto& words = type->inst_.words_;
-        if (words[2] != storage_class) {
-            continue;
-        }
-
-        const Type* this_pointer_type = FindTypeById(words[3]);
-        if (this_pointer_type && (*this_pointer_type == pointer_type)) {
-            return *type;
-        }
+    lookup_key_.assign({(4u << 16) | spv::OpTypePointer, uint32_t(storage_class), CanonicalTypeId(pointer_type.Id())});
+    if (const Type* type = FindType(lookup_key_)) {
+        return *type;
     }
 
     const uint32_t type_id = module_.TakeNextId();
@@ -333,7 +324,7 @@ const Type& TypeManager::GetTypePointerBuiltInInput(spv::BuiltIn built_in) {
         }
         default: {
             assert(false && "unhandled builtin");
-            return *(id_to_type_.begin()->second);
+            return types_.front();
         }
     }
 }
@@ -395,44 +386,26 @@ uint32_t TypeManager::TypeLength(const Type& type) {
 const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
-    id_to_constant_[inst->ResultId()] = std::make_unique<Constant>(type, *inst);
-    const Constant* new_constant = id_to_constant_[inst->ResultId()].get();
+    const Constant* new_constant = &constants_.emplace_back(type, *inst);
+    SetById(id_to_constant_, inst->ResultId(), new_constant);
 
-    if (inst->Opcode() == spv::OpConstant) {
-        if (type.inst_.Opcode() == spv::OpTypeInt && type.inst_.Word(2) == 32) {
-            int_32bit_constants_.push_back(new_constant);
-        } else if (type.inst_.Opcode() == spv::OpTypeFloat && type.inst_.Word(2) == 32) {
-            float_32bit_constants_.push_back(new_constant);
-        }
-    } else if (inst->Opcode() == spv::OpConstantNull) {
-        null_constants_.push_back(new_constant);
-    }
+    BuildConstantKey(*inst, lookup_key_);
+    constant_map_.try_emplace(lookup_key_, new_constant);
 
     return *new_constant;
 }
 
 const Constant* TypeManager::FindConstantInt32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : int_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    lookup_key_.assign({(4u << 16) | spv::OpConstant, type_id, value});
+    return FindConstant(lookup_key_);
 }
 
 const Constant* TypeManager::FindConstantFloat32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : float_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    lookup_key_.assign({(4u << 16) | spv::OpConstant, type_id, value});
+    return FindConstant(lookup_key_);
 }
 
-const Constant* TypeManager::FindConstantById(uint32_t id) const {
-    auto constant = id_to_constant_.find(id);
-    return (constant == id_to_constant_.end()) ? nullptr : constant->second.get();
-}
+const Constant* TypeManager::FindConstantById(uint32_t id) const { return FindById(id_to_constant_, id); }
 
 const Constant& TypeManager::CreateConstantUInt32(uint32_t value) {
     const Type& type = GetTypeInt(32, 0);
@@ -494,10 +467,9 @@ const Constant& TypeManager::GetConstantZeroVec3() {
 }
 
 const Constant& TypeManager::GetConstantNull(const Type& type) {
-    for (const auto& constant : null_constants_) {
-        if (constant->type_.Id() == type.Id()) {
-            return *constant;
-        }
+    lookup_key_.assign({(3u << 16) | spv::OpConstantNull, type.Id()});
+    if (const Constant* constant = FindConstant(lookup_key_)) {
+        return *constant;
     }
 
     const uint32_t constant_id = module_.TakeNextId();
@@ -509,8 +481,8 @@ const Constant& TypeManager::GetConstantNull(const Type& type) {
 const Variable& TypeManager::AddVariable(std::unique_ptr<Instruction> new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
-    id_to_variable_[inst->ResultId()] = std::make_unique<Variable>(type, *inst);
-    const Variable* new_variable = id_to_variable_[inst->ResultId()].get();
+    const Variable* new_variable = &variables_.emplace_back(type, *inst);
+    SetById(id_to_variable_, inst->ResultId(), new_variable);
 
     if (new_variable->StorageClass() == spv::StorageClassInput) {
         input_variables_.push_back(new_variable);
@@ -521,10 +493,7 @@ const Variable& TypeManager::AddVariable(std::unique_ptr<Instruction> new_inst,
     return *new_variable;
 }
 
-const Variable* TypeManager::FindVariableById(uint32_t id) const {
-    auto variable = id_to_variable_.find(id);
-    return (variable == id_to_variable_.end()) ? nullptr : variable->second.get();
-}
+const Variable* TypeManager::FindVariableById(uint32_t id) const { return FindById(id_to_variable_, id); }
 
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
@@ -14,9 +14,10 @@
  */
 #pragma once
 
+#include <deque>
 #include <vector>
-#include <list>
 #include "instruction.h"
+#include "utils/hash_util.h"
 #include "generated/spirv_grammar_helper.h"
 
 namespace gpuav {
@@ -52,7 +53,6 @@ static constexpr bool ConstantOperation(uint32_t opcode) {
 struct Type {
     Type(SpvType spv_type, const Instruction& inst) : spv_type_(spv_type), inst_(inst) {}
 
-    bool operator==(Type const& other) const;
     uint32_t Id() const { return inst_.ResultId(); }
 
     const SpvType spv_type_;
@@ -130,11 +130,44 @@ class TypeManager {
   private:
     Module& module_;
 
+    // The words of a type or constant instruction without its result ID, with the IDs of the types it is made of replaced by
+    // their canonical IDs (see canonical_type_ids_)
+    using InstructionKey = std::vector<uint32_t>;
+    struct InstructionKeyHash {
+        size_t operator()(const InstructionKey& key) const {
+            hash_util::HashCombiner hc;
+            hc.Combine(key.begin(), key.end());
+            return hc.Value();
+        }
+    };
+    void BuildTypeKey(const Instruction& inst, InstructionKey& key) const;
+    void BuildConstantKey(const Instruction& inst, InstructionKey& key) const;
+    const Type* FindType(const InstructionKey& key) const;
+    const Constant* FindConstant(const InstructionKey& key) const;
+    uint32_t CanonicalTypeId(uint32_t id) const {
+        return (id < canonical_type_ids_.size() && canonical_type_ids_[id] != 0) ? canonical_type_ids_[id] : id;
+    }
+
+    // Never shrinks, so the objects keep their address
+    std::deque<Type> types_;
+    std::deque<Constant> constants_;
+    std::deque<Variable> variables_;
+
+    // Indexed by result ID, the IDs are dense (below the module bound)
+    std::vector<const Type*> id_to_type_;
+    std::vector<const Constant*> id_to_constant_;
+    std::vector<const Variable*> id_to_variable_;
+
     // Currently we don't worry about duplicated types. If duplicate types are added from the original SPIR-V, we just use the first
-    // one we fine. We should only be adding a new object because it currently doesn't exists.
-    vvl::unordered_map<uint32_t, std::unique_ptr<Type>> id_to_type_;
-    vvl::unordered_map<uint32_t, std::unique_ptr<Constant>> id_to_constant_;
-    vvl::unordered_map<uint32_t, std::unique_ptr<Variable>> id_to_variable_;
+    // one we find. We should only be adding a new object because it currently doesn't exists.
+    // The first type added with a given key is the canonical type of the key, the Get*() functions look up the key of the type
+    // they would create.
+    vvl::unordered_map<InstructionKey, const Type*, InstructionKeyHash> type_map_;
+    std::vector<uint32_t> canonical_type_ids_;
+    // Constants are keyed by the exact ID of their type
+    vvl::unordered_map<InstructionKey, const Constant*, InstructionKeyHash> constant_map_;
+    // Reused by the lookups, to not allocate a key each time
+    mutable InstructionKey lookup_key_;
 
     // Create faster lookups for specific types
     // some types are base types and only will be one
@@ -143,23 +176,9 @@ class TypeManager {
     const Type* sampler_type = nullptr;
     const Type* ray_query_type = nullptr;
     const Type* acceleration_structure_type = nullptr;
-    std::vector<const Type*> int_types_;
-    std::vector<const Type*> float_types_;
-    std::vector<const Type*> vector_types_;
-    std::vector<const Type*> matrix_types_;
-    std::vector<const Type*> image_types_;
-    std::vector<const Type*> sampled_image_types_;
-    std::vector<const Type*> array_types_;
-    std::vector<const Type*> runtime_array_types_;
-    std::vector<const Type*> pointer_types_;
-    std::vector<const Type*> forward_pointer_types_;
-    std::vector<const Type*> function_types_;
-
-    std::vector<const Constant*> int_32bit_constants_;
-    std::vector<const Constant*> float_32bit_constants_;
+
     const Constant* uint_32bit_zero_constants_ = nullptr;
     const Constant* float_32bit_zero_constants_ = nullptr;
-    std::vector<const Constant*> null_constants_;
 
     std::vector<const Variable*> input_variables_;
     std::vector<const Variable*> output_variables_;
@@ -18,12 +18,19 @@
 
 #include "layer_options.h"
 #include "utils/hash_util.h"
+#include "vk_layer_config.h"
+#include "utils/vk_layer_utils.h"
 #include <vulkan/layer/vk_layer_settings.hpp>
 
+#include <mutex>
+#include <optional>
+
 #include "gpu/core/gpu_settings.h"
 #include "error_message/logging.h"
 
 #include "sync/sync_settings.h"
+#include "core_checks/cc_settings.h"
+#include "chassis/entry_point_timing.h"
 
 // Include new / delete overrides if using mimalloc. This needs to be include exactly once in a file that is
 // part of the VVL but not the layer utils library.
@@ -50,6 +57,8 @@ const char *VK_LAYER_VALIDATE_GPU_BASED = "validate_gpu_based";
 const char *VK_LAYER_DISABLES = "disables";
 const char *VK_LAYER_STATELESS_PARAM = "stateless_param";
 const char *VK_LAYER_THREAD_SAFETY = "thread_safety";
+const char *VK_LAYER_THREAD_SAFETY_OWNER_CACHE = "thread_safety_owner_cache";
+const char *VK_LAYER_THREAD_SAFETY_SKIP_IMMUTABLE_READS = "thread_safety_skip_immutable_reads";
 const char *VK_LAYER_VALIDATE_CORE = "validate_core";
 const char *VK_LAYER_CHECK_COMMAND_BUFFER = "check_command_buffer";
 const char *VK_LAYER_CHECK_OBJECT_IN_USE = "check_object_in_use";
@@ -65,6 +74,36 @@ const char *VK_LAYER_MESSAGE_ID_FILTER = "message_id_filter";
 const char *VK_LAYER_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *VK_LAYER_PARALLEL_VALIDATION = "parallel_validation";
+const char *VK_LAYER_PARALLEL_VALIDATION_THREAD_COUNT = "parallel_validation_thread_count";
+const char *VK_LAYER_ASYNC_SPIRV_VALIDATION = "async_spirv_validation";
+const char *VK_LAYER_ASYNC_SUBMIT_VALIDATION = "async_submit_validation";
+const char *VK_LAYER_ENTRY_POINT_TIMING = "entry_point_timing";
+const char *VK_LAYER_ENTRY_POINT_TIMING_FILE = "entry_point_timing_file";
+const char *VK_LAYER_ENTRY_POINT_TIMING_FORMAT = "entry_point_timing_format";
+const char *VK_LAYER_TRACE_MARKERS = "trace_markers";
+const char *VK_LAYER_TRACE_MARKERS_FILE = "trace_markers_file";
+const char *VK_LAYER_LOCK_CONTENTION_REPORT = "lock_contention_report";
+const char *VK_LAYER_LOCK_CONTENTION_REPORT_FILE = "lock_contention_report_file";
+const char *VK_LAYER_MEMORY_REPORT = "memory_report";
+const char *VK_LAYER_MEMORY_REPORT_FILE = "memory_report_file";
+const char *VK_LAYER_MEMORY_REPORT_INTERVAL = "memory_report_interval";
+const char *VK_LAYER_APP_ALLOCATION_CALLBACKS = "app_allocation_callbacks";
+const char *VK_LAYER_FRAME_BUDGET = "frame_budget";
+const char *VK_LAYER_FRAME_BUDGET_SAMPLE_RATE = "frame_budget_sample_rate";
+const char *VK_LAYER_CHECK_TELEMETRY = "check_telemetry";
+const char *VK_LAYER_CHECK_TELEMETRY_FILE = "check_telemetry_file";
+const char *VK_LAYER_CHECK_TELEMETRY_INTERVAL = "check_telemetry_interval";
+
+// SyncVal
+// ---
+const char *VK_LAYER_SYNCVAL_STATS = "syncval_stats";
+
+// Draw time check sampling
+// ---
+const char *VK_LAYER_DRAW_SAMPLING_MODE = "draw_sampling_mode";
+const char *VK_LAYER_DRAW_STATE_SAMPLE_RATE = "draw_state_sample_rate";
+const char *VK_LAYER_DESCRIPTOR_SAMPLE_RATE = "descriptor_sample_rate";
 
 const char *VK_LAYER_PRINTF_TO_STDOUT = "printf_to_stdout";
 const char *VK_LAYER_PRINTF_VERBOSE = "printf_verbose";
@@ -80,6 +119,9 @@ const char *VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESSES = "gpuav_max_buffer_devic
 const char *VK_LAYER_GPUAV_VALIDATE_RAY_QUERY = "gpuav_validate_ray_query";
 const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
+const char *VK_LAYER_GPUAV_ASYNC_SHADER_INSTRUMENTATION = "gpuav_async_shader_instrumentation";
+const char *VK_LAYER_GPUAV_ASYNC_PIPELINE_INSTRUMENTATION = "gpuav_async_pipeline_instrumentation";
+const char *VK_LAYER_GPUAV_DEDUPLICATE_ERRORS = "gpuav_deduplicate_errors";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -95,6 +137,8 @@ const char *VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_i
 
 // Message Formatting
 const char *VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME = "message_format_display_application_name";
+const char *VK_LAYER_MESSAGE_FORMAT_DEFERRED_OUTPUT = "message_format_deferred_output";
+const char *VK_LAYER_MESSAGE_FORMAT_BINARY_LOG = "message_format_binary_log";
 
 // These were deprecated after the 1.3.280 SDK release
 const char *DEPRECATED_VK_LAYER_GPUAV_VALIDATE_COPIES = "gpuav_validate_copies";
@@ -366,7 +410,78 @@ static const char *GetDefaultPrefix() {
     return "LAYER";
 #endif
 }
+
+static void SetApplicationName(ConfigAndEnvSettings *settings_data) {
+    // Grab application name here while we have access to it and know if to save it or not
+    if (settings_data->message_format_settings->display_application_name) {
+        settings_data->message_format_settings->application_name =
+            settings_data->create_info->pApplicationInfo ? settings_data->create_info->pApplicationInfo->pApplicationName : "";
+    }
+}
+
+// Everything ProcessConfigAndEnvSettings resolves, so the settings of the next instance can be copied instead of parsed.
+//
+// Without settings in its pNext chain, the settings of an instance only depend on the environment and on the settings
+// file. Apps and loaders probing for the layer create and destroy many instances, and each vkCreateInstance would
+// otherwise parse the settings file and look up every setting in the environment again.
+struct ParsedSettings {
+    size_t environment_hash = 0;
+    CHECK_ENABLED enables{};
+    CHECK_DISABLED disables{};
+    vvl::unordered_set<uint32_t> message_filter_list;
+    uint32_t duplicate_message_limit = 0;
+    MessageFormatSettings message_format_settings;
+    bool fine_grained_locking = true;
+    uint32_t parallel_validation_thread_count = 0;
+    GpuAVSettings gpuav_settings;
+    DebugPrintfSettings printf_settings;
+    SyncValSettings syncval_settings;
+    CoreChecksSettings core_settings;
+    EntryPointTimingSettings entry_point_timing_settings;
+    std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
+
+    ParsedSettings(size_t hash, const ConfigAndEnvSettings &settings_data)
+        : environment_hash(hash),
+          enables(settings_data.enables),
+          disables(settings_data.disables),
+          message_filter_list(settings_data.message_filter_list),
+          duplicate_message_limit(*settings_data.duplicate_message_limit),
+          message_format_settings(*settings_data.message_format_settings),
+          fine_grained_locking(*settings_data.fine_grained_locking),
+          parallel_validation_thread_count(*settings_data.parallel_validation_thread_count),
+          gpuav_settings(*settings_data.gpuav_settings),
+          printf_settings(*settings_data.printf_settings),
+          syncval_settings(*settings_data.syncval_settings),
+          core_settings(*settings_data.core_settings),
+          entry_point_timing_settings(*settings_data.entry_point_timing_settings),
+          custom_stype_info(::custom_stype_info) {}
+
+    void Restore(ConfigAndEnvSettings *settings_data) const {
+        settings_data->enables = enables;
+        settings_data->disables = disables;
+        settings_data->message_filter_list = message_filter_list;
+        *settings_data->duplicate_message_limit = duplicate_message_limit;
+        settings_data->message_format_settings->display_application_name = message_format_settings.display_application_name;
+        settings_data->message_format_settings->deferred_output = message_format_settings.deferred_output;
+        settings_data->message_format_settings->binary_log = message_format_settings.binary_log;
+        *settings_data->fine_grained_locking = fine_grained_locking;
+        *settings_data->parallel_validation_thread_count = parallel_validation_thread_count;
+        *settings_data->gpuav_settings = gpuav_settings;
+        *settings_data->printf_settings = printf_settings;
+        *settings_data->syncval_settings = syncval_settings;
+        *settings_data->core_settings = core_settings;
+        *settings_data->entry_point_timing_settings = entry_point_timing_settings;
+        ::custom_stype_info = custom_stype_info;
+        SetApplicationName(settings_data);
+    }
+};
+
+static std::mutex parsed_settings_lock;
+static std::optional<ParsedSettings> parsed_settings;
+
+static void ParseConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
 #endif
+
 // Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     // When compiling a build for self validation, ProcessConfigAndEnvSettings immediately returns,
@@ -376,6 +491,31 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     (void)settings_data;
     return;
 #else
+    const VkInstanceCreateInfo *create_info = settings_data->create_info;
+    const bool settings_in_pnext = vkuFindLayerSettingsCreateInfo(create_info) ||
+                                   vku::FindStructInPNextChain<VkValidationFeaturesEXT>(create_info) ||
+                                   vku::FindStructInPNextChain<VkValidationFlagsEXT>(create_info);
+    size_t environment_hash = 0;
+    const bool reusable = !settings_in_pnext && HashEnvironment(environment_hash);
+    if (reusable) {
+        std::lock_guard<std::mutex> guard(parsed_settings_lock);
+        if (parsed_settings && parsed_settings->environment_hash == environment_hash) {
+            parsed_settings->Restore(settings_data);
+            return;
+        }
+    }
+
+    ParseConfigAndEnvSettings(settings_data);
+
+    if (reusable) {
+        std::lock_guard<std::mutex> guard(parsed_settings_lock);
+        parsed_settings.emplace(environment_hash, *settings_data);
+    }
+#endif
+}
+
+#if !defined(BUILD_SELF_VVL)
+static void ParseConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     // If not cleared, garbage has been seen in some Android run effecting the error message
     custom_stype_info.clear();
 
@@ -407,6 +547,17 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING, *settings_data->fine_grained_locking);
     }
 
+    // Parallel Validation
+    SetValidationSetting(layer_setting_set, settings_data->enables, parallel_validation, VK_LAYER_PARALLEL_VALIDATION);
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_VALIDATION_THREAD_COUNT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_VALIDATION_THREAD_COUNT,
+                                *settings_data->parallel_validation_thread_count);
+    }
+    SetValidationSetting(layer_setting_set, settings_data->enables, async_spirv_validation, VK_LAYER_ASYNC_SPIRV_VALIDATION);
+
+    // Async Submit Validation
+    SetValidationSetting(layer_setting_set, settings_data->enables, async_submit_validation, VK_LAYER_ASYNC_SUBMIT_VALIDATION);
+
     // Message ID Filtering
     std::vector<std::string> message_id_filter;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_ID_FILTER)) {
@@ -428,10 +579,107 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST, custom_stype_info);
     }
 
+    EntryPointTimingSettings &entry_point_timing_settings = *settings_data->entry_point_timing_settings;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ENTRY_POINT_TIMING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ENTRY_POINT_TIMING, entry_point_timing_settings.enabled);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ENTRY_POINT_TIMING_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ENTRY_POINT_TIMING_FILE, entry_point_timing_settings.output_file);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ENTRY_POINT_TIMING_FORMAT)) {
+        std::string format;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ENTRY_POINT_TIMING_FORMAT, format);
+        entry_point_timing_settings.chrome_trace = (format == "CHROME_TRACE");
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_TRACE_MARKERS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_TRACE_MARKERS, entry_point_timing_settings.trace_markers);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_TRACE_MARKERS_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_TRACE_MARKERS_FILE, entry_point_timing_settings.trace_file);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LOCK_CONTENTION_REPORT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LOCK_CONTENTION_REPORT,
+                                entry_point_timing_settings.lock_contention_report);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_LOCK_CONTENTION_REPORT_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_LOCK_CONTENTION_REPORT_FILE,
+                                entry_point_timing_settings.lock_contention_report_file);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MEMORY_REPORT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MEMORY_REPORT, entry_point_timing_settings.memory_report);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MEMORY_REPORT_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MEMORY_REPORT_FILE, entry_point_timing_settings.memory_report_file);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MEMORY_REPORT_INTERVAL)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MEMORY_REPORT_INTERVAL,
+                                entry_point_timing_settings.memory_report_interval);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_APP_ALLOCATION_CALLBACKS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_APP_ALLOCATION_CALLBACKS,
+                                entry_point_timing_settings.app_allocation_callbacks);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FRAME_BUDGET)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FRAME_BUDGET, entry_point_timing_settings.frame_budget_us);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FRAME_BUDGET_SAMPLE_RATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FRAME_BUDGET_SAMPLE_RATE,
+                                entry_point_timing_settings.frame_budget_sample_rate);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CHECK_TELEMETRY)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CHECK_TELEMETRY, entry_point_timing_settings.check_telemetry);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CHECK_TELEMETRY_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CHECK_TELEMETRY_FILE, entry_point_timing_settings.check_telemetry_file);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CHECK_TELEMETRY_INTERVAL)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CHECK_TELEMETRY_INTERVAL,
+                                entry_point_timing_settings.check_telemetry_interval);
+    }
+
+    SyncValSettings &syncval_settings = *settings_data->syncval_settings;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_STATS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_STATS, syncval_settings.stats);
+    }
+    // Read here rather than when a device is created, so they are resolved with the other settings of the instance
+    const std::string env_debug_command_number = GetEnvironment("VK_SYNCVAL_DEBUG_COMMAND_NUMBER");
+    if (!env_debug_command_number.empty()) {
+        syncval_settings.debug_command_number = static_cast<uint32_t>(std::stoul(env_debug_command_number));
+    }
+    const std::string env_debug_reset_count = GetEnvironment("VK_SYNCVAL_DEBUG_RESET_COUNT");
+    if (!env_debug_reset_count.empty()) {
+        syncval_settings.debug_reset_count = static_cast<uint32_t>(std::stoul(env_debug_reset_count));
+    }
+    syncval_settings.debug_cmdbuf_pattern = GetEnvironment("VK_SYNCVAL_DEBUG_CMDBUF_PATTERN");
+    vvl::ToLower(syncval_settings.debug_cmdbuf_pattern);
+    // Specify non-zero number to print the stats to stdout on destruction
+    const std::string show_stats_str = GetEnvironment("VK_SYNCVAL_SHOW_STATS");
+    syncval_settings.show_stats = !show_stats_str.empty() && std::stoul(show_stats_str) != 0;
+
+    CoreChecksSettings &core_settings = *settings_data->core_settings;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DRAW_SAMPLING_MODE)) {
+        std::string mode;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DRAW_SAMPLING_MODE, mode);
+        core_settings.draw_sampling_mode = (mode == "HASH") ? DrawSamplingMode::Hash : DrawSamplingMode::EveryNth;
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DRAW_STATE_SAMPLE_RATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DRAW_STATE_SAMPLE_RATE, core_settings.draw_state_sample_rate);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DESCRIPTOR_SAMPLE_RATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DESCRIPTOR_SAMPLE_RATE, core_settings.descriptor_sample_rate);
+    }
+
     DebugPrintfSettings &printf_settings = *settings_data->printf_settings;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_TO_STDOUT)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_TO_STDOUT, printf_settings.to_stdout);
     }
+    // This option was published when Debug PrintF came out, leave to not break people's flow
+    // Deprecated right after the 1.3.280 SDK release
+    if (!GetEnvironment("DEBUG_PRINTF_TO_STDOUT").empty()) {
+        printf("Validation Setting Warning - DEBUG_PRINTF_TO_STDOUT was set, this is deprecated, please use %s\n",
+               "VK_LAYER_PRINTF_TO_STDOUT");
+        printf_settings.to_stdout = true;
+    }
 
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_VERBOSE)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_VERBOSE, printf_settings.verbose);
@@ -492,6 +740,24 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                    DEPRECATED_GPUAV_SELECT_INSTRUMENTED_SHADERS, VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS);
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_ASYNC_SHADER_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_ASYNC_SHADER_INSTRUMENTATION,
+                                    gpuav_settings.async_shader_instrumentation);
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_ASYNC_PIPELINE_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_ASYNC_PIPELINE_INSTRUMENTATION,
+                                    gpuav_settings.async_pipeline_instrumentation);
+        }
+        // Builds on the shader modules instrumentation worker threads
+        if (!gpuav_settings.async_shader_instrumentation) {
+            gpuav_settings.async_pipeline_instrumentation = false;
+        }
+
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEDUPLICATE_ERRORS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEDUPLICATE_ERRORS, gpuav_settings.deduplicate_errors);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -563,10 +829,16 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME,
                                 settings_data->message_format_settings->display_application_name);
     }
-    // Grab application name here while we have access to it and know if to save it or not
-    if (settings_data->message_format_settings->display_application_name) {
-        settings_data->message_format_settings->application_name =
-            settings_data->create_info->pApplicationInfo ? settings_data->create_info->pApplicationInfo->pApplicationName : "";
+    SetApplicationName(settings_data);
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_DEFERRED_OUTPUT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_DEFERRED_OUTPUT,
+                                settings_data->message_format_settings->deferred_output);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_BINARY_LOG)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_BINARY_LOG,
+                                settings_data->message_format_settings->binary_log);
     }
 
     const auto *validation_features_ext = vku::FindStructInPNextChain<VkValidationFeaturesEXT>(settings_data->create_info);
@@ -604,6 +876,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     if (use_fine_grained_settings) {
         SetValidationSetting(layer_setting_set, settings_data->disables, stateless_checks, VK_LAYER_STATELESS_PARAM);
         SetValidationSetting(layer_setting_set, settings_data->disables, thread_safety, VK_LAYER_THREAD_SAFETY);
+        SetValidationSetting(layer_setting_set, settings_data->enables, thread_safety_owner_cache,
+                             VK_LAYER_THREAD_SAFETY_OWNER_CACHE);
+        SetValidationSetting(layer_setting_set, settings_data->enables, thread_safety_skip_immutable_reads,
+                             VK_LAYER_THREAD_SAFETY_SKIP_IMMUTABLE_READS);
         SetValidationSetting(layer_setting_set, settings_data->disables, core_checks, VK_LAYER_VALIDATE_CORE);
         SetValidationSetting(layer_setting_set, settings_data->disables, command_buffer_state, VK_LAYER_CHECK_COMMAND_BUFFER);
         SetValidationSetting(layer_setting_set, settings_data->disables, object_in_use, VK_LAYER_CHECK_OBJECT_IN_USE);
@@ -618,5 +894,5 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     }
 
     vkuDestroyLayerSettingSet(layer_setting_set, nullptr);
-#endif
 }
+#endif
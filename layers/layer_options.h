@@ -75,6 +75,11 @@ enum EnableFlags {
     vendor_specific_nvidia,
     debug_printf_validation,
     sync_validation,
+    thread_safety_owner_cache,
+    thread_safety_skip_immutable_reads,
+    parallel_validation,
+    async_submit_validation,
+    async_spirv_validation,
     // Insert new enables above this line
     kMaxEnableFlags,
 };
@@ -87,6 +92,8 @@ using CHECK_ENABLED = std::array<bool, kMaxEnableFlags>;
 struct GpuAVSettings;
 struct DebugPrintfSettings;
 struct SyncValSettings;
+struct CoreChecksSettings;
+struct EntryPointTimingSettings;
 struct MessageFormatSettings;
 struct ConfigAndEnvSettings {
     const char *layer_description;
@@ -97,9 +104,12 @@ struct ConfigAndEnvSettings {
     uint32_t *duplicate_message_limit;
     MessageFormatSettings *message_format_settings;
     bool *fine_grained_locking;
+    uint32_t *parallel_validation_thread_count;
     GpuAVSettings *gpuav_settings;
     DebugPrintfSettings *printf_settings;
     SyncValSettings *syncval_settings;
+    CoreChecksSettings *core_settings;
+    EntryPointTimingSettings *entry_point_timing_settings;
 };
 
 static const vvl::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
@@ -166,6 +176,11 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_NVIDIA",                      // vendor_specific_nvidia,
     "VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT",                       // debug_printf,
     "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT",         // sync_validation,
+    "VALIDATION_CHECK_ENABLE_THREAD_SAFETY_OWNER_CACHE",                   // thread_safety_owner_cache,
+    "VALIDATION_CHECK_ENABLE_THREAD_SAFETY_SKIP_IMMUTABLE_READS",          // thread_safety_skip_immutable_reads,
+    "VALIDATION_CHECK_ENABLE_PARALLEL_VALIDATION",                         // parallel_validation,
+    "VALIDATION_CHECK_ENABLE_ASYNC_SUBMIT_VALIDATION",                     // async_submit_validation,
+    "VALIDATION_CHECK_ENABLE_ASYNC_SPIRV_VALIDATION",                      // async_spirv_validation,
 };
 
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
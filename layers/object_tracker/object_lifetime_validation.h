@@ -34,9 +34,49 @@ struct ObjTrackState {
     std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
 };
 
-typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
-// Used for GPL and we know there are at most only 4 libraries that should be used
-typedef vvl::concurrent_unordered_map<uint64_t, small_vector<std::shared_ptr<ObjTrackState>, 4>, 6> object_list_map_type;
+// Storage for the ObjTrackState records of every object type.
+// Records are handed out from fixed size chunks that live as long as the ObjectLifetimes object, so their address never changes
+// and the object maps can store plain pointers. Destroyed records go on a free list and are reused by the next object, so the
+// create/destroy churn of transient objects (descriptor sets, command buffers) neither allocates nor touches a reference count.
+class ObjTrackStateSlab {
+  public:
+    ObjTrackState *Allocate() {
+        ObjTrackState *node = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            if (!free_list_.empty()) {
+                node = free_list_.back();
+                free_list_.pop_back();
+            } else {
+                if (chunks_.empty() || next_in_chunk_ == kChunkSize) {
+                    chunks_.emplace_back(std::make_unique<ObjTrackState[]>(kChunkSize));
+                    next_in_chunk_ = 0;
+                }
+                node = &chunks_.back()[next_in_chunk_++];
+            }
+        }
+        *node = ObjTrackState{};
+        return node;
+    }
+
+    void Free(ObjTrackState *node) {
+        node->child_objects.reset();
+        std::lock_guard<std::mutex> guard(lock_);
+        free_list_.emplace_back(node);
+    }
+
+  private:
+    static constexpr size_t kChunkSize = 1024;
+    std::mutex lock_;
+    std::vector<std::unique_ptr<ObjTrackState[]>> chunks_;
+    size_t next_in_chunk_ = 0;
+    std::vector<ObjTrackState *> free_list_;
+};
+
+// Values point into ObjectLifetimes::object_slab
+typedef vvl::concurrent_unordered_map<uint64_t, ObjTrackState *, 6> object_map_type;
+// Used for GPL and we know there are at most only 4 libraries that should be used, holds the library handles
+typedef vvl::concurrent_unordered_map<uint64_t, small_vector<uint64_t, 4>, 6> object_list_map_type;
 
 class ObjectLifetimes : public ValidationObject {
     using Func = vvl::Func;
@@ -56,6 +96,8 @@ class ObjectLifetimes : public ValidationObject {
 
     std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
     std::atomic<uint64_t> num_total_objects;
+    // Backing storage for the ObjTrackState of every map below
+    ObjTrackStateSlab object_slab;
     // Vector of unordered_maps per object type to hold ObjTrackState info
     object_map_type object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
@@ -64,18 +106,32 @@ class ObjectLifetimes : public ValidationObject {
 
     bool null_descriptor_enabled;
 
+    // Tags set on the unique IDs of the wrapped objects tracked by this object, see TracksObject
+    static std::atomic<uint64_t> next_object_tag_base;
+    const uint64_t object_tag_base;
+    uint64_t ObjectTag(VulkanObjectType object_type) const { return object_tag_base | object_type; }
+    void TagObject(uint64_t object_handle, VulkanObjectType object_type);
+    void UntagObject(uint64_t object_handle, VulkanObjectType object_type);
+
     // Constructor for object lifetime tracking
-    ObjectLifetimes() : num_objects{}, num_total_objects(0), null_descriptor_enabled(false) {
+    ObjectLifetimes()
+        : num_objects{},
+          num_total_objects(0),
+          null_descriptor_enabled(false),
+          object_tag_base(next_object_tag_base.fetch_add(1) << 8) {
         container_type = LayerObjectTypeObjectTracker;
     }
     ~ObjectLifetimes() {}
 
+    // pNode is released back to object_slab if it could not be inserted
     template <typename T1>
-    void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, const Location &loc,
-                      std::shared_ptr<ObjTrackState> pNode) {
+    bool InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, const Location &loc, ObjTrackState *pNode) {
         uint64_t object_handle = HandleToUint64(object);
         const bool inserted = map.insert(object_handle, pNode);
-        if (!inserted) {
+        if (inserted) {
+            TagObject(object_handle, object_type);
+        } else {
+            object_slab.Free(pNode);
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
             // TODO should this be an error? https://gitlab.khronos.org/vulkan/vulkan/-/issues/3616
@@ -85,6 +141,7 @@ class ObjectLifetimes : public ValidationObject {
                            "race condition in the application.",
                            string_VulkanObjectType(object_type), object_handle);
         }
+        return inserted;
     }
 
     bool ReportUndestroyedInstanceObjects(VkInstance instance, const Location &loc) const;
@@ -100,7 +157,9 @@ class ObjectLifetimes : public ValidationObject {
     void CreateQueue(VkQueue vkObj, const Location &loc);
     void AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer, VkCommandBufferLevel level,
                                const Location &loc);
-    void AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location &loc);
+    void AllocateDescriptorSets(VkDescriptorPool descriptor_pool, uint32_t descriptor_set_count,
+                                const VkDescriptorSet *descriptor_sets, const Location &loc);
+    void DestroyDescriptorPoolChildren(ObjTrackState &pool_node);
     void AllocateDisplayKHR(VkPhysicalDevice physical_device, VkDisplayKHR display, const Location &loc);
     void CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain, const Location &loc);
     void DestroyLeakedInstanceObjects();
@@ -136,18 +195,17 @@ class ObjectLifetimes : public ValidationObject {
         uint64_t object_handle = HandleToUint64(object);
         const bool custom_allocator = (pAllocator != nullptr);
         if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
+            auto pNewObjNode = object_slab.Allocate();
             pNewObjNode->object_type = object_type;
             pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
             pNewObjNode->handle = object_handle;
+            if (object_type == kVulkanObjectTypeDescriptorPool) {
+                pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
+            }
 
             InsertObject(object_map[object_type], object, object_type, loc, pNewObjNode);
             num_objects[object_type]++;
             num_total_objects++;
-
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
-                pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
-            }
         }
     }
 
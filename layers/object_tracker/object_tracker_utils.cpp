@@ -31,7 +31,24 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     return typed_handle;
 }
 
+std::atomic<uint64_t> ObjectLifetimes::next_object_tag_base{1};
+
+// The tag of a wrapped object can't survive its destruction, the next object of the slot has another unique ID.
+// The handles that aren't wrapped are not IDs of unique_id_mapping and are never tagged.
+void ObjectLifetimes::TagObject(uint64_t object_handle, VulkanObjectType object_type) {
+    unique_id_mapping.SetTag(object_handle, ObjectTag(object_type));
+}
+
+void ObjectLifetimes::UntagObject(uint64_t object_handle, VulkanObjectType object_type) {
+    unique_id_mapping.ClearTag(object_handle, ObjectTag(object_type));
+}
+
 bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
+    // A wrapped object tracked by this object carries its tag, the maps are only needed for the other handles and to tell
+    // what is wrong with an object that isn't tracked here (destroyed, or from another device)
+    if (unique_id_mapping.HasTag(object_handle, ObjectTag(object_type))) {
+        return true;
+    }
     // Look for object in object map
     if (object_map[object_type].contains(object_handle)) {
         return true;
@@ -121,17 +138,17 @@ bool ObjectLifetimes::CheckPipelineObjectValidity(uint64_t object_handle, const
         return skip;  // no-linked
     }
     for (const auto &pipeline : itr->second) {
-        if (!TracksObject(pipeline->handle, kVulkanObjectTypePipeline)) {
+        if (!TracksObject(pipeline, kVulkanObjectTypePipeline)) {
             skip |= LogError(invalid_handle_vuid, instance, loc,
                              "Invalid VkPipeline Object 0x%" PRIxLEAST64
                              " as it was created with VkPipelineLibraryCreateInfoKHR::pLibraries 0x%" PRIxLEAST64
                              " that doesn't exist anymore. The application must maintain the lifetime of a pipeline library based "
                              "on the pipelines that link with it.",
-                             object_handle, pipeline->handle);
+                             object_handle, pipeline);
             break;
         } else {
             // Libaries pipeline can have their own nested libraries
-            skip |= CheckPipelineObjectValidity(pipeline->handle, invalid_handle_vuid, loc);
+            skip |= CheckPipelineObjectValidity(pipeline, invalid_handle_vuid, loc);
         }
     }
     return skip;
@@ -140,6 +157,7 @@ bool ObjectLifetimes::CheckPipelineObjectValidity(uint64_t object_handle, const
 void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType object_type) {
     assert(object != HandleToUint64(VK_NULL_HANDLE));
 
+    UntagObject(object, object_type);
     auto item = object_map[object_type].pop(object);
     if (item == object_map[object_type].end()) {
         // We've already checked that the object exists. If we couldn't find and atomically remove it
@@ -158,6 +176,7 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
     assert(num_objects[item->second->object_type] > 0);
 
     num_objects[item->second->object_type]--;
+    object_slab.Free(item->second);
 }
 
 // Destroy memRef lists and free all memory
@@ -171,15 +190,23 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
         assert(num_objects[obj_index] > 0);
         num_objects[obj_index]--;
         object_map[kVulkanObjectTypeQueue].erase(queue.first);
+        object_slab.Free(queue.second);
     }
 }
 
+// Only called when the parent device or instance is destroyed, nothing else can look up these objects anymore. They are
+// dropped in one sweep of the map instead of popped one by one, their records are freed with object_slab.
 void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
-    auto snapshot = object_map[object_type].snapshot();
-    for (const auto &item : snapshot) {
-        auto object_info = item.second;
-        DestroyObjectSilently(object_info->handle, object_type);
+    auto &map = object_map[object_type];
+    uint64_t count = 0;
+    for (const auto &item : map.snapshot()) {
+        UntagObject(item.first, object_type);
+        count++;
     }
+    map.clear();
+    assert(num_objects[object_type] >= count);
+    num_objects[object_type] -= count;
+    num_total_objects -= count;
 }
 
 bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core_object_type, const char *invalid_handle_vuid,
@@ -190,7 +217,7 @@ bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core
 
 void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
                                             VkCommandBufferLevel level, const Location &loc) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
+    auto new_obj_node = object_slab.Allocate();
     new_obj_node->object_type = kVulkanObjectTypeCommandBuffer;
     new_obj_node->handle = HandleToUint64(command_buffer);
     new_obj_node->parent_object = HandleToUint64(command_pool);
@@ -222,20 +249,50 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkComman
     return skip;
 }
 
-void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location &loc) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeDescriptorSet;
-    new_obj_node->status = OBJSTATUS_NONE;
-    new_obj_node->handle = HandleToUint64(descriptor_set);
-    new_obj_node->parent_object = HandleToUint64(descriptor_pool);
-    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, loc, new_obj_node);
-    num_objects[kVulkanObjectTypeDescriptorSet]++;
-    num_total_objects++;
-
+void ObjectLifetimes::AllocateDescriptorSets(VkDescriptorPool descriptor_pool, uint32_t descriptor_set_count,
+                                             const VkDescriptorSet *descriptor_sets, const Location &loc) {
+    // Look the pool up once for the whole batch
+    vvl::unordered_set<uint64_t> *pool_children = nullptr;
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
+        pool_children = itr->second->child_objects.get();
+        pool_children->reserve(pool_children->size() + descriptor_set_count);
+    }
+
+    for (uint32_t i = 0; i < descriptor_set_count; i++) {
+        const VkDescriptorSet descriptor_set = descriptor_sets[i];
+        auto new_obj_node = object_slab.Allocate();
+        new_obj_node->object_type = kVulkanObjectTypeDescriptorSet;
+        new_obj_node->status = OBJSTATUS_NONE;
+        new_obj_node->handle = HandleToUint64(descriptor_set);
+        new_obj_node->parent_object = HandleToUint64(descriptor_pool);
+        InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet,
+                     loc.dot(Field::pDescriptorSets, i), new_obj_node);
+        if (pool_children) {
+            pool_children->insert(HandleToUint64(descriptor_set));
+        }
+    }
+    num_objects[kVulkanObjectTypeDescriptorSet] += descriptor_set_count;
+    num_total_objects += descriptor_set_count;
+}
+
+void ObjectLifetimes::DestroyDescriptorPoolChildren(ObjTrackState &pool_node) {
+    auto &sets_map = object_map[kVulkanObjectTypeDescriptorSet];
+    uint64_t destroyed = 0;
+    for (const uint64_t set : *pool_node.child_objects) {
+        // Children are owned by the pool, a single pop both checks and removes them
+        UntagObject(set, kVulkanObjectTypeDescriptorSet);
+        auto item = sets_map.pop(set);
+        if (item != sets_map.end()) {
+            object_slab.Free(item->second);
+            ++destroyed;
+        }
     }
+    pool_node.child_objects->clear();
+    assert(num_objects[kVulkanObjectTypeDescriptorSet] >= destroyed);
+    assert(num_total_objects >= destroyed);
+    num_objects[kVulkanObjectTypeDescriptorSet] -= destroyed;
+    num_total_objects -= destroyed;
 }
 
 bool ObjectLifetimes::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set,
@@ -397,24 +454,27 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSet2KHR(VkCommandBuffer co
 }
 
 void ObjectLifetimes::CreateQueue(VkQueue vkObj, const Location &loc) {
-    std::shared_ptr<ObjTrackState> p_obj_node = NULL;
+    ObjTrackState *p_obj_node = nullptr;
     auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
-    if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = std::make_shared<ObjTrackState>();
-        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, loc, p_obj_node);
-        num_objects[kVulkanObjectTypeQueue]++;
-        num_total_objects++;
+    const bool new_queue = queue_item == object_map[kVulkanObjectTypeQueue].end();
+    if (new_queue) {
+        p_obj_node = object_slab.Allocate();
     } else {
         p_obj_node = queue_item->second;
     }
     p_obj_node->object_type = kVulkanObjectTypeQueue;
     p_obj_node->status = OBJSTATUS_NONE;
     p_obj_node->handle = HandleToUint64(vkObj);
+    if (new_queue) {
+        InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, loc, p_obj_node);
+        num_objects[kVulkanObjectTypeQueue]++;
+        num_total_objects++;
+    }
 }
 
 void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain, const Location &loc) {
     if (!swapchain_image_map.contains(HandleToUint64(swapchain_image))) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
+        auto new_obj_node = object_slab.Allocate();
         new_obj_node->object_type = kVulkanObjectTypeImage;
         new_obj_node->status = OBJSTATUS_NONE;
         new_obj_node->handle = HandleToUint64(swapchain_image);
@@ -607,11 +667,7 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyDescriptorPoolChildren(*itr->second);
     }
 }
 
@@ -781,10 +837,8 @@ void ObjectLifetimes::PostCallRecordAllocateDescriptorSets(VkDevice device, cons
                                                            VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
     auto lock = WriteSharedLock();
-    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
-        AllocateDescriptorSet(pAllocateInfo->descriptorPool, pDescriptorSets[i],
-                              record_obj.location.dot(Field::pDescriptorSets, i));
-    }
+    AllocateDescriptorSets(pAllocateInfo->descriptorPool, pAllocateInfo->descriptorSetCount, pDescriptorSets,
+                           record_obj.location);
 }
 
 bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
@@ -818,9 +872,11 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
     RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR);
 
     auto snapshot = swapchain_image_map.snapshot(
-        [swapchain](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
+        [swapchain](const ObjTrackState *pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
     for (const auto &itr : snapshot) {
+        UntagObject(itr.first, kVulkanObjectTypeImage);
         swapchain_image_map.erase(itr.first);
+        object_slab.Free(itr.second);
     }
 }
 
@@ -847,7 +903,7 @@ bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescr
 void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                       const VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
     auto lock = WriteSharedLock();
-    std::shared_ptr<ObjTrackState> pool_node = nullptr;
+    ObjTrackState *pool_node = nullptr;
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
         pool_node = itr->second;
@@ -890,11 +946,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto lock = WriteSharedLock();
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyDescriptorPoolChildren(*itr->second);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -910,7 +962,7 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
 
     auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+        [commandPool](const ObjTrackState *pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     for (const auto &itr : snapshot) {
         auto node = itr.second;
         skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
@@ -926,7 +978,7 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
     auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+        [commandPool](const ObjTrackState *pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
     for (const auto &itr : snapshot) {
         RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
@@ -964,7 +1016,7 @@ void ObjectLifetimes::PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(V
 void ObjectLifetimes::AllocateDisplayKHR(VkPhysicalDevice physical_device, VkDisplayKHR display, const Location &loc) {
     auto iter = object_map[kVulkanObjectTypeDisplayKHR].find(HandleToUint64(display));
     if (iter == object_map[kVulkanObjectTypeDisplayKHR].end()) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
+        auto new_obj_node = object_slab.Allocate();
         new_obj_node->status = OBJSTATUS_NONE;
         new_obj_node->object_type = kVulkanObjectTypeDisplayKHR;
         new_obj_node->handle = HandleToUint64(display);
@@ -1508,11 +1560,9 @@ void ObjectLifetimes::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkP
             if (auto pNext = vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(pCreateInfos[index].pNext)) {
                 if ((pNext->libraryCount > 0) && (pNext->pLibraries)) {
                     const uint64_t linked_handle = HandleToUint64(pPipelines[index]);
-                    small_vector<std::shared_ptr<ObjTrackState>, 4> libraries;
+                    small_vector<uint64_t, 4> libraries;
                     for (uint32_t index2 = 0; index2 < pNext->libraryCount; ++index2) {
-                        const uint64_t library_handle = HandleToUint64(pNext->pLibraries[index2]);
-                        const auto &linked_pipeline = object_map[kVulkanObjectTypePipeline].find(library_handle);
-                        libraries.emplace_back(linked_pipeline->second);
+                        libraries.emplace_back(HandleToUint64(pNext->pLibraries[index2]));
                     }
                     linked_graphics_pipeline_map.insert(linked_handle, libraries);
                 }
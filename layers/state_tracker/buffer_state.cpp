@@ -20,6 +20,7 @@
 #include "state_tracker/buffer_state.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "state_tracker/state_tracker.h"
+#include "chassis/memory_report.h"
 
 static VkExternalMemoryHandleTypeFlags GetExternalHandleTypes(const VkBufferCreateInfo *create_info) {
     const auto *external_memory_info = vku::FindStructInPNextChain<VkExternalMemoryBufferCreateInfo>(create_info->pNext);
@@ -97,6 +98,10 @@ bool Buffer::CompareCreateInfo(const Buffer &other) const {
            valid_queue_family;
 }
 
+void Buffer::AddMemoryUsage(MemoryUsage &usage) const {
+    usage.Add(MemoryCategory::Buffer, sizeof(*this) + create_info.queueFamilyIndexCount * sizeof(uint32_t));
+}
+
 BufferView::BufferView(const std::shared_ptr<vvl::Buffer> &bf, VkBufferView handle, const VkBufferViewCreateInfo *pCreateInfo,
                        VkFormatFeatureFlags2KHR format_features)
     : StateObject(handle, kVulkanObjectTypeBufferView),
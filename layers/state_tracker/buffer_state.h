@@ -72,6 +72,8 @@ class Buffer : public Bindable {
     // This function is only used for comparing Imported External Dedicated Memory
     bool CompareCreateInfo(const Buffer &other) const;
 
+    void AddMemoryUsage(MemoryUsage &usage) const override;
+
   private:
     std::variant<std::monostate, BindableLinearMemoryTracker, BindableSparseMemoryTracker> tracker_;
 };
@@ -23,6 +23,10 @@
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
+#include "chassis/memory_report.h"
+
+#include <shared_mutex>
+#include <string_view>
 
 static ShaderObjectStage inline ConvertToShaderObjectStage(VkShaderStageFlagBits stage) {
     if (stage == VK_SHADER_STAGE_VERTEX_BIT) return ShaderObjectStage::VERTEX;
@@ -156,11 +160,44 @@ void CommandPool::Destroy() {
         dev_data.Destroy<CommandBuffer>(entry.first);
     }
     commandBuffers.clear();
+    {
+        std::lock_guard<std::mutex> guard(free_layout_maps_lock_);
+        free_layout_maps_.clear();
+    }
     StateObject::Destroy();
 }
 
+std::shared_ptr<ImageSubresourceLayoutMap> CommandPool::AcquireLayoutMap(const vvl::Image &image_state) const {
+    std::shared_ptr<ImageSubresourceLayoutMap> layout_map;
+    {
+        std::lock_guard<std::mutex> guard(free_layout_maps_lock_);
+        if (!free_layout_maps_.empty()) {
+            layout_map = std::move(free_layout_maps_.back());
+            free_layout_maps_.pop_back();
+        }
+    }
+    if (layout_map) {
+        layout_map->Reset(image_state);
+    } else {
+        layout_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
+    }
+    return layout_map;
+}
+
+void CommandPool::ReleaseLayoutMap(std::shared_ptr<ImageSubresourceLayoutMap> &&layout_map) const {
+    // Still referenced by a copy of the command buffer state (e.g. the submit time validation), can't be reused
+    if (!layout_map || layout_map.use_count() != 1) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(free_layout_maps_lock_);
+    if (free_layout_maps_.size() < kMaxFreeLayoutMaps) {
+        free_layout_maps_.emplace_back(std::move(layout_map));
+    }
+}
+
 void CommandBuffer::SetActiveSubpass(uint32_t subpass) {
     active_subpass_ = subpass;
+    render_state_generation++;
     // Always reset stored rasterization samples count
     active_subpass_sample_count_ = std::nullopt;
 }
@@ -190,25 +227,44 @@ const vvl::ImageView *CommandBuffer::GetActiveAttachmentImageViewState(uint32_t
     return active_attachments[index].image_view;
 }
 
+StateObject::ParentLink *CommandBuffer::AllocateParentLink() {
+    if (free_parent_links_.empty()) {
+        return &parent_link_storage_.emplace_back();
+    }
+    StateObject::ParentLink *link = free_parent_links_.back();
+    free_parent_links_.pop_back();
+    return link;
+}
+
+void CommandBuffer::UnlinkChild(StateObject &child_node, StateObject::ParentLink *link) {
+    child_node.UnlinkParent(*link);
+    free_parent_links_.emplace_back(link);
+}
+
 void CommandBuffer::AddChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    if (child_node->AddParent(this)) {
-        object_bindings.insert(child_node);
+    auto [it, inserted] = object_bindings.emplace(child_node, nullptr);
+    if (inserted) {
+        it->second = AllocateParentLink();
+        child_node->LinkParent(*this, *it->second);
     }
 }
 
 void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    child_node->RemoveParent(this);
-    object_bindings.erase(child_node);
+    auto it = object_bindings.find(child_node);
+    if (it != object_bindings.end()) {
+        UnlinkChild(*child_node, it->second);
+        object_bindings.erase(it);
+    }
 }
 
 // Reset the command buffer state
 // Maintain the createInfo and set state to CB_NEW, but clear all other state
 void CommandBuffer::ResetCBState() {
     // Remove object bindings
-    for (const auto &obj : object_bindings) {
-        obj->RemoveParent(this);
+    for (const auto &[obj, link] : object_bindings) {
+        UnlinkChild(*obj, link);
     }
     object_bindings.clear();
     broken_bindings.clear();
@@ -225,8 +281,12 @@ void CommandBuffer::ResetCBState() {
     resumesRenderPassInstance = false;
     state = CbState::New;
     command_count = 0;
+    action_command_count = 0;
     submitCount = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
+    // The draw state generations are not reset, they keep counting so values are never reused by a later recording
+    dynamic_state_generation++;
+    vertex_buffer_generation++;
 
     dynamic_state_status.cb.reset();
     dynamic_state_status.pipeline.reset();
@@ -264,21 +324,30 @@ void CommandBuffer::ResetCBState() {
     SetActiveSubpass(0);
     rendering_attachments.Reset();
     waitedEvents.clear();
-    events.clear();
-    writeEventsBeforeWait.clear();
+    ClearRetainingCapacity(events);
+    ClearRetainingCapacity(writeEventsBeforeWait);
     activeQueries.clear();
     startedQueries.clear();
     renderPassQueries.clear();
-    image_layout_map.clear();
     aliased_image_layout_map.clear();
+    // Only the maps of the recording being reset are kept for their image, anything not reused by it goes to the pool
+    ReleaseReusableLayoutMaps();
+    for (auto &[image, layout_state] : image_layout_map) {
+        if (layout_state.map && layout_state.map.use_count() == 1) {
+            layout_state.map->Reset();
+            reusable_layout_maps_.emplace(image, std::move(layout_state));
+        }
+    }
+    image_layout_map.clear();
+    push_descriptor_validation_sets_.clear();
     current_vertex_buffer_binding_info.clear();
     primaryCommandBuffer = VK_NULL_HANDLE;
     linkedCommandBuffers.clear();
-    queue_submit_functions.clear();
-    queue_submit_functions_after_render_pass.clear();
-    cmd_execute_commands_functions.clear();
-    eventUpdates.clear();
-    queryUpdates.clear();
+    ClearRetainingCapacity(queue_submit_functions);
+    ClearRetainingCapacity(queue_submit_functions_after_render_pass);
+    ClearRetainingCapacity(cmd_execute_commands_functions);
+    ClearRetainingCapacity(eventUpdates);
+    ClearRetainingCapacity(queryUpdates);
 
     for (auto &item : lastBound) {
         item.Reset();
@@ -299,7 +368,7 @@ void CommandBuffer::ResetCBState() {
     // Clean up the label data
     debug_label.Reset();
     label_stack_depth_ = 0;
-    label_commands_.clear();
+    ClearRetainingCapacity(label_commands_);
 
     nesting_level = 0;
 
@@ -308,6 +377,8 @@ void CommandBuffer::ResetCBState() {
 
     // Clean up the label data
     dev_data.debug_report->ResetCmdDebugUtilsLabel(VkHandle());
+
+    UpdateCommandScope();
 }
 
 void CommandBuffer::Reset() {
@@ -345,16 +416,52 @@ void CommandBuffer::ResetPushConstantRangesLayoutIfIncompatible(const vvl::Pipel
     push_constant_data_chunks.clear();
 }
 
+void CommandBuffer::ReleaseReusableLayoutMaps() {
+    for (auto &[image, layout_state] : reusable_layout_maps_) {
+        command_pool->ReleaseLayoutMap(std::move(layout_state.map));
+    }
+    reusable_layout_maps_.clear();
+}
+
 void CommandBuffer::Destroy() {
     // Remove the cb debug labels
     dev_data.debug_report->EraseCmdDebugUtilsLabel(VkHandle());
     {
         auto guard = WriteLock();
         ResetCBState();
+        ReleaseReusableLayoutMaps();
     }
     StateObject::Destroy();
 }
 
+void CommandBuffer::AddMemoryUsage(MemoryUsage &usage) const {
+    auto guard = ReadLock();
+    size_t bytes = sizeof(*this);
+    bytes += MemoryUsage::MapBytes(object_bindings) + MemoryUsage::MapBytes(broken_bindings);
+    bytes += parent_link_storage_.size() * sizeof(StateObject::ParentLink) + MemoryUsage::VectorBytes(free_parent_links_);
+    auto add_layout_map = [&usage, &bytes](const std::shared_ptr<ImageSubresourceLayoutMap> &map) {
+        if (map && usage.FirstVisit(map.get())) {
+            using LayoutMap = ImageSubresourceLayoutMap::LayoutMap;
+            bytes += sizeof(ImageSubresourceLayoutMap) + map->GetLayoutMap().size() * sizeof(LayoutMap::value_type);
+        }
+    };
+    bytes += MemoryUsage::MapBytes(image_layout_map) + MemoryUsage::MapBytes(aliased_image_layout_map);
+    for (const auto &[image, layout_state] : image_layout_map) {
+        add_layout_map(layout_state.map);
+    }
+    for (const auto &[image, layout_state] : reusable_layout_maps_) {
+        add_layout_map(layout_state.map);
+    }
+    bytes += MemoryUsage::VectorBytes(events) + MemoryUsage::VectorBytes(writeEventsBeforeWait);
+    bytes += MemoryUsage::VectorBytes(queue_submit_functions) + MemoryUsage::VectorBytes(queue_submit_functions_after_render_pass);
+    bytes += MemoryUsage::VectorBytes(eventUpdates) + MemoryUsage::VectorBytes(queryUpdates);
+    bytes += MemoryUsage::VectorBytes(label_commands_) + MemoryUsage::VectorBytes(push_constant_data_chunks);
+    for (const auto &chunk : push_constant_data_chunks) {
+        bytes += MemoryUsage::VectorBytes(chunk.values);
+    }
+    usage.Add(MemoryCategory::CommandBuffer, bytes);
+}
+
 void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) {
     {
         auto guard = WriteLock();
@@ -370,8 +477,9 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
             // Only record a broken binding if one of the nodes in the invalid chain is still
             // being tracked by the command buffer. This is to try to avoid race conditions
             // caused by separate CommandBuffer and StateObject::parent_nodes locking.
-            if (object_bindings.erase(obj)) {
-                obj->RemoveParent(this);
+            if (auto it = object_bindings.find(obj); it != object_bindings.end()) {
+                UnlinkChild(*obj, it->second);
+                object_bindings.erase(it);
                 found_invalid = true;
             }
             switch (obj->Type()) {
@@ -395,6 +503,7 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
             } else if (state == CbState::Recorded) {
                 state = CbState::InvalidComplete;
             }
+            UpdateCommandScope();
             broken_bindings.emplace(invalid_nodes[0]->Handle(), log_list);
         }
     }
@@ -433,15 +542,19 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
         if (alias_iter != aliased_image_layout_map.end()) {
             layout_map = alias_iter->second;
         } else {
-            layout_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
+            layout_map = command_pool->AcquireLayoutMap(image_state);
             // Save the local layout map for the next aliased image.
             // The global layout map pointer is only used as a key into the local lookup
             // table so it doesn't need to be locked.
             aliased_image_layout_map.emplace(global_layout_map, layout_map);
         }
 
+    } else if (auto reuse_iter = reusable_layout_maps_.find(image_state.VkHandle());
+               reuse_iter != reusable_layout_maps_.end() && reuse_iter->second.id == image_state.GetId()) {
+        layout_map = std::move(reuse_iter->second.map);
+        reusable_layout_maps_.erase(reuse_iter);
     } else {
-        layout_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
+        layout_map = command_pool->AcquireLayoutMap(image_state);
     }
     if (iter != image_layout_map.end()) {
         // overwrite the stale entry
@@ -455,12 +568,13 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
 }
 
 static bool SetQueryState(const QueryObject &object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
+    localQueryToStateMap->SetQueryState(object, value);
     return false;
 }
 
 void CommandBuffer::BeginQuery(const QueryObject &query_obj) {
     activeQueries.insert(query_obj);
+    render_state_generation++;
     startedQueries.insert(query_obj);
     queryUpdates.emplace_back([query_obj](CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                           uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
@@ -475,6 +589,7 @@ void CommandBuffer::BeginQuery(const QueryObject &query_obj) {
 
 void CommandBuffer::EndQuery(const QueryObject &query_obj) {
     activeQueries.erase(query_obj);
+    render_state_generation++;
     queryUpdates.emplace_back([query_obj](CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                           uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
         return SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
@@ -499,14 +614,12 @@ bool CommandBuffer::UpdatesQuery(const QueryObject &query_obj) const {
 
 static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perfPass, QueryState value,
                                QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject query_obj = {queryPool, firstQuery + i, perfPass};
-        (*localQueryToStateMap)[query_obj] = value;
-    }
+    localQueryToStateMap->SetQueryStates(queryPool, firstQuery, queryCount, perfPass, value);
     return false;
 }
 
 void CommandBuffer::EndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    render_state_generation++;
     for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
         QueryObject query_obj = {queryPool, slot};
         activeQueries.erase(query_obj);
@@ -608,6 +721,7 @@ void CommandBuffer::BeginRenderPass(Func command, const VkRenderPassBeginInfo *p
     active_render_pass_begin_info = vku::safe_VkRenderPassBeginInfo(pRenderPassBegin);
     SetActiveSubpass(0);
     activeSubpassContents = contents;
+    UpdateCommandScope();
     renderPassQueries.clear();
 
     // Connect this RP to cmdBuffer
@@ -651,6 +765,7 @@ void CommandBuffer::NextSubpass(Func command, VkSubpassContents contents) {
     RecordCmd(command);
     SetActiveSubpass(GetActiveSubpass() + 1);
     activeSubpassContents = contents;
+    UpdateCommandScope();
 
     if (activeFramebuffer) {
         active_subpasses.clear();
@@ -670,6 +785,7 @@ void CommandBuffer::NextSubpass(Func command, VkSubpassContents contents) {
 void CommandBuffer::EndRenderPass(Func command) {
     RecordCmd(command);
     activeRenderPass = nullptr;
+    UpdateCommandScope();
     attachment_source = AttachmentSource::Empty;
     active_attachments.clear();
     active_subpasses.clear();
@@ -681,6 +797,7 @@ void CommandBuffer::EndRenderPass(Func command) {
 void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderingInfo) {
     RecordCmd(command);
     activeRenderPass = std::make_shared<vvl::RenderPass>(pRenderingInfo, true);
+    render_state_generation++;
     renderPassQueries.clear();
 
     rendering_attachments.Reset();
@@ -703,6 +820,7 @@ void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderi
     activeSubpassContents = ((pRenderingInfo->flags & VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR)
                                  ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
                                  : VK_SUBPASS_CONTENTS_INLINE);
+    UpdateCommandScope();
 
     // Handle flags for dynamic rendering
     if (!hasRenderPassInstance && pRenderingInfo->flags & VK_RENDERING_RESUMING_BIT) {
@@ -768,6 +886,8 @@ void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderi
 void CommandBuffer::EndRendering(Func command) {
     RecordCmd(command);
     activeRenderPass = nullptr;
+    UpdateCommandScope();
+    render_state_generation++;
     active_color_attachments_index.clear();
 }
 
@@ -775,6 +895,7 @@ void CommandBuffer::BeginVideoCoding(const VkVideoBeginCodingInfoKHR *pBeginInfo
     RecordCmd(Func::vkCmdBeginVideoCodingKHR);
     bound_video_session = dev_data.Get<vvl::VideoSession>(pBeginInfo->videoSession);
     bound_video_session_parameters = dev_data.Get<vvl::VideoSessionParameters>(pBeginInfo->videoSessionParameters);
+    UpdateCommandScope();
 
     if (bound_video_session) {
         // Connect this video session to cmdBuffer
@@ -836,6 +957,7 @@ void CommandBuffer::BeginVideoCoding(const VkVideoBeginCodingInfoKHR *pBeginInfo
 void CommandBuffer::EndVideoCoding(const VkVideoEndCodingInfoKHR *pEndCodingInfo) {
     RecordCmd(Func::vkCmdEndVideoCodingKHR);
     bound_video_session = nullptr;
+    UpdateCommandScope();
     bound_video_session_parameters = nullptr;
     bound_video_picture_resources.clear();
     video_encode_quality_level.reset();
@@ -896,10 +1018,8 @@ void CommandBuffer::ControlVideoCoding(const VkVideoCodingControlInfoKHR *pContr
 void vvl::CommandBuffer::EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info) {
     queryUpdates.emplace_back([query_info](vvl::CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                            uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        for (uint32_t i = 0; i < query_info.queryCount; i++) {
-            SetQueryState(QueryObject(query_info.queryPool, query_info.firstQuery + i), QUERYSTATE_ENDED, localQueryToStateMap);
-        }
-        return false;
+        return SetQueryStateMulti(query_info.queryPool, query_info.firstQuery, query_info.queryCount, 0, QUERYSTATE_ENDED,
+                                  localQueryToStateMap);
     });
     for (uint32_t i = 0; i < query_info.queryCount; i++) {
         updatedQueries.insert(QueryObject(query_info.queryPool, query_info.firstQuery + i));
@@ -993,6 +1113,7 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
 
     // Set updated state here in case implicit reset occurs above
     state = CbState::Recording;
+    UpdateCommandScope();
     ASSERT_AND_RETURN(pBeginInfo);
     beginInfo = *pBeginInfo;
     if (beginInfo.pInheritanceInfo && IsSeconary()) {
@@ -1048,16 +1169,43 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
     }
     performance_lock_acquired = dev_data.performance_lock_acquired;
     updatedQueries.clear();
+    // For the render pass inherited by a secondary
+    UpdateCommandScope();
 }
 
 void CommandBuffer::End(VkResult result) {
     if (VK_SUCCESS == result) {
         state = CbState::Recorded;
+        UpdateCommandScope();
+    }
+}
+
+CommandScopeFlags CommandBuffer::ComputeCommandScope() const {
+    CommandScopeFlags scope = 0;
+    if (state == CbState::Recording) {
+        scope |= kCommandScopeRecording;
+    }
+    if (activeRenderPass || (IsSeconary() && (beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT))) {
+        scope |= kCommandScopeInsideRenderPass;
+    }
+    if (!activeRenderPass) {
+        scope |= kCommandScopeOutsideRenderPass;
+    }
+    scope |= bound_video_session ? kCommandScopeInsideVideoCoding : kCommandScopeOutsideVideoCoding;
+    if (IsPrimary()) {
+        scope |= kCommandScopePrimary;
     }
+    if (!IsPrimary() || !activeRenderPass || activeRenderPass->UsesDynamicRendering() ||
+        activeSubpassContents != VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS) {
+        scope |= kCommandScopeInlineContents;
+    }
+    return scope;
 }
 
 void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) {
     RecordCmd(Func::vkCmdExecuteCommands);
+    // Bound state is undefined after executing secondary command buffers
+    render_state_generation++;
     for (const VkCommandBuffer sub_command_buffer : secondary_command_buffers) {
         auto sub_cb_state = dev_data.GetWrite<CommandBuffer>(sub_command_buffer);
         ASSERT_AND_RETURN(sub_cb_state);
@@ -1167,6 +1315,16 @@ void CommandBuffer::PushDescriptorSetState(VkPipelineBindPoint pipelineBindPoint
     push_descriptor_set->PerformPushDescriptorsUpdate(descriptorWriteCount, pDescriptorWrites);
 }
 
+const vvl::DescriptorSet &CommandBuffer::GetPushDescriptorValidationSet(
+    const std::shared_ptr<const vvl::DescriptorSetLayout> &dsl) const {
+    auto &validation_set = push_descriptor_validation_sets_[dsl.get()];
+    if (!validation_set) {
+        // Not created through CreateDescriptorSet, the subclasses of the validation objects are never needed here
+        validation_set = std::make_shared<vvl::DescriptorSet>(VK_NULL_HANDLE, nullptr, dsl, 0, &dev_data);
+    }
+    return *validation_set;
+}
+
 // Generic function to handle state update for all CmdDraw* type functions
 void CommandBuffer::UpdateDrawCmd(Func command) {
     has_draw_cmd = true;
@@ -1188,9 +1346,13 @@ void CommandBuffer::UpdateTraceRayCmd(Func command) {
 // Generic function to handle state update for all Provoking functions calls (draw/dispatch/traceray/etc)
 void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point) {
     RecordCmd(command);
+    action_command_count++;
 
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &last_bound = lastBound[lv_bind_point];
+    // Snapshot what this action command was validated against, see CoreChecks::ValidateActionState
+    last_bound.UpdateValidatedGenerations(command);
+
     vvl::Pipeline *pipe = last_bound.pipeline_state;
     if (!pipe) {
         return;
@@ -1278,6 +1440,7 @@ void CommandBuffer::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipeline_b
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
     auto &last_bound = lastBound[lv_bind_point];
     last_bound.desc_set_pipeline_layout = pipeline_layout.VkHandle();
+    last_bound.descriptor_generation++;
     auto &pipe_compat_ids = pipeline_layout.set_compat_ids;
     // Resize binding arrays
     if (last_binding_index >= last_bound.per_set.size()) {
@@ -1305,13 +1468,18 @@ void CommandBuffer::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipeline_b
         last_bound.per_set.resize(required_size);
     }
 
-    // For any previously bound sets, need to set them to "invalid" if they were disturbed by this update
-    for (uint32_t set_idx = 0; set_idx < first_set; ++set_idx) {
-        auto &set_info = last_bound.per_set[set_idx];
-        if (set_info.compat_id_for_set != pipe_compat_ids[set_idx]) {
-            PushDescriptorCleanup(last_bound, set_idx);
-            set_info.Reset();
-            set_info.compat_id_for_set = pipe_compat_ids[set_idx];
+    // For any previously bound sets, need to set them to "invalid" if they were disturbed by this update.
+    // The compat ID of set N covers the layouts of sets [0, N] and the push constant ranges, and the bound sets always hold the
+    // IDs of one layout for [0, N], so if set first_set - 1 is still compatible all of those below it are too. This is the
+    // common case of rebinding the upper sets with the same, or a compatible, pipeline layout.
+    if (first_set > 0 && last_bound.per_set[first_set - 1].compat_id_for_set != pipe_compat_ids[first_set - 1]) {
+        for (uint32_t set_idx = 0; set_idx < first_set; ++set_idx) {
+            auto &set_info = last_bound.per_set[set_idx];
+            if (set_info.compat_id_for_set != pipe_compat_ids[set_idx]) {
+                PushDescriptorCleanup(last_bound, set_idx);
+                set_info.Reset();
+                set_info.compat_id_for_set = pipe_compat_ids[set_idx];
+            }
         }
     }
 
@@ -1359,6 +1527,7 @@ void CommandBuffer::UpdateLastBoundDescriptorBuffers(VkPipelineBindPoint pipelin
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
     auto &last_bound = lastBound[lv_bind_point];
     last_bound.desc_set_pipeline_layout = pipeline_layout.VkHandle();
+    last_bound.descriptor_generation++;
     auto &pipe_compat_ids = pipeline_layout.set_compat_ids;
     // Resize binding arrays
     if (last_binding_index >= last_bound.per_set.size()) {
@@ -1390,6 +1559,7 @@ void CommandBuffer::UpdateLastBoundDescriptorBuffers(VkPipelineBindPoint pipelin
     for (uint32_t set_idx = 0; set_idx < first_set; ++set_idx) {
         PushDescriptorCleanup(last_bound, set_idx);
         last_bound.per_set[set_idx].Reset();
+        last_bound.per_set[set_idx].compat_id_for_set = pipe_compat_ids[set_idx];
     }
 
     // Now update the bound sets with the input sets
@@ -1483,6 +1653,7 @@ void CommandBuffer::RecordStateCmd(Func command, CBDynamicState state) {
 }
 
 void CommandBuffer::RecordDynamicState(CBDynamicState state) {
+    dynamic_state_generation++;
     dynamic_state_status.cb.set(state);
     dynamic_state_status.pipeline.set(state);
     dynamic_state_status.history.set(state);
@@ -1610,11 +1781,12 @@ void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Locat
         for (auto &function : queryUpdates) {
             function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
         }
-        for (const auto &query_state_pair : local_query_to_state_map) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, query_state_pair.second);
-        }
+        local_query_to_state_map.ForEachRange(
+            [this](VkQueryPool pool, uint32_t perf_pass, const QueryMap::QueryRangeMap::key_type &queries, QueryState state) {
+                auto query_pool_state = dev_data.Get<vvl::QueryPool>(pool);
+                if (!query_pool_state) return;
+                query_pool_state->SetQueryStates(queries.begin, queries.distance(), perf_pass, state);
+            });
     }
 
     // Update vvl::Event with src_stage from the last recorded SetEvent.
@@ -1656,13 +1828,22 @@ void CommandBuffer::Retire(uint32_t perf_submit_pass, const std::function<bool(c
         function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
     }
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, QUERYSTATE_AVAILABLE);
-        }
-    }
+    local_query_to_state_map.ForEachRange(
+        [this, &is_query_updated_after](VkQueryPool pool, uint32_t perf_pass, const QueryMap::QueryRangeMap::key_type &queries,
+                                        QueryState state) {
+            if (state != QUERYSTATE_ENDED) return;
+            auto query_pool_state = dev_data.Get<vvl::QueryPool>(pool);
+            if (!query_pool_state) return;
+            // Make the runs of queries not updated by a later submission available
+            uint32_t available_begin = queries.begin;
+            for (uint32_t slot = queries.begin; slot < queries.end; ++slot) {
+                if (is_query_updated_after(QueryObject(pool, slot, 0, perf_pass))) {
+                    query_pool_state->SetQueryStates(available_begin, slot - available_begin, perf_pass, QUERYSTATE_AVAILABLE);
+                    available_begin = slot + 1;
+                }
+            }
+            query_pool_state->SetQueryStates(available_begin, queries.end - available_begin, perf_pass, QUERYSTATE_AVAILABLE);
+        });
 }
 
 uint32_t CommandBuffer::GetDynamicColorAttachmentCount() const {
@@ -1713,12 +1894,14 @@ void CommandBuffer::BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderOb
     const auto stage_index = static_cast<uint32_t>(ConvertToShaderObjectStage(shader_stage));
     lastBoundState.shader_object_bound[stage_index] = true;
     lastBoundState.shader_object_states[stage_index] = shader_object_state;
+    lastBoundState.pipeline_generation++;
 }
 
 void CommandBuffer::UnbindResources() {
     // Vertex and index buffers
     index_buffer_binding.reset();
     current_vertex_buffer_binding_info.clear();
+    vertex_buffer_generation++;
 
     // Push constants
     push_constant_data_chunks.clear();
@@ -1730,6 +1913,7 @@ void CommandBuffer::UnbindResources() {
     dynamic_state_status.pipeline.reset();
     dynamic_state_status.rtx_stack_size_cb = false;
     dynamic_state_status.rtx_stack_size_pipeline = false;
+    dynamic_state_generation++;
 
     // Pipeline and descriptor sets
     lastBound[BindPoint_Graphics].Reset();
@@ -1802,21 +1986,66 @@ void CommandBuffer::GetCurrentPipelineAndDesriptorSets(VkPipelineBindPoint pipel
     *rtn_sets = &(last_bound.per_set);
 }
 
+namespace {
+class LabelNameTable {
+  public:
+    LabelNameTable() { Intern(""); }
+
+    CommandBuffer::LabelId Intern(const char *label_name) {
+        const std::string_view name(label_name);
+        {
+            ReadLockGuard guard(lock_);
+            if (auto it = ids_.find(name); it != ids_.end()) {
+                return it->second;
+            }
+        }
+        WriteLockGuard guard(lock_);
+        if (auto it = ids_.find(name); it != ids_.end()) {
+            return it->second;
+        }
+        const auto label_id = static_cast<CommandBuffer::LabelId>(names_.size());
+        // The names are never removed and deque growth doesn't move them, so the map can key on views of them
+        names_.emplace_back(name);
+        ids_.emplace(names_.back(), label_id);
+        return label_id;
+    }
+
+    std::string Name(CommandBuffer::LabelId label_id) const {
+        ReadLockGuard guard(lock_);
+        assert(label_id < names_.size());
+        return names_[label_id];
+    }
+
+  private:
+    mutable std::shared_mutex lock_;
+    std::deque<std::string> names_;
+    vvl::unordered_map<std::string_view, CommandBuffer::LabelId> ids_;
+};
+
+LabelNameTable &GetLabelNameTable() {
+    static LabelNameTable table;
+    return table;
+}
+}  // namespace
+
+CommandBuffer::LabelId CommandBuffer::InternLabelName(const char *label_name) { return GetLabelNameTable().Intern(label_name); }
+
+std::string CommandBuffer::GetLabelName(LabelId label_id) { return GetLabelNameTable().Name(label_id); }
+
 void CommandBuffer::BeginLabel(const char *label_name) {
     ++label_stack_depth_;
-    label_commands_.push_back(LabelCommand{true, label_name});
+    label_commands_.push_back(LabelCommand{true, InternLabelName(label_name)});
 }
 
 void CommandBuffer::EndLabel() {
     --label_stack_depth_;
-    label_commands_.push_back(LabelCommand{false, std::string()});
+    label_commands_.push_back(LabelCommand{false, kEmptyLabelId});
 }
 
-void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands,
-                                        std::vector<std::string> &label_stack) {
+void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<LabelId> &label_stack) {
     for (const LabelCommand &command : label_commands) {
         if (command.begin) {
-            label_stack.push_back(command.label_name.empty() ? "(empty label)" : command.label_name);
+            label_stack.push_back(command.label_id);
         } else if (!label_stack.empty()) {
             // The above condition is needed for several reasons. On the primary command buffer level
             // the labels are not necessary balanced. And if the empty stack is detected in the context
@@ -1828,7 +2057,7 @@ void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &lab
 }
 
 std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                              const std::vector<std::string> &initial_label_stack) {
+                                              const std::vector<LabelId> &initial_label_stack) {
     assert(label_command_index < label_commands.size());
 
     auto commands_to_replay = vvl::make_span(label_commands.data(), label_command_index + 1);
@@ -1836,11 +2065,11 @@ std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &l
     vvl::CommandBuffer::ReplayLabelCommands(commands_to_replay, label_stack);
 
     std::string debug_region;
-    for (const std::string &label_name : label_stack) {
+    for (const LabelId label_id : label_stack) {
         if (!debug_region.empty()) {
             debug_region += "::";
         }
-        debug_region += label_name;
+        debug_region += label_id == kEmptyLabelId ? "(empty label)" : GetLabelName(label_id);
     }
     return debug_region;
 }
@@ -27,6 +27,10 @@
 #include "containers/qfo_transfer.h"
 #include "containers/custom_containers.h"
 #include "generated/dynamic_state_helper.h"
+#include "external/inplace_function.h"
+#include "utils/arena_allocator.h"
+
+#include <deque>
 
 class CoreChecks;
 class ValidationStateTracker;
@@ -58,6 +62,19 @@ enum class CbState {
     InvalidIncomplete,  // fouled before recording was completed
 };
 
+// What the state of a command buffer allows the next recorded command to require, kept by vvl::CommandBuffer so the common
+// case of CoreChecks::ValidateCmd() is a single mask test against the generated requirements of the command
+enum CommandScopeBits : uint32_t {
+    kCommandScopeRecording = 1u << 0,
+    kCommandScopeInsideRenderPass = 1u << 1,   // primary in a render pass, or secondary in one or continuing one
+    kCommandScopeOutsideRenderPass = 1u << 2,  // no active render pass
+    kCommandScopeInsideVideoCoding = 1u << 3,
+    kCommandScopeOutsideVideoCoding = 1u << 4,
+    kCommandScopePrimary = 1u << 5,
+    kCommandScopeInlineContents = 1u << 6,  // not in a subpass of a primary recorded with secondary command buffers
+};
+using CommandScopeFlags = uint32_t;
+
 enum class AttachmentSource {
     Empty = 0,
     RenderPass,
@@ -148,6 +165,16 @@ class CommandPool : public StateObject {
     void Reset();
 
     void Destroy() override;
+
+    // Layout maps given back by the command buffers of this pool, reset in place for whatever image is recorded next
+    std::shared_ptr<ImageSubresourceLayoutMap> AcquireLayoutMap(const vvl::Image &image_state) const;
+    void ReleaseLayoutMap(std::shared_ptr<ImageSubresourceLayoutMap> &&layout_map) const;
+
+  private:
+    // Bounds what a pool keeps after a recording that touched a lot of images
+    static constexpr size_t kMaxFreeLayoutMaps = 1024;
+    mutable std::mutex free_layout_maps_lock_;
+    mutable std::vector<std::shared_ptr<ImageSubresourceLayoutMap>> free_layout_maps_;
 };
 
 class CommandBuffer : public RefcountedStateObject {
@@ -179,10 +206,15 @@ class CommandBuffer : public RefcountedStateObject {
     bool has_build_as_cmd;
 
     CbState state;           // Track cmd buffer update state
-    uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
+    uint64_t command_count;  // Number of commands recorded. Used with VK_KHR_performance_query and to sample checks
+    uint64_t action_command_count;  // Number of draw, dispatch and trace rays commands recorded, to sample draw time checks
     uint64_t submitCount;    // Number of times CB has been submitted
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
+    // Sequence numbers for the command buffer wide state read by draw time validation (see LastBound::IsDrawStateValidated)
+    uint64_t dynamic_state_generation = 1;  // vkCmdSet* dynamic state
+    uint64_t vertex_buffer_generation = 1;  // vertex and index buffer bindings
+    uint64_t render_state_generation = 1;   // render pass instance, subpass, active queries, transform feedback, etc
 
     // Track status of all vkCmdSet* calls, if 1, means it was set
     struct DynamicStateStatus {
@@ -286,6 +318,7 @@ class CommandBuffer : public RefcountedStateObject {
         // VK_DYNAMIC_STATE_VERTEX_INPUT_EXT
         std::vector<uint32_t> vertex_binding_descriptions_divisor;
         std::vector<VkVertexInputAttributeDescription2EXT> vertex_attribute_descriptions;
+        std::vector<VertexInputState::AttributeRequirements> vertex_attribute_requirements;
 
         // VK_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT
         VkConservativeRasterizationModeEXT conservative_rasterization_mode;
@@ -354,6 +387,7 @@ class CommandBuffer : public RefcountedStateObject {
             if (mask[CB_DYNAMIC_STATE_VERTEX_INPUT_EXT]) {
                 vertex_binding_descriptions_divisor.clear();
                 vertex_attribute_descriptions.clear();
+                vertex_attribute_requirements.clear();
             }
             if (mask[CB_DYNAMIC_STATE_VIEWPORT_W_SCALING_NV]) {
                 viewport_w_scalings.clear();
@@ -442,7 +476,8 @@ class CommandBuffer : public RefcountedStateObject {
     std::shared_ptr<vvl::Framebuffer> activeFramebuffer;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    vvl::unordered_set<std::shared_ptr<StateObject>> object_bindings;
+    // Each bound object has this command buffer linked as a parent through the mapped ParentLink
+    vvl::unordered_map<std::shared_ptr<StateObject>, StateObject::ParentLink *> object_bindings;
     vvl::unordered_map<VulkanTypedHandle, LogObjectList> broken_bindings;
 
     QFOTransferBarrierSets<QFOBufferTransferBarrier> qfo_transfer_buffer_barriers;
@@ -493,13 +528,20 @@ class CommandBuffer : public RefcountedStateObject {
     std::vector<std::function<bool(const CommandBuffer &secondary, const CommandBuffer *primary, const vvl::Framebuffer *)>>
         cmd_execute_commands_functions;
 
-    using EventCallback = std::function<bool(CommandBuffer &cb_state, bool do_validate, EventMap &local_event_signal_info,
-                                             VkQueue waiting_queue, const Location &loc)>;
+    // Event and query updates are recorded for every event/query command and only capture a few handles and indices, so
+    // they are stored inline instead of each heap allocating its std::function storage.
+    static constexpr size_t kInlineCallbackCapacity = 128;
+    using EventCallback =
+        stdext::inplace_function<bool(CommandBuffer &cb_state, bool do_validate, EventMap &local_event_signal_info,
+                                      VkQueue waiting_queue, const Location &loc),
+                                 kInlineCallbackCapacity>;
     std::vector<EventCallback> eventUpdates;
 
-    std::vector<std::function<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                   uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
-        queryUpdates;
+    using QueryCallback =
+        stdext::inplace_function<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
+                                      uint32_t perfQueryPass, QueryMap *localQueryToStateMap),
+                                 kInlineCallbackCapacity>;
+    std::vector<QueryCallback> queryUpdates;
     bool performance_lock_acquired = false;
     bool performance_lock_released = false;
 
@@ -534,9 +576,9 @@ class CommandBuffer : public RefcountedStateObject {
     uint32_t conditional_rendering_subpass{0};
     std::vector<VkDescriptorBufferBindingInfoEXT> descriptor_buffer_binding_info;
 
-    mutable std::shared_mutex lock;
-    ReadLockGuard ReadLock() const { return ReadLockGuard(lock); }
-    WriteLockGuard WriteLock() { return WriteLockGuard(lock); }
+    mutable vvl::RecordingMutex lock;
+    RecordingReadLockGuard ReadLock() const { return RecordingReadLockGuard(lock); }
+    RecordingWriteLockGuard WriteLock() { return RecordingWriteLockGuard(lock); }
 
     CommandBuffer(ValidationStateTracker &dev, VkCommandBuffer handle, const VkCommandBufferAllocateInfo *pAllocateInfo,
                   const vvl::CommandPool *cmd_pool);
@@ -544,6 +586,7 @@ class CommandBuffer : public RefcountedStateObject {
     virtual ~CommandBuffer() { Destroy(); }
 
     void Destroy() override;
+    void AddMemoryUsage(MemoryUsage &usage) const override;
 
     VkCommandBuffer VkHandle() const { return handle_.Cast<VkCommandBuffer>(); }
 
@@ -637,6 +680,9 @@ class CommandBuffer : public RefcountedStateObject {
 
     void PushDescriptorSetState(VkPipelineBindPoint pipelineBindPoint, const vvl::PipelineLayout &pipeline_layout, uint32_t set,
                                 uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites);
+    // Empty descriptor set of a push descriptor layout, that push descriptor writes are validated against. The validation
+    // only depends on the layout, so the set is kept until the command buffer is reset instead of creating one per push.
+    const vvl::DescriptorSet &GetPushDescriptorValidationSet(const std::shared_ptr<const vvl::DescriptorSetLayout> &dsl) const;
 
     void UpdateDrawCmd(Func command);
     void UpdateDispatchCmd(Func command);
@@ -685,30 +731,75 @@ class CommandBuffer : public RefcountedStateObject {
 
     inline void BindPipeline(LvlBindPoint bind_point, vvl::Pipeline *pipe_state) {
         lastBound[bind_point].pipeline_state = pipe_state;
+        lastBound[bind_point].pipeline_generation++;
     }
     void BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderObject *shader_object_state);
 
     bool IsPrimary() const { return allocate_info.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY; }
+    CommandScopeFlags GetCommandScope() const { return command_scope_; }
+    // What command_scope_ is updated to on the state, render pass and video coding transitions
+    CommandScopeFlags ComputeCommandScope() const;
     bool IsSeconary() const { return allocate_info.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY; }
     void BeginLabel(const char *label_name);
     void EndLabel();
     int LabelStackDepth() const { return label_stack_depth_; }
 
+    // Label names are interned: label commands and label stacks hold the id of the name, which is only turned back into
+    // a string when an error message needs it. The table is shared by all devices and keeps every name used by the
+    // application, a label name is usually one of a small set of string literals.
+    using LabelId = uint32_t;
+    static constexpr LabelId kEmptyLabelId = 0;  // id of the empty name
+    static LabelId InternLabelName(const char *label_name);
+    static std::string GetLabelName(LabelId label_id);
+
     struct LabelCommand {
-        bool begin = false;      // vkCmdBeginDebugUtilsLabelEXT or vkCmdEndDebugUtilsLabelEXT
-        std::string label_name;  // used when begin == true
+        bool begin = false;                // vkCmdBeginDebugUtilsLabelEXT or vkCmdEndDebugUtilsLabelEXT
+        LabelId label_id = kEmptyLabelId;  // used when begin == true
     };
     const std::vector<LabelCommand> &GetLabelCommands() const { return label_commands_; }
 
     // Applies label commands to the label_stack: for "begin label" command it pushes
     // a label on the stack, and for the "end label" command it removes the top label.
-    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<std::string> &label_stack);
+    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<LabelId> &label_stack);
     // Computes debug region by replaying given commands on top initial label stack.
     static std::string GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                          const std::vector<std::string> &initial_label_stack = {});
+                                          const std::vector<LabelId> &initial_label_stack = {});
+
+  protected:
+    // Clear-but-keep-storage for the containers rebuilt by every recording, so re-recording the same command buffer doesn't
+    // allocate. The storage is trimmed back to what the reset recording used when it is far above it, so a one-off large
+    // recording doesn't keep its memory forever.
+    template <typename T, typename Allocator>
+    static void ClearRetainingCapacity(std::vector<T, Allocator> &container) {
+        constexpr size_t kMinCapacityToTrim = 64;
+        constexpr size_t kTrimFactor = 4;
+        const size_t used = container.size();
+        container.clear();
+        if (container.capacity() > kMinCapacityToTrim && container.capacity() > used * kTrimFactor) {
+            std::vector<T, Allocator>().swap(container);
+            container.reserve(used);
+        }
+    }
 
   private:
     void ResetCBState();
+    void ReleaseReusableLayoutMaps();
+    void UpdateCommandScope() { command_scope_ = ComputeCommandScope(); }
+    StateObject::ParentLink *AllocateParentLink();
+    void UnlinkChild(StateObject &child_node, StateObject::ParentLink *link);
+
+    // Backing storage of the object_bindings links, kept across resets so re-recording doesn't allocate
+    std::deque<StateObject::ParentLink, vvl::ArenaAllocator<StateObject::ParentLink, vvl::Arena::StateTracker>>
+        parent_link_storage_;
+    std::vector<StateObject::ParentLink *, vvl::ArenaAllocator<StateObject::ParentLink *, vvl::Arena::StateTracker>>
+        free_parent_links_;
+    CommandScopeFlags command_scope_ = 0;
+    // Layout maps of the previous recording that nothing else references, reused when the same image is used again.
+    // The ones the next recording doesn't use go back to the command pool.
+    ImageLayoutMap reusable_layout_maps_;
+    // The sets keep their layout alive, so a layout can't be replaced by another one at the same address
+    mutable vvl::unordered_map<const vvl::DescriptorSetLayout *, std::shared_ptr<vvl::DescriptorSet>>
+        push_descriptor_validation_sets_;
 
     // Keep track of how many CmdBeginDebugUtilsLabelEXT calls have been made without a matching CmdEndDebugUtilsLabelEXT.
     // Negative value for a secondary command buffer indicates invalid state.
@@ -23,6 +23,7 @@
 #include "state_tracker/ray_tracing_state.h"
 #include "state_tracker/sampler_state.h"
 #include "state_tracker/shader_module.h"
+#include "chassis/memory_report.h"
 
 static vvl::DescriptorPool::TypeCountMap GetMaxTypeCounts(const VkDescriptorPoolCreateInfo *create_info) {
     vvl::DescriptorPool::TypeCountMap counts;
@@ -45,8 +46,28 @@ vvl::DescriptorPool::DescriptorPool(ValidationStateTracker &dev, const VkDescrip
       maxDescriptorTypeCount(GetMaxTypeCounts(pCreateInfo)),
       available_sets_(pCreateInfo->maxSets),
       available_counts_(maxDescriptorTypeCount),
+      storage_cache_(std::make_shared<DescriptorSetStorageCache>()),
       dev_data_(dev) {}
 
+std::unique_ptr<uint8_t[]> vvl::DescriptorSetStorageCache::Acquire(size_t size) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto iter = free_storage_.find(size);
+        if (iter != free_storage_.end() && !iter->second.empty()) {
+            auto storage = std::move(iter->second.back());
+            iter->second.pop_back();
+            return storage;
+        }
+    }
+    // Bindings are placement constructed into the storage, so there is no need to clear it
+    return std::unique_ptr<uint8_t[]>(new uint8_t[size]);
+}
+
+void vvl::DescriptorSetStorageCache::Release(std::unique_ptr<uint8_t[]> &&storage, size_t size) {
+    std::lock_guard<std::mutex> guard(lock_);
+    free_storage_[size].emplace_back(std::move(storage));
+}
+
 void vvl::DescriptorPool::Allocate(const VkDescriptorSetAllocateInfo *alloc_info, const VkDescriptorSet *descriptor_sets,
                                    const vvl::AllocateDescriptorSetsData &ds_data) {
     auto guard = WriteLock();
@@ -193,7 +214,7 @@ bool operator==(const DescriptorSetLayoutDef &lhs, const DescriptorSetLayoutDef
     if (lhs.GetMutableTypes() != rhs.GetMutableTypes()) {
         return false;
     }
-    // vectors of vku::safe_VkDescriptorSetLayoutBinding structures
+    // vectors of VkDescriptorSetLayoutBinding structures
     const auto &lhs_bindings = lhs.GetBindings();
     const auto &rhs_bindings = rhs.GetBindings();
     if (lhs_bindings.size() != rhs_bindings.size()) {
@@ -308,6 +329,20 @@ vvl::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescriptorSetLayoutC
         }
     }
 
+    // Only the sampler types keep their immutable samplers, like a deep copy of the bindings would
+    const auto uses_immutable_samplers = [](const VkDescriptorSetLayoutBinding &binding) {
+        return binding.pImmutableSamplers && (binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+                                              binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+    };
+    size_t immutable_sampler_count = 0;
+    for (const auto &input_binding : sorted_bindings) {
+        if (uses_immutable_samplers(*input_binding.layout_binding)) {
+            immutable_sampler_count += input_binding.layout_binding->descriptorCount;
+        }
+    }
+    // Sized once, the bindings point into it
+    immutable_samplers_.reserve(immutable_sampler_count);
+
     // Store the create info in the sorted order from above
     uint32_t index = 0;
     binding_count_ = static_cast<uint32_t>(sorted_bindings.size());
@@ -318,8 +353,16 @@ vvl::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescriptorSetLayoutC
         // Add to binding and map, s.t. it is robust to invalid duplication of binding_num
         const auto binding_num = input_binding.layout_binding->binding;
         binding_to_index_map_[binding_num] = index++;
-        bindings_.emplace_back(input_binding.layout_binding);
+        bindings_.emplace_back(*input_binding.layout_binding);
         auto &binding_info = bindings_.back();
+        if (uses_immutable_samplers(binding_info) && binding_info.descriptorCount > 0) {
+            const size_t first_sampler = immutable_samplers_.size();
+            immutable_samplers_.insert(immutable_samplers_.end(), binding_info.pImmutableSamplers,
+                                       binding_info.pImmutableSamplers + binding_info.descriptorCount);
+            binding_info.pImmutableSamplers = immutable_samplers_.data() + first_sampler;
+        } else {
+            binding_info.pImmutableSamplers = nullptr;
+        }
         binding_flags_.emplace_back(input_binding.binding_flags);
 
         descriptor_count_ += binding_info.descriptorCount;
@@ -328,6 +371,9 @@ vvl::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescriptorSetLayoutC
         }
 
         if (IsDynamicDescriptor(binding_info.descriptorType)) {
+            const auto binding_index = static_cast<uint32_t>(bindings_.size() - 1);
+            dynamic_bindings_.push_back(
+                {binding_index, binding_num, binding_info.descriptorCount, dynamic_descriptor_count_, binding_info.descriptorType});
             dynamic_descriptor_count_ += binding_info.descriptorCount;
         }
 
@@ -372,7 +418,7 @@ uint32_t vvl::DescriptorSetLayoutDef::GetIndexFromBinding(uint32_t binding) cons
 VkDescriptorSetLayoutBinding const *vvl::DescriptorSetLayoutDef::GetDescriptorSetLayoutBindingPtrFromIndex(
     const uint32_t index) const {
     if (index >= bindings_.size()) return nullptr;
-    return bindings_[index].ptr();
+    return &bindings_[index];
 }
 // Return descriptorCount for given index, 0 if index is unavailable
 uint32_t vvl::DescriptorSetLayoutDef::GetDescriptorCountFromIndex(const uint32_t index) const {
@@ -447,16 +493,23 @@ const std::vector<VkDescriptorType> &vvl::DescriptorSetLayoutDef::GetMutableType
     return mutable_types_[binding];
 }
 
-void vvl::DescriptorSetLayout::SetLayoutSizeInBytes(const VkDeviceSize *layout_size_in_bytes_) {
-    if (layout_size_in_bytes_) {
-        layout_size_in_bytes = std::make_unique<VkDeviceSize>(*layout_size_in_bytes_);
-    } else {
-        layout_size_in_bytes.reset();
+void vvl::DescriptorSetLayout::SetDescriptorBufferLayout(DescriptorBufferLayout &&descriptor_buffer_layout) {
+    descriptor_buffer_layout.required_size = descriptor_buffer_layout.size;
+    if (descriptor_buffer_layout.size > 0) {
+        // There can only be one binding with VARIABLE_DESCRIPTOR_COUNT
+        for (uint32_t i = 0; i < GetBindingCount(); i++) {
+            if (IsVariableDescriptorCountFromIndex(i)) {
+                // If the descriptor set only consists of the VARIABLE_DESCRIPTOR_COUNT binding, its offset may be 0. The
+                // set is then treated as if its size was 1, so that the offset is still validated.
+                descriptor_buffer_layout.required_size =
+                    GetBindingCount() == 1 ? 1 : descriptor_buffer_layout.binding_offsets[i];
+                break;
+            }
+        }
     }
+    descriptor_buffer_layout_ = std::make_unique<const DescriptorBufferLayout>(std::move(descriptor_buffer_layout));
 }
 
-const VkDeviceSize *vvl::DescriptorSetLayout::GetLayoutSizeInBytes() const { return layout_size_in_bytes.get(); }
-
 // If our layout is compatible with rh_ds_layout, return true.
 bool vvl::DescriptorSetLayout::IsCompatible(DescriptorSetLayout const *rh_ds_layout) const {
     return (this == rh_ds_layout) || (GetLayoutDef() == rh_ds_layout->GetLayoutDef());
@@ -477,14 +530,24 @@ vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorP
       some_update_(false),
       pool_state_(pool_state),
       layout_(layout),
+      storage_cache_(pool_state ? pool_state->GetStorageCache() : nullptr),
+      bindings_store_size_(0),
       state_data_(state_data),
       variable_count_(variable_count),
-      change_count_(0) {
+      change_count_(0),
+      invalidate_count_(0) {
     // Foreach binding, create default descriptors of given type
     auto binding_count = layout_->GetBindingCount();
     bindings_.reserve(binding_count);
-    bindings_store_.resize(binding_count);
-    auto free_binding = bindings_store_.data();
+    dynamic_buffer_descriptors_.reserve(layout_->GetDynamicDescriptorCount());
+    // operator new[] alignment covers every binding type
+    static_assert(alignof(BindingBackingStore) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    bindings_store_size_ = sizeof(BindingBackingStore) * binding_count;
+    if (bindings_store_size_ > 0) {
+        bindings_store_ = storage_cache_ ? storage_cache_->Acquire(bindings_store_size_)
+                                         : std::unique_ptr<uint8_t[]>(new uint8_t[bindings_store_size_]);
+    }
+    auto free_binding = reinterpret_cast<BindingBackingStore *>(bindings_store_.get());
     for (uint32_t i = 0; i < binding_count; ++i) {
         auto create_info = layout_->GetDescriptorSetLayoutBindingPtrFromIndex(i);
         ASSERT_AND_CONTINUE(create_info);
@@ -542,7 +605,7 @@ vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorP
                 auto binding = MakeBinding<BufferBinding>(free_binding++, *create_info, descriptor_count, flags);
                 if (IsDynamicDescriptor(type)) {
                     for (uint32_t di = 0; di < descriptor_count; ++di) {
-                        dynamic_offset_idx_to_descriptor_list_.push_back({i, di});
+                        dynamic_buffer_descriptors_.push_back(&binding->descriptors[di]);
                     }
                 }
                 bindings_.push_back(std::move(binding));
@@ -580,6 +643,38 @@ void vvl::DescriptorSet::NotifyInvalidate(const NodeList &invalid_nodes, bool un
     for (auto &binding : bindings_) {
         binding->NotifyInvalidate(invalid_nodes, unlink);
     }
+    // Something referenced by the descriptors changed, anything validated against it needs to be looked at again
+    ++change_count_;
+    ++invalidate_count_;
+}
+
+void vvl::DescriptorValidationCache::MarkUpdated(uint32_t binding, uint32_t binding_descriptor_count, uint32_t first,
+                                                 uint32_t count) {
+    std::lock_guard<std::mutex> guard(lock);
+    ++update_count;
+    for (auto &[key, entry] : entries) {
+        if (key.binding != binding) {
+            continue;
+        }
+        if (entry.all_validated) {
+            entry.all_validated = false;
+            entry.validated_indices.assign(binding_descriptor_count, true);
+        }
+        const uint32_t end = std::min(first + count, static_cast<uint32_t>(entry.validated_indices.size()));
+        for (uint32_t i = first; i < end; ++i) {
+            entry.validated_indices[i] = false;
+        }
+    }
+}
+
+void vvl::DescriptorSet::AddMemoryUsage(MemoryUsage &usage) const {
+    size_t bytes = sizeof(*this) + bindings_store_size_ + MemoryUsage::VectorBytes(bindings_) +
+                   MemoryUsage::VectorBytes(dynamic_buffer_descriptors_) +
+                   MemoryUsage::VectorBytes(push_descriptor_set_writes);
+    for (const auto &binding : bindings_) {
+        bytes += binding->DescriptorBytes();
+    }
+    usage.Add(MemoryCategory::DescriptorSet, bytes);
 }
 
 uint32_t vvl::DescriptorSet::GetDynamicOffsetIndexFromBinding(uint32_t dynamic_binding) const {
@@ -588,13 +683,12 @@ uint32_t vvl::DescriptorSet::GetDynamicOffsetIndexFromBinding(uint32_t dynamic_b
         return vvl::kU32Max;
     }
     assert(IsDynamicDescriptor(bindings_[index]->type));
-    uint32_t dynamic_offset_index = 0;
-    for (uint32_t i = 0; i < index; i++) {
-        if (IsDynamicDescriptor(bindings_[i]->type)) {
-            dynamic_offset_index += bindings_[i]->count;
+    for (const auto &dynamic_binding : layout_->GetDynamicBindings()) {
+        if (dynamic_binding.index == index) {
+            return dynamic_binding.first_dynamic_offset;
         }
     }
-    return dynamic_offset_index;
+    return vvl::kU32Max;
 }
 
 void vvl::DescriptorSet::Destroy() {
@@ -603,6 +697,15 @@ void vvl::DescriptorSet::Destroy() {
     }
     StateObject::Destroy();
 }
+
+vvl::DescriptorSet::~DescriptorSet() {
+    Destroy();
+    // The bindings live in bindings_store_, they must be gone before it can be reused by another set
+    bindings_.clear();
+    if (storage_cache_ && bindings_store_) {
+        storage_cache_->Release(std::move(bindings_store_), bindings_store_size_);
+    }
+}
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void vvl::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     assert(IsPushDescriptor());
@@ -626,12 +729,28 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
     auto &orig_binding = iter.CurrentBinding();
 
     // Verify next consecutive binding matches type, stage flags & immutable sampler use and if AtEnd
+    const DescriptorBinding *updated_binding = nullptr;
+    uint32_t updated_first = 0;
+    uint32_t updated_count = 0;
     for (uint32_t i = 0; i < descriptors_remaining; ++i, ++iter) {
         if (iter.AtEnd() || !orig_binding.IsConsistent(iter.CurrentBinding())) {
             break;
         }
         iter->WriteUpdate(*this, *state_data_, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
+
+        if (&iter.CurrentBinding() != updated_binding) {
+            if (updated_binding) {
+                validation_cache_.MarkUpdated(updated_binding->binding, updated_binding->count, updated_first, updated_count);
+            }
+            updated_binding = &iter.CurrentBinding();
+            updated_first = iter.CurrentIndex();
+            updated_count = 0;
+        }
+        ++updated_count;
+    }
+    if (updated_binding) {
+        validation_cache_.MarkUpdated(updated_binding->binding, updated_binding->count, updated_first, updated_count);
     }
     if (update.descriptorCount) {
         some_update_ = true;
@@ -648,9 +767,21 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
     auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
     auto dst_iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
     // Update parameters all look good so perform update
+    const DescriptorBinding *updated_binding = nullptr;
+    uint32_t updated_first = 0;
+    uint32_t updated_count = 0;
     for (uint32_t i = 0; i < update.descriptorCount; ++i, ++src_iter, ++dst_iter) {
         auto &src = *src_iter;
         auto &dst = *dst_iter;
+        if (&dst_iter.CurrentBinding() != updated_binding) {
+            if (updated_binding) {
+                validation_cache_.MarkUpdated(updated_binding->binding, updated_binding->count, updated_first, updated_count);
+            }
+            updated_binding = &dst_iter.CurrentBinding();
+            updated_first = dst_iter.CurrentIndex();
+            updated_count = 0;
+        }
+        ++updated_count;
         if (src_iter.updated()) {
             auto type = src_iter.CurrentBinding().type;
             if (type == VK_DESCRIPTOR_TYPE_MUTABLE_EXT) {
@@ -665,6 +796,9 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
             dst_iter.updated(false);
         }
     }
+    if (updated_binding) {
+        validation_cache_.MarkUpdated(updated_binding->binding, updated_binding->count, updated_first, updated_count);
+    }
 
     if (!(layout_->GetDescriptorBindingFlagsFromBinding(update.dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
@@ -25,6 +25,7 @@
 #include "generated/vk_object_types.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -36,6 +37,8 @@ struct DeviceExtensions;
 namespace vvl {
 class Sampler;
 class DescriptorSet;
+class DescriptorSetLayout;
+class DescriptorSetLayoutDef;
 class CommandBuffer;
 class ImageView;
 class Buffer;
@@ -45,6 +48,20 @@ class AccelerationStructureNV;
 class AccelerationStructureKHR;
 struct AllocateDescriptorSetsData;
 
+// Recycles the binding storage of the sets allocated from a pool.
+// Applications that reset a pool every frame allocate the same layouts again, so the storage of a freed set is handed to the
+// next set needing the same size instead of going back to the heap. The cache is shared with the sets, so a set that outlives
+// its pool (still referenced by a command buffer, for instance) can safely give its storage back.
+class DescriptorSetStorageCache {
+  public:
+    std::unique_ptr<uint8_t[]> Acquire(size_t size);
+    void Release(std::unique_ptr<uint8_t[]> &&storage, size_t size);
+
+  private:
+    std::mutex lock_;
+    vvl::unordered_map<size_t, std::vector<std::unique_ptr<uint8_t[]>>> free_storage_;
+};
+
 class DescriptorPool : public StateObject {
   public:
     DescriptorPool(ValidationStateTracker &dev, const VkDescriptorPool handle, const VkDescriptorPoolCreateInfo *pCreateInfo);
@@ -77,6 +94,8 @@ class DescriptorPool : public StateObject {
         return available_sets_;
     }
 
+    const std::shared_ptr<DescriptorSetStorageCache> &GetStorageCache() const { return storage_cache_; }
+
     const vku::safe_VkDescriptorPoolCreateInfo safe_create_info;
     const VkDescriptorPoolCreateInfo &create_info;
 
@@ -90,6 +109,7 @@ class DescriptorPool : public StateObject {
     uint32_t available_sets_;        // Available descriptor sets in this pool
     TypeCountMap available_counts_;  // Available # of descriptors of each type in this pool
     vvl::unordered_map<VkDescriptorSet, vvl::DescriptorSet *> sets_;  // Collection of all sets in this pool
+    std::shared_ptr<DescriptorSetStorageCache> storage_cache_;
     ValidationStateTracker &dev_data_;
     mutable std::shared_mutex lock_;
 };
@@ -105,6 +125,25 @@ class DescriptorUpdateTemplate : public StateObject {
           create_info(*safe_create_info.ptr()) {}
 
     VkDescriptorUpdateTemplate VkHandle() const { return handle_.Cast<VkDescriptorUpdateTemplate>(); };
+
+    // The update entries unrolled into one VkWriteDescriptorSet per descriptor for a given set layout.
+    // Only the pointers into pData change between updates, so they are kept as offsets and patched in by DecodedTemplateUpdate.
+    struct DecodedLayout {
+        std::shared_ptr<const DescriptorSetLayoutDef> layout_def;
+        std::vector<VkWriteDescriptorSet> writes;
+        std::vector<size_t> offsets;
+        // Index of the update entry each write came from, used to chain the inline/acceleration structure pNext
+        std::vector<uint32_t> entries;
+        bool has_extended_infos = false;
+    };
+
+    // The decoded layout is built once for the layout the template was created with, and only rebuilt (then swapped in
+    // as a new immutable copy) when used with a different, compatible, set layout.
+    std::shared_ptr<const DecodedLayout> GetDecodedLayout(const DescriptorSetLayout &layout) const;
+
+  private:
+    mutable std::mutex decoded_layout_lock_;
+    mutable std::shared_ptr<const DecodedLayout> decoded_layout_;
 };
 
 // Utility structs/classes/types
@@ -156,6 +195,10 @@ class DescriptorSetLayoutDef {
   public:
     // Constructors and destructor
     DescriptorSetLayoutDef(const VkDescriptorSetLayoutCreateInfo *p_create_info);
+    // The bindings point into immutable_samplers_, a moved vector keeps its storage but a copied one would not
+    DescriptorSetLayoutDef(const DescriptorSetLayoutDef &) = delete;
+    DescriptorSetLayoutDef &operator=(const DescriptorSetLayoutDef &) = delete;
+    DescriptorSetLayoutDef(DescriptorSetLayoutDef &&) = default;
     size_t hash() const;
 
     uint32_t GetTotalDescriptorCount() const { return descriptor_count_; };
@@ -177,8 +220,8 @@ class DescriptorSetLayoutDef {
     VkDescriptorSetLayoutBinding const *GetDescriptorSetLayoutBindingPtrFromBinding(uint32_t binding) const {
         return GetDescriptorSetLayoutBindingPtrFromIndex(GetIndexFromBinding(binding));
     }
-    const std::vector<vku::safe_VkDescriptorSetLayoutBinding> &GetBindings() const { return bindings_; }
-    const VkDescriptorSetLayoutBinding *GetBindingInfoFromIndex(const uint32_t index) const { return bindings_[index].ptr(); }
+    const std::vector<VkDescriptorSetLayoutBinding> &GetBindings() const { return bindings_; }
+    const VkDescriptorSetLayoutBinding *GetBindingInfoFromIndex(const uint32_t index) const { return &bindings_[index]; }
     const VkDescriptorSetLayoutBinding *GetBindingInfoFromBinding(const uint32_t binding) const {
         return GetBindingInfoFromIndex(GetIndexFromBinding(binding));
     }
@@ -213,14 +256,26 @@ class DescriptorSetLayoutDef {
     };
     const BindingTypeStats &GetBindingTypeStats() const { return binding_type_stats_; }
 
+    // The bindings with a dynamic descriptor type, in the order their offsets are consumed from pDynamicOffsets
+    struct DynamicBinding {
+        uint32_t index;                 // binding vector index
+        uint32_t binding;               // binding number
+        uint32_t count;                 // descriptorCount, dynamic bindings can't have a variable count
+        uint32_t first_dynamic_offset;  // index of the offset of its first descriptor, relative to the set
+        VkDescriptorType type;
+    };
+    const std::vector<DynamicBinding> &GetDynamicBindings() const { return dynamic_bindings_; }
+
     std::string DescribeDifference(uint32_t index, const DescriptorSetLayoutDef &other) const;
 
   private:
     // Only the first three data members are used for hash and equality checks, the other members are derived from them, and are
     // used to speed up the various lookups/queries/validations
     VkDescriptorSetLayoutCreateFlags flags_;
-    std::vector<vku::safe_VkDescriptorSetLayoutBinding> bindings_;
+    std::vector<VkDescriptorSetLayoutBinding> bindings_;
     std::vector<VkDescriptorBindingFlags> binding_flags_;
+    // The pImmutableSamplers of all the bindings, in one block rather than an allocation per binding
+    std::vector<VkSampler> immutable_samplers_;
     // List of mutable types for each binding: [binding][mutable type]
     std::vector<std::vector<VkDescriptorType>> mutable_types_;
 
@@ -234,6 +289,7 @@ class DescriptorSetLayoutDef {
     uint32_t descriptor_count_;  // total # descriptors in this layout
     uint32_t dynamic_descriptor_count_;
     BindingTypeStats binding_type_stats_;
+    std::vector<DynamicBinding> dynamic_bindings_;
 };
 
 // Canonical dictionary of DSL definitions -- independent of device or handle
@@ -249,7 +305,7 @@ static inline bool operator==(const DescriptorSetLayoutDef &lhs, const Descripto
     if (lhs.GetMutableTypes() != rhs.GetMutableTypes()) {
         return false;
     }
-    // vectors of vku::safe_VkDescriptorSetLayoutBinding structures
+    // vectors of VkDescriptorSetLayoutBinding structures
     const auto &lhs_bindings = lhs.GetBindings();
     const auto &rhs_bindings = rhs.GetBindings();
     if (lhs_bindings.size() != rhs_bindings.size()) {
@@ -292,6 +348,9 @@ class DescriptorSetLayout : public StateObject {
     DescriptorSetLayoutId GetLayoutId() const { return layout_id_; }
     uint32_t GetTotalDescriptorCount() const { return layout_id_->GetTotalDescriptorCount(); };
     uint32_t GetDynamicDescriptorCount() const { return layout_id_->GetDynamicDescriptorCount(); };
+    const std::vector<DescriptorSetLayoutDef::DynamicBinding> &GetDynamicBindings() const {
+        return layout_id_->GetDynamicBindings();
+    }
     uint32_t GetBindingCount() const { return layout_id_->GetBindingCount(); };
     VkDescriptorSetLayoutCreateFlags GetCreateFlags() const { return layout_id_->GetCreateFlags(); }
     uint32_t GetIndexFromBinding(uint32_t binding) const { return layout_id_->GetIndexFromBinding(binding); }
@@ -304,7 +363,7 @@ class DescriptorSetLayout : public StateObject {
     VkDescriptorSetLayoutBinding const *GetDescriptorSetLayoutBindingPtrFromBinding(uint32_t binding) const {
         return layout_id_->GetDescriptorSetLayoutBindingPtrFromBinding(binding);
     }
-    const std::vector<vku::safe_VkDescriptorSetLayoutBinding> &GetBindings() const { return layout_id_->GetBindings(); }
+    const std::vector<VkDescriptorSetLayoutBinding> &GetBindings() const { return layout_id_->GetBindings(); }
     uint32_t GetDescriptorCountFromIndex(const uint32_t index) const { return layout_id_->GetDescriptorCountFromIndex(index); }
     uint32_t GetDescriptorCountFromBinding(const uint32_t binding) const {
         return layout_id_->GetDescriptorCountFromBinding(binding);
@@ -339,15 +398,28 @@ class DescriptorSetLayout : public StateObject {
     bool IsVariableDescriptorCount(uint32_t binding) const {
         return IsVariableDescriptorCountFromIndex(GetIndexFromBinding(binding));
     }
-    void SetLayoutSizeInBytes(const VkDeviceSize *layout_size_in_bytes_);
-    const VkDeviceSize *GetLayoutSizeInBytes() const;
+
+    // Queried once when a layout with VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT is created, instead of each
+    // time vkCmdSetDescriptorBufferOffsetsEXT is validated
+    struct DescriptorBufferLayout {
+        // vkGetDescriptorSetLayoutSizeEXT
+        VkDeviceSize size = 0;
+        // vkGetDescriptorSetLayoutBindingOffsetEXT, indexed like the bindings
+        std::vector<VkDeviceSize> binding_offsets;
+        // Bytes of the descriptor buffer that must be valid at the set offset. Ends at the variable descriptor count binding
+        // if there is one, since its size is only known when descriptors are written.
+        VkDeviceSize required_size = 0;
+    };
+    void SetDescriptorBufferLayout(DescriptorBufferLayout &&descriptor_buffer_layout);
+    // Null if the layout is not used for descriptor buffers
+    const DescriptorBufferLayout *GetDescriptorBufferLayout() const { return descriptor_buffer_layout_.get(); }
 
     using BindingTypeStats = DescriptorSetLayoutDef::BindingTypeStats;
     const BindingTypeStats &GetBindingTypeStats() const { return layout_id_->GetBindingTypeStats(); }
 
   private:
     DescriptorSetLayoutId layout_id_;
-    std::unique_ptr<VkDeviceSize> layout_size_in_bytes;
+    std::unique_ptr<const DescriptorBufferLayout> descriptor_buffer_layout_;
 };
 
 /*
@@ -672,6 +744,8 @@ class DescriptorBinding {
 
     virtual const Descriptor *GetDescriptor(const uint32_t index) const = 0;
     virtual Descriptor *GetDescriptor(const uint32_t index) = 0;
+    // Heap memory of the descriptors, for the memory report
+    virtual size_t DescriptorBytes() const = 0;
 
     bool IsBindless() const {
         return (binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT)) != 0;
@@ -709,6 +783,11 @@ class DescriptorBindingImpl : public DescriptorBinding {
 
     Descriptor *GetDescriptor(const uint32_t index) override { return index < count ? &descriptors[index] : nullptr; }
 
+    size_t DescriptorBytes() const override {
+        // A single descriptor is stored inline
+        return (descriptors.size() > 1 ? descriptors.size() * sizeof(T) : 0) + updated.size();
+    }
+
     template <typename Fn>
     void ForAllUpdated(Fn &&op) {
         auto size = updated.size();
@@ -753,6 +832,8 @@ using AccelerationStructureBinding = DescriptorBindingImpl<AccelerationStructure
 using MutableBinding = DescriptorBindingImpl<MutableDescriptor>;
 
 // Helper class to encapsulate the descriptor update template decoding logic
+// The decoding itself is cached in the template (see DescriptorUpdateTemplate::GetDecodedLayout), this only copies the
+// cached writes and points them into pData.
 struct DecodedTemplateUpdate {
     std::vector<VkWriteDescriptorSet> desc_writes;
     std::vector<VkWriteDescriptorSetInlineUniformBlockEXT> inline_infos;
@@ -763,6 +844,57 @@ struct DecodedTemplateUpdate {
                           VkDescriptorSetLayout push_layout = VK_NULL_HANDLE);
 };
 
+// Remembers which descriptors DescriptorValidator already checked against a given shader requirement, so draws (and GPU-AV
+// submits) that use a descriptor set in the same way again don't walk all of its descriptors again.
+// Everything the result depends on outside of the set itself is part of the key. Updating descriptors only forgets those
+// descriptors (the validated bits act as the inverse of a per-binding dirty bitmap), so a large update-after-bind set that
+// gets a few descriptors rewritten between submits is not validated in full again. The whole cache is dropped when an
+// object referenced by the descriptors is invalidated.
+struct DescriptorValidationCache {
+    struct Key {
+        uint64_t cb_id;
+        uint64_t render_state_generation;
+        uint64_t image_layout_change_count;
+        // The graphics pipeline is only looked at when there are active attachments, 0 otherwise
+        uint64_t pipeline_generation;
+        uint64_t requirement_hash;
+        vvl::Func command;
+        uint32_t set_index;
+        uint32_t binding;
+
+        bool operator==(const Key &other) const {
+            return cb_id == other.cb_id && render_state_generation == other.render_state_generation &&
+                   image_layout_change_count == other.image_layout_change_count &&
+                   pipeline_generation == other.pipeline_generation && requirement_hash == other.requirement_hash &&
+                   command == other.command && set_index == other.set_index && binding == other.binding;
+        }
+        struct Hash {
+            size_t operator()(const Key &key) const {
+                hash_util::HashCombiner hc;
+                hc << key.cb_id << key.render_state_generation << key.image_layout_change_count << key.pipeline_generation
+                   << key.requirement_hash << key.command << key.set_index << key.binding;
+                return hc.Value();
+            }
+        };
+    };
+    struct Entry {
+        bool all_validated = false;
+        std::vector<bool> validated_indices;  // only used when not all_validated
+    };
+    // Keeps the cache from growing without limit when many command buffers use the same set
+    static constexpr size_t kMaxEntries = 1024;
+
+    // Forget that descriptors [first, first + count) of binding were validated, takes the lock
+    void MarkUpdated(uint32_t binding, uint32_t binding_descriptor_count, uint32_t first, uint32_t count);
+
+    std::mutex lock;
+    // DescriptorSet::GetInvalidateCount() the entries were validated against
+    uint64_t invalidate_count = ~0ULL;
+    // Bumped by MarkUpdated, so validation that raced with an update doesn't mark the updated descriptors as validated
+    uint64_t update_count = 0;
+    vvl::unordered_map<Key, Entry, Key::Hash> entries;
+};
+
 /*
  * DescriptorSet class
  *
@@ -798,7 +930,8 @@ class DescriptorSet : public StateObject {
                   uint32_t variable_count, StateTracker *state_data);
     void LinkChildNodes() override;
     void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) override;
-    ~DescriptorSet() { Destroy(); }
+    void AddMemoryUsage(MemoryUsage &usage) const override;
+    ~DescriptorSet();
 
     // A number of common Get* functions that return data based on layout from which this set was created
     uint32_t GetTotalDescriptorCount() const { return layout_->GetTotalDescriptorCount(); };
@@ -878,10 +1011,9 @@ class DescriptorSet : public StateObject {
         return binding_data ? binding_data->GetDescriptor(index) : nullptr;
     }
 
-    // For a given dynamic offset array, return the corresponding index into the list of descriptors in set
-    const Descriptor *GetDescriptorFromDynamicOffsetIndex(const uint32_t index) const {
-        auto pos = dynamic_offset_idx_to_descriptor_list_.at(index);
-        return bindings_[pos.first]->GetDescriptor(pos.second);
+    // For a given dynamic offset index in the set, return the buffer descriptor the offset applies to
+    const BufferDescriptor *GetDynamicBufferDescriptor(const uint32_t index) const {
+        return index < dynamic_buffer_descriptors_.size() ? dynamic_buffer_descriptors_[index] : nullptr;
     }
 
     // Returns index in the dynamic offset array (specified by
@@ -890,9 +1022,13 @@ class DescriptorSet : public StateObject {
     uint32_t GetDynamicOffsetIndexFromBinding(uint32_t dynamic_binding) const;
 
     uint64_t GetChangeCount() const { return change_count_; }
+    // Only bumped when an object referenced by the descriptors changes, unlike GetChangeCount() which also counts updates
+    uint64_t GetInvalidateCount() const { return invalidate_count_; }
 
     const std::vector<vku::safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
+    DescriptorValidationCache &GetValidationCache() const { return validation_cache_; }
+
     void Destroy() override;
 
     const DescriptorSetLayout &Layout() const { return *layout_; }
@@ -1010,16 +1146,23 @@ class DescriptorSet : public StateObject {
     std::atomic<bool> some_update_;  // has any part of the set ever been updated?
     vvl::DescriptorPool *pool_state_;
     const std::shared_ptr<DescriptorSetLayout const> layout_;
+    // Where bindings_store_ came from, null for sets not allocated from a pool (push descriptors)
+    std::shared_ptr<DescriptorSetStorageCache> storage_cache_;
     // NOTE: the the backing store for the bindings must be declared *before* it so it will be destructed *after* it
     // "Destructors for nonstatic member objects are called in the reverse order in which they appear in the class declaration."
-    std::vector<BindingBackingStore> bindings_store_;
+    std::unique_ptr<uint8_t[]> bindings_store_;
+    size_t bindings_store_size_;
     std::vector<BindingPtr> bindings_;
     StateTracker *state_data_;
     uint32_t variable_count_;
     std::atomic<uint64_t> change_count_;
+    std::atomic<uint64_t> invalidate_count_;
+
+    mutable DescriptorValidationCache validation_cache_;
 
-    // For a given dynamic offset index in the set, map to associated index of the descriptors in the set
-    std::vector<std::pair<uint32_t, uint32_t>> dynamic_offset_idx_to_descriptor_list_;
+    // For a given dynamic offset index in the set, the descriptor it applies to. The descriptors live in the bindings, which
+    // are never reallocated, so updates to the set are seen without refreshing this.
+    std::vector<const BufferDescriptor *> dynamic_buffer_descriptors_;
 
     // If this descriptor set is a push descriptor set, the descriptor
     // set writes that were last pushed.
@@ -106,11 +106,42 @@ DeviceMemory::DeviceMemory(VkDeviceMemory handle, const VkMemoryAllocateInfo *pA
 }
 }  // namespace vvl
 
+void vvl::DeviceMemory::AddBoundResource(StateObject &resource, VkDeviceSize memory_offset) {
+    std::lock_guard<std::mutex> guard(bound_resources_lock_);
+    bound_resources_.emplace(memory_offset, BoundResource{resource.Handle(), resource.shared_from_this()});
+}
+
+void vvl::DeviceMemory::RemoveBoundResource(const StateObject &resource, VkDeviceSize memory_offset) {
+    std::lock_guard<std::mutex> guard(bound_resources_lock_);
+    auto [begin, end] = bound_resources_.equal_range(memory_offset);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.handle == resource.Handle()) {
+            bound_resources_.erase(it);
+            return;
+        }
+    }
+}
+
+std::vector<std::shared_ptr<vvl::StateObject>> vvl::DeviceMemory::GetResourcesBoundAt(VkDeviceSize memory_offset,
+                                                                                     VulkanObjectType type) const {
+    std::vector<std::shared_ptr<StateObject>> result;
+    std::lock_guard<std::mutex> guard(bound_resources_lock_);
+    auto [begin, end] = bound_resources_.equal_range(memory_offset);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.handle.type != type) continue;
+        if (auto state = it->second.state.lock()) {
+            result.emplace_back(std::move(state));
+        }
+    }
+    return result;
+}
+
 void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
     ASSERT_AND_RETURN(mem_state);
 
     mem_state->AddParent(parent);
+    mem_state->AddBoundResource(*parent, memory_offset);
     binding_ = {mem_state, memory_offset, 0u};
 }
 
@@ -154,6 +185,26 @@ bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
     return true;
 }
 
+void vvl::BindableSparseMemoryTracker::UnlinkMemory(StateObject *parent) {
+    DeviceMemoryState mem_states;
+    for (auto &value_pair : binding_map_) {
+        if (value_pair.second.memory_state) mem_states.emplace(value_pair.second.memory_state);
+    }
+    for (auto &mem_state : mem_states) {
+        mem_state->RemoveParent(parent);
+    }
+}
+
+void vvl::BindableSparseMemoryTracker::LinkMemory(StateObject *parent) {
+    DeviceMemoryState mem_states;
+    for (auto &value_pair : binding_map_) {
+        if (value_pair.second.memory_state) mem_states.emplace(value_pair.second.memory_state);
+    }
+    for (auto &mem_state : mem_states) {
+        mem_state->AddParent(parent);
+    }
+}
+
 void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
     MEM_BINDING memory_data{mem_state, memory_offset, resource_offset};
@@ -162,14 +213,40 @@ void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shar
     auto guard = WriteLockGuard{binding_lock_};
 
     // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
-    }
+    UnlinkMemory(parent);
     binding_map_.overwrite_range(item);
+    LinkMemory(parent);
+}
 
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+void vvl::BindableSparseMemoryTracker::BindMemoryRanges(StateObject *parent, std::vector<SparseMemoryBind> &binds) {
+    if (binds.empty()) {
+        return;
+    }
+
+    // Page by page binds of a virtual texture are mostly laid out contiguously in both resource and memory space.
+    // Merging neighbours doesn't change the result, two contiguous binds can't overlap each other.
+    size_t merged_count = 0;
+    for (size_t i = 1; i < binds.size(); ++i) {
+        SparseMemoryBind &last = binds[merged_count];
+        const SparseMemoryBind &bind = binds[i];
+        if (bind.memory_state == last.memory_state && bind.resource_offset == last.resource_offset + last.size &&
+            bind.memory_offset == last.memory_offset + last.size) {
+            last.size += bind.size;
+        } else {
+            binds[++merged_count] = std::move(binds[i]);
+        }
+    }
+    binds.resize(merged_count + 1);
+
+    auto guard = WriteLockGuard{binding_lock_};
+
+    UnlinkMemory(parent);
+    for (const auto &bind : binds) {
+        MEM_BINDING memory_data{bind.memory_state, bind.memory_offset, bind.resource_offset};
+        binding_map_.overwrite_range(
+            BindingMap::value_type{{bind.resource_offset, bind.resource_offset + bind.size}, std::move(memory_data)});
     }
+    LinkMemory(parent);
 }
 
 BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const MemoryRange &range) const {
@@ -20,6 +20,8 @@
 #include "state_tracker/state_object.h"
 #include "containers/range_vector.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <map>
+#include <mutex>
 
 namespace vvl {
 struct MemRange {
@@ -84,6 +86,21 @@ class DeviceMemory : public StateObject {
     bool IsDedicatedImage() const { return GetDedicatedImage() != VK_NULL_HANDLE; }
 
     VkDeviceMemory VkHandle() const { return handle_.Cast<VkDeviceMemory>(); }
+
+    // Non sparse, single plane resources bound to this memory, by memory offset.
+    // Suballocators put tens of thousands of resources in the same allocation, looking up the ones bound at a given offset
+    // (memory aliasing) must not walk all of them.
+    void AddBoundResource(StateObject &resource, VkDeviceSize memory_offset);
+    void RemoveBoundResource(const StateObject &resource, VkDeviceSize memory_offset);
+    std::vector<std::shared_ptr<StateObject>> GetResourcesBoundAt(VkDeviceSize memory_offset, VulkanObjectType type) const;
+
+  private:
+    struct BoundResource {
+        VulkanTypedHandle handle;
+        std::weak_ptr<StateObject> state;
+    };
+    mutable std::mutex bound_resources_lock_;
+    std::multimap<VkDeviceSize, BoundResource> bound_resources_;
 };
 
 // Generic memory binding struct to track objects bound to objects
@@ -112,6 +129,20 @@ class BindableMemoryTracker {
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
 
+    // One VkSparseMemoryBind, with the memory already looked up
+    struct SparseMemoryBind {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        VkDeviceSize memory_offset;
+        VkDeviceSize resource_offset;
+        VkDeviceSize size;
+    };
+    // All the binds of one resource in a vkQueueBindSparse call, applied in order
+    virtual void BindMemoryRanges(StateObject *parent, std::vector<SparseMemoryBind> &binds) {
+        for (auto &bind : binds) {
+            BindMemory(parent, bind.memory_state, bind.memory_offset, bind.resource_offset, bind.size);
+        }
+    }
+
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual DeviceMemoryState GetBoundMemoryStates() const = 0;
 };
@@ -170,12 +201,19 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    // Contiguous binds of the same memory are merged into a single range, and the parent links of the memory are only
+    // updated once for the whole batch
+    void BindMemoryRanges(StateObject *parent, std::vector<SparseMemoryBind> &binds) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
 
     DeviceMemoryState GetBoundMemoryStates() const override;
 
   private:
+    // binding_lock_ must be held
+    void UnlinkMemory(StateObject *parent);
+    void LinkMemory(StateObject *parent);
+
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
     BindingMap binding_map_;
@@ -229,6 +267,9 @@ class Bindable : public StateObject {
     }
 
     void Destroy() override {
+        if (const MEM_BINDING *binding = memory_tracker_->Binding()) {
+            binding->memory_state->RemoveBoundResource(*this, binding->memory_offset);
+        }
         for (auto &state : memory_tracker_->GetBoundMemoryStates()) {
             state->RemoveParent(this);
         }
@@ -278,6 +319,9 @@ class Bindable : public StateObject {
                     const VkDeviceSize resource_offset, const VkDeviceSize mem_size) {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
+    void BindMemoryRanges(StateObject *parent, std::vector<BindableMemoryTracker::SparseMemoryBind> &binds) {
+        memory_tracker_->BindMemoryRanges(parent, binds);
+    }
 
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
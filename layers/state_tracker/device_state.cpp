@@ -19,15 +19,6 @@
 
 namespace vvl {
 
-const std::vector<VkQueueFamilyProperties> PhysicalDevice::GetQueueFamilyProps(VkPhysicalDevice phys_dev) {
-    std::vector<VkQueueFamilyProperties> result;
-    uint32_t count;
-    DispatchGetPhysicalDeviceQueueFamilyProperties(phys_dev, &count, nullptr);
-    result.resize(count);
-    DispatchGetPhysicalDeviceQueueFamilyProperties(phys_dev, &count, result.data());
-    return result;
-}
-
 VkQueueFlags PhysicalDevice::GetSupportedQueues() {
     VkQueueFlags flag = 0;
     for (const auto& prop : queue_family_properties) {
@@ -38,7 +29,8 @@ VkQueueFlags PhysicalDevice::GetSupportedQueues() {
 
 PhysicalDevice::PhysicalDevice(VkPhysicalDevice handle)
     : StateObject(handle, kVulkanObjectTypePhysicalDevice),
-      queue_family_properties(GetQueueFamilyProps(handle)),
+      info(GetPhysicalDeviceInfo(handle)),
+      queue_family_properties(info->queue_family_properties),
       supported_queues(GetSupportedQueues()) {}
 
 }  // namespace vvl
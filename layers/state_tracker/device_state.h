@@ -18,8 +18,10 @@
  */
 #pragma once
 #include "state_tracker/state_object.h"
+#include "state_tracker/physical_device_cache.h"
 #include "generated/layer_chassis_dispatch.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <shared_mutex>
 #include <vector>
 
 class QueueFamilyPerfCounters {
@@ -39,7 +41,9 @@ namespace vvl {
 class PhysicalDevice : public StateObject {
   public:
     uint32_t queue_family_known_count = 1;  // spec implies one QF must always be supported
-    const std::vector<VkQueueFamilyProperties> queue_family_properties;
+    // Shared with the other instances and devices on the same physical device
+    const std::shared_ptr<const PhysicalDeviceInfo> info;
+    const std::vector<VkQueueFamilyProperties> &queue_family_properties;
     const VkQueueFlags supported_queues;
     // TODO These are currently used by CoreChecks, but should probably be refactored
     bool vkGetPhysicalDeviceDisplayPlanePropertiesKHR_called = false;
@@ -55,9 +59,29 @@ class PhysicalDevice : public StateObject {
 
     VkPhysicalDevice VkHandle() const { return handle_.Cast<VkPhysicalDevice>(); }
 
+    // Format properties don't change for the lifetime of the physical device, so each format is only queried once.
+    // query fills the properties on a miss. The result depends on whether the device uses VkFormatProperties3, so the
+    // properties are cached for both cases.
+    template <typename QueryFunc>
+    VkFormatProperties3KHR GetFormatProperties(VkFormat format, bool has_format_feature2, const QueryFunc &query) {
+        const uint64_t key = (uint64_t(format) << 1) | (has_format_feature2 ? 1 : 0);
+        {
+            ReadLockGuard guard(format_properties_lock_);
+            auto it = format_properties_.find(key);
+            if (it != format_properties_.end()) {
+                return it->second;
+            }
+        }
+        const VkFormatProperties3KHR format_properties = query(format);
+        WriteLockGuard guard(format_properties_lock_);
+        return format_properties_.emplace(key, format_properties).first->second;
+    }
+
   private:
-    const std::vector<VkQueueFamilyProperties> GetQueueFamilyProps(VkPhysicalDevice phys_dev);
     VkQueueFlags GetSupportedQueues();
+
+    std::shared_mutex format_properties_lock_;
+    unordered_map<uint64_t, VkFormatProperties3KHR> format_properties_;
 };
 
 class DisplayMode : public StateObject {
@@ -28,6 +28,18 @@ namespace image_layout_map {
 using InitialLayoutStates = ImageSubresourceLayoutMap::InitialLayoutStates;
 using LayoutEntry = ImageSubresourceLayoutMap::LayoutEntry;
 
+std::shared_ptr<const Encoder> EncoderCache::Get(const VkImageSubresourceRange& full_range) {
+    // Full ranges always start at mip level and array layer 0, aspect bits and mip level counts fit in 16 bits
+    const uint64_t key = (static_cast<uint64_t>(full_range.aspectMask & 0xFFFF) << 48) |
+                         (static_cast<uint64_t>(full_range.levelCount & 0xFFFF) << 32) | full_range.layerCount;
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& entry = entries_[key];
+    if (!entry) {
+        entry = std::make_shared<const Encoder>(full_range);
+    }
+    return entry;
+}
+
 template <typename LayoutsMap>
 static bool UpdateLayoutStateImpl(LayoutsMap& layouts, InitialLayoutStates& initial_layout_states, const IndexRange& range,
                                   LayoutEntry& new_entry, const vvl::CommandBuffer& cb_state, const vvl::ImageView* view_state) {
@@ -89,11 +101,28 @@ bool ImageSubresourceLayoutMap::SubresourceLayout::operator==(const ImageSubreso
     return is_equal;
 }
 ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const vvl::Image& image_state)
-    : image_state_(image_state),
-      encoder_(image_state.subresource_encoder),
-      layouts_(encoder_.SubresourceCount()),
+    : image_state_(&image_state),
+      encoder_(&image_state.subresource_encoder),
+      layouts_(encoder_->SubresourceCount()),
       initial_layout_states_() {}
 
+void ImageSubresourceLayoutMap::Reset() {
+    layouts_.clear();
+    initial_layout_states_.clear();
+    std::lock_guard<std::mutex> guard(submit_layouts_lock_);
+    submit_layouts_.expected.clear();
+    submit_layouts_.transitions.clear();
+    submit_layouts_dirty_ = true;
+}
+
+void ImageSubresourceLayoutMap::Reset(const vvl::Image& image_state) {
+    Reset();
+    image_state_ = &image_state;
+    encoder_ = &image_state.subresource_encoder;
+    // The small map of a single subresource image lives in place, no allocation when switching between them
+    layouts_.Reset(encoder_->SubresourceCount());
+}
+
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
@@ -113,8 +142,9 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const vvl::CommandBuff
         expected_layout = layout;
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
+    submit_layouts_dirty_ = true;
 
-    RangeGenerator range_gen(encoder_, range);
+    RangeGenerator range_gen(*encoder_, range);
     if (layouts_.SmallMode()) {
         return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              expected_layout);
@@ -140,8 +170,9 @@ static void SetSubresourceRangeInitialLayoutImpl(LayoutMap& layouts, InitialLayo
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state,
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
+    submit_layouts_dirty_ = true;
 
-    RangeGenerator range_gen(encoder_, range);
+    RangeGenerator range_gen(*encoder_, range);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
     } else {
@@ -153,6 +184,7 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, VkImageLayout layout,
                                                                  const vvl::ImageView& view_state) {
+    submit_layouts_dirty_ = true;
     RangeGenerator range_gen(view_state.range_generator);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -166,7 +198,7 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 
 // TODO: make sure this paranoia check is sufficient and not too much.
 uintptr_t ImageSubresourceLayoutMap::CompatibilityKey() const {
-    return (reinterpret_cast<uintptr_t>(&image_state_) ^ encoder_.AspectMask());
+    return (reinterpret_cast<uintptr_t>(image_state_) ^ encoder_->AspectMask());
 }
 
 bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& other) {
@@ -178,7 +210,42 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     //         currently this function is only used to import from secondary command buffers, destruction of which
     //         invalidate the referencing primary command buffer, meaning that the dangling pointer will either be
     //         cleaned up in invalidation, on not referenced by validation code.
+    submit_layouts_dirty_ = true;
     return sparse_container::splice(layouts_, other.layouts_, LayoutEntry::Updater());
 }
 
+// Append range to the list, merging it with the previous range when they touch, are in the same aspect and have the same layout
+static void AppendLayoutRange(ImageSubresourceLayoutMap::LayoutRanges& ranges, const IndexRange& range, VkImageLayout layout,
+                              IndexType aspect_size) {
+    if (!ranges.empty()) {
+        auto& last = ranges.back();
+        const bool same_aspect = (last.range.begin / aspect_size) == ((range.end - 1) / aspect_size);
+        if (last.layout == layout && last.range.end == range.begin && same_aspect) {
+            last.range.end = range.end;
+            return;
+        }
+    }
+    ranges.emplace_back(ImageSubresourceLayoutMap::LayoutRange{range, layout});
+}
+
+const ImageSubresourceLayoutMap::SubmitLayouts& ImageSubresourceLayoutMap::GetSubmitLayouts() const {
+    std::lock_guard<std::mutex> guard(submit_layouts_lock_);
+    if (submit_layouts_dirty_) {
+        submit_layouts_.expected.clear();
+        submit_layouts_.transitions.clear();
+        const IndexType aspect_size = encoder_->AspectSize();
+        for (const auto& entry : layouts_) {
+            const LayoutEntry& layout_entry = entry.second;
+            if (layout_entry.initial_layout != kInvalidLayout && layout_entry.initial_layout != VK_IMAGE_LAYOUT_UNDEFINED) {
+                AppendLayoutRange(submit_layouts_.expected, entry.first, layout_entry.initial_layout, aspect_size);
+            }
+            if (layout_entry.current_layout != kInvalidLayout) {
+                AppendLayoutRange(submit_layouts_.transitions, entry.first, layout_entry.current_layout, aspect_size);
+            }
+        }
+        submit_layouts_dirty_ = false;
+    }
+    return submit_layouts_;
+}
+
 }  // namespace image_layout_map
@@ -20,10 +20,13 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
+#include "containers/custom_containers.h"
 #include "containers/range_vector.h"
 #include "containers/subresource_adapter.h"
 #include "utils/vk_layer_utils.h"
@@ -47,6 +50,18 @@ using IndexRange = sparse_container::range<IndexType>;
 using Encoder = subresource_adapter::RangeEncoder;
 using RangeGenerator = subresource_adapter::RangeGenerator;
 
+// The subresource encoder of an image only depends on its full range, so all images with the same aspects, mip level
+// and array layer counts share a single instance instead of each carrying a copy.
+// Distinct full ranges are few in practice, entries are kept for the lifetime of the device.
+class EncoderCache {
+  public:
+    std::shared_ptr<const Encoder> Get(const VkImageSubresourceRange& full_range);
+
+  private:
+    std::mutex mutex_;
+    vvl::unordered_map<uint64_t, std::shared_ptr<const Encoder>> entries_;
+};
+
 struct InitialLayoutState {
     VkImageView image_view;          // For relaxed matching rule evaluation, else VK_NULL_HANDLE
     VkImageAspectFlags aspect_mask;  // For relaxed matching rules... else 0
@@ -114,6 +129,20 @@ class ImageSubresourceLayoutMap {
     using LayoutMap = subresource_adapter::BothRangeMap<LayoutEntry, 16>;
     using RangeType = LayoutMap::key_type;
 
+    // Compact, sorted summary of the layout map used at submit time.
+    // "expected" holds the ranges that must be in a given layout when the command buffer starts executing (UNDEFINED is left
+    // out as there is nothing to check), "transitions" holds the layout each range is left in. Adjacent ranges of the same
+    // aspect with the same layout are merged, so submit time only walks a short list per image.
+    struct LayoutRange {
+        IndexRange range;
+        VkImageLayout layout;
+    };
+    using LayoutRanges = std::vector<LayoutRange>;
+    struct SubmitLayouts {
+        LayoutRanges expected;
+        LayoutRanges transitions;
+    };
+
     bool SetSubresourceRangeLayout(const vvl::CommandBuffer& cb_state, const VkImageSubresourceRange& range, VkImageLayout layout,
                                    VkImageLayout expected_layout = kInvalidLayout);
     void SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, const VkImageSubresourceRange& range,
@@ -123,19 +152,25 @@ class ImageSubresourceLayoutMap {
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
     const LayoutMap& GetLayoutMap() const { return layouts_; }
+    // Rebuilt on first use after the layout map changed
+    const SubmitLayouts& GetSubmitLayouts() const;
     ImageSubresourceLayoutMap(const vvl::Image& image_state);
     ~ImageSubresourceLayoutMap() {}
-    const vvl::Image* GetImageView() const { return &image_state_; };
+    // Back to the freshly constructed state, keeping the storage for the next recording of the same image
+    void Reset();
+    // Same as Reset(), but for recording another image. Lets a pool hand out the map to any image.
+    void Reset(const vvl::Image& image_state);
+    const vvl::Image* GetImageView() const { return image_state_; };
 
     // This looks a bit ponderous but kAspectCount is a compile time constant
     VkImageSubresource Decode(IndexType index) const {
-        const auto subres = encoder_.Decode(index);
-        return encoder_.MakeVkSubresource(subres);
+        const auto subres = encoder_->Decode(index);
+        return encoder_->MakeVkSubresource(subres);
     }
 
     RangeGenerator RangeGen(const VkImageSubresourceRange& subres_range) const {
-        if (encoder_.InRange(subres_range)) {
-            return (RangeGenerator(encoder_, subres_range));
+        if (encoder_->InRange(subres_range)) {
+            return (RangeGenerator(*encoder_, subres_range));
         }
         // Return empty range generator
         return RangeGenerator();
@@ -162,14 +197,18 @@ class ImageSubresourceLayoutMap {
     }
 
   protected:
-    bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
-    bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
+    bool InRange(const VkImageSubresource& subres) const { return encoder_->InRange(subres); }
+    bool InRange(const VkImageSubresourceRange& range) const { return encoder_->InRange(range); }
 
   private:
-    const vvl::Image& image_state_;
-    const Encoder& encoder_;
+    const vvl::Image* image_state_;
+    const Encoder* encoder_;
     LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+
+    mutable std::mutex submit_layouts_lock_;
+    mutable bool submit_layouts_dirty_ = true;
+    mutable SubmitLayouts submit_layouts_;
 };
 }  // namespace image_layout_map
 
@@ -183,7 +222,18 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
     bool AnyInRange(RangeGenerator& gen, std::function<bool(const key_type& range, const mapped_type& state)>&& func) const;
+    // Apply the final layouts recorded by a command buffer
+    void SetLayouts(const image_layout_map::ImageSubresourceLayoutMap::LayoutRanges& transitions);
+    // Write lock must be held. All layout changes must go through here (or SetLayouts) to keep UniformLayout() up to date
+    void SetLayout(const key_type& range, VkImageLayout layout);
+
+    // Read lock must be held. The layout of every subresource if they are all in the same one, else kInvalidLayout.
+    // Computed on first use after a layout change, so checking a whole image (like host image copies of each mip level
+    // into an image that was transitioned at once) doesn't walk the map every time.
+    VkImageLayout UniformLayout() const;
 
   private:
     mutable std::shared_mutex lock_;
+    mutable std::atomic<bool> uniform_layout_valid_{false};
+    mutable std::atomic<VkImageLayout> uniform_layout_{image_layout_map::kInvalidLayout};
 };
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/shader_module.h"
+#include "chassis/memory_report.h"
 #include <limits>
 #include <string_view>
 
@@ -190,26 +191,30 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       disjoint((pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) != 0),
       requirements(GetMemoryRequirements(dev_data, img, pCreateInfo, disjoint, IsExternalBuffer())),
       sparse_residency((pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT) != 0),
-      sparse_requirements(GetSparseRequirements(dev_data, img, sparse_residency)),
-      sparse_metadata_required(SparseMetaDataRequired(sparse_requirements)),
+      sparse_metadata_required(false),
       get_sparse_reqs_called(false),
       sparse_metadata_bound(false),
 #ifdef VK_USE_PLATFORM_METAL_EXT
       metal_image_export(GetMetalExport(pCreateInfo, VK_EXPORT_METAL_OBJECT_TYPE_METAL_TEXTURE_BIT_EXT)),
       metal_io_surface_export(GetMetalExport(pCreateInfo, VK_EXPORT_METAL_OBJECT_TYPE_METAL_IOSURFACE_BIT_EXT)),
 #endif  // VK_USE_PLATFORM_METAL_EXT
-      subresource_encoder(full_range),
+      shared_subresource_encoder(dev_data.subresource_encoder_cache_.Get(full_range)),
+      subresource_encoder(*shared_subresource_encoder),
       fragment_encoder(nullptr),
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
-      supported_video_profiles(dev_data.video_profile_cache_.Get(
-          dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
+      rare_create_data_(MakeRareCreateData(dev_data, img, pCreateInfo, sparse_residency)) {
+    if (rare_create_data_) {
+        sparse_metadata_required = SparseMetaDataRequired(rare_create_data_->sparse_requirements);
+    }
     if (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) {
         bool is_resident = (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT) != 0;
-        tracker_.emplace<BindableSparseMemoryTracker>(requirements.data(), is_resident);
-        SetMemoryTracker(&std::get<BindableSparseMemoryTracker>(tracker_));
+        auto &tracker = tracker_.emplace<std::unique_ptr<BindableSparseMemoryTracker>>(
+            std::make_unique<BindableSparseMemoryTracker>(requirements.data(), is_resident));
+        SetMemoryTracker(tracker.get());
     } else if (pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) {
-        tracker_.emplace<BindableMultiplanarMemoryTracker>(requirements.data(), vkuFormatPlaneCount(pCreateInfo->format));
-        SetMemoryTracker(&std::get<BindableMultiplanarMemoryTracker>(tracker_));
+        auto &tracker = tracker_.emplace<std::unique_ptr<BindableMultiplanarMemoryTracker>>(
+            std::make_unique<BindableMultiplanarMemoryTracker>(requirements.data(), vkuFormatPlaneCount(pCreateInfo->format)));
+        SetMemoryTracker(tracker.get());
     } else {
         tracker_.emplace<BindableLinearMemoryTracker>(requirements.data());
         SetMemoryTracker(&std::get<BindableLinearMemoryTracker>(tracker_));
@@ -233,7 +238,6 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       disjoint((pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) != 0),
       requirements{},
       sparse_residency(false),
-      sparse_requirements{},
       sparse_metadata_required(false),
       get_sparse_reqs_called(false),
       sparse_metadata_bound(false),
@@ -241,11 +245,11 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       metal_image_export(GetMetalExport(pCreateInfo, VK_EXPORT_METAL_OBJECT_TYPE_METAL_TEXTURE_BIT_EXT)),
       metal_io_surface_export(GetMetalExport(pCreateInfo, VK_EXPORT_METAL_OBJECT_TYPE_METAL_IOSURFACE_BIT_EXT)),
 #endif  // VK_USE_PLATFORM_METAL_EXT
-      subresource_encoder(full_range),
+      shared_subresource_encoder(dev_data.subresource_encoder_cache_.Get(full_range)),
+      subresource_encoder(*shared_subresource_encoder),
       fragment_encoder(nullptr),
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
-      supported_video_profiles(dev_data.video_profile_cache_.Get(
-          dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
+      rare_create_data_(MakeRareCreateData(dev_data, img, pCreateInfo, false)) {
     fragment_encoder =
         std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*this));
 
@@ -253,6 +257,28 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
     SetMemoryTracker(&std::get<BindableNoMemoryTracker>(tracker_));
 }
 
+std::unique_ptr<const Image::RareCreateData> Image::MakeRareCreateData(const ValidationStateTracker &dev_data, VkImage img,
+                                                                       const VkImageCreateInfo *pCreateInfo, bool sparse_residency) {
+    const auto *profile_list = vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext);
+    if (!sparse_residency && !profile_list) {
+        return nullptr;
+    }
+    auto data = std::make_unique<RareCreateData>();
+    data->sparse_requirements = GetSparseRequirements(dev_data, img, sparse_residency);
+    data->supported_video_profiles = dev_data.video_profile_cache_.Get(dev_data.physical_device, profile_list);
+    return data;
+}
+
+const Image::SparseReqs &Image::SparseRequirements() const {
+    static const SparseReqs kEmpty;
+    return rare_create_data_ ? rare_create_data_->sparse_requirements : kEmpty;
+}
+
+const Image::SupportedVideoProfiles &Image::GetSupportedVideoProfiles() const {
+    static const SupportedVideoProfiles kEmpty;
+    return rare_create_data_ ? rare_create_data_->supported_video_profiles : kEmpty;
+}
+
 void Image::Destroy() {
     // NOTE: due to corner cases in aliased images, the layout_range_map MUST not be cleaned up here.
     // If it is, bad local entries could be created by vvl::CommandBuffer::GetImageSubresourceLayoutMap()
@@ -268,6 +294,29 @@ void Image::Destroy() {
     Bindable::Destroy();
 }
 
+void Image::AddMemoryUsage(MemoryUsage &usage) const {
+    size_t bytes = sizeof(*this);
+    if (rare_create_data_) {
+        bytes += sizeof(RareCreateData) + MemoryUsage::VectorBytes(rare_create_data_->sparse_requirements);
+    }
+    if (std::holds_alternative<std::unique_ptr<BindableSparseMemoryTracker>>(tracker_)) {
+        bytes += sizeof(BindableSparseMemoryTracker);
+    } else if (std::holds_alternative<std::unique_ptr<BindableMultiplanarMemoryTracker>>(tracker_)) {
+        bytes += sizeof(BindableMultiplanarMemoryTracker);
+    }
+    if (usage.FirstVisit(shared_subresource_encoder.get())) {
+        bytes += sizeof(image_layout_map::Encoder);
+    }
+    if (fragment_encoder) {
+        bytes += sizeof(subresource_adapter::ImageRangeEncoder);
+    }
+    // Aliased images share the same layout map
+    if (layout_range_map && usage.FirstVisit(layout_range_map.get())) {
+        bytes += sizeof(GlobalImageLayoutRangeMap) + layout_range_map->size() * sizeof(GlobalImageLayoutRangeMap::value_type);
+    }
+    usage.Add(MemoryCategory::Image, bytes);
+}
+
 void Image::NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) {
     Bindable::NotifyInvalidate(invalid_nodes, unlink);
     if (unlink) {
@@ -357,12 +406,10 @@ void Image::SetInitialLayoutMap() {
 }
 
 void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout layout) {
-    using sparse_container::update_range_value;
-    using sparse_container::value_precedence;
     GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, NormalizeSubresourceRange(range));
     auto guard = layout_range_map->WriteLock();
     for (; range_gen->non_empty(); ++range_gen) {
-        update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
+        layout_range_map->SetLayout(*range_gen, layout);
     }
 }
 
@@ -889,3 +936,31 @@ bool GlobalImageLayoutRangeMap::AnyInRange(RangeGenerator &gen,
     }
     return false;
 }
+
+void GlobalImageLayoutRangeMap::SetLayouts(const image_layout_map::ImageSubresourceLayoutMap::LayoutRanges &transitions) {
+    for (const auto &transition : transitions) {
+        SetLayout(transition.range, transition.layout);
+    }
+}
+
+void GlobalImageLayoutRangeMap::SetLayout(const key_type &range, VkImageLayout layout) {
+    uniform_layout_valid_.store(false, std::memory_order_relaxed);
+    sparse_container::update_range_value(*this, range, layout, sparse_container::value_precedence::prefer_source);
+}
+
+VkImageLayout GlobalImageLayoutRangeMap::UniformLayout() const {
+    if (uniform_layout_valid_.load(std::memory_order_acquire)) {
+        return uniform_layout_.load(std::memory_order_relaxed);
+    }
+    // Concurrent readers compute the same value, writers are excluded by the lock
+    VkImageLayout uniform_layout = empty() ? image_layout_map::kInvalidLayout : begin()->second;
+    for (const auto &entry : *this) {
+        if (entry.second != uniform_layout) {
+            uniform_layout = image_layout_map::kInvalidLayout;
+            break;
+        }
+    }
+    uniform_layout_.store(uniform_layout, std::memory_order_relaxed);
+    uniform_layout_valid_.store(true, std::memory_order_release);
+    return uniform_layout;
+}
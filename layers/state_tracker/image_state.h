@@ -107,25 +107,27 @@ class Image : public Bindable {
 
     const bool sparse_residency;
     using SparseReqs = std::vector<VkSparseImageMemoryRequirements>;
-    const SparseReqs sparse_requirements;
-    const bool sparse_metadata_required;  // Track if sparse metadata aspect is required for this image
+    using SupportedVideoProfiles = vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>>;
+    bool sparse_metadata_required;        // Track if sparse metadata aspect is required for this image
     bool get_sparse_reqs_called;          // Track if GetImageSparseMemoryRequirements() has been called for this image
     bool sparse_metadata_bound;           // Track if sparse metadata aspect is bound to this image
 
     VkImageFormatProperties image_format_properties = {};
+    // (view format << 32 | view usage) of the last view of this image that passed the format feature checks, 0 if none yet
+    mutable std::atomic<uint64_t> validated_view_format_features{0};
 #ifdef VK_USE_PLATFORM_METAL_EXT
     const bool metal_image_export;
     const bool metal_io_surface_export;
 #endif  // VK_USE_PLATFORM_METAL
 
-    const image_layout_map::Encoder subresource_encoder;                             // Subresource resolution encoder
+    // Subresource resolution encoder, shared by all images with the same full range
+    const std::shared_ptr<const image_layout_map::Encoder> shared_subresource_encoder;
+    const image_layout_map::Encoder &subresource_encoder;
     std::unique_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
     const VkDevice store_device_as_workaround;                                       // TODO REMOVE WHEN encoder can be const
 
     std::shared_ptr<GlobalImageLayoutRangeMap> layout_range_map;
 
-    vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>> supported_video_profiles;
-
     Image(const ValidationStateTracker &dev_data, VkImage handle, const VkImageCreateInfo *pCreateInfo,
           VkFormatFeatureFlags2KHR features);
     Image(const ValidationStateTracker &dev_data, VkImage handle, const VkImageCreateInfo *pCreateInfo, VkSwapchainKHR swapchain,
@@ -137,6 +139,10 @@ class Image : public Bindable {
     VkImage VkHandle() const { return handle_.Cast<VkImage>(); }
 
     bool HasAHBFormat() const { return ahb_format != 0; }
+    // Empty unless the image is sparse resident
+    const SparseReqs &SparseRequirements() const;
+    // Empty unless the image was created with a video profile list
+    const SupportedVideoProfiles &GetSupportedVideoProfiles() const;
     bool IsCompatibleAliasing(const Image *other_image_state) const;
 
     // returns true if this image could be using the same memory as another image
@@ -196,6 +202,7 @@ class Image : public Bindable {
     void SetSwapchain(std::shared_ptr<vvl::Swapchain> &swapchain, uint32_t swapchain_index);
 
     void Destroy() override;
+    void AddMemoryUsage(MemoryUsage &usage) const override;
 
     // Returns the effective extent of the provided subresource, adjusted for mip level and array depth.
     VkExtent3D GetEffectiveSubresourceExtent(const VkImageSubresourceLayers &sub) const {
@@ -243,19 +250,37 @@ class Image : public Bindable {
 
     template <typename UnaryPredicate>
     bool AnyImageAliasOf(const UnaryPredicate &pred) const {
-        // Look for another aliasing image and
-        // ObjectBindings() is thread safe since returns by value, and once
-        // the weak_ptr is successfully locked, the other image state won't
-        // be freed out from under us.
-        for (auto const &memory_state : GetBoundMemoryStates()) {
-            if (AnyAliasBindingOf(memory_state->ObjectBindings(), pred)) return true;
+        // Aliasing through memory needs a single binding at the same memory offset (see IsCompatibleAliasing), so only the
+        // images bound at that offset are candidates instead of everything bound to the memory.
+        // Once the weak_ptr is successfully locked, the other image state won't be freed out from under us.
+        const MEM_BINDING *binding = Binding();
+        if (!binding) {
+            return false;
+        }
+        const auto candidates = binding->memory_state->GetResourcesBoundAt(binding->memory_offset, kVulkanObjectTypeImage);
+        for (const auto &state_object : candidates) {
+            auto other_image = static_cast<const Image *>(state_object.get());
+            if ((other_image != this) && other_image->IsCompatibleAliasing(this)) {
+                if (pred(*other_image)) return true;
+            }
         }
         return false;
     }
 
   private:
-    std::variant<std::monostate, BindableNoMemoryTracker, BindableLinearMemoryTracker, BindableSparseMemoryTracker,
-                 BindableMultiplanarMemoryTracker>
+    // Only sparse resident and video images have these, the others don't pay for them
+    struct RareCreateData {
+        SparseReqs sparse_requirements;
+        SupportedVideoProfiles supported_video_profiles;
+    };
+    std::unique_ptr<const RareCreateData> rare_create_data_;
+    // Returns nullptr for the common case of an image that is neither sparse resident nor used for video
+    static std::unique_ptr<const RareCreateData> MakeRareCreateData(const ValidationStateTracker &dev_data, VkImage handle,
+                                                                    const VkImageCreateInfo *pCreateInfo, bool sparse_residency);
+
+    // The sparse and multiplanar trackers are several times larger than the linear one, and only used by few images
+    std::variant<std::monostate, BindableNoMemoryTracker, BindableLinearMemoryTracker,
+                 std::unique_ptr<BindableSparseMemoryTracker>, std::unique_ptr<BindableMultiplanarMemoryTracker>>
         tracker_;
 };
 
@@ -337,6 +362,13 @@ class Swapchain : public StateObject {
     ValidationStateTracker &dev_data;
     uint32_t acquired_images = 0;
 
+    // Surface properties checked by every acquire and present. They can't change for the lifetime of the swapchain, so they
+    // are only queried once, a recreated swapchain queries them again.
+    static constexpr uint32_t kUnknownMinImageCount = vvl::kU32Max;
+    mutable std::atomic<uint32_t> min_image_count{kUnknownMinImageCount};
+    // The last queue family that was checked to support presenting to the surface
+    mutable std::atomic<uint32_t> present_queue_family_index{VK_QUEUE_FAMILY_IGNORED};
+
     Swapchain(ValidationStateTracker &dev_data, const VkSwapchainCreateInfoKHR *pCreateInfo, VkSwapchainKHR handle);
 
     ~Swapchain() {
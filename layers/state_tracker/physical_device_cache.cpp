@@ -0,0 +1,97 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "state_tracker/physical_device_cache.h"
+
+#include <cstring>
+#include <mutex>
+
+#include "containers/custom_containers.h"
+#include "generated/layer_chassis_dispatch.h"
+#include "utils/hash_util.h"
+
+namespace vvl {
+
+struct PhysicalDeviceKey {
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint32_t api_version;
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+
+    explicit PhysicalDeviceKey(const VkPhysicalDeviceProperties &properties)
+        : vendor_id(properties.vendorID),
+          device_id(properties.deviceID),
+          driver_version(properties.driverVersion),
+          api_version(properties.apiVersion) {
+        std::memcpy(pipeline_cache_uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+    }
+    bool operator==(const PhysicalDeviceKey &rhs) const {
+        return vendor_id == rhs.vendor_id && device_id == rhs.device_id && driver_version == rhs.driver_version &&
+               api_version == rhs.api_version && std::memcmp(pipeline_cache_uuid, rhs.pipeline_cache_uuid, VK_UUID_SIZE) == 0;
+    }
+    size_t hash() const {
+        hash_util::HashCombiner hc;
+        hc << vendor_id << device_id << driver_version << api_version;
+        hc.Combine(std::begin(pipeline_cache_uuid), std::end(pipeline_cache_uuid));
+        return hc.Value();
+    }
+};
+
+static std::shared_ptr<const PhysicalDeviceInfo> QueryPhysicalDeviceInfo(VkPhysicalDevice physical_device,
+                                                                         const VkPhysicalDeviceProperties &properties) {
+    auto info = std::make_shared<PhysicalDeviceInfo>();
+    info->properties = properties;
+    DispatchGetPhysicalDeviceMemoryProperties(physical_device, &info->memory_properties);
+
+    uint32_t count = 0;
+    DispatchEnumerateDeviceExtensionProperties(physical_device, nullptr, &count, nullptr);
+    info->extensions.resize(count);
+    DispatchEnumerateDeviceExtensionProperties(physical_device, nullptr, &count, info->extensions.data());
+    info->extensions.resize(count);
+
+    count = 0;
+    DispatchGetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+    info->queue_family_properties.resize(count);
+    DispatchGetPhysicalDeviceQueueFamilyProperties(physical_device, &count, info->queue_family_properties.data());
+    return info;
+}
+
+std::shared_ptr<const PhysicalDeviceInfo> GetPhysicalDeviceInfo(VkPhysicalDevice physical_device) {
+    // Never emptied, there is one entry per device and driver the process has seen
+    static std::mutex lock;
+    static vvl::unordered_map<PhysicalDeviceKey, std::shared_ptr<const PhysicalDeviceInfo>,
+                              hash_util::HasHashMember<PhysicalDeviceKey>>
+        cache;
+
+    VkPhysicalDeviceProperties properties;
+    DispatchGetPhysicalDeviceProperties(physical_device, &properties);
+    const PhysicalDeviceKey key(properties);
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            return it->second;
+        }
+    }
+    // Queried without the lock, if two threads miss at the same time the first one in is kept, the results are the same
+    auto info = QueryPhysicalDeviceInfo(physical_device, properties);
+    std::lock_guard<std::mutex> guard(lock);
+    return cache.emplace(key, std::move(info)).first->second;
+}
+
+}  // namespace vvl
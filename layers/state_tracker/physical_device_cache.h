@@ -0,0 +1,41 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <vulkan/vulkan.h>
+
+namespace vvl {
+
+// The queries the layer makes of a physical device for every instance and device created on it. Their results can't change
+// while the same driver runs the same device, so they are made once for the process and shared, immutable, by all the
+// instances and devices. Apps and tools probing the devices repeatedly then don't query them again each time.
+struct PhysicalDeviceInfo {
+    VkPhysicalDeviceProperties properties;
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    std::vector<VkExtensionProperties> extensions;
+    std::vector<VkQueueFamilyProperties> queue_family_properties;
+};
+
+// The cache is keyed by the vendor, device, driver version and pipeline cache UUID of VkPhysicalDeviceProperties, the only
+// identity of the device and its driver that doesn't need Vulkan 1.1. A handle is not a key, a new instance can reuse the
+// handle of a destroyed one for another device. So a lookup costs a vkGetPhysicalDeviceProperties, the other queries are only
+// made the first time a device is seen.
+std::shared_ptr<const PhysicalDeviceInfo> GetPhysicalDeviceInfo(VkPhysicalDevice physical_device);
+
+}  // namespace vvl
@@ -824,6 +824,7 @@ void LastBound::UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorS
     }
     cb_state.AddChild(ds);
     push_descriptor_set = std::move(ds);
+    descriptor_generation++;
 }
 
 void LastBound::Reset() {
@@ -835,6 +836,33 @@ void LastBound::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    pipeline_generation++;
+    descriptor_generation++;
+    validated_generations = {};
+}
+
+void LastBound::UpdateValidatedGenerations(vvl::Func command) {
+    validated_generations.command = command;
+    validated_generations.pipeline = pipeline_generation;
+    validated_generations.descriptor = descriptor_generation;
+    validated_generations.dynamic_state = cb_state.dynamic_state_generation;
+    validated_generations.vertex_buffer = cb_state.vertex_buffer_generation;
+    validated_generations.render_state = cb_state.render_state_generation;
+    validated_generations.image_layout = cb_state.image_layout_change_count;
+}
+
+bool LastBound::IsDrawStateValidated(vvl::Func command) const {
+    // The VUIDs (and some of the checks) depend on which action command is used
+    return validated_generations.command == command && validated_generations.pipeline == pipeline_generation &&
+           validated_generations.dynamic_state == cb_state.dynamic_state_generation &&
+           validated_generations.vertex_buffer == cb_state.vertex_buffer_generation &&
+           validated_generations.render_state == cb_state.render_state_generation &&
+           validated_generations.image_layout == cb_state.image_layout_change_count;
+}
+
+bool LastBound::IsDescriptorBindingValidated(vvl::Func command) const {
+    return validated_generations.command == command && validated_generations.pipeline == pipeline_generation &&
+           validated_generations.descriptor == descriptor_generation;
 }
 
 bool LastBound::IsDepthTestEnable() const {
@@ -1212,14 +1240,15 @@ bool LastBound::IsBoundSetCompatible(uint32_t set, const vvl::PipelineLayout &pi
     if ((set >= per_set.size()) || (set >= pipeline_layout.set_compat_ids.size())) {
         return false;
     }
-    return (*(per_set[set].compat_id_for_set) == *(pipeline_layout.set_compat_ids[set]));
+    // The compat IDs are canonical, equal definitions are the same entry of the dictionary
+    return per_set[set].compat_id_for_set == pipeline_layout.set_compat_ids[set];
 }
 
 bool LastBound::IsBoundSetCompatible(uint32_t set, const vvl::ShaderObject &shader_object_state) const {
     if ((set >= per_set.size()) || (set >= shader_object_state.set_compat_ids.size())) {
         return false;
     }
-    return (*(per_set[set].compat_id_for_set) == *(shader_object_state.set_compat_ids[set]));
+    return per_set[set].compat_id_for_set == shader_object_state.set_compat_ids[set];
 };
 
 std::string LastBound::DescribeNonCompatibleSet(uint32_t set, const vvl::PipelineLayout &pipeline_layout) const {
@@ -686,8 +686,31 @@ struct LastBound {
 
     std::vector<PER_SET> per_set;
 
+    // Bumped each time the bound pipeline/shader objects or the bound descriptor sets change. Together with the command
+    // buffer wide generations they let ValidateActionState know nothing changed since the previous action command.
+    uint64_t pipeline_generation = 1;
+    uint64_t descriptor_generation = 1;
+
+    // Generations at the time of the last action command recorded for this bind point, 0 means nothing was recorded yet
+    struct ValidatedGenerations {
+        vvl::Func command = vvl::Func::Empty;
+        uint64_t pipeline = 0;
+        uint64_t descriptor = 0;
+        uint64_t dynamic_state = 0;
+        uint64_t vertex_buffer = 0;
+        uint64_t render_state = 0;
+        uint64_t image_layout = 0;
+    } validated_generations;
+
     void Reset();
 
+    // Called when an action command is recorded
+    void UpdateValidatedGenerations(vvl::Func command);
+    // True if the pipeline, dynamic state, vertex buffers and render pass instance are unchanged since the last action command
+    bool IsDrawStateValidated(vvl::Func command) const;
+    // True if the pipeline and the descriptor sets bound to it are unchanged since the last action command
+    bool IsDescriptorBindingValidated(vvl::Func command) const;
+
     void UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorSet> &&ds);
 
     // Dynamic State helpers that require both the Pipeline and CommandBuffer state are here
@@ -18,6 +18,12 @@
 #include "state_tracker/pipeline_sub_state.h"
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/shader_module.h"
+#include "utils/hash_vk_types.h"
+#include "utils/vk_layer_utils.h"
+#include "utils/vk_struct_compare.h"
+
+#include <type_traits>
+#include <vulkan/utility/vk_format_utils.h>
 
 VkPipelineLayoutCreateFlags PipelineSubState::PipelineLayoutCreateFlags() const {
     const auto layout_state = parent.PipelineLayoutState();
@@ -52,7 +58,22 @@ VertexInputState::VertexInputState(const vvl::Pipeline &p, const vku::safe_VkGra
             vertex_attribute_descriptions.emplace_back(vku::InitStruct<VkVertexInputAttributeDescription2EXT>(
                 nullptr, description->location, description->binding, description->format, description->offset));
         }
+
+        vertex_attribute_requirements.reserve(vertex_attribute_descriptions.size());
+        for (const auto &description : vertex_attribute_descriptions) {
+            vertex_attribute_requirements.emplace_back(GetAttributeRequirements(description));
+        }
+    }
+}
+
+VertexInputState::AttributeRequirements VertexInputState::GetAttributeRequirements(
+    const VkVertexInputAttributeDescription2EXT &description) {
+    const VkDeviceSize element_size = vkuFormatElementSize(description.format);
+    VkDeviceSize alignment = element_size;
+    if (vkuFormatElementIsTexel(description.format)) {
+        alignment = SafeDivision(alignment, vkuFormatComponentCount(description.format));
     }
+    return {alignment, description.offset + element_size};
 }
 
 PreRasterState::PreRasterState(const vvl::Pipeline &p, const ValidationStateTracker &state_data,
@@ -149,32 +170,81 @@ PreRasterState::PreRasterState(const vvl::Pipeline &p, const ValidationStateTrac
     }
 }
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+// Thousands of pipelines commonly share the same color blend, multisample and depth/stencil states, identical states are
+// stored once and shared between them. Like the pipeline layout dictionaries, the entries live for the whole process.
+// States with a pNext chain are not interned, each keeps its own copy.
+template <typename SafeState>
+struct PipelineStateHash {
+    size_t operator()(const SafeState &value) const {
+        using VkState = std::remove_cv_t<std::remove_pointer_t<decltype(value.ptr())>>;
+        return std::hash<VkState>()(*value.ptr());
+    }
+};
+struct ColorBlendStateEqual {
+    bool operator()(const vku::safe_VkPipelineColorBlendStateCreateInfo &lhs,
+                    const vku::safe_VkPipelineColorBlendStateCreateInfo &rhs) const {
+        return ComparePipelineColorBlendStateCreateInfo(*lhs.ptr(), *rhs.ptr());
+    }
+};
+struct MultisampleStateEqual {
+    bool operator()(const vku::safe_VkPipelineMultisampleStateCreateInfo &lhs,
+                    const vku::safe_VkPipelineMultisampleStateCreateInfo &rhs) const {
+        return ComparePipelineMultisampleStateCreateInfo(*lhs.ptr(), *rhs.ptr());
+    }
+};
+struct DepthStencilStateEqual {
+    bool operator()(const vku::safe_VkPipelineDepthStencilStateCreateInfo &lhs,
+                    const vku::safe_VkPipelineDepthStencilStateCreateInfo &rhs) const {
+        return ComparePipelineDepthStencilStateCreateInfo(*lhs.ptr(), *rhs.ptr());
+    }
+};
+
+using ColorBlendStateDict =
+    hash_util::Dictionary<vku::safe_VkPipelineColorBlendStateCreateInfo,
+                          PipelineStateHash<vku::safe_VkPipelineColorBlendStateCreateInfo>, ColorBlendStateEqual>;
+using MultisampleStateDict =
+    hash_util::Dictionary<vku::safe_VkPipelineMultisampleStateCreateInfo,
+                          PipelineStateHash<vku::safe_VkPipelineMultisampleStateCreateInfo>, MultisampleStateEqual>;
+using DepthStencilStateDict =
+    hash_util::Dictionary<vku::safe_VkPipelineDepthStencilStateCreateInfo,
+                          PipelineStateHash<vku::safe_VkPipelineDepthStencilStateCreateInfo>, DepthStencilStateEqual>;
+
+static ColorBlendStateDict color_blend_state_dict;
+static MultisampleStateDict multisample_state_dict;
+static DepthStencilStateDict depth_stencil_state_dict;
+
+// Source is either a safe struct or a pointer to the Vk struct, both construct a SafeState
+template <typename Dict, typename Source>
+static typename Dict::Id InternPipelineState(Dict &dict, const void *pNext, const Source &source) {
+    if (pNext) {
+        return std::make_shared<const typename Dict::Def>(source);
+    }
+    return dict.LookUp(source);
+}
+
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(cbs);
+    return InternPipelineState(color_blend_state_dict, cbs.pNext, cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const VkPipelineColorBlendStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+    return InternPipelineState(color_blend_state_dict, cbs.pNext, &cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(cbs);
+    return InternPipelineState(multisample_state_dict, cbs.pNext, cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const VkPipelineMultisampleStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&cbs);
+    return InternPipelineState(multisample_state_dict, cbs.pNext, &cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(cbs);
+    return InternPipelineState(depth_stencil_state_dict, cbs.pNext, cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const VkPipelineDepthStencilStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&cbs);
+    return InternPipelineState(depth_stencil_state_dict, cbs.pNext, &cbs);
 }
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
     const vku::safe_VkPipelineShaderStageCreateInfo &cbs) {
@@ -18,7 +18,9 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
 #include "state_tracker/state_object.h"
+#include "containers/range_vector.h"
 
 enum QueryState {
     QUERYSTATE_UNKNOWN,    // Initial state.
@@ -47,39 +49,54 @@ class QueryPool : public StateObject {
           perf_counter_queue_family_index(perf_queue_family_index),
           supported_video_profile(std::move(supp_video_profile)),
           video_encode_feedback_flags(enabled_video_encode_feedback_flags),
-          query_states_(pCreateInfo->queryCount) {
-        for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-            auto perf_size = n_perf_pass > 0 ? n_perf_pass : 1;
-            query_states_[i].reserve(perf_size);
-            for (uint32_t p = 0; p < perf_size; p++) {
-                query_states_[i].emplace_back(QUERYSTATE_UNKNOWN);
-            }
-        }
-    }
+          pass_count_(n_perf_pass > 0 ? n_perf_pass : 1),
+          query_states_((uint64_t(pCreateInfo->queryCount) * pass_count_ + kStatesPerWord - 1) / kStatesPerWord,
+                        StatePattern(QUERYSTATE_UNKNOWN)) {}
 
     VkQueryPool VkHandle() const { return handle_.Cast<VkQueryPool>(); }
 
-    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
+    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) { SetQueryStates(query, 1, perf_pass, state); }
+
+    // Resetting a query resets all its performance passes
+    void SetQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
         auto guard = WriteLock();
-        assert(query < query_states_.size());
+        assert(uint64_t(first_query) + query_count <= create_info.queryCount);
         assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
-        if (state == QUERYSTATE_RESET) {
-            for (auto &state : query_states_[query]) {
-                state = QUERYSTATE_RESET;
-            }
+        const uint32_t end_query = uint32_t(std::min(uint64_t(first_query) + query_count, uint64_t(create_info.queryCount)));
+        if (first_query >= end_query) return;
+        if (state == QUERYSTATE_RESET || pass_count_ == 1) {
+            // The states of all the passes of the range are contiguous
+            SetStates(uint64_t(first_query) * pass_count_, uint64_t(end_query) * pass_count_, state);
         } else {
-            query_states_[query][perf_pass] = state;
+            for (uint32_t query = first_query; query < end_query; ++query) {
+                const uint64_t index = uint64_t(query) * pass_count_ + perf_pass;
+                SetStates(index, index + 1, state);
+            }
         }
     }
+
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const {
         auto guard = ReadLock();
         // this method can get called with invalid arguments during validation
-        if (query < query_states_.size() && ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
-            return query_states_[query][perf_pass];
+        if (query < create_info.queryCount &&
+            ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
+            return GetState(uint64_t(query) * pass_count_ + perf_pass);
         }
         return QUERYSTATE_UNKNOWN;
     }
 
+    // True if the perf_pass of all the queries of the range is in the given state
+    bool AreQueriesInState(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) const {
+        auto guard = ReadLock();
+        const uint32_t end_query = uint32_t(std::min(uint64_t(first_query) + query_count, uint64_t(create_info.queryCount)));
+        for (uint32_t query = first_query; query < end_query; ++query) {
+            if (GetState(uint64_t(query) * pass_count_ + perf_pass) != state) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     const vku::safe_VkQueryPoolCreateInfo safe_create_info;
     const VkQueryPoolCreateInfo &create_info;
 
@@ -96,7 +113,33 @@ class QueryPool : public StateObject {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
+    // The states of all the performance passes of all the queries, query major, packed kStateBits per state. Large pools of
+    // timestamp queries take 8 bytes for 16 queries, and ranges of queries are reset or made available a word at a time.
+    static constexpr uint32_t kStateBits = 4;
+    static constexpr uint32_t kStatesPerWord = 64 / kStateBits;
+    static constexpr uint64_t kStateMask = (uint64_t(1) << kStateBits) - 1;
+    static constexpr uint64_t StatePattern(QueryState state) { return uint64_t(state) * (~uint64_t(0) / kStateMask); }
+
+    QueryState GetState(uint64_t index) const {
+        const uint32_t shift = uint32_t(index % kStatesPerWord) * kStateBits;
+        return QueryState((query_states_[index / kStatesPerWord] >> shift) & kStateMask);
+    }
+    // Sets the states of [begin, end)
+    void SetStates(uint64_t begin, uint64_t end, QueryState state) {
+        const uint64_t pattern = StatePattern(state);
+        while (begin < end) {
+            const uint64_t word = begin / kStatesPerWord;
+            const uint64_t word_end = std::min(end, (word + 1) * kStatesPerWord);
+            const uint32_t low_bit = uint32_t(begin % kStatesPerWord) * kStateBits;
+            const uint32_t bit_count = uint32_t(word_end - begin) * kStateBits;
+            const uint64_t mask = (bit_count == 64 ? ~uint64_t(0) : ((uint64_t(1) << bit_count) - 1)) << low_bit;
+            query_states_[word] = (query_states_[word] & ~mask) | (pattern & mask);
+            begin = word_end;
+        }
+    }
+
+    const uint32_t pass_count_;
+    std::vector<uint64_t> query_states_;
     mutable std::shared_mutex lock_;
 };
 }  // namespace vvl
@@ -154,7 +197,51 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.slot == query2.slot) && (query1.perf_pass == query2.perf_pass));
 }
 
-typedef std::map<QueryObject, QueryState> QueryMap;
+// Query states set by the command buffers of a submission, as ranges of queries of each query pool and performance pass.
+// Resetting or ending a range of queries is a single range update.
+class QueryMap {
+  public:
+    using QueryRangeMap = sparse_container::range_map<uint32_t, QueryState>;
+
+    void SetQueryState(const QueryObject &query_obj, QueryState state) {
+        SetQueryStates(query_obj.pool, query_obj.slot, 1, query_obj.perf_pass, state);
+    }
+    void SetQueryStates(VkQueryPool pool, uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
+        if (query_count == 0) return;
+        auto &pass_ranges = pools_[pool];
+        if (pass_ranges.size() <= perf_pass) {
+            pass_ranges.resize(perf_pass + 1);
+        }
+        pass_ranges[perf_pass].overwrite_range(
+            std::make_pair(QueryRangeMap::key_type(first_query, first_query + query_count), state));
+    }
+
+    // QUERYSTATE_UNKNOWN if the query was not updated
+    QueryState GetQueryState(VkQueryPool pool, uint32_t query, uint32_t perf_pass) const {
+        auto pool_it = pools_.find(pool);
+        if (pool_it == pools_.end() || pool_it->second.size() <= perf_pass) {
+            return QUERYSTATE_UNKNOWN;
+        }
+        const QueryRangeMap &ranges = pool_it->second[perf_pass];
+        auto it = ranges.find(query);
+        return it != ranges.end() ? it->second : QUERYSTATE_UNKNOWN;
+    }
+
+    // func(VkQueryPool pool, uint32_t perf_pass, const QueryRangeMap::key_type &queries, QueryState state)
+    template <typename Func>
+    void ForEachRange(Func &&func) const {
+        for (const auto &[pool, pass_ranges] : pools_) {
+            for (uint32_t perf_pass = 0; perf_pass < pass_ranges.size(); ++perf_pass) {
+                for (const auto &[queries, state] : pass_ranges[perf_pass]) {
+                    func(pool, perf_pass, queries, state);
+                }
+            }
+        }
+    }
+
+  private:
+    vvl::unordered_map<VkQueryPool, std::vector<QueryRangeMap>> pools_;
+};
 
 enum QueryResultType {
     QUERYRESULT_UNKNOWN,
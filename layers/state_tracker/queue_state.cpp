@@ -135,6 +135,15 @@ void vvl::Queue::NotifyAndWait(const Location &loc, uint64_t until_seq) {
     Wait(loc, until_seq);
 }
 
+void vvl::Queue::DeferValidation(std::function<void()> &&task) {
+    auto guard = Lock();
+    deferred_validation_.emplace_back(std::move(task));
+    if (!thread_) {
+        thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
+    }
+    cond_.notify_one();
+}
+
 void vvl::Queue::Destroy() {
     std::unique_ptr<std::thread> dead_thread;
     {
@@ -157,31 +166,37 @@ void vvl::Queue::PostSubmit() {
     }
 }
 
-vvl::QueueSubmission *vvl::Queue::NextSubmission() {
-    QueueSubmission *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
-    // about locking.
+void vvl::Queue::NextSubmissions(std::vector<QueueSubmission *> &ready, std::vector<std::function<void()>> &deferred_validation,
+                                 bool &exit) {
+    // Find the submissions that are ready so that the thread function doesn't need to worry about locking.
     auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
+    auto submission_ready = [this]() { return !submissions_.empty() && request_seq_ >= submissions_.front().seq; };
+    while (!exit_thread_ && deferred_validation_.empty() && !submission_ready()) {
         // The queue thread must wait forever if nothing is happening, until we tell it to exit
         cond_.wait(guard);
     }
+    // Deferred validation is always handed out, even when exiting, so no reported error gets lost
+    deferred_validation.swap(deferred_validation_);
+    exit = exit_thread_;
     if (!exit_thread_) {
-        result = &submissions_.front();
-        // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
+        // NOTE: the submissions must remain on the dequeue until we're done processing them so that
+        // anyone waiting for them can find the correct waiter. Only this thread pops them, and the deque never moves
+        // its elements, so the pointers stay valid without the lock.
+        for (auto &submission : submissions_) {
+            if (submission.seq > request_seq_) {
+                break;
+            }
+            ready.emplace_back(&submission);
+        }
     }
-    return result;
 }
 
 void vvl::Queue::Retire(QueueSubmission &submission) {
-    auto is_query_updated_after = [this](const QueryObject &query_object) {
+    auto is_query_updated_after = [this, retired_seq = submission.seq](const QueryObject &query_object) {
         auto guard = this->Lock();
-        bool first = true;
         for (const auto &submission : this->submissions_) {
-            // The current submission is still on the deque, so skip it
-            if (first) {
-                first = false;
+            // The current submission and the ones retired before it in the same batch are still on the deque, so skip them
+            if (submission.seq <= retired_seq) {
                 continue;
             }
             for (const auto &next_cb_state : submission.cbs) {
@@ -216,24 +231,38 @@ void vvl::Queue::Retire(QueueSubmission &submission) {
 }
 
 void vvl::Queue::ThreadFunc() {
-    QueueSubmission *submission = nullptr;
+    std::vector<QueueSubmission *> ready;
+    std::vector<std::function<void()>> deferred_validation;
+    bool exit = false;
 
-    // Roll this queue forward, one submission at a time.
+    // Roll this queue forward, all the submissions that are known to be done at once.
     while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
+        ready.clear();
+        NextSubmissions(ready, deferred_validation, exit);
+        // Not held while waiting for the next submission, that would stop destroyed objects from ever being released
+        const auto borrow_guard = dev_data_.BorrowGuard();
+        // Validation deferred from vkQueueSubmit has to see the state from before its submission is retired
+        for (auto &task : deferred_validation) {
+            task();
+        }
+        deferred_validation.clear();
+        if (exit) {
             break;
         }
-        Retire(*submission);
-        // wake up anyone waiting for this submission to be retired
+        if (ready.empty()) {
+            continue;
+        }
+        for (QueueSubmission *submission : ready) {
+            Retire(*submission);
+            // wake up anyone waiting for this submission to be retired, it doesn't wait for the rest of the batch.
+            // Nobody else touches the promise, only the waiter.
+            submission->completed.set_value();
+        }
         {
-            std::promise<void> completed;
-            {
-                auto guard = Lock();
-                completed = std::move(submission->completed);
+            auto guard = Lock();
+            for (size_t i = 0; i < ready.size(); ++i) {
                 submissions_.pop_front();
             }
-            completed.set_value();
         }
     }
 }
@@ -22,6 +22,7 @@
 #include "state_tracker/semaphore_state.h"
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <future>
 #include <thread>
 #include <vector>
@@ -115,6 +116,11 @@ class Queue : public StateObject {
     // Helper that combines Notify and Wait
     void NotifyAndWait(const Location &loc, uint64_t until_seq = kU64Max);
 
+    // Run submit time validation that does not have to affect the return value of vkQueueSubmit on the queue thread.
+    // Tasks run in the order they were added and before any later submission is retired. Used when the
+    // async_submit_validation setting is enabled.
+    void DeferValidation(std::function<void()> &&task);
+
   public:
     // Queue family index. As queueFamilyIndex parameter in vkGetDeviceQueue.
     const uint32_t queue_family_index;
@@ -127,11 +133,13 @@ class Queue : public StateObject {
 
     // Track command buffer label stack accross all command buffers submitted to this queue.
     // Access to this variable relies on external queue synchronization.
-    std::vector<std::string> cmdbuf_label_stack;
+    // The labels are vvl::CommandBuffer::LabelId, the ids of the interned label names.
+    std::vector<uint32_t> cmdbuf_label_stack;
 
     // Track the last closed label. It is used in the error messages to help locate unbalanced vkCmdEndDebugUtilsLabelEXT command.
     // Access to this variable relies on external queue synchronization.
-    std::string last_closed_cmdbuf_label;
+    // The id of the empty name when no label was closed yet.
+    uint32_t last_closed_cmdbuf_label = 0;
 
     // Stop per-queue label tracking after the first label mismatch error.
     // Access to this variable relies on external queue synchronization.
@@ -146,7 +154,9 @@ class Queue : public StateObject {
   private:
     using LockGuard = std::unique_lock<std::mutex>;
     void ThreadFunc();
-    QueueSubmission *NextSubmission();
+    // Hands out every submission that is ready to be retired, in order
+    void NextSubmissions(std::vector<QueueSubmission *> &ready, std::vector<std::function<void()>> &deferred_validation,
+                         bool &exit);
     LockGuard Lock() const { return LockGuard(lock_); }
 
     ValidationStateTracker &dev_data_;
@@ -157,6 +167,7 @@ class Queue : public StateObject {
     std::deque<QueueSubmission> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
+    std::vector<std::function<void()>> deferred_validation_;
     bool exit_thread_{false};
     mutable std::mutex lock_;
     // condition to wake up the queue's thread
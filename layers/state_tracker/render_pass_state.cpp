@@ -20,6 +20,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "utils/convert_utils.h"
 #include "state_tracker/image_state.h"
+#include "utils/hash_util.h"
 
 static const VkImageLayout kInvalidLayout = VK_IMAGE_LAYOUT_MAX_ENUM;
 
@@ -61,12 +62,15 @@ static void RecordRenderPassDAG(const VkRenderPassCreateInfo2 *pCreateInfo, vvl:
     subpass_to_node.resize(pCreateInfo->subpassCount);
     auto &self_dependencies = const_cast<vvl::RenderPass::SelfDepVec &>(render_pass->self_dependencies);
     self_dependencies.resize(pCreateInfo->subpassCount);
+    auto &self_dependency_summaries = const_cast<vvl::RenderPass::SelfDepSummaryVec &>(render_pass->self_dependency_summaries);
+    self_dependency_summaries.resize(pCreateInfo->subpassCount);
     auto &subpass_dependencies = const_cast<vvl::RenderPass::SubpassGraphVec &>(render_pass->subpass_dependencies);
     subpass_dependencies.resize(pCreateInfo->subpassCount);
 
     for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
         subpass_to_node[i].pass = i;
         self_dependencies[i].clear();
+        self_dependency_summaries[i] = {};
         subpass_dependencies[i].pass = i;
     }
     for (uint32_t i = 0; i < pCreateInfo->dependencyCount; ++i) {
@@ -76,6 +80,27 @@ static void RecordRenderPassDAG(const VkRenderPassCreateInfo2 *pCreateInfo, vvl:
         if ((dependency.srcSubpass != VK_SUBPASS_EXTERNAL) && (dependency.dstSubpass != VK_SUBPASS_EXTERNAL)) {
             if (dependency.srcSubpass == dependency.dstSubpass) {
                 self_dependencies[dependency.srcSubpass].push_back(i);
+
+                vvl::RenderPass::SelfDependency self_dependency{i,
+                                                                dependency.srcStageMask,
+                                                                dependency.dstStageMask,
+                                                                dependency.srcAccessMask,
+                                                                dependency.dstAccessMask,
+                                                                dependency.dependencyFlags};
+                // "If a VkMemoryBarrier2 is included in the pNext chain, srcStageMask, dstStageMask,
+                // srcAccessMask, and dstAccessMask parameters are ignored."
+                if (const auto barrier = vku::FindStructInPNextChain<VkMemoryBarrier2>(dependency.pNext)) {
+                    self_dependency.src_stage_mask = barrier->srcStageMask;
+                    self_dependency.dst_stage_mask = barrier->dstStageMask;
+                    self_dependency.src_access_mask = barrier->srcAccessMask;
+                    self_dependency.dst_access_mask = barrier->dstAccessMask;
+                }
+                auto &summary = self_dependency_summaries[dependency.srcSubpass];
+                summary.src_stage_mask |= self_dependency.src_stage_mask;
+                summary.dst_stage_mask |= self_dependency.dst_stage_mask;
+                summary.src_access_mask |= self_dependency.src_access_mask;
+                summary.dst_access_mask |= self_dependency.dst_access_mask;
+                summary.dependencies.emplace_back(self_dependency);
             } else {
                 subpass_to_node[dependency.dstSubpass].prev.push_back(dependency.srcSubpass);
                 subpass_to_node[dependency.srcSubpass].next.push_back(dependency.dstSubpass);
@@ -267,6 +292,83 @@ static void InitRenderPassState(vvl::RenderPass *render_pass) {
     attachment_tracker.FinalTransitions();
 }
 
+// Follows CoreChecks::ValidateRenderPassCompatibility, anything it compares must be part of the fingerprint.
+// Attachment references are hashed by the format, samples and flags they point to, not by index, and a list that only
+// differs by trailing VK_ATTACHMENT_UNUSED entries is compatible, so those are not hashed.
+static uint64_t ComputeCompatibilityFingerprint(const vku::safe_VkRenderPassCreateInfo2 &create_info) {
+    hash_util::HashCombiner hc;
+    auto hash_attachment = [&create_info, &hc](uint32_t attachment) {
+        if (attachment >= create_info.attachmentCount) {
+            hc << VK_ATTACHMENT_UNUSED;
+            return;
+        }
+        const VkAttachmentDescription2 &description = create_info.pAttachments[attachment];
+        hc << description.format << description.samples << description.flags;
+    };
+    auto hash_references = [&create_info, &hc, &hash_attachment](const vku::safe_VkAttachmentReference2 *references,
+                                                                   uint32_t count) {
+        uint32_t used_count = 0;
+        for (uint32_t i = 0; references && i < count; ++i) {
+            if (references[i].attachment < create_info.attachmentCount) {
+                used_count = i + 1;
+            }
+        }
+        hc << used_count;
+        for (uint32_t i = 0; i < used_count; ++i) {
+            hash_attachment(references[i].attachment);
+        }
+    };
+
+    hc << create_info.flags << create_info.subpassCount;
+    for (uint32_t i = 0; i < create_info.subpassCount; ++i) {
+        const auto &subpass = create_info.pSubpasses[i];
+        hash_references(subpass.pInputAttachments, subpass.inputAttachmentCount);
+        hash_references(subpass.pColorAttachments, subpass.colorAttachmentCount);
+        // Resolve attachments only matter with more than one subpass
+        if (create_info.subpassCount > 1) {
+            hash_references(subpass.pResolveAttachments, subpass.colorAttachmentCount);
+        }
+        hash_attachment(subpass.pDepthStencilAttachment ? subpass.pDepthStencilAttachment->attachment : VK_ATTACHMENT_UNUSED);
+        hc << subpass.flags << subpass.viewMask;
+        if (const auto fsr = vku::FindStructInPNextChain<VkFragmentShadingRateAttachmentInfoKHR>(subpass.pNext)) {
+            hc << true << fsr->shadingRateAttachmentTexelSize.width << fsr->shadingRateAttachmentTexelSize.height;
+        } else {
+            hc << false;
+        }
+    }
+
+    // Same as the compatibility check, a VkMemoryBarrier2 in the render pass pNext replaces the masks of every dependency
+    const auto barrier = vku::FindStructInPNextChain<VkMemoryBarrier2KHR>(create_info.pNext);
+    hc << create_info.dependencyCount;
+    for (uint32_t i = 0; i < create_info.dependencyCount; ++i) {
+        const auto &dependency = create_info.pDependencies[i];
+        hc << dependency.srcSubpass << dependency.dstSubpass << dependency.dependencyFlags << dependency.viewOffset;
+        if (barrier) {
+            hc << barrier->srcStageMask << barrier->dstStageMask << barrier->srcAccessMask << barrier->dstAccessMask;
+        } else {
+            hc << static_cast<VkPipelineStageFlags2>(dependency.srcStageMask)
+               << static_cast<VkPipelineStageFlags2>(dependency.dstStageMask)
+               << static_cast<VkAccessFlags2>(dependency.srcAccessMask) << static_cast<VkAccessFlags2>(dependency.dstAccessMask);
+        }
+    }
+
+    hc << create_info.correlatedViewMaskCount;
+    for (uint32_t i = 0; i < create_info.correlatedViewMaskCount; ++i) {
+        hc << create_info.pCorrelatedViewMasks[i];
+    }
+
+    if (const auto fdm = vku::FindStructInPNextChain<VkRenderPassFragmentDensityMapCreateInfoEXT>(create_info.pNext)) {
+        hc << true;
+        hash_attachment(fdm->fragmentDensityMapAttachment.attachment);
+    } else {
+        hc << false;
+    }
+
+    // Zero is reserved for "no fingerprint"
+    const uint64_t fingerprint = hc.Value();
+    return fingerprint ? fingerprint : 1;
+}
+
 namespace vvl {
 
 RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo)
@@ -274,7 +376,8 @@ RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCrea
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
-      create_info(pCreateInfo) {
+      create_info(pCreateInfo),
+      compatibility_fingerprint(ComputeCompatibilityFingerprint(create_info)) {
     InitRenderPassState(this);
 }
 
@@ -288,7 +391,8 @@ RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreat
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
-      create_info(ConvertCreateInfo(*pCreateInfo)) {
+      create_info(ConvertCreateInfo(*pCreateInfo)),
+      compatibility_fingerprint(ComputeCompatibilityFingerprint(create_info)) {
     InitRenderPassState(this);
 }
 
@@ -421,6 +525,48 @@ void Framebuffer::LinkChildNodes() {
     }
 }
 
+template <typename T>
+static bool SameOwner(const std::weak_ptr<T> &cached, const std::shared_ptr<T> &current) {
+    return !cached.owner_before(current) && !current.owner_before(cached);
+}
+
+bool ImagelessAttachmentCache::Contains(const std::shared_ptr<const RenderPass> &rp_state,
+                                        const std::shared_ptr<const ImageView> *views, uint32_t view_count,
+                                        bool render_to_single_sampled) const {
+    ReadLockGuard guard(lock_);
+    for (const Entry &entry : entries_) {
+        if (entry.render_to_single_sampled != render_to_single_sampled || entry.views.size() != view_count ||
+            !SameOwner(entry.rp_state, rp_state)) {
+            continue;
+        }
+        uint32_t i = 0;
+        while (i < view_count && SameOwner(entry.views[i], views[i])) {
+            ++i;
+        }
+        if (i == view_count) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ImagelessAttachmentCache::Insert(const std::shared_ptr<const RenderPass> &rp_state,
+                                      const std::shared_ptr<const ImageView> *views, uint32_t view_count,
+                                      bool render_to_single_sampled) const {
+    Entry entry;
+    entry.rp_state = rp_state;
+    entry.views.assign(views, views + view_count);
+    entry.render_to_single_sampled = render_to_single_sampled;
+
+    WriteLockGuard guard(lock_);
+    if (entries_.size() < kMaxEntries) {
+        entries_.emplace_back(std::move(entry));
+    } else {
+        entries_[next_entry_] = std::move(entry);
+        next_entry_ = (next_entry_ + 1) % kMaxEntries;
+    }
+}
+
 void Framebuffer::Destroy() {
     for (auto &view : attachments_view_state) {
         view->RemoveParent(this);
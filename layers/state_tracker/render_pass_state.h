@@ -78,9 +78,32 @@ class RenderPass : public StateObject {
     const vku::safe_VkPipelineRenderingCreateInfo dynamic_pipeline_rendering_create_info;
     const vku::safe_VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info;
     const vku::safe_VkRenderPassCreateInfo2 create_info;
+    // Hash of everything render pass compatibility looks at, two render passes with the same (non zero) fingerprint are
+    // compatible. Zero for dynamic rendering.
+    const uint64_t compatibility_fingerprint{0};
     using SubpassVec = std::vector<uint32_t>;
     using SelfDepVec = std::vector<SubpassVec>;
     const std::vector<SubpassVec> self_dependencies;
+    // Scopes of a self-dependency, taken from the VkMemoryBarrier2 of its pNext chain when there is one
+    struct SelfDependency {
+        uint32_t dependency_index;
+        VkPipelineStageFlags2 src_stage_mask;
+        VkPipelineStageFlags2 dst_stage_mask;
+        VkAccessFlags2 src_access_mask;
+        VkAccessFlags2 dst_access_mask;
+        VkDependencyFlags dependency_flags;
+    };
+    // What the pipeline barriers recorded inside a subpass are checked against. The unions turn down a barrier that no
+    // self-dependency can contain without looking at each of them.
+    struct SelfDependencySummary {
+        std::vector<SelfDependency> dependencies;
+        VkPipelineStageFlags2 src_stage_mask = VK_PIPELINE_STAGE_2_NONE;
+        VkPipelineStageFlags2 dst_stage_mask = VK_PIPELINE_STAGE_2_NONE;
+        VkAccessFlags2 src_access_mask = VK_ACCESS_2_NONE;
+        VkAccessFlags2 dst_access_mask = VK_ACCESS_2_NONE;
+    };
+    using SelfDepSummaryVec = std::vector<SelfDependencySummary>;
+    const SelfDepSummaryVec self_dependency_summaries;
     using DAGNodeVec = std::vector<DAGNode>;
     const DAGNodeVec subpass_to_node;
     using FirstReadMap = vvl::unordered_map<uint32_t, bool>;
@@ -115,12 +138,37 @@ class RenderPass : public StateObject {
     const VkMultisampledRenderToSingleSampledInfoEXT *GetMSRTSSInfo(uint32_t subpass) const;
 };
 
+// The VkRenderPassAttachmentBeginInfo of the imageless framebuffer begins that passed validation, so beginning again with the
+// same views (the common case across frames) only needs a lookup. The states are held weakly and compared by identity, a
+// destroyed object, or a new one reusing its handle, never matches.
+class ImagelessAttachmentCache {
+  public:
+    bool Contains(const std::shared_ptr<const RenderPass> &rp_state, const std::shared_ptr<const ImageView> *views,
+                  uint32_t view_count, bool render_to_single_sampled) const;
+    void Insert(const std::shared_ptr<const RenderPass> &rp_state, const std::shared_ptr<const ImageView> *views,
+                uint32_t view_count, bool render_to_single_sampled) const;
+
+  private:
+    struct Entry {
+        std::weak_ptr<const RenderPass> rp_state;
+        std::vector<std::weak_ptr<const ImageView>> views;
+        bool render_to_single_sampled = false;
+    };
+    // Enough for the views of a swapchain rotation
+    static constexpr size_t kMaxEntries = 4;
+
+    mutable std::shared_mutex lock_;
+    mutable std::vector<Entry> entries_;
+    mutable size_t next_entry_ = 0;
+};
+
 class Framebuffer : public StateObject {
   public:
     const vku::safe_VkFramebufferCreateInfo safe_create_info;
     const VkFramebufferCreateInfo &create_info;
     std::shared_ptr<const RenderPass> rp_state;
     std::vector<std::shared_ptr<vvl::ImageView>> attachments_view_state;
+    ImagelessAttachmentCache imageless_attachment_cache;
 
     Framebuffer(VkFramebuffer handle, const VkFramebufferCreateInfo *pCreateInfo, std::shared_ptr<RenderPass> &&rpstate,
                 std::vector<std::shared_ptr<vvl::ImageView>> &&attachments);
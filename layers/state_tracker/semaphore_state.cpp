@@ -42,6 +42,7 @@ vvl::Semaphore::Semaphore(ValidationStateTracker &dev, VkSemaphore handle, const
 #endif  // VK_USE_PLATFORM_METAL_EXT
       completed_{type == VK_SEMAPHORE_TYPE_TIMELINE ? kSignal : kNone, SubmissionReference{},
                  type_create_info ? type_create_info->initialValue : 0},
+      completed_payload_(completed_.payload),
       next_payload_(completed_.payload + 1),
       dev_data_(dev) {
 }
@@ -60,6 +61,7 @@ void vvl::Semaphore::EnqueueSignal(const SubmissionReference &signal_submit, uin
     assert(timeline_.find(payload) == timeline_.end() || !timeline_.find(payload)->second.signal_submit.has_value());
 
     timeline_[payload].signal_submit.emplace(signal_submit);
+    pending_signals_.insert(payload);
 }
 
 void vvl::Semaphore::EnqueueWait(const SubmissionReference &wait_submit, uint64_t &payload) {
@@ -69,7 +71,7 @@ void vvl::Semaphore::EnqueueWait(const SubmissionReference &wait_submit, uint64_
         // Otherwise timeline should contain a binary signal.
         if (timeline_.empty()) {
             assert(payload == 0);
-            completed_ = SemOp(kWait, wait_submit, 0);
+            SetCompleted(SemOp(kWait, wait_submit, 0));
             return;
         }
         assert(timeline_.rbegin()->second.HasSignaler());
@@ -118,6 +120,64 @@ std::optional<vvl::Semaphore::SemOp> vvl::Semaphore::LastOp(const std::function<
     return result;
 }
 
+vvl::Semaphore::SemOp vvl::Semaphore::FirstOp(uint64_t payload, const TimePoint &timepoint) {
+    if (!timepoint.wait_submits.empty()) {
+        return SemOp(kWait, timepoint.wait_submits[0], payload);
+    }
+    if (timepoint.signal_submit) {
+        return SemOp(kSignal, *timepoint.signal_submit, payload);
+    }
+    assert(timepoint.acquire_command);
+    return SemOp(*timepoint.acquire_command, payload);
+}
+
+std::optional<vvl::Semaphore::SemOp> vvl::Semaphore::ConflictingSignal(uint64_t payload) const {
+    auto guard = ReadLock();
+    if (pending_signals_.count(payload)) {
+        return SemOp(kSignal, *timeline_.at(payload).signal_submit, payload);
+    }
+    if (completed_.op_type == kSignal && payload <= completed_.payload) {
+        return completed_;
+    }
+    return {};
+}
+
+std::optional<vvl::Semaphore::SemOp> vvl::Semaphore::LastPendingSignalAtOrBelow(uint64_t payload) const {
+    auto guard = ReadLock();
+    auto it = pending_signals_.upper_bound(payload);
+    if (it == pending_signals_.begin()) {
+        return {};
+    }
+    --it;
+    return SemOp(kSignal, *timeline_.at(*it).signal_submit, *it);
+}
+
+std::optional<vvl::Semaphore::SemOp> vvl::Semaphore::LastOpOutsideRange(uint64_t payload, uint64_t max_diff) const {
+    auto out_of_range = [payload, max_diff](uint64_t other) {
+        return (other > payload ? other - payload : payload - other) > max_diff;
+    };
+    auto guard = ReadLock();
+    if (!timeline_.empty()) {
+        // Above payload the difference only grows with the pending payload, so the highest one is the only candidate.
+        // Otherwise all the higher pending payloads are in range, look for the highest one below the range.
+        const auto &[last_payload, last_timepoint] = *timeline_.rbegin();
+        if (out_of_range(last_payload)) {
+            return FirstOp(last_payload, last_timepoint);
+        }
+        if (payload > max_diff) {
+            auto it = timeline_.lower_bound(payload - max_diff);
+            if (it != timeline_.begin()) {
+                --it;
+                return FirstOp(it->first, it->second);
+            }
+        }
+    }
+    if (out_of_range(completed_.payload)) {
+        return completed_;
+    }
+    return {};
+}
+
 std::optional<vvl::SubmissionReference> vvl::Semaphore::GetPendingBinarySignalSubmission() const {
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
     auto guard = ReadLock();
@@ -154,11 +214,6 @@ std::optional<vvl::SubmissionReference> vvl::Semaphore::GetPendingBinaryWaitSubm
     return timepoint.wait_submits[0];
 }
 
-uint64_t vvl::Semaphore::CurrentPayload() const {
-    auto guard = ReadLock();
-    return completed_.payload;
-}
-
 bool vvl::Semaphore::CanBinaryBeSignaled() const {
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
     auto guard = ReadLock();
@@ -223,16 +278,16 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
 
     if (retire_here) {
         if (timepoint.signal_submit) {
-            completed_ = SemOp(kSignal, *timepoint.signal_submit, payload);
+            SetCompleted(SemOp(kSignal, *timepoint.signal_submit, payload));
         }
         if (timepoint.acquire_command) {
-            completed_ = SemOp(*timepoint.acquire_command, payload);
+            SetCompleted(SemOp(*timepoint.acquire_command, payload));
         }
         for (auto &wait_submit : timepoint.wait_submits) {
-            completed_ = SemOp(kWait, wait_submit, payload);
+            SetCompleted(SemOp(kWait, wait_submit, payload));
         }
         timepoint.completed.set_value();
-        timeline_.erase(timeline_.begin());
+        EraseTimePoint(timeline_.begin());
         if (scope_ == kExternalTemporary) {
             scope_ = kInternal;
             imported_handle_type_.reset();
@@ -423,7 +478,8 @@ bool SemaphoreSubmitState::CannotSignalBinary(const vvl::Semaphore &semaphore_st
 
 bool SemaphoreSubmitState::CheckSemaphoreValue(
     const vvl::Semaphore &semaphore_state, std::string &where, uint64_t &bad_value,
-    std::function<bool(const vvl::Semaphore::OpType, uint64_t, bool is_pending)> compare_func) {
+    std::function<bool(const vvl::Semaphore::OpType, uint64_t, bool is_pending)> compare_func,
+    const std::function<std::optional<vvl::Semaphore::SemOp>()> &find_pending) {
     auto current_signal = timeline_signals.find(semaphore_state.VkHandle());
     // NOTE: for purposes of validation, duplicate operations in the same submission are not yet pending.
     if (current_signal != timeline_signals.end()) {
@@ -441,7 +497,7 @@ bool SemaphoreSubmitState::CheckSemaphoreValue(
             return true;
         }
     }
-    auto pending = semaphore_state.LastOp(compare_func);
+    auto pending = find_pending();
     if (pending) {
         if (pending->payload == semaphore_state.CurrentPayload()) {
             where = "current";
@@ -19,9 +19,11 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
+#include <atomic>
 #include <future>
 #include <map>
 #include <mutex>
+#include <set>
 #include "containers/custom_containers.h"
 #include "error_message/error_location.h"
 
@@ -94,15 +96,25 @@ class Semaphore : public RefcountedStateObject {
     std::optional<SemOp> LastOp(
         const std::function<bool(OpType op_type, uint64_t payload, bool is_pending)> &filter = nullptr) const;
 
+    // Timeline queries of submit validation. They give the same operation LastOp would find with the equivalent filter,
+    // but only look at the part of the timeline that can match.
+    //
+    // Pending signal with this exact payload, otherwise the completed signal if its payload is not lower
+    std::optional<SemOp> ConflictingSignal(uint64_t payload) const;
+    // Highest pending signal with a payload lower or equal to this one
+    std::optional<SemOp> LastPendingSignalAtOrBelow(uint64_t payload) const;
+    // Highest operation, pending or completed, with a payload that differs from this one by more than max_diff
+    std::optional<SemOp> LastOpOutsideRange(uint64_t payload, uint64_t max_diff) const;
+
     // Returns pending queue submission that signals this binary semaphore.
     std::optional<SubmissionReference> GetPendingBinarySignalSubmission() const;
 
     // Returns pending queue submission that waits on this binary semaphore.
     std::optional<SubmissionReference> GetPendingBinaryWaitSubmission() const;
 
-    // Current payload value.
+    // Current payload value, read without taking the semaphore lock.
     // If a queue submission command is pending execution, then the returned value may immediately be out of date.
-    uint64_t CurrentPayload() const;
+    uint64_t CurrentPayload() const { return completed_payload_.load(std::memory_order_acquire); }
 
     bool CanBinaryBeSignaled() const;
     bool CanBinaryBeWaited() const;
@@ -131,6 +143,18 @@ class Semaphore : public RefcountedStateObject {
 
     std::shared_future<void> Wait(uint64_t payload);
 
+    // Must be called with the write lock held
+    void SetCompleted(const SemOp &op) {
+        completed_ = op;
+        completed_payload_.store(op.payload, std::memory_order_release);
+    }
+    void EraseTimePoint(std::map<uint64_t, TimePoint>::iterator pos) {
+        pending_signals_.erase(pos->first);
+        timeline_.erase(pos);
+    }
+    // The operation LastOp reports first for a time point
+    static SemOp FirstOp(uint64_t payload, const TimePoint &timepoint);
+
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
@@ -140,6 +164,8 @@ class Semaphore : public RefcountedStateObject {
 
     // the most recently completed operation
     SemOp completed_;
+    // copy of completed_.payload for readers that don't take the lock
+    std::atomic<uint64_t> completed_payload_;
     // next payload value for binary semaphore operations
     uint64_t next_payload_;
 
@@ -147,6 +173,8 @@ class Semaphore : public RefcountedStateObject {
     // Timeline operations can be added in any order and multiple wait operations
     // can use the same payload value.
     std::map<uint64_t, TimePoint> timeline_;
+    // Payloads of the time points in timeline_ that have a signal operation
+    std::set<uint64_t> pending_signals_;
     mutable std::shared_mutex lock_;
     ValidationStateTracker &dev_data_;
 };
@@ -192,6 +220,9 @@ struct SemaphoreSubmitState {
 
     bool CannotSignalBinary(const vvl::Semaphore &semaphore_state, VkQueue &other_queue, vvl::Func &other_command) const;
 
+    // compare_func checks the operations of the current submission, find_pending looks up the semaphore operation
+    // that fails the same comparison
     bool CheckSemaphoreValue(const vvl::Semaphore &semaphore_state, std::string &where, uint64_t &bad_value,
-                             std::function<bool(const vvl::Semaphore::OpType, uint64_t, bool is_pending)> compare_func);
+                             std::function<bool(const vvl::Semaphore::OpType, uint64_t, bool is_pending)> compare_func,
+                             const std::function<std::optional<vvl::Semaphore::SemOp>()> &find_pending);
 };
\ No newline at end of file
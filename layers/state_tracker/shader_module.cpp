@@ -23,6 +23,8 @@
 #include "state_tracker/descriptor_sets.h"
 #include "generated/spirv_grammar_helper.h"
 #include "spirv/1.2/GLSL.std.450.h"
+#include "utils/trace_markers.h"
+#include "chassis/memory_report.h"
 
 namespace spirv {
 
@@ -845,15 +847,33 @@ std::optional<VkPrimitiveTopology> Module::GetTopology(const EntryPoint& entrypo
     return result;
 }
 
+size_t Module::GetMemoryUsage() const {
+    using vvl::MemoryUsage;
+    const StaticData& data = static_data_;
+    size_t bytes = sizeof(*this) + MemoryUsage::VectorBytes(words_);
+    bytes += MemoryUsage::VectorBytes(data.instructions) + MemoryUsage::VectorBytes(data.definitions);
+    bytes += MemoryUsage::MapBytes(data.decorations) + MemoryUsage::MapBytes(data.execution_modes) +
+             MemoryUsage::MapBytes(data.id_to_spec_id) + MemoryUsage::MapBytes(data.type_struct_map) +
+             MemoryUsage::MapBytes(data.image_write_load_id_map);
+    bytes += MemoryUsage::VectorBytes(data.decoration_inst) + MemoryUsage::VectorBytes(data.member_decoration_inst) +
+             MemoryUsage::VectorBytes(data.variable_inst) + MemoryUsage::VectorBytes(data.cooperative_matrix_inst) +
+             MemoryUsage::VectorBytes(data.capability_list) + MemoryUsage::VectorBytes(data.extension_inst);
+    // The EntryPoint analysis is built lazily by whichever thread looks it up first, only its slot is counted
+    bytes += data.entry_points.size() * sizeof(EntryPointSlot) + data.type_structs.size() * sizeof(TypeStructInfo);
+    return bytes;
+}
+
 Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data) {
     if (!module_state.valid_spirv) return;
+    VVL_TRACE_SCOPE("spirv::Module::StaticData");
 
     // Parse the words first so we have instruction class objects to use
     {
         std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
         it += 5;  // skip first 5 word of header
         while (it != module_state.words_.cend()) {
-            Instruction insn(it);
+            // Build in place, an Instruction carries its words inline so a temporary copy isn't free
+            const Instruction &insn = instructions.emplace_back(it);
             const uint32_t opcode = insn.Opcode();
 
             // Check for opcodes that would require reparsing of the words
@@ -861,16 +881,21 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                 if (stateless_data) {
                     assert(stateless_data->has_group_decoration == false);  // if assert, spirv-opt didn't flatten it
                     stateless_data->has_group_decoration = true;
+                    instructions.pop_back();
                     return;  // no need to continue parsing
                 }
             }
 
-            instructions.emplace_back(insn);
             it += insn.Length();
         }
         instructions.shrink_to_fit();
     }
 
+    // The header bound is an upper limit on every <id>, so FindDef can index directly instead of hashing. Don't trust it
+    // blindly for the allocation though, the table still grows on demand if an id goes past the clamped size.
+    const uint32_t id_bound = module_state.words_[3];
+    definitions.resize(std::min(static_cast<size_t>(id_bound), module_state.words_.size()), nullptr);
+
     // These have their own object class, but need entire module parsed first
     std::vector<const Instruction*> entry_point_instructions;
     std::vector<const Instruction*> type_struct_instructions;
@@ -879,14 +904,16 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     // both OpDecorate and OpMemberDecorate builtin instructions
     std::vector<const Instruction*> builtin_decoration_instructions;
 
-    DebugNameMap debug_name_map;
+    // Anything the EntryPoint analysis needs has to outlive this constructor, as that analysis is deferred
+    entry_point_build_data = std::make_unique<EntryPointBuildData>();
+    DebugNameMap& debug_name_map = entry_point_build_data->debug_name_map;
 
     std::vector<uint32_t> store_pointer_ids;
     std::vector<uint32_t> load_pointer_ids;
     std::vector<uint32_t> atomic_store_pointer_ids;
     std::vector<uint32_t> atomic_load_pointer_ids;
 
-    AccessChainVariableMap access_chain_map;
+    AccessChainVariableMap& access_chain_map = entry_point_build_data->access_chain_map;
 
     uint32_t last_func_id = 0;
     // < Function ID, OpFunctionParameter Ids >
@@ -898,6 +925,9 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         // Build definition list
         const uint32_t result_id = insn.ResultId();
         if (result_id != 0) {
+            if (result_id >= definitions.size()) {
+                definitions.resize(result_id + 1, nullptr);
+            }
             definitions[result_id] = &insn;
         }
 
@@ -941,6 +971,10 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                 }
                 break;
 
+            case spv::OpExtension:
+                extension_inst.push_back(&insn);
+                break;
+
             case spv::OpVariable:
                 variable_inst.push_back(&insn);
                 break;
@@ -1133,7 +1167,7 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
 
     // parsing, take every load/store find the variable it touches
     // (image access are done later)
-    VariableAccessMap variable_access_map;
+    VariableAccessMap& variable_access_map = entry_point_build_data->variable_access_map;
     auto mark_variable_access = [&module_state, &variable_access_map](const std::vector<uint32_t>& ids, uint32_t access) {
         for (const auto& object_id : ids) {
             uint32_t variable_id = object_id;
@@ -1188,7 +1222,7 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
 
     // Need to get ImageAccesses as EntryPoint's variables depend on it
     std::vector<std::shared_ptr<ImageAccess>> image_accesses;
-    ImageAccessMap image_access_map;
+    ImageAccessMap& image_access_map = entry_point_build_data->image_access_map;
 
     for (const auto& insn : image_instructions) {
         auto new_access = image_accesses.emplace_back(std::make_shared<ImageAccess>(module_state, *insn, func_parameter_map));
@@ -1199,13 +1233,83 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         }
     }
 
-    // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
+    if (has_specialization_constants) {
+        // Walks the type of each Workgroup variable looking for an array length that isn't a plain OpConstant
+        std::vector<uint32_t> type_ids;
+        for (const Instruction* insn : variable_inst) {
+            if (insn->StorageClass() == spv::StorageClassWorkgroup) {
+                type_ids.push_back(insn->Word(1));
+            }
+        }
+        vvl::unordered_set<uint32_t> visited_types;
+        while (!type_ids.empty() && !has_spec_constant_workgroup_memory) {
+            const uint32_t type_id = type_ids.back();
+            type_ids.pop_back();
+            const Instruction* type = type_id < definitions.size() ? definitions[type_id] : nullptr;
+            if (!type || !visited_types.insert(type_id).second) {
+                continue;
+            }
+            switch (type->Opcode()) {
+                case spv::OpTypePointer:
+                    type_ids.push_back(type->Word(3));
+                    break;
+                case spv::OpTypeArray: {
+                    const uint32_t length_id = type->Word(3);
+                    const Instruction* length = length_id < definitions.size() ? definitions[length_id] : nullptr;
+                    if (!length || length->Opcode() != spv::OpConstant) {
+                        has_spec_constant_workgroup_memory = true;
+                    }
+                    type_ids.push_back(type->Word(2));
+                } break;
+                case spv::OpTypeVector:
+                case spv::OpTypeMatrix:
+                    type_ids.push_back(type->Word(2));
+                    break;
+                case spv::OpTypeStruct:
+                    for (uint32_t i = 2; i < type->Length(); ++i) {
+                        type_ids.push_back(type->Word(i));
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Only record the entry points here, Module::GetEntryPoint() does the analysis once the module is complete
     for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map, access_chain_map,
-                                                               variable_access_map, debug_name_map));
+        entry_points.emplace_back(std::make_unique<EntryPointSlot>(*insn));
+    }
+    if (entry_points.empty()) {
+        entry_point_build_data.reset();
+    } else {
+        entry_point_build_data->pending_entry_points = static_cast<uint32_t>(entry_points.size());
     }
 }
 
+Module::EntryPointSlot::EntryPointSlot(const Instruction& insn)
+    : entrypoint_insn(insn),
+      stage(static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(insn.Word(1)))),
+      name(insn.GetAsString(3)) {}
+
+std::shared_ptr<const EntryPoint> Module::GetEntryPoint(const EntryPointSlot& slot) const {
+    std::call_once(slot.built, [this, &slot]() {
+        VVL_TRACE_SCOPE("spirv::Module::BuildEntryPoint");
+        EntryPointBuildData& build_data = *static_data_.entry_point_build_data;
+        slot.entry_point =
+            std::make_shared<EntryPoint>(*this, slot.entrypoint_insn, build_data.image_access_map, build_data.access_chain_map,
+                                         build_data.variable_access_map, build_data.debug_name_map);
+        // Once the last one is built nothing reads the maps anymore
+        if (--build_data.pending_entry_points == 0) {
+            build_data.image_access_map.clear();
+            build_data.access_chain_map.clear();
+            build_data.variable_access_map.clear();
+            build_data.debug_name_map.clear();
+        }
+    });
+    return slot.entry_point;
+}
+
 std::string Module::GetDecorations(uint32_t id) const {
     std::ostringstream ss;
     for (const spirv::Instruction& insn : GetInstructions()) {
@@ -1345,9 +1449,9 @@ std::string Module::DescribeVariable(uint32_t id) const {
 
 std::shared_ptr<const EntryPoint> Module::FindEntrypoint(char const* name, VkShaderStageFlagBits stageBits) const {
     if (!name) return nullptr;
-    for (const auto& entry_point : static_data_.entry_points) {
-        if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
-            return entry_point;
+    for (const auto& slot : static_data_.entry_points) {
+        if (slot->stage == stageBits && strcmp(slot->name, name) == 0) {
+            return GetEntryPoint(*slot);
         }
     }
     return nullptr;
@@ -1388,6 +1492,165 @@ bool Module::FindLocalSize(const EntryPoint& entrypoint, uint32_t& local_size_x,
     return false;  // not found
 }
 
+std::optional<uint32_t> Module::EvaluateSpecConstant(uint32_t id, const SpecConstantValues& spec_values, uint32_t depth) const {
+    const Instruction* insn = FindDef(id);
+    // Valid SPIR-V only has a few levels of nested OpSpecConstantOp, this only guards against cycles
+    if (!insn || depth > 64) {
+        return std::nullopt;
+    }
+    const uint32_t opcode = insn->Opcode();
+    if (opcode == spv::OpConstantTrue || opcode == spv::OpConstantFalse || opcode == spv::OpSpecConstantTrue ||
+        opcode == spv::OpSpecConstantFalse) {
+        uint32_t value = (opcode == spv::OpConstantTrue || opcode == spv::OpSpecConstantTrue) ? 1 : 0;
+        if (opcode == spv::OpSpecConstantTrue || opcode == spv::OpSpecConstantFalse) {
+            const auto spec_id = static_data_.id_to_spec_id.find(id);
+            if (spec_id != static_data_.id_to_spec_id.end()) {
+                const auto override_value = spec_values.find(spec_id->second);
+                if (override_value != spec_values.end() && !override_value->second.empty()) {
+                    value = override_value->second[0] != 0 ? 1 : 0;
+                }
+            }
+        }
+        return value;
+    }
+
+    // Only 32-bit integers, the only type the local size and array lengths are using in practice
+    const Instruction* type = FindDef(insn->Word(1));
+    if (!type || (type->Opcode() != spv::OpTypeBool && (type->Opcode() != spv::OpTypeInt || type->Word(2) != 32))) {
+        return std::nullopt;
+    }
+
+    if (opcode == spv::OpConstant) {
+        return insn->Word(3);
+    } else if (opcode == spv::OpSpecConstant) {
+        const auto spec_id = static_data_.id_to_spec_id.find(id);
+        if (spec_id != static_data_.id_to_spec_id.end()) {
+            const auto override_value = spec_values.find(spec_id->second);
+            if (override_value != spec_values.end() && override_value->second.size() == 1) {
+                return override_value->second[0];
+            }
+        }
+        return insn->Word(3);
+    } else if (opcode != spv::OpSpecConstantOp) {
+        return std::nullopt;
+    }
+
+    const uint32_t operation = insn->Word(3);
+    const uint32_t operand_count = insn->Length() - 4;
+    uint32_t operands[3] = {0, 0, 0};
+    if (operand_count == 0 || operand_count > 3) {
+        return std::nullopt;
+    }
+    for (uint32_t i = 0; i < operand_count; ++i) {
+        const auto operand = EvaluateSpecConstant(insn->Word(4 + i), spec_values, depth + 1);
+        if (!operand) {
+            return std::nullopt;
+        }
+        operands[i] = *operand;
+    }
+    const uint32_t a = operands[0];
+    const uint32_t b = operands[1];
+    const int32_t signed_a = static_cast<int32_t>(a);
+    const int32_t signed_b = static_cast<int32_t>(b);
+
+    switch (operation) {
+        case spv::OpSelect:
+            return a ? b : operands[2];
+        case spv::OpIAdd:
+            return a + b;
+        case spv::OpISub:
+            return a - b;
+        case spv::OpIMul:
+            return a * b;
+        case spv::OpUDiv:
+            if (b == 0) return std::nullopt;
+            return a / b;
+        case spv::OpUMod:
+            if (b == 0) return std::nullopt;
+            return a % b;
+        case spv::OpSNegate:
+            return 0u - a;
+        case spv::OpNot:
+            return ~a;
+        case spv::OpBitwiseAnd:
+            return a & b;
+        case spv::OpBitwiseOr:
+            return a | b;
+        case spv::OpBitwiseXor:
+            return a ^ b;
+        case spv::OpShiftLeftLogical:
+            if (b >= 32) return std::nullopt;
+            return a << b;
+        case spv::OpShiftRightLogical:
+            if (b >= 32) return std::nullopt;
+            return a >> b;
+        case spv::OpLogicalNot:
+            return a ? 0u : 1u;
+        case spv::OpLogicalAnd:
+            return (a && b) ? 1u : 0u;
+        case spv::OpLogicalOr:
+            return (a || b) ? 1u : 0u;
+        case spv::OpLogicalEqual:
+        case spv::OpIEqual:
+            return (a == b) ? 1u : 0u;
+        case spv::OpLogicalNotEqual:
+        case spv::OpINotEqual:
+            return (a != b) ? 1u : 0u;
+        case spv::OpULessThan:
+            return (a < b) ? 1u : 0u;
+        case spv::OpULessThanEqual:
+            return (a <= b) ? 1u : 0u;
+        case spv::OpUGreaterThan:
+            return (a > b) ? 1u : 0u;
+        case spv::OpUGreaterThanEqual:
+            return (a >= b) ? 1u : 0u;
+        case spv::OpSLessThan:
+            return (signed_a < signed_b) ? 1u : 0u;
+        case spv::OpSLessThanEqual:
+            return (signed_a <= signed_b) ? 1u : 0u;
+        case spv::OpSGreaterThan:
+            return (signed_a > signed_b) ? 1u : 0u;
+        case spv::OpSGreaterThanEqual:
+            return (signed_a >= signed_b) ? 1u : 0u;
+        default:
+            // The signed divisions and the conversions are left to spirv-opt
+            return std::nullopt;
+    }
+}
+
+bool Module::EvaluateLocalSize(const EntryPoint& entrypoint, const SpecConstantValues& spec_values, uint32_t& local_size_x,
+                               uint32_t& local_size_y, uint32_t& local_size_z) const {
+    std::optional<uint32_t> x, y, z;
+    if (static_data_.has_builtin_workgroup_size) {
+        const Instruction* composite_def = FindDef(static_data_.builtin_workgroup_size_id);
+        const uint32_t opcode = composite_def->Opcode();
+        if (opcode != spv::OpConstantComposite && opcode != spv::OpSpecConstantComposite) {
+            return false;
+        }
+        x = EvaluateSpecConstant(composite_def->Word(3), spec_values);
+        y = EvaluateSpecConstant(composite_def->Word(4), spec_values);
+        z = EvaluateSpecConstant(composite_def->Word(5), spec_values);
+    } else if (entrypoint.execution_mode.Has(ExecutionModeSet::local_size_bit)) {
+        x = entrypoint.execution_mode.local_size_x;
+        y = entrypoint.execution_mode.local_size_y;
+        z = entrypoint.execution_mode.local_size_z;
+    } else if (entrypoint.execution_mode.Has(ExecutionModeSet::local_size_id_bit)) {
+        x = EvaluateSpecConstant(entrypoint.execution_mode.local_size_x, spec_values);
+        y = EvaluateSpecConstant(entrypoint.execution_mode.local_size_y, spec_values);
+        z = EvaluateSpecConstant(entrypoint.execution_mode.local_size_z, spec_values);
+    } else {
+        return true;  // no local size, same as FindLocalSize not finding one
+    }
+
+    if (!x || !y || !z) {
+        return false;
+    }
+    local_size_x = *x;
+    local_size_y = *y;
+    local_size_z = *z;
+    return true;
+}
+
 uint32_t Module::CalculateWorkgroupSharedMemory() const {
     uint32_t total_size = 0;
     // when using WorkgroupMemoryExplicitLayoutKHR
@@ -2351,3 +2614,12 @@ AtomicInstructionInfo Module::GetAtomicInfo(const Instruction& insn) const {
 }
 
 }  // namespace spirv
+
+void vvl::ShaderModule::AddMemoryUsage(MemoryUsage& usage) const {
+    size_t bytes = sizeof(*this);
+    // The same module can be shared with other shader modules of identical SPIR-V and with pipelines
+    if (spirv && usage.FirstVisit(spirv.get())) {
+        bytes += spirv->GetMemoryUsage();
+    }
+    usage.Add(MemoryCategory::ShaderModule, bytes);
+}
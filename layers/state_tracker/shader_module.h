@@ -17,14 +17,20 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_object.h"
 #include "state_tracker/sampler_state.h"
+#include "utils/arena_allocator.h"
 #include <spirv/unified1/spirv.hpp>
 #include "spirv-tools/optimizer.hpp"
 
@@ -573,9 +579,42 @@ struct StatelessData {
     bool has_group_decoration{false};
 };
 
+// Module parse results only needed to build the EntryPoints, kept until every entry point is built
+struct EntryPointBuildData {
+    ImageAccessMap image_access_map;
+    AccessChainVariableMap access_chain_map;
+    VariableAccessMap variable_access_map;
+    DebugNameMap debug_name_map;
+    std::atomic<uint32_t> pending_entry_points{0};
+};
+
+// spirv-val of a module started in the background at vkCreateShaderModule (async_spirv_validation), the first pipeline using
+// the module waits for it. Guarded by the lock of the validation object that started it.
+struct DeferredValidation {
+    uint32_t cache_hash = 0;
+    bool started = false;
+    bool done = false;
+    // The result is only reported once, even if the module is used by many pipelines
+    bool reported = false;
+    spv_result_t result = SPV_SUCCESS;
+    std::string diagnostic;
+};
+
 // Represents a SPIR-V Module
 // This holds the SPIR-V source and parse it
 struct Module {
+    // OpEntryPoint found while parsing. The full EntryPoint analysis (interface variables, accessible ids, ...) is costly and
+    // only happens the first time the entry point is asked for, see GetEntryPoint()
+    struct EntryPointSlot {
+        EntryPointSlot(const Instruction &insn);
+        const Instruction &entrypoint_insn;
+        const VkShaderStageFlagBits stage;
+        const char *name;
+
+        mutable std::once_flag built;
+        mutable std::shared_ptr<const EntryPoint> entry_point;
+    };
+
     // Static/const data extracted from a SPIRV module at initialization time
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
@@ -584,12 +623,16 @@ struct Module {
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
+        // The lists only read while validating the module, their blocks come from the SPIR-V arena
+        using InstructionList = std::vector<const Instruction *, vvl::ArenaAllocator<const Instruction *, vvl::Arena::Spirv>>;
+
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
         // A mapping of <id> to the first word of its def. this is useful because walking type
         // trees, constant expressions, etc requires jumping all over the instruction stream.
-        vvl::unordered_map<uint32_t, const Instruction *> definitions;
+        // Indexed directly by <id> (ids are dense, below the header bound), null where no definition exists
+        InstructionList definitions;
 
         vvl::unordered_map<uint32_t, DecorationSet> decorations;
         DecorationSet empty_decoration;  // all zero values, allows use to return a reference and not a copy each time
@@ -602,10 +645,10 @@ struct Module {
         // [OpSpecConstant Result ID -> OpDecorate SpecID value] mapping
         vvl::unordered_map<uint32_t, uint32_t> id_to_spec_id;
         // Find all decoration instructions to prevent relooping module later - many checks need this info
-        std::vector<const Instruction *> decoration_inst;
-        std::vector<const Instruction *> member_decoration_inst;
+        InstructionList decoration_inst;
+        InstructionList member_decoration_inst;
         // Find all variable instructions to prevent relookping module later
-        std::vector<const Instruction *> variable_inst;
+        InstructionList variable_inst;
         // For shader tile image - OpDepthAttachmentReadEXT/OpStencilAttachmentReadEXT/OpColorAttachmentReadEXT
         bool has_shader_tile_image_depth_read{false};
         bool has_shader_tile_image_stencil_read{false};
@@ -620,14 +663,19 @@ struct Module {
         std::vector<const Instruction *> cooperative_matrix_inst;
 
         std::vector<spv::Capability> capability_list;
+        InstructionList extension_inst;
         // Code on the hot path can cache capabilities for fast access.
         bool has_capability_runtime_descriptor_array{false};
 
         bool has_specialization_constants{false};
+        // The type of a Workgroup variable has an array whose length is a specialization constant, so its size can only be
+        // known once specialized
+        bool has_spec_constant_workgroup_memory{false};
         bool uses_interpolate_at_sample{false};
 
         // EntryPoint has pointer references inside it that need to be preserved
-        std::vector<std::shared_ptr<EntryPoint>> entry_points;
+        std::vector<std::unique_ptr<EntryPointSlot>> entry_points;
+        std::unique_ptr<EntryPointBuildData> entry_point_build_data;
 
         std::vector<std::shared_ptr<TypeStructInfo>> type_structs;  // All OpTypeStruct objects
         // <OpTypeStruct ID, info> - used for faster lookup as there can many structs
@@ -652,6 +700,9 @@ struct Module {
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
 
+    // Set once by CoreChecks::DeferSpirvValidation
+    mutable std::shared_ptr<DeferredValidation> deferred_validation;
+
     // Used for when modifying the SPIR-V (spirv-opt, GPU-AV instrumentation, etc) and need reparse it for VVL validaiton
     Module(vvl::span<const uint32_t> code) : valid_spirv(true), words_(code.begin(), code.end()), static_data_(*this) {}
 
@@ -661,10 +712,11 @@ struct Module {
           words_(pCode, pCode + codeSize / sizeof(uint32_t)),
           static_data_(*this, stateless_data) {}
 
+    // Host memory of the words and everything parsed out of them
+    size_t GetMemoryUsage() const;
+
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
-        return it->second;
+        return (id < static_data_.definitions.size()) ? static_data_.definitions[id] : nullptr;
     }
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
@@ -714,8 +766,19 @@ struct Module {
     std::optional<VkPrimitiveTopology> GetTopology(const EntryPoint &entrypoint) const;
 
     std::shared_ptr<const EntryPoint> FindEntrypoint(char const *name, VkShaderStageFlagBits stageBits) const;
+    // Builds the EntryPoint on first use, safe to call from multiple threads
+    std::shared_ptr<const EntryPoint> GetEntryPoint(const EntryPointSlot &slot) const;
     bool FindLocalSize(const EntryPoint &entrypoint, uint32_t &local_size_x, uint32_t &local_size_y, uint32_t &local_size_z) const;
 
+    // <SpecId, value words> of VkSpecializationInfo, the same map given to spirv-opt to set the spec constant values
+    using SpecConstantValues = std::unordered_map<uint32_t, std::vector<uint32_t>>;
+    // Evaluates a 32-bit integer or boolean constant as if the module was specialized with spec_values, without running
+    // spirv-opt on it. Returns nothing for the instructions that aren't handled, the caller then needs the specialized module.
+    std::optional<uint32_t> EvaluateSpecConstant(uint32_t id, const SpecConstantValues &spec_values, uint32_t depth = 0) const;
+    // Same as FindLocalSize on the specialized module. Returns false if it can't be evaluated, leaving the sizes untouched.
+    bool EvaluateLocalSize(const EntryPoint &entrypoint, const SpecConstantValues &spec_values, uint32_t &local_size_x,
+                           uint32_t &local_size_y, uint32_t &local_size_z) const;
+
     uint32_t CalculateWorkgroupSharedMemory() const;
 
     const Instruction *GetConstantDef(uint32_t id) const;
@@ -759,6 +822,7 @@ struct ShaderModule : public StateObject {
           gpu_validation_shader_id(unique_shader_id) {}
 
     VkShaderModule VkHandle() const { return handle_.Cast<VkShaderModule>(); }
+    void AddMemoryUsage(MemoryUsage &usage) const override;
 
     // If null, means this is a empty object and no shader backing it
     // TODO - This (and vvl::ShaderObject) could be unique, but need handle multiple ValidationObjects
@@ -17,6 +17,7 @@
 #include "shader_object_state.h"
 #include "shader_module.h"
 #include "state_tracker/state_tracker.h"
+#include "chassis/memory_report.h"
 
 namespace vvl {
 static ShaderObject::SetLayoutVector GetSetLayouts(ValidationStateTracker &dev_data, const VkShaderCreateInfoEXT &pCreateInfo) {
@@ -60,4 +61,12 @@ VkPrimitiveTopology ShaderObject::GetTopology() const {
     }
     return VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
 }
+
+void ShaderObject::AddMemoryUsage(MemoryUsage &usage) const {
+    size_t bytes = sizeof(*this);
+    if (spirv && usage.FirstVisit(spirv.get())) {
+        bytes += spirv->GetMemoryUsage();
+    }
+    usage.Add(MemoryCategory::ShaderModule, bytes);
+}
 }  // namespace vvl
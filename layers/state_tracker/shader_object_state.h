@@ -54,6 +54,7 @@ struct ShaderObject : public StateObject {
     const std::vector<PipelineLayoutCompatId> set_compat_ids;
 
     VkShaderEXT VkHandle() const { return handle_.Cast<VkShaderEXT>(); }
+    void AddMemoryUsage(MemoryUsage &usage) const override;
     bool IsGraphicsShaderState() const { return create_info.stage != VK_SHADER_STAGE_COMPUTE_BIT; };
     VkPrimitiveTopology GetTopology() const;
 };
@@ -18,6 +18,8 @@
  */
 #include "state_tracker/state_object.h"
 
+thread_local bool vvl::StateObject::tearing_down_ = false;
+
 vvl::StateObject::~StateObject() { Destroy(); }
 
 void vvl::StateObject::Destroy() {
@@ -38,6 +40,15 @@ const VulkanTypedHandle* vvl::StateObject::InUse() const {
             return &node->Handle();
         }
     }
+    for (const ParentLink* link = parent_links_; link; link = link->next) {
+        auto node = link->parent.lock();
+        if (!node) {
+            continue;
+        }
+        if (node->InUse()) {
+            return &node->Handle();
+        }
+    }
     return nullptr;
 }
 
@@ -49,10 +60,53 @@ bool vvl::StateObject::AddParent(StateObject* parent_node) {
 
 void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     assert(parent_node);
+    if (tearing_down_) {
+        return;
+    }
     auto guard = WriteLockTree();
     parent_nodes_.erase(parent_node->Handle());
 }
 
+void vvl::StateObject::LinkParent(StateObject& parent_node, ParentLink& link) {
+    assert(!link.linked);
+    link.parent_handle = parent_node.Handle();
+    link.parent = parent_node.weak_from_this();
+    auto guard = WriteLockTree();
+    link.prev = nullptr;
+    link.next = parent_links_;
+    if (parent_links_) {
+        parent_links_->prev = &link;
+    }
+    parent_links_ = &link;
+    link.linked = true;
+}
+
+void vvl::StateObject::UnlinkParent(ParentLink& link) {
+    {
+        auto guard = WriteLockTree();
+        if (link.linked) {
+            if (link.prev) {
+                link.prev->next = link.next;
+            } else {
+                parent_links_ = link.next;
+            }
+            if (link.next) {
+                link.next->prev = link.prev;
+            }
+            link.linked = false;
+        }
+        link.prev = nullptr;
+        link.next = nullptr;
+    }
+    link.parent.reset();
+}
+
+void vvl::StateObject::AppendLinkedParents(NodeMap& parents) const {
+    for (const ParentLink* link = parent_links_; link; link = link->next) {
+        parents.emplace(link->parent_handle, link->parent);
+    }
+}
+
 // copy the current set of parents so that we don't need to hold the lock
 // while calling NotifyInvalidate on them, as that would lead to recursive locking.
 vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
@@ -61,19 +115,34 @@ vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink)
         auto guard = WriteLockTree();
         result = std::move(parent_nodes_);
         parent_nodes_.clear();
+        AppendLinkedParents(result);
+        // The owners still hold the links, they are only taken off the list
+        while (parent_links_) {
+            ParentLink* link = parent_links_;
+            parent_links_ = link->next;
+            link->prev = nullptr;
+            link->next = nullptr;
+            link->linked = false;
+        }
     } else {
         auto guard = ReadLockTree();
         result = parent_nodes_;
+        AppendLinkedParents(result);
     }
     return result;
 }
 
 vvl::StateObject::NodeMap vvl::StateObject::ObjectBindings() const {
     auto guard = ReadLockTree();
-    return parent_nodes_;
+    NodeMap result = parent_nodes_;
+    AppendLinkedParents(result);
+    return result;
 }
 
 void vvl::StateObject::Invalidate(bool unlink) {
+    if (unlink && tearing_down_) {
+        return;
+    }
     NodeList empty;
     // We do not want to call the virtual method here because any special handling
     // in an overriden NotifyInvalidate() is for when a child node has become invalid.
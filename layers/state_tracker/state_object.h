@@ -36,6 +36,8 @@ struct hash<VulkanTypedHandle> {
 }  // namespace std
 
 namespace vvl {
+struct MemoryUsage;
+
 // inheriting from enable_shared_from_this<> adds a method, shared_from_this(), which
 // returns a shared_ptr version of the current object. It requires the object to
 // be created with std::make_shared<> and it MUST NOT be used from the constructor
@@ -49,6 +51,19 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     using NodeList = small_vector<std::shared_ptr<StateObject>, 4, uint32_t>;
     using IdType = uint32_t;
 
+    // Intrusive parent -> child edge, owned by the parent so it can be unlinked in O(1) and reused without allocating.
+    // Command buffers bind far more objects than any other parent and unlink all of them on every reset, so they use
+    // these instead of AddParent()/RemoveParent(), which hash into parent_nodes_.
+    // All fields are guarded by the tree lock of the child the link is on.
+    struct ParentLink {
+        VulkanTypedHandle parent_handle;
+        std::weak_ptr<StateObject> parent;
+        ParentLink *prev = nullptr;
+        ParentLink *next = nullptr;
+        // Cleared when the child drops all its parents (see GetParentsForInvalidate)
+        bool linked = false;
+    };
+
     template <typename Handle>
     StateObject(Handle h, VulkanObjectType t) : TypedHandleWrapper(h, t), destroyed_(false), id_(0) {}
 
@@ -89,6 +104,11 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     virtual bool AddParent(StateObject *parent_node);
     virtual void RemoveParent(StateObject *parent_node);
 
+    // The caller must make sure a parent is only linked once and that the link outlives its place on the list
+    void LinkParent(StateObject &parent_node, ParentLink &link);
+    // No-op if the link was already dropped by this object
+    void UnlinkParent(ParentLink &link);
+
     // Invalidate is called on a state object to inform its parents that it
     // is being destroyed (unlink == true) or otherwise becoming invalid (unlink == false)
     void Invalidate(bool unlink = true);
@@ -96,6 +116,17 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Helper to let objects examine their immediate parents without holding the tree lock.
     NodeMap ObjectBindings() const;
 
+    // Set on the thread of vkDestroyDevice while it drops the state of the objects of the device. Their parents are being
+    // dropped as well, so the objects destroyed in the meantime neither notify nor unlink them.
+    class DeviceTeardown {
+      public:
+        DeviceTeardown() { tearing_down_ = true; }
+        ~DeviceTeardown() { tearing_down_ = false; }
+    };
+
+    // Estimated host memory held by the object, only called when the memory_report setting is enabled
+    virtual void AddMemoryUsage(MemoryUsage &usage) const {}
+
   protected:
     template <typename Derived, typename Shared = std::shared_ptr<Derived>>
     static Shared SharedFromThisImpl(Derived *derived) {
@@ -110,6 +141,10 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // returns a copy of the current set of parents so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
     NodeMap GetParentsForInvalidate(bool unlink);
+    // tree_lock_ must be held
+    void AppendLinkedParents(NodeMap &parents) const;
+
+    static thread_local bool tearing_down_;
 
     // Set to true when the API-level object is destroyed, but this object may
     // hang around until its shared_ptr refcount goes to zero.
@@ -122,7 +157,9 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
     NodeMap parent_nodes_;
-    // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
+    // Head of the ParentLink list, parents linked that way are not in parent_nodes_
+    ParentLink *parent_links_ = nullptr;
+    // Lock guarding parent_nodes_ and parent_links_, this lock MUST NOT be used for other purposes.
     mutable std::shared_mutex tree_lock_;
 };
 
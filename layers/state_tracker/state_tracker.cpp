@@ -143,6 +143,27 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetExternalFormatFeaturesANDROI
 
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
+VkFormatProperties3KHR ValidationStateTracker::GetPDFormatProperties(const VkFormat format) const {
+    return physical_device_state->GetFormatProperties(format, has_format_feature2, [this](VkFormat query_format) {
+        VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
+        VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
+
+        if (has_format_feature2) {
+            DispatchGetPhysicalDeviceFormatProperties2Helper(physical_device, query_format, &fmt_props_2);
+            fmt_props_3.linearTilingFeatures |= fmt_props_2.formatProperties.linearTilingFeatures;
+            fmt_props_3.optimalTilingFeatures |= fmt_props_2.formatProperties.optimalTilingFeatures;
+            fmt_props_3.bufferFeatures |= fmt_props_2.formatProperties.bufferFeatures;
+        } else {
+            VkFormatProperties format_properties;
+            DispatchGetPhysicalDeviceFormatProperties(physical_device, query_format, &format_properties);
+            fmt_props_3.linearTilingFeatures = format_properties.linearTilingFeatures;
+            fmt_props_3.optimalTilingFeatures = format_properties.optimalTilingFeatures;
+            fmt_props_3.bufferFeatures = format_properties.bufferFeatures;
+        }
+        return fmt_props_3;
+    });
+}
+
 VkFormatFeatureFlags2 ValidationStateTracker::GetImageFormatFeatures(VkPhysicalDevice physical_device, bool has_format_feature2,
                                                                      bool has_drm_modifiers, VkDevice device, VkImage image,
                                                                      VkFormat format, VkImageTiling tiling) {
@@ -367,6 +388,44 @@ struct BufferAddressInfillUpdateOps {
     const Mapped &insert_value;
 };
 
+ValidationStateTracker::BuffersByAddress ValidationStateTracker::GetBuffersByAddress(VkDeviceAddress address) const {
+    std::shared_ptr<const BufferAddressSnapshot> snapshot = std::atomic_load(&buffer_address_snapshot_);
+    if (!snapshot || snapshot->version != buffer_device_address_ranges_version.load()) {
+        std::lock_guard<std::mutex> snapshot_guard(buffer_address_snapshot_lock_);
+        snapshot = std::atomic_load(&buffer_address_snapshot_);
+        if (!snapshot || snapshot->version != buffer_device_address_ranges_version.load()) {
+            static std::atomic<uint64_t> next_snapshot_id{1};
+            auto new_snapshot = std::make_shared<BufferAddressSnapshot>();
+            new_snapshot->id = next_snapshot_id.fetch_add(1, std::memory_order_relaxed);
+            {
+                ReadLockGuard guard(buffer_address_lock_);
+                new_snapshot->version = buffer_device_address_ranges_version.load();
+                new_snapshot->map = buffer_address_map_;
+            }
+            snapshot = std::move(new_snapshot);
+            std::atomic_store(&buffer_address_snapshot_, snapshot);
+        }
+    }
+
+    // Checks of the same command often look up addresses inside the same buffer, like the geometries of an acceleration
+    // structure build. The entry can only be used while its snapshot is the current one, which the caller then keeps alive.
+    struct LastLookup {
+        uint64_t snapshot_id = 0;
+        const BufferAddressRangeMap::value_type *entry = nullptr;
+    };
+    thread_local LastLookup last;
+    if (last.snapshot_id == snapshot->id && last.entry->first.includes(address)) {
+        return BuffersByAddress(std::move(snapshot), last.entry->second);
+    }
+
+    const auto found_it = snapshot->map.find(address);
+    if (found_it == snapshot->map.end()) {
+        return BuffersByAddress();
+    }
+    last = {snapshot->id, &*found_it};
+    return BuffersByAddress(std::move(snapshot), found_it->second);
+}
+
 std::shared_ptr<vvl::Buffer> ValidationStateTracker::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) {
     return std::make_shared<vvl::Buffer>(*this, handle, pCreateInfo);
 }
@@ -388,6 +447,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 
             BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
             sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            buffer_device_address_ranges_version++;
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -420,17 +480,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 
     auto buffer_state = Get<vvl::Buffer>(pCreateInfo->buffer);
 
-    VkFormatFeatureFlags2KHR buffer_features;
-    if (has_format_feature2) {
-        VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
-        VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-        DispatchGetPhysicalDeviceFormatProperties2Helper(physical_device, pCreateInfo->format, &fmt_props_2);
-        buffer_features = fmt_props_3.bufferFeatures | fmt_props_2.formatProperties.bufferFeatures;
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, pCreateInfo->format, &format_properties);
-        buffer_features = format_properties.bufferFeatures;
-    }
+    const VkFormatFeatureFlags2KHR buffer_features = GetPDFormatProperties(pCreateInfo->format).bufferFeatures;
 
     Add(CreateBufferViewState(buffer_state, *pView, pCreateInfo, buffer_features));
 }
@@ -551,6 +601,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
+            buffer_device_address_ranges_version++;
         }
     }
     Destroy<vvl::Buffer>(buffer);
@@ -628,21 +679,24 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetPotentialFormatFeatures(VkFo
     VkFormatFeatureFlags2KHR format_features = 0;
 
     if (format != VK_FORMAT_UNDEFINED) {
-        if (has_format_feature2) {
-            VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
-            auto fmt_props_3 = vku::InitStruct<VkFormatProperties3KHR>(
-                IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier) ? &fmt_drm_props : nullptr);
-            VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
+        // YCbCr conversions, image views and the like of the same few formats are created over and over, so the whole result
+        // (including the modifier lists, that the physical device state doesn't cache) is kept per format
+        const auto cached = potential_format_features_.find(format);
+        if (cached != potential_format_features_.end()) {
+            return cached->second;
+        }
 
-            DispatchGetPhysicalDeviceFormatProperties2Helper(physical_device, format, &fmt_props_2);
+        const VkFormatProperties3KHR format_properties = GetPDFormatProperties(format);
+        format_features |= format_properties.linearTilingFeatures;
+        format_features |= format_properties.optimalTilingFeatures;
 
-            format_features |= fmt_props_2.formatProperties.linearTilingFeatures;
-            format_features |= fmt_props_2.formatProperties.optimalTilingFeatures;
+        if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
+            if (has_format_feature2) {
+                VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
+                VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
 
-            format_features |= fmt_props_3.linearTilingFeatures;
-            format_features |= fmt_props_3.optimalTilingFeatures;
+                DispatchGetPhysicalDeviceFormatProperties2Helper(physical_device, format, &fmt_props_2);
 
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
                 std::vector<VkDrmFormatModifierProperties2EXT> drm_properties;
                 drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
                 fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
@@ -651,14 +705,7 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetPotentialFormatFeatures(VkFo
                 for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
                     format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
                 }
-            }
-        } else {
-            VkFormatProperties format_properties;
-            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-            format_features |= format_properties.linearTilingFeatures;
-            format_features |= format_properties.optimalTilingFeatures;
-
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
+            } else {
                 VkDrmFormatModifierPropertiesListEXT fmt_drm_props = vku::InitStructHelper();
                 VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
 
@@ -674,6 +721,7 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetPotentialFormatFeatures(VkFo
                 }
             }
         }
+        potential_format_features_.insert(format, format_features);
     }
 
     return format_features;
@@ -721,18 +769,13 @@ void ValidationStateTracker::PostCreateDevice(const VkDeviceCreateInfo *pCreateI
     }
 
     // Store physical device properties and physical device mem limits into CoreChecks structs
-    DispatchGetPhysicalDeviceMemoryProperties(physical_device, &phys_dev_mem_props);
-    DispatchGetPhysicalDeviceProperties(physical_device, &phys_dev_props);
+    const vvl::PhysicalDeviceInfo &phys_dev_info = *physical_device_state->info;
+    phys_dev_mem_props = phys_dev_info.memory_properties;
+    phys_dev_props = phys_dev_info.properties;
 
     {
-        uint32_t n_props = 0;
-        std::vector<VkExtensionProperties> props;
-        instance_dispatch_table.EnumerateDeviceExtensionProperties(physical_device, NULL, &n_props, NULL);
-        props.resize(n_props);
-        instance_dispatch_table.EnumerateDeviceExtensionProperties(physical_device, NULL, &n_props, props.data());
-
         vvl::unordered_set<vvl::Extension> phys_dev_extensions;
-        for (const auto &ext_prop : props) {
+        for (const auto &ext_prop : phys_dev_info.extensions) {
             phys_dev_extensions.insert(GetExtension(ext_prop.extensionName));
         }
 
@@ -1022,11 +1065,7 @@ void ValidationStateTracker::PostCreateDevice(const VkDeviceCreateInfo *pCreateI
 
     // Store queue family data
     if (pCreateInfo->pQueueCreateInfos != nullptr) {
-        uint32_t num_queue_families = 0;
-        instance_dispatch_table.GetPhysicalDeviceQueueFamilyProperties(physical_device, &num_queue_families, nullptr);
-        std::vector<VkQueueFamilyProperties> queue_family_properties_list(num_queue_families);
-        instance_dispatch_table.GetPhysicalDeviceQueueFamilyProperties(physical_device, &num_queue_families,
-                                                                       queue_family_properties_list.data());
+        const auto &queue_family_properties_list = physical_device_state->queue_family_properties;
 
         for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
             const VkDeviceQueueCreateInfo &queue_create_info = pCreateInfo->pQueueCreateInfos[i];
@@ -1078,18 +1117,22 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
                                                         const RecordObject &record_obj) {
     if (!device) return;
 
-    command_pool_map_.clear();
-    assert(command_buffer_map_.empty());
-    pipeline_map_.clear();
-    shader_object_map_.clear();
-    render_pass_map_.clear();
-
-    // This will also delete all sets in the pool & remove them from setMap
-    descriptor_pool_map_.clear();
-    // All sets should be removed
-    assert(descriptor_set_map_.empty());
-    desc_template_map_.clear();
-    descriptor_set_layout_map_.clear();
+    // Every object of the device goes away here, skip the invalidation walks and parent unlinking of each of them
+    {
+        vvl::StateObject::DeviceTeardown teardown;
+        command_pool_map_.clear();
+        assert(command_buffer_map_.empty());
+        pipeline_map_.clear();
+        shader_object_map_.clear();
+        render_pass_map_.clear();
+
+        // This will also delete all sets in the pool & remove them from setMap
+        descriptor_pool_map_.clear();
+        // All sets should be removed
+        assert(descriptor_set_map_.empty());
+        desc_template_map_.clear();
+        descriptor_set_layout_map_.clear();
+    }
     // Because swapchains are associated with Surfaces, which are at instance level,
     // they need to be explicitly destroyed here to avoid continued references to
     // the device we're destroying.
@@ -1097,15 +1140,30 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
         entry.second->Destroy();
     }
     swapchain_map_.clear();
-    image_view_map_.clear();
-    image_map_.clear();
-    buffer_view_map_.clear();
-    buffer_map_.clear();
+    {
+        vvl::StateObject::DeviceTeardown teardown;
+        image_view_map_.clear();
+        image_map_.clear();
+        buffer_view_map_.clear();
+        buffer_map_.clear();
+    }
     // Queues persist until device is destroyed
     for (auto &entry : queue_map_.snapshot()) {
         entry.second->Destroy();
     }
     queue_map_.clear();
+    // No other thread can be in a hook anymore, so nothing retired is still borrowed
+    state_epoch_.Reclaim();
+}
+
+void ValidationStateTracker::AddMemoryUsage(vvl::MemoryUsage &usage) const {
+    auto add = [&usage](const auto &state) { state->AddMemoryUsage(usage); };
+    ForEachShared<vvl::Image>(add);
+    ForEachShared<vvl::Buffer>(add);
+    ForEachShared<vvl::DescriptorSet>(add);
+    ForEachShared<vvl::CommandBuffer>(add);
+    ForEachShared<vvl::ShaderModule>(add);
+    ForEachShared<vvl::ShaderObject>(add);
 }
 
 void ValidationStateTracker::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
@@ -1167,7 +1225,7 @@ static void UpdateCmdBufLabelStack(const vvl::CommandBuffer &cb_state, vvl::Queu
     if (queue_state.found_unbalanced_cmdbuf_label) return;
     for (const auto &command : cb_state.GetLabelCommands()) {
         if (command.begin) {
-            queue_state.cmdbuf_label_stack.push_back(command.label_name);
+            queue_state.cmdbuf_label_stack.push_back(command.label_id);
         } else {
             if (queue_state.cmdbuf_label_stack.empty()) {
                 queue_state.found_unbalanced_cmdbuf_label = true;
@@ -1192,6 +1250,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit(VkQueue queue, uint32_t s
         }
     }
     queue_state->PostSubmit();
+    SampleMemoryUsageIfDue();
 }
 
 void ValidationStateTracker::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -1259,6 +1318,7 @@ void ValidationStateTracker::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t
         }
     }
     queue_state->PostSubmit();
+    SampleMemoryUsageIfDue();
 }
 
 void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
@@ -1315,49 +1375,67 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
         // Track objects tied to memory
+        // Binds are handed to the resource all at once, so its range map is updated once per resource and not once per page
+        std::vector<vvl::BindableMemoryTracker::SparseMemoryBind> sparse_binds;
+        auto get_memory = [this](VkDeviceMemory memory, std::shared_ptr<vvl::DeviceMemory> &last) {
+            // A virtual texturing update binds many pages out of the same memory
+            if (!last || last->VkHandle() != memory) {
+                last = Get<vvl::DeviceMemory>(memory);
+            }
+            return last;
+        };
+        std::shared_ptr<vvl::DeviceMemory> last_mem_state;
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer)) {
-                    buffer_state->BindMemory(buffer_state.get(), mem_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            const VkSparseBufferMemoryBindInfo &buffer_bind = bind_info.pBufferBinds[j];
+            auto buffer_state = Get<vvl::Buffer>(buffer_bind.buffer);
+            if (!buffer_state) continue;
+            sparse_binds.clear();
+            sparse_binds.reserve(buffer_bind.bindCount);
+            for (uint32_t k = 0; k < buffer_bind.bindCount; k++) {
+                const VkSparseMemoryBind &sparse_binding = buffer_bind.pBinds[k];
+                sparse_binds.push_back({get_memory(sparse_binding.memory, last_mem_state), sparse_binding.memoryOffset,
+                                        sparse_binding.resourceOffset, sparse_binding.size});
             }
+            buffer_state->BindMemoryRanges(buffer_state.get(), sparse_binds);
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image)) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            const VkSparseImageOpaqueMemoryBindInfo &image_opaque_bind = bind_info.pImageOpaqueBinds[j];
+            auto image_state = Get<vvl::Image>(image_opaque_bind.image);
+            if (!image_state) continue;
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder && image_opaque_bind.bindCount > 0) {
+                image_state->fragment_encoder = std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
             }
+            sparse_binds.clear();
+            sparse_binds.reserve(image_opaque_bind.bindCount);
+            for (uint32_t k = 0; k < image_opaque_bind.bindCount; k++) {
+                const VkSparseMemoryBind &sparse_binding = image_opaque_bind.pBinds[k];
+                sparse_binds.push_back({get_memory(sparse_binding.memory, last_mem_state), sparse_binding.memoryOffset,
+                                        sparse_binding.resourceOffset, sparse_binding.size});
+            }
+            image_state->BindMemoryRanges(image_state.get(), sparse_binds);
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageBinds[j].pBinds[k];
+            const VkSparseImageMemoryBindInfo &image_bind = bind_info.pImageBinds[j];
+            auto image_state = Get<vvl::Image>(image_bind.image);
+            if (!image_state) continue;
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder && image_bind.bindCount > 0) {
+                image_state->fragment_encoder = std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
+            }
+            sparse_binds.clear();
+            sparse_binds.reserve(image_bind.bindCount);
+            for (uint32_t k = 0; k < image_bind.bindCount; k++) {
+                const VkSparseImageMemoryBind &sparse_binding = image_bind.pBinds[k];
                 // TODO: This size is broken for non-opaque bindings, need to update to comprehend full sparse binding data
                 VkDeviceSize size = sparse_binding.extent.depth * sparse_binding.extent.height * sparse_binding.extent.width * 4;
                 VkDeviceSize offset = sparse_binding.offset.z * sparse_binding.offset.y * sparse_binding.offset.x * 4;
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<vvl::Image>(bind_info.pImageBinds[j].image)) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset, offset, size);
-                }
+                sparse_binds.push_back(
+                    {get_memory(sparse_binding.memory, last_mem_state), sparse_binding.memoryOffset, offset, size});
             }
+            image_state->BindMemoryRanges(image_state.get(), sparse_binds);
         }
         auto timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
         Location submit_loc = record_obj.location.dot(vvl::Field::pBindInfo, bind_idx);
@@ -1393,6 +1471,7 @@ void ValidationStateTracker::PostCallRecordQueueBindSparse(VkQueue queue, uint32
     if (record_obj.result != VK_SUCCESS) return;
     auto queue_state = Get<vvl::Queue>(queue);
     queue_state->PostSubmit();
+    SampleMemoryUsageIfDue();
 }
 
 void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
@@ -1523,12 +1602,7 @@ void ValidationStateTracker::PostCallRecordGetFenceStatus(VkDevice device, VkFen
 void ValidationStateTracker::RecordGetDeviceQueueState(uint32_t queue_family_index, uint32_t queue_index,
                                                        VkDeviceQueueCreateFlags flags, VkQueue queue) {
     if (Get<vvl::Queue>(queue) == nullptr) {
-        uint32_t num_queue_families = 0;
-        instance_dispatch_table.GetPhysicalDeviceQueueFamilyProperties(physical_device, &num_queue_families, nullptr);
-        std::vector<VkQueueFamilyProperties> queue_family_properties_list(num_queue_families);
-        instance_dispatch_table.GetPhysicalDeviceQueueFamilyProperties(physical_device, &num_queue_families,
-                                                                       queue_family_properties_list.data());
-
+        const auto &queue_family_properties_list = physical_device_state->queue_family_properties;
         Add(CreateQueue(queue, queue_family_index, queue_index, flags, queue_family_properties_list[queue_family_index]));
     }
 }
@@ -2098,15 +2172,21 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice de
                                                                      VkDescriptorSetLayout *pSetLayout,
                                                                      const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::DescriptorSetLayout>(pCreateInfo, *pSetLayout));
-}
-
-void ValidationStateTracker::PostCallRecordGetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
-                                                                         VkDeviceSize *pLayoutSizeInBytes,
-                                                                         const RecordObject &record_obj) {
-    if (auto descriptor_set_layout = Get<vvl::DescriptorSetLayout>(layout)) {
-        descriptor_set_layout->SetLayoutSizeInBytes(pLayoutSizeInBytes);
+    auto descriptor_set_layout = std::make_shared<vvl::DescriptorSetLayout>(pCreateInfo, *pSetLayout);
+    // The layout sizes and offsets can only be queried with the descriptorBuffer feature
+    if (enabled_features.descriptorBuffer &&
+        (pCreateInfo->flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0) {
+        vvl::DescriptorSetLayout::DescriptorBufferLayout descriptor_buffer_layout;
+        DispatchGetDescriptorSetLayoutSizeEXT(device, *pSetLayout, &descriptor_buffer_layout.size);
+        descriptor_buffer_layout.binding_offsets.resize(descriptor_set_layout->GetBindingCount());
+        for (uint32_t i = 0; i < descriptor_set_layout->GetBindingCount(); i++) {
+            const uint32_t binding = descriptor_set_layout->GetDescriptorSetLayoutBindingPtrFromIndex(i)->binding;
+            DispatchGetDescriptorSetLayoutBindingOffsetEXT(device, *pSetLayout, binding,
+                                                           &descriptor_buffer_layout.binding_offsets[i]);
+        }
+        descriptor_set_layout->SetDescriptorBufferLayout(std::move(descriptor_buffer_layout));
     }
+    Add(std::move(descriptor_set_layout));
 }
 
 void ValidationStateTracker::PostCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
@@ -2894,6 +2974,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
     // Using this function is the same as passing in VK_WHOLE_SIZE
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, VK_WHOLE_SIZE);
     cb_state->index_buffer_binding = vvl::IndexBufferBinding(buffer, buffer_size, offset, indexType);
+    cb_state->vertex_buffer_generation++;
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state] && buffer) {
@@ -2912,6 +2993,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer2KHR(VkCommandBuffer
     auto buffer_state = Get<vvl::Buffer>(buffer);
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, size);
     cb_state->index_buffer_binding = vvl::IndexBufferBinding(buffer, buffer_size, offset, indexType);
+    cb_state->vertex_buffer_generation++;
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state] && buffer) {
@@ -2924,6 +3006,7 @@ void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer c
                                                                const VkDeviceSize *pOffsets, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     cb_state->RecordCmd(record_obj.location.function);
+    cb_state->vertex_buffer_generation++;
 
     for (uint32_t i = 0; i < bindingCount; ++i) {
         auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
@@ -3251,11 +3334,21 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
                                            std::move(views)));
 }
 
+std::shared_ptr<vvl::RenderPass> ValidationStateTracker::CreateRenderPassState(VkRenderPass handle,
+                                                                               const VkRenderPassCreateInfo *pCreateInfo) const {
+    return std::make_shared<vvl::RenderPass>(handle, pCreateInfo);
+}
+
+std::shared_ptr<vvl::RenderPass> ValidationStateTracker::CreateRenderPassState(VkRenderPass handle,
+                                                                               const VkRenderPassCreateInfo2 *pCreateInfo) const {
+    return std::make_shared<vvl::RenderPass>(handle, pCreateInfo);
+}
+
 void ValidationStateTracker::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                             const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::RenderPass>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
@@ -3269,7 +3362,7 @@ void ValidationStateTracker::PostCallRecordCreateRenderPass2(VkDevice device, co
                                                              const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
 
-    Add(std::make_shared<vvl::RenderPass>(*pRenderPass, pCreateInfo));
+    Add(CreateRenderPassState(*pRenderPass, pCreateInfo));
 }
 
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
@@ -3302,6 +3395,7 @@ void ValidationStateTracker::PostCallRecordCmdBeginTransformFeedbackEXT(VkComman
 
     cb_state->RecordCmd(record_obj.location.function);
     cb_state->transform_feedback_active = true;
+    cb_state->render_state_generation++;
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer,
@@ -3312,6 +3406,7 @@ void ValidationStateTracker::PostCallRecordCmdEndTransformFeedbackEXT(VkCommandB
 
     cb_state->RecordCmd(record_obj.location.function);
     cb_state->transform_feedback_active = false;
+    cb_state->render_state_generation++;
 }
 
 void ValidationStateTracker::PostCallRecordCmdBeginConditionalRenderingEXT(
@@ -3322,6 +3417,7 @@ void ValidationStateTracker::PostCallRecordCmdBeginConditionalRenderingEXT(
     cb_state->RecordCmd(record_obj.location.function);
     cb_state->conditional_rendering_active = true;
     cb_state->conditional_rendering_inside_render_pass = cb_state->activeRenderPass != nullptr;
+    cb_state->render_state_generation++;
     cb_state->conditional_rendering_subpass = cb_state->GetActiveSubpass();
 }
 
@@ -3332,6 +3428,7 @@ void ValidationStateTracker::PostCallRecordCmdEndConditionalRenderingEXT(VkComma
     cb_state->RecordCmd(record_obj.location.function);
     cb_state->conditional_rendering_active = false;
     cb_state->conditional_rendering_inside_render_pass = false;
+    cb_state->render_state_generation++;
     cb_state->conditional_rendering_subpass = 0;
 }
 
@@ -4269,7 +4366,18 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(VkDevi
                                                                           VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate,
                                                                           const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo));
+    auto template_state = std::make_shared<vvl::DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo);
+    // Decode the template up front so updates with it only have to patch in the pData pointers
+    std::shared_ptr<const vvl::DescriptorSetLayout> dsl;
+    if (pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        dsl = Get<vvl::DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    } else if (auto layout_data = Get<vvl::PipelineLayout>(pCreateInfo->pipelineLayout)) {
+        dsl = layout_data->GetDsl(pCreateInfo->set);
+    }
+    if (dsl) {
+        template_state->GetDecodedLayout(*dsl);
+    }
+    Add(std::move(template_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplateKHR(
@@ -4474,17 +4582,9 @@ void ValidationStateTracker::PostCallRecordResetQueryPool(VkDevice device, VkQue
     auto query_pool_state = Get<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN(query_pool_state);
 
-    // Reset the state of existing entries.
+    // Reset the state of existing entries, of all the performance passes
     const uint32_t max_query_count = std::min(queryCount, query_pool_state->create_info.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->create_info.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
-        }
-    }
+    query_pool_state->SetQueryStates(firstQuery, max_query_count, 0, QUERYSTATE_RESET);
 }
 
 void ValidationStateTracker::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
@@ -4745,6 +4845,48 @@ void ValidationStateTracker::PostCallRecordCmdTraceRaysIndirect2KHR(VkCommandBuf
     cb_state->UpdateTraceRayCmd(record_obj.location.function);
 }
 
+// The same SPIR-V tends to be handed to the driver many times (per pipeline variant, per VkShaderModule, ...), and the
+// spirv::Module is never modified once built, so hand out the one already parsed instead of walking the binary again.
+std::shared_ptr<spirv::Module> ValidationStateTracker::GetOrCreateSpirvModule(size_t code_size, const uint32_t *code,
+                                                                              spirv::StatelessData *stateless_data) {
+    if (disabled[shader_validation_caching]) {
+        return std::make_shared<spirv::Module>(code_size, code, stateless_data);
+    }
+
+    const uint32_t hash = hash_util::ShaderHash(code, code_size);
+    {
+        ReadLockGuard guard(spirv_module_cache_lock_);
+        auto it = spirv_module_cache_.find(hash);
+        if (it != spirv_module_cache_.end()) {
+            auto module_state = it->second.module_state.lock();
+            // A hash hit still needs the full compare, which is far cheaper than the parse
+            if (module_state && (module_state->words_.size() * sizeof(uint32_t) == code_size) &&
+                std::equal(module_state->words_.begin(), module_state->words_.end(), code)) {
+                *stateless_data = *it->second.stateless_data;
+                return module_state;
+            }
+        }
+    }
+
+    auto module_state = std::make_shared<spirv::Module>(code_size, code, stateless_data);
+    // Modules with group decorations are rebuilt from the flattened binary, so they never match their own code
+    if (module_state->valid_spirv && !stateless_data->has_group_decoration) {
+        WriteLockGuard guard(spirv_module_cache_lock_);
+        if (spirv_module_cache_.size() >= spirv_module_cache_prune_size_) {
+            for (auto it = spirv_module_cache_.begin(); it != spirv_module_cache_.end();) {
+                if (it->second.module_state.expired()) {
+                    it = spirv_module_cache_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            spirv_module_cache_prune_size_ = std::max(spirv_module_cache_prune_size_, spirv_module_cache_.size() * 2);
+        }
+        spirv_module_cache_[hash] = {module_state, std::make_shared<const spirv::StatelessData>(*stateless_data)};
+    }
+    return module_state;
+}
+
 void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                              const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                              const RecordObject &record_obj,
@@ -4753,8 +4895,7 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
         return;
     }
 
-    chassis_state.module_state =
-        std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
+    chassis_state.module_state = GetOrCreateSpirvModule(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
     if (chassis_state.module_state && chassis_state.stateless_data.has_group_decoration) {
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
@@ -4778,16 +4919,17 @@ void ValidationStateTracker::PreCallRecordCreateShadersEXT(VkDevice device, uint
                                                            const VkShaderCreateInfoEXT *pCreateInfos,
                                                            const VkAllocationCallbacks *pAllocator, VkShaderEXT *pShaders,
                                                            const RecordObject &record_obj, chassis::ShaderObject &chassis_state) {
-    for (uint32_t i = 0; i < createInfoCount; ++i) {
+    // Each create info only writes its own module_states/stateless_data entry, so the parsing can be spread out
+    vvl::ParallelFor(validation_worker_pool.get(), createInfoCount, [&](uint32_t i) {
         if (pCreateInfos[i].codeSize == 0 || !pCreateInfos[i].pCode) {
-            continue;
+            return;
         }
         // don't need to worry about GroupDecoration with VK_EXT_shader_object
         if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) {
-            chassis_state.module_states[i] = std::make_shared<spirv::Module>(
+            chassis_state.module_states[i] = GetOrCreateSpirvModule(
                 pCreateInfos[i].codeSize, static_cast<const uint32_t *>(pCreateInfos[i].pCode), &chassis_state.stateless_data[i]);
         }
-    }
+    });
 }
 
 void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
@@ -4960,6 +5102,7 @@ void ValidationStateTracker::PostCallRecordCmdBindVertexBuffers2(VkCommandBuffer
     if (pStrides) {
         cb_state->RecordStateCmd(record_obj.location.function, CB_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE);
     }
+    cb_state->vertex_buffer_generation++;
 
     for (uint32_t i = 0; i < bindingCount; ++i) {
         auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
@@ -5171,6 +5314,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRenderingAttachmentLocationsKHR
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
 
     cb_state->rendering_attachments.set_color_locations = true;
+    cb_state->render_state_generation++;
     cb_state->rendering_attachments.color_locations.resize(pLocationInfo->colorAttachmentCount);
     for (size_t i = 0; i < pLocationInfo->colorAttachmentCount; ++i) {
         cb_state->rendering_attachments.color_locations[i] = pLocationInfo->pColorAttachmentLocations[i];
@@ -5182,6 +5326,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRenderingInputAttachmentIndices
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
 
     cb_state->rendering_attachments.set_color_indexes = true;
+    cb_state->render_state_generation++;
     cb_state->rendering_attachments.color_indexes.resize(pLocationInfo->colorAttachmentCount);
     for (size_t i = 0; i < pLocationInfo->colorAttachmentCount; ++i) {
         cb_state->rendering_attachments.color_indexes[i] = pLocationInfo->pColorAttachmentInputIndices[i];
@@ -5198,6 +5343,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRayTracingPipelineStackSizeKHR(
     // CB_DYNAMIC_STATE_RAY_TRACING_PIPELINE_STACK_SIZE_KHR);
     cb_state->dynamic_state_status.rtx_stack_size_cb = true;
     cb_state->dynamic_state_status.rtx_stack_size_pipeline = true;
+    cb_state->dynamic_state_generation++;
 }
 
 void ValidationStateTracker::PostCallRecordCmdSetVertexInputEXT(
@@ -5221,8 +5367,10 @@ void ValidationStateTracker::PostCallRecordCmdSetVertexInputEXT(
     }
 
     cb_state->dynamic_state_value.vertex_attribute_descriptions.resize(vertexAttributeDescriptionCount);
+    cb_state->dynamic_state_value.vertex_attribute_requirements.resize(vertexAttributeDescriptionCount);
     for (const auto [i, description] : vvl::enumerate(pVertexAttributeDescriptions, vertexAttributeDescriptionCount)) {
         cb_state->dynamic_state_value.vertex_attribute_descriptions[i] = *description;
+        cb_state->dynamic_state_value.vertex_attribute_requirements[i] = VertexInputState::GetAttributeRequirements(*description);
     }
 }
 
@@ -5577,6 +5725,10 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
     if (record_obj.device_address == 0) return;
     if (auto buffer_state = Get<vvl::Buffer>(pInfo->buffer)) {
         WriteLockGuard guard(buffer_address_lock_);
+        // Applications often query the address again each frame, the address range is already tracked then
+        if (buffer_state->deviceAddress == record_obj.device_address) {
+            return;
+        }
         // address is used for GPU-AV and ray tracing buffer validation
         buffer_state->deviceAddress = record_obj.device_address;
         const auto address_range = buffer_state->DeviceAddressRange();
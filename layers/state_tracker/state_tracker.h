@@ -22,16 +22,19 @@
 #include "generated/chassis.h"
 #include "utils/hash_vk_types.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/image_layout_map.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/device_features.h"
 #include "error_message/logging.h"
 #include "containers/custom_containers.h"
 #include "utils/android_ndk_types.h"
 #include "containers/range_vector.h"
+#include "containers/state_map.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace vvl {
@@ -84,7 +87,7 @@ struct StatelessData;
 using ShaderModuleUniqueIds = std::unordered_map<VkShaderStageFlagBits, uint32_t>;
 
 #define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)        \
-    vvl::concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;               \
+    vvl::ConcurrentStateMap<handle_type, std::shared_ptr<state_type>> map_member;                     \
     template <typename Dummy>                                                                         \
     struct MapTraits<state_type, Dummy> {                                                             \
         static constexpr bool kInstanceScope = instance_scope;                                        \
@@ -102,6 +105,18 @@ namespace state_object {
 template <typename StateType>
 struct Traits {};
 
+// Guards of GetRead()/GetWrite(), by the type stored in the ValidationStateTracker
+template <typename BaseType>
+struct LockGuards {
+    using Read = ReadLockGuard;
+    using Write = WriteLockGuard;
+};
+template <>
+struct LockGuards<vvl::CommandBuffer> {
+    using Read = RecordingReadLockGuard;
+    using Write = RecordingWriteLockGuard;
+};
+
 // Helper object to make the macros simpler
 // HandleType_ is a vulkan handle type
 // StateType_ is the type of the corresponding state object, which may be a derived type
@@ -114,8 +129,8 @@ struct TraitsBase {
     using HandleType = HandleType_;
     using SharedType = std::shared_ptr<StateType>;
     using ConstSharedType = std::shared_ptr<const StateType>;
-    using ReadLockedType = LockedSharedPtr<const StateType, ReadLockGuard>;
-    using WriteLockedType = LockedSharedPtr<StateType, WriteLockGuard>;
+    using ReadLockedType = LockedSharedPtr<const StateType, typename LockGuards<BaseType>::Read>;
+    using WriteLockedType = LockedSharedPtr<StateType, typename LockGuards<BaseType>::Write>;
 };
 }  // namespace state_object
 
@@ -297,6 +312,8 @@ class ValidationStateTracker : public ValidationObject {
         auto iter = map.pop(handle);
         if (iter != map.end()) {
             iter->second->Destroy();
+            // Another thread may still be using it through GetBorrowed()
+            state_epoch_.Retire(std::move(iter->second));
         }
     }
 
@@ -354,6 +371,35 @@ class ValidationStateTracker : public ValidationObject {
         return std::static_pointer_cast<State>(std::move(found_it->second));
     }
 
+    // GetBorrowed() is Get() without the shared_ptr copy, which saves two atomic reference count updates (and the cache line
+    // bouncing between threads that goes with them) per lookup in the hot vkCmd* validation paths.
+    // The returned pointer must not outlive the BorrowGuard() taken before the lookup, so keep it local to the hook and never
+    // store it. Objects destroyed concurrently stay alive (in the destroyed state) until every guard that could see them is
+    // released.
+    [[nodiscard]] vvl::StateEpoch::Guard BorrowGuard() const { return vvl::StateEpoch::Guard(state_epoch_); }
+
+    template <typename State, typename Traits = typename state_object::Traits<State>,
+              typename MapTraits = MapTraits<typename Traits::BaseType>>
+    State* GetBorrowed(typename Traits::HandleType handle) {
+        static_assert(!MapTraits::kInstanceScope, "Instance scope objects are retired by the instance");
+        return static_cast<State*>(GetStateMap<State>().find_borrowed(handle));
+    }
+
+    template <typename State, typename Traits = typename state_object::Traits<State>,
+              typename MapTraits = MapTraits<typename Traits::BaseType>>
+    const State* GetBorrowed(typename Traits::HandleType handle) const {
+        static_assert(!MapTraits::kInstanceScope, "Instance scope objects are retired by the instance");
+        return static_cast<const State*>(GetStateMap<State>().find_borrowed(handle));
+    }
+
+    void AddMemoryUsage(vvl::MemoryUsage& usage) const override;
+    // Called on every queue submission, samples once every memory_report_interval of them
+    void SampleMemoryUsageIfDue() const {
+        if (memory_report && memory_report->SampleDue(container_type)) {
+            SampleMemoryUsage();
+        }
+    }
+
     // GetRead() and GetWrite() return an already locked state object. Currently this is only supported by
     // vvl::CommandBuffer, because it has public ReadLock() and WriteLock() methods.
     // NOTE: Calling base class hook methods with a vvl::CommandBuffer lock held will lead to deadlock. Instead,
@@ -404,23 +450,38 @@ class ValidationStateTracker : public ValidationObject {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
-    vvl::span<vvl::Buffer*> GetBuffersByAddress(VkDeviceAddress address) {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer*>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
+    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
 
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    // Immutable copy of buffer_address_map_, looked up without taking buffer_address_lock_. Adding or removing an address
+    // range only changes buffer_device_address_ranges_version, the next lookup makes a new copy, so the buffers created in
+    // a row are only copied once.
+    struct BufferAddressSnapshot {
+        // Unique among the snapshots of all devices, identifies the snapshot in the last lookup of each thread
+        uint64_t id;
+        uint32_t version;
+        BufferAddressRangeMap map;
+    };
+
+    // The buffers found at an address, keeps the snapshot they were found in alive
+    class BuffersByAddress {
+      public:
+        BuffersByAddress() = default;
+        BuffersByAddress(std::shared_ptr<const BufferAddressSnapshot> snapshot, vvl::span<vvl::Buffer* const> buffers)
+            : snapshot_(std::move(snapshot)), buffers_(buffers) {}
+
+        operator vvl::span<vvl::Buffer* const>() const { return buffers_; }
+        vvl::Buffer* const* begin() const { return buffers_.begin(); }
+        vvl::Buffer* const* end() const { return buffers_.end(); }
+        size_t size() const { return buffers_.size(); }
+        bool empty() const { return buffers_.empty(); }
+
+      private:
+        std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+        vvl::span<vvl::Buffer* const> buffers_;
+    };
+
+    BuffersByAddress GetBuffersByAddress(VkDeviceAddress address) const;
 
     // Return a count pair, {written addresses count, total address ranges count}
     using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
@@ -838,6 +899,10 @@ class ValidationStateTracker : public ValidationObject {
                                                     const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                     const RecordObject& record_obj, PipelineStates& pipeline_states,
                                                     chassis::CreateRayTracingPipelinesKHR& chassis_state) override;
+    virtual std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle,
+                                                                   const VkRenderPassCreateInfo* pCreateInfo) const;
+    virtual std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle,
+                                                                   const VkRenderPassCreateInfo2* pCreateInfo) const;
     void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass,
                                         const RecordObject& record_obj) override;
@@ -891,6 +956,8 @@ class ValidationStateTracker : public ValidationObject {
     void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator,
                                        const RecordObject& record_obj) override;
 
+    std::shared_ptr<spirv::Module> GetOrCreateSpirvModule(size_t code_size, const uint32_t* code,
+                                                          spirv::StatelessData* stateless_data);
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          const RecordObject& record_obj, chassis::CreateShaderModule& chassis_state) override;
@@ -1623,8 +1690,6 @@ class ValidationStateTracker : public ValidationObject {
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
                                     const RecordObject& record_obj) override;
 
-    void PostCallRecordGetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
-                                                     VkDeviceSize* pLayoutSizeInBytes, const RecordObject& record_obj) override;
     void PreCallRecordCmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                        VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
                                                        const uint32_t* pBufferIndices, const VkDeviceSize* pOffsets,
@@ -1678,6 +1743,9 @@ class ValidationStateTracker : public ValidationObject {
         DispatchGetPhysicalDeviceProperties2Helper(gpu, &prop2);
     }
 
+    // Cached in the physical device state. The features of VkFormatProperties are included when VkFormatProperties3 is used
+    VkFormatProperties3KHR GetPDFormatProperties(const VkFormat format) const;
+
     VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkPhysicalDevice physical_device, bool has_format_feature2,
                                                     bool has_drm_modifiers, VkDevice device, VkImage image, VkFormat format,
                                                     VkImageTiling tiling);
@@ -1857,12 +1925,11 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<QueueFamilyExtensionProperties> queue_family_ext_props;
 
     bool performance_lock_acquired = false;
-    uint32_t buffer_device_address_ranges_version = 0;
+    // Incremented when a buffer device address range is added or removed
+    std::atomic<uint32_t> buffer_device_address_ranges_version{0};
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
-
-    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
-    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    mutable image_layout_map::EncoderCache subresource_encoder_cache_;
 
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
@@ -1878,7 +1945,13 @@ class ValidationStateTracker : public ValidationObject {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Only read and written with std::atomic_load/std::atomic_store, null until the first lookup
+    mutable std::shared_ptr<const BufferAddressSnapshot> buffer_address_snapshot_;
+    // Serializes the copies of buffer_address_map_, so that threads finding an old snapshot at the same time copy it once
+    mutable std::mutex buffer_address_snapshot_lock_;
 
+    // < format, features > of GetPotentialFormatFeatures(), which also depend on the enabled device extensions
+    mutable vvl::concurrent_unordered_map<VkFormat, VkFormatFeatureFlags2KHR> potential_format_features_;
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
     // < external format, colorAttachmentFormat > (VK_ANDROID_external_format_resolve)
@@ -1892,6 +1965,15 @@ class ValidationStateTracker : public ValidationObject {
     vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<vvl::ShaderModule>> shader_identifier_map_;
     mutable std::shared_mutex shader_identifier_map_lock_;
 
+    // Parsed SPIR-V, keyed by the hash of its code. Only holds weak references, the modules live as long as their users do
+    struct SpirvModuleCacheEntry {
+        std::weak_ptr<spirv::Module> module_state;
+        std::shared_ptr<const spirv::StatelessData> stateless_data;
+    };
+    vvl::unordered_map<uint32_t, SpirvModuleCacheEntry> spirv_module_cache_;
+    size_t spirv_module_cache_prune_size_ = 1024;
+    mutable std::shared_mutex spirv_module_cache_lock_;
+
     // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
     vvl::unordered_map<int, ExternalOpaqueInfo> fd_handle_map_;
     mutable std::shared_mutex fd_handle_map_lock_;
@@ -1938,6 +2020,8 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkPhysicalDevice, vvl::PhysicalDevice, physical_device_map_)
 
     std::atomic<vvl::StateObject::IdType> object_id_{1}; // 0 is an invalid id
+    // Keeps destroyed state objects alive while GetBorrowed() pointers to them may be in use
+    mutable vvl::StateEpoch state_epoch_;
 
     // Simple base address allocator allow allow VkDeviceMemory allocations to appear to exist in a common address space.
     // At 256GB allocated/sec  ( > 8GB at 30Hz), will overflow in just over 2 years
@@ -20,6 +20,9 @@
 #pragma once
 
 #include "vulkan/vulkan.h"
+#include "utils/vk_layer_utils.h"
+
+#include <limits>
 
 namespace vvl {
 class Buffer;
@@ -40,10 +43,16 @@ struct IndexBufferBinding {
     VkDeviceSize size;
     VkDeviceSize offset;
     VkIndexType index_type;
+    // Number of indices that fit in the bound size, so draws only compare firstIndex + indexCount against it
+    uint64_t max_index_count;
 
-    IndexBufferBinding() : buffer(VK_NULL_HANDLE), size(0), offset(0), index_type(static_cast<VkIndexType>(0)) {}
+    IndexBufferBinding()
+        : buffer(VK_NULL_HANDLE), size(0), offset(0), index_type(static_cast<VkIndexType>(0)), max_index_count(0) {}
     IndexBufferBinding(VkBuffer buffer_, VkDeviceSize size_, VkDeviceSize offset_, VkIndexType index_type_)
-        : buffer(buffer_), size(size_), offset(offset_), index_type(index_type_) {}
+        : buffer(buffer_), size(size_), offset(offset_), index_type(index_type_) {
+        const uint32_t index_size = GetIndexAlignment(index_type);
+        max_index_count = index_size ? size / index_size : std::numeric_limits<uint64_t>::max();
+    }
 
     void reset() { *this = IndexBufferBinding(); }
 };
@@ -251,7 +251,13 @@ void VideoProfileDesc::Cache::Release(VideoProfileDesc const *desc) {
 }
 
 VideoPictureResource::VideoPictureResource()
-    : image_view_state(nullptr), image_state(nullptr), base_array_layer(0), range(), coded_offset(), coded_extent() {}
+    : image_view_state(nullptr),
+      image_state(nullptr),
+      base_array_layer(0),
+      range(),
+      coded_offset(),
+      coded_extent(),
+      hash_(ComputeHash()) {}
 
 VideoPictureResource::VideoPictureResource(const ValidationStateTracker &dev_data, VkVideoPictureResourceInfoKHR const &res)
     : image_view_state(dev_data.Get<ImageView>(res.imageViewBinding)),
@@ -259,7 +265,15 @@ VideoPictureResource::VideoPictureResource(const ValidationStateTracker &dev_dat
       base_array_layer(res.baseArrayLayer),
       range(GetImageSubresourceRange(image_view_state.get(), res.baseArrayLayer)),
       coded_offset(res.codedOffset),
-      coded_extent(res.codedExtent) {}
+      coded_extent(res.codedExtent),
+      hash_(ComputeHash()) {}
+
+std::size_t VideoPictureResource::ComputeHash() const {
+    hash_util::HashCombiner hc;
+    hc << image_state.get() << range.baseMipLevel << range.baseArrayLayer << coded_offset.x << coded_offset.y
+       << coded_extent.width << coded_extent.height;
+    return hc.Value();
+}
 
 VkImageSubresourceRange VideoPictureResource::GetImageSubresourceRange(ImageView const *image_view_state, uint32_t layer) {
     VkImageSubresourceRange range{};
@@ -327,10 +341,9 @@ VideoPictureID::VideoPictureID(VideoProfileDesc const &profile, VkVideoReference
 
 void VideoSessionDeviceState::Reset() {
     initialized_ = true;
-    for (size_t i = 0; i < is_active_.size(); ++i) {
-        is_active_[i] = false;
-        all_pictures_[i].clear();
-        pictures_per_id_[i].clear();
+    for (DpbSlot &slot : slots_) {
+        slot.active = false;
+        slot.Clear();
     }
     encode_.quality_level = 0;
     encode_.rate_control_state = VideoEncodeRateControlState();
@@ -339,59 +352,47 @@ void VideoSessionDeviceState::Reset() {
 void VideoSessionDeviceState::Activate(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) {
     assert(!picture_id.IsBothFields());
 
-    is_active_[slot_index] = true;
+    DpbSlot &slot = slots_[slot_index];
+    slot.active = true;
 
     if (picture_id.IsFrame()) {
         // If slot is activated with a frame then it overrides all previous pictures
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        slot.Clear();
     }
 
-    auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-    if (prev_res_it != pictures_per_id_[slot_index].end()) {
-        // If we replace an existing picture then remove it
-        all_pictures_[slot_index].erase(prev_res_it->second);
+    // Replaces any existing picture with the same id
+    if (const uint32_t i = PictureIndex(picture_id); i < kPictureIdCount) {
+        slot.pictures[i] = res;
+        slot.picture_mask |= 1u << i;
     }
-
-    all_pictures_[slot_index].insert(res);
-    pictures_per_id_[slot_index][picture_id] = res;
 }
 
 void VideoSessionDeviceState::Invalidate(int32_t slot_index, const VideoPictureID &picture_id) {
     assert(!picture_id.IsBothFields());
 
-    bool previous_is_frame = pictures_per_id_[slot_index].find(VideoPictureID::Frame()) != pictures_per_id_[slot_index].end();
+    DpbSlot &slot = slots_[slot_index];
+    const bool previous_is_frame = (slot.picture_mask & (1u << PictureIndex(VideoPictureID::Frame()))) != 0;
     if (picture_id.IsFrame() || previous_is_frame) {
         // If invalidation happens due to a non-reference setup frame then it invalidates all previous pictures
         // Also invalidate all if the previous picture reference was a frame (e.g. a field invalidates a previous frame)
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        slot.Clear();
     } else {
         // Invalidate any existing picture reference with the specified id by removing it
-        auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-        if (prev_res_it != pictures_per_id_[slot_index].end()) {
-            VideoPictureResource res = prev_res_it->second;
-            pictures_per_id_[slot_index].erase(picture_id);
-            // Check if there are any more references to the previous resource
-            auto other_ref_it = std::find_if(std::begin(pictures_per_id_[slot_index]), std::end(pictures_per_id_[slot_index]),
-                                             [&res](const auto &it) { return it.second == res; });
-            if (other_ref_it == pictures_per_id_[slot_index].end()) {
-                // If there are no remaining references to the resource, remove it
-                all_pictures_[slot_index].erase(res);
-            }
+        if (const uint32_t i = PictureIndex(picture_id); i < kPictureIdCount) {
+            slot.pictures[i] = VideoPictureResource();
+            slot.picture_mask &= ~(1u << i);
         }
     }
 
     // If there are no remaining picture references then deactivate the slot
-    if (pictures_per_id_[slot_index].empty()) {
-        is_active_[slot_index] = false;
+    if (slot.picture_mask == 0) {
+        slot.active = false;
     }
 }
 
 void VideoSessionDeviceState::Deactivate(int32_t slot_index) {
-    is_active_[slot_index] = false;
-    all_pictures_[slot_index].clear();
-    pictures_per_id_[slot_index].clear();
+    slots_[slot_index].active = false;
+    slots_[slot_index].Clear();
 }
 
 class RateControlStateMismatchRecorder {
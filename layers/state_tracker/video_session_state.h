@@ -18,6 +18,7 @@
 #include "state_tracker/state_object.h"
 #include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <array>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -245,27 +246,17 @@ class VideoPictureResource {
     operator bool() const { return image_view_state != nullptr; }
 
     bool operator==(VideoPictureResource const &rhs) const {
-        return image_state == rhs.image_state && range.baseMipLevel == rhs.range.baseMipLevel &&
+        return hash_ == rhs.hash_ && image_state == rhs.image_state && range.baseMipLevel == rhs.range.baseMipLevel &&
                range.baseArrayLayer == rhs.range.baseArrayLayer && coded_offset.x == rhs.coded_offset.x &&
                coded_offset.y == rhs.coded_offset.y && coded_extent.width == rhs.coded_extent.width &&
                coded_extent.height == rhs.coded_extent.height;
     }
 
-    bool operator!=(VideoPictureResource const &rhs) const {
-        return image_state != rhs.image_state || range.baseMipLevel != rhs.range.baseMipLevel ||
-               range.baseArrayLayer != rhs.range.baseArrayLayer || coded_offset.x != rhs.coded_offset.x ||
-               coded_offset.y != rhs.coded_offset.y || coded_extent.width != rhs.coded_extent.width ||
-               coded_extent.height != rhs.coded_extent.height;
-    }
+    bool operator!=(VideoPictureResource const &rhs) const { return !(*this == rhs); }
 
     struct hash {
       public:
-        std::size_t operator()(VideoPictureResource const &res) const {
-            hash_util::HashCombiner hc;
-            hc << res.image_state.get() << res.range.baseMipLevel << res.range.baseArrayLayer << res.coded_offset.x
-               << res.coded_offset.y << res.coded_extent.width << res.coded_extent.height;
-            return hc.Value();
-        }
+        std::size_t operator()(VideoPictureResource const &res) const { return res.hash_; }
     };
 
     VkOffset3D GetEffectiveImageOffset(const vvl::VideoSession &vs_state) const;
@@ -273,6 +264,11 @@ class VideoPictureResource {
 
   private:
     VkImageSubresourceRange GetImageSubresourceRange(ImageView const *image_view_state, uint32_t layer);
+    std::size_t ComputeHash() const;
+
+    // The identity of the picture resource, computed once because resources are compared and hashed for every reference
+    // slot of every video coding command
+    std::size_t hash_;
 };
 
 using VideoPictureResources = unordered_set<VideoPictureResource, VideoPictureResource::hash>;
@@ -419,23 +415,25 @@ struct VideoEncodeRateControlState {
 
 class VideoSessionDeviceState {
   public:
-    VideoSessionDeviceState(uint32_t reference_slot_count = 0)
-        : initialized_(false),
-          is_active_(reference_slot_count, false),
-          all_pictures_(reference_slot_count),
-          pictures_per_id_(reference_slot_count),
-          encode_() {}
+    VideoSessionDeviceState(uint32_t reference_slot_count = 0) : initialized_(false), slots_(reference_slot_count), encode_() {}
 
     bool IsInitialized() const { return initialized_; }
-    bool IsSlotActive(int32_t slot_index) const { return is_active_[slot_index]; }
+    bool IsSlotActive(int32_t slot_index) const { return slots_[slot_index].active; }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureResource &res) const {
-        return all_pictures_[slot_index].find(res) != all_pictures_[slot_index].end();
+        const DpbSlot &slot = slots_[slot_index];
+        for (uint32_t i = 0; i < kPictureIdCount; ++i) {
+            if ((slot.picture_mask & (1u << i)) && slot.pictures[i] == res) {
+                return true;
+            }
+        }
+        return false;
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) const {
-        auto it = pictures_per_id_[slot_index].find(picture_id);
-        return it != pictures_per_id_[slot_index].end() && it->second == res;
+        const uint32_t i = PictureIndex(picture_id);
+        const DpbSlot &slot = slots_[slot_index];
+        return i < kPictureIdCount && (slot.picture_mask & (1u << i)) && slot.pictures[i] == res;
     }
 
     uint32_t GetEncodeQualityLevel() const { return encode_.quality_level; }
@@ -455,10 +453,27 @@ class VideoSessionDeviceState {
                                   const vku::safe_VkVideoBeginCodingInfoKHR &begin_info, const Location &loc) const;
 
   private:
+    // A DPB slot can hold a frame, or a top field and a bottom field
+    static constexpr uint32_t kPictureIdCount = 3;
+    static uint32_t PictureIndex(const VideoPictureID &picture_id) {
+        return picture_id.IsFrame() ? 0 : picture_id.IsTopField() ? 1 : picture_id.IsBottomField() ? 2 : kPictureIdCount;
+    }
+
+    struct DpbSlot {
+        bool active = false;
+        // Bit i is set if pictures[i] is the picture with PictureIndex i
+        uint32_t picture_mask = 0;
+        std::array<VideoPictureResource, kPictureIdCount> pictures{};
+
+        void Clear() {
+            picture_mask = 0;
+            pictures = {};
+        }
+    };
+
     bool initialized_;
-    std::vector<bool> is_active_;
-    std::vector<VideoPictureResources> all_pictures_;
-    std::vector<unordered_map<VideoPictureID, VideoPictureResource, VideoPictureID::hash>> pictures_per_id_;
+    // Indexed by DPB slot, copied from the session state for every submission, so it is kept flat
+    std::vector<DpbSlot> slots_;
 
     struct {
         uint32_t quality_level{0};
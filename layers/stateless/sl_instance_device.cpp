@@ -18,6 +18,7 @@
 
 #include "stateless/stateless_validation.h"
 #include "generated/layer_chassis_dispatch.h"
+#include "state_tracker/physical_device_cache.h"
 
 // Traits objects to allow string_join to operate on collections of const char *
 template <typename String>
@@ -243,18 +244,14 @@ void StatelessValidation::CommonPostCallRecordEnumeratePhysicalDevice(const VkPh
     for (int i = 0; i < count; ++i) {
         const auto &phys_device = phys_devices[i];
         if (0 == physical_device_properties_map.count(phys_device)) {
-            auto phys_dev_props = new VkPhysicalDeviceProperties;
-            DispatchGetPhysicalDeviceProperties(phys_device, phys_dev_props);
+            const auto phys_dev_info = vvl::GetPhysicalDeviceInfo(phys_device);
+            auto phys_dev_props = new VkPhysicalDeviceProperties(phys_dev_info->properties);
             physical_device_properties_map[phys_device] = phys_dev_props;
 
-            // Enumerate the Device Ext Properties to save the PhysicalDevice supported extension state
-            uint32_t ext_count = 0;
+            // Save the PhysicalDevice supported extension state
             vvl::unordered_set<vvl::Extension> dev_exts_enumerated{};
-            std::vector<VkExtensionProperties> ext_props{};
-            instance_dispatch_table.EnumerateDeviceExtensionProperties(phys_device, nullptr, &ext_count, nullptr);
-            ext_props.resize(ext_count);
-            instance_dispatch_table.EnumerateDeviceExtensionProperties(phys_device, nullptr, &ext_count, ext_props.data());
-            for (uint32_t j = 0; j < ext_count; j++) {
+            const std::vector<VkExtensionProperties> &ext_props = phys_dev_info->extensions;
+            for (size_t j = 0; j < ext_props.size(); j++) {
                 vvl::Extension extension = GetExtension(ext_props[j].extensionName);
                 dev_exts_enumerated.insert(extension);
 
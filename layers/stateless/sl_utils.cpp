@@ -117,7 +117,7 @@ static VkStringErrorFlags ValidateVkString(const int max_length, const char *utf
 }
 
 static const int kMaxParamCheckerStringLength = 256;
-bool StatelessValidation::ValidateString(const Location &loc, const std::string &vuid, const char *validateString) const {
+bool StatelessValidation::ValidateString(const Location &loc, const char *vuid, const char *validateString) const {
     bool skip = false;
 
     VkStringErrorFlags result = ValidateVkString(kMaxParamCheckerStringLength, validateString);
@@ -132,31 +132,46 @@ bool StatelessValidation::ValidateString(const Location &loc, const std::string
     return skip;
 }
 
-bool StatelessValidation::ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const {
-    bool skip = false;
-    if (is_zero) {
-        skip |= LogError(vuid, device, loc, "is zero.");
-    }
-    return skip;
+bool StatelessValidation::LogNotZeroError(const char *vuid, const Location &loc) const {
+    return LogError(vuid, device, loc, "is zero.");
 }
 
-/**
- * Validate a required pointer.
- *
- * Verify that a required pointer is not NULL.
- *
- * @param loc Name of API call being validated.
- * @param value Pointer to validate.
- * @return Boolean value indicating that the call should be skipped.
- */
-bool StatelessValidation::ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const {
-    bool skip = false;
+bool StatelessValidation::LogNullError(const char *vuid, const Location &loc) const {
+    return LogError(vuid, device, loc, "is NULL.");
+}
 
-    if (value == nullptr) {
-        skip |= LogError(vuid, device, loc, "is NULL.");
-    }
+bool StatelessValidation::LogZeroCountError(const char *vuid, const Location &count_loc) const {
+    return LogError(vuid, device, count_loc, "must be greater than 0.");
+}
 
-    return skip;
+bool StatelessValidation::LogStructTypeError(const char *vuid, const Location &loc, VkStructureType sType) const {
+    return LogError(vuid, device, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
+}
+
+bool StatelessValidation::LogStructTypeArrayError(const char *vuid, const Location &array_loc, uint32_t index,
+                                                  VkStructureType sType) const {
+    return LogError(vuid, device, array_loc.dot(index).dot(Field::sType), "must be %s", string_VkStructureType(sType));
+}
+
+bool StatelessValidation::LogNullHandleError(const Location &loc) const {
+    return LogError("UNASSIGNED-GeneralParameterError-RequiredHandle", device, loc, "is VK_NULL_HANDLE.");
+}
+
+bool StatelessValidation::LogNullHandleArrayError(const Location &array_loc, uint32_t index) const {
+    return LogError("UNASSIGNED-GeneralParameterError-RequiredHandleArray", device, array_loc.dot(index), "is VK_NULL_HANDLE.");
+}
+
+bool StatelessValidation::LogRangedEnumNotFoundError(const char *vuid, const Location &loc, vvl::Enum name, uint32_t value) const {
+    return LogError(vuid, device, loc,
+                    "(%" PRIu32
+                    ") does not fall within the begin..end range of the %s enumeration tokens and is "
+                    "not an extension added token.",
+                    value, String(name));
+}
+
+bool StatelessValidation::LogRangedEnumExtensionError(const char *vuid, const Location &loc, uint32_t value,
+                                                      const vvl::Extensions &extensions) const {
+    return LogError(vuid, device, loc, "(%" PRIu32 ") requires the extensions %s.", value, String(extensions).c_str());
 }
 
 bool StatelessValidation::ValidateAllocationCallbacks(const VkAllocationCallbacks &callback, const Location &loc) const {
@@ -241,8 +256,10 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
     bool skip = false;
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
+        // pNext chains are short, a linear search over inline storage keeps the success path free of allocations.
+        // The mask has one bit per sType modulo 64, the list only needs to be searched when the bit was already set.
+        small_vector<VkStructureType, 8> unique_stype_check;
+        uint64_t unique_stype_mask = 0;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -262,13 +279,18 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    std::string type_name = string_VkStructureType(current->sType);
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    const uint64_t stype_bit = uint64_t(1) << (static_cast<uint32_t>(current->sType) % 64);
+                    const bool seen = (unique_stype_mask & stype_bit) &&
+                                      std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                                          unique_stype_check.end();
+                    if (seen && !IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= LogError(stype_vuid, device, pNext_loc,
-                                         "chain contains duplicate structure types: %s appears multiple times.", type_name.c_str());
+                                         "chain contains duplicate structure types: %s appears multiple times.",
+                                         string_VkStructureType(current->sType));
                     } else {
-                        unique_stype_check.insert(current->sType);
+                        unique_stype_mask |= stype_bit;
+                        unique_stype_check.emplace_back(current->sType);
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
@@ -281,8 +303,9 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                     }
                     if (!custom) {
                         if (std::find(start, end, current->sType) == end) {
+                            const char *type_name = string_VkStructureType(current->sType);
                             // String returned by string_VkStructureType for an unrecognized type.
-                            if (type_name.compare("Unhandled VkStructureType") == 0) {
+                            if (strcmp(type_name, "Unhandled VkStructureType") == 0) {
                                 std::string message = "chain includes a structure with unknown VkStructureType (%" PRIu32 "). ";
                                 message += disclaimer;
                                 skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), current->sType, header_version,
@@ -290,7 +313,7 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                             } else {
                                 std::string message = "chain includes a structure with unexpected VkStructureType %s. ";
                                 message += disclaimer;
-                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name.c_str(), header_version,
+                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name, header_version,
                                                  pNext_loc.Fields().c_str());
                             }
                         }
@@ -420,6 +443,32 @@ bool StatelessValidation::ValidateFlagsImplementation(const Location &loc, vvl::
     return skip;
 }
 
+// A value needs no extension only if each of its bits doesn't, so the supported bits can be found once bit by bit.
+// Threads racing on the first use compute the same table.
+template <typename FlagTypedef>
+FlagTypedef StatelessValidation::GetSupportedFlagBits(vvl::FlagBitmask flag_bitmask, FlagTypedef all_flags) const {
+    SupportedFlagBits &entry = supported_flag_bits_[static_cast<size_t>(flag_bitmask)];
+    if (entry.ready.load(std::memory_order_acquire)) {
+        return static_cast<FlagTypedef>(entry.bits.load(std::memory_order_relaxed));
+    }
+    FlagTypedef supported = 0;
+    for (FlagTypedef remaining = all_flags; remaining != 0; remaining &= remaining - 1) {
+        const FlagTypedef bit = remaining & (~remaining + 1);
+        bool bit_supported = false;
+        if constexpr (sizeof(FlagTypedef) == sizeof(VkFlags64)) {
+            bit_supported = IsValidFlag64Value(flag_bitmask, bit, device_extensions).empty();
+        } else {
+            bit_supported = IsValidFlagValue(flag_bitmask, bit, device_extensions).empty();
+        }
+        if (bit_supported) {
+            supported |= bit;
+        }
+    }
+    entry.bits.store(supported, std::memory_order_relaxed);
+    entry.ready.store(true, std::memory_order_release);
+    return supported;
+}
+
 /**
  * Validate a 32 bit Vulkan bitmask value.
  *
@@ -445,7 +494,7 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
                          String(flag_bitmask));
     }
 
-    if (!skip && value != 0) {
+    if (!skip && value != 0 && (value & ~GetSupportedFlagBits<VkFlags>(flag_bitmask, all_flags)) != 0) {
         vvl::Extensions required = IsValidFlagValue(flag_bitmask, value, device_extensions);
         if (!required.empty() && device != VK_NULL_HANDLE) {
             // If called from an instance function, there is no device to base extension support off of
@@ -481,7 +530,7 @@ bool StatelessValidation::ValidateFlags(const Location &loc, vvl::FlagBitmask fl
                          String(flag_bitmask));
     }
 
-    if (!skip && value != 0) {
+    if (!skip && value != 0 && (value & ~GetSupportedFlagBits<VkFlags64>(flag_bitmask, all_flags)) != 0) {
         vvl::Extensions required = IsValidFlag64Value(flag_bitmask, value, device_extensions);
         if (!required.empty() && device != VK_NULL_HANDLE) {
             // If called from an instance function, there is no device to base extension support off of
@@ -78,13 +78,49 @@ class StatelessValidation : public ValidationObject {
     mutable std::mutex renderpass_map_mutex;
     vvl::unordered_map<VkRenderPass, SubpassesUsageStates> renderpasses_states;
 
+    // The bits of each flag type allowed by the enabled extensions. These never change for a device, and testing a value
+    // against them replaces the chain of extension checks of IsValidFlagValue for every flag that is valid.
+    struct SupportedFlagBits {
+        std::atomic<uint64_t> bits{0};
+        std::atomic<bool> ready{false};
+    };
+    mutable std::array<SupportedFlagBits, vvl::kFlagBitmaskCount> supported_flag_bits_;
+    template <typename FlagTypedef>
+    FlagTypedef GetSupportedFlagBits(vvl::FlagBitmask flag_bitmask, FlagTypedef all_flags) const;
+
     // Constructor for stateles validation tracking
     StatelessValidation() { container_type = LayerObjectTypeParameterValidation; }
     ~StatelessValidation() {}
 
-    bool ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const;
+    // The Validate* helpers below are inlined in every generated PreCallValidate*, they only test the condition and leave the
+    // message to one of these out of line functions
+    VVL_COLD bool LogNotZeroError(const char *vuid, const Location &loc) const;
+    VVL_COLD bool LogNullError(const char *vuid, const Location &loc) const;
+    VVL_COLD bool LogZeroCountError(const char *vuid, const Location &count_loc) const;
+    VVL_COLD bool LogStructTypeError(const char *vuid, const Location &loc, VkStructureType sType) const;
+    VVL_COLD bool LogStructTypeArrayError(const char *vuid, const Location &array_loc, uint32_t index, VkStructureType sType) const;
+    VVL_COLD bool LogNullHandleError(const Location &loc) const;
+    VVL_COLD bool LogNullHandleArrayError(const Location &array_loc, uint32_t index) const;
+    VVL_COLD bool LogRangedEnumNotFoundError(const char *vuid, const Location &loc, vvl::Enum name, uint32_t value) const;
+    VVL_COLD bool LogRangedEnumExtensionError(const char *vuid, const Location &loc, uint32_t value,
+                                              const vvl::Extensions &extensions) const;
+
+    bool ValidateNotZero(bool is_zero, const char *vuid, const Location &loc) const {
+        return is_zero ? LogNotZeroError(vuid, loc) : false;
+    }
 
-    bool ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const;
+    /**
+     * Validate a required pointer.
+     *
+     * Verify that a required pointer is not NULL.
+     *
+     * @param loc Name of API call being validated.
+     * @param value Pointer to validate.
+     * @return Boolean value indicating that the call should be skipped.
+     */
+    bool ValidateRequiredPointer(const Location &loc, const void *value, const char *vuid) const {
+        return value == nullptr ? LogNullError(vuid, loc) : false;
+    }
 
     bool ValidateAllocationCallbacks(const VkAllocationCallbacks &callback, const Location &loc) const;
 
@@ -95,12 +131,12 @@ class StatelessValidation : public ValidationObject {
 
         // Count parameters not tagged as optional cannot be 0
         if (countRequired && (count == 0)) {
-            skip |= LogError(count_required_vuid, device, count_loc, "must be greater than 0.");
+            skip |= LogZeroCountError(count_required_vuid, count_loc);
         }
 
         // Array parameters not tagged as optional cannot be NULL, unless the count is 0
         if (arrayRequired && (count != 0) && (*array == nullptr)) {
-            skip |= LogError(array_required_vuid, device, array_loc, "is NULL.");
+            skip |= LogNullError(array_required_vuid, array_loc);
         }
 
         return skip;
@@ -136,7 +172,7 @@ class StatelessValidation : public ValidationObject {
 
         if (count == nullptr) {
             if (countPtrRequired) {
-                skip |= LogError(count_ptr_required_vuid, device, count_loc, "is NULL.");
+                skip |= LogNullError(count_ptr_required_vuid, count_loc);
             }
         } else {
             skip |= ValidateArray(count_loc, array_loc, *array ? (*count) : 0, &array, countValueRequired, arrayRequired,
@@ -166,10 +202,10 @@ class StatelessValidation : public ValidationObject {
 
         if (value == nullptr) {
             if (required) {
-                skip |= LogError(struct_vuid, device, loc, "is NULL.");
+                skip |= LogNullError(struct_vuid, loc);
             }
         } else if (value->sType != sType) {
-            skip |= LogError(stype_vuid, device, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
+            skip |= LogStructTypeError(stype_vuid, loc, sType);
         }
 
         return skip;
@@ -204,8 +240,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i].sType != sType) {
-                    skip |= LogError(stype_vuid, device, array_loc.dot(i).dot(Field::sType), "must be %s",
-                                     string_VkStructureType(sType));
+                    skip |= LogStructTypeArrayError(stype_vuid, array_loc, i, sType);
                 }
             }
         }
@@ -242,8 +277,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i]->sType != sType) {
-                    skip |= LogError(stype_vuid, device, array_loc.dot(i).dot(Field::sType), "must be %s",
-                                     string_VkStructureType(sType));
+                    skip |= LogStructTypeArrayError(stype_vuid, array_loc, i, sType);
                 }
             }
         }
@@ -278,7 +312,7 @@ class StatelessValidation : public ValidationObject {
 
         if (count == nullptr) {
             if (countPtrRequired) {
-                skip |= LogError(count_ptr_required_vuid, device, count_loc, "is NULL.");
+                skip |= LogNullError(count_ptr_required_vuid, count_loc);
             }
         } else {
             skip |= ValidateStructTypeArray(count_loc, array_loc, (*count), array, sType, countValueRequired && (array != nullptr),
@@ -302,7 +336,7 @@ class StatelessValidation : public ValidationObject {
         bool skip = false;
 
         if (value == VK_NULL_HANDLE) {
-            skip |= LogError("UNASSIGNED-GeneralParameterError-RequiredHandle", device, loc, "is VK_NULL_HANDLE.");
+            skip |= LogNullHandleError(loc);
         }
         return skip;
     }
@@ -340,8 +374,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that no handles in the array are VK_NULL_HANDLE
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i] == VK_NULL_HANDLE) {
-                    skip |= LogError("UNASSIGNED-GeneralParameterError-RequiredHandleArray", device, array_loc.dot(i),
-                                     "is VK_NULL_HANDLE.");
+                    skip |= LogNullHandleArrayError(array_loc, i);
                 }
             }
         }
@@ -398,15 +431,10 @@ class StatelessValidation : public ValidationObject {
         ValidValue result = IsValidEnumValue(value);
 
         if (result == ValidValue::NotFound) {
-            skip |= LogError(vuid, device, loc,
-                             "(%" PRIu32
-                             ") does not fall within the begin..end range of the %s enumeration tokens and is "
-                             "not an extension added token.",
-                             value, String(name));
+            skip |= LogRangedEnumNotFoundError(vuid, loc, name, value);
         } else if (result == ValidValue::NoExtension && device != VK_NULL_HANDLE) {
             // If called from an instance function, there is no device to base extension support off of
-            auto extensions = GetEnumExtensions(value);
-            skip |= LogError(vuid, device, loc, "(%" PRIu32 ") requires the extensions %s.", value, String(extensions).c_str());
+            skip |= LogRangedEnumExtensionError(vuid, loc, value, GetEnumExtensions(value));
         }
 
         return skip;
@@ -446,16 +474,11 @@ class StatelessValidation : public ValidationObject {
             for (uint32_t i = 0; i < count; ++i) {
                 ValidValue result = IsValidEnumValue(array[i]);
                 if (result == ValidValue::NotFound) {
-                    skip |= LogError(array_required_vuid, device, array_loc.dot(i),
-                                     "(%" PRIu32
-                                     ") does not fall within the begin..end range of the %s enumeration tokens and is "
-                                     "not an extension added token.",
-                                     array[i], String(name));
+                    skip |= LogRangedEnumNotFoundError(array_required_vuid, array_loc.dot(i), name, array[i]);
                 } else if (result == ValidValue::NoExtension && device != VK_NULL_HANDLE) {
                     // If called from an instance function, there is no device to base extension support off of
-                    auto extensions = GetEnumExtensions(array[i]);
-                    skip |= LogError(array_required_vuid, device, array_loc.dot(i), "(%" PRIu32 ") requires the extensions %s.",
-                                     array[i], String(extensions).c_str());
+                    skip |=
+                        LogRangedEnumExtensionError(array_required_vuid, array_loc.dot(i), array[i], GetEnumExtensions(array[i]));
                 }
             }
         }
@@ -528,7 +551,7 @@ class StatelessValidation : public ValidationObject {
                                                      VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties,
                                                      const RecordObject &record_obj) override;
 
-    bool ValidateString(const Location &loc, const std::string &vuid, const char *validateString) const;
+    bool ValidateString(const Location &loc, const char *vuid, const char *validateString) const;
 
     bool ValidateCoarseSampleOrderCustomNV(const VkCoarseSampleOrderCustomNV &order, const Location &order_loc) const;
 
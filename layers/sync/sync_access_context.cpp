@@ -71,35 +71,52 @@ class HazardDetectFirstUse {
     const ResourceUsageRange &tag_range_;
 };
 
-AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
-                             const std::vector<SubpassDependencyGraphNode> &dependencies,
+SubpassBarriers::SubpassBarriers(VkQueueFlags queue_flags, const SubpassDependencyGraphNode &dependencies)
+    : async(dependencies.async) {
+    prev.reserve(dependencies.prev.size());
+    for (const auto &[prev_node, prev_dependencies] : dependencies.prev) {
+        assert(prev_dependencies.size());
+        auto &prev_barriers = prev.emplace_back(prev_node->pass, std::vector<SyncBarrier>()).second;
+        prev_barriers.reserve(prev_dependencies.size());
+        for (const VkSubpassDependency2 *dependency : prev_dependencies) {
+            prev_barriers.emplace_back(queue_flags, *dependency);
+        }
+    }
+    from_external.reserve(dependencies.barrier_from_external.size());
+    for (const VkSubpassDependency2 *dependency : dependencies.barrier_from_external) {
+        from_external.emplace_back(queue_flags, *dependency);
+    }
+    to_external.reserve(dependencies.barrier_to_external.size());
+    for (const VkSubpassDependency2 *dependency : dependencies.barrier_to_external) {
+        to_external.emplace_back(queue_flags, *dependency);
+    }
+}
+
+AccessContext::AccessContext(uint32_t subpass, const std::vector<SubpassBarriers> &subpass_barriers,
                              const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
     Reset();
-    const auto &subpass_dep = dependencies[subpass];
-    const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
-    prev_.reserve(subpass_dep.prev.size() + (has_barrier_from_external ? 1U : 0U));
+    const SubpassBarriers &barriers = subpass_barriers[subpass];
+    const bool has_barrier_from_external = !barriers.from_external.empty();
+    prev_.reserve(barriers.prev.size() + (has_barrier_from_external ? 1U : 0U));
     prev_by_subpass_.resize(subpass, nullptr);  // Can't be more prevs than the subpass we're on
-    for (const auto &prev_dep : subpass_dep.prev) {
-        const auto prev_pass = prev_dep.first->pass;
-        const auto &prev_barriers = prev_dep.second;
-        assert(prev_dep.second.size());
-        prev_.emplace_back(&contexts[prev_pass], queue_flags, prev_barriers);
+    for (const auto &[prev_pass, prev_barriers] : barriers.prev) {
+        prev_.emplace_back(&contexts[prev_pass], prev_barriers);
         prev_by_subpass_[prev_pass] = &prev_.back();
     }
 
-    async_.reserve(subpass_dep.async.size());
-    for (const auto async_subpass : subpass_dep.async) {
+    async_.reserve(barriers.async.size());
+    for (const auto async_subpass : barriers.async) {
         // Start tags are not known at creation time (as it's done at BeginRenderpass)
         async_.emplace_back(contexts[async_subpass], kInvalidTag, kQueueIdInvalid);
     }
 
     if (has_barrier_from_external) {
         // Store the barrier from external with the reat, but save pointer for "by subpass" lookups.
-        prev_.emplace_back(external_context, queue_flags, subpass_dep.barrier_from_external);
+        prev_.emplace_back(external_context, barriers.from_external);
         src_external_ = &prev_.back();
     }
-    if (subpass_dep.barrier_to_external.size()) {
-        dst_external_ = TrackBack(this, queue_flags, subpass_dep.barrier_to_external);
+    if (!barriers.to_external.empty()) {
+        dst_external_ = TrackBack(this, barriers.to_external);
     }
 }
 
@@ -107,6 +124,7 @@ template <typename NormalizeOp>
 void AccessContext::Trim(NormalizeOp &&normalize) {
     ForAll(std::forward<NormalizeOp>(normalize));
     sparse_container::consolidate(access_state_map_);
+    consolidated_size_ = access_state_map_.size();
 }
 
 void AccessContext::Trim() {
@@ -122,6 +140,56 @@ void AccessContext::TrimAndClearFirstAccess() {
     Trim(normalize);
 }
 
+void AccessContext::ConsolidateIfFragmented() {
+    // Small maps are cheap to search anyway
+    constexpr size_t kMinConsolidateSize = 256;
+    const size_t size = access_state_map_.size();
+    if (size < kMinConsolidateSize || size < 2 * consolidated_size_) {
+        return;
+    }
+    Consolidate();
+}
+
+void AccessContext::Consolidate() {
+    sparse_container::consolidate(access_state_map_);
+    consolidated_size_ = access_state_map_.size();
+}
+
+void AccessContext::AddBarrierToScopeSummary(const SyncBarrier &barrier, bool layout_transition) {
+    // The second scope becomes part of the read barriers and write dependency chains of the accesses in the first scope
+    scope_summary_.stages |= barrier.dst_exec_scope.exec_scope;
+    if (layout_transition) {
+        scope_summary_.accesses |= SyncStageAccess::UsageInfo(SYNC_IMAGE_LAYOUT_TRANSITION).stage_access_bit;
+    }
+}
+
+bool AccessContext::MayHaveAccessesInScope(const SyncBarrier &barrier) const {
+    // Contexts with previous contexts import accesses the summary knows nothing about
+    if (!scope_summary_.valid || !prev_.empty()) {
+        return true;
+    }
+    return (barrier.src_exec_scope.exec_scope & scope_summary_.stages) != 0 ||
+           barrier.src_access_scope.Intersects(scope_summary_.accesses);
+}
+
+bool AccessContext::MayHaveAccessesToWait(QueueId queue_id, ResourceUsageTag tag) const {
+    if (!wait_summary_.valid) {
+        return true;
+    }
+    for (const auto &[queue, min_tag] : wait_summary_.min_tags) {
+        if ((queue_id == kQueueAny || queue == queue_id) && min_tag <= tag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AccessContext::AddUsageToScopeSummary(SyncStageAccessIndex usage) {
+    const SyncStageAccessInfoType &usage_info = SyncStageAccess::UsageInfo(usage);
+    scope_summary_.stages |= usage_info.stage_mask;
+    scope_summary_.accesses |= usage_info.stage_access_bit;
+}
+
 void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     auto gather = [&used](const ResourceAccessRangeMap::value_type &access) { access.second.GatherReferencedTags(used); };
     ConstForAll(gather);
@@ -144,6 +212,12 @@ void AccessContext::ConstForAll(Action &&action) const {
 void AccessContext::ResolveFromContext(const AccessContext &from) {
     const NoopBarrierAction noop_barrier;
     from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
+    // The accesses are copied unchanged
+    scope_summary_.stages |= from.scope_summary_.stages;
+    scope_summary_.accesses |= from.scope_summary_.accesses;
+    scope_summary_.valid &= from.scope_summary_.valid && from.prev_.empty();
+    wait_summary_.valid = false;
+    ConsolidateIfFragmented();
 }
 
 void AccessContext::ResolvePreviousAccess(const ResourceAccessRange &range, ResourceAccessRangeMap *descent_map,
@@ -177,6 +251,8 @@ void AccessContext::ResolvePreviousAccesses() {
     if (!prev_.size()) return;  // If no previous contexts, nothing to do
 
     ResolvePreviousAccess(kFullRange, &access_state_map_, &default_state);
+    scope_summary_.valid = false;
+    wait_summary_.valid = false;
 }
 
 void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -190,6 +266,8 @@ void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccess
     const auto base_address = ResourceBaseAddress(buffer);
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag_ex);
     UpdateMemoryAccessRangeState(access_state_map_, action, range + base_address);
+    wait_summary_.valid = false;
+    AddUsageToScopeSummary(current_usage);
 }
 
 void AccessContext::UpdateAccessState(const ImageState &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -245,6 +323,7 @@ void AccessContext::UpdateAccessState(ImageRangeGen &range_gen, SyncStageAccessI
     }
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, ResourceUsageTagEx{tag});
     UpdateMemoryAccessState(action, range_gen);
+    AddUsageToScopeSummary(current_usage);
 }
 
 void AccessContext::UpdateAccessState(const ImageRangeGen &range_gen, SyncStageAccessIndex current_usage,
@@ -260,6 +339,9 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
         context.ResolveAccessRange(kFullRange, barrier_action, &access_state_map_, nullptr, false);
     }
+    scope_summary_.valid = false;
+    wait_summary_.valid = false;
+    ConsolidateIfFragmented();
 }
 
 // Caller must ensure that lifespan of this is less than the lifespan of from
@@ -550,6 +632,18 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
     return hazard;
 }
 
+void AccessContext::PrepareConcurrentLookups() const {
+    access_state_map_.get_implementation_map().prepare_concurrent_lookups();
+    for (const auto &prev : prev_) {
+        if (prev.source_subpass) {
+            prev.source_subpass->PrepareConcurrentLookups();
+        }
+    }
+    for (const auto &async_ref : async_) {
+        async_ref.Context().access_state_map_.get_implementation_map().prepare_concurrent_lookups();
+    }
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
@@ -558,6 +652,13 @@ AttachmentViewGen::AttachmentViewGen(const syncval_state::ImageViewState *image_
                                      const VkExtent3D &extent)
     : view_(image_view), view_mask_(image_view->normalized_subresource_range.aspectMask), gen_store_() {
     gen_store_[Gen::kViewSubresource].emplace(image_view->GetFullViewImageRangeGen());
+    if (image_view->IsFullViewRenderArea(offset, extent)) {
+        // The render area usually is the whole attachment, copy the generators the view built at creation
+        gen_store_[Gen::kRenderArea].emplace(image_view->GetFullViewImageRangeGen());
+        gen_store_[Gen::kDepthOnlyRenderArea] = image_view->GetFullViewDepthRangeGen();
+        gen_store_[Gen::kStencilOnlyRenderArea] = image_view->GetFullViewStencilRangeGen();
+        return;
+    }
     gen_store_[Gen::kRenderArea].emplace(image_view->MakeImageRangeGen(offset, extent));
 
     const auto depth = view_mask_ & VK_IMAGE_ASPECT_DEPTH_BIT;
@@ -19,6 +19,7 @@
 
 #include "sync/sync_common.h"
 #include "sync/sync_access_state.h"
+#include "sync/sync_stats.h"
 
 struct SubpassDependencyGraphNode;
 
@@ -220,11 +221,25 @@ struct SubpassBarrierTrackback {
             barriers.emplace_back(queue_flags_, *dependency);
         }
     }
+    SubpassBarrierTrackback(const SubpassNode *source_subpass_, const std::vector<SyncBarrier> &barriers_)
+        : barriers(barriers_), source_subpass(source_subpass_) {}
     SubpassBarrierTrackback(const SubpassNode *source_subpass_, const SyncBarrier &barrier_)
         : barriers(1, barrier_), source_subpass(source_subpass_) {}
     SubpassBarrierTrackback &operator=(const SubpassBarrierTrackback &) = default;
 };
 
+// Barriers of a subpass with the subpasses it depends on and with the external scope. They only depend on the render pass
+// and on the queue flags, syncval_state::RenderPass builds them once for all the instances of the render pass.
+struct SubpassBarriers {
+    // Earlier subpass index and the barriers from it
+    std::vector<std::pair<uint32_t, std::vector<SyncBarrier>>> prev;
+    std::vector<uint32_t> async;
+    std::vector<SyncBarrier> from_external;
+    std::vector<SyncBarrier> to_external;
+
+    SubpassBarriers(VkQueueFlags queue_flags, const SubpassDependencyGraphNode &dependencies);
+};
+
 class AttachmentViewGen {
   public:
     enum Gen { kViewSubresource = 0, kRenderArea = 1, kDepthOnlyRenderArea = 2, kStencilOnlyRenderArea = 3, kGenSize = 4 };
@@ -286,6 +301,9 @@ class AccessContext {
 
     HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
                                       const AccessContext &access_context) const;
+    // Makes hazard detection against this context (and the contexts it looks at) safe to run from several threads at once,
+    // as long as none of them is changed in the meantime
+    void PrepareConcurrentLookups() const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -296,6 +314,9 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         access_state_map_.clear();
+        consolidated_size_ = 0;
+        scope_summary_ = ScopeSummary();
+        wait_summary_ = WaitSummary();
     }
 
     void ResolvePreviousAccesses();
@@ -336,17 +357,33 @@ class AccessContext {
     template <typename Action>
     void ApplyToContext(const Action &barrier_action);
 
-    AccessContext(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
+    AccessContext(uint32_t subpass, const std::vector<SubpassBarriers> &subpass_barriers,
                   const std::vector<AccessContext> &contexts, const AccessContext *external_context);
 
     AccessContext() { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
     void Trim();
     void TrimAndClearFirstAccess();
+    // Merges adjacent ranges with equal access state, but only once the map grew to twice the size it had after the last
+    // consolidation, which keeps the cost linear in the number of entries added. Must not be called with pending barriers.
+    void ConsolidateIfFragmented();
+    // Same merge whatever the size of the map, for contexts that are done changing but are still resolved from
+    void Consolidate();
+    // Barriers applied to the map outside of the AccessContext methods must be added to the scope summary
+    void AddBarrierToScopeSummary(const SyncBarrier &barrier, bool layout_transition);
+    // False when no access state of the map can be in the first scope of the barrier, which then can't change any of them
+    bool MayHaveAccessesInScope(const SyncBarrier &barrier) const;
+    // False when none of the accesses left by the last tagged wait is from queue_id (from any queue for kQueueAny) and tagged
+    // at or before tag, in which case the tagged wait has nothing to clear
+    bool MayHaveAccessesToWait(QueueId queue_id, ResourceUsageTag tag) const;
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
     ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
     const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
+    // Estimated host memory of the access map, for the memory report
+    size_t GetMemoryUsage() const {
+        return sizeof(*this) + access_state_map_.size() * sizeof(ResourceAccessRangeMap::value_type);
+    }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return src_external_;
@@ -365,6 +402,9 @@ class AccessContext {
     void ConstForAll(Action &&action) const;
     template <typename Predicate>
     void EraseIf(Predicate &&pred);
+    // Applies a WaitQueueTagPredicate or WaitTagPredicate wait to every access state, and summarizes what is left of them
+    template <typename Predicate>
+    void ApplyTaggedWait(Predicate &predicate);
 
     // For use during queue submit building up the QueueBatchContext AccessContext for validation, otherwise clear.
     void AddAsyncContext(const AccessContext *context, ResourceUsageTag tag, QueueId queue_id);
@@ -454,7 +494,29 @@ class AccessContext {
     template <typename Detector>
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
 
+    void AddUsageToScopeSummary(SyncStageAccessIndex usage);
+
+    // Superset of what the first scope of a barrier is tested against, over all the access states of the map: the read stages,
+    // read barriers and write dependency chains in stages, the last writes in accesses. Only grows until the next Reset, the
+    // updates it can't follow (imports from other contexts) make it invalid instead.
+    struct ScopeSummary {
+        VkPipelineStageFlags2KHR stages = VK_PIPELINE_STAGE_2_NONE;
+        SyncStageAccessFlags accesses;
+        bool valid = true;
+    };
+
+    // Smallest tag, for each queue, of the accesses a tagged wait can clear. Built by ApplyTaggedWait, it stays a lower bound
+    // while accesses are only erased (waits, Trim) and is invalid once the map is updated otherwise.
+    struct WaitSummary {
+        std::vector<std::pair<QueueId, ResourceUsageTag>> min_tags;
+        bool valid = false;
+    };
+
     ResourceAccessRangeMap access_state_map_;
+    // Size of access_state_map_ after it was last consolidated
+    size_t consolidated_size_ = 0;
+    ScopeSummary scope_summary_;
+    WaitSummary wait_summary_;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
@@ -480,10 +542,13 @@ struct ActionToOpsAdapter {
 
         // Need to apply the action to the Infill.  'infill_update_range' expect ops.infill to be completely done with
         // the infill_range, where as Action::Infill assumes the caller will apply the action() logic to the infill_range
+        uint64_t infill_count = 0;
         for (; infill != pos; ++infill) {
             assert(infill != accesses.end());
             action(infill);
+            ++infill_count;
         }
+        syncval_stats::AddInfilledEntries(infill_count);
     }
     void update(const Iterator &pos) const { action(pos); }
     const Action &action;
@@ -492,6 +557,7 @@ struct ActionToOpsAdapter {
 template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
+    // Only used to resolve pending barriers, which were added to the scope summary when applied
     UpdateMemoryAccessRangeState(access_state_map_, barrier_action, kFullRange);
 }
 
@@ -499,13 +565,18 @@ template <typename Action>
 void AccessContext::UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action,
                                                  const ResourceAccessRange &range) {
     ActionToOpsAdapter<Action> ops{action};
+    const size_t size_before = accesses.size();
     infill_update_range(accesses, range, ops);
+    syncval_stats::AddEntries(accesses.size() - size_before);
 }
 
 template <typename Action, typename RangeGen>
 void AccessContext::UpdateMemoryAccessState(const Action &action, RangeGen &range_gen) {
     ActionToOpsAdapter<Action> ops{action};
+    const size_t size_before = access_state_map_.size();
     infill_update_rangegen(access_state_map_, range_gen, ops);
+    syncval_stats::AddEntries(access_state_map_.size() - size_before);
+    wait_summary_.valid = false;
 }
 
 template <typename Action>
@@ -514,6 +585,7 @@ void AccessContext::ApplyUpdateAction(const AttachmentViewGen &view_gen, Attachm
     if (ref_range_gen) {
         ImageRangeGen range_gen(*ref_range_gen);
         UpdateMemoryAccessState(action, range_gen);
+        scope_summary_.valid = false;
     }
 }
 
@@ -655,6 +727,7 @@ void AccessContext::ResolveAccessRange(const ResourceAccessRange &range, Barrier
 template <typename Detector, typename RangeGen>
 HazardResult AccessContext::DetectHazardGeneratedRanges(Detector &detector, RangeGen &range_gen, DetectOptions options) const {
     HazardResult hazard;
+    syncval_stats::AddHazardCheck();
 
     // Do this before range_gen is incremented s.t. the copies used will be correct
     if (static_cast<uint32_t>(options) & DetectOptions::kDetectAsync) {
@@ -699,10 +772,28 @@ void AccessContext::EraseIf(Predicate &&pred) {
     vvl::EraseIf(access_state_map_, pred);
 }
 
+template <typename Predicate>
+void AccessContext::ApplyTaggedWait(Predicate &predicate) {
+    WaitSummary summary;
+    vvl::EraseIf(access_state_map_, [&predicate, &summary](ResourceAccessRangeMap::value_type &access) {
+        // Apply..Wait returns true if the waited access is empty...
+        if (access.second.ApplyPredicatedWait<Predicate>(predicate)) {
+            return true;
+        }
+        access.second.GatherWaitableTags(summary.min_tags);
+        return false;
+    });
+    summary.valid = true;
+    wait_summary_ = std::move(summary);
+}
+
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
     from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
+    scope_summary_.valid = false;
+    wait_summary_.valid = false;
+    ConsolidateIfFragmented();
 }
 
 template <typename ResolveOp, typename RangeGenerator>
@@ -711,6 +802,9 @@ void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessConte
     for (; range_gen->non_empty(); ++range_gen) {
         from_context.ResolveAccessRange(*range_gen, resolve_op, &access_state_map_, infill_state, recur_to_infill);
     }
+    scope_summary_.valid = false;
+    wait_summary_.valid = false;
+    ConsolidateIfFragmented();
 }
 
 template <typename BarrierAction>
@@ -17,6 +17,7 @@
 
 #pragma once
 #include "sync/sync_common.h"
+#include "utils/arena_allocator.h"
 
 class ResourceAccessState;
 class ResourceAccessWriteState;
@@ -26,19 +27,19 @@ struct ResourceFirstAccess;
 //       rules apply only to this specific access for this stage, and not the stage as a whole. The ordering detection
 //       also reflects this special case for read hazard detection (using access instead of exec scope)
 constexpr VkPipelineStageFlags2KHR kColorAttachmentExecScope = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR;
-const SyncStageAccessFlags kColorAttachmentAccessScope =
+constexpr SyncStageAccessFlags kColorAttachmentAccessScope =
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_BIT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 constexpr VkPipelineStageFlags2KHR kDepthStencilAttachmentExecScope =
     VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR;
-const SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
+constexpr SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
     SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 constexpr VkPipelineStageFlags2KHR kRasterAttachmentExecScope = kDepthStencilAttachmentExecScope | kColorAttachmentExecScope;
-const SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
+constexpr SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
 
 enum SyncHazard {
     NONE = 0,
@@ -64,12 +65,17 @@ enum class SyncOrdering : uint8_t {
 };
 const char *string_SyncHazard(SyncHazard hazard);
 const char *string_SyncHazardVUID(SyncHazard hazard);
+// True for hazards against a prior read
+bool IsHazardVsRead(SyncHazard hazard);
 
 class HazardResult {
   public:
+    // Only keeps what the hazard message needs. The message itself is formatted by FormatHazard, if the hazard is reported.
     struct HazardState {
-        std::unique_ptr<const ResourceAccessState> access_state;
         std::unique_ptr<const ResourceFirstAccess> recorded_access;
+        // Barriers of the prior access, read barriers for hazards against a read, write barriers otherwise
+        VkPipelineStageFlags2KHR read_barriers = 0;
+        SyncStageAccessFlags write_barriers;
         SyncStageAccessIndex usage_index = std::numeric_limits<SyncStageAccessIndex>::max();
         SyncStageAccessFlags prior_access;
         ResourceUsageTag tag = ResourceUsageTag();
@@ -275,10 +281,10 @@ class ResourceAccessState : public SyncStageAccess {
     // but only up to one per pipeline stage (as another read from the *same* stage become more recent,
     // and applicable one for hazard detection
     struct ReadState {
-        VkPipelineStageFlags2KHR stage;        // The stage of this read
-        SyncStageAccessFlags access;           // TODO: Change to FlagBits when we have a None bit enum
-                                               // TODO: Revisit whether this needs to support multiple reads per stage
-        VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
+        VkPipelineStageFlags2KHR stage;         // The stage of this read
+        const SyncStageAccessInfoType *access;  // Single stage/access bit, referenced instead of copying the full mask
+                                                // TODO: Revisit whether this needs to support multiple reads per stage
+        VkPipelineStageFlags2KHR barriers;      // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
         ResourceUsageTag tag;
         uint32_t handle_index;
@@ -286,9 +292,9 @@ class ResourceAccessState : public SyncStageAccess {
         VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
                                                      // Excluded from comparison
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
-                  ResourceUsageTagEx tag_ex);
+        ReadState(const SyncStageAccessInfoType &usage_info, VkPipelineStageFlags2KHR barriers_, ResourceUsageTagEx tag_ex);
         ResourceUsageTagEx TagEx() const { return {tag, handle_index}; }
+        const SyncStageAccessFlags &AccessBit() const { return access->stage_access_bit; }
         bool operator==(const ReadState &rhs) const {
             return (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
                    (sync_stages == rhs.sync_stages) && (tag == rhs.tag) && (queue == rhs.queue) &&
@@ -325,8 +331,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
-                 ResourceUsageTagEx tag_ex);
+        void Set(const SyncStageAccessInfoType &usage_info, VkPipelineStageFlags2KHR barriers_, ResourceUsageTagEx tag_ex);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
         bool ReadInEventScope(VkPipelineStageFlags2 exec_scope, QueueId scope_queue, ResourceUsageTag scope_tag) const {
@@ -395,6 +400,9 @@ class ResourceAccessState : public SyncStageAccess {
     };
     friend WaitAcquirePredicate;
 
+    // Lowers the per queue minimum of min_tags to the tags of the reads and the write that a tagged wait could clear
+    void GatherWaitableTags(std::vector<std::pair<QueueId, ResourceUsageTag>> &min_tags) const;
+
     template <typename Predicate>
     bool ApplyPredicatedWait(Predicate &predicate);
 
@@ -511,7 +519,9 @@ class ResourceAccessState : public SyncStageAccess {
 
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
-    using ReadStates = small_vector<ReadState, 3, uint32_t>;
+    // Almost all resources have a single outstanding read, keep that one inline and spill the rest to the heap so that
+    // the copies made by the range map infill/split stay small
+    using ReadStates = small_vector<ReadState, 1, uint32_t>;
     ReadStates last_reads;
 
     // TODO Input Attachment cleanup for multiple reads in a given stage
@@ -530,7 +540,13 @@ class ResourceAccessState : public SyncStageAccess {
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+// Submit time hazard detection does many lookups into large, stable access maps, which the flat index backend speeds up.
+// The nodes come from the size-class pools of the syncval arena.
+using ResourceAccessRangeImplMap = sparse_container::flat_indexed_range_map<
+    ResourceAddress, ResourceAccessState, ResourceAccessRange,
+    vvl::ArenaAllocator<std::pair<const ResourceAccessRange, ResourceAccessState>, vvl::Arena::SyncVal>>;
+using ResourceAccessRangeMap =
+    sparse_container::range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange, ResourceAccessRangeImplMap>;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
@@ -16,6 +16,9 @@
  */
 
 #include "sync/sync_commandbuffer.h"
+
+#include <algorithm>
+
 #include "sync/sync_op.h"
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
@@ -24,18 +27,16 @@
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/shader_module.h"
+#include "chassis/memory_report.h"
 
-SyncStageAccessIndex GetSyncStageAccessIndexsByDescriptorSet(VkDescriptorType descriptor_type,
-                                                             const spirv::ResourceInterfaceVariable &variable,
-                                                             VkShaderStageFlagBits stage_flag) {
-    if (!variable.IsAccessed()) {
+SyncStageAccessIndex syncval_state::DescriptorAccess::GetAccess(VkDescriptorType descriptor_type) const {
+    if (!variable->IsAccessed()) {
         return SYNC_ACCESS_INDEX_NONE;
     }
     if (descriptor_type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT) {
-        assert(stage_flag == VK_SHADER_STAGE_FRAGMENT_BIT);
+        assert(stage == VK_SHADER_STAGE_FRAGMENT_BIT);
         return SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ;
     }
-    const auto stage_accesses = sync_utils::GetShaderStageAccesses(stage_flag);
 
     if (descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) {
         return stage_accesses.uniform_read;
@@ -44,14 +45,14 @@ SyncStageAccessIndex GetSyncStageAccessIndexsByDescriptorSet(VkDescriptorType de
     // If the desriptorSet is writable, we don't need to care SHADER_READ. SHADER_WRITE is enough.
     // Because if write hazard happens, read hazard might or might not happen.
     // But if write hazard doesn't happen, read hazard is impossible to happen.
-    if (variable.IsWrittenTo()) {
+    if (variable->IsWrittenTo()) {
         return stage_accesses.storage_write;
     } else if (descriptor_type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE ||
                descriptor_type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
                descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER) {
         return stage_accesses.sampled_read;
     } else {
-        if (variable.IsImage() && !variable.IsImageReadFrom()) {
+        if (variable->IsImage() && !variable->IsImageReadFrom()) {
             // only image descriptor was accessed, not the image data
             return SYNC_ACCESS_INDEX_NONE;
         }
@@ -65,6 +66,132 @@ bool CommandExecutionContext::ValidForSyncOps() const {
     return valid;
 }
 
+void ResourceUsageLog::clear() {
+    entries_.clear();
+    origins_.clear();
+    wide_origins_.clear();
+    alt_usages_.clear();
+    last_origin_ = 0;
+}
+
+uint32_t ResourceUsageLog::FindOrAddOrigin(const Origin &origin) {
+    // A command buffer log has the origin of its recording and one per executed secondary recording
+    if (last_origin_ < origins_.size() && origins_[last_origin_] == origin) {
+        return last_origin_;
+    }
+    auto found = std::find(origins_.begin(), origins_.end(), origin);
+    if (found == origins_.end()) {
+        found = origins_.insert(found, origin);
+    }
+    last_origin_ = static_cast<uint32_t>(found - origins_.begin());
+    return last_origin_;
+}
+
+uint32_t ResourceUsageLog::GetOrigin(size_t index) const {
+    const uint32_t origin = entries_[index].OriginIndex();
+    if (origin != kWideOrigin) {
+        return origin;
+    }
+    const auto found =
+        std::lower_bound(wide_origins_.begin(), wide_origins_.end(), std::make_pair(static_cast<uint32_t>(index), 0u));
+    assert(found != wide_origins_.end() && found->first == index);
+    return found->second;
+}
+
+void ResourceUsageLog::PushEntry(Entry entry, uint32_t origin_index) {
+    if (origin_index < kWideOrigin) {
+        entry.SetTypeAndOrigin(entry.Type(), origin_index);
+    } else {
+        entry.SetTypeAndOrigin(entry.Type(), kWideOrigin);
+        wide_origins_.emplace_back(static_cast<uint32_t>(entries_.size()), origin_index);
+    }
+    entries_.emplace_back(entry);
+}
+
+void ResourceUsageLog::Append(vvl::Func command, uint32_t seq_num, SubcommandType sub_command_type, uint32_t sub_command,
+                              const vvl::CommandBuffer *cb_state, uint32_t reset_count, uint32_t label_command_index) {
+    assert(static_cast<uint32_t>(command) <= std::numeric_limits<uint16_t>::max());
+    Entry entry;
+    entry.seq_num = seq_num;
+    entry.sub_command = sub_command;
+    entry.label_command_index = label_command_index;
+    entry.command = static_cast<uint16_t>(command);
+    entry.SetTypeAndOrigin(static_cast<uint32_t>(sub_command_type), 0);
+    PushEntry(entry, FindOrAddOrigin(Origin{cb_state, reset_count}));
+}
+
+void ResourceUsageLog::PushAlternateEntry() {
+    Entry entry;
+    entry.seq_num = 0;
+    entry.sub_command = static_cast<uint32_t>(alt_usages_.size() - 1);
+    entry.label_command_index = vvl::kNoIndex32;
+    entry.command = static_cast<uint16_t>(vvl::Func::Empty);
+    entry.SetTypeAndOrigin(kAlternateType, 0);
+    entries_.emplace_back(entry);
+}
+
+void ResourceUsageLog::AppendAlternate(const AlternateResourceUsage::RecordBase &alt_record) {
+    alt_usages_.emplace_back(alt_record);
+    PushAlternateEntry();
+}
+
+void ResourceUsageLog::AppendCopy(const ResourceUsageRecord &record) {
+    if (record.alt_usage) {
+        alt_usages_.emplace_back(*record.alt_usage);
+        PushAlternateEntry();
+    } else {
+        Append(record.command, record.seq_num, record.sub_command_type, record.sub_command, record.cb_state,
+               record.reset_count, record.label_command_index);
+    }
+}
+
+void ResourceUsageLog::Import(const ResourceUsageLog &other, uint32_t label_command_offset) {
+    std::vector<uint32_t> origin_map(other.origins_.size());
+    for (size_t i = 0; i < other.origins_.size(); ++i) {
+        origin_map[i] = FindOrAddOrigin(other.origins_[i]);
+    }
+    const uint32_t alt_usage_base = static_cast<uint32_t>(alt_usages_.size());
+    alt_usages_.insert(alt_usages_.end(), other.alt_usages_.begin(), other.alt_usages_.end());
+
+    entries_.reserve(entries_.size() + other.entries_.size());
+    for (size_t i = 0; i < other.entries_.size(); ++i) {
+        Entry entry = other.entries_[i];
+        if (entry.Type() == kAlternateType) {
+            entry.sub_command += alt_usage_base;
+            entries_.emplace_back(entry);
+            continue;
+        }
+        if (entry.label_command_index != vvl::kNoIndex32) {
+            entry.label_command_index += label_command_offset;
+        }
+        PushEntry(entry, origin_map[other.GetOrigin(i)]);
+    }
+}
+
+ResourceUsageRecord ResourceUsageLog::operator[](size_t index) const {
+    assert(index < entries_.size());
+    const Entry &entry = entries_[index];
+    ResourceUsageRecord record;
+    if (entry.Type() == kAlternateType) {
+        record.alt_usage = &alt_usages_[entry.sub_command];
+        return record;
+    }
+    const Origin &origin = origins_[GetOrigin(index)];
+    record.command = static_cast<vvl::Func>(entry.command);
+    record.seq_num = entry.seq_num;
+    record.sub_command_type = static_cast<SubcommandType>(entry.Type());
+    record.sub_command = entry.sub_command;
+    record.cb_state = origin.cb_state;
+    record.reset_count = origin.reset_count;
+    record.label_command_index = entry.label_command_index;
+    return record;
+}
+
+size_t ResourceUsageLog::GetMemoryUsage() const {
+    return vvl::MemoryUsage::VectorBytes(entries_) + vvl::MemoryUsage::VectorBytes(origins_) +
+           vvl::MemoryUsage::VectorBytes(wide_origins_) + vvl::MemoryUsage::VectorBytes(alt_usages_);
+}
+
 CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator &sync_validator)
     : CommandExecutionContext(&sync_validator),
       cb_state_(),
@@ -97,6 +224,7 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
     reset_count_ = from.reset_count_;
 
     handles_ = from.handles_;
+    handle_indices_ = from.handle_indices_;
     sync_state_->stats.AddHandleRecord((uint32_t)from.handles_.size());
 
     const auto *from_context = from.GetCurrentAccessContext();
@@ -119,8 +247,21 @@ CommandBufferAccessContext::~CommandBufferAccessContext() {
 }
 
 void CommandBufferAccessContext::Reset() {
-    access_log_ = std::make_shared<AccessLog>();
-    cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    // Submitted batches keep the log of a previous recording alive. When nothing does, keep the storage for the re-record,
+    // otherwise start a new log sized like the last one to skip the regrowth.
+    if (access_log_.use_count() == 1) {
+        access_log_->clear();
+    } else {
+        const size_t previous_size = access_log_->size();
+        access_log_ = std::make_shared<AccessLog>();
+        access_log_->reserve(previous_size);
+    }
+    // Same as the access log, the set of a submitted recording can still be referenced
+    if (cbs_referenced_ && cbs_referenced_.use_count() == 1) {
+        cbs_referenced_->clear();
+    } else {
+        cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    }
     if (cb_state_) {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
@@ -131,8 +272,11 @@ void CommandBufferAccessContext::Reset() {
 
     sync_state_->stats.RemoveHandleRecord((uint32_t)handles_.size());
     handles_.clear();
+    handle_indices_.clear();
 
     current_command_tag_ = vvl::kNoIndex32;
+    event_scope_snapshot_.reset();
+    event_scope_snapshot_context_ = nullptr;
     cb_access_context_.Reset();
     render_pass_contexts_.clear();
     current_context_ = &cb_access_context_;
@@ -311,140 +455,129 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    // Graphics and compute pipelines are all created by SyncValidator
+    const auto &sync_pipe = static_cast<const syncval_state::Pipeline &>(*pipe);
+    for (const syncval_state::DescriptorAccess &descriptor_access : sync_pipe.descriptor_accesses) {
+        const auto &variable = *descriptor_access.variable;
+        if (variable.decorations.set >= per_sets->size()) {
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
             continue;
-        } else if (!stage_state.entrypoint) {
+        }
+        const auto &per_set = (*per_sets)[variable.decorations.set];
+        const auto *descriptor_set = per_set.bound_descriptor_set.get();
+        if (!descriptor_set) continue;
+        auto binding = descriptor_set->GetBinding(variable.decorations.binding);
+        const auto descriptor_type = binding->type;
+        SyncStageAccessIndex sync_index = descriptor_access.GetAccess(descriptor_type);
+
+        // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
+        // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
+        // (e.g. read access, when both reads and writes are allowed) or for an array of descriptors, not all
+        // elements are accessed in the general case.
+        //
+        // This workaround disables validation for the descriptor array case.
+        if (binding->count > 1) {
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
-            }
-            const auto &per_set = (*per_sets)[variable.decorations.set];
-            const auto *descriptor_set = per_set.bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
-            // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
-            // (e.g. read access, when both reads and writes are allowed) or for an array of descriptors, not all
-            // elements are accessed in the general case.
-            //
-            // This workaround disables validation for the descriptor array case.
-            if (binding->count > 1) {
-                continue;
-            }
 
-            for (uint32_t index = 0; index < binding->count; index++) {
-                const auto *descriptor = binding->GetDescriptor(index);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
-                            continue;
-                        }
+        for (uint32_t index = 0; index < binding->count; index++) {
+            const auto *descriptor = binding->GetDescriptor(index);
+            switch (descriptor->GetClass()) {
+                case DescriptorClass::ImageSampler:
+                case DescriptorClass::Image: {
+                    if (descriptor->Invalid()) {
+                        continue;
+                    }
 
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        VkImageLayout image_layout = image_descriptor->GetImageLayout();
-
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
+                    // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                    const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                    const auto *img_view_state =
+                        static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
+                    VkImageLayout image_layout = image_descriptor->GetImageLayout();
+
+                    if (img_view_state->IsDepthSliced()) {
+                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                        // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                        // See: VUID 00343
+                        continue;
+                    }
 
-                        HazardResult hazard;
+                    HazardResult hazard;
 
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            // Input attachments are subject to raster ordering rules
-                            hazard =
-                                current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
-                        } else {
-                            hazard = current_context_->DetectHazard(*img_view_state, sync_index);
-                        }
+                    if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                        const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                        const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                        // Input attachments are subject to raster ordering rules
+                        hazard = current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
+                    } else {
+                        hazard = current_context_->DetectHazard(*img_view_state, sync_index);
+                    }
 
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
-                                "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                variable.decorations.binding, index, FormatHazard(hazard).c_str());
-                        }
-                        break;
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
+                            "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
+                            ", index %" PRIu32 ". Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(), string_VkDescriptorType(descriptor_type),
+                            string_VkImageLayout(image_layout), variable.decorations.binding, index, FormatHazard(hazard).c_str());
                     }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
-                        }
-                        break;
+                    break;
+                }
+                case DescriptorClass::TexelBuffer: {
+                    const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                    if (texel_descriptor->Invalid()) {
+                        continue;
                     }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += per_set.dynamicOffsets[dynamic_offset_index];
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range =
-                            MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                    const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                    const auto *buf_state = buf_view_state->buffer_state.get();
+                    const ResourceAccessRange range = MakeRange(*buf_view_state);
+                    auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
+                            "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(), string_VkDescriptorType(descriptor_type),
+                            variable.decorations.binding, index, FormatHazard(hazard).c_str());
+                    }
+                    break;
+                }
+                case DescriptorClass::GeneralBuffer: {
+                    const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                    if (buffer_descriptor->Invalid()) {
+                        continue;
+                    }
+                    VkDeviceSize offset = buffer_descriptor->GetOffset();
+                    if (vvl::IsDynamicDescriptor(descriptor_type)) {
+                        const uint32_t dynamic_offset_index = descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                        if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
+                            continue;  // core validation error
                         }
-                        break;
+                        offset += per_set.dynamicOffsets[dynamic_offset_index];
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
+                    const auto *buf_state = buffer_descriptor->GetBufferState();
+                    const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                    auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                    if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
+                        skip |= sync_state_->LogError(
+                            string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
+                            "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                            string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
+                            sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                            sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                            sync_state_->FormatHandle(descriptor_set->Handle()).c_str(), string_VkDescriptorType(descriptor_type),
+                            variable.decorations.binding, index, FormatHazard(hazard).c_str());
+                    }
+                    break;
                 }
+                // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
+                default:
+                    break;
             }
         }
     }
@@ -466,95 +599,89 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    // Graphics and compute pipelines are all created by SyncValidator
+    const auto &sync_pipe = static_cast<const syncval_state::Pipeline &>(*pipe);
+    for (const syncval_state::DescriptorAccess &descriptor_access : sync_pipe.descriptor_accesses) {
+        const auto &variable = *descriptor_access.variable;
+        if (variable.decorations.set >= per_sets->size()) {
+            // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
             continue;
-        } else if (!stage_state.entrypoint) {
+        }
+        const auto &per_set = (*per_sets)[variable.decorations.set];
+        const auto *descriptor_set = per_set.bound_descriptor_set.get();
+        if (!descriptor_set) continue;
+        auto binding = descriptor_set->GetBinding(variable.decorations.binding);
+        const auto descriptor_type = binding->type;
+        SyncStageAccessIndex sync_index = descriptor_access.GetAccess(descriptor_type);
+
+        // Do not update state for descriptor array (the same as in Validate function).
+        if (binding->count > 1) {
             continue;
         }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= per_sets->size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
-            }
-            const auto &per_set = (*per_sets)[variable.decorations.set];
-            const auto *descriptor_set = per_set.bound_descriptor_set.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncStageAccessIndex sync_index =
-                GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Do not update state for descriptor array (the same as in Validate function).
-            if (binding->count > 1) {
-                continue;
-            }
 
-            for (uint32_t i = 0; i < binding->count; i++) {
-                const auto *descriptor = binding->GetDescriptor(i);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *img_view_state =
-                            static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
-                        if (img_view_state->IsDepthSliced()) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
-                                                                tag);
-                        } else {
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
-                        }
-                        AddCommandHandle(tag, img_view_state->Handle());
-                        break;
+        for (uint32_t i = 0; i < binding->count; i++) {
+            const auto *descriptor = binding->GetDescriptor(i);
+            switch (descriptor->GetClass()) {
+                case DescriptorClass::ImageSampler:
+                case DescriptorClass::Image: {
+                    // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                    const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                    if (image_descriptor->Invalid()) {
+                        continue;
                     }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
+                    const auto *img_view_state =
+                        static_cast<const syncval_state::ImageViewState *>(image_descriptor->GetImageViewState());
+                    if (img_view_state->IsDepthSliced()) {
+                        // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                        // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                        // See: VUID 00343
+                        continue;
                     }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += per_set.dynamicOffsets[dynamic_offset_index];
+                    if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                        const VkExtent3D extent = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.extent);
+                        const VkOffset3D offset = CastTo3D(cb_state_->active_render_pass_begin_info.renderArea.offset);
+                        current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
+                                                            tag);
+                    } else {
+                        current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
+                    }
+                    AddCommandHandle(tag, img_view_state->Handle());
+                    break;
+                }
+                case DescriptorClass::TexelBuffer: {
+                    const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                    if (texel_descriptor->Invalid()) {
+                        continue;
+                    }
+                    const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                    const auto *buf_state = buf_view_state->buffer_state.get();
+                    const ResourceAccessRange range = MakeRange(*buf_view_state);
+                    const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
+                    current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                    break;
+                }
+                case DescriptorClass::GeneralBuffer: {
+                    const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                    if (buffer_descriptor->Invalid()) {
+                        continue;
+                    }
+                    VkDeviceSize offset = buffer_descriptor->GetOffset();
+                    if (vvl::IsDynamicDescriptor(descriptor_type)) {
+                        const uint32_t dynamic_offset_index = descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                        if (dynamic_offset_index >= per_set.dynamicOffsets.size()) {
+                            continue;  // core validation error
                         }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
+                        offset += per_set.dynamicOffsets[dynamic_offset_index];
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
-                    default:
-                        break;
+                    const auto *buf_state = buffer_descriptor->GetBufferState();
+                    const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                    const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
+                    current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                    break;
                 }
+                // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
+                default:
+                    break;
             }
         }
     }
@@ -878,33 +1005,26 @@ void CommandBufferAccessContext::ResolveExecutedCommandBuffer(const AccessContex
 
 void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context) {
     cbs_referenced_->emplace_back(recorded_context.GetCBStateShared());
-    access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
 
     // Adjust command indices for the log records added from recorded_context.
     const auto &recorded_label_commands = recorded_context.cb_state_->GetLabelCommands();
     const bool use_proxy = !proxy_label_commands_.empty();
     const auto &label_commands = use_proxy ? proxy_label_commands_ : cb_state_->GetLabelCommands();
+    uint32_t command_offset = 0;
     if (!label_commands.empty()) {
         assert(label_commands.size() >= recorded_label_commands.size());
-        const uint32_t command_offset = static_cast<uint32_t>(label_commands.size() - recorded_label_commands.size());
-        for (size_t i = 0; i < recorded_context.access_log_->size(); i++) {
-            size_t index = (access_log_->size() - 1) - i;
-            assert((*access_log_)[index].label_command_index != vvl::kU32Max);
-            (*access_log_)[index].label_command_index += command_offset;
-        }
+        command_offset = static_cast<uint32_t>(label_commands.size() - recorded_label_commands.size());
     }
+    access_log_->Import(*recorded_context.access_log_, command_offset);
 }
 
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
     subcommand_number_ = 0;
     current_command_tag_ = access_log_->size();
+    sync_state_->stats.AddCommand();
 
-    auto &record = access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_);
-
-    if (!cb_state_->GetLabelCommands().empty()) {
-        record.label_command_index = static_cast<uint32_t>(cb_state_->GetLabelCommands().size() - 1);
-    }
+    access_log_->Append(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_, CurrentLabelCommand());
     CheckCommandTagDebugCheckpoint();
     return current_command_tag_;
 }
@@ -913,62 +1033,51 @@ ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command
     subcommand_number_++;
 
     const ResourceUsageTag tag = access_log_->size();
-    auto &record = access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_);
-
-    // By default copy handle range from the main command, but can be overwritten with AddSubcommandHandle.
-    const auto &main_command_record = (*access_log_)[current_command_tag_];
-    record.first_handle_index = main_command_record.first_handle_index;
-    record.handle_count = main_command_record.handle_count;
-
-    if (!cb_state_->GetLabelCommands().empty()) {
-        record.label_command_index = static_cast<uint32_t>(cb_state_->GetLabelCommands().size() - 1);
-    }
+    access_log_->Append(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_, CurrentLabelCommand());
     return tag;
 }
 
+uint32_t CommandBufferAccessContext::CurrentLabelCommand() const {
+    const auto &label_commands = cb_state_->GetLabelCommands();
+    return label_commands.empty() ? vvl::kNoIndex32 : static_cast<uint32_t>(label_commands.size() - 1);
+}
+
 uint32_t CommandBufferAccessContext::AddHandle(const VulkanTypedHandle &typed_handle, uint32_t index) {
-    const uint32_t handle_index = static_cast<uint32_t>(handles_.size());
-    handles_.emplace_back(HandleRecord(typed_handle, index));
-    sync_state_->stats.AddHandleRecord();
-    return handle_index;
+    // Commands of a recording tend to reference the same buffers and images, their accesses share one record
+    const HandleRecord handle_record(typed_handle, index);
+    const auto [it, inserted] = handle_indices_.emplace(handle_record, static_cast<uint32_t>(handles_.size()));
+    if (inserted) {
+        handles_.emplace_back(handle_record);
+        sync_state_->stats.AddHandleRecord();
+    }
+    return it->second;
 }
 
 ResourceUsageTagEx CommandBufferAccessContext::AddCommandHandle(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle,
                                                                 uint32_t index) {
     assert(tag < access_log_->size());
-    const uint32_t handle_index = AddHandle(typed_handle, index);
-    // TODO: the following range check is not needed. Test and remove.
-    if (tag < access_log_->size()) {
-        auto &record = (*access_log_)[tag];
-        if (record.first_handle_index == vvl::kNoIndex32) {
-            record.first_handle_index = handle_index;
-            record.handle_count = 1;
-        } else {
-            // assert that command handles occupy continuous range
-            assert(handle_index - record.first_handle_index == record.handle_count);
-            record.handle_count++;
-        }
-    }
-    return {tag, handle_index};
+    return {tag, AddHandle(typed_handle, index)};
 }
 
 void CommandBufferAccessContext::AddSubcommandHandle(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle, uint32_t index) {
     assert(tag < access_log_->size());
-    const uint32_t handle_index = AddHandle(typed_handle, index);
-    // TODO: the following range check is not needed. Test and remove.
-    if (tag < access_log_->size()) {
-        auto &record = (*access_log_)[tag];
-        const auto &main_command_record = (*access_log_)[current_command_tag_];
-        if (record.first_handle_index == main_command_record.first_handle_index) {
-            // override default behavior that subcommand references the same handles as the main command
-            record.first_handle_index = handle_index;
-            record.handle_count = 1;
-        } else {
-            // assert that command handles occupy continuous range
-            assert(handle_index - record.first_handle_index == record.handle_count);
-            record.handle_count++;
+    (void)tag;
+    AddHandle(typed_handle, index);
+}
+
+void CommandBufferAccessContext::AddMemoryUsage(vvl::MemoryUsage &usage) const {
+    size_t bytes = cb_access_context_.GetMemoryUsage() + vvl::MemoryUsage::VectorBytes(handles_) +
+                   vvl::MemoryUsage::MapBytes(handle_indices_) + vvl::MemoryUsage::VectorBytes(sync_ops_);
+    // The log is shared with the submitted batches that replayed this command buffer
+    if (access_log_ && usage.FirstVisit(access_log_.get())) {
+        bytes += access_log_->GetMemoryUsage();
+    }
+    for (const auto &render_pass_context : render_pass_contexts_) {
+        for (const AccessContext &subpass_context : render_pass_context->GetContexts()) {
+            bytes += subpass_context.GetMemoryUsage();
         }
     }
+    usage.Add(vvl::MemoryCategory::SyncMaps, bytes);
 }
 
 std::string CommandBufferAccessContext::GetDebugRegionName(const ResourceUsageRecord &record) const {
@@ -977,6 +1086,22 @@ std::string CommandBufferAccessContext::GetDebugRegionName(const ResourceUsageRe
     return vvl::CommandBuffer::GetDebugRegionName(label_commands, record.label_command_index);
 }
 
+std::shared_ptr<const AccessContext> CommandBufferAccessContext::GetEventScopeSnapshot() {
+    if (!event_scope_snapshot_ || event_scope_snapshot_context_ != current_context_ ||
+        event_scope_snapshot_log_size_ != access_log_->size()) {
+        event_scope_snapshot_ = std::make_shared<const AccessContext>(*current_context_);
+        event_scope_snapshot_context_ = current_context_;
+        event_scope_snapshot_log_size_ = access_log_->size();
+    }
+    return event_scope_snapshot_;
+}
+
+void CommandBufferAccessContext::KeepEventScopeSnapshot(ResourceUsageTag set_event_tag) {
+    if (event_scope_snapshot_ && event_scope_snapshot_log_size_ == set_event_tag && access_log_->size() == set_event_tag + 1) {
+        event_scope_snapshot_log_size_ = access_log_->size();
+    }
+}
+
 void CommandBufferAccessContext::RecordSyncOp(SyncOpPointer &&sync_op) {
     auto tag = sync_op->Record(this);
     // As renderpass operations can have side effects on the command buffer access context,
@@ -1061,45 +1186,27 @@ void CommandBufferAccessContext::RecordClearAttachment(ResourceUsageTag tag, con
 // VK_SYNCVAL_DEBUG_CMDBUF_PATTERN: (optional, empty string by default) pattern to match command buffer debug name
 void CommandBufferAccessContext::CheckCommandTagDebugCheckpoint() {
     auto get_cmdbuf_name = [](const DebugReport &debug_report, uint64_t cmdbuf_handle) {
-        std::unique_lock<std::mutex> lock(debug_report.debug_output_mutex);
-        std::string object_name = debug_report.GetUtilsObjectNameNoLock(cmdbuf_handle);
+        std::string object_name = debug_report.GetUtilsObjectName(cmdbuf_handle);
         if (object_name.empty()) {
-            object_name = debug_report.GetMarkerObjectNameNoLock(cmdbuf_handle);
+            object_name = debug_report.GetMarkerObjectName(cmdbuf_handle);
         }
         vvl::ToLower(object_name);
         return object_name;
     };
-    if (sync_state_->debug_command_number == command_number_ && sync_state_->debug_reset_count == reset_count_) {
+    const SyncValSettings &debug_settings = sync_state_->syncval_settings;
+    if (debug_settings.debug_command_number == command_number_ && debug_settings.debug_reset_count == reset_count_) {
         const auto cmdbuf_name = get_cmdbuf_name(*sync_state_->debug_report, cb_state_->Handle().handle);
-        const auto &pattern = sync_state_->debug_cmdbuf_pattern;
+        const auto &pattern = debug_settings.debug_cmdbuf_pattern;
         const bool cmdbuf_match = pattern.empty() || (cmdbuf_name.find(pattern) != std::string::npos);
         if (cmdbuf_match) {
             sync_state_->LogInfo("SYNCVAL_DEBUG_COMMAND", LogObjectList(), Location(access_log_->back().command),
                                  "Command stream has reached command #%" PRIu32 " in command buffer %s with reset count #%" PRIu32,
-                                 sync_state_->debug_command_number, sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                 sync_state_->debug_reset_count);
+                                 debug_settings.debug_command_number, sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                                 debug_settings.debug_reset_count);
         }
     }
 }
 
-static bool IsHazardVsRead(SyncHazard hazard) {
-    bool vs_read = false;
-    switch (hazard) {
-        case SyncHazard::WRITE_AFTER_READ:
-            vs_read = true;
-            break;
-        case SyncHazard::WRITE_RACING_READ:
-            vs_read = true;
-            break;
-        case SyncHazard::PRESENT_AFTER_READ:
-            vs_read = true;
-            break;
-        default:
-            break;
-    }
-    return vs_read;
-}
-
 static const SyncStageAccessInfoType *SyncStageAccessInfoFromMask(SyncStageAccessFlags flags) {
     // Return the info for the first bit found
     const SyncStageAccessInfoType *info = nullptr;
@@ -1119,7 +1226,7 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     } else {
         for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex().size(); i++) {
             const auto &info = syncStageAccessInfoByStageAccessIndex()[i];
-            if ((flags & info.stage_access_bit).any()) {
+            if (flags.Intersects(info.stage_access_bit)) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
@@ -1179,7 +1286,7 @@ std::ostream &operator<<(std::ostream &out, const HandleRecord::FormatterState &
 std::ostream &operator<<(std::ostream &out, const ResourceUsageRecord::FormatterState &formatter) {
     const ResourceUsageRecord &record = formatter.record;
     if (record.alt_usage) {
-        out << record.alt_usage.Formatter(formatter.sync_state);
+        out << record.alt_usage->Formatter(formatter.sync_state);
     } else {
         out << "command: " << vvl::String(record.command);
         // Note: ex_cb_state set to null forces output of record.cb_state
@@ -1221,11 +1328,9 @@ std::ostream &operator<<(std::ostream &out, const HazardResult::HazardState &haz
     }
     out << "prior_usage: " << stage_access_name;
     if (IsHazardVsRead(hazard.hazard)) {
-        const auto barriers = hazard.access_state->GetReadBarriers(hazard.prior_access);
-        out << ", read_barriers: " << string_VkPipelineStageFlags2(barriers);
+        out << ", read_barriers: " << string_VkPipelineStageFlags2(hazard.read_barriers);
     } else {
-        SyncStageAccessFlags write_barrier = hazard.access_state->GetWriteBarriers();
-        out << ", write_barriers: " << string_SyncStageAccessFlags(write_barrier);
+        out << ", write_barriers: " << string_SyncStageAccessFlags(hazard.write_barriers);
     }
     return out;
 }
@@ -1243,13 +1348,51 @@ SyncNodeFormatter::SyncNodeFormatter(const SyncValidator &sync_state, const vvl:
     : debug_report(sync_state.debug_report), node(state_object), label(label_) {}
 
 std::string SyncValidationInfo::FormatHazard(const HazardResult &hazard) const {
-    std::stringstream out;
     assert(hazard.IsHazard());
+    // The usage description looks up debug names and labels. Skip it for hazards that are filtered or over the duplicate
+    // limit, the message that would contain it is dropped anyway.
+    if (sync_state_->IsMessageMuted(string_SyncHazardVUID(hazard.Hazard()))) {
+        return std::string();
+    }
+    std::stringstream out;
     out << hazard.State();
     out << ", " << FormatUsage(hazard.TagEx()) << ")";
     return out.str();
 }
 
+static std::vector<syncval_state::DescriptorAccess> MakeDescriptorAccesses(const vvl::Pipeline &pipe) {
+    std::vector<syncval_state::DescriptorAccess> accesses;
+    for (const auto &stage_state : pipe.stage_states) {
+        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe.RasterizationDisabled()) {
+            continue;
+        } else if (!stage_state.entrypoint) {
+            continue;
+        }
+        const VkShaderStageFlagBits stage = stage_state.GetStage();
+        const sync_utils::ShaderStageAccesses stage_accesses = sync_utils::GetShaderStageAccesses(stage);
+        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
+            accesses.push_back({&variable, stage, stage_accesses});
+        }
+    }
+    return accesses;
+}
+
+syncval_state::Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPipelineCreateInfo *pCreateInfo,
+                                  std::shared_ptr<const vvl::PipelineCache> &&pipe_cache,
+                                  std::shared_ptr<const vvl::RenderPass> &&rpstate,
+                                  std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                  spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages],
+                                  ShaderModuleUniqueIds *shader_unique_id_map)
+    : vvl::Pipeline(state_data, pCreateInfo, std::move(pipe_cache), std::move(rpstate), std::move(layout), stateless_data,
+                    shader_unique_id_map),
+      descriptor_accesses(MakeDescriptorAccesses(*this)) {}
+
+syncval_state::Pipeline::Pipeline(const ValidationStateTracker &state_data, const VkComputePipelineCreateInfo *pCreateInfo,
+                                  std::shared_ptr<const vvl::PipelineCache> &&pipe_cache,
+                                  std::shared_ptr<const vvl::PipelineLayout> &&layout, spirv::StatelessData *stateless_data)
+    : vvl::Pipeline(state_data, pCreateInfo, std::move(pipe_cache), std::move(layout), stateless_data),
+      descriptor_accesses(MakeDescriptorAccesses(*this)) {}
+
 syncval_state::CommandBuffer::CommandBuffer(SyncValidator &dev, VkCommandBuffer handle,
                                             const VkCommandBufferAllocateInfo *pCreateInfo, const vvl::CommandPool *pool)
     : vvl::CommandBuffer(dev, handle, pCreateInfo, pool), access_context(dev, this) {}
@@ -1264,6 +1407,12 @@ void syncval_state::CommandBuffer::Reset() {
     access_context.Reset();
 }
 
+void syncval_state::CommandBuffer::AddMemoryUsage(vvl::MemoryUsage &usage) const {
+    vvl::CommandBuffer::AddMemoryUsage(usage);
+    auto guard = ReadLock();
+    access_context.AddMemoryUsage(usage);
+}
+
 void syncval_state::CommandBuffer::NotifyInvalidate(const vvl::StateObject::NodeList &invalid_nodes, bool unlink) {
     for (auto &obj : invalid_nodes) {
         switch (obj->Type()) {
@@ -17,7 +17,10 @@
 #pragma once
 
 #include "sync/sync_renderpass.h"
+#include "sync/sync_utils.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "state_tracker/pipeline_state.h"
+#include "utils/hash_util.h"
 
 class SyncValidator;
 
@@ -93,6 +96,11 @@ struct HandleRecord {
         : handle(typed_handle.handle), type(typed_handle.type), index(index) {}
     bool IsIndexed() const { return index != vvl::kNoIndex32; }
 
+    bool operator==(const HandleRecord &other) const {
+        return handle == other.handle && type == other.type && index == other.index;
+    }
+    size_t hash() const { return hash_util::HashCombiner().Combine(handle).Combine(type).Combine(index).Value(); }
+
     VulkanTypedHandle TypedHandle() const {
         VulkanTypedHandle typed_handle;
         typed_handle.handle = handle;
@@ -128,9 +136,6 @@ struct ResourceCmdUsageRecord {
     const vvl::CommandBuffer *cb_state = nullptr;
     uint32_t reset_count = 0;
 
-    uint32_t first_handle_index = vvl::kNoIndex32;
-    uint32_t handle_count = 0;
-
     uint32_t label_command_index = vvl::kNoIndex32;
 };
 
@@ -156,16 +161,86 @@ struct ResourceUsageRecord : public ResourceCmdUsageRecord {
         return FormatterState(sync_state, *this, ex_cb_state, debug_name_provider, handle_index);
     }
 
-    AlternateResourceUsage alt_usage;
+    // Set for the records of queue operations (present, acquire), points into the side table of the log
+    const AlternateResourceUsage *alt_usage = nullptr;
 
     ResourceUsageRecord() = default;
     ResourceUsageRecord(vvl::Func command_, uint32_t seq_num_, SubcommandType sub_type_, uint32_t sub_command_,
                         const vvl::CommandBuffer *cb_state_, uint32_t reset_count_)
         : ResourceCmdUsageRecord(command_, seq_num_, sub_type_, sub_command_, cb_state_, reset_count_) {}
+};
+
+// Access log of a command buffer or of queue operations, one record per tag.
+//
+// For long command buffers the log is the largest syncval allocation, so a record is stored in 16 bytes. The command buffer
+// and reset count, which are the same for all the commands of a recording, are stored once per recording in the origin table.
+// The AlternateResourceUsage of the rare queue operation records lives in a side table. operator[] returns the unpacked
+// ResourceUsageRecord, which only error reporting needs.
+class ResourceUsageLog {
+  public:
+    using SubcommandType = ResourceUsageRecord::SubcommandType;
 
-    ResourceUsageRecord(const AlternateResourceUsage &other) : ResourceCmdUsageRecord(), alt_usage(other) {}
-    ResourceUsageRecord(const ResourceUsageRecord &other) : ResourceCmdUsageRecord(other), alt_usage(other.alt_usage) {}
-    ResourceUsageRecord &operator=(const ResourceUsageRecord &other) = default;
+    size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+    void reserve(size_t count) { entries_.reserve(count); }
+    void clear();
+
+    void Append(vvl::Func command, uint32_t seq_num, SubcommandType sub_command_type, uint32_t sub_command,
+                const vvl::CommandBuffer *cb_state, uint32_t reset_count, uint32_t label_command_index);
+    void AppendAlternate(const AlternateResourceUsage::RecordBase &alt_record);
+    // Append a copy of a record read from any log
+    void AppendCopy(const ResourceUsageRecord &record);
+    // Append all the records of other, label_command_offset is added to the label command indices they have
+    void Import(const ResourceUsageLog &other, uint32_t label_command_offset);
+
+    ResourceUsageRecord operator[](size_t index) const;
+    ResourceUsageRecord back() const { return (*this)[entries_.size() - 1]; }
+
+    size_t GetMemoryUsage() const;
+
+  private:
+    struct Origin {
+        const vvl::CommandBuffer *cb_state;
+        uint32_t reset_count;
+        bool operator==(const Origin &other) const { return cb_state == other.cb_state && reset_count == other.reset_count; }
+    };
+
+    static constexpr uint32_t kTypeBits = 3;
+    static constexpr uint32_t kTypeMask = (1u << kTypeBits) - 1;
+    // The origin index is in wide_origins_
+    static constexpr uint32_t kWideOrigin = (1u << (16 - kTypeBits)) - 1;
+    // The sub_command field of an alternate record is its index in alt_usages_
+    static constexpr uint32_t kAlternateType = 7;
+    static_assert(static_cast<uint32_t>(SubcommandType::kIndex) < kAlternateType, "subcommand type doesn't fit");
+
+    struct Entry {
+        uint32_t seq_num;
+        uint32_t sub_command;
+        uint32_t label_command_index;
+        uint16_t command;
+        // Subcommand type in the low kTypeBits, origin index above
+        uint16_t type_and_origin;
+
+        uint32_t Type() const { return type_and_origin & kTypeMask; }
+        uint32_t OriginIndex() const { return static_cast<uint32_t>(type_and_origin) >> kTypeBits; }
+        void SetTypeAndOrigin(uint32_t type, uint32_t origin) {
+            type_and_origin = static_cast<uint16_t>(type | (origin << kTypeBits));
+        }
+    };
+    static_assert(sizeof(Entry) == 16, "ResourceUsageLog::Entry is not packed");
+
+    uint32_t FindOrAddOrigin(const Origin &origin);
+    uint32_t GetOrigin(size_t index) const;
+    void PushEntry(Entry entry, uint32_t origin_index);
+    // Entry of the alternate usage last added to alt_usages_
+    void PushAlternateEntry();
+
+    std::vector<Entry> entries_;
+    std::vector<Origin> origins_;
+    // Origin index of the entries with kWideOrigin, sorted by entry index as entries are only appended
+    std::vector<std::pair<uint32_t, uint32_t>> wide_origins_;
+    std::vector<AlternateResourceUsage> alt_usages_;
+    uint32_t last_origin_ = 0;
 };
 
 // Provides debug region name for the specified access log command.
@@ -180,7 +255,7 @@ struct DebugNameProvider {
 // TODO: determine where to draw the design split for tag tracking (is there anything command to Queues and CB's)
 class CommandExecutionContext : public SyncValidationInfo {
   public:
-    using AccessLog = std::vector<ResourceUsageRecord>;
+    using AccessLog = ResourceUsageLog;
     using CommandBufferSet = std::vector<std::shared_ptr<const vvl::CommandBuffer>>;
     CommandExecutionContext() : SyncValidationInfo(nullptr) {}
     CommandExecutionContext(const SyncValidator *sync_validator) : SyncValidationInfo(sync_validator) {}
@@ -327,8 +402,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     ResourceUsageTagEx AddCommandHandle(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle,
                                         uint32_t index = vvl::kNoIndex32);
 
-    // Default subcommand behavior is that it references the same handles as the main command.
-    // The following method allows to set subcommand handles independently of the main command.
+    // Records a handle referenced by a subcommand. Handles are interned, a handle already referenced by the recording
+    // keeps its index.
     void AddSubcommandHandle(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle, uint32_t index = vvl::kNoIndex32);
 
     const HandleRecord &GetHandleRecord(uint32_t handle_index) const { return handles_[handle_index]; }
@@ -346,6 +421,11 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
         SyncOpPointer sync_op(std::make_shared<T>(std::forward<Args>(args)...));
         RecordSyncOp(std::move(sync_op));  // Call the non-template version
     }
+    // Copy of the current access context for the first scope of a vkCmdSetEvent. Set events without any access recorded
+    // between them share the same copy.
+    std::shared_ptr<const AccessContext> GetEventScopeSnapshot();
+    // The set event command itself doesn't change the accesses, its tag keeps the snapshot current
+    void KeepEventScopeSnapshot(ResourceUsageTag set_event_tag);
     std::shared_ptr<AccessLog> GetAccessLogShared() const { return access_log_; }
     std::shared_ptr<CommandBufferSet> GetCBReferencesShared() const { return cbs_referenced_; }
     void ImportRecordedAccessLog(const CommandBufferAccessContext &cb_context);
@@ -354,6 +434,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     // DebugNameProvider
     std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
 
+    void AddMemoryUsage(vvl::MemoryUsage &usage) const;
+
     std::vector<vvl::CommandBuffer::LabelCommand> &GetProxyLabelCommands() { return proxy_label_commands_; }
 
   private:
@@ -368,6 +450,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     void RecordClearAttachment(ResourceUsageTag tag, const ClearAttachmentInfo &clear_info);
 
     void CheckCommandTagDebugCheckpoint();
+    // Index of the last label command recorded so far, kNoIndex32 when there is none
+    uint32_t CurrentLabelCommand() const;
 
   private:
     // Note: since every CommandBufferAccessContext is encapsulated in its CommandBuffer object,
@@ -380,17 +464,25 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     uint32_t subcommand_number_;
     uint32_t reset_count_;
 
-    // Handles referenced by the tagged commands
+    // Handles referenced by the tagged commands. A handle is stored once per command buffer recording, accesses refer to it
+    // by its index in handles_
     std::vector<HandleRecord> handles_;
+    vvl::unordered_map<HandleRecord, uint32_t, hash_util::HasHashMember<HandleRecord>> handle_indices_;
 
     // Location of the current command in the access log (it's not always the last element, there might be
-    // subcommands that follow). The subcommands by default reference the same handles as the main command.
+    // subcommands that follow).
     ResourceUsageTag current_command_tag_ = vvl::kNoIndex32;
 
     AccessContext cb_access_context_;
     AccessContext *current_context_;
     SyncEventsContext events_context_;
 
+    // Accesses are only recorded along with a new tag, so the snapshot is current while the access log keeps the size it
+    // had when the snapshot was taken
+    std::shared_ptr<const AccessContext> event_scope_snapshot_;
+    const AccessContext *event_scope_snapshot_context_ = nullptr;
+    size_t event_scope_snapshot_log_size_ = 0;
+
     // Don't need the following for an active proxy cb context
     std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
     RenderPassAccessContext *current_renderpass_context_;
@@ -419,6 +511,32 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     void Destroy() override;
     void Reset() override;
+    void AddMemoryUsage(vvl::MemoryUsage &usage) const override;
+};
+
+// A resource variable of one of the shader stages of a pipeline
+struct DescriptorAccess {
+    const spirv::ResourceInterfaceVariable *variable;
+    VkShaderStageFlagBits stage;
+    sync_utils::ShaderStageAccesses stage_accesses;
+
+    // The descriptor type comes from the bound descriptor set, the variable only tells if it is read or written
+    SyncStageAccessIndex GetAccess(VkDescriptorType descriptor_type) const;
+};
+
+class Pipeline : public vvl::Pipeline {
+  public:
+    Pipeline(const ValidationStateTracker &state_data, const VkGraphicsPipelineCreateInfo *pCreateInfo,
+             std::shared_ptr<const vvl::PipelineCache> &&pipe_cache, std::shared_ptr<const vvl::RenderPass> &&rpstate,
+             std::shared_ptr<const vvl::PipelineLayout> &&layout,
+             spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages], ShaderModuleUniqueIds *shader_unique_id_map);
+    Pipeline(const ValidationStateTracker &state_data, const VkComputePipelineCreateInfo *pCreateInfo,
+             std::shared_ptr<const vvl::PipelineCache> &&pipe_cache, std::shared_ptr<const vvl::PipelineLayout> &&layout,
+             spirv::StatelessData *stateless_data);
+
+    // The resource variables of the stages that run, gathered at creation so recording a draw or a dispatch doesn't walk
+    // the stages and look up the accesses of each of them again
+    const std::vector<DescriptorAccess> descriptor_accesses;
 };
 }  // namespace syncval_state
 
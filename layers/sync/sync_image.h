@@ -54,11 +54,19 @@ class ImageViewState : public vvl::ImageView {
     const ImageState *GetImageState() const { return static_cast<const syncval_state::ImageState *>(image_state.get()); }
     ImageRangeGen MakeImageRangeGen(const VkOffset3D &offset, const VkExtent3D &extent, VkImageAspectFlags aspect_mask = 0) const;
     const ImageRangeGen &GetFullViewImageRangeGen() const { return view_range_gen; }
+    // Depth only and stencil only parts of the view, only set if the view has both aspects
+    const std::optional<ImageRangeGen> &GetFullViewDepthRangeGen() const { return depth_range_gen; }
+    const std::optional<ImageRangeGen> &GetFullViewStencilRangeGen() const { return stencil_range_gen; }
+    // True if a render area covers the whole view, its range generators are then the ones of the full view
+    bool IsFullViewRenderArea(const VkOffset3D &offset, const VkExtent3D &extent) const;
 
   protected:
     ImageRangeGen MakeImageRangeGen() const;
+    std::optional<ImageRangeGen> MakeAspectRangeGen(VkImageAspectFlags aspect) const;
     // All data members needs for MakeImageRangeGen() must be set before initializing view_range_gen... i.e. above this line.
     const ImageRangeGen view_range_gen;
+    const std::optional<ImageRangeGen> depth_range_gen;
+    const std::optional<ImageRangeGen> stencil_range_gen;
 };
 
 class Swapchain : public vvl::Swapchain {
@@ -322,6 +322,7 @@ void SyncOpBarriers::ApplyBarriers(const Barriers &barriers, const FunctorFactor
             auto update_action = factory.MakeApplyFunctor(queue_id, barrier.barrier, barrier.IsLayoutTransition());
             auto range_gen = factory.MakeRangeGen(*state, barrier.Range());
             access_context->UpdateMemoryAccessState(update_action, range_gen);
+            access_context->AddBarrierToScopeSummary(barrier.barrier, barrier.IsLayoutTransition());
         }
     }
 }
@@ -332,6 +333,7 @@ void SyncOpBarriers::ApplyGlobalBarriers(const Barriers &barriers, const Functor
     auto barriers_functor = factory.MakeGlobalApplyFunctor(barriers.size(), tag);
     for (const auto &barrier : barriers) {
         barriers_functor.EmplaceBack(factory.MakeGlobalBarrierOpFunctor(queue_id, barrier));
+        access_context->AddBarrierToScopeSummary(barrier, false);
     }
     auto range_gen = factory.MakeGlobalRangeGen();
     access_context->UpdateMemoryAccessState(barriers_functor, range_gen);
@@ -363,7 +365,17 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     const auto queue_id = exec_context.GetQueueId();
     ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
     ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
-    ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    // The global barrier walk also resolves the pending barriers of the buffer and image barriers, without those it can
+    // be skipped when no access can be in the first scope of the global barriers
+    bool apply_global_barriers = !barrier_set.buffer_memory_barriers.empty() || !barrier_set.image_memory_barriers.empty();
+    for (const auto &barrier : barrier_set.memory_barriers) {
+        apply_global_barriers |= access_context->MayHaveAccessesInScope(barrier);
+    }
+    if (apply_global_barriers) {
+        ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+        // Barriers tend to make neighbouring ranges equal again
+        access_context->ConsolidateIfFragmented();
+    }
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope, exec_tag);
     } else {
@@ -783,6 +795,7 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
     // Apply the pending barriers
     ResolvePendingBarrierFunctor apply_pending_action(exec_tag);
     access_context->ApplyToContext(apply_pending_action);
+    access_context->ConsolidateIfFragmented();
 }
 
 bool SyncOpWaitEvents::ReplayValidate(ReplayState &replay, ResourceUsageTag recorded_tag) const {
@@ -877,32 +890,25 @@ void SyncOpResetEvent::ReplayRecord(CommandExecutionContext &exec_context, Resou
 }
 
 SyncOpSetEvent::SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                               VkPipelineStageFlags2KHR stageMask, const AccessContext *access_context)
+                               VkPipelineStageFlags2KHR stageMask, std::shared_ptr<const AccessContext> &&access_context)
     : SyncOpBase(command),
       event_(sync_state.Get<vvl::Event>(event)),
-      recorded_context_(),
+      // Snapshot of the current access_context for later inspection at wait time. See
+      // CommandBufferAccessContext::GetEventScopeSnapshot.
+      // NOTE: This appears brute force, but given that we only save a "first-last" model of access history, the current
+      //       access context (include barrier state for chaining) won't necessarily contain the needed information at Wait
+      //       or Submit time reference.
+      recorded_context_(std::move(access_context)),
       src_exec_scope_(SyncExecScope::MakeSrc(queue_flags, stageMask)),
-      dep_info_() {
-    // Snapshot the current access_context for later inspection at wait time.
-    // NOTE: This appears brute force, but given that we only save a "first-last" model of access history, the current
-    //       access context (include barrier state for chaining) won't necessarily contain the needed information at Wait
-    //       or Submit time reference.
-    if (access_context) {
-        recorded_context_ = std::make_shared<const AccessContext>(*access_context);
-    }
-}
+      dep_info_() {}
 
 SyncOpSetEvent::SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                               const VkDependencyInfoKHR &dep_info, const AccessContext *access_context)
+                               const VkDependencyInfoKHR &dep_info, std::shared_ptr<const AccessContext> &&access_context)
     : SyncOpBase(command),
       event_(sync_state.Get<vvl::Event>(event)),
-      recorded_context_(),
+      recorded_context_(std::move(access_context)),
       src_exec_scope_(SyncExecScope::MakeSrc(queue_flags, sync_utils::GetGlobalStageMasks(dep_info).src)),
-      dep_info_(new vku::safe_VkDependencyInfo(&dep_info)) {
-    if (access_context) {
-        recorded_context_ = std::make_shared<const AccessContext>(*access_context);
-    }
-}
+      dep_info_(new vku::safe_VkDependencyInfo(&dep_info)) {}
 
 bool SyncOpSetEvent::Validate(const CommandBufferAccessContext &cb_context) const {
     return DoValidate(cb_context, ResourceUsageRecord::kMaxIndex);
@@ -976,6 +982,7 @@ bool SyncOpSetEvent::DoValidate(const CommandExecutionContext &exec_context, con
 
 ResourceUsageTag SyncOpSetEvent::Record(CommandBufferAccessContext *cb_context) {
     const auto tag = cb_context->NextCommandTag(command_);
+    cb_context->KeepEventScopeSnapshot(tag);
     auto *events_context = cb_context->GetCurrentEventsContext();
     const QueueId queue_id = cb_context->GetQueueId();
     assert(recorded_context_);
@@ -1068,8 +1075,9 @@ bool SyncOpBeginRenderPass::Validate(const CommandBufferAccessContext &cb_contex
     // Construct the state we can use to validate against... (since validation is const and RecordCmdBeginRenderPass
     // hasn't happened yet)
     const std::vector<AccessContext> empty_context_vector;
-    AccessContext temp_context(subpass, cb_context.GetQueueFlags(), rp_state.subpass_dependencies, empty_context_vector,
-                               cb_context.GetCurrentAccessContext());
+    const auto &subpass_barriers =
+        static_cast<const syncval_state::RenderPass &>(rp_state).GetSubpassBarriers(cb_context.GetQueueFlags());
+    AccessContext temp_context(subpass, subpass_barriers, empty_context_vector, cb_context.GetCurrentAccessContext());
 
     // Validate attachment operations
     if (attachments_.empty()) return skip;
@@ -1192,8 +1200,13 @@ bool SyncOpEndRenderPass::ReplayValidate(ReplayState &replay, ResourceUsageTag r
 void SyncOpEndRenderPass::ReplayRecord(CommandExecutionContext &exec_context, ResourceUsageTag exec_tag) const {}
 
 ReplayState::ReplayState(CommandExecutionContext &exec_context, const CommandBufferAccessContext &recorded_context,
-                         const ErrorObject &error_obj, uint32_t index, ResourceUsageTag base_tag)
-    : exec_context_(exec_context), recorded_context_(recorded_context), error_obj_(error_obj), index_(index), base_tag_(base_tag) {}
+                         const ErrorObject &error_obj, uint32_t index, ResourceUsageTag base_tag, bool first_use_hazard_free)
+    : exec_context_(exec_context),
+      recorded_context_(recorded_context),
+      error_obj_(error_obj),
+      index_(index),
+      base_tag_(base_tag),
+      first_use_hazard_free_(first_use_hazard_free) {}
 
 void ReplayState::BeginRenderPassReplaySetup(const SyncOpBeginRenderPass &begin_op) {
     exec_context_.BeginRenderPassReplaySetup(*this, begin_op);
@@ -1221,7 +1234,7 @@ const AccessContext *ReplayState::GetRecordedAccessContext() const {
 
 bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range) const {
     bool skip = false;
-    if (first_use_range.non_empty()) {
+    if (first_use_range.non_empty() && !first_use_hazard_free_) {
         HazardResult hazard;
         // We're allowing for the Replay(Validate|Record) to modify the exec_context (e.g. for Renderpass operations), so
         // we need to fetch the current access context each time
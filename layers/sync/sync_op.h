@@ -164,6 +164,8 @@ class SyncOpBase {
     virtual ResourceUsageTag Record(CommandBufferAccessContext *cb_context) = 0;
     virtual bool ReplayValidate(ReplayState &replay, ResourceUsageTag recorded_tag) const = 0;
     virtual void ReplayRecord(CommandExecutionContext &exec_context, ResourceUsageTag exec_tag) const = 0;
+    // True if the replay of this operation switches the recorded context hazards are detected from (render pass instances)
+    virtual bool ReplaysRenderPass() const { return false; }
 
   protected:
     // Only non-null and valid for SyncOps within a render pass instance  WIP -- think about how to manage for non RPI calls within
@@ -283,9 +285,9 @@ class SyncOpResetEvent : public SyncOpBase {
 class SyncOpSetEvent : public SyncOpBase {
   public:
     SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                   VkPipelineStageFlags2KHR stageMask, const AccessContext *access_context);
+                   VkPipelineStageFlags2KHR stageMask, std::shared_ptr<const AccessContext> &&access_context);
     SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkEvent event,
-                   const VkDependencyInfoKHR &dep_info, const AccessContext *access_context);
+                   const VkDependencyInfoKHR &dep_info, std::shared_ptr<const AccessContext> &&access_context);
     ~SyncOpSetEvent() override = default;
 
     bool Validate(const CommandBufferAccessContext &cb_context) const override;
@@ -298,7 +300,8 @@ class SyncOpSetEvent : public SyncOpBase {
     void DoRecord(QueueId queue_id, ResourceUsageTag recorded_tag, const std::shared_ptr<const AccessContext> &access_context,
                   SyncEventsContext *events_context) const;
     std::shared_ptr<const vvl::Event> event_;
-    // The Access context of the command buffer at record set event time.
+    // The Access context of the command buffer at record set event time, shared with the set events recorded right before
+    // or after this one if no access happened in between.
     std::shared_ptr<const AccessContext> recorded_context_;
     SyncExecScope src_exec_scope_;
     // Note that the dep info is *not* dehandled, but retained for comparison with a future WaitEvents2
@@ -315,6 +318,7 @@ class SyncOpBeginRenderPass : public SyncOpBase {
     ResourceUsageTag Record(CommandBufferAccessContext *cb_context) override;
     bool ReplayValidate(ReplayState &replay, ResourceUsageTag recorded_tag) const override;
     void ReplayRecord(CommandExecutionContext &exec_context, ResourceUsageTag exec_tag) const override;
+    bool ReplaysRenderPass() const override { return true; }
     const RenderPassAccessContext *GetRenderPassAccessContext() const { return rp_context_; }
 
   protected:
@@ -428,8 +432,10 @@ class ReplayState {
     bool ValidateFirstUse();
     bool DetectFirstUseHazard(const ResourceUsageRange &first_use_range) const;
 
+    // first_use_hazard_free is set when the caller already knows the recorded first accesses can't have a hazard against
+    // the execution context, in which case only the sync operations are validated and replayed
     ReplayState(CommandExecutionContext &exec_context, const CommandBufferAccessContext &recorded_context,
-                const ErrorObject &error_object, uint32_t index, ResourceUsageTag base_tag);
+                const ErrorObject &error_object, uint32_t index, ResourceUsageTag base_tag, bool first_use_hazard_free = false);
 
     CommandExecutionContext &GetExecutionContext() const { return exec_context_; }
     ResourceUsageTag GetBaseTag() const { return base_tag_; }
@@ -451,5 +457,6 @@ class ReplayState {
     const ErrorObject &error_obj_;
     const uint32_t index_;
     const ResourceUsageTag base_tag_;
+    const bool first_use_hazard_free_;
     RenderPassReplayState rp_replay_;
 };
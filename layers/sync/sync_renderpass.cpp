@@ -68,14 +68,30 @@ class UpdateStateResolveAction {
     const ResourceUsageTag tag_;
 };
 
+const std::vector<SubpassBarriers> &syncval_state::RenderPass::GetSubpassBarriers(VkQueueFlags queue_flags) const {
+    std::lock_guard<std::mutex> guard(barriers_lock_);
+    for (const auto &[flags, barriers] : barriers_) {
+        if (flags == queue_flags) {
+            return *barriers;
+        }
+    }
+    auto barriers = std::make_unique<std::vector<SubpassBarriers>>();
+    barriers->reserve(subpass_dependencies.size());
+    for (const SubpassDependencyGraphNode &dependencies : subpass_dependencies) {
+        barriers->emplace_back(queue_flags, dependencies);
+    }
+    return *barriers_.emplace_back(queue_flags, std::move(barriers)).second;
+}
+
 void InitSubpassContexts(VkQueueFlags queue_flags, const vvl::RenderPass &rp_state, const AccessContext *external_context,
                          std::vector<AccessContext> &subpass_contexts) {
     const auto &create_info = rp_state.create_info;
+    const auto &subpass_barriers = static_cast<const syncval_state::RenderPass &>(rp_state).GetSubpassBarriers(queue_flags);
     // Add this for all subpasses here so that they exsist during next subpass validation
     subpass_contexts.clear();
     subpass_contexts.reserve(create_info.subpassCount);
     for (uint32_t pass = 0; pass < create_info.subpassCount; pass++) {
-        subpass_contexts.emplace_back(pass, queue_flags, rp_state.subpass_dependencies, subpass_contexts, external_context);
+        subpass_contexts.emplace_back(pass, subpass_barriers, subpass_contexts, external_context);
     }
 }
 
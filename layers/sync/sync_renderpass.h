@@ -17,11 +17,13 @@
 
 #pragma once
 
+#include <mutex>
 #include <vulkan/vulkan.h>
 
 #include "sync/sync_common.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_op.h"
+#include "state_tracker/render_pass_state.h"
 
 class CommandExecutionContext;
 struct ClearAttachmentInfo;
@@ -63,6 +65,22 @@ struct DynamicRenderingInfo {
     std::vector<Attachment> attachments;  // All attachments (with internal typing)
 };
 
+// Render pass with the barrier tables of its subpasses. Beginning the render pass instantiates the subpass contexts from
+// them, instead of converting every subpass dependency to barriers again.
+class RenderPass : public vvl::RenderPass {
+  public:
+    RenderPass(VkRenderPass handle, const VkRenderPassCreateInfo *pCreateInfo) : vvl::RenderPass(handle, pCreateInfo) {}
+    RenderPass(VkRenderPass handle, const VkRenderPassCreateInfo2 *pCreateInfo) : vvl::RenderPass(handle, pCreateInfo) {}
+
+    // The barriers depend on the queue flags of the command buffer, they are built on the first use with each
+    const std::vector<SubpassBarriers> &GetSubpassBarriers(VkQueueFlags queue_flags) const;
+
+  private:
+    mutable std::mutex barriers_lock_;
+    // A render pass is only used by the queue families of a device, a linear search is enough
+    mutable std::vector<std::pair<VkQueueFlags, std::unique_ptr<const std::vector<SubpassBarriers>>>> barriers_;
+};
+
 struct BeginRenderingCmdState {
     BeginRenderingCmdState(std::shared_ptr<const syncval_state::CommandBuffer> &&cb_state_) : cb_state(std::move(cb_state_)) {}
     void AddRenderingInfo(const SyncValidator &state, const VkRenderingInfo &rendering_info);
@@ -17,4 +17,17 @@
 
 #pragma once
 
-struct SyncValSettings {};
+#include <cstdint>
+#include <limits>
+#include <string>
+
+struct SyncValSettings {
+    bool stats = false;  // Collect syncval stats and report them when the device is idled or destroyed
+
+    // Developer options, only set by environment variables
+    bool show_stats = false;  // VK_SYNCVAL_SHOW_STATS, print the stats to stdout on destruction
+    // VK_SYNCVAL_DEBUG_COMMAND_NUMBER, VK_SYNCVAL_DEBUG_RESET_COUNT and VK_SYNCVAL_DEBUG_CMDBUF_PATTERN (lower case)
+    uint32_t debug_command_number = std::numeric_limits<uint32_t>::max();
+    uint32_t debug_reset_count = 1;
+    std::string debug_cmdbuf_pattern;
+};
@@ -16,18 +16,24 @@
  */
 
 #include "sync_stats.h"
-
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 #include "sync_commandbuffer.h"
 #include "utils/vk_layer_utils.h"
 
 #include <iostream>
+#include <sstream>
 
 namespace syncval_stats {
 
+std::atomic_bool access_map_counters_enabled{false};
+
+AccessMapCounters &GetAccessMapCounters() {
+    static AccessMapCounters counters;
+    return counters;
+}
+
 void Value32::Update(uint32_t new_value) { u32.store(new_value); }
-uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n); }
-uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n); }
+uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n) + n; }
+uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n) - n; }
 
 void ValueMax32::Update(uint32_t new_value) {
     value.Update(new_value);
@@ -39,9 +45,12 @@ void ValueMax32::Add(uint32_t n) {
     vvl::atomic_fetch_max(max_value.u32, new_value);
 }
 
-void ValueMax32::Sub(uint32_t n) {
-    uint32_t new_value = value.Sub(n);
-    vvl::atomic_fetch_max(max_value.u32, new_value);
+void ValueMax32::Sub(uint32_t n) { value.Sub(n); }
+
+void Samples64::Add(uint64_t sample) {
+    count.Add(1);
+    total.Add(sample);
+    vvl::atomic_fetch_max(max_value, sample);
 }
 
 Stats::~Stats() {
@@ -51,13 +60,58 @@ Stats::~Stats() {
     }
 }
 
-void Stats::AddCommandBufferContext() { command_buffer_context_counter.Add(1); }
-void Stats::RemoveCommandBufferContext() { command_buffer_context_counter.Sub(1); }
+void Stats::Enable() {
+    enabled.store(true);
+    access_map_counters_enabled.store(true);
+}
+
+void Stats::AddCommandBufferContext() {
+    if (IsEnabled()) command_buffer_context_counter.Add(1);
+}
+void Stats::RemoveCommandBufferContext() {
+    if (IsEnabled()) command_buffer_context_counter.Sub(1);
+}
+
+void Stats::AddHandleRecord(uint32_t count) {
+    if (IsEnabled()) handle_record_counter.Add(count);
+}
+void Stats::RemoveHandleRecord(uint32_t count) {
+    if (IsEnabled()) handle_record_counter.Sub(count);
+}
+
+void Stats::AddCommand() {
+    if (IsEnabled()) command_counter.Add(1);
+}
 
-void Stats::AddHandleRecord(uint32_t count) { handle_record_counter.Add(count); }
-void Stats::RemoveHandleRecord(uint32_t count) { handle_record_counter.Sub(count); }
+void Stats::AddCommandBufferAccessMapSize(uint64_t size) {
+    if (IsEnabled()) command_buffer_access_map_size.Add(size);
+}
+void Stats::AddBatchAccessMapSize(uint64_t size) {
+    if (IsEnabled()) batch_access_map_size.Add(size);
+}
 
-void Stats::ReportOnDestruction() { report_on_destruction = true; }
+void Stats::AddSubmitReplayTime(uint64_t nanoseconds) {
+    if (IsEnabled()) submit_replay_time_ns.Add(nanoseconds);
+}
+
+void Stats::ReportOnDestruction() {
+    Enable();
+    report_on_destruction = true;
+}
+
+static void ReportAccessMapSamples(std::ostringstream &str, const char *name, const Samples64 &samples) {
+    const uint64_t entry_size = sizeof(ResourceAccessRangeMap::value_type);
+    const uint64_t count = samples.count.u64;
+    const uint64_t average = count ? samples.total.u64 / count : 0;
+    const uint64_t max_value = samples.max_value;
+
+    str << name << ":\n";
+    str << "\tsamples = " << count << "\n";
+    str << "\taverage_entries = " << average << "\n";
+    str << "\taverage_memory = " << average * entry_size << " bytes\n";
+    str << "\tmax_entries = " << max_value << "\n";
+    str << "\tmax_memory = " << max_value * entry_size << " bytes\n";
+}
 
 std::string Stats::CreateReport() {
     std::ostringstream str;
@@ -81,8 +135,34 @@ std::string Stats::CreateReport() {
         str << "\tmax_count = " << handle_record_max << "\n";
         str << "\tmax_memory = " << handle_record_max_memory << " bytes\n";
     }
+    ReportAccessMapSamples(str, "CommandBufferAccessMap", command_buffer_access_map_size);
+    ReportAccessMapSamples(str, "BatchAccessMap", batch_access_map_size);
+    {
+        const AccessMapCounters &counters = GetAccessMapCounters();
+        const uint64_t commands = command_counter.u64;
+        const uint64_t hazard_checks = counters.hazard_checks.u64;
+        const uint64_t infilled = counters.infilled_entries.u64;
+        const uint64_t added = counters.entries_added.u64;
+
+        str << "AccessMapUpdates (all devices):\n";
+        str << "\tinfill_count = " << infilled << "\n";
+        str << "\tsplit_count = " << (added > infilled ? added - infilled : 0) << "\n";
+        str << "\thazard_checks = " << hazard_checks << "\n";
+        str << "\trecorded_commands = " << commands << "\n";
+        str << "\thazard_checks_per_command = " << (commands ? double(hazard_checks) / double(commands) : 0.0) << "\n";
+    }
+    {
+        const uint64_t submits = submit_replay_time_ns.count.u64;
+        const uint64_t total_us = submit_replay_time_ns.total.u64 / 1000;
+        const uint64_t max_us = submit_replay_time_ns.max_value / 1000;
+
+        str << "SubmitReplay:\n";
+        str << "\tcount = " << submits << "\n";
+        str << "\ttotal_time = " << total_us << " us\n";
+        str << "\taverage_time = " << (submits ? total_us / submits : 0) << " us\n";
+        str << "\tmax_time = " << max_us << " us\n";
+    }
     return str.str();
 }
 
 }  // namespace syncval_stats
-#endif  // VVL_ENABLE_SYNCVAL_STATS != 0
@@ -17,22 +17,16 @@
 
 #pragma once
 
-#include <string>
-#include <cstdint>
-
-#ifndef VVL_ENABLE_SYNCVAL_STATS
-#define VVL_ENABLE_SYNCVAL_STATS 0
-#endif
-
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 #include <atomic>
-#endif
+#include <cstdint>
+#include <string>
 
+// Stats are always compiled in and enabled at runtime with the syncval_stats setting (or VK_SYNCVAL_SHOW_STATS).
+// When disabled every update is a single relaxed load.
 namespace syncval_stats {
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 
 struct Value32 {
-    std::atomic_uint32_t u32;
+    std::atomic_uint32_t u32{0};
     void Update(uint32_t new_value);
     uint32_t Add(uint32_t n);
     uint32_t Sub(uint32_t n);
@@ -46,9 +40,47 @@ struct ValueMax32 {
     void Sub(uint32_t n);
 };
 
+struct Value64 {
+    std::atomic_uint64_t u64{0};
+    void Add(uint64_t n) { u64.fetch_add(n, std::memory_order_relaxed); }
+};
+
+// Accumulates samples to report count, average and max
+struct Samples64 {
+    Value64 count;
+    Value64 total;
+    std::atomic_uint64_t max_value{0};
+    void Add(uint64_t sample);
+};
+
+// The range map counters are updated from AccessContext code, which has no link back to its validator,
+// so they are process wide and shared by all devices that enabled stats.
+struct AccessMapCounters {
+    Value64 hazard_checks;
+    Value64 infilled_entries;
+    Value64 entries_added;  // infilled entries + entries created by splitting existing ones
+};
+
+extern std::atomic_bool access_map_counters_enabled;
+AccessMapCounters &GetAccessMapCounters();
+
+inline bool AccessMapCountersEnabled() { return access_map_counters_enabled.load(std::memory_order_relaxed); }
+inline void AddHazardCheck() {
+    if (AccessMapCountersEnabled()) GetAccessMapCounters().hazard_checks.Add(1);
+}
+inline void AddInfilledEntries(uint64_t count) {
+    if (AccessMapCountersEnabled()) GetAccessMapCounters().infilled_entries.Add(count);
+}
+inline void AddEntries(uint64_t count) {
+    if (AccessMapCountersEnabled()) GetAccessMapCounters().entries_added.Add(count);
+}
+
 struct Stats {
     ~Stats();
+    std::atomic_bool enabled{false};
     bool report_on_destruction = false;
+    bool IsEnabled() const { return enabled.load(std::memory_order_relaxed); }
+    void Enable();
 
     ValueMax32 command_buffer_context_counter;
     void AddCommandBufferContext();
@@ -58,18 +90,20 @@ struct Stats {
     void AddHandleRecord(uint32_t count = 1);
     void RemoveHandleRecord(uint32_t count = 1);
 
+    Value64 command_counter;
+    void AddCommand();
+
+    // Number of entries in the access map of recorded command buffer contexts and of submitted batch contexts
+    Samples64 command_buffer_access_map_size;
+    Samples64 batch_access_map_size;
+    void AddCommandBufferAccessMapSize(uint64_t size);
+    void AddBatchAccessMapSize(uint64_t size);
+
+    Samples64 submit_replay_time_ns;
+    void AddSubmitReplayTime(uint64_t nanoseconds);
+
     void ReportOnDestruction();
     std::string CreateReport();
 };
 
-#else
-struct Stats {
-    void AddHandleRecord(uint32_t count = 1) {}
-    void RemoveHandleRecord(uint32_t count = 1) {}
-    void AddCommandBufferContext() {}
-    void RemoveCommandBufferContext() {}
-    void ReportOnDestruction() {}
-    std::string CreateReport() { return "SyncVal stats are disabled in the current build configuration\n"; }
-};
-#endif  // VVL_ENABLE_SYNCVAL_STATS != 0
 }  // namespace syncval_stats
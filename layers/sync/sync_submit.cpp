@@ -18,6 +18,7 @@
 #include "sync/sync_submit.h"
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
+#include "utils/worker_pool.h"
 
 AcquiredImage::AcquiredImage(const PresentedImage& presented, ResourceUsageTag acq_tag)
     : image(presented.image), generator(presented.range_gen), present_tag(presented.tag), acquire_tag(acq_tag) {}
@@ -201,15 +202,19 @@ void QueueBatchContext::ApplyPredicatedWait(Predicate& predicate) {
 void QueueBatchContext::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
     const bool any_queue = (queue_id == kQueueAny);
 
-    if (any_queue) {
-        // This isn't just avoid an unneeded test, but to allow *all* queues to to be waited in a single pass
-        // (and it does avoid doing the same test for every access, as well as avoiding the need for the predicate
-        // to grok Queue/Device/Wait differences.
-        ResourceAccessState::WaitTagPredicate predicate{tag};
-        ApplyPredicatedWait(predicate);
-    } else {
-        ResourceAccessState::WaitQueueTagPredicate predicate{queue_id, tag};
-        ApplyPredicatedWait(predicate);
+    // Batches kept alive by unwaited signals see the same fence and queue waits over and over, once waited they are skipped
+    // until they get new accesses
+    if (access_context_.MayHaveAccessesToWait(queue_id, tag)) {
+        if (any_queue) {
+            // This isn't just avoid an unneeded test, but to allow *all* queues to to be waited in a single pass
+            // (and it does avoid doing the same test for every access, as well as avoiding the need for the predicate
+            // to grok Queue/Device/Wait differences.
+            ResourceAccessState::WaitTagPredicate predicate{tag};
+            access_context_.ApplyTaggedWait(predicate);
+        } else {
+            ResourceAccessState::WaitQueueTagPredicate predicate{queue_id, tag};
+            access_context_.ApplyTaggedWait(predicate);
+        }
     }
 
     // SwapChain acquire QBC's have no queue, but also, events are always empty.
@@ -387,7 +392,7 @@ void QueueBatchContext::LogPresentOperations(const PresentedImages& presented_im
         access_log->reserve(tag_range_.size());
         assert(tag_range_.size() == presented_images.size());
         for (const auto& presented : presented_images) {
-            access_log->emplace_back(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
+            access_log->AppendAlternate(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
         }
     }
 }
@@ -402,7 +407,7 @@ void QueueBatchContext::LogAcquireOperation(const PresentedImage& presented, vvl
     BatchAccessLog::BatchRecord batch{queue_state_};
     batch.base_tag = tag_range_.begin;
     batch_log_.Insert(batch, tag_range_, access_log);
-    access_log->emplace_back(AcquireResourceRecord(presented, tag_range_.begin, command));
+    access_log->AppendAlternate(AcquireResourceRecord(presented, tag_range_.begin, command));
 }
 
 void QueueBatchContext::SetupAccessContext(const PresentedImage& presented) {
@@ -452,7 +457,7 @@ std::string QueueBatchContext::FormatUsage(ResourceUsageTagEx tag_ex) const {
     BatchAccessLog::AccessRecord access = batch_log_.GetAccessRecord(tag_ex.tag);
     if (access.IsValid()) {
         const BatchAccessLog::BatchRecord& batch = *access.batch;
-        const ResourceUsageRecord& record = *access.record;
+        const ResourceUsageRecord& record = access.record;
         if (batch.queue) {
             // Queue and Batch information (for enqueued operations)
             out << SyncNodeFormatter(*sync_state_, batch.queue->GetQueueState());
@@ -514,11 +519,75 @@ std::vector<QueueBatchContext::ConstPtr> QueueBatchContext::ResolveSubmitDepende
     return batches_resolved;
 }
 
+// Address ranges written to the batch context by the command buffers of a submit resolved so far
+using BatchTouchedRanges = sparse_container::range_map<ResourceAddress, bool>;
+
+static bool IntersectsBatchTouchedRanges(const BatchTouchedRanges& touched, const ResourceAccessRangeMap& accesses) {
+    if (touched.empty()) {
+        return false;
+    }
+    for (const auto& access : accesses) {
+        const auto it = touched.lower_bound(access.first);
+        if (it != touched.end() && it->first.intersects(access.first)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void AddBatchTouchedRanges(BatchTouchedRanges& touched, const ResourceAccessRangeMap& accesses) {
+    // Adjacent entries are merged first, access maps are mostly made of contiguous pieces of the same resources
+    ResourceAccessRange pending;
+    for (const auto& access : accesses) {
+        if (pending.non_empty() && pending.end == access.first.begin) {
+            pending.end = access.first.end;
+            continue;
+        }
+        if (pending.non_empty()) {
+            sparse_container::update_range_value(touched, pending, true, sparse_container::value_precedence::prefer_dest);
+        }
+        pending = access.first;
+    }
+    if (pending.non_empty()) {
+        sparse_container::update_range_value(touched, pending, true, sparse_container::value_precedence::prefer_dest);
+    }
+}
+
 bool QueueBatchContext::ValidateSubmit(const VkSubmitInfo2& submit, uint64_t submit_index, uint32_t batch_index,
-                                       std::vector<std::string>& current_label_stack, const ErrorObject& error_obj) {
+                                       std::vector<vvl::CommandBuffer::LabelId>& current_label_stack,
+                                       const ErrorObject& error_obj) {
     bool skip = false;
     const std::vector<CommandBufferInfo> command_buffers = GetCommandBuffers(submit);
 
+    // With a worker pool, the first accesses of all command buffers are checked against the starting state of the batch in
+    // parallel. A command buffer that passes, and doesn't touch memory that an earlier command buffer of the batch
+    // resolved into the batch context, can't have a first use hazard in the replay either: at every address it uses the batch
+    // context only differs from the starting state by barriers, and barriers only remove hazards.
+    // Command buffers with render pass instances are replayed from the subpass contexts, so they are always fully replayed.
+    std::vector<uint8_t> start_state_hazard_free;
+    BatchTouchedRanges touched_ranges;
+    vvl::WorkerPool* worker_pool = GetSyncState().validation_worker_pool.get();
+    if (worker_pool && command_buffers.size() > 1 && ValidForSyncOps()) {
+        start_state_hazard_free.resize(command_buffers.size(), 0);
+        const AccessContext& batch_context = *GetCurrentAccessContext();
+        batch_context.PrepareConcurrentLookups();
+        const QueueId queue_id = GetQueueId();
+        vvl::ParallelFor(worker_pool, static_cast<uint32_t>(command_buffers.size()), [&](uint32_t i) {
+            const CommandBufferAccessContext& access_context = command_buffers[i].cb_state->access_context;
+            if (access_context.GetTagCount() == 0) {
+                return;
+            }
+            const auto& sync_ops = access_context.GetSyncOps();
+            if (std::any_of(sync_ops.begin(), sync_ops.end(), [](const auto& entry) { return entry.sync_op->ReplaysRenderPass(); })) {
+                return;
+            }
+            const ResourceUsageRange all_tags(0, ResourceUsageRecord::kMaxIndex);
+            const HazardResult hazard =
+                access_context.GetCurrentAccessContext()->DetectFirstUseHazard(queue_id, all_tags, batch_context);
+            start_state_hazard_free[i] = hazard.IsHazard() ? 0 : 1;
+        });
+    }
+
     BatchAccessLog::BatchRecord batch{queue_state_, submit_index, batch_index};
     uint32_t tag_count = 0;
     for (const auto& cb : command_buffers) {
@@ -527,11 +596,27 @@ bool QueueBatchContext::ValidateSubmit(const VkSubmitInfo2& submit, uint64_t sub
     if (tag_count) {
         batch.base_tag = SetupBatchTags(tag_count);
     }
-    for (const auto& cb : command_buffers) {
+    for (size_t i = 0; i < command_buffers.size(); ++i) {
+        const auto& cb = command_buffers[i];
         // Validate and resolve command buffers that has tagged commands
         const CommandBufferAccessContext& access_context = cb.cb_state->access_context;
         if (access_context.GetTagCount() > 0) {
-            skip |= ReplayState(*this, access_context, error_obj, cb.index, batch.base_tag).ValidateFirstUse();
+            GetSyncState().stats.AddCommandBufferAccessMapSize(
+                access_context.GetCurrentAccessContext()->GetAccessStateMap().size());
+            bool first_use_hazard_free = false;
+            if (!start_state_hazard_free.empty()) {
+                const ResourceAccessRangeMap& recorded_accesses = access_context.GetCurrentAccessContext()->GetAccessStateMap();
+                first_use_hazard_free =
+                    start_state_hazard_free[i] && !IntersectsBatchTouchedRanges(touched_ranges, recorded_accesses);
+                AddBatchTouchedRanges(touched_ranges, recorded_accesses);
+            }
+            // Past the frame budget, the first use hazards are only detected for a sample of the command buffers. The replay of
+            // the barriers and the resolve below still update the batch state.
+            if (!GetSyncState().SampleBudgetedCheck(submit_index + i)) {
+                first_use_hazard_free = true;
+            }
+            skip |= ReplayState(*this, access_context, error_obj, cb.index, batch.base_tag, first_use_hazard_free)
+                        .ValidateFirstUse();
             // The barriers have already been applied in ValidatFirstUse
             batch_log_.Import(batch, access_context, current_label_stack);
             ResolveSubmittedCommandBuffer(*access_context.GetCurrentAccessContext(), batch.base_tag);
@@ -621,7 +706,7 @@ uint64_t QueueSyncState::ReserveSubmitId() const { return submit_index_.fetch_ad
 void QueueSyncState::SetPendingLastBatch(QueueBatchContext::Ptr&& last) const { pending_last_batch_ = std::move(last); }
 
 void BatchAccessLog::Import(const BatchRecord& batch, const CommandBufferAccessContext& cb_access,
-                            const std::vector<std::string>& initial_label_stack) {
+                            const std::vector<vvl::CommandBuffer::LabelId>& initial_label_stack) {
     ResourceUsageRange import_range = {batch.base_tag, batch.base_tag + cb_access.GetTagCount()};
     log_map_.insert(std::make_pair(import_range, CBSubmitLog(batch, cb_access, initial_label_stack)));
 }
@@ -658,6 +743,9 @@ void BatchAccessLog::Insert(const BatchRecord& batch, const ResourceUsageRange&
 // Note that for each subcase, any "next steps" logic is designed to be handled within the subsequent iteration -- meaning that
 // each subcase simply handles the specifics of the current update/skip/erase action needed, and leaves the iterators in a sensible
 // state for the top of loop... intentionally eliding special case handling.
+//
+// A kept range usually references a few tags of a large command buffer, for example its last write to each resource. It is
+// compacted to the records of these tags, so retained batches don't keep every access log they were submitted with.
 void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
     auto current_tag = used_tags.cbegin();
     const auto end_tag = used_tags.cend();
@@ -683,7 +771,9 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
             } else {
                 // Skip the rest of the tags in this range
                 // If this is end, the next iteration will handle
-                current_tag = used_tags.lower_bound(range.end);
+                const auto range_end_tag = used_tags.lower_bound(range.end);
+                current_map_range->second.Compact(current_tag, range_end_tag);
+                current_tag = range_end_tag;
 
                 // This is a range we will keep, advance to the next. Next iteration handles end condition
                 ++current_map_range;
@@ -711,20 +801,51 @@ std::string BatchAccessLog::CBSubmitLog::GetDebugRegionName(const ResourceUsageR
 BatchAccessLog::AccessRecord BatchAccessLog::CBSubmitLog::GetAccessRecord(ResourceUsageTag tag) const {
     assert(tag >= batch_.base_tag);
     const size_t index = tag - batch_.base_tag;
-    assert(log_);
-    assert(index < log_->size());
-    const ResourceUsageRecord* record = &(*log_)[index];
-    const auto debug_name_provider = (record->label_command_index == vvl::kU32Max) ? nullptr : this;
+    ResourceUsageRecord record;
+    if (compact_log_) {
+        const auto& tag_offsets = compact_log_->tag_offsets;
+        auto found = std::lower_bound(tag_offsets.begin(), tag_offsets.end(), static_cast<uint32_t>(index));
+        if (found == tag_offsets.end() || *found != index) {
+            // Only the tags referenced when the log was compacted can be looked up
+            assert(false);
+            return AccessRecord();
+        }
+        record = compact_log_->records[found - tag_offsets.begin()];
+    } else {
+        assert(log_);
+        assert(index < log_->size());
+        record = (*log_)[index];
+    }
+    const auto debug_name_provider = (record.label_command_index == vvl::kU32Max) ? nullptr : this;
     return AccessRecord{&batch_, record, debug_name_provider};
 }
 
+void BatchAccessLog::CBSubmitLog::Compact(ResourceUsageTagSet::const_iterator first, ResourceUsageTagSet::const_iterator last) {
+    const size_t used_count = static_cast<size_t>(std::distance(first, last));
+    if (used_count * kCompactRatio > Size()) {
+        return;
+    }
+    auto compact_log = std::make_shared<CompactLog>();
+    compact_log->tag_offsets.reserve(used_count);
+    compact_log->records.reserve(used_count);
+    for (auto tag = first; tag != last; ++tag) {
+        const AccessRecord access = GetAccessRecord(*tag);
+        if (access.IsValid()) {
+            compact_log->tag_offsets.emplace_back(static_cast<uint32_t>(*tag - batch_.base_tag));
+            compact_log->records.AppendCopy(access.record);
+        }
+    }
+    compact_log_ = std::move(compact_log);
+    log_.reset();
+}
+
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch,
                                          std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                                          std::shared_ptr<const CommandExecutionContext::AccessLog> log)
     : batch_(batch), cbs_(cbs), log_(log) {}
 
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch, const CommandBufferAccessContext& cb,
-                                         const std::vector<std::string>& initial_label_stack)
+                                         const std::vector<vvl::CommandBuffer::LabelId>& initial_label_stack)
     : batch_(batch), cbs_(cb.GetCBReferencesShared()), log_(cb.GetAccessLogShared()), initial_label_stack_(initial_label_stack) {
     label_commands_ = (*cbs_)[0]->GetLabelCommands();  // TODO: when timelines are supported use cbs directly
 }
@@ -131,10 +131,10 @@ class BatchAccessLog {
     };
 
     struct AccessRecord {
-        const BatchRecord *batch;
-        const ResourceUsageRecord *record;
-        const DebugNameProvider *debug_name_provider;
-        bool IsValid() const { return batch && record; }
+        const BatchRecord *batch = nullptr;
+        ResourceUsageRecord record;
+        const DebugNameProvider *debug_name_provider = nullptr;
+        bool IsValid() const { return batch != nullptr; }
     };
 
     struct CBSubmitLog : DebugNameProvider {
@@ -147,19 +147,34 @@ class BatchAccessLog {
         CBSubmitLog(const BatchRecord &batch, std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                     std::shared_ptr<const CommandExecutionContext::AccessLog> log);
         CBSubmitLog(const BatchRecord &batch, const CommandBufferAccessContext &cb,
-                    const std::vector<std::string> &initial_label_stack);
-        size_t Size() const { return log_->size(); }
+                    const std::vector<vvl::CommandBuffer::LabelId> &initial_label_stack);
+        size_t Size() const { return compact_log_ ? compact_log_->records.size() : log_->size(); }
         AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
 
+        // Replaces the access log, shared with the command buffer and every other submission of it, by a copy of the
+        // records of the used tags [first, last) when these are a small part of the log
+        void Compact(ResourceUsageTagSet::const_iterator first, ResourceUsageTagSet::const_iterator last);
+
         // DebugNameProvider
         std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
 
       private:
+        // A log is compacted when less than 1 in kCompactRatio of its records are still referenced
+        static constexpr size_t kCompactRatio = 4;
+
+        // The records of the referenced tags, stored by their offset from the base tag of the batch
+        struct CompactLog {
+            std::vector<uint32_t> tag_offsets;  // sorted
+            CommandExecutionContext::AccessLog records;
+        };
+
         BatchRecord batch_;
         std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs_;
         std::shared_ptr<const CommandExecutionContext::AccessLog> log_;
+        // Set once the log is compacted, log_ is then released
+        std::shared_ptr<const CompactLog> compact_log_;
         // label stack at the point when command buffer is submitted to the queue
-        std::vector<std::string> initial_label_stack_;
+        std::vector<vvl::CommandBuffer::LabelId> initial_label_stack_;
 
         // TODO: remove this field and use (*cbs_)[0]->GetLabelCommands() directly
         // when timeline semaphore support is implemented.
@@ -173,7 +188,7 @@ class BatchAccessLog {
     };
 
     void Import(const BatchRecord &batch, const CommandBufferAccessContext &cb_access,
-                const std::vector<std::string> &initial_label_stack);
+                const std::vector<vvl::CommandBuffer::LabelId> &initial_label_stack);
     void Import(const BatchAccessLog &other);
     void Insert(const BatchRecord &batch, const ResourceUsageRange &range,
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
@@ -249,7 +264,7 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
                                                     const QueueBatchContext::ConstPtr &last_batch,
                                                     SignaledSemaphoresUpdate &signaled_semaphores_update);
     bool ValidateSubmit(const VkSubmitInfo2 &submit, uint64_t submit_index, uint32_t batch_index,
-                        std::vector<std::string> &current_label_stack, const ErrorObject &error_obj);
+                        std::vector<vvl::CommandBuffer::LabelId> &current_label_stack, const ErrorObject &error_obj);
     std::vector<CommandBufferInfo> GetCommandBuffers(const VkSubmitInfo2 &submit_info);
     void ResolveSubmittedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
 
@@ -16,6 +16,7 @@
  */
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -26,17 +27,31 @@
 #include "state_tracker/device_state.h"
 #include "state_tracker/buffer_state.h"
 #include "utils/convert_utils.h"
+#include "utils/trace_markers.h"
+#include "chassis/memory_report.h"
 
-SyncValidator::~SyncValidator() {
-    // Instance level SyncValidator does not have much to say
-    const bool device_validation_object = (device != nullptr);
-    // Get environment variable. Specify non-zero number to enable
-    const auto show_stats_str = GetEnvironment("VK_SYNCVAL_SHOW_STATS");
-    const bool show_stats = !show_stats_str.empty() && std::stoul(show_stats_str) != 0;
+void SyncValidator::ReportStats(const Location &loc) {
+    if (!syncval_settings.stats) return;
+    LogInfo("SYNCVAL_STATS", device, loc, "%s", stats.CreateReport().c_str());
+}
 
-    if (device_validation_object && show_stats) {
-        stats.ReportOnDestruction();
+void SyncValidator::AddMemoryUsage(vvl::MemoryUsage &usage) const {
+    StateTracker::AddMemoryUsage(usage);
+    // The last batch of each queue holds the accesses of everything submitted before it
+    for (const auto &batch : GetLastBatches([](const QueueBatchContext::ConstPtr &) { return true; })) {
+        if (const AccessContext *context = batch->GetCurrentAccessContext()) {
+            usage.Add(vvl::MemoryCategory::SyncMaps, context->GetMemoryUsage());
+        }
+    }
+}
+
+bool SyncValidator::IsInterceptNeeded(std::string_view hook) const {
+    // The submit time validation returns right away when disabled. Its record hooks still update the StateTracker.
+    if (disabled[sync_validation_queue_submit]) {
+        return hook != "PreCallValidateQueueSubmit" && hook != "PreCallValidateQueueSubmit2" &&
+               hook != "PreCallValidateQueueSubmit2KHR" && hook != "PreCallValidateQueuePresentKHR";
     }
+    return true;
 }
 
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
@@ -198,6 +213,32 @@ std::shared_ptr<vvl::ImageView> SyncValidator::CreateImageViewState(
     return std::make_shared<ImageViewState>(image_state, iv, ci, ff, cubic_props);
 }
 
+std::shared_ptr<vvl::Pipeline> SyncValidator::CreateGraphicsPipelineState(
+    const VkGraphicsPipelineCreateInfo *pCreateInfo, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+    std::shared_ptr<const vvl::RenderPass> &&render_pass, std::shared_ptr<const vvl::PipelineLayout> &&layout,
+    spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages], ShaderModuleUniqueIds *shader_unique_id_map) const {
+    return std::make_shared<syncval_state::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(render_pass),
+                                                     std::move(layout), stateless_data, shader_unique_id_map);
+}
+
+std::shared_ptr<vvl::Pipeline> SyncValidator::CreateComputePipelineState(const VkComputePipelineCreateInfo *pCreateInfo,
+                                                                         std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                                         std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                                         spirv::StatelessData *stateless_data) const {
+    return std::make_shared<syncval_state::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout),
+                                                     stateless_data);
+}
+
+std::shared_ptr<vvl::RenderPass> SyncValidator::CreateRenderPassState(VkRenderPass handle,
+                                                                      const VkRenderPassCreateInfo *pCreateInfo) const {
+    return std::make_shared<syncval_state::RenderPass>(handle, pCreateInfo);
+}
+
+std::shared_ptr<vvl::RenderPass> SyncValidator::CreateRenderPassState(VkRenderPass handle,
+                                                                      const VkRenderPassCreateInfo2 *pCreateInfo) const {
+    return std::make_shared<syncval_state::RenderPass>(handle, pCreateInfo);
+}
+
 bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                  uint32_t regionCount, const VkBufferCopy *pRegions,
                                                  const ErrorObject &error_obj) const {
@@ -621,16 +662,18 @@ void SyncValidator::PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, cons
         queue_sync_states_.emplace_back(std::make_shared<QueueSyncState>(queue, queue_id_limit_++));
     }
 
-    const auto env_debug_command_number = GetEnvironment("VK_SYNCVAL_DEBUG_COMMAND_NUMBER");
-    if (!env_debug_command_number.empty()) {
-        debug_command_number = static_cast<uint32_t>(std::stoul(env_debug_command_number));
+    if (syncval_settings.show_stats) {
+        stats.ReportOnDestruction();
     }
-    const auto env_debug_reset_count = GetEnvironment("VK_SYNCVAL_DEBUG_RESET_COUNT");
-    if (!env_debug_reset_count.empty()) {
-        debug_reset_count = static_cast<uint32_t>(std::stoul(env_debug_reset_count));
+    if (syncval_settings.stats) {
+        stats.Enable();
     }
-    debug_cmdbuf_pattern = GetEnvironment("VK_SYNCVAL_DEBUG_CMDBUF_PATTERN");
-    vvl::ToLower(debug_cmdbuf_pattern);
+}
+
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                               const RecordObject &record_obj) {
+    ReportStats(record_obj.location);
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -679,6 +722,16 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     cb_state->access_context.Reset();
 }
 
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    if (!cb_state) return;
+
+    // The recorded accesses no longer change, but are resolved into each primary executing this command buffer and each
+    // batch submitting it, walking ranges that differ only by where the recording happened to split them
+    cb_state->access_context.GetCurrentAccessContext()->Consolidate();
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, Func command) {
     auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
@@ -2548,7 +2601,7 @@ void SyncValidator::PostCallRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkE
     auto *cb_context = &cb_state->access_context;
 
     cb_context->RecordSyncOp<SyncOpSetEvent>(record_obj.location.function, *this, cb_context->GetQueueFlags(), event, stageMask,
-                                             cb_context->GetCurrentAccessContext());
+                                             cb_context->GetEventScopeSnapshot());
 }
 
 bool SyncValidator::PreCallValidateCmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
@@ -2588,7 +2641,7 @@ void SyncValidator::PostCallRecordCmdSetEvent2(VkCommandBuffer commandBuffer, Vk
     if (!pDependencyInfo) return;
 
     cb_context->RecordSyncOp<SyncOpSetEvent>(record_obj.location.function, *this, cb_context->GetQueueFlags(), event,
-                                             *pDependencyInfo, cb_context->GetCurrentAccessContext());
+                                             *pDependencyInfo, cb_context->GetEventScopeSnapshot());
 }
 
 bool SyncValidator::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
@@ -2882,6 +2935,9 @@ void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordOb
 
     // As we we've waited for everything on device, any waits are mooted. (except for acquires)
     vvl::EraseIf(waitable_fences_, [](SignaledFences::value_type &waitable) { return waitable.second.acquired.Invalid(); });
+
+    // Idling the device is where applications can ask for a snapshot of the stats
+    ReportStats(record_obj.location);
 }
 
 struct QueuePresentCmdState {
@@ -3044,10 +3100,12 @@ bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCou
 
 bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                         const ErrorObject &error_obj) const {
+    VVL_TRACE_SCOPE("SyncValidator::ValidateQueueSubmit");
     bool skip = false;
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
+    const vvl::CheckTimer check_timer(check_telemetry.get(), vvl::CheckFamily::SyncQueueSubmit);
 
     vvl::TlsGuard<QueueSubmitCmdState> cmd_state(&skip, *this);
     cmd_state->queue = GetQueueSyncStateShared(queue);
@@ -3075,7 +3133,13 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
         // TODO: All syncval tests pass when the return value is ignored. Write a regression test that fails/crashes in this case.
         const auto async_batches = batch->RegisterAsyncContexts(resolved_batches);
 
+        const auto replay_start = stats.IsEnabled() ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
         skip |= batch->ValidateSubmit(submit, submit_id, batch_idx, current_label_stack, error_obj);
+        if (stats.IsEnabled()) {
+            const auto replay_time = std::chrono::steady_clock::now() - replay_start;
+            stats.AddSubmitReplayTime(std::chrono::duration_cast<std::chrono::nanoseconds>(replay_time).count());
+            stats.AddBatchAccessMapSize(batch->GetCurrentAccessContext()->GetAccessStateMap().size());
+        }
 
         const auto signal_semaphores = vvl::make_span(submit.pSignalSemaphoreInfos, submit.signalSemaphoreInfoCount);
         for (const auto &semaphore_info : signal_semaphores) {
@@ -3249,12 +3313,34 @@ ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresou
 syncval_state::ImageViewState::ImageViewState(const std::shared_ptr<vvl::Image> &image_state, VkImageView handle,
                                               const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
                                               const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props)
-    : vvl::ImageView(image_state, handle, ci, ff, cubic_props), view_range_gen(MakeImageRangeGen()) {}
+    : vvl::ImageView(image_state, handle, ci, ff, cubic_props),
+      view_range_gen(MakeImageRangeGen()),
+      depth_range_gen(MakeAspectRangeGen(VK_IMAGE_ASPECT_DEPTH_BIT)),
+      stencil_range_gen(MakeAspectRangeGen(VK_IMAGE_ASPECT_STENCIL_BIT)) {}
 
 ImageRangeGen syncval_state::ImageViewState::MakeImageRangeGen() const {
     return GetImageState()->MakeImageRangeGen(normalized_subresource_range, IsDepthSliced());
 }
 
+std::optional<ImageRangeGen> syncval_state::ImageViewState::MakeAspectRangeGen(VkImageAspectFlags aspect) const {
+    const VkImageAspectFlags view_mask = normalized_subresource_range.aspectMask;
+    if (!(view_mask & aspect) || (view_mask == aspect)) {
+        return {};
+    }
+    VkImageSubresourceRange subresource_range = normalized_subresource_range;
+    subresource_range.aspectMask = aspect;
+    return GetImageState()->MakeImageRangeGen(subresource_range, IsDepthSliced());
+}
+
+bool syncval_state::ImageViewState::IsFullViewRenderArea(const VkOffset3D &offset, const VkExtent3D &extent) const {
+    // Depth sliced views address the slices of the render area depth, keep the general generators for them
+    if (IsDepthSliced() || offset.x != 0 || offset.y != 0 || offset.z != 0) {
+        return false;
+    }
+    const VkExtent3D view_extent = image_state->GetEffectiveSubresourceExtent(normalized_subresource_range);
+    return extent.width == view_extent.width && extent.height == view_extent.height && extent.depth == view_extent.depth;
+}
+
 ImageRangeGen syncval_state::ImageViewState::MakeImageRangeGen(const VkOffset3D &offset, const VkExtent3D &extent,
                                                                const VkImageAspectFlags aspect_mask) const {
     if (Invalid()) ImageRangeGen();
@@ -33,6 +33,8 @@ VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Imag
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, syncval_state::CommandBuffer, vvl::CommandBuffer)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkSwapchainKHR, syncval_state::Swapchain, vvl::Swapchain)
+VALSTATETRACK_DERIVED_STATE_OBJECT(VkPipeline, syncval_state::Pipeline, vvl::Pipeline)
+VALSTATETRACK_DERIVED_STATE_OBJECT(VkRenderPass, syncval_state::RenderPass, vvl::RenderPass)
 
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
@@ -44,7 +46,6 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using Field = vvl::Field;
 
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
-    ~SyncValidator();
 
     // Stats object must be the first member of this class:
     // - it is the first to be constructed: can observe all subsequent syncval stats events
@@ -64,10 +65,6 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using SignaledFences = vvl::unordered_map<VkFence, FenceSyncState>;
     SignaledFences waitable_fences_;
 
-    uint32_t debug_command_number = vvl::kU32Max;
-    uint32_t debug_reset_count = 1;
-    std::string debug_cmdbuf_pattern;
-
     // Applies information from update object to signaled_semaphores_.
     // The update object is mutable to be able to std::move SignalInfo from it.
     void UpdateSignaledSemaphores(SignaledSemaphoresUpdate &update, const QueueBatchContext::Ptr &last_batch);
@@ -103,6 +100,20 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     std::shared_ptr<vvl::ImageView> CreateImageViewState(const std::shared_ptr<vvl::Image> &image_state, VkImageView iv,
                                                          const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
                                                          const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) final;
+    std::shared_ptr<vvl::Pipeline> CreateGraphicsPipelineState(const VkGraphicsPipelineCreateInfo *pCreateInfo,
+                                                               std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                               std::shared_ptr<const vvl::RenderPass> &&render_pass,
+                                                               std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                               spirv::StatelessData stateless_data[kCommonMaxGraphicsShaderStages],
+                                                               ShaderModuleUniqueIds *shader_unique_id_map) const final;
+    std::shared_ptr<vvl::Pipeline> CreateComputePipelineState(const VkComputePipelineCreateInfo *pCreateInfo,
+                                                              std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
+                                                              std::shared_ptr<const vvl::PipelineLayout> &&layout,
+                                                              spirv::StatelessData *stateless_data) const final;
+    std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle,
+                                                           const VkRenderPassCreateInfo *pCreateInfo) const final;
+    std::shared_ptr<vvl::RenderPass> CreateRenderPassState(VkRenderPass handle,
+                                                           const VkRenderPassCreateInfo2 *pCreateInfo) const final;
 
     void RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                   const VkSubpassBeginInfo *pSubpassBeginInfo, Func command);
@@ -112,6 +123,12 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
     void PostCreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                    const RecordObject &record_obj) override;
+    // Sends the stats report as an information message when enabled with the syncval_stats setting
+    void ReportStats(const Location &loc);
+    void AddMemoryUsage(vvl::MemoryUsage &usage) const override;
+    bool IsInterceptNeeded(std::string_view hook) const override;
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const;
@@ -187,6 +204,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                           const RecordObject &record_obj) override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) override;
 
     void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                           VkSubpassContents contents, const RecordObject &record_obj) override;
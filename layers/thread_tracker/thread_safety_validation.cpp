@@ -23,6 +23,152 @@ ReadLockGuard ThreadSafety::ReadLock() const { return ReadLockGuard(validation_o
 
 WriteLockGuard ThreadSafety::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
 
+namespace {
+// Indices handed out to the threads, only locked the first time a thread uses an object and when it exits
+struct ThreadIndexRegistry {
+    std::mutex lock;
+    // Thread id of each index, index 0 is never used
+    std::vector<std::thread::id> thread_ids{std::thread::id()};
+    std::vector<uint32_t> free_indices;
+};
+
+// Never destroyed, threads can still exit after the static objects are gone
+ThreadIndexRegistry &GetThreadIndexRegistry() {
+    static ThreadIndexRegistry *registry = new ThreadIndexRegistry();
+    return *registry;
+}
+
+struct ThreadIndex {
+    uint32_t index;
+
+    ThreadIndex() {
+        ThreadIndexRegistry &registry = GetThreadIndexRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        if (registry.free_indices.empty()) {
+            index = static_cast<uint32_t>(registry.thread_ids.size());
+            registry.thread_ids.emplace_back(std::this_thread::get_id());
+        } else {
+            index = registry.free_indices.back();
+            registry.free_indices.pop_back();
+            registry.thread_ids[index] = std::this_thread::get_id();
+        }
+    }
+    ~ThreadIndex() {
+        ThreadIndexRegistry &registry = GetThreadIndexRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        registry.free_indices.emplace_back(index);
+    }
+};
+}  // namespace
+
+uint32_t CurrentThreadIndex() {
+    thread_local ThreadIndex thread_index;
+    return thread_index.index;
+}
+
+std::thread::id ThreadIdOfIndex(uint32_t index) {
+    ThreadIndexRegistry &registry = GetThreadIndexRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    return index < registry.thread_ids.size() ? registry.thread_ids[index] : std::thread::id();
+}
+
+std::atomic<uint64_t> ThreadSafety::next_owner_cache_id{1};
+thread_local CommandBufferOwnerCache ThreadSafety::owner_cache;
+
+bool ThreadSafety::TryStartWriteOwned(VkCommandBuffer object, bool lockPool) {
+    CommandBufferOwnerCache &cache = owner_cache;
+    if (cache.thread_safety_id != owner_cache_id || cache.command_buffer != object ||
+        cache.cb_epoch != c_VkCommandBuffer.destroy_epoch.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    ObjectUseData &cb_use_data = *cache.cb_use_data;
+    ObjectUseData *pool_use_data = lockPool ? cache.pool_use_data.get() : nullptr;
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+    if (pool_use_data && cache.pool_epoch != c_VkCommandPool.destroy_epoch.load(std::memory_order_relaxed)) {
+        return false;
+    }
+#endif
+    const std::thread::id tid = cache.thread_id;
+    if (!cb_use_data.IsOwnedBy(tid) || (pool_use_data && !pool_use_data->IsOwnedBy(tid))) {
+        return false;
+    }
+    cb_use_data.AddOwnerUse();
+    if (pool_use_data) {
+        pool_use_data->AddOwnerUse();
+    }
+    // Another thread revoked the ownership while we were counting, let the full path report it
+    if (!cb_use_data.IsOwnedBy(tid) || (pool_use_data && !pool_use_data->IsOwnedBy(tid))) {
+        cb_use_data.RemoveOwnerUse();
+        if (pool_use_data) {
+            pool_use_data->RemoveOwnerUse();
+        }
+        return false;
+    }
+    cache.fast_write_depth++;
+    if (pool_use_data) {
+        cache.fast_pool_write_depth++;
+    }
+    return true;
+}
+
+bool ThreadSafety::TryFinishWriteOwned(VkCommandBuffer object, bool lockPool) {
+    CommandBufferOwnerCache &cache = owner_cache;
+    if (cache.fast_write_depth == 0 || cache.thread_safety_id != owner_cache_id || cache.command_buffer != object) {
+        return false;
+    }
+    // Owner use counts are only ever written by this thread, so they are released even if the ownership got revoked
+    cache.cb_use_data->RemoveOwnerUse();
+    cache.fast_write_depth--;
+    if (lockPool && cache.pool_use_data) {
+        assert(cache.fast_pool_write_depth > 0);
+        cache.pool_use_data->RemoveOwnerUse();
+        cache.fast_pool_write_depth--;
+    }
+    return true;
+}
+
+void ThreadSafety::UpdateOwnerCache(VkCommandBuffer object) {
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+    CommandBufferOwnerCache &cache = owner_cache;
+    if (cache.fast_write_depth != 0) {
+        return;
+    }
+    const uint64_t cb_epoch = c_VkCommandBuffer.destroy_epoch.load(std::memory_order_relaxed);
+    const uint64_t pool_epoch = c_VkCommandPool.destroy_epoch.load(std::memory_order_relaxed);
+    if (cache.thread_safety_id == owner_cache_id && cache.command_buffer == object && cache.cb_epoch == cb_epoch &&
+        cache.pool_epoch == pool_epoch) {
+        return;
+    }
+
+    // Refilling is the slow path, so these lookups are only paid when switching command buffers
+    auto cb_iter = c_VkCommandBuffer.object_table.find(object);
+    if (cb_iter == c_VkCommandBuffer.object_table.end()) {
+        return;
+    }
+    std::shared_ptr<ObjectUseData> pool_use_data;
+    auto pool_iter = command_pool_map.find(object);
+    if (pool_iter != command_pool_map.end()) {
+        auto pool_use_iter = c_VkCommandPool.object_table.find(pool_iter->second);
+        if (pool_use_iter == c_VkCommandPool.object_table.end()) {
+            return;
+        }
+        pool_use_data = pool_use_iter->second;
+    }
+
+    cache.thread_safety_id = owner_cache_id;
+    cache.thread_id = std::this_thread::get_id();
+    cache.command_buffer = object;
+    cache.cb_epoch = cb_epoch;
+    cache.pool_epoch = pool_epoch;
+    cache.cb_use_data = cb_iter->second;
+    cache.pool_use_data = std::move(pool_use_data);
+    cache.fast_pool_write_depth = 0;
+#else
+    // Command pools share a counter with every other non-dispatchable handle, so there is no cheap ownership for them
+    (void)object;
+#endif
+}
+
 void ThreadSafety::PreCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                        VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
@@ -91,15 +237,27 @@ void ThreadSafety::PostCallRecordAllocateDescriptorSets(VkDevice device, const V
     if (VK_SUCCESS == record_obj.result) {
         auto lock = WriteLockGuard(thread_safety_lock);
         auto& pool_descriptor_sets = pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
+        pool_descriptor_sets.reserve(pool_descriptor_sets.size() + pAllocateInfo->descriptorSetCount);
+        // Sets are usually allocated many at a time with the same layout, only look the layout up when it changes
+        VkDescriptorSetLayout last_layout = VK_NULL_HANDLE;
+        bool read_only = false;
         for (uint32_t index0 = 0; index0 < pAllocateInfo->descriptorSetCount; index0++) {
             CreateObject(pDescriptorSets[index0]);
             pool_descriptor_sets.insert(pDescriptorSets[index0]);
 
-            auto iter = dsl_read_only_map.find(pAllocateInfo->pSetLayouts[index0]);
-            if (iter != dsl_read_only_map.end()) {
-                ds_read_only_map.insert_or_assign(pDescriptorSets[index0], iter->second);
-            } else {
-                assert(false && "descriptor set layout not found");
+            if (index0 == 0 || pAllocateInfo->pSetLayouts[index0] != last_layout) {
+                last_layout = pAllocateInfo->pSetLayouts[index0];
+                auto iter = dsl_read_only_map.find(last_layout);
+                if (iter != dsl_read_only_map.end()) {
+                    read_only = iter->second;
+                } else {
+                    read_only = false;
+                    assert(false && "descriptor set layout not found");
+                }
+            }
+            if (read_only) {
+                ds_read_only_map.insert_or_assign(pDescriptorSets[index0], true);
+                ds_read_only_pools.insert(pAllocateInfo->descriptorPool);
             }
         }
     }
@@ -133,11 +291,14 @@ void ThreadSafety::PostCallRecordFreeDescriptorSets(VkDevice device, VkDescripto
     if (VK_SUCCESS == record_obj.result) {
         auto lock = WriteLockGuard(thread_safety_lock);
         auto& pool_descriptor_sets = pool_descriptor_sets_map[descriptorPool];
+        const bool has_read_only = ds_read_only_pools.count(descriptorPool) != 0;
         for (uint32_t index0 = 0; index0 < descriptorSetCount; index0++) {
             auto descriptor_set = pDescriptorSets[index0];
             DestroyObject(descriptor_set);
             pool_descriptor_sets.erase(descriptor_set);
-            ds_read_only_map.erase(descriptor_set);
+            if (has_read_only) {
+                ds_read_only_map.erase(descriptor_set);
+            }
         }
     }
 }
@@ -151,7 +312,7 @@ void ThreadSafety::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescrip
     auto iterator = pool_descriptor_sets_map.find(descriptorPool);
     // Possible to have no descriptor sets allocated from pool
     if (iterator != pool_descriptor_sets_map.end()) {
-        for (auto descriptor_set : pool_descriptor_sets_map[descriptorPool]) {
+        for (auto descriptor_set : iterator->second) {
             StartWriteObject(descriptor_set, record_obj.location);
         }
     }
@@ -166,12 +327,7 @@ void ThreadSafety::PostCallRecordDestroyDescriptorPool(VkDevice device, VkDescri
     {
         auto lock = WriteLockGuard(thread_safety_lock);
         // remove references to implicitly freed descriptor sets
-        for (auto descriptor_set : pool_descriptor_sets_map[descriptorPool]) {
-            FinishWriteObject(descriptor_set, record_obj.location);
-            DestroyObject(descriptor_set);
-            ds_read_only_map.erase(descriptor_set);
-        }
-        pool_descriptor_sets_map[descriptorPool].clear();
+        RemoveDescriptorSets(descriptorPool, record_obj.location);
         pool_descriptor_sets_map.erase(descriptorPool);
     }
 }
@@ -186,7 +342,7 @@ void ThreadSafety::PreCallRecordResetDescriptorPool(VkDevice device, VkDescripto
     auto iterator = pool_descriptor_sets_map.find(descriptorPool);
     // Possible to have no descriptor sets allocated from pool
     if (iterator != pool_descriptor_sets_map.end()) {
-        for (auto descriptor_set : pool_descriptor_sets_map[descriptorPool]) {
+        for (auto descriptor_set : iterator->second) {
             StartWriteObject(descriptor_set, record_obj.location);
         }
     }
@@ -201,13 +357,26 @@ void ThreadSafety::PostCallRecordResetDescriptorPool(VkDevice device, VkDescript
     if (VK_SUCCESS == record_obj.result) {
         // remove references to implicitly freed descriptor sets
         auto lock = WriteLockGuard(thread_safety_lock);
-        for (auto descriptor_set : pool_descriptor_sets_map[descriptorPool]) {
-            FinishWriteObject(descriptor_set, record_obj.location);
-            DestroyObject(descriptor_set);
+        RemoveDescriptorSets(descriptorPool, record_obj.location);
+    }
+}
+
+// Drops every set allocated from pool, thread_safety_lock must be held for writing
+void ThreadSafety::RemoveDescriptorSets(VkDescriptorPool pool, const Location& loc) {
+    auto iter = pool_descriptor_sets_map.find(pool);
+    if (iter == pool_descriptor_sets_map.end()) {
+        return;
+    }
+    auto& pool_descriptor_sets = iter->second;
+    const bool has_read_only = ds_read_only_pools.erase(pool) != 0;
+    for (auto descriptor_set : pool_descriptor_sets) {
+        FinishWriteObject(descriptor_set, loc);
+        DestroyObject(descriptor_set);
+        if (has_read_only) {
             ds_read_only_map.erase(descriptor_set);
         }
-        pool_descriptor_sets_map[descriptorPool].clear();
     }
+    pool_descriptor_sets.clear();
 }
 
 bool ThreadSafety::DsReadOnly(VkDescriptorSet set) const {
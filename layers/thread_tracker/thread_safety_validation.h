@@ -42,45 +42,52 @@ static_assert(std::is_same<uint64_t, DISTINCT_NONDISPATCHABLE_PHONY_HANDLE>::val
               "Mismatched non-dispatchable handle handle, expected uint64_t.");
 #endif
 
-// Modern CPUs have 64 or 128-byte cache line sizes (Apple M1 has 128-byte cache line size).
-// Use alignment of 64 bytes (instead of 128) to prioritize using less memory and decrease
-// cache pressure.
-inline constexpr size_t kObjectUserDataAlignment = 64;
-static_assert(vku::concurrent::get_hardware_destructive_interference_size() % kObjectUserDataAlignment ==
-              0);  // sanity check on the build machine
-
-class alignas(kObjectUserDataAlignment) ObjectUseData {
+// Small index of the calling thread, so that ObjectUseData can pack the thread using an object with its use counts. The
+// indices start at 1 and the ones of exited threads are reused.
+uint32_t CurrentThreadIndex();
+// For the error messages, the thread an index was last given to
+std::thread::id ThreadIdOfIndex(uint32_t index);
+
+// Not aligned to a cache line: an object is mostly used by a single thread at a time, and the few bytes keep the
+// shared_ptr allocations of the object tables small.
+class ObjectUseData {
   public:
+    // Read count, write count and index of the thread last using the object while it was idle, in a single word so that a
+    // use is a single atomic operation
     class WriteReadCount {
       public:
-        explicit WriteReadCount(int64_t v) : count(v) {}
+        explicit WriteReadCount(uint64_t v) : packed(v) {}
 
-        int32_t GetReadCount() const { return static_cast<int32_t>(count & 0xFFFFFFFF); }
-        int32_t GetWriteCount() const { return static_cast<int32_t>(count >> 32); }
+        int32_t GetReadCount() const { return static_cast<int32_t>(packed & kCountMask); }
+        int32_t GetWriteCount() const { return static_cast<int32_t>((packed >> kWriteShift) & kCountMask); }
+        uint32_t GetThreadIndex() const { return static_cast<uint32_t>(packed >> kThreadShift); }
+        bool IsIdle() const { return (packed & kCountsMask) == 0; }
 
       private:
-        int64_t count{};
+        uint64_t packed;
     };
 
-    WriteReadCount AddWriter() {
-        int64_t prev = writer_reader_count.fetch_add(1ULL << 32);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount AddReader() {
-        int64_t prev = writer_reader_count.fetch_add(1ULL);
-        return WriteReadCount(prev);
-    }
+    WriteReadCount AddWriter(uint32_t thread_index) { return AddUse(kWriter, thread_index); }
+    WriteReadCount AddReader(uint32_t thread_index) { return AddUse(kReader, thread_index); }
     WriteReadCount RemoveWriter() {
-        int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
-        assert(prev > 0);
+        const uint64_t prev = packed_.fetch_sub(kWriter, std::memory_order_acq_rel);
+        assert(WriteReadCount(prev).GetWriteCount() > 0);
         return WriteReadCount(prev);
     }
     WriteReadCount RemoveReader() {
-        int64_t prev = writer_reader_count.fetch_add(-1LL);
-        assert(prev > 0);
+        const uint64_t prev = packed_.fetch_sub(kReader, std::memory_order_acq_rel);
+        assert(WriteReadCount(prev).GetReadCount() > 0);
         return WriteReadCount(prev);
     }
-    WriteReadCount GetCount() { return WriteReadCount(writer_reader_count); }
+    WriteReadCount GetCount() const { return WriteReadCount(packed_.load(std::memory_order_acquire)); }
+
+    // After a collision, the thread reporting it becomes the one using the object
+    void SetThreadIndex(uint32_t thread_index) {
+        uint64_t prev = packed_.load(std::memory_order_relaxed);
+        while (!packed_.compare_exchange_weak(prev, (prev & kCountsMask) | (uint64_t(thread_index) << kThreadShift),
+                                              std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        }
+    }
 
     void WaitForObjectIdle(bool is_writer) {
         // Wait for thread-safe access to object instead of skipping call.
@@ -89,11 +96,55 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
         }
     }
 
-    std::atomic<std::thread::id> thread{};
+    // Used by the owner cache mode (see ThreadSafety::TryStartWriteOwned)
+    // While a thread owns the object, it counts its own writes in owner_use_count with plain loads and stores. Any other
+    // thread first revokes the ownership and then looks at owner_use_count to detect a collision.
+    std::atomic<std::thread::id> owner{};
+    std::atomic<int32_t> owner_use_count{};
+
+    bool IsOwnedBy(std::thread::id tid) const { return owner.load(std::memory_order_relaxed) == tid; }
+    // Only the owner thread is allowed to call these
+    void AddOwnerUse() { owner_use_count.store(owner_use_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+    void RemoveOwnerUse() {
+        assert(owner_use_count.load(std::memory_order_relaxed) > 0);
+        owner_use_count.store(owner_use_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
 
   private:
-    // Need to update write and read counts atomically. Writer in high 32 bits, reader in low 32 bits.
-    std::atomic<int64_t> writer_reader_count{};
+    // [63 .. 44] thread index | [43 .. 22] write count | [21 .. 0] read count
+    static constexpr uint32_t kWriteShift = 22;
+    static constexpr uint32_t kThreadShift = 44;
+    static constexpr uint64_t kCountMask = (1ull << kWriteShift) - 1;
+    static constexpr uint64_t kCountsMask = (1ull << kThreadShift) - 1;
+    static constexpr uint64_t kReader = 1;
+    static constexpr uint64_t kWriter = 1ull << kWriteShift;
+
+    // An idle object records the thread starting to use it, in the same atomic operation as the count
+    WriteReadCount AddUse(uint64_t use, uint32_t thread_index) {
+        uint64_t prev = packed_.load(std::memory_order_relaxed);
+        uint64_t next = 0;
+        do {
+            next = WriteReadCount(prev).IsIdle() ? (uint64_t(thread_index) << kThreadShift) | use : prev + use;
+        } while (!packed_.compare_exchange_weak(prev, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+        return WriteReadCount(prev);
+    }
+
+    std::atomic<uint64_t> packed_{0};
+};
+
+// Owner cache mode: per-thread memo of the last command buffer used by the thread (and its pool). While the thread owns both
+// objects, repeated uses skip the object_table lookups and the shared atomic counters entirely.
+struct CommandBufferOwnerCache {
+    uint64_t thread_safety_id = 0;
+    uint64_t cb_epoch = 0;
+    uint64_t pool_epoch = 0;
+    std::thread::id thread_id{};
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    std::shared_ptr<ObjectUseData> cb_use_data;
+    std::shared_ptr<ObjectUseData> pool_use_data;
+    // Number of fast path uses not finished yet. The cache can't be refilled while this is not zero.
+    uint32_t fast_write_depth = 0;
+    uint32_t fast_pool_write_depth = 0;
 };
 
 template <typename T>
@@ -104,11 +155,19 @@ class counter {
 
     vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
 
+    // When set, objects of this counter can be owned by a thread in the owner cache mode
+    bool track_owner = false;
+    // Bumped on every destroy, so per-thread caches of ObjectUseData can't outlive a reused handle
+    std::atomic<uint64_t> destroy_epoch{0};
+
     void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
 
     void DestroyObject(T object) {
         if (object) {
             object_table.erase(object);
+            if (track_owner) {
+                destroy_epoch.fetch_add(1, std::memory_order_relaxed);
+            }
         }
     }
 
@@ -136,18 +195,20 @@ class counter {
         }
 
         const std::thread::id tid = std::this_thread::get_id();
-        const ObjectUseData::WriteReadCount prev_count = use_data->AddWriter();
+        RevokeOwner(use_data, object, loc, tid);
+        const uint32_t thread_index = CurrentThreadIndex();
+        // The writer thread is recorded with the count when there is no current use of the object
+        const ObjectUseData::WriteReadCount prev_count = use_data->AddWriter(thread_index);
         const bool prev_read = prev_count.GetReadCount() != 0;
         const bool prev_write = prev_count.GetWriteCount() != 0;
 
         if (!prev_read && !prev_write) {
-            // There is no current use of the object. Record writer thread.
-            use_data->thread = tid;
+            GrantOwner(*use_data, tid);
         } else if (!prev_read) {
             assert(prev_write);
             // There are no other readers but there is another writer. Two writers just collided.
-            if (use_data->thread != tid) {
-                HandleErrorOnWrite(use_data, object, loc);
+            if (prev_count.GetThreadIndex() != thread_index) {
+                HandleErrorOnWrite(use_data, object, loc, prev_count.GetThreadIndex());
             } else {
                 // This is either safe multiple use in one call, or recursive use.
                 // There is no way to make recursion safe. Just forge ahead.
@@ -155,8 +216,8 @@ class counter {
         } else {
             assert(prev_read);
             // There are other readers. This writer collided with them.
-            if (use_data->thread != tid) {
-                HandleErrorOnWrite(use_data, object, loc);
+            if (prev_count.GetThreadIndex() != thread_index) {
+                HandleErrorOnWrite(use_data, object, loc, prev_count.GetThreadIndex());
             } else {
                 // This is either safe multiple use in one call, or recursive use.
                 // There is no way to make recursion safe. Just forge ahead.
@@ -184,16 +245,14 @@ class counter {
             return;
         }
 
-        const std::thread::id tid = std::this_thread::get_id();
-        const ObjectUseData::WriteReadCount prev_count = use_data->AddReader();
-        const bool prev_read = prev_count.GetReadCount() != 0;
+        RevokeOwner(use_data, object, loc, std::this_thread::get_id());
+        const uint32_t thread_index = CurrentThreadIndex();
+        // The reader thread is recorded with the count when there is no current use of the object
+        const ObjectUseData::WriteReadCount prev_count = use_data->AddReader(thread_index);
         const bool prev_write = prev_count.GetWriteCount() != 0;
 
-        if (!prev_read && !prev_write) {
-            // There is no current use of the object. Record reader thread.
-            use_data->thread = tid;
-        } else if (prev_write && use_data->thread != tid) {
-            HandleErrorOnRead(use_data, object, loc);
+        if (prev_write && prev_count.GetThreadIndex() != thread_index) {
+            HandleErrorOnRead(use_data, object, loc, prev_count.GetThreadIndex());
         } else {
             // There are other readers of the object.
         }
@@ -216,6 +275,30 @@ class counter {
     }
 
   private:
+    // The owner is the only thread taking the fast path, so it only needs to be given up when someone else shows up
+    void RevokeOwner(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location &loc, std::thread::id tid) {
+        const std::thread::id owner = use_data->owner.load(std::memory_order_acquire);
+        if (owner == std::thread::id() || owner == tid) {
+            return;
+        }
+        use_data->owner.store(std::thread::id(), std::memory_order_seq_cst);
+        // Owner uses are always writes, so anything still in flight collides with us
+        if (use_data->owner_use_count.load(std::memory_order_seq_cst) > 0) {
+            const std::string error_message = GetErrorMessage(tid, owner);
+            object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Write", object, loc, "%s", error_message.c_str());
+        }
+    }
+
+    void GrantOwner(ObjectUseData &use_data, std::thread::id tid) {
+        if (!track_owner || !object_data->enabled[thread_safety_owner_cache]) {
+            return;
+        }
+        if (use_data.owner.load(std::memory_order_relaxed) == std::thread::id() &&
+            use_data.owner_use_count.load(std::memory_order_relaxed) == 0) {
+            use_data.owner.store(tid, std::memory_order_release);
+        }
+    }
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << string_VulkanObjectType(object_type)
@@ -223,32 +306,31 @@ class counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc,
+                            uint32_t other_thread_index) {
         const std::thread::id tid = std::this_thread::get_id();
-        const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
+        const std::string error_message = GetErrorMessage(tid, ThreadIdOfIndex(other_thread_index));
         const bool skip =
             object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Write", object, loc, "%s", error_message.c_str());
         if (skip) {
             // Wait for thread-safe access to object instead of skipping call.
             use_data->WaitForObjectIdle(true);
-            // There is now no current use of the object. Record writer thread.
-            use_data->thread = tid;
-        } else {
-            // There is now no current use of the object. Record writer thread.
-            use_data->thread = tid;
         }
+        // Record writer thread.
+        use_data->SetThreadIndex(CurrentThreadIndex());
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc,
+                           uint32_t other_thread_index) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
-        const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
+        const auto error_message = GetErrorMessage(tid, ThreadIdOfIndex(other_thread_index));
         const bool skip =
             object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Read", object, loc, "%s", error_message.c_str());
         if (skip) {
             // Wait for thread-safe access to object instead of skipping call.
             use_data->WaitForObjectIdle(false);
-            use_data->thread = tid;
+            use_data->SetThreadIndex(CurrentThreadIndex());
         }
     }
 };
@@ -279,8 +361,12 @@ class ThreadSafety : public ValidationObject {
     // Descriptor sets using VK_DESCRIPTOR_SET_LAYOUT_CREATE_HOST_ONLY_POOL_BIT_EXT can also
     // be used simultaneously in multiple threads
     vvl::concurrent_unordered_map<VkDescriptorSetLayout, bool, 4> dsl_read_only_map;
+    // Only sets that are read_only are added, DsReadOnly() treats a missing set as not read_only
     vvl::concurrent_unordered_map<VkDescriptorSet, bool, 6> ds_read_only_map;
+    // Pools that had a read_only set allocated since their last reset, the others can skip ds_read_only_map on free/reset
+    vvl::unordered_set<VkDescriptorPool> ds_read_only_pools;
     bool DsReadOnly(VkDescriptorSet) const;
+    void RemoveDescriptorSets(VkDescriptorPool pool, const Location& loc);
 
     counter<VkCommandBuffer> c_VkCommandBuffer;
     counter<VkDevice> c_VkDevice;
@@ -305,6 +391,11 @@ class ThreadSafety : public ValidationObject {
     // for objects created with the instance as parent.
     ThreadSafety *parent_instance;
 
+    // Identifies this object in the per-thread CommandBufferOwnerCache
+    const uint64_t owner_cache_id;
+    static std::atomic<uint64_t> next_owner_cache_id;
+    static thread_local CommandBufferOwnerCache owner_cache;
+
     ThreadSafety(ThreadSafety *parent)
         : c_VkCommandBuffer(kVulkanObjectTypeCommandBuffer, this),
           c_VkDevice(kVulkanObjectTypeDevice, this),
@@ -316,8 +407,13 @@ class ThreadSafety : public ValidationObject {
 #else   // DISTINCT_NONDISPATCHABLE_HANDLES
           c_uint64_t(kVulkanObjectTypeUnknown, this),
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
-          parent_instance(parent) {
+          parent_instance(parent),
+          owner_cache_id(next_owner_cache_id++) {
         container_type = LayerObjectTypeThreading;
+        c_VkCommandBuffer.track_owner = true;
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+        c_VkCommandPool.track_owner = true;
+#endif
     };
 
 #define WRAPPER(type)                                                                                 \
@@ -328,6 +424,20 @@ class ThreadSafety : public ValidationObject {
     void CreateObject(type object) { c_##type.CreateObject(object); }                                 \
     void DestroyObject(type object) { c_##type.DestroyObject(object); }
 
+// The objects only externally synchronized by their destruction (see immutable_handles in thread_safety_generator.py) are
+// read by every command using them, tracking these reads only catches a use racing with the destruction
+#define WRAPPER_IMMUTABLE(type)                                                                       \
+    void StartWriteObject(type object, const Location& loc) { c_##type.StartWrite(object, loc); }   \
+    void FinishWriteObject(type object, const Location& loc) { c_##type.FinishWrite(object, loc); } \
+    void StartReadObject(type object, const Location& loc) {                                          \
+        if (!enabled[thread_safety_skip_immutable_reads]) c_##type.StartRead(object, loc);            \
+    }                                                                                                 \
+    void FinishReadObject(type object, const Location& loc) {                                         \
+        if (!enabled[thread_safety_skip_immutable_reads]) c_##type.FinishRead(object, loc);           \
+    }                                                                                                 \
+    void CreateObject(type object) { c_##type.CreateObject(object); }                                 \
+    void DestroyObject(type object) { c_##type.DestroyObject(object); }
+
 #define WRAPPER_PARENT_INSTANCE(type)                                                                                           \
     void StartWriteObjectParentInstance(type object, const Location& loc) {                                                       \
         (parent_instance ? parent_instance : this)->c_##type.StartWrite(object, loc);                                       \
@@ -357,8 +467,15 @@ class ThreadSafety : public ValidationObject {
     void CreateObject(VkCommandBuffer object) { c_VkCommandBuffer.CreateObject(object); }
     void DestroyObject(VkCommandBuffer object) { c_VkCommandBuffer.DestroyObject(object); }
 
+    bool TryStartWriteOwned(VkCommandBuffer object, bool lockPool);
+    bool TryFinishWriteOwned(VkCommandBuffer object, bool lockPool);
+    void UpdateOwnerCache(VkCommandBuffer object);
+
     // VkCommandBuffer needs check for implicit use of command pool
     void StartWriteObject(VkCommandBuffer object, const Location& loc, bool lockPool = true) {
+        if (enabled[thread_safety_owner_cache] && TryStartWriteOwned(object, lockPool)) {
+            return;
+        }
         if (lockPool) {
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
@@ -367,8 +484,14 @@ class ThreadSafety : public ValidationObject {
             }
         }
         c_VkCommandBuffer.StartWrite(object, loc);
+        if (enabled[thread_safety_owner_cache]) {
+            UpdateOwnerCache(object);
+        }
     }
     void FinishWriteObject(VkCommandBuffer object, const Location& loc, bool lockPool = true) {
+        if (enabled[thread_safety_owner_cache] && TryFinishWriteOwned(object, lockPool)) {
+            return;
+        }
         c_VkCommandBuffer.FinishWrite(object, loc);
         if (lockPool) {
             auto iter = command_pool_map.find(object);
@@ -0,0 +1,327 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/arena_allocator.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+
+namespace vvl {
+
+const char *ArenaName(Arena arena) {
+    switch (arena) {
+        case Arena::StateTracker:
+            return "StateTracker";
+        case Arena::SyncVal:
+            return "SyncVal";
+        case Arena::Spirv:
+            return "Spirv";
+        case Arena::GpuAV:
+            return "GpuAV";
+        case Arena::ErrorMessage:
+            return "ErrorMessage";
+        case Arena::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+namespace {
+
+constexpr size_t kChunkSize = 64 * 1024;
+constexpr size_t kSizeClassGranularity = 16;
+constexpr size_t kMaxPooledSize = 1024;
+constexpr size_t kSizeClassCount = kMaxPooledSize / kSizeClassGranularity;
+
+// Largest block served by the pools of each arena
+constexpr std::array<size_t, kArenaCount> kPooledSize = {
+    512,   // StateTracker: the deque blocks of the command buffer parent links
+    1024,  // SyncVal: the access map nodes, a ResourceAccessState each
+    256,   // Spirv: the decoration and variable lists of the smaller modules
+    1024,  // GpuAV: the error logger vectors of command buffers with a few validated commands
+    0,     // ErrorMessage: the deferred message deque, only counted
+};
+
+// Where a chunk or a large block was allocated: the heap, or the callbacks of one InstallAllocationCallbacks
+using Source = uint64_t;
+constexpr Source kHeapSource = 0;
+
+// Header at the start of each chunk. The chunks are aligned to their size, so a block finds its chunk by masking its address.
+struct Chunk {
+    Chunk *next = nullptr;
+    Source source = kHeapSource;
+    uint32_t live_blocks = 0;
+    // Set when the callbacks were removed while some blocks were still used, the chunk is never reused nor freed
+    bool abandoned = false;
+};
+constexpr size_t kChunkHeaderSize = (sizeof(Chunk) + kSizeClassGranularity - 1) / kSizeClassGranularity * kSizeClassGranularity;
+
+// Stored right before a large block
+struct LargeHeader {
+    Source source;
+};
+
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+struct SizeClassPool {
+    std::mutex lock;
+    FreeBlock *free_list = nullptr;
+    Chunk *chunks = nullptr;
+    // Chunk the never used blocks are carved from, an offset of kChunkSize means a new chunk is needed
+    Chunk *current = nullptr;
+    size_t carve_offset = kChunkSize;
+};
+
+struct ArenaState {
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> peak_bytes{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> total_allocations{0};
+    std::atomic<uint64_t> pooled_allocations{0};
+    std::atomic<uint64_t> pool_bytes{0};
+    std::array<SizeClassPool, kSizeClassCount> pools;
+};
+
+struct Backing {
+    std::shared_mutex lock;
+    VkAllocationCallbacks callbacks{};
+    Source installed = kHeapSource;
+    Source last_source = kHeapSource;
+};
+
+struct State {
+    Backing backing;
+    std::array<ArenaState, kArenaCount> arenas;
+};
+
+// Never destroyed, containers of other static objects can still free their blocks at exit
+State &GetState() {
+    static State *state = new State();
+    return *state;
+}
+
+void *BackingAllocate(size_t size, size_t alignment, Source &source) {
+    Backing &backing = GetState().backing;
+    {
+        std::shared_lock<std::shared_mutex> guard(backing.lock);
+        if (backing.installed != kHeapSource) {
+            void *ptr = backing.callbacks.pfnAllocation(backing.callbacks.pUserData, size, alignment,
+                                                        VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+            source = backing.installed;
+            return ptr;
+        }
+    }
+    source = kHeapSource;
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+void BackingFree(void *ptr, size_t alignment, Source source) {
+    if (source == kHeapSource) {
+        ::operator delete(ptr, std::align_val_t(alignment));
+        return;
+    }
+    Backing &backing = GetState().backing;
+    std::shared_lock<std::shared_mutex> guard(backing.lock);
+    // Otherwise the callbacks were removed and the block is left to the application heap
+    if (source == backing.installed) {
+        backing.callbacks.pfnFree(backing.callbacks.pUserData, ptr);
+    }
+}
+
+Chunk *ChunkOf(void *block) { return reinterpret_cast<Chunk *>(reinterpret_cast<uintptr_t>(block) & ~uintptr_t(kChunkSize - 1)); }
+
+size_t SizeClass(size_t size) { return (size - 1) / kSizeClassGranularity; }
+
+bool IsPooled(Arena arena, size_t size, size_t alignment) {
+    return size != 0 && size <= kPooledSize[static_cast<uint32_t>(arena)] && alignment <= kSizeClassGranularity;
+}
+
+void *PoolAllocate(ArenaState &state, size_t size_class) {
+    SizeClassPool &pool = state.pools[size_class];
+    const size_t block_size = (size_class + 1) * kSizeClassGranularity;
+    std::lock_guard<std::mutex> guard(pool.lock);
+    if (FreeBlock *block = pool.free_list) {
+        pool.free_list = block->next;
+        ChunkOf(block)->live_blocks++;
+        return block;
+    }
+    if (pool.carve_offset + block_size > kChunkSize) {
+        Source source = kHeapSource;
+        Chunk *chunk = new (BackingAllocate(kChunkSize, kChunkSize, source)) Chunk();
+        chunk->source = source;
+        chunk->next = pool.chunks;
+        pool.chunks = chunk;
+        pool.current = chunk;
+        pool.carve_offset = kChunkHeaderSize;
+        state.pool_bytes.fetch_add(kChunkSize, std::memory_order_relaxed);
+    }
+    void *block = reinterpret_cast<char *>(pool.current) + pool.carve_offset;
+    pool.carve_offset += block_size;
+    pool.current->live_blocks++;
+    return block;
+}
+
+void PoolFree(ArenaState &state, size_t size_class, void *ptr) {
+    SizeClassPool &pool = state.pools[size_class];
+    Chunk *chunk = ChunkOf(ptr);
+    std::lock_guard<std::mutex> guard(pool.lock);
+    chunk->live_blocks--;
+    if (!chunk->abandoned) {
+        FreeBlock *block = static_cast<FreeBlock *>(ptr);
+        block->next = pool.free_list;
+        pool.free_list = block;
+    }
+}
+
+// The header keeps the block aligned, and is large enough for LargeHeader
+size_t LargeHeaderSize(size_t alignment) { return std::max(alignment, kSizeClassGranularity); }
+
+void *LargeAllocate(size_t size, size_t alignment) {
+    const size_t header_size = LargeHeaderSize(alignment);
+    Source source = kHeapSource;
+    char *base = static_cast<char *>(BackingAllocate(size + header_size, header_size, source));
+    reinterpret_cast<LargeHeader *>(base + header_size - sizeof(LargeHeader))->source = source;
+    return base + header_size;
+}
+
+void LargeFree(void *ptr, size_t alignment) {
+    const size_t header_size = LargeHeaderSize(alignment);
+    char *base = static_cast<char *>(ptr) - header_size;
+    const Source source = reinterpret_cast<LargeHeader *>(base + header_size - sizeof(LargeHeader))->source;
+    BackingFree(base, header_size, source);
+}
+
+}  // namespace
+
+namespace arena {
+
+void *Allocate(Arena arena, size_t size, size_t alignment) {
+    ArenaState &state = GetState().arenas[static_cast<uint32_t>(arena)];
+    void *ptr = nullptr;
+    if (IsPooled(arena, size, alignment)) {
+        ptr = PoolAllocate(state, SizeClass(size));
+        state.pooled_allocations.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        ptr = LargeAllocate(size, alignment);
+    }
+
+    const uint64_t bytes = state.bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peak = state.peak_bytes.load(std::memory_order_relaxed);
+    while (bytes > peak && !state.peak_bytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+    }
+    state.allocations.fetch_add(1, std::memory_order_relaxed);
+    state.total_allocations.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+}
+
+void Free(Arena arena, void *ptr, size_t size, size_t alignment) noexcept {
+    if (!ptr) {
+        return;
+    }
+    ArenaState &state = GetState().arenas[static_cast<uint32_t>(arena)];
+    if (IsPooled(arena, size, alignment)) {
+        PoolFree(state, SizeClass(size), ptr);
+    } else {
+        LargeFree(ptr, alignment);
+    }
+    state.bytes.fetch_sub(size, std::memory_order_relaxed);
+    state.allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+ArenaStats GetStats(Arena arena) {
+    const ArenaState &state = GetState().arenas[static_cast<uint32_t>(arena)];
+    ArenaStats stats;
+    stats.bytes = state.bytes.load(std::memory_order_relaxed);
+    stats.peak_bytes = state.peak_bytes.load(std::memory_order_relaxed);
+    stats.allocations = state.allocations.load(std::memory_order_relaxed);
+    stats.total_allocations = state.total_allocations.load(std::memory_order_relaxed);
+    stats.pooled_allocations = state.pooled_allocations.load(std::memory_order_relaxed);
+    stats.pool_bytes = state.pool_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool InstallAllocationCallbacks(const VkAllocationCallbacks &callbacks) {
+    Backing &backing = GetState().backing;
+    std::unique_lock<std::shared_mutex> guard(backing.lock);
+    if (backing.installed != kHeapSource) {
+        return false;
+    }
+    backing.callbacks = callbacks;
+    backing.installed = ++backing.last_source;
+    return true;
+}
+
+void RemoveAllocationCallbacks() {
+    State &state = GetState();
+    VkAllocationCallbacks callbacks{};
+    Source removed = kHeapSource;
+    {
+        std::unique_lock<std::shared_mutex> guard(state.backing.lock);
+        if (state.backing.installed == kHeapSource) {
+            return;
+        }
+        callbacks = state.backing.callbacks;
+        removed = state.backing.installed;
+        state.backing.installed = kHeapSource;
+    }
+
+    // New allocations already go to the heap, the pools drop every free block and chunk that came from the callbacks
+    for (ArenaState &arena_state : state.arenas) {
+        for (SizeClassPool &pool : arena_state.pools) {
+            std::lock_guard<std::mutex> guard(pool.lock);
+            FreeBlock **block_link = &pool.free_list;
+            while (*block_link) {
+                if (ChunkOf(*block_link)->source == removed) {
+                    *block_link = (*block_link)->next;
+                } else {
+                    block_link = &(*block_link)->next;
+                }
+            }
+            if (pool.current && pool.current->source == removed) {
+                pool.current = nullptr;
+                pool.carve_offset = kChunkSize;
+            }
+            Chunk **chunk_link = &pool.chunks;
+            while (Chunk *chunk = *chunk_link) {
+                if (chunk->source != removed) {
+                    chunk_link = &chunk->next;
+                    continue;
+                }
+                *chunk_link = chunk->next;
+                arena_state.pool_bytes.fetch_sub(kChunkSize, std::memory_order_relaxed);
+                if (chunk->live_blocks == 0) {
+                    chunk->~Chunk();
+                    callbacks.pfnFree(callbacks.pUserData, chunk);
+                } else {
+                    chunk->abandoned = true;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace arena
+}  // namespace vvl
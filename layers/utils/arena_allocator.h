@@ -0,0 +1,101 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vulkan/vulkan.h>
+
+namespace vvl {
+
+// Subsystems of the layer whose containers allocate from their own arena
+enum class Arena : uint32_t {
+    StateTracker,
+    SyncVal,
+    Spirv,
+    GpuAV,
+    ErrorMessage,
+    Count,
+};
+constexpr uint32_t kArenaCount = static_cast<uint32_t>(Arena::Count);
+
+const char *ArenaName(Arena arena);
+
+struct ArenaStats {
+    // Bytes and allocations currently held by the containers of the arena
+    uint64_t bytes = 0;
+    uint64_t peak_bytes = 0;
+    uint64_t allocations = 0;
+    uint64_t total_allocations = 0;
+    // Allocations served by the size-class pools, out of total_allocations
+    uint64_t pooled_allocations = 0;
+    // Chunks held by the pools, their blocks being used or free
+    uint64_t pool_bytes = 0;
+};
+
+// Layer-wide allocation of the containers that opt in with ArenaAllocator.
+//
+// Each arena has size-class pools for the blocks up to a size picked after the objects it mostly holds (the access map
+// nodes of syncval, the links and small vectors of the state tracker...). A pool carves its blocks out of 64KB chunks and
+// keeps the freed blocks for reuse, larger blocks are allocated one by one. The chunks and the larger blocks come from the
+// heap, or from the VkAllocationCallbacks of vkCreateInstance when the app_allocation_callbacks setting installed them.
+namespace arena {
+
+// Throws std::bad_alloc like operator new, the containers expect it
+void *Allocate(Arena arena, size_t size, size_t alignment);
+void Free(Arena arena, void *ptr, size_t size, size_t alignment) noexcept;
+ArenaStats GetStats(Arena arena);
+
+// The callbacks serve the allocations of every instance until RemoveAllocationCallbacks, so they must outlive all the
+// instances created in the meantime. Returns false if the callbacks of another instance are already installed.
+bool InstallAllocationCallbacks(const VkAllocationCallbacks &callbacks);
+// Frees the chunks allocated from the callbacks, nothing is allocated from them afterwards. The blocks still used at this
+// point (objects of another instance) stay where they are and are never freed.
+void RemoveAllocationCallbacks();
+
+}  // namespace arena
+
+// Standard allocator on top of an arena, for instance std::deque<T, vvl::ArenaAllocator<T, vvl::Arena::SyncVal>>
+template <typename T, Arena A>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+    // The arena is a non-type parameter, allocator_traits can't rebind it by itself
+    template <typename U>
+    struct rebind {
+        using other = ArenaAllocator<U, A>;
+    };
+
+    ArenaAllocator() noexcept = default;
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U, A> &) noexcept {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena::Allocate(A, n * sizeof(T), alignof(T))); }
+    void deallocate(T *ptr, size_t n) noexcept { arena::Free(A, ptr, n * sizeof(T), alignof(T)); }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U, A> &) const noexcept {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U, A> &) const noexcept {
+        return false;
+    }
+};
+
+}  // namespace vvl
@@ -47,4 +47,6 @@ uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     return XXH64(info, info_size, seed);
 }
 
+uint64_t ValidationCacheHash(const void *data, const size_t size, uint64_t seed) { return XXH64(data, size, seed); }
+
 }  // namespace hash_util
\ No newline at end of file
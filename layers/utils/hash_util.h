@@ -164,4 +164,7 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
+// Stable from one run to the next, for what is stored in the validation cache file. Chained with the seed.
+uint64_t ValidationCacheHash(const void *data, const size_t size, uint64_t seed = 0);
+
 }  // namespace hash_util
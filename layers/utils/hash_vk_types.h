@@ -27,7 +27,7 @@
 // Hash and equality and/or compare functions for selected Vk types (and useful collections thereof)
 
 // VkDescriptorSetLayoutBinding
-static inline bool operator==(const vku::safe_VkDescriptorSetLayoutBinding &lhs, const vku::safe_VkDescriptorSetLayoutBinding &rhs) {
+static inline bool operator==(const VkDescriptorSetLayoutBinding &lhs, const VkDescriptorSetLayoutBinding &rhs) {
     if ((lhs.binding != rhs.binding) || (lhs.descriptorType != rhs.descriptorType) ||
         (lhs.descriptorCount != rhs.descriptorCount) || (lhs.stageFlags != rhs.stageFlags) ||
         !hash_util::SimilarForNullity(lhs.pImmutableSamplers, rhs.pImmutableSamplers)) {
@@ -45,8 +45,8 @@ static inline bool operator==(const vku::safe_VkDescriptorSetLayoutBinding &lhs,
 
 namespace std {
 template <>
-struct hash<vku::safe_VkDescriptorSetLayoutBinding> {
-    size_t operator()(const vku::safe_VkDescriptorSetLayoutBinding &value) const {
+struct hash<VkDescriptorSetLayoutBinding> {
+    size_t operator()(const VkDescriptorSetLayoutBinding &value) const {
         hash_util::HashCombiner hc;
         hc << value.binding << value.descriptorType << value.descriptorCount << value.stageFlags;
         if (value.pImmutableSamplers) {
@@ -129,3 +129,51 @@ struct hash<VkShaderModuleIdentifierEXT> {
     }
 };
 }  // namespace std
+
+// Pipeline states, the pNext chains are not hashed
+namespace std {
+template <>
+struct hash<VkPipelineColorBlendStateCreateInfo> {
+    size_t operator()(const VkPipelineColorBlendStateCreateInfo &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.flags << value.logicOpEnable << value.logicOp << value.attachmentCount;
+        hc.Combine(value.blendConstants, value.blendConstants + 4);
+        if (value.pAttachments) {
+            for (uint32_t i = 0; i < value.attachmentCount; i++) {
+                const VkPipelineColorBlendAttachmentState &attachment = value.pAttachments[i];
+                hc << attachment.blendEnable << attachment.srcColorBlendFactor << attachment.dstColorBlendFactor
+                   << attachment.colorBlendOp << attachment.srcAlphaBlendFactor << attachment.dstAlphaBlendFactor
+                   << attachment.alphaBlendOp << attachment.colorWriteMask;
+            }
+        }
+        return hc.Value();
+    }
+};
+
+template <>
+struct hash<VkPipelineMultisampleStateCreateInfo> {
+    size_t operator()(const VkPipelineMultisampleStateCreateInfo &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.flags << value.rasterizationSamples << value.sampleShadingEnable << value.minSampleShading
+           << value.alphaToCoverageEnable << value.alphaToOneEnable;
+        // The sample mask is left to the equality check, its length depends on the sample count
+        if (value.pSampleMask) {
+            hc << value.pSampleMask[0];
+        }
+        return hc.Value();
+    }
+};
+
+template <>
+struct hash<VkPipelineDepthStencilStateCreateInfo> {
+    size_t operator()(const VkPipelineDepthStencilStateCreateInfo &value) const {
+        hash_util::HashCombiner hc;
+        hc << value.flags << value.depthTestEnable << value.depthWriteEnable << value.depthCompareOp << value.depthBoundsTestEnable
+           << value.stencilTestEnable << value.minDepthBounds << value.maxDepthBounds;
+        for (const VkStencilOpState *op : {&value.front, &value.back}) {
+            hc << op->failOp << op->passOp << op->depthFailOp << op->compareOp << op->compareMask << op->writeMask << op->reference;
+        }
+        return hc.Value();
+    }
+};
+}  // namespace std
@@ -0,0 +1,170 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/lock_profile.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vvl {
+namespace lock_profile {
+
+std::atomic_bool enabled{false};
+
+// Only written by their thread, so counting an acquisition doesn't add a shared cache line to the lock being measured.
+// They are atomics because the report reads them from another thread.
+struct SiteCounters {
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> contended{0};
+    std::atomic<uint64_t> wait_ns{0};
+    std::atomic<uint64_t> max_wait_ns{0};
+};
+
+struct ThreadCounters {
+    std::array<SiteCounters, kLockSiteCount> sites;
+};
+
+struct Profile {
+    std::mutex lock;
+    uint32_t users = 0;
+    // Bumped on every Begin so threads don't keep counting into the counters of a previous profile
+    std::atomic<uint64_t> session{0};
+    std::string output_file;
+    std::vector<std::unique_ptr<ThreadCounters>> threads;
+};
+
+static Profile &GetProfile() {
+    static Profile profile;
+    return profile;
+}
+
+static void Add(std::atomic<uint64_t> &counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+const char *SiteName(LockSite site) {
+    switch (site) {
+        case LockSite::HandleTable:
+            return "HandleTable";
+        case LockSite::StateMap:
+            return "StateMap";
+        case LockSite::DescriptorSetManager:
+            return "DescriptorSetManager";
+        case LockSite::DebugOutput:
+            return "DebugOutput";
+        case LockSite::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+void Begin(const std::string &output_file) {
+    Profile &profile = GetProfile();
+    std::lock_guard<std::mutex> guard(profile.lock);
+    if (profile.users++ == 0) {
+        profile.threads.clear();
+        profile.session.fetch_add(1, std::memory_order_release);
+        profile.output_file = output_file;
+        enabled.store(true);
+    }
+}
+
+static void WriteProfile(const Profile &profile) {
+    struct Totals {
+        uint32_t site;
+        uint64_t acquisitions = 0;
+        uint64_t contended = 0;
+        uint64_t wait_ns = 0;
+        uint64_t max_wait_ns = 0;
+    };
+    std::array<Totals, kLockSiteCount> totals;
+    for (uint32_t i = 0; i < kLockSiteCount; ++i) {
+        totals[i].site = i;
+        for (const auto &thread : profile.threads) {
+            const SiteCounters &counters = thread->sites[i];
+            totals[i].acquisitions += counters.acquisitions.load(std::memory_order_relaxed);
+            totals[i].contended += counters.contended.load(std::memory_order_relaxed);
+            totals[i].wait_ns += counters.wait_ns.load(std::memory_order_relaxed);
+            totals[i].max_wait_ns = std::max(totals[i].max_wait_ns, counters.max_wait_ns.load(std::memory_order_relaxed));
+        }
+    }
+    // Most waited on first
+    std::sort(totals.begin(), totals.end(), [](const Totals &a, const Totals &b) { return a.wait_ns > b.wait_ns; });
+
+    std::ofstream out(profile.output_file);
+    if (!out) {
+        printf("Validation Setting Warning - could not open %s to write the lock contention report\n",
+               profile.output_file.c_str());
+        return;
+    }
+    // One lock per line, tests/benchmarks reads them back
+    out << "{\n\"threads\": " << profile.threads.size() << ",\n\"locks\": [\n";
+    bool first = true;
+    for (const Totals &site : totals) {
+        if (site.acquisitions == 0) continue;
+        out << (first ? "" : ",\n") << "{\"lock\": \"" << SiteName(static_cast<LockSite>(site.site))
+            << "\", \"acquisitions\": " << site.acquisitions << ", \"contended\": " << site.contended
+            << ", \"wait_ns\": " << site.wait_ns << ", \"max_wait_ns\": " << site.max_wait_ns << "}";
+        first = false;
+    }
+    out << "\n]\n}\n";
+}
+
+void End() {
+    Profile &profile = GetProfile();
+    std::lock_guard<std::mutex> guard(profile.lock);
+    if (profile.users == 0 || --profile.users != 0) return;
+    enabled.store(false);
+    WriteProfile(profile);
+}
+
+void RecordAcquisition(LockSite site, bool contended, std::chrono::steady_clock::duration wait) {
+    struct Cache {
+        uint64_t session = 0;
+        ThreadCounters *counters = nullptr;
+    };
+    thread_local Cache cache;
+
+    // Only the first acquisition of a thread in a profile takes the lock
+    Profile &profile = GetProfile();
+    if (cache.session != profile.session.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> guard(profile.lock);
+        // The profile may have been ended while this lock was taken
+        if (!IsEnabled()) return;
+        profile.threads.emplace_back(std::make_unique<ThreadCounters>());
+        cache.session = profile.session.load(std::memory_order_relaxed);
+        cache.counters = profile.threads.back().get();
+    }
+    SiteCounters &counters = cache.counters->sites[static_cast<uint32_t>(site)];
+    Add(counters.acquisitions, 1);
+    if (contended) {
+        const uint64_t wait_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count());
+        Add(counters.contended, 1);
+        Add(counters.wait_ns, wait_ns);
+        if (wait_ns > counters.max_wait_ns.load(std::memory_order_relaxed)) {
+            counters.max_wait_ns.store(wait_ns, std::memory_order_relaxed);
+        }
+    }
+}
+
+}  // namespace lock_profile
+}  // namespace vvl
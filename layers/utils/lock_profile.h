@@ -0,0 +1,90 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Contention of the locks shared by the threads calling the layer, to check that a contention fix actually scales.
+//
+// A lock is profiled by declaring it as a ProfiledMutex of its site. Acquisitions first try the lock: only when that fails
+// the wait is timed and counted as contended. Like the trace markers the profile is process wide, the handle table and the
+// debug report are not owned by a device. When it is disabled, a lock costs one relaxed load on top of the mutex.
+namespace vvl {
+
+enum class LockSite : uint32_t {
+    HandleTable,           // free list of unique_id_mapping
+    StateMap,              // buckets of the vvl::StateMap of the state objects
+    DescriptorSetManager,  // gpu::DescriptorSetManager, the descriptor pools of GPU-AV and debug printf
+    DebugOutput,           // DebugReport::debug_output_mutex
+    Count,
+};
+constexpr uint32_t kLockSiteCount = static_cast<uint32_t>(LockSite::Count);
+
+namespace lock_profile {
+
+extern std::atomic_bool enabled;
+inline bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+// Reference counted by the devices that enabled the profile, the last End() writes the file
+void Begin(const std::string &output_file);
+void End();
+
+const char *SiteName(LockSite site);
+void RecordAcquisition(LockSite site, bool contended, std::chrono::steady_clock::duration wait);
+
+}  // namespace lock_profile
+
+template <typename Mutex, LockSite site>
+class ProfiledMutex {
+  public:
+    void lock() {
+        if (!lock_profile::IsEnabled()) {
+            mutex_.lock();
+        } else if (mutex_.try_lock()) {
+            lock_profile::RecordAcquisition(site, false, {});
+        } else {
+            const auto start = std::chrono::steady_clock::now();
+            mutex_.lock();
+            lock_profile::RecordAcquisition(site, true, std::chrono::steady_clock::now() - start);
+        }
+    }
+    bool try_lock() { return mutex_.try_lock(); }
+    void unlock() { mutex_.unlock(); }
+
+    // Only for the shared mutexes
+    void lock_shared() {
+        if (!lock_profile::IsEnabled()) {
+            mutex_.lock_shared();
+        } else if (mutex_.try_lock_shared()) {
+            lock_profile::RecordAcquisition(site, false, {});
+        } else {
+            const auto start = std::chrono::steady_clock::now();
+            mutex_.lock_shared();
+            lock_profile::RecordAcquisition(site, true, std::chrono::steady_clock::now() - start);
+        }
+    }
+    bool try_lock_shared() { return mutex_.try_lock_shared(); }
+    void unlock_shared() { mutex_.unlock_shared(); }
+
+  private:
+    Mutex mutex_;
+};
+
+}  // namespace vvl
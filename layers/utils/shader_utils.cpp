@@ -19,6 +19,8 @@
 
 #include "shader_utils.h"
 
+#include <cstring>
+
 #include "generated/device_features.h"
 #include "utils/hash_util.h"
 
@@ -48,52 +50,71 @@ void ValidationCache::GetUUID(uint8_t *uuid) {
 }
 
 void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-    auto size = headerSize;
+    auto size = kHeaderSize;
     if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
 
+    // A header size that doesn't match is also how the caches written before the specializations were added are discarded
     uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
     if (data[0] != size) return;
     if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
     uint8_t expected_uuid[VK_UUID_SIZE];
     GetUUID(expected_uuid);
     if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+    const uint32_t shader_hash_count = data[2 + VK_UUID_SIZE / sizeof(uint32_t)];
+    if (shader_hash_count > (pCreateInfo->initialDataSize - size) / sizeof(uint32_t)) return;  // truncated
 
-    data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
-
+    auto const *bytes = reinterpret_cast<uint8_t const *>(pCreateInfo->pInitialData);
     auto guard = WriteLock();
-    for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-        good_shader_hashes_.insert(*data);
+    for (uint32_t i = 0; i < shader_hash_count; i++, size += sizeof(uint32_t)) {
+        uint32_t hash = 0;
+        std::memcpy(&hash, bytes + size, sizeof(hash));
+        good_shader_hashes_.insert(hash);
+    }
+    for (; size + kSpecializationRecordSize <= pCreateInfo->initialDataSize; size += kSpecializationRecordSize) {
+        uint64_t hash = 0;
+        Specialization specialization{};
+        std::memcpy(&hash, bytes + size, sizeof(hash));
+        std::memcpy(&specialization, bytes + size + sizeof(hash), sizeof(specialization));
+        good_specializations_.emplace(hash, specialization);
     }
 }
 
 void ValidationCache::Write(size_t *pDataSize, void *pData) {
-    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+    auto guard = ReadLock();
     if (!pData) {
-        *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
+        *pDataSize = kHeaderSize + good_shader_hashes_.size() * sizeof(uint32_t) +
+                     good_specializations_.size() * kSpecializationRecordSize;
         return;
     }
 
-    if (*pDataSize < headerSize) {
+    if (*pDataSize < kHeaderSize) {
         *pDataSize = 0;
         return;  // Too small for even the header!
     }
 
     uint32_t *out = (uint32_t *)pData;
-    size_t actualSize = headerSize;
+    size_t actualSize = kHeaderSize;
 
     // Write the header
-    *out++ = headerSize;
+    *out++ = kHeaderSize;
     *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
     GetUUID(reinterpret_cast<uint8_t *>(out));
     out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
-
-    {
-        auto guard = ReadLock();
-        for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize < *pDataSize;
-             it++, out++, actualSize += sizeof(uint32_t)) {
-            *out = *it;
-        }
+    uint32_t *shader_hash_count = out++;
+
+    // Only whole entries are written when the size is too small for all of them
+    *shader_hash_count = 0;
+    for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize + sizeof(uint32_t) <= *pDataSize;
+         it++, out++, actualSize += sizeof(uint32_t)) {
+        *out = *it;
+        (*shader_hash_count)++;
+    }
+    auto *bytes = reinterpret_cast<uint8_t *>(pData);
+    for (auto it = good_specializations_.begin();
+         it != good_specializations_.end() && actualSize + kSpecializationRecordSize <= *pDataSize;
+         it++, actualSize += kSpecializationRecordSize) {
+        std::memcpy(bytes + actualSize, &it->first, sizeof(it->first));
+        std::memcpy(bytes + actualSize + sizeof(it->first), &it->second, sizeof(it->second));
     }
 
     *pDataSize = actualSize;
@@ -108,6 +129,7 @@ void ValidationCache::Merge(ValidationCache const *other) {
     auto guard = WriteLock();
     good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
     for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+    good_specializations_.insert(other->good_specializations_.begin(), other->good_specializations_.end());
 }
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
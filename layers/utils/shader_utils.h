@@ -25,6 +25,8 @@
 
 #include <spirv-tools/libspirv.hpp>
 
+#include <optional>
+
 struct DeviceFeatures;
 struct DeviceExtensions;
 class APIVersion;
@@ -90,8 +92,35 @@ class ValidationCache {
         good_shader_hashes_.insert(hash);
     }
 
+    // What the pipeline checks need from an entry point whose specialization passed spirv-opt and spirv-val
+    struct Specialization {
+        uint32_t local_size_x;
+        uint32_t local_size_y;
+        uint32_t local_size_z;
+        uint32_t total_workgroup_shared_memory;
+    };
+
+    std::optional<Specialization> FindSpecialization(uint64_t hash) const {
+        auto guard = ReadLock();
+        auto it = good_specializations_.find(hash);
+        if (it == good_specializations_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void InsertSpecialization(uint64_t hash, const Specialization &specialization) {
+        auto guard = WriteLock();
+        good_specializations_.emplace(hash, specialization);
+    }
+
   private:
     ValidationCache(uint32_t spirv_val_option_hash) : spirv_val_option_hash_(spirv_val_option_hash) {}
+
+    // Size, version, UUID and count of shader hashes. The shader hashes follow, then the specializations
+    static constexpr size_t kHeaderSize = 3 * sizeof(uint32_t) + VK_UUID_SIZE;
+    // Hash, then Specialization
+    static constexpr size_t kSpecializationRecordSize = sizeof(uint64_t) + sizeof(Specialization);
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
@@ -106,6 +135,9 @@ class ValidationCache {
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     vvl::unordered_set<uint32_t> good_shader_hashes_;
+    // Pipelines created by every run of an application specialize the same entry points with the same constant values.
+    // By ValidationCacheHash of the module, entry point and constant values.
+    vvl::unordered_map<uint64_t, Specialization> good_specializations_;
     mutable std::shared_mutex lock_;
 };
 
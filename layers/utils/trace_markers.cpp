@@ -0,0 +1,168 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/trace_markers.h"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace vvl {
+namespace trace {
+
+std::atomic_bool enabled{false};
+
+// Bounds the memory of a long capture, events past the limit are counted but dropped
+static constexpr size_t kMaxEventsPerThread = 1 << 20;
+
+struct Event {
+    const char *name;
+    int64_t start_ns;
+    int64_t duration_ns;
+};
+
+struct ThreadEvents {
+    uint64_t thread_id = 0;
+    size_t dropped = 0;
+    std::vector<Event> events;
+};
+
+struct Recorder {
+    std::mutex lock;
+    uint32_t users = 0;
+    // Bumped on every Begin so threads don't keep using the buffers of a previous capture
+    std::atomic<uint64_t> session{0};
+    std::string output_file;
+    std::vector<std::unique_ptr<ThreadEvents>> threads;
+};
+
+static Recorder &GetRecorder() {
+    static Recorder recorder;
+    return recorder;
+}
+
+static uint64_t ProcessId() {
+#if defined(_WIN32)
+    return GetCurrentProcessId();
+#else
+    return static_cast<uint64_t>(getpid());
+#endif
+}
+
+static uint64_t ThreadId() {
+#if defined(_WIN32)
+    return GetCurrentThreadId();
+#elif defined(__linux__) || defined(__ANDROID__)
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+    static std::atomic<uint64_t> next_thread_id{1};
+    thread_local uint64_t thread_id = next_thread_id.fetch_add(1);
+    return thread_id;
+#endif
+}
+
+static int64_t ToNanoseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+void Begin(const std::string &output_file) {
+    Recorder &recorder = GetRecorder();
+    std::lock_guard<std::mutex> guard(recorder.lock);
+    if (recorder.users++ == 0) {
+        // Buffers of the previous capture are only released here, a marker that was still open when it ended may have
+        // been appending to its buffer
+        recorder.threads.clear();
+        recorder.session.fetch_add(1, std::memory_order_release);
+        recorder.output_file = output_file;
+        enabled.store(true);
+    }
+}
+
+static void WriteTrace(const Recorder &recorder) {
+    std::ofstream out(recorder.output_file);
+    if (!out) {
+        printf("Validation Setting Warning - could not open %s to write the trace\n", recorder.output_file.c_str());
+        return;
+    }
+    const uint64_t pid = ProcessId();
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"args\":{\"name\":\"Vulkan Validation Layers\"}}";
+    char ts[64];
+    for (const auto &thread : recorder.threads) {
+        for (const Event &event : thread->events) {
+            // Microseconds with nanosecond precision
+            snprintf(ts, sizeof(ts), "\"ts\":%.3f,\"dur\":%.3f", event.start_ns / 1000.0, event.duration_ns / 1000.0);
+            out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"vvl\",\"ph\":\"X\",\"pid\":" << pid
+                << ",\"tid\":" << thread->thread_id << "," << ts << "}";
+        }
+        if (thread->dropped) {
+            printf("Validation Warning - %zu trace events of thread %llu were dropped\n", thread->dropped,
+                   static_cast<unsigned long long>(thread->thread_id));
+        }
+    }
+    out << "\n]}\n";
+}
+
+void End() {
+    Recorder &recorder = GetRecorder();
+    std::lock_guard<std::mutex> guard(recorder.lock);
+    if (recorder.users == 0 || --recorder.users != 0) return;
+    enabled.store(false);
+    WriteTrace(recorder);
+}
+
+void AddEvent(const char *name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    struct Cache {
+        uint64_t session = 0;
+        ThreadEvents *events = nullptr;
+    };
+    thread_local Cache cache;
+    if (!IsEnabled()) return;
+
+    // Only the first event of a thread in a capture takes the lock. The devices that enabled tracing are destroyed before
+    // the last End(), so no thread appends while the file is written.
+    Recorder &recorder = GetRecorder();
+    if (cache.session != recorder.session.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> guard(recorder.lock);
+        // Tracing may have been ended while this marker was open
+        if (!IsEnabled()) return;
+        recorder.threads.emplace_back(std::make_unique<ThreadEvents>());
+        recorder.threads.back()->thread_id = ThreadId();
+        cache.session = recorder.session.load(std::memory_order_relaxed);
+        cache.events = recorder.threads.back().get();
+    }
+    ThreadEvents &thread_events = *cache.events;
+    if (thread_events.events.size() >= kMaxEventsPerThread) {
+        thread_events.dropped++;
+        return;
+    }
+    thread_events.events.emplace_back(Event{name, ToNanoseconds(start.time_since_epoch()), ToNanoseconds(end - start)});
+}
+
+}  // namespace trace
+}  // namespace vvl
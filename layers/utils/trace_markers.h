@@ -0,0 +1,67 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Scoped trace markers for the hot paths of the layer, written as a Chrome trace (also loads in Perfetto).
+//
+// Timestamps are steady_clock microseconds, which is CLOCK_MONOTONIC on Linux and Android and QueryPerformanceCounter on
+// Windows, and events carry the OS process and thread ids, so the trace lines up with application traces using the same
+// clock. The recorder is process wide since markers live in code that has no link to a device (e.g. SPIR-V parsing).
+namespace vvl {
+namespace trace {
+
+extern std::atomic_bool enabled;
+inline bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+// Reference counted by the devices that enabled tracing, the last End() writes the file
+void Begin(const std::string &output_file);
+void End();
+
+// name must be a string literal (only the pointer is stored)
+void AddEvent(const char *name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+class ScopedMarker {
+  public:
+    explicit ScopedMarker(const char *name) : name_(IsEnabled() ? name : nullptr) {
+        if (name_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~ScopedMarker() {
+        if (name_) {
+            AddEvent(name_, start_, std::chrono::steady_clock::now());
+        }
+    }
+    ScopedMarker(const ScopedMarker &) = delete;
+    ScopedMarker &operator=(const ScopedMarker &) = delete;
+
+  private:
+    const char *name_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace trace
+}  // namespace vvl
+
+#define VVL_TRACE_CONCAT_INNER(a, b) a##b
+#define VVL_TRACE_CONCAT(a, b) VVL_TRACE_CONCAT_INNER(a, b)
+#define VVL_TRACE_SCOPE(name) vvl::trace::ScopedMarker VVL_TRACE_CONCAT(vvl_trace_marker_, __LINE__)(name)
@@ -86,8 +86,14 @@ void LayerDebugMessengerActions(DebugReport *debug_report, const char *layer_ide
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
-        dbg_create_info.pfnUserCallback = MessengerLogCallback;
-        dbg_create_info.pUserData = (void *)log_output;
+        if (log_output == stdout) {
+            dbg_create_info.pfnUserCallback = MessengerLogCallback;
+            dbg_create_info.pUserData = (void *)log_output;
+        } else {
+            // Log files are written on a separate thread, stdout stays synchronous to keep its order with the application output
+            dbg_create_info.pfnUserCallback = MessengerLogFileCallback;
+            dbg_create_info.pUserData = debug_report->CreateLogFileWriter(log_output);
+        }
         LayerCreateMessengerCallback(debug_report, default_layer_callback, &dbg_create_info, &messenger);
     }
 
@@ -25,8 +25,10 @@
 #include <functional>
 #include <string>
 #include <vector>
+#include <atomic>
 #include <bitset>
 #include <shared_mutex>
+#include <thread>
 
 #include <vulkan/utility/vk_format_utils.h>
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
@@ -55,6 +57,16 @@
 #endif
 #endif
 
+// For functions only called when validation fails (building the error message), keeps them out of line and away from the
+// instruction cache of the checks calling them
+#if defined(__GNUC__)
+#define VVL_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define VVL_COLD __declspec(noinline)
+#else
+#define VVL_COLD
+#endif
+
 // There are many times we want to assert, but also it is highly important to not crash for release builds.
 // This Macro also makes it more obvious if we are returning early because of a known situation or if we are just guarding against
 // something wrong actually happening.
@@ -462,6 +474,55 @@ std::string GetTempFilePath();
 typedef std::shared_lock<std::shared_mutex> ReadLockGuard;
 typedef std::unique_lock<std::shared_mutex> WriteLockGuard;
 
+namespace vvl {
+// Reader/writer lock in a single atomic word, for the state that is almost always locked by one thread at a time. A command
+// buffer is externally synchronized while recording, other threads only read it at submit time or in the GPU-AV post process.
+// Uncontended, locking is one compare-exchange and unlocking one atomic store. Contended waits yield, there is no fairness.
+class RecordingMutex {
+  public:
+    void lock() {
+        uint32_t expected = 0;
+        while (!state_.compare_exchange_weak(expected, kWriter, std::memory_order_acquire, std::memory_order_relaxed)) {
+            expected = 0;
+            std::this_thread::yield();
+        }
+    }
+    bool try_lock() {
+        uint32_t expected = 0;
+        return state_.compare_exchange_strong(expected, kWriter, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+    // Readers can't get in while the writer bit is set, so the writer is the only one left in the word
+    void unlock() { state_.store(0, std::memory_order_release); }
+
+    void lock_shared() {
+        uint32_t current = state_.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((current & kWriter) == 0) {
+                if (state_.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return;
+                }
+            } else {
+                std::this_thread::yield();
+                current = state_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    bool try_lock_shared() {
+        uint32_t current = state_.load(std::memory_order_relaxed);
+        return (current & kWriter) == 0 &&
+               state_.compare_exchange_strong(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+    void unlock_shared() { state_.fetch_sub(1, std::memory_order_release); }
+
+  private:
+    static constexpr uint32_t kWriter = 1u << 31;
+    std::atomic<uint32_t> state_{0};
+};
+}  // namespace vvl
+
+typedef std::shared_lock<vvl::RecordingMutex> RecordingReadLockGuard;
+typedef std::unique_lock<vvl::RecordingMutex> RecordingWriteLockGuard;
+
 // helper class for the very common case of getting and then locking a command buffer (or other state object)
 template <typename T, typename Guard>
 class LockedSharedPtr : public std::shared_ptr<T> {
@@ -83,3 +83,38 @@ bool ComparePipelineFragmentShadingRateStateCreateInfo(const VkPipelineFragmentS
     return (a.fragmentSize.width == b.fragmentSize.width) && (a.fragmentSize.height == b.fragmentSize.height) &&
            (a.combinerOps[0] == b.combinerOps[0]) && (a.combinerOps[1] == b.combinerOps[1]);
 }
+
+bool ComparePipelineColorBlendStateCreateInfo(const VkPipelineColorBlendStateCreateInfo &a,
+                                              const VkPipelineColorBlendStateCreateInfo &b) {
+    if ((a.flags != b.flags) || (a.logicOpEnable != b.logicOpEnable) || (a.logicOp != b.logicOp) ||
+        (a.attachmentCount != b.attachmentCount) || ((a.pAttachments == nullptr) != (b.pAttachments == nullptr))) {
+        return false;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+        if (a.blendConstants[i] != b.blendConstants[i]) {
+            return false;
+        }
+    }
+    if (a.pAttachments) {
+        for (uint32_t i = 0; i < a.attachmentCount; i++) {
+            if (!ComparePipelineColorBlendAttachmentState(a.pAttachments[i], b.pAttachments[i])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static inline bool CompareStencilOpState(const VkStencilOpState &a, const VkStencilOpState &b) {
+    return (a.failOp == b.failOp) && (a.passOp == b.passOp) && (a.depthFailOp == b.depthFailOp) && (a.compareOp == b.compareOp) &&
+           (a.compareMask == b.compareMask) && (a.writeMask == b.writeMask) && (a.reference == b.reference);
+}
+
+bool ComparePipelineDepthStencilStateCreateInfo(const VkPipelineDepthStencilStateCreateInfo &a,
+                                                const VkPipelineDepthStencilStateCreateInfo &b) {
+    return (a.flags == b.flags) && (a.depthTestEnable == b.depthTestEnable) && (a.depthWriteEnable == b.depthWriteEnable) &&
+           (a.depthCompareOp == b.depthCompareOp) && (a.depthBoundsTestEnable == b.depthBoundsTestEnable) &&
+           (a.stencilTestEnable == b.stencilTestEnable) && CompareStencilOpState(a.front, b.front) &&
+           CompareStencilOpState(a.back, b.back) && (a.minDepthBounds == b.minDepthBounds) &&
+           (a.maxDepthBounds == b.maxDepthBounds);
+}
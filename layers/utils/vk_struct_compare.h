@@ -35,3 +35,10 @@ bool ComparePipelineColorBlendAttachmentState(const VkPipelineColorBlendAttachme
 
 bool ComparePipelineFragmentShadingRateStateCreateInfo(const VkPipelineFragmentShadingRateStateCreateInfoKHR &a,
                                                        const VkPipelineFragmentShadingRateStateCreateInfoKHR &b);
+
+// The pNext chains are not compared, these are used to find identical pipeline states that don't have one
+bool ComparePipelineColorBlendStateCreateInfo(const VkPipelineColorBlendStateCreateInfo &a,
+                                              const VkPipelineColorBlendStateCreateInfo &b);
+
+bool ComparePipelineDepthStencilStateCreateInfo(const VkPipelineDepthStencilStateCreateInfo &a,
+                                                const VkPipelineDepthStencilStateCreateInfo &b);
@@ -0,0 +1,173 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/worker_pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace vvl {
+
+void TaskGroup::Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return pending_ == 0; });
+}
+
+WorkerPool::WorkerPool(uint32_t worker_count) : worker_count_(worker_count) {}
+
+std::shared_ptr<WorkerPool> WorkerPool::Shared(uint32_t worker_count) {
+    static std::mutex shared_lock;
+    static std::weak_ptr<WorkerPool> shared_pool;
+    std::lock_guard<std::mutex> guard(shared_lock);
+    std::shared_ptr<WorkerPool> pool = shared_pool.lock();
+    if (pool) {
+        pool->Reserve(worker_count);
+    } else {
+        pool = std::make_shared<WorkerPool>(worker_count);
+        shared_pool = pool;
+    }
+    return pool;
+}
+
+void WorkerPool::Reserve(uint32_t worker_count) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (worker_count <= worker_count_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    worker_count_.store(worker_count, std::memory_order_relaxed);
+    if (!workers_.empty()) {
+        // Already running, only the new workers are started
+        for (uint32_t i = static_cast<uint32_t>(workers_.size()); i < worker_count; ++i) {
+            workers_.emplace_back(&WorkerPool::WorkerMain, this);
+        }
+    }
+}
+
+void WorkerPool::StartWorkers() {
+    if (!workers_.empty()) {
+        return;
+    }
+    // The workers wait on mutex_ until the caller releases it
+    const uint32_t worker_count = worker_count_.load(std::memory_order_relaxed);
+    workers_.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&WorkerPool::WorkerMain, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+    }
+    job_available_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkerPool::RunJob(uint32_t count, TaskFunc func, void *context) {
+    if (count == 0) {
+        return;
+    }
+    func(context, 0);
+    if (count == 1) {
+        return;
+    }
+
+    Job job(func, context, count);
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        StartWorkers();
+        jobs_.push_back(&job);
+    }
+    job_available_.notify_all();
+
+    Drain(job);
+
+    // Every index is claimed at this point, wait for the workers still running one of them
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = std::find(jobs_.begin(), jobs_.end(), &job);
+    if (it != jobs_.end()) {
+        jobs_.erase(it);
+    }
+    job_done_.wait(lock, [&job] { return job.active_workers == 0; });
+}
+
+void WorkerPool::Post(std::function<void()> task) {
+    assert(WorkerCount() > 0);
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        StartWorkers();
+        posted_tasks_.emplace_back(std::move(task));
+    }
+    job_available_.notify_one();
+}
+
+void WorkerPool::Post(std::function<void()> task, TaskGroup &group) {
+    {
+        std::lock_guard<std::mutex> guard(group.mutex_);
+        group.pending_++;
+    }
+    Post([task = std::move(task), &group]() {
+        task();
+        std::lock_guard<std::mutex> guard(group.mutex_);
+        group.pending_--;
+        // Under the lock, the owner of the group can destroy it as soon as Wait() sees the count drop to 0
+        group.done_.notify_all();
+    });
+}
+
+void WorkerPool::Drain(Job &job) {
+    for (uint32_t index = job.next.fetch_add(1, std::memory_order_relaxed); index < job.count;
+         index = job.next.fetch_add(1, std::memory_order_relaxed)) {
+        job.func(job.context, index);
+    }
+}
+
+void WorkerPool::WorkerMain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        job_available_.wait(lock, [this] { return stop_ || !jobs_.empty() || !posted_tasks_.empty(); });
+        if (jobs_.empty()) {
+            if (posted_tasks_.empty()) {
+                // Stopping, with nothing left to run
+                return;
+            }
+            std::function<void()> task = std::move(posted_tasks_.front());
+            posted_tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+            continue;
+        }
+        Job *job = jobs_.front();
+        if (job->next.load(std::memory_order_relaxed) >= job->count) {
+            // Nothing left to claim, the submitting thread is finishing it
+            jobs_.pop_front();
+            continue;
+        }
+        job->active_workers++;
+        lock.unlock();
+        Drain(*job);
+        lock.lock();
+        job->active_workers--;
+        job_done_.notify_all();
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,125 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Counts the tasks one owner posted to a pool that others post to as well, so it can wait for its own tasks only
+class TaskGroup {
+  public:
+    // Blocks until every task posted with this group has run
+    void Wait();
+
+  private:
+    friend class WorkerPool;
+    std::mutex mutex_;
+    std::condition_variable done_;
+    uint32_t pending_ = 0;
+};
+
+// Small pool of threads owned by the layer, used to fan out independent pieces of work of a single API call.
+//
+// Run() blocks until every task is done and the calling thread works on the tasks too, so the workers only add
+// parallelism and never become a dependency of the application threads. Several application threads can call Run()
+// at the same time, the workers go through their jobs in submission order.
+//
+// The threads are only started by the first Run() or Post() that needs them, a pool created for a device that never
+// uses it costs nothing.
+class WorkerPool {
+  public:
+    explicit WorkerPool(uint32_t worker_count);
+    ~WorkerPool();
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // The pool of the process, shared by every device and subsystem so that a process with many devices doesn't end up
+    // with a set of layer threads for each. It has the largest worker count asked for so far and lives until its last
+    // user releases it.
+    static std::shared_ptr<WorkerPool> Shared(uint32_t worker_count);
+
+    uint32_t WorkerCount() const { return worker_count_.load(std::memory_order_relaxed); }
+
+    // Call task(i) for each i in [0, count). Index 0 is always run by the calling thread, which is useful for work that
+    // hands state to the caller through thread local storage.
+    template <typename Task>
+    void Run(uint32_t count, Task &task) {
+        RunJob(count, [](void *context, uint32_t index) { (*static_cast<Task *>(context))(index); }, &task);
+    }
+
+    // Queue a task nobody waits on, for work that can finish in the background (the caller synchronizes with it by its own
+    // means). Workers pick jobs from Run() first. Tasks still queued when the pool is destroyed are run before the workers exit.
+    // Requires at least one worker.
+    void Post(std::function<void()> task);
+    // Same, the task is counted in group until it has run
+    void Post(std::function<void()> task, TaskGroup &group);
+
+  private:
+    using TaskFunc = void (*)(void *context, uint32_t index);
+
+    struct Job {
+        TaskFunc func;
+        void *context;
+        uint32_t count;
+        std::atomic<uint32_t> next;
+        // Number of workers currently draining the job, guarded by mutex_
+        uint32_t active_workers = 0;
+
+        Job(TaskFunc func, void *context, uint32_t count) : func(func), context(context), count(count), next(1) {}
+    };
+
+    void RunJob(uint32_t count, TaskFunc func, void *context);
+    // Never removes workers, a pool that was asked for fewer keeps its count
+    void Reserve(uint32_t worker_count);
+    // Requires mutex_
+    void StartWorkers();
+    static void Drain(Job &job);
+    void WorkerMain();
+
+    // Only increased, under mutex_
+    std::atomic<uint32_t> worker_count_;
+    std::mutex mutex_;
+    std::condition_variable job_available_;
+    std::condition_variable job_done_;
+    std::deque<Job *> jobs_;
+    std::deque<std::function<void()>> posted_tasks_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+// Call task(i) for each i in [0, count), spread over the pool if there is one, otherwise in order on the calling thread
+template <typename Task>
+void ParallelFor(WorkerPool *pool, uint32_t count, Task &&task) {
+    if (pool && count > 1) {
+        pool->Run(count, task);
+    } else {
+        for (uint32_t i = 0; i < count; ++i) {
+            task(i);
+        }
+    }
+}
+
+}  // namespace vvl
@@ -25,10 +25,12 @@
 #include <sstream>
 #include <string>
 #include <charconv>
+#include <string_view>
 #include <sys/stat.h>
 
 #include <vulkan/vk_layer.h>
 #include "utils/vk_layer_utils.h"
+#include "utils/hash_util.h"
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -44,6 +46,12 @@
 #define GetCurrentDir getcwd
 #endif
 
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#elif !defined(_WIN32) && !defined(__ANDROID__)
+extern char **environ;
+#endif
+
 using std::string;
 
 class ConfigFile {
@@ -123,6 +131,41 @@ void SetEnvironment(const char *variable, const char *value) {
 #endif
 }
 
+bool HashEnvironment(size_t &hash) {
+#if defined(__ANDROID__)
+    (void)hash;
+    return false;
+#else
+    hash_util::HashCombiner hc;
+#if defined(_WIN32)
+    char *block = GetEnvironmentStringsA();
+    if (!block) {
+        return false;
+    }
+    // NUL separated strings, terminated by an empty one
+    for (const char *entry = block; *entry; entry += strlen(entry) + 1) {
+        hc << std::string_view(entry);
+    }
+    FreeEnvironmentStringsA(block);
+#else
+#if defined(__APPLE__)
+    char **env = *_NSGetEnviron();
+#else
+    char **env = environ;
+#endif
+    for (; env && *env; ++env) {
+        hc << std::string_view(*env);
+    }
+#endif
+    char cwd[512];
+    if (GetCurrentDir(cwd, sizeof(cwd))) {
+        hc << std::string_view(cwd);
+    }
+    hash = hc.Value();
+    return true;
+#endif
+}
+
 const char *getLayerOption(const char *option) { return layer_config.GetOption(option); }
 
 const SettingsFileInfo *GetLayerSettingsFileInfo() { return &layer_config.settings_info; }
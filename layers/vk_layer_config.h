@@ -35,6 +35,10 @@ std::string GetEnvironment(const char *variable);
 // Not supported on Android
 void SetEnvironment(const char *variable, const char *value);
 
+// Hash of every environment variable and of the current directory, where a local vk_layer_settings.txt is found.
+// Returns false on Android, whose system properties can't be enumerated.
+bool HashEnvironment(size_t &hash);
+
 enum SettingsFileSource {
     kVkConfig,
     kEnvVar,
@@ -318,6 +318,7 @@ void BestPractices::PostCallRecordAllocateMemory(VkDevice device, const VkMemory
                                                  const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
                                                  const RecordObject& record_obj) {
     ValidationStateTracker::PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, record_obj);
+    ManualPostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, record_obj);
 
     if (record_obj.result < VK_SUCCESS) {
         LogErrorCode(record_obj);
@@ -45,31 +45,22 @@
 #include "vk_layer_config.h"
 #include "layer_options.h"
 #include "containers/custom_containers.h"
+#include "containers/handle_table.h"
 #include "error_message/logging.h"
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
 #include "vk_object_types.h"
 #include "utils/vk_layer_extension_utils.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/worker_pool.h"
 #include "vk_dispatch_table_helper.h"
 #include "vk_extension_helper.h"
 #include "gpu/core/gpu_settings.h"
 #include "sync/sync_settings.h"
-
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
+#include "core_checks/cc_settings.h"
+#include "chassis/entry_point_timing.h"
+#include "chassis/memory_report.h"
+#include "chassis/check_telemetry.h"
 
 namespace chassis {
 struct CreateGraphicsPipelines;
@@ -91,7 +82,7 @@ class Pipeline;
 // Each chassis layer will need to track its own state
 using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vvl::HandleTable unique_id_mapping;
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);
 
@@ -2217,6 +2208,15 @@ class ValidationObject {
     }
 
     std::vector<std::vector<ValidationObject*>> intercept_vectors;
+    // Commands whose hooks are all overridden by the same validation object, or by none, indexed by the PreCallValidate
+    // InterceptId of the command. The vkCmd* entry points call that object directly instead of looping intercept_vectors.
+    struct SingleIntercept {
+        ValidationObject* object = nullptr;
+        bool pre_call_validate = false;
+        bool pre_call_record = false;
+        bool post_call_record = false;
+    };
+    std::vector<SingleIntercept> single_intercepts;
 
     VkLayerInstanceDispatchTable instance_dispatch_table;
     VkLayerDispatchTable device_dispatch_table;
@@ -2226,9 +2226,25 @@ class ValidationObject {
     CHECK_DISABLED disabled = {};
     CHECK_ENABLED enabled = {};
     bool fine_grained_locking{true};
+    // Zero means as many threads as the system has cores
+    uint32_t parallel_validation_thread_count = 0;
     GpuAVSettings gpuav_settings = {};
     DebugPrintfSettings printf_settings = {};
     SyncValSettings syncval_settings = {};
+    CoreChecksSettings core_settings = {};
+    EntryPointTimingSettings entry_point_timing_settings = {};
+    // Created with the device when parallel validation is enabled, shared by the device object and all its validation objects
+    std::shared_ptr<vvl::WorkerPool> validation_worker_pool;
+    // Only set on the device object, when entry point timing is enabled
+    std::unique_ptr<EntryPointTimings> entry_point_timings;
+    // Created with the device when the memory report is enabled, shared by the device object and all its validation objects
+    std::shared_ptr<vvl::MemoryReport> memory_report;
+    // Set on the instance object that installed the VkAllocationCallbacks of vkCreateInstance for the layer arenas
+    bool installed_allocation_callbacks = false;
+    // Created with the device when the frame budget is enabled, shared by the device object and all its validation objects
+    std::shared_ptr<vvl::FrameBudget> frame_budget;
+    // Created with the device when the check telemetry is enabled, shared by the device object and all its validation objects
+    std::shared_ptr<vvl::CheckTelemetry> check_telemetry;
 
     VkInstance instance = VK_NULL_HANDLE;
     VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -2253,11 +2269,28 @@ class ValidationObject {
     virtual ~ValidationObject(){};
 
     void InitObjectDispatchVectors();
+    // Built from intercept_vectors, once they are final and again when an object is released
+    void InitSingleIntercepts();
+    // Called by InitObjectDispatchVectors() for every hook the object overrides, with the hook name (PreCallValidateCmdDraw).
+    // Returning false leaves the object out of the intercept vector of the hook, for overrides with nothing to do under the
+    // runtime enables and disables of this device (e.g. the query checks when query validation is disabled).
+    virtual bool IsInterceptNeeded(std::string_view hook) const { return true; }
 
     mutable std::shared_mutex validation_object_mutex;
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+    // Estimated host memory of the state tracked by this object, see chassis/memory_report.h
+    virtual void AddMemoryUsage(vvl::MemoryUsage& usage) const {}
+    void SampleMemoryUsage() const {
+        vvl::MemoryUsage usage;
+        AddMemoryUsage(usage);
+        memory_report->Record(container_type, usage);
+    }
+
+    // False if a check that is sampled past the frame budget must be skipped, see chassis/frame_budget.h
+    bool SampleBudgetedCheck(uint64_t sample_key) const { return !frame_budget || frame_budget->ShouldValidate(sample_key); }
+
     // If the Record phase calls a function that blocks, we might need to release
     // the lock that protects Record itself in order to avoid mutual waiting.
     static thread_local WriteLockGuard* record_guard;
@@ -2311,10 +2344,16 @@ class ValidationObject {
     ValidationObjectType* GetValidationObject() const;
 
     // Debug Logging Helpers
+    // Lets validation skip an expensive check when the message it would log is muted anyway
+    bool IsMessageMuted(std::string_view vuid_text, VkFlags msg_flags = kErrorBit) const {
+        return debug_report->IsMessageMuted(msg_flags, vuid_text);
+    }
+
     bool DECORATE_PRINTF(5, 6)
         LogError(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
         va_list argptr;
         va_start(argptr, format);
+        if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
         const bool result = debug_report->LogMsg(kErrorBit, objlist, &loc, vuid_text, format, argptr);
         va_end(argptr);
         return result;
@@ -2325,6 +2364,7 @@ class ValidationObject {
                                                  const char* format, ...) const {
         va_list argptr;
         va_start(argptr, format);
+        if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
         const bool result = debug_report->LogMsg(kWarningBit, objlist, &loc, vuid_text, format, argptr);
         va_end(argptr);
         return result;
@@ -2334,6 +2374,7 @@ class ValidationObject {
         LogWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
         va_list argptr;
         va_start(argptr, format);
+        if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
         const bool result = debug_report->LogMsg(kWarningBit, objlist, &loc, vuid_text, format, argptr);
         va_end(argptr);
         return result;
@@ -2343,6 +2384,7 @@ class ValidationObject {
                                                      const char* format, ...) const {
         va_list argptr;
         va_start(argptr, format);
+        if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
         const bool result = debug_report->LogMsg(kPerformanceWarningBit, objlist, &loc, vuid_text, format, argptr);
         va_end(argptr);
         return result;
@@ -2352,6 +2394,7 @@ class ValidationObject {
         LogInfo(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
         va_list argptr;
         va_start(argptr, format);
+        if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
         const bool result = debug_report->LogMsg(kInformationBit, objlist, &loc, vuid_text, format, argptr);
         va_end(argptr);
         return result;
@@ -2361,6 +2404,7 @@ class ValidationObject {
         LogVerbose(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
         va_list argptr;
         va_start(argptr, format);
+        if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
         const bool result = debug_report->LogMsg(kVerboseBit, objlist, &loc, vuid_text, format, argptr);
         va_end(argptr);
         return result;
@@ -2392,7 +2436,9 @@ class ValidationObject {
     // Map of wrapped descriptor pools to set of wrapped descriptor sets allocated from each pool
     vvl::unordered_map<VkDescriptorPool, vvl::unordered_set<VkDescriptorSet>> pool_descriptor_sets_map;
 
-    // Unwrap a handle.
+    // Unwrap a handle. The unique ID is a slot index and generation of unique_id_mapping, so this is an indexed load even for
+    // the handle arrays of vkCmdBindDescriptorSets and friends, and a stale or invalid ID finds a mismatched generation
+    // instead of reading a freed record (which a pointer used as the unique ID would do).
     template <typename HandleType>
     HandleType Unwrap(HandleType wrapped_handle) {
         if (wrapped_handle == (HandleType)VK_NULL_HANDLE) return wrapped_handle;
@@ -2405,10 +2451,9 @@ class ValidationObject {
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-        auto unique_id = global_unique_id++;
-        unique_id = HashedUint64::hash(unique_id);
+        // The unique ID encodes the slot of the handle table, Unwrap() is a wait-free indexed load
+        const uint64_t unique_id = unique_id_mapping.Insert(CastToUint64(new_created_handle));
         assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-        unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
         return (HandleType)unique_id;
     }
 
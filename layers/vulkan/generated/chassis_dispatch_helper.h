@@ -1713,7 +1713,7 @@ typedef enum InterceptId {
 void ValidationObject::InitObjectDispatchVectors() {
 
 #define BUILD_DISPATCH_VECTOR(name) \
-    init_object_dispatch_vector(InterceptId ## name, \
+    init_object_dispatch_vector(InterceptId ## name, #name, \
                                 typeid(&ValidationObject::name), \
                                 typeid(&ThreadSafety::name), \
                                 typeid(&StatelessValidation::name), \
@@ -1725,6 +1725,7 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&SyncValidator::name));
 
     auto init_object_dispatch_vector = [this](InterceptId id,
+                                              const char* hook,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
                                               const std::type_info& tpv_typeid,
@@ -1736,30 +1737,33 @@ void ValidationObject::InitObjectDispatchVectors() {
                                               const std::type_info& tsv_typeid) {
         for (auto item : this->object_dispatch) {
             auto intercept_vector = &this->intercept_vectors[id];
+            const auto push_if_needed = [item, intercept_vector, hook]() {
+                if (item->IsInterceptNeeded(hook)) intercept_vector->push_back(item);
+            };
             switch (item->container_type) {
             case LayerObjectTypeThreading:
-                if (tt_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tt_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeParameterValidation:
-                if (tpv_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tpv_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeObjectTracker:
-                if (tot_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tot_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeCoreValidation:
-                if (tcv_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tcv_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeBestPractices:
-                if (tbp_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tbp_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeGpuAssisted:
-                if (tga_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tga_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeDebugPrintf:
-                if (tdp_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tdp_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeSyncValidation:
-                if (tsv_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tsv_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeInstance:
             case LayerObjectTypeDevice:
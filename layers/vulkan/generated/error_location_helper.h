@@ -4669,6 +4669,7 @@ enum class FlagBitmask {
     VkVideoEncodeUsageFlagBitsKHR,
     VkVideoSessionCreateFlagBitsKHR,
 };
+constexpr size_t kFlagBitmaskCount = static_cast<size_t>(FlagBitmask::VkVideoSessionCreateFlagBitsKHR) + 1;
 
 // Need underscore prefix to not conflict with namespace, but still easy to match generation
 enum class Extension {
@@ -24,9 +24,9 @@
 #include "instrumentation_buffer_device_address_comp.h"
 
 // To view SPIR-V, copy contents of array and paste in https://www.khronos.org/spir/visualizer/
-[[maybe_unused]] const uint32_t instrumentation_buffer_device_address_comp_size = 1236;
-[[maybe_unused]] const uint32_t instrumentation_buffer_device_address_comp[1236] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000000c7, 0x00000000, 0x00020011, 0x00000001, 0x00020011, 0x00000005, 0x00020011,
+[[maybe_unused]] const uint32_t instrumentation_buffer_device_address_comp_size = 1264;
+[[maybe_unused]] const uint32_t instrumentation_buffer_device_address_comp[1264] = {
+    0x07230203, 0x00010300, 0x0008000b, 0x000000f7, 0x00000000, 0x00020011, 0x00000001, 0x00020011, 0x00000005, 0x00020011,
     0x0000000b, 0x0006000b, 0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
     0x00030003, 0x00000002, 0x000001c2, 0x00070004, 0x415f4c47, 0x675f4252, 0x735f7570, 0x65646168, 0x6e695f72, 0x00343674,
     0x00070004, 0x455f4c47, 0x625f5458, 0x65666675, 0x65725f72, 0x65726566, 0x0065636e, 0x00090004, 0x455f4c47, 0x625f5458,
@@ -36,118 +36,121 @@
     0x615f6563, 0x65726464, 0x75287373, 0x75763b31, 0x36753b34, 0x753b3134, 0x31753b31, 0x0000003b, 0x00050005, 0x00000007,
     0x74736e69, 0x6d756e5f, 0x00000000, 0x00050005, 0x00000008, 0x67617473, 0x6e695f65, 0x00006f66, 0x00040005, 0x00000009,
     0x72646461, 0x00000000, 0x00070005, 0x0000000a, 0x65636361, 0x625f7373, 0x5f657479, 0x657a6973, 0x00000000, 0x00070005,
-    0x0000000b, 0x65636361, 0x695f7373, 0x7274736e, 0x69746375, 0x00006e6f, 0x00040005, 0x0000000f, 0x676e6172, 0x00695f65,
-    0x00040005, 0x00000017, 0x676e6152, 0x00000065, 0x00050006, 0x00000017, 0x00000000, 0x69676562, 0x0000006e, 0x00040006,
-    0x00000017, 0x00000001, 0x00646e65, 0x00070005, 0x00000019, 0x66667542, 0x72646441, 0x75706e49, 0x66754274, 0x00726566,
-    0x00080006, 0x00000019, 0x00000000, 0x5f616462, 0x676e6172, 0x635f7365, 0x746e756f, 0x00000000, 0x00060006, 0x00000019,
-    0x00000001, 0x5f616462, 0x676e6172, 0x00007365, 0x00030005, 0x0000001b, 0x00000000, 0x00040005, 0x00000023, 0x676e6152,
-    0x00000065, 0x00050006, 0x00000023, 0x00000000, 0x69676562, 0x0000006e, 0x00040006, 0x00000023, 0x00000001, 0x00646e65,
-    0x00040005, 0x00000025, 0x676e6172, 0x00000065, 0x00080005, 0x00000051, 0x52646d43, 0x756f7365, 0x49656372, 0x7865646e,
-    0x66667542, 0x00007265, 0x00050006, 0x00000051, 0x00000000, 0x65646e69, 0x00000078, 0x000a0005, 0x00000053, 0x74736e69,
-    0x646d635f, 0x7365725f, 0x6372756f, 0x6e695f65, 0x5f786564, 0x66667562, 0x00007265, 0x00080005, 0x00000059, 0x45646d43,
-    0x726f7272, 0x756f4373, 0x7542746e, 0x72656666, 0x00000000, 0x00070006, 0x00000059, 0x00000000, 0x6f727265, 0x635f7372,
-    0x746e756f, 0x00000000, 0x000a0005, 0x0000005b, 0x74736e69, 0x646d635f, 0x7272655f, 0x5f73726f, 0x6e756f63, 0x75625f74,
-    0x72656666, 0x00000000, 0x00060005, 0x0000006c, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00050006, 0x0000006c,
-    0x00000000, 0x67616c66, 0x00000073, 0x00070006, 0x0000006c, 0x00000001, 0x74697277, 0x5f6e6574, 0x6e756f63, 0x00000074,
-    0x00050006, 0x0000006c, 0x00000002, 0x61746164, 0x00000000, 0x00070005, 0x0000006e, 0x74736e69, 0x7272655f, 0x5f73726f,
-    0x66667562, 0x00007265, 0x00070005, 0x000000a7, 0x69746341, 0x6e496e6f, 0x42786564, 0x65666675, 0x00000072, 0x00050006,
-    0x000000a7, 0x00000000, 0x65646e69, 0x00000078, 0x00090005, 0x000000a9, 0x74736e69, 0x7463615f, 0x5f6e6f69, 0x65646e69,
-    0x75625f78, 0x72656666, 0x00000000, 0x000b0047, 0x0000000c, 0x00000029, 0x74736e69, 0x6675625f, 0x5f726566, 0x69766564,
-    0x615f6563, 0x65726464, 0x00007373, 0x00000000, 0x00050048, 0x00000017, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000017, 0x00000001, 0x00000023, 0x00000008, 0x00040047, 0x00000018, 0x00000006, 0x00000010, 0x00050048, 0x00000019,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000019, 0x00000001, 0x00000023, 0x00000008, 0x00030047, 0x00000019,
-    0x00000002, 0x00040047, 0x0000001b, 0x00000022, 0x00000007, 0x00040047, 0x0000001b, 0x00000021, 0x00000002, 0x00040047,
-    0x00000050, 0x00000006, 0x00000004, 0x00050048, 0x00000051, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000051,
-    0x00000002, 0x00040047, 0x00000053, 0x00000022, 0x00000007, 0x00040047, 0x00000053, 0x00000021, 0x00000004, 0x00040047,
-    0x00000058, 0x00000006, 0x00000004, 0x00050048, 0x00000059, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000059,
-    0x00000002, 0x00040047, 0x0000005b, 0x00000022, 0x00000007, 0x00040047, 0x0000005b, 0x00000021, 0x00000005, 0x00040047,
-    0x0000006b, 0x00000006, 0x00000004, 0x00050048, 0x0000006c, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000006c,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000006c, 0x00000002, 0x00000023, 0x00000008, 0x00030047, 0x0000006c,
-    0x00000002, 0x00040047, 0x0000006e, 0x00000022, 0x00000007, 0x00040047, 0x0000006e, 0x00000021, 0x00000000, 0x00040047,
-    0x000000a6, 0x00000006, 0x00000004, 0x00050048, 0x000000a7, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a7,
-    0x00000002, 0x00040047, 0x000000a9, 0x00000022, 0x00000007, 0x00040047, 0x000000a9, 0x00000021, 0x00000003, 0x00040015,
-    0x00000002, 0x00000020, 0x00000000, 0x00040017, 0x00000003, 0x00000002, 0x00000004, 0x00040015, 0x00000004, 0x00000040,
-    0x00000000, 0x00020014, 0x00000005, 0x00080021, 0x00000006, 0x00000005, 0x00000002, 0x00000003, 0x00000004, 0x00000002,
-    0x00000002, 0x00040020, 0x0000000e, 0x00000007, 0x00000002, 0x0004002b, 0x00000002, 0x00000010, 0x00000000, 0x0004001e,
-    0x00000017, 0x00000004, 0x00000004, 0x0003001d, 0x00000018, 0x00000017, 0x0004001e, 0x00000019, 0x00000004, 0x00000018,
-    0x00040020, 0x0000001a, 0x0000000c, 0x00000019, 0x0004003b, 0x0000001a, 0x0000001b, 0x0000000c, 0x00040015, 0x0000001c,
-    0x00000020, 0x00000001, 0x0004002b, 0x0000001c, 0x0000001d, 0x00000000, 0x00040020, 0x0000001e, 0x0000000c, 0x00000004,
-    0x0004001e, 0x00000023, 0x00000004, 0x00000004, 0x00040020, 0x00000024, 0x00000007, 0x00000023, 0x0004002b, 0x0000001c,
-    0x00000026, 0x00000001, 0x00040020, 0x00000028, 0x0000000c, 0x00000017, 0x00040020, 0x0000002c, 0x00000007, 0x00000004,
-    0x00030029, 0x00000005, 0x0000004b, 0x0003001d, 0x00000050, 0x00000002, 0x0003001e, 0x00000051, 0x00000050, 0x00040020,
-    0x00000052, 0x0000000c, 0x00000051, 0x0004003b, 0x00000052, 0x00000053, 0x0000000c, 0x00040020, 0x00000054, 0x0000000c,
-    0x00000002, 0x0003001d, 0x00000058, 0x00000002, 0x0003001e, 0x00000059, 0x00000058, 0x00040020, 0x0000005a, 0x0000000c,
-    0x00000059, 0x0004003b, 0x0000005a, 0x0000005b, 0x0000000c, 0x0004002b, 0x00000002, 0x0000005e, 0x00000001, 0x0004002b,
-    0x00000002, 0x00000063, 0x00000006, 0x0003002a, 0x00000005, 0x00000068, 0x0003001d, 0x0000006b, 0x00000002, 0x0005001e,
-    0x0000006c, 0x00000002, 0x00000002, 0x0000006b, 0x00040020, 0x0000006d, 0x0000000c, 0x0000006c, 0x0004003b, 0x0000006d,
-    0x0000006e, 0x0000000c, 0x0004002b, 0x00000002, 0x00000070, 0x00000010, 0x0004002b, 0x0000001c, 0x0000007c, 0x00000002,
-    0x0004002b, 0x00000002, 0x00000082, 0x0dead001, 0x0004002b, 0x00000002, 0x00000085, 0x00000002, 0x0004002b, 0x00000002,
-    0x00000089, 0x00000003, 0x0004002b, 0x00000002, 0x0000008e, 0x00000004, 0x0004002b, 0x00000002, 0x00000093, 0x00000005,
-    0x0004002b, 0x00000002, 0x0000009c, 0x00000009, 0x0004002b, 0x00000002, 0x000000a0, 0x0000000a, 0x0004002b, 0x00000002,
-    0x000000a4, 0x00000007, 0x0003001d, 0x000000a6, 0x00000002, 0x0003001e, 0x000000a7, 0x000000a6, 0x00040020, 0x000000a8,
-    0x0000000c, 0x000000a7, 0x0004003b, 0x000000a8, 0x000000a9, 0x0000000c, 0x0004002b, 0x00000002, 0x000000ae, 0x00000008,
-    0x0004002b, 0x00000002, 0x000000b4, 0x0000000b, 0x0004002b, 0x00000002, 0x000000b9, 0x0000000c, 0x0004002b, 0x00000002,
-    0x000000bb, 0x00000020, 0x0004002b, 0x00000002, 0x000000c0, 0x0000000d, 0x0004002b, 0x00000002, 0x000000c4, 0x0000000e,
-    0x00050036, 0x00000005, 0x0000000c, 0x00000000, 0x00000006, 0x00030037, 0x00000002, 0x00000007, 0x00030037, 0x00000003,
-    0x00000008, 0x00030037, 0x00000004, 0x00000009, 0x00030037, 0x00000002, 0x0000000a, 0x00030037, 0x00000002, 0x0000000b,
-    0x000200f8, 0x0000000d, 0x0004003b, 0x0000000e, 0x0000000f, 0x00000007, 0x0004003b, 0x00000024, 0x00000025, 0x00000007,
-    0x0003003e, 0x0000000f, 0x00000010, 0x000200f9, 0x00000011, 0x000200f8, 0x00000011, 0x000400f6, 0x00000013, 0x00000014,
-    0x00000000, 0x000200f9, 0x00000015, 0x000200f8, 0x00000015, 0x0004003d, 0x00000002, 0x00000016, 0x0000000f, 0x00050041,
-    0x0000001e, 0x0000001f, 0x0000001b, 0x0000001d, 0x0004003d, 0x00000004, 0x00000020, 0x0000001f, 0x00040071, 0x00000002,
-    0x00000021, 0x00000020, 0x000500b0, 0x00000005, 0x00000022, 0x00000016, 0x00000021, 0x000400fa, 0x00000022, 0x00000012,
-    0x00000013, 0x000200f8, 0x00000012, 0x0004003d, 0x00000002, 0x00000027, 0x0000000f, 0x00060041, 0x00000028, 0x00000029,
-    0x0000001b, 0x00000026, 0x00000027, 0x0004003d, 0x00000017, 0x0000002a, 0x00000029, 0x00050051, 0x00000004, 0x0000002b,
-    0x0000002a, 0x00000000, 0x00050041, 0x0000002c, 0x0000002d, 0x00000025, 0x0000001d, 0x0003003e, 0x0000002d, 0x0000002b,
-    0x00050051, 0x00000004, 0x0000002e, 0x0000002a, 0x00000001, 0x00050041, 0x0000002c, 0x0000002f, 0x00000025, 0x00000026,
-    0x0003003e, 0x0000002f, 0x0000002e, 0x00050041, 0x0000002c, 0x00000030, 0x00000025, 0x0000001d, 0x0004003d, 0x00000004,
-    0x00000031, 0x00000030, 0x000500b0, 0x00000005, 0x00000032, 0x00000009, 0x00000031, 0x000300f7, 0x00000034, 0x00000000,
-    0x000400fa, 0x00000032, 0x00000033, 0x00000034, 0x000200f8, 0x00000033, 0x000200f9, 0x00000013, 0x000200f8, 0x00000034,
-    0x00050041, 0x0000002c, 0x00000036, 0x00000025, 0x00000026, 0x0004003d, 0x00000004, 0x00000037, 0x00000036, 0x000500b0,
-    0x00000005, 0x00000038, 0x00000009, 0x00000037, 0x000300f7, 0x0000003a, 0x00000000, 0x000400fa, 0x00000038, 0x00000039,
-    0x0000003a, 0x000200f8, 0x00000039, 0x00040071, 0x00000004, 0x0000003b, 0x0000000a, 0x00050080, 0x00000004, 0x0000003c,
-    0x00000009, 0x0000003b, 0x00050041, 0x0000002c, 0x0000003d, 0x00000025, 0x00000026, 0x0004003d, 0x00000004, 0x0000003e,
-    0x0000003d, 0x000500ac, 0x00000005, 0x0000003f, 0x0000003c, 0x0000003e, 0x000200f9, 0x0000003a, 0x000200f8, 0x0000003a,
-    0x000700f5, 0x00000005, 0x00000040, 0x00000038, 0x00000034, 0x0000003f, 0x00000039, 0x000300f7, 0x00000042, 0x00000000,
-    0x000400fa, 0x00000040, 0x00000041, 0x00000042, 0x000200f8, 0x00000041, 0x000200f9, 0x00000013, 0x000200f8, 0x00000042,
-    0x00040071, 0x00000004, 0x00000044, 0x0000000a, 0x00050080, 0x00000004, 0x00000045, 0x00000009, 0x00000044, 0x00050041,
-    0x0000002c, 0x00000046, 0x00000025, 0x00000026, 0x0004003d, 0x00000004, 0x00000047, 0x00000046, 0x000500b2, 0x00000005,
-    0x00000048, 0x00000045, 0x00000047, 0x000300f7, 0x0000004a, 0x00000000, 0x000400fa, 0x00000048, 0x00000049, 0x0000004a,
-    0x000200f8, 0x00000049, 0x000200fe, 0x0000004b, 0x000200f8, 0x0000004a, 0x000200f9, 0x00000014, 0x000200f8, 0x00000014,
-    0x0004003d, 0x00000002, 0x0000004d, 0x0000000f, 0x00050080, 0x00000002, 0x0000004e, 0x0000004d, 0x00000026, 0x0003003e,
-    0x0000000f, 0x0000004e, 0x000200f9, 0x00000011, 0x000200f8, 0x00000013, 0x00060041, 0x00000054, 0x00000055, 0x00000053,
-    0x0000001d, 0x0000001d, 0x0004003d, 0x00000002, 0x00000056, 0x00000055, 0x00060041, 0x00000054, 0x0000005d, 0x0000005b,
-    0x0000001d, 0x00000056, 0x000700ea, 0x00000002, 0x0000005f, 0x0000005d, 0x0000005e, 0x00000010, 0x0000005e, 0x000500ae,
-    0x00000005, 0x00000064, 0x0000005f, 0x00000063, 0x000300f7, 0x00000067, 0x00000000, 0x000400fa, 0x00000064, 0x00000066,
-    0x00000067, 0x000200f8, 0x00000066, 0x000200fe, 0x00000068, 0x000200f8, 0x00000067, 0x00050041, 0x00000054, 0x0000006f,
-    0x0000006e, 0x00000026, 0x000700ea, 0x00000002, 0x00000071, 0x0000006f, 0x0000005e, 0x00000010, 0x00000070, 0x00050080,
-    0x00000002, 0x00000074, 0x00000071, 0x00000070, 0x00050044, 0x00000002, 0x00000075, 0x0000006e, 0x00000002, 0x0004007c,
-    0x0000001c, 0x00000076, 0x00000075, 0x0004007c, 0x00000002, 0x00000077, 0x00000076, 0x000500b2, 0x00000005, 0x00000078,
-    0x00000074, 0x00000077, 0x000300f7, 0x0000007b, 0x00000000, 0x000400fa, 0x00000078, 0x0000007a, 0x0000007b, 0x000200f8,
-    0x0000007a, 0x00060041, 0x00000054, 0x0000007f, 0x0000006e, 0x0000007c, 0x00000071, 0x0003003e, 0x0000007f, 0x00000070,
-    0x00050080, 0x00000002, 0x00000081, 0x00000071, 0x0000005e, 0x00060041, 0x00000054, 0x00000083, 0x0000006e, 0x0000007c,
-    0x00000081, 0x0003003e, 0x00000083, 0x00000082, 0x00050080, 0x00000002, 0x00000086, 0x00000071, 0x00000085, 0x00060041,
-    0x00000054, 0x00000087, 0x0000006e, 0x0000007c, 0x00000086, 0x0003003e, 0x00000087, 0x00000007, 0x00050080, 0x00000002,
-    0x0000008a, 0x00000071, 0x00000089, 0x00050051, 0x00000002, 0x0000008b, 0x00000008, 0x00000000, 0x00060041, 0x00000054,
-    0x0000008c, 0x0000006e, 0x0000007c, 0x0000008a, 0x0003003e, 0x0000008c, 0x0000008b, 0x00050080, 0x00000002, 0x0000008f,
-    0x00000071, 0x0000008e, 0x00050051, 0x00000002, 0x00000090, 0x00000008, 0x00000001, 0x00060041, 0x00000054, 0x00000091,
-    0x0000006e, 0x0000007c, 0x0000008f, 0x0003003e, 0x00000091, 0x00000090, 0x00050080, 0x00000002, 0x00000094, 0x00000071,
-    0x00000093, 0x00050051, 0x00000002, 0x00000095, 0x00000008, 0x00000002, 0x00060041, 0x00000054, 0x00000096, 0x0000006e,
-    0x0000007c, 0x00000094, 0x0003003e, 0x00000096, 0x00000095, 0x00050080, 0x00000002, 0x00000098, 0x00000071, 0x00000063,
-    0x00050051, 0x00000002, 0x00000099, 0x00000008, 0x00000003, 0x00060041, 0x00000054, 0x0000009a, 0x0000006e, 0x0000007c,
-    0x00000098, 0x0003003e, 0x0000009a, 0x00000099, 0x00050080, 0x00000002, 0x0000009d, 0x00000071, 0x0000009c, 0x00060041,
-    0x00000054, 0x0000009e, 0x0000006e, 0x0000007c, 0x0000009d, 0x0003003e, 0x0000009e, 0x00000085, 0x00050080, 0x00000002,
-    0x000000a1, 0x00000071, 0x000000a0, 0x00060041, 0x00000054, 0x000000a2, 0x0000006e, 0x0000007c, 0x000000a1, 0x0003003e,
-    0x000000a2, 0x0000005e, 0x00050080, 0x00000002, 0x000000a5, 0x00000071, 0x000000a4, 0x00060041, 0x00000054, 0x000000aa,
-    0x000000a9, 0x0000001d, 0x0000001d, 0x0004003d, 0x00000002, 0x000000ab, 0x000000aa, 0x00060041, 0x00000054, 0x000000ac,
-    0x0000006e, 0x0000007c, 0x000000a5, 0x0003003e, 0x000000ac, 0x000000ab, 0x00050080, 0x00000002, 0x000000af, 0x00000071,
-    0x000000ae, 0x00060041, 0x00000054, 0x000000b0, 0x00000053, 0x0000001d, 0x0000001d, 0x0004003d, 0x00000002, 0x000000b1,
-    0x000000b0, 0x00060041, 0x00000054, 0x000000b2, 0x0000006e, 0x0000007c, 0x000000af, 0x0003003e, 0x000000b2, 0x000000b1,
-    0x00050080, 0x00000002, 0x000000b5, 0x00000071, 0x000000b4, 0x00040071, 0x00000002, 0x000000b6, 0x00000009, 0x00060041,
-    0x00000054, 0x000000b7, 0x0000006e, 0x0000007c, 0x000000b5, 0x0003003e, 0x000000b7, 0x000000b6, 0x00050080, 0x00000002,
-    0x000000ba, 0x00000071, 0x000000b9, 0x000500c2, 0x00000004, 0x000000bc, 0x00000009, 0x000000bb, 0x00040071, 0x00000002,
-    0x000000bd, 0x000000bc, 0x00060041, 0x00000054, 0x000000be, 0x0000006e, 0x0000007c, 0x000000ba, 0x0003003e, 0x000000be,
-    0x000000bd, 0x00050080, 0x00000002, 0x000000c1, 0x00000071, 0x000000c0, 0x00060041, 0x00000054, 0x000000c2, 0x0000006e,
-    0x0000007c, 0x000000c1, 0x0003003e, 0x000000c2, 0x0000000a, 0x00050080, 0x00000002, 0x000000c5, 0x00000071, 0x000000c4,
-    0x00060041, 0x00000054, 0x000000c6, 0x0000006e, 0x0000007c, 0x000000c5, 0x0003003e, 0x000000c6, 0x0000000b, 0x000200f9,
-    0x0000007b, 0x000200f8, 0x0000007b, 0x000200fe, 0x00000068, 0x00010038,
+    0x0000000b, 0x65636361, 0x695f7373, 0x7274736e, 0x69746375, 0x00006e6f, 0x00030005, 0x0000000f, 0x00006f6c, 0x00030005,
+    0x000000c7, 0x00006968, 0x00030005, 0x000000c8, 0x0064696d, 0x00040005, 0x00000017, 0x676e6152, 0x00000065, 0x00050006,
+    0x00000017, 0x00000000, 0x69676562, 0x0000006e, 0x00040006, 0x00000017, 0x00000001, 0x00646e65, 0x00070005, 0x00000019,
+    0x66667542, 0x72646441, 0x75706e49, 0x66754274, 0x00726566, 0x00080006, 0x00000019, 0x00000000, 0x5f616462, 0x676e6172,
+    0x635f7365, 0x746e756f, 0x00000000, 0x00060006, 0x00000019, 0x00000001, 0x5f616462, 0x676e6172, 0x00007365, 0x00030005,
+    0x0000001b, 0x00000000, 0x00040005, 0x00000023, 0x676e6152, 0x00000065, 0x00050006, 0x00000023, 0x00000000, 0x69676562,
+    0x0000006e, 0x00040006, 0x00000023, 0x00000001, 0x00646e65, 0x00040005, 0x00000025, 0x676e6172, 0x00000065, 0x00080005,
+    0x00000051, 0x52646d43, 0x756f7365, 0x49656372, 0x7865646e, 0x66667542, 0x00007265, 0x00050006, 0x00000051, 0x00000000,
+    0x65646e69, 0x00000078, 0x000a0005, 0x00000053, 0x74736e69, 0x646d635f, 0x7365725f, 0x6372756f, 0x6e695f65, 0x5f786564,
+    0x66667562, 0x00007265, 0x00080005, 0x00000059, 0x45646d43, 0x726f7272, 0x756f4373, 0x7542746e, 0x72656666, 0x00000000,
+    0x00070006, 0x00000059, 0x00000000, 0x6f727265, 0x635f7372, 0x746e756f, 0x00000000, 0x000a0005, 0x0000005b, 0x74736e69,
+    0x646d635f, 0x7272655f, 0x5f73726f, 0x6e756f63, 0x75625f74, 0x72656666, 0x00000000, 0x00060005, 0x0000006c, 0x7074754f,
+    0x75427475, 0x72656666, 0x00000000, 0x00050006, 0x0000006c, 0x00000000, 0x67616c66, 0x00000073, 0x00070006, 0x0000006c,
+    0x00000001, 0x74697277, 0x5f6e6574, 0x6e756f63, 0x00000074, 0x00050006, 0x0000006c, 0x00000002, 0x61746164, 0x00000000,
+    0x00070005, 0x0000006e, 0x74736e69, 0x7272655f, 0x5f73726f, 0x66667562, 0x00007265, 0x00070005, 0x000000a7, 0x69746341,
+    0x6e496e6f, 0x42786564, 0x65666675, 0x00000072, 0x00050006, 0x000000a7, 0x00000000, 0x65646e69, 0x00000078, 0x00090005,
+    0x000000a9, 0x74736e69, 0x7463615f, 0x5f6e6f69, 0x65646e69, 0x75625f78, 0x72656666, 0x00000000, 0x000b0047, 0x0000000c,
+    0x00000029, 0x74736e69, 0x6675625f, 0x5f726566, 0x69766564, 0x615f6563, 0x65726464, 0x00007373, 0x00000000, 0x00050048,
+    0x00000017, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000017, 0x00000001, 0x00000023, 0x00000008, 0x00040047,
+    0x00000018, 0x00000006, 0x00000010, 0x00050048, 0x00000019, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000019,
+    0x00000001, 0x00000023, 0x00000008, 0x00030047, 0x00000019, 0x00000002, 0x00040047, 0x0000001b, 0x00000022, 0x00000007,
+    0x00040047, 0x0000001b, 0x00000021, 0x00000002, 0x00040047, 0x00000050, 0x00000006, 0x00000004, 0x00050048, 0x00000051,
+    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000051, 0x00000002, 0x00040047, 0x00000053, 0x00000022, 0x00000007,
+    0x00040047, 0x00000053, 0x00000021, 0x00000004, 0x00040047, 0x00000058, 0x00000006, 0x00000004, 0x00050048, 0x00000059,
+    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000059, 0x00000002, 0x00040047, 0x0000005b, 0x00000022, 0x00000007,
+    0x00040047, 0x0000005b, 0x00000021, 0x00000005, 0x00040047, 0x0000006b, 0x00000006, 0x00000004, 0x00050048, 0x0000006c,
+    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000006c, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000006c,
+    0x00000002, 0x00000023, 0x00000008, 0x00030047, 0x0000006c, 0x00000002, 0x00040047, 0x0000006e, 0x00000022, 0x00000007,
+    0x00040047, 0x0000006e, 0x00000021, 0x00000000, 0x00040047, 0x000000a6, 0x00000006, 0x00000004, 0x00050048, 0x000000a7,
+    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a7, 0x00000002, 0x00040047, 0x000000a9, 0x00000022, 0x00000007,
+    0x00040047, 0x000000a9, 0x00000021, 0x00000003, 0x00040015, 0x00000002, 0x00000020, 0x00000000, 0x00040017, 0x00000003,
+    0x00000002, 0x00000004, 0x00040015, 0x00000004, 0x00000040, 0x00000000, 0x00020014, 0x00000005, 0x00080021, 0x00000006,
+    0x00000005, 0x00000002, 0x00000003, 0x00000004, 0x00000002, 0x00000002, 0x00040020, 0x0000000e, 0x00000007, 0x00000002,
+    0x0004002b, 0x00000002, 0x00000010, 0x00000000, 0x0004001e, 0x00000017, 0x00000004, 0x00000004, 0x0003001d, 0x00000018,
+    0x00000017, 0x0004001e, 0x00000019, 0x00000004, 0x00000018, 0x00040020, 0x0000001a, 0x0000000c, 0x00000019, 0x0004003b,
+    0x0000001a, 0x0000001b, 0x0000000c, 0x00040015, 0x0000001c, 0x00000020, 0x00000001, 0x0004002b, 0x0000001c, 0x0000001d,
+    0x00000000, 0x00040020, 0x0000001e, 0x0000000c, 0x00000004, 0x0004001e, 0x00000023, 0x00000004, 0x00000004, 0x00040020,
+    0x00000024, 0x00000007, 0x00000023, 0x0004002b, 0x0000001c, 0x00000026, 0x00000001, 0x00040020, 0x00000028, 0x0000000c,
+    0x00000017, 0x00040020, 0x0000002c, 0x00000007, 0x00000004, 0x00030029, 0x00000005, 0x0000004b, 0x0003001d, 0x00000050,
+    0x00000002, 0x0003001e, 0x00000051, 0x00000050, 0x00040020, 0x00000052, 0x0000000c, 0x00000051, 0x0004003b, 0x00000052,
+    0x00000053, 0x0000000c, 0x00040020, 0x00000054, 0x0000000c, 0x00000002, 0x0003001d, 0x00000058, 0x00000002, 0x0003001e,
+    0x00000059, 0x00000058, 0x00040020, 0x0000005a, 0x0000000c, 0x00000059, 0x0004003b, 0x0000005a, 0x0000005b, 0x0000000c,
+    0x0004002b, 0x00000002, 0x0000005e, 0x00000001, 0x0004002b, 0x00000002, 0x00000063, 0x00000006, 0x0003002a, 0x00000005,
+    0x00000068, 0x0003001d, 0x0000006b, 0x00000002, 0x0005001e, 0x0000006c, 0x00000002, 0x00000002, 0x0000006b, 0x00040020,
+    0x0000006d, 0x0000000c, 0x0000006c, 0x0004003b, 0x0000006d, 0x0000006e, 0x0000000c, 0x0004002b, 0x00000002, 0x00000070,
+    0x00000010, 0x0004002b, 0x0000001c, 0x0000007c, 0x00000002, 0x0004002b, 0x00000002, 0x00000082, 0x0dead001, 0x0004002b,
+    0x00000002, 0x00000085, 0x00000002, 0x0004002b, 0x00000002, 0x00000089, 0x00000003, 0x0004002b, 0x00000002, 0x0000008e,
+    0x00000004, 0x0004002b, 0x00000002, 0x00000093, 0x00000005, 0x0004002b, 0x00000002, 0x0000009c, 0x00000009, 0x0004002b,
+    0x00000002, 0x000000a0, 0x0000000a, 0x0004002b, 0x00000002, 0x000000a4, 0x00000007, 0x0003001d, 0x000000a6, 0x00000002,
+    0x0003001e, 0x000000a7, 0x000000a6, 0x00040020, 0x000000a8, 0x0000000c, 0x000000a7, 0x0004003b, 0x000000a8, 0x000000a9,
+    0x0000000c, 0x0004002b, 0x00000002, 0x000000ae, 0x00000008, 0x0004002b, 0x00000002, 0x000000b4, 0x0000000b, 0x0004002b,
+    0x00000002, 0x000000b9, 0x0000000c, 0x0004002b, 0x00000002, 0x000000bb, 0x00000020, 0x0004002b, 0x00000002, 0x000000c0,
+    0x0000000d, 0x0004002b, 0x00000002, 0x000000c4, 0x0000000e, 0x00050036, 0x00000005, 0x0000000c, 0x00000000, 0x00000006,
+    0x00030037, 0x00000002, 0x00000007, 0x00030037, 0x00000003, 0x00000008, 0x00030037, 0x00000004, 0x00000009, 0x00030037,
+    0x00000002, 0x0000000a, 0x00030037, 0x00000002, 0x0000000b, 0x000200f8, 0x0000000d, 0x0004003b, 0x0000000e, 0x0000000f,
+    0x00000007, 0x0004003b, 0x0000000e, 0x000000c7, 0x00000007, 0x0004003b, 0x0000000e, 0x000000c8, 0x00000007, 0x0004003b,
+    0x00000024, 0x00000025, 0x00000007, 0x0003003e, 0x0000000f, 0x00000010, 0x00050041, 0x0000001e, 0x000000c9, 0x0000001b,
+    0x0000001d, 0x0004003d, 0x00000004, 0x000000ca, 0x000000c9, 0x00040071, 0x00000002, 0x000000cb, 0x000000ca, 0x0003003e,
+    0x000000c7, 0x000000cb, 0x000200f9, 0x00000011, 0x000200f8, 0x00000011, 0x000400f6, 0x000000cd, 0x000000ce, 0x00000000,
+    0x000200f9, 0x000000cf, 0x000200f8, 0x000000cf, 0x0004003d, 0x00000002, 0x000000d0, 0x0000000f, 0x0004003d, 0x00000002,
+    0x000000d1, 0x000000c7, 0x000500b0, 0x00000005, 0x000000d2, 0x000000d0, 0x000000d1, 0x000400fa, 0x000000d2, 0x000000cc,
+    0x000000cd, 0x000200f8, 0x000000cc, 0x0004003d, 0x00000002, 0x000000d3, 0x0000000f, 0x0004003d, 0x00000002, 0x000000d4,
+    0x000000c7, 0x0004003d, 0x00000002, 0x000000d5, 0x0000000f, 0x00050082, 0x00000002, 0x000000d6, 0x000000d4, 0x000000d5,
+    0x00050086, 0x00000002, 0x000000d7, 0x000000d6, 0x00000085, 0x00050080, 0x00000002, 0x000000d8, 0x000000d3, 0x000000d7,
+    0x0003003e, 0x000000c8, 0x000000d8, 0x0004003d, 0x00000002, 0x000000d9, 0x000000c8, 0x00070041, 0x0000001e, 0x000000da,
+    0x0000001b, 0x00000026, 0x000000d9, 0x0000001d, 0x0004003d, 0x00000004, 0x000000db, 0x000000da, 0x000500b2, 0x00000005,
+    0x000000dc, 0x000000db, 0x00000009, 0x000300f7, 0x000000de, 0x00000000, 0x000400fa, 0x000000dc, 0x000000dd, 0x000000df,
+    0x000200f8, 0x000000dd, 0x0004003d, 0x00000002, 0x000000e0, 0x000000c8, 0x00050080, 0x00000002, 0x000000e1, 0x000000e0,
+    0x0000005e, 0x0003003e, 0x0000000f, 0x000000e1, 0x000200f9, 0x000000de, 0x000200f8, 0x000000df, 0x0004003d, 0x00000002,
+    0x000000e2, 0x000000c8, 0x0003003e, 0x000000c7, 0x000000e2, 0x000200f9, 0x000000de, 0x000200f8, 0x000000de, 0x000200f9,
+    0x000000ce, 0x000200f8, 0x000000ce, 0x000200f9, 0x00000011, 0x000200f8, 0x000000cd, 0x0004003d, 0x00000002, 0x000000e3,
+    0x0000000f, 0x000500ac, 0x00000005, 0x000000e4, 0x000000e3, 0x00000010, 0x000300f7, 0x000000e6, 0x00000000, 0x000400fa,
+    0x000000e4, 0x000000e5, 0x000000e6, 0x000200f8, 0x000000e5, 0x0004003d, 0x00000002, 0x000000e7, 0x0000000f, 0x00050082,
+    0x00000002, 0x000000e8, 0x000000e7, 0x0000005e, 0x00060041, 0x00000028, 0x000000e9, 0x0000001b, 0x00000026, 0x000000e8,
+    0x0004003d, 0x00000017, 0x000000ea, 0x000000e9, 0x00050051, 0x00000004, 0x000000ec, 0x000000ea, 0x00000000, 0x00050041,
+    0x0000002c, 0x000000ed, 0x00000025, 0x0000001d, 0x0003003e, 0x000000ed, 0x000000ec, 0x00050051, 0x00000004, 0x000000ee,
+    0x000000ea, 0x00000001, 0x00050041, 0x0000002c, 0x000000ef, 0x00000025, 0x00000026, 0x0003003e, 0x000000ef, 0x000000ee,
+    0x00040071, 0x00000004, 0x000000f0, 0x0000000a, 0x00050080, 0x00000004, 0x000000f1, 0x00000009, 0x000000f0, 0x00050041,
+    0x0000002c, 0x000000f2, 0x00000025, 0x00000026, 0x0004003d, 0x00000004, 0x000000f3, 0x000000f2, 0x000500b2, 0x00000005,
+    0x000000f4, 0x000000f1, 0x000000f3, 0x000300f7, 0x000000f6, 0x00000000, 0x000400fa, 0x000000f4, 0x000000f5, 0x000000f6,
+    0x000200f8, 0x000000f5, 0x000200fe, 0x0000004b, 0x000200f8, 0x000000f6, 0x000200f9, 0x000000e6, 0x000200f8, 0x000000e6,
+    0x000200f9, 0x00000013, 0x000200f8, 0x00000013, 0x00060041, 0x00000054, 0x00000055, 0x00000053, 0x0000001d, 0x0000001d,
+    0x0004003d, 0x00000002, 0x00000056, 0x00000055, 0x00060041, 0x00000054, 0x0000005d, 0x0000005b, 0x0000001d, 0x00000056,
+    0x000700ea, 0x00000002, 0x0000005f, 0x0000005d, 0x0000005e, 0x00000010, 0x0000005e, 0x000500ae, 0x00000005, 0x00000064,
+    0x0000005f, 0x00000063, 0x000300f7, 0x00000067, 0x00000000, 0x000400fa, 0x00000064, 0x00000066, 0x00000067, 0x000200f8,
+    0x00000066, 0x000200fe, 0x00000068, 0x000200f8, 0x00000067, 0x00050041, 0x00000054, 0x0000006f, 0x0000006e, 0x00000026,
+    0x000700ea, 0x00000002, 0x00000071, 0x0000006f, 0x0000005e, 0x00000010, 0x00000070, 0x00050080, 0x00000002, 0x00000074,
+    0x00000071, 0x00000070, 0x00050044, 0x00000002, 0x00000075, 0x0000006e, 0x00000002, 0x0004007c, 0x0000001c, 0x00000076,
+    0x00000075, 0x0004007c, 0x00000002, 0x00000077, 0x00000076, 0x000500b2, 0x00000005, 0x00000078, 0x00000074, 0x00000077,
+    0x000300f7, 0x0000007b, 0x00000000, 0x000400fa, 0x00000078, 0x0000007a, 0x0000007b, 0x000200f8, 0x0000007a, 0x00060041,
+    0x00000054, 0x0000007f, 0x0000006e, 0x0000007c, 0x00000071, 0x0003003e, 0x0000007f, 0x00000070, 0x00050080, 0x00000002,
+    0x00000081, 0x00000071, 0x0000005e, 0x00060041, 0x00000054, 0x00000083, 0x0000006e, 0x0000007c, 0x00000081, 0x0003003e,
+    0x00000083, 0x00000082, 0x00050080, 0x00000002, 0x00000086, 0x00000071, 0x00000085, 0x00060041, 0x00000054, 0x00000087,
+    0x0000006e, 0x0000007c, 0x00000086, 0x0003003e, 0x00000087, 0x00000007, 0x00050080, 0x00000002, 0x0000008a, 0x00000071,
+    0x00000089, 0x00050051, 0x00000002, 0x0000008b, 0x00000008, 0x00000000, 0x00060041, 0x00000054, 0x0000008c, 0x0000006e,
+    0x0000007c, 0x0000008a, 0x0003003e, 0x0000008c, 0x0000008b, 0x00050080, 0x00000002, 0x0000008f, 0x00000071, 0x0000008e,
+    0x00050051, 0x00000002, 0x00000090, 0x00000008, 0x00000001, 0x00060041, 0x00000054, 0x00000091, 0x0000006e, 0x0000007c,
+    0x0000008f, 0x0003003e, 0x00000091, 0x00000090, 0x00050080, 0x00000002, 0x00000094, 0x00000071, 0x00000093, 0x00050051,
+    0x00000002, 0x00000095, 0x00000008, 0x00000002, 0x00060041, 0x00000054, 0x00000096, 0x0000006e, 0x0000007c, 0x00000094,
+    0x0003003e, 0x00000096, 0x00000095, 0x00050080, 0x00000002, 0x00000098, 0x00000071, 0x00000063, 0x00050051, 0x00000002,
+    0x00000099, 0x00000008, 0x00000003, 0x00060041, 0x00000054, 0x0000009a, 0x0000006e, 0x0000007c, 0x00000098, 0x0003003e,
+    0x0000009a, 0x00000099, 0x00050080, 0x00000002, 0x0000009d, 0x00000071, 0x0000009c, 0x00060041, 0x00000054, 0x0000009e,
+    0x0000006e, 0x0000007c, 0x0000009d, 0x0003003e, 0x0000009e, 0x00000085, 0x00050080, 0x00000002, 0x000000a1, 0x00000071,
+    0x000000a0, 0x00060041, 0x00000054, 0x000000a2, 0x0000006e, 0x0000007c, 0x000000a1, 0x0003003e, 0x000000a2, 0x0000005e,
+    0x00050080, 0x00000002, 0x000000a5, 0x00000071, 0x000000a4, 0x00060041, 0x00000054, 0x000000aa, 0x000000a9, 0x0000001d,
+    0x0000001d, 0x0004003d, 0x00000002, 0x000000ab, 0x000000aa, 0x00060041, 0x00000054, 0x000000ac, 0x0000006e, 0x0000007c,
+    0x000000a5, 0x0003003e, 0x000000ac, 0x000000ab, 0x00050080, 0x00000002, 0x000000af, 0x00000071, 0x000000ae, 0x00060041,
+    0x00000054, 0x000000b0, 0x00000053, 0x0000001d, 0x0000001d, 0x0004003d, 0x00000002, 0x000000b1, 0x000000b0, 0x00060041,
+    0x00000054, 0x000000b2, 0x0000006e, 0x0000007c, 0x000000af, 0x0003003e, 0x000000b2, 0x000000b1, 0x00050080, 0x00000002,
+    0x000000b5, 0x00000071, 0x000000b4, 0x00040071, 0x00000002, 0x000000b6, 0x00000009, 0x00060041, 0x00000054, 0x000000b7,
+    0x0000006e, 0x0000007c, 0x000000b5, 0x0003003e, 0x000000b7, 0x000000b6, 0x00050080, 0x00000002, 0x000000ba, 0x00000071,
+    0x000000b9, 0x000500c2, 0x00000004, 0x000000bc, 0x00000009, 0x000000bb, 0x00040071, 0x00000002, 0x000000bd, 0x000000bc,
+    0x00060041, 0x00000054, 0x000000be, 0x0000006e, 0x0000007c, 0x000000ba, 0x0003003e, 0x000000be, 0x000000bd, 0x00050080,
+    0x00000002, 0x000000c1, 0x00000071, 0x000000c0, 0x00060041, 0x00000054, 0x000000c2, 0x0000006e, 0x0000007c, 0x000000c1,
+    0x0003003e, 0x000000c2, 0x0000000a, 0x00050080, 0x00000002, 0x000000c5, 0x00000071, 0x000000c4, 0x00060041, 0x00000054,
+    0x000000c6, 0x0000006e, 0x0000007c, 0x000000c5, 0x0003003e, 0x000000c6, 0x0000000b, 0x000200f9, 0x0000007b, 0x000200f8,
+    0x0000007b, 0x000200fe, 0x00000068, 0x00010038,
 };
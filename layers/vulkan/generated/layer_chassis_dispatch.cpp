@@ -1319,77 +1319,6 @@ VkResult DispatchCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCre
     return result;
 }
 
-void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites,
-                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) {
-    auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
-    if (!wrap_handles)
-        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
-                                                                      descriptorCopyCount, pDescriptorCopies);
-    vku::safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
-    vku::safe_VkCopyDescriptorSet* local_pDescriptorCopies = nullptr;
-    {
-        if (pDescriptorWrites) {
-            local_pDescriptorWrites = new vku::safe_VkWriteDescriptorSet[descriptorWriteCount];
-            for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
-                local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
-                WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
-
-                if (pDescriptorWrites[index0].dstSet) {
-                    local_pDescriptorWrites[index0].dstSet = layer_data->Unwrap(pDescriptorWrites[index0].dstSet);
-                }
-                if (local_pDescriptorWrites[index0].pImageInfo) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        if (pDescriptorWrites[index0].pImageInfo[index1].sampler) {
-                            local_pDescriptorWrites[index0].pImageInfo[index1].sampler =
-                                layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].sampler);
-                        }
-                        if (pDescriptorWrites[index0].pImageInfo[index1].imageView) {
-                            local_pDescriptorWrites[index0].pImageInfo[index1].imageView =
-                                layer_data->Unwrap(pDescriptorWrites[index0].pImageInfo[index1].imageView);
-                        }
-                    }
-                }
-                if (local_pDescriptorWrites[index0].pBufferInfo) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        if (pDescriptorWrites[index0].pBufferInfo[index1].buffer) {
-                            local_pDescriptorWrites[index0].pBufferInfo[index1].buffer =
-                                layer_data->Unwrap(pDescriptorWrites[index0].pBufferInfo[index1].buffer);
-                        }
-                    }
-                }
-                if (local_pDescriptorWrites[index0].pTexelBufferView) {
-                    for (uint32_t index1 = 0; index1 < local_pDescriptorWrites[index0].descriptorCount; ++index1) {
-                        local_pDescriptorWrites[index0].pTexelBufferView[index1] =
-                            layer_data->Unwrap(local_pDescriptorWrites[index0].pTexelBufferView[index1]);
-                    }
-                }
-            }
-        }
-        if (pDescriptorCopies) {
-            local_pDescriptorCopies = new vku::safe_VkCopyDescriptorSet[descriptorCopyCount];
-            for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
-                local_pDescriptorCopies[index0].initialize(&pDescriptorCopies[index0]);
-
-                if (pDescriptorCopies[index0].srcSet) {
-                    local_pDescriptorCopies[index0].srcSet = layer_data->Unwrap(pDescriptorCopies[index0].srcSet);
-                }
-                if (pDescriptorCopies[index0].dstSet) {
-                    local_pDescriptorCopies[index0].dstSet = layer_data->Unwrap(pDescriptorCopies[index0].dstSet);
-                }
-            }
-        }
-    }
-    layer_data->device_dispatch_table.UpdateDescriptorSets(
-        device, descriptorWriteCount, (const VkWriteDescriptorSet*)local_pDescriptorWrites, descriptorCopyCount,
-        (const VkCopyDescriptorSet*)local_pDescriptorCopies);
-    if (local_pDescriptorWrites) {
-        delete[] local_pDescriptorWrites;
-    }
-    if (local_pDescriptorCopies) {
-        delete[] local_pDescriptorCopies;
-    }
-}
-
 VkResult DispatchCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                    const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
@@ -9346,4 +9275,143 @@ void DispatchCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkB
                                                                        countBufferOffset, maxDrawCount, stride);
 }
 
+bool IsDownChainOnlyDispatch(const char* name) {
+    static const vvl::unordered_set<std::string_view> down_chain_only_commands = {
+        "vkCmdSetViewport",
+        "vkCmdSetScissor",
+        "vkCmdSetLineWidth",
+        "vkCmdSetDepthBias",
+        "vkCmdSetBlendConstants",
+        "vkCmdSetDepthBounds",
+        "vkCmdSetStencilCompareMask",
+        "vkCmdSetStencilWriteMask",
+        "vkCmdSetStencilReference",
+        "vkCmdDraw",
+        "vkCmdDrawIndexed",
+        "vkCmdDispatch",
+        "vkCmdClearAttachments",
+        "vkCmdNextSubpass",
+        "vkCmdEndRenderPass",
+        "vkCmdExecuteCommands",
+        "vkCmdSetDeviceMask",
+        "vkCmdDispatchBase",
+        "vkCmdNextSubpass2",
+        "vkCmdEndRenderPass2",
+        "vkCmdEndRendering",
+        "vkCmdSetCullMode",
+        "vkCmdSetFrontFace",
+        "vkCmdSetPrimitiveTopology",
+        "vkCmdSetViewportWithCount",
+        "vkCmdSetScissorWithCount",
+        "vkCmdSetDepthTestEnable",
+        "vkCmdSetDepthWriteEnable",
+        "vkCmdSetDepthCompareOp",
+        "vkCmdSetDepthBoundsTestEnable",
+        "vkCmdSetStencilTestEnable",
+        "vkCmdSetStencilOp",
+        "vkCmdSetRasterizerDiscardEnable",
+        "vkCmdSetDepthBiasEnable",
+        "vkCmdSetPrimitiveRestartEnable",
+        "vkCmdEndVideoCodingKHR",
+        "vkCmdControlVideoCodingKHR",
+        "vkCmdEndRenderingKHR",
+        "vkCmdSetDeviceMaskKHR",
+        "vkCmdDispatchBaseKHR",
+        "vkCmdNextSubpass2KHR",
+        "vkCmdEndRenderPass2KHR",
+        "vkCmdSetFragmentShadingRateKHR",
+        "vkCmdSetRenderingAttachmentLocationsKHR",
+        "vkCmdSetRenderingInputAttachmentIndicesKHR",
+        "vkCmdTraceRaysIndirect2KHR",
+        "vkCmdSetLineStippleKHR",
+        "vkCmdDebugMarkerBeginEXT",
+        "vkCmdDebugMarkerEndEXT",
+        "vkCmdDebugMarkerInsertEXT",
+        "vkCmdEndConditionalRenderingEXT",
+        "vkCmdSetViewportWScalingNV",
+        "vkCmdSetDiscardRectangleEXT",
+        "vkCmdSetDiscardRectangleEnableEXT",
+        "vkCmdSetDiscardRectangleModeEXT",
+        "vkCmdBeginDebugUtilsLabelEXT",
+        "vkCmdEndDebugUtilsLabelEXT",
+        "vkCmdInsertDebugUtilsLabelEXT",
+        "vkCmdInitializeGraphScratchMemoryAMDX",
+        "vkCmdDispatchGraphAMDX",
+        "vkCmdDispatchGraphIndirectAMDX",
+        "vkCmdDispatchGraphIndirectCountAMDX",
+        "vkCmdSetSampleLocationsEXT",
+        "vkCmdSetViewportShadingRatePaletteNV",
+        "vkCmdSetCoarseSampleOrderNV",
+        "vkCmdDrawMeshTasksNV",
+        "vkCmdSetExclusiveScissorEnableNV",
+        "vkCmdSetExclusiveScissorNV",
+        "vkCmdSetCheckpointNV",
+        "vkCmdSetLineStippleEXT",
+        "vkCmdSetCullModeEXT",
+        "vkCmdSetFrontFaceEXT",
+        "vkCmdSetPrimitiveTopologyEXT",
+        "vkCmdSetViewportWithCountEXT",
+        "vkCmdSetScissorWithCountEXT",
+        "vkCmdSetDepthTestEnableEXT",
+        "vkCmdSetDepthWriteEnableEXT",
+        "vkCmdSetDepthCompareOpEXT",
+        "vkCmdSetDepthBoundsTestEnableEXT",
+        "vkCmdSetStencilTestEnableEXT",
+        "vkCmdSetStencilOpEXT",
+        "vkCmdSetDepthBias2EXT",
+        "vkCmdSetFragmentShadingRateEnumNV",
+        "vkCmdSetVertexInputEXT",
+        "vkCmdSubpassShadingHUAWEI",
+        "vkCmdSetPatchControlPointsEXT",
+        "vkCmdSetRasterizerDiscardEnableEXT",
+        "vkCmdSetDepthBiasEnableEXT",
+        "vkCmdSetLogicOpEXT",
+        "vkCmdSetPrimitiveRestartEnableEXT",
+        "vkCmdSetColorWriteEnableEXT",
+        "vkCmdDrawMultiEXT",
+        "vkCmdDrawMultiIndexedEXT",
+        "vkCmdDrawClusterHUAWEI",
+        "vkCmdCopyMemoryIndirectNV",
+        "vkCmdDecompressMemoryNV",
+        "vkCmdDecompressMemoryIndirectCountNV",
+        "vkCmdSetDepthClampEnableEXT",
+        "vkCmdSetPolygonModeEXT",
+        "vkCmdSetRasterizationSamplesEXT",
+        "vkCmdSetSampleMaskEXT",
+        "vkCmdSetAlphaToCoverageEnableEXT",
+        "vkCmdSetAlphaToOneEnableEXT",
+        "vkCmdSetLogicOpEnableEXT",
+        "vkCmdSetColorBlendEnableEXT",
+        "vkCmdSetColorBlendEquationEXT",
+        "vkCmdSetColorWriteMaskEXT",
+        "vkCmdSetTessellationDomainOriginEXT",
+        "vkCmdSetRasterizationStreamEXT",
+        "vkCmdSetConservativeRasterizationModeEXT",
+        "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+        "vkCmdSetDepthClipEnableEXT",
+        "vkCmdSetSampleLocationsEnableEXT",
+        "vkCmdSetColorBlendAdvancedEXT",
+        "vkCmdSetProvokingVertexModeEXT",
+        "vkCmdSetLineRasterizationModeEXT",
+        "vkCmdSetLineStippleEnableEXT",
+        "vkCmdSetDepthClipNegativeOneToOneEXT",
+        "vkCmdSetViewportWScalingEnableNV",
+        "vkCmdSetViewportSwizzleNV",
+        "vkCmdSetCoverageToColorEnableNV",
+        "vkCmdSetCoverageToColorLocationNV",
+        "vkCmdSetCoverageModulationModeNV",
+        "vkCmdSetCoverageModulationTableEnableNV",
+        "vkCmdSetCoverageModulationTableNV",
+        "vkCmdSetShadingRateImageEnableNV",
+        "vkCmdSetRepresentativeFragmentTestEnableNV",
+        "vkCmdSetCoverageReductionModeNV",
+        "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+        "vkCmdTraceRaysKHR",
+        "vkCmdTraceRaysIndirectKHR",
+        "vkCmdSetRayTracingPipelineStackSizeKHR",
+        "vkCmdDrawMeshTasksEXT",
+    };
+    return down_chain_only_commands.count(name) != 0;
+}
+
 // NOLINTEND
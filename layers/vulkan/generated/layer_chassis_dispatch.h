@@ -29,6 +29,9 @@ extern bool wrap_handles;
 class ValidationObject;
 void WrapPnextChainHandles(ValidationObject* layer_data, const void* pNext);
 
+// True for the vkCmd* commands that have no handle to unwrap, their dispatch function only calls down the chain
+bool IsDownChainOnlyDispatch(const char* name);
+
 VkResult DispatchCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
                                 VkInstance* pInstance);
 void DispatchDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator);
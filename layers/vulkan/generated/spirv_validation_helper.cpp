@@ -1069,171 +1069,470 @@ static inline std::string SpvExtensionRequirments(std::string_view extension) {
 }
 // clang-format on
 
-bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(const spirv::Instruction &insn, const Location &loc) const {
-    bool skip = false;
-    const bool pipeline = loc.function != vvl::Func::vkCreateShadersEXT;
+// Dense index of the capabilities and extensions that have requirements, their bit in the supported sets of CoreChecks
+static constexpr uint32_t kSpirvCapabilityCount = 153;
+static constexpr uint32_t kSpirvExtensionCount = 85;
+static_assert(kSpirvCapabilityCount <= CoreChecks::kMaxSpirvCapabilities, "CoreChecks::SpirvCapabilityBits is too small");
+static_assert(kSpirvExtensionCount <= CoreChecks::kMaxSpirvExtensions, "CoreChecks::SpirvExtensionBits is too small");
 
-    if (insn.Opcode() == spv::OpCapability) {
-        // All capabilities are generated so if it is not in the list it is not supported by Vulkan
-        if (spirvCapabilities.count(insn.Word(1)) == 0) {
-            const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08739" : "VUID-VkShaderCreateInfoEXT-pCode-08739";
-            skip |= LogError(vuid, device, loc, "SPIR-V has Capability (%s) declared, but this is not supported by Vulkan.",
-                             string_SpvCapability(insn.Word(1)));
-            return skip;  // no known capability to validate
-        }
+// clang-format off
+// Returns vvl::kNoIndex32 if the capability is not supported by Vulkan
+static uint32_t GetSpirvCapabilityIndex(uint32_t capability) {
+    switch (capability) {
+        case spv::CapabilityMatrix: return 0;
+        case spv::CapabilityShader: return 1;
+        case spv::CapabilityInputAttachment: return 2;
+        case spv::CapabilitySampled1D: return 3;
+        case spv::CapabilityImage1D: return 4;
+        case spv::CapabilitySampledBuffer: return 5;
+        case spv::CapabilityImageBuffer: return 6;
+        case spv::CapabilityImageQuery: return 7;
+        case spv::CapabilityDerivativeControl: return 8;
+        case spv::CapabilityGeometry: return 9;
+        case spv::CapabilityTessellation: return 10;
+        case spv::CapabilityFloat64: return 11;
+        case spv::CapabilityInt64: return 12;
+        case spv::CapabilityInt64Atomics: return 13;
+        case spv::CapabilityAtomicFloat16AddEXT: return 14;
+        case spv::CapabilityAtomicFloat32AddEXT: return 15;
+        case spv::CapabilityAtomicFloat64AddEXT: return 16;
+        case spv::CapabilityAtomicFloat16MinMaxEXT: return 17;
+        case spv::CapabilityAtomicFloat32MinMaxEXT: return 18;
+        case spv::CapabilityAtomicFloat64MinMaxEXT: return 19;
+        case spv::CapabilityAtomicFloat16VectorNV: return 20;
+        case spv::CapabilityInt64ImageEXT: return 21;
+        case spv::CapabilityInt16: return 22;
+        case spv::CapabilityTessellationPointSize: return 23;
+        case spv::CapabilityGeometryPointSize: return 24;
+        case spv::CapabilityImageGatherExtended: return 25;
+        case spv::CapabilityStorageImageMultisample: return 26;
+        case spv::CapabilityUniformBufferArrayDynamicIndexing: return 27;
+        case spv::CapabilitySampledImageArrayDynamicIndexing: return 28;
+        case spv::CapabilityStorageBufferArrayDynamicIndexing: return 29;
+        case spv::CapabilityStorageImageArrayDynamicIndexing: return 30;
+        case spv::CapabilityClipDistance: return 31;
+        case spv::CapabilityCullDistance: return 32;
+        case spv::CapabilityImageCubeArray: return 33;
+        case spv::CapabilitySampleRateShading: return 34;
+        case spv::CapabilitySparseResidency: return 35;
+        case spv::CapabilityMinLod: return 36;
+        case spv::CapabilitySampledCubeArray: return 37;
+        case spv::CapabilityImageMSArray: return 38;
+        case spv::CapabilityStorageImageExtendedFormats: return 39;
+        case spv::CapabilityInterpolationFunction: return 40;
+        case spv::CapabilityStorageImageReadWithoutFormat: return 41;
+        case spv::CapabilityStorageImageWriteWithoutFormat: return 42;
+        case spv::CapabilityMultiViewport: return 43;
+        case spv::CapabilityDrawParameters: return 44;
+        case spv::CapabilityMultiView: return 45;
+        case spv::CapabilityDeviceGroup: return 46;
+        case spv::CapabilityVariablePointersStorageBuffer: return 47;
+        case spv::CapabilityVariablePointers: return 48;
+        case spv::CapabilityShaderClockKHR: return 49;
+        case spv::CapabilityStencilExportEXT: return 50;
+        case spv::CapabilitySubgroupBallotKHR: return 51;
+        case spv::CapabilitySubgroupVoteKHR: return 52;
+        case spv::CapabilityImageReadWriteLodAMD: return 53;
+        case spv::CapabilityImageGatherBiasLodAMD: return 54;
+        case spv::CapabilityFragmentMaskAMD: return 55;
+        case spv::CapabilitySampleMaskOverrideCoverageNV: return 56;
+        case spv::CapabilityGeometryShaderPassthroughNV: return 57;
+        case spv::CapabilityShaderViewportIndex: return 58;
+        case spv::CapabilityShaderLayer: return 59;
+        case spv::CapabilityShaderViewportIndexLayerEXT: return 60;
+        case spv::CapabilityShaderViewportMaskNV: return 61;
+        case spv::CapabilityPerViewAttributesNV: return 62;
+        case spv::CapabilityStorageBuffer16BitAccess: return 63;
+        case spv::CapabilityUniformAndStorageBuffer16BitAccess: return 64;
+        case spv::CapabilityStoragePushConstant16: return 65;
+        case spv::CapabilityStorageInputOutput16: return 66;
+        case spv::CapabilityGroupNonUniform: return 67;
+        case spv::CapabilityGroupNonUniformVote: return 68;
+        case spv::CapabilityGroupNonUniformArithmetic: return 69;
+        case spv::CapabilityGroupNonUniformBallot: return 70;
+        case spv::CapabilityGroupNonUniformShuffle: return 71;
+        case spv::CapabilityGroupNonUniformShuffleRelative: return 72;
+        case spv::CapabilityGroupNonUniformClustered: return 73;
+        case spv::CapabilityGroupNonUniformQuad: return 74;
+        case spv::CapabilityGroupNonUniformPartitionedNV: return 75;
+        case spv::CapabilitySampleMaskPostDepthCoverage: return 76;
+        case spv::CapabilityShaderNonUniform: return 77;
+        case spv::CapabilityRuntimeDescriptorArray: return 78;
+        case spv::CapabilityInputAttachmentArrayDynamicIndexing: return 79;
+        case spv::CapabilityUniformTexelBufferArrayDynamicIndexing: return 80;
+        case spv::CapabilityStorageTexelBufferArrayDynamicIndexing: return 81;
+        case spv::CapabilityUniformBufferArrayNonUniformIndexing: return 82;
+        case spv::CapabilitySampledImageArrayNonUniformIndexing: return 83;
+        case spv::CapabilityStorageBufferArrayNonUniformIndexing: return 84;
+        case spv::CapabilityStorageImageArrayNonUniformIndexing: return 85;
+        case spv::CapabilityInputAttachmentArrayNonUniformIndexing: return 86;
+        case spv::CapabilityUniformTexelBufferArrayNonUniformIndexing: return 87;
+        case spv::CapabilityStorageTexelBufferArrayNonUniformIndexing: return 88;
+        case spv::CapabilityFragmentFullyCoveredEXT: return 89;
+        case spv::CapabilityFloat16: return 90;
+        case spv::CapabilityInt8: return 91;
+        case spv::CapabilityStorageBuffer8BitAccess: return 92;
+        case spv::CapabilityUniformAndStorageBuffer8BitAccess: return 93;
+        case spv::CapabilityStoragePushConstant8: return 94;
+        case spv::CapabilityVulkanMemoryModel: return 95;
+        case spv::CapabilityVulkanMemoryModelDeviceScope: return 96;
+        case spv::CapabilityDenormPreserve: return 97;
+        case spv::CapabilityDenormFlushToZero: return 98;
+        case spv::CapabilitySignedZeroInfNanPreserve: return 99;
+        case spv::CapabilityRoundingModeRTE: return 100;
+        case spv::CapabilityRoundingModeRTZ: return 101;
+        case spv::CapabilityComputeDerivativeGroupQuadsNV: return 102;
+        case spv::CapabilityComputeDerivativeGroupLinearNV: return 103;
+        case spv::CapabilityImageFootprintNV: return 104;
+        case spv::CapabilityMeshShadingNV: return 105;
+        case spv::CapabilityRayTracingKHR: return 106;
+        case spv::CapabilityRayQueryKHR: return 107;
+        case spv::CapabilityRayTraversalPrimitiveCullingKHR: return 108;
+        case spv::CapabilityRayCullMaskKHR: return 109;
+        case spv::CapabilityRayTracingNV: return 110;
+        case spv::CapabilityRayTracingMotionBlurNV: return 111;
+        case spv::CapabilityTransformFeedback: return 112;
+        case spv::CapabilityGeometryStreams: return 113;
+        case spv::CapabilityFragmentDensityEXT: return 114;
+        case spv::CapabilityPhysicalStorageBufferAddresses: return 115;
+        case spv::CapabilityCooperativeMatrixNV: return 116;
+        case spv::CapabilityIntegerFunctions2INTEL: return 117;
+        case spv::CapabilityShaderSMBuiltinsNV: return 118;
+        case spv::CapabilityFragmentShaderSampleInterlockEXT: return 119;
+        case spv::CapabilityFragmentShaderPixelInterlockEXT: return 120;
+        case spv::CapabilityFragmentShaderShadingRateInterlockEXT: return 121;
+        case spv::CapabilityDemoteToHelperInvocationEXT: return 122;
+        case spv::CapabilityFragmentShadingRateKHR: return 123;
+        case spv::CapabilityWorkgroupMemoryExplicitLayoutKHR: return 124;
+        case spv::CapabilityWorkgroupMemoryExplicitLayout8BitAccessKHR: return 125;
+        case spv::CapabilityWorkgroupMemoryExplicitLayout16BitAccessKHR: return 126;
+        case spv::CapabilityDotProductInputAllKHR: return 127;
+        case spv::CapabilityDotProductInput4x8BitKHR: return 128;
+        case spv::CapabilityDotProductInput4x8BitPackedKHR: return 129;
+        case spv::CapabilityDotProductKHR: return 130;
+        case spv::CapabilityFragmentBarycentricKHR: return 131;
+        case spv::CapabilityTextureSampleWeightedQCOM: return 132;
+        case spv::CapabilityTextureBoxFilterQCOM: return 133;
+        case spv::CapabilityTextureBlockMatchQCOM: return 134;
+        case spv::CapabilityTextureBlockMatch2QCOM: return 135;
+        case spv::CapabilityMeshShadingEXT: return 136;
+        case spv::CapabilityRayTracingOpacityMicromapEXT: return 137;
+        case spv::CapabilityCoreBuiltinsARM: return 138;
+        case spv::CapabilityShaderInvocationReorderNV: return 139;
+        case spv::CapabilityRayTracingPositionFetchKHR: return 140;
+        case spv::CapabilityRayQueryPositionFetchKHR: return 141;
+        case spv::CapabilityTileImageColorReadAccessEXT: return 142;
+        case spv::CapabilityTileImageDepthReadAccessEXT: return 143;
+        case spv::CapabilityTileImageStencilReadAccessEXT: return 144;
+        case spv::CapabilityCooperativeMatrixKHR: return 145;
+        case spv::CapabilityShaderEnqueueAMDX: return 146;
+        case spv::CapabilityGroupNonUniformRotateKHR: return 147;
+        case spv::CapabilityExpectAssumeKHR: return 148;
+        case spv::CapabilityFloatControls2: return 149;
+        case spv::CapabilityQuadControlKHR: return 150;
+        case spv::CapabilityRawAccessChainsNV: return 151;
+        case spv::CapabilityReplicatedCompositesEXT: return 152;
+        default: return vvl::kNoIndex32;
+    }
+}
+
+// Interns the name of an OpExtension, returns vvl::kNoIndex32 if the extension is not supported by Vulkan
+static uint32_t GetSpirvExtensionIndex(std::string_view extension) {
+    static const vvl::unordered_map<std::string_view, uint32_t> table {
+    {"SPV_KHR_variable_pointers", 0},
+    {"SPV_AMD_shader_explicit_vertex_parameter", 1},
+    {"SPV_AMD_gcn_shader", 2},
+    {"SPV_AMD_gpu_shader_half_float", 3},
+    {"SPV_AMD_gpu_shader_int16", 4},
+    {"SPV_AMD_shader_ballot", 5},
+    {"SPV_AMD_shader_fragment_mask", 6},
+    {"SPV_AMD_shader_image_load_store_lod", 7},
+    {"SPV_AMD_shader_trinary_minmax", 8},
+    {"SPV_AMD_texture_gather_bias_lod", 9},
+    {"SPV_AMD_shader_early_and_late_fragment_tests", 10},
+    {"SPV_KHR_shader_draw_parameters", 11},
+    {"SPV_KHR_8bit_storage", 12},
+    {"SPV_KHR_16bit_storage", 13},
+    {"SPV_KHR_shader_clock", 14},
+    {"SPV_KHR_float_controls", 15},
+    {"SPV_KHR_storage_buffer_storage_class", 16},
+    {"SPV_KHR_post_depth_coverage", 17},
+    {"SPV_EXT_shader_stencil_export", 18},
+    {"SPV_KHR_shader_ballot", 19},
+    {"SPV_KHR_subgroup_vote", 20},
+    {"SPV_NV_sample_mask_override_coverage", 21},
+    {"SPV_NV_geometry_shader_passthrough", 22},
+    {"SPV_NV_mesh_shader", 23},
+    {"SPV_NV_viewport_array2", 24},
+    {"SPV_NV_shader_subgroup_partitioned", 25},
+    {"SPV_NV_shader_invocation_reorder", 26},
+    {"SPV_EXT_shader_viewport_index_layer", 27},
+    {"SPV_NVX_multiview_per_view_attributes", 28},
+    {"SPV_EXT_descriptor_indexing", 29},
+    {"SPV_KHR_vulkan_memory_model", 30},
+    {"SPV_NV_compute_shader_derivatives", 31},
+    {"SPV_NV_fragment_shader_barycentric", 32},
+    {"SPV_NV_shader_image_footprint", 33},
+    {"SPV_NV_shading_rate", 34},
+    {"SPV_NV_ray_tracing", 35},
+    {"SPV_KHR_ray_tracing", 36},
+    {"SPV_KHR_ray_query", 37},
+    {"SPV_KHR_ray_cull_mask", 38},
+    {"SPV_GOOGLE_hlsl_functionality1", 39},
+    {"SPV_GOOGLE_user_type", 40},
+    {"SPV_GOOGLE_decorate_string", 41},
+    {"SPV_EXT_fragment_invocation_density", 42},
+    {"SPV_KHR_physical_storage_buffer", 43},
+    {"SPV_EXT_physical_storage_buffer", 44},
+    {"SPV_NV_cooperative_matrix", 45},
+    {"SPV_NV_shader_sm_builtins", 46},
+    {"SPV_EXT_fragment_shader_interlock", 47},
+    {"SPV_EXT_demote_to_helper_invocation", 48},
+    {"SPV_KHR_fragment_shading_rate", 49},
+    {"SPV_KHR_non_semantic_info", 50},
+    {"SPV_EXT_shader_image_int64", 51},
+    {"SPV_KHR_terminate_invocation", 52},
+    {"SPV_KHR_multiview", 53},
+    {"SPV_KHR_workgroup_memory_explicit_layout", 54},
+    {"SPV_EXT_shader_atomic_float_add", 55},
+    {"SPV_KHR_fragment_shader_barycentric", 56},
+    {"SPV_KHR_subgroup_uniform_control_flow", 57},
+    {"SPV_EXT_shader_atomic_float_min_max", 58},
+    {"SPV_EXT_shader_atomic_float16_add", 59},
+    {"SPV_NV_shader_atomic_fp16_vector", 60},
+    {"SPV_EXT_fragment_fully_covered", 61},
+    {"SPV_KHR_integer_dot_product", 62},
+    {"SPV_INTEL_shader_integer_functions2", 63},
+    {"SPV_KHR_device_group", 64},
+    {"SPV_QCOM_image_processing", 65},
+    {"SPV_QCOM_image_processing2", 66},
+    {"SPV_EXT_mesh_shader", 67},
+    {"SPV_KHR_ray_tracing_position_fetch", 68},
+    {"SPV_EXT_shader_tile_image", 69},
+    {"SPV_EXT_opacity_micromap", 70},
+    {"SPV_KHR_cooperative_matrix", 71},
+    {"SPV_ARM_core_builtins", 72},
+    {"SPV_AMDX_shader_enqueue", 73},
+    {"SPV_HUAWEI_cluster_culling_shader", 74},
+    {"SPV_HUAWEI_subpass_shading", 75},
+    {"SPV_NV_ray_tracing_motion_blur", 76},
+    {"SPV_KHR_maximal_reconvergence", 77},
+    {"SPV_KHR_subgroup_rotate", 78},
+    {"SPV_KHR_expect_assume", 79},
+    {"SPV_KHR_float_controls2", 80},
+    {"SPV_KHR_quad_control", 81},
+    {"SPV_NV_raw_access_chains", 82},
+    {"SPV_EXT_replicated_composites", 83},
+    {"SPV_KHR_relaxed_extended_instruction", 84},
+    };
+
+    const auto entry = table.find(extension);
+    return entry != table.end() ? entry->second : vvl::kNoIndex32;
+}
+// clang-format on
 
-        // Each capability has one or more requirements to check
-        // Only one item has to be satisfied and an error only occurs
-        // when all are not satisfied
-        auto caps = spirvCapabilities.equal_range(insn.Word(1));
+void CoreChecks::InitSpirvSupport() {
+    // Each capability has one or more requirements to check
+    // Only one item has to be satisfied for the capability to be supported
+    for (const auto &[capability, info] : spirvCapabilities) {
         bool has_support = false;
-        for (auto it = caps.first; (it != caps.second) && (has_support == false); ++it) {
-            if (it->second.version) {
-                if (api_version >= it->second.version) {
-                    has_support = true;
-                }
-            } else if (it->second.feature) {
-                if (it->second.feature.IsEnabled(enabled_features)) {
-                    has_support = true;
-                }
-            } else if (it->second.extension) {
-                // kEnabledByApiLevel is not valid as some extension are promoted with feature bits to be used.
-                // If the new Api Level gives support, it will be caught in the "it->second.version" check instead.
-                if (IsExtEnabledByCreateinfo(device_extensions.*(it->second.extension))) {
-                    has_support = true;
-                }
-            } else if (it->second.property) {
-                // support is or'ed as only one has to be supported (if applicable)
-                switch (insn.Word(1)) {
-                    case spv::CapabilityDenormFlushToZero:
-                        has_support |= ((phys_dev_props_core12.shaderDenormFlushToZeroFloat16 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderDenormFlushToZeroFloat32 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderDenormFlushToZeroFloat64 & VK_TRUE) != 0);
-                        break;
-                    case spv::CapabilityDenormPreserve:
-                        has_support |= ((phys_dev_props_core12.shaderDenormPreserveFloat16 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderDenormPreserveFloat32 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderDenormPreserveFloat64 & VK_TRUE) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniform:
-                        has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformArithmetic:
-                        has_support |=
-                            ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformBallot:
-                        has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformClustered:
-                        has_support |=
-                            ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformPartitionedNV:
-                        has_support |=
-                            ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformQuad:
-                        has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformShuffle:
-                        has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformShuffleRelative:
-                        has_support |=
-                            ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT) != 0);
-                        break;
-                    case spv::CapabilityGroupNonUniformVote:
-                        has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT) != 0);
-                        break;
-                    case spv::CapabilityRoundingModeRTE:
-                        has_support |= ((phys_dev_props_core12.shaderRoundingModeRTEFloat16 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderRoundingModeRTEFloat32 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderRoundingModeRTEFloat64 & VK_TRUE) != 0);
-                        break;
-                    case spv::CapabilityRoundingModeRTZ:
-                        has_support |= ((phys_dev_props_core12.shaderRoundingModeRTZFloat16 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderRoundingModeRTZFloat32 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderRoundingModeRTZFloat64 & VK_TRUE) != 0);
-                        break;
-                    case spv::CapabilitySignedZeroInfNanPreserve:
-                        has_support |= ((phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat16 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat32 & VK_TRUE) != 0);
-                        has_support |= ((phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat64 & VK_TRUE) != 0);
-                        break;
-                    default:
-                        break;
-                }
+        if (info.version) {
+            has_support = api_version >= info.version;
+        } else if (info.feature) {
+            has_support = info.feature.IsEnabled(enabled_features);
+        } else if (info.extension) {
+            // kEnabledByApiLevel is not valid as some extension are promoted with feature bits to be used.
+            // If the new Api Level gives support, it will be caught in the "info.version" check instead.
+            has_support = IsExtEnabledByCreateinfo(device_extensions.*(info.extension));
+        } else if (info.property) {
+            // support is or'ed as only one has to be supported (if applicable)
+            switch (capability) {
+                case spv::CapabilityDenormFlushToZero:
+                    has_support |= ((phys_dev_props_core12.shaderDenormFlushToZeroFloat16 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderDenormFlushToZeroFloat32 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderDenormFlushToZeroFloat64 & VK_TRUE) != 0);
+                    break;
+                case spv::CapabilityDenormPreserve:
+                    has_support |= ((phys_dev_props_core12.shaderDenormPreserveFloat16 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderDenormPreserveFloat32 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderDenormPreserveFloat64 & VK_TRUE) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniform:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BASIC_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformArithmetic:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformBallot:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_BALLOT_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformClustered:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_CLUSTERED_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformPartitionedNV:
+                    has_support |=
+                        ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_PARTITIONED_BIT_NV) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformQuad:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_QUAD_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformShuffle:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformShuffleRelative:
+                    has_support |=
+                        ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT) != 0);
+                    break;
+                case spv::CapabilityGroupNonUniformVote:
+                    has_support |= ((phys_dev_props_core11.subgroupSupportedOperations & VK_SUBGROUP_FEATURE_VOTE_BIT) != 0);
+                    break;
+                case spv::CapabilityRoundingModeRTE:
+                    has_support |= ((phys_dev_props_core12.shaderRoundingModeRTEFloat16 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderRoundingModeRTEFloat32 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderRoundingModeRTEFloat64 & VK_TRUE) != 0);
+                    break;
+                case spv::CapabilityRoundingModeRTZ:
+                    has_support |= ((phys_dev_props_core12.shaderRoundingModeRTZFloat16 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderRoundingModeRTZFloat32 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderRoundingModeRTZFloat64 & VK_TRUE) != 0);
+                    break;
+                case spv::CapabilitySignedZeroInfNanPreserve:
+                    has_support |= ((phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat16 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat32 & VK_TRUE) != 0);
+                    has_support |= ((phys_dev_props_core12.shaderSignedZeroInfNanPreserveFloat64 & VK_TRUE) != 0);
+                    break;
+                default:
+                    break;
             }
         }
-
-        if (has_support == false) {
-            const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08740" : "VUID-VkShaderCreateInfoEXT-pCode-08740";
-            skip |= LogError(vuid, device, loc,
-                             "SPIR-V Capability %s was declared, but one of the following requirements is required (%s).",
-                             string_SpvCapability(insn.Word(1)), SpvCapabilityRequirements(insn.Word(1)));
+        if (has_support) {
+            supported_spirv_capabilities.set(GetSpirvCapabilityIndex(capability));
         }
+    }
 
-        // Portability checks
-        if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
-            if ((VK_FALSE == enabled_features.shaderSampleRateInterpolationFunctions) &&
-                (spv::CapabilityInterpolationFunction == insn.Word(1))) {
-                skip |= LogError("VUID-RuntimeSpirv-shaderSampleRateInterpolationFunctions-06325", device, loc,
-                                 "SPIR-V (portability error) InterpolationFunction Capability are not supported "
-                                 "by this platform");
-            }
+    // Same for each SPIR-V Extension
+    for (const auto &[extension, info] : spirvExtensions) {
+        bool has_support = false;
+        if (info.version) {
+            has_support = api_version >= info.version;
+        } else if (info.feature) {
+            has_support = info.feature.IsEnabled(enabled_features);
+        } else if (info.extension) {
+            has_support = IsExtEnabled(device_extensions.*(info.extension));
+        }
+        if (has_support) {
+            supported_spirv_extensions.set(GetSpirvExtensionIndex(extension));
         }
-    } else if (insn.Opcode() == spv::OpExtension) {
-        static const std::string spv_prefix = "SPV_";
-        std::string extension_name = insn.GetAsString(1);
+    }
+}
 
-        if (0 == extension_name.compare(0, spv_prefix.size(), spv_prefix)) {
-            if (spirvExtensions.count(extension_name) == 0) {
-                const char *vuid =
-                    pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08741" : "VUID-VkShaderCreateInfoEXT-pCode-08741";
-                skip |= LogError(vuid, device, loc, "SPIR-V Extension %s was declared, but that is not supported by Vulkan.",
-                                 extension_name.c_str());
-                return skip;  // no known extension to validate
-            }
+bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(const spirv::Module &module_state, const Location &loc) const {
+    bool skip = false;
+    const auto &static_data = module_state.static_data_;
+
+    // A capability or extension that is not supported by Vulkan has no bit, it is never supported
+    bool unknown = false;
+    SpirvCapabilityBits capabilities;
+    for (const spv::Capability capability : static_data.capability_list) {
+        const uint32_t index = GetSpirvCapabilityIndex(capability);
+        if (index == vvl::kNoIndex32) {
+            unknown = true;
         } else {
-            const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08741" : "VUID-VkShaderCreateInfoEXT-pCode-08741";
-            skip |= LogError(vuid, device, loc,
-                             "SPIR-V Extension %s was declared, but this is not a SPIR-V extension. Please use a SPIR-V"
-                             " extension (https://github.com/KhronosGroup/SPIRV-Registry) for OpExtension instructions. Non-SPIR-V "
-                             "extensions can be"
-                             " recorded in SPIR-V using the OpSourceExtension instruction.",
-                             extension_name.c_str());
-            return skip;  // no known extension to validate
+            capabilities.set(index);
         }
+    }
+    SpirvExtensionBits extensions;
+    for (const spirv::Instruction *insn : static_data.extension_inst) {
+        const uint32_t index = GetSpirvExtensionIndex(insn->GetAsString(1));
+        if (index == vvl::kNoIndex32) {
+            unknown = true;
+        } else {
+            extensions.set(index);
+        }
+    }
 
-        // Each SPIR-V Extension has one or more requirements to check
-        // Only one item has to be satisfied and an error only occurs
-        // when all are not satisfied
-        auto ext = spirvExtensions.equal_range(extension_name);
-        bool has_support = false;
-        for (auto it = ext.first; (it != ext.second) && (has_support == false); ++it) {
-            if (it->second.version) {
-                if (api_version >= it->second.version) {
-                    has_support = true;
-                }
-            } else if (it->second.feature) {
-                if (it->second.feature.IsEnabled(enabled_features)) {
-                    has_support = true;
-                }
-            } else if (it->second.extension) {
-                if (IsExtEnabled(device_extensions.*(it->second.extension))) {
-                    has_support = true;
-                }
-            }
+    // The portability subset can remove support for a capability the requirements give
+    const bool portability_check = IsExtEnabled(device_extensions.vk_khr_portability_subset) &&
+                                   (VK_FALSE == enabled_features.shaderSampleRateInterpolationFunctions);
+
+    // Usual case, everything the module declares is supported
+    if (!unknown && !portability_check && (capabilities & ~supported_spirv_capabilities).none() &&
+        (extensions & ~supported_spirv_extensions).none()) {
+        return skip;
+    }
+
+    // Walk the declarations to report which ones are not supported
+    for (const spv::Capability capability : static_data.capability_list) {
+        skip |= ValidateShaderCapability(capability, loc);
+    }
+    for (const spirv::Instruction *insn : static_data.extension_inst) {
+        skip |= ValidateShaderExtension(insn->GetAsString(1), loc);
+    }
+    return skip;
+}
+
+bool CoreChecks::ValidateShaderCapability(uint32_t capability, const Location &loc) const {
+    bool skip = false;
+    const bool pipeline = loc.function != vvl::Func::vkCreateShadersEXT;
+
+    // All capabilities are generated so if it is not in the list it is not supported by Vulkan
+    const uint32_t index = GetSpirvCapabilityIndex(capability);
+    if (index == vvl::kNoIndex32) {
+        const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08739" : "VUID-VkShaderCreateInfoEXT-pCode-08739";
+        skip |= LogError(vuid, device, loc, "SPIR-V has Capability (%s) declared, but this is not supported by Vulkan.",
+                         string_SpvCapability(capability));
+        return skip;  // no known capability to validate
+    }
+
+    if (!supported_spirv_capabilities[index]) {
+        const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08740" : "VUID-VkShaderCreateInfoEXT-pCode-08740";
+        skip |= LogError(vuid, device, loc,
+                         "SPIR-V Capability %s was declared, but one of the following requirements is required (%s).",
+                         string_SpvCapability(capability), SpvCapabilityRequirements(capability));
+    }
+
+    // Portability checks
+    if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
+        if ((VK_FALSE == enabled_features.shaderSampleRateInterpolationFunctions) &&
+            (spv::CapabilityInterpolationFunction == capability)) {
+            skip |= LogError("VUID-RuntimeSpirv-shaderSampleRateInterpolationFunctions-06325", device, loc,
+                             "SPIR-V (portability error) InterpolationFunction Capability are not supported "
+                             "by this platform");
         }
+    }
+    return skip;
+}
 
-        if (has_support == false) {
-            const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08742" : "VUID-VkShaderCreateInfoEXT-pCode-08742";
-            skip |= LogError(vuid, device, loc,
-                             "SPIR-V Extension %s was declared, but one of the following requirements is required (%s).",
-                             extension_name.c_str(), SpvExtensionRequirments(extension_name).c_str());
+bool CoreChecks::ValidateShaderExtension(const std::string &extension_name, const Location &loc) const {
+    bool skip = false;
+    const bool pipeline = loc.function != vvl::Func::vkCreateShadersEXT;
+    static const std::string spv_prefix = "SPV_";
+
+    const uint32_t index = GetSpirvExtensionIndex(extension_name);
+    if (0 == extension_name.compare(0, spv_prefix.size(), spv_prefix)) {
+        if (index == vvl::kNoIndex32) {
+            const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08741" : "VUID-VkShaderCreateInfoEXT-pCode-08741";
+            skip |= LogError(vuid, device, loc, "SPIR-V Extension %s was declared, but that is not supported by Vulkan.",
+                             extension_name.c_str());
+            return skip;  // no known extension to validate
         }
-    }  // spv::OpExtension
+    } else {
+        const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08741" : "VUID-VkShaderCreateInfoEXT-pCode-08741";
+        skip |= LogError(vuid, device, loc,
+                         "SPIR-V Extension %s was declared, but this is not a SPIR-V extension. Please use a SPIR-V"
+                         " extension (https://github.com/KhronosGroup/SPIRV-Registry) for OpExtension instructions. Non-SPIR-V "
+                         "extensions can be"
+                         " recorded in SPIR-V using the OpSourceExtension instruction.",
+                         extension_name.c_str());
+        return skip;  // no known extension to validate
+    }
+
+    if (!supported_spirv_extensions[index]) {
+        const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08742" : "VUID-VkShaderCreateInfoEXT-pCode-08742";
+        skip |= LogError(vuid, device, loc,
+                         "SPIR-V Extension %s was declared, but one of the following requirements is required (%s).",
+                         extension_name.c_str(), SpvExtensionRequirments(extension_name).c_str());
+    }
     return skip;
 }
 // NOLINTEND
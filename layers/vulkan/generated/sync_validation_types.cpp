@@ -24,7 +24,7 @@
 #include "sync_validation_types.h"
 // clang-format off
 const std::array<SyncStageAccessInfoType, 137>& syncStageAccessInfoByStageAccessIndex() {
-static const std::array<SyncStageAccessInfoType, 137> variable = { {
+static constexpr std::array<SyncStageAccessInfoType, 137> variable = { {
     {
         "SYNC_ACCESS_INDEX_NONE",
         VK_PIPELINE_STAGE_2_NONE_KHR,
@@ -987,8 +987,8 @@ static const std::array<SyncStageAccessInfoType, 137> variable = { {
 }};
 return variable;
 }
-const std::map<VkPipelineStageFlags2, SyncStageAccessFlags>& syncStageAccessMaskByStageBit() {
-    static const std::map<VkPipelineStageFlags2, SyncStageAccessFlags> variable = {
+vvl::span<const std::pair<VkPipelineStageFlags2, SyncStageAccessFlags>> syncStageAccessMaskByStageBit() {
+    static constexpr std::array<std::pair<VkPipelineStageFlags2, SyncStageAccessFlags>, 35> variable = {{
     { VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, (
         SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ_BIT |
         SYNC_DRAW_INDIRECT_TRANSFORM_FEEDBACK_COUNTER_READ_BIT_EXT
@@ -1193,12 +1193,12 @@ const std::map<VkPipelineStageFlags2, SyncStageAccessFlags>& syncStageAccessMask
         SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_ACQUIRE_READ_BIT_SYNCVAL |
         SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_PRESENTED_BIT_SYNCVAL
     )},
-    };
+    }};
     return variable;
 }
 
-const std::map<VkAccessFlags2, SyncStageAccessFlags>& syncStageAccessMaskByAccessBit() {
-    static const std::map<VkAccessFlags2, SyncStageAccessFlags> variable = {
+vvl::span<const std::pair<VkAccessFlags2, SyncStageAccessFlags>> syncStageAccessMaskByAccessBit() {
+    static constexpr std::array<std::pair<VkAccessFlags2, SyncStageAccessFlags>, 42> variable = {{
     { VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT, (
         SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ_BIT |
         SYNC_ACCELERATION_STRUCTURE_BUILD_INDIRECT_COMMAND_READ_BIT
@@ -1265,6 +1265,12 @@ const std::map<VkAccessFlags2, SyncStageAccessFlags>& syncStageAccessMaskByAcces
     { VK_ACCESS_2_HOST_WRITE_BIT, (
         SYNC_HOST_HOST_WRITE_BIT
     )},
+    { VK_ACCESS_2_MEMORY_READ_BIT, (
+        syncStageAccessReadMask
+    )},
+    { VK_ACCESS_2_MEMORY_WRITE_BIT, (
+        syncStageAccessWriteMask
+    )},
     { VK_ACCESS_2_COMMAND_PREPROCESS_READ_BIT_NV, (
         SYNC_COMMAND_PREPROCESS_BIT_NV_COMMAND_PREPROCESS_READ_BIT_NV
     )},
@@ -1413,13 +1419,7 @@ const std::map<VkAccessFlags2, SyncStageAccessFlags>& syncStageAccessMaskByAcces
     { VK_ACCESS_2_PRESENT_PRESENTED_BIT_SYNCVAL, (
         SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_PRESENTED_BIT_SYNCVAL
     )},
-    { VK_ACCESS_2_MEMORY_READ_BIT, (
-        syncStageAccessReadMask
-    )},
-    { VK_ACCESS_2_MEMORY_WRITE_BIT, (
-        syncStageAccessWriteMask
-    )},
-    };
+    }};
     return variable;
 }
 
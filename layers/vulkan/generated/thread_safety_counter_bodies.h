@@ -30,21 +30,21 @@ WRAPPER(VkFence)
 WRAPPER(VkDeviceMemory)
 WRAPPER(VkEvent)
 WRAPPER(VkQueryPool)
-WRAPPER(VkBufferView)
-WRAPPER(VkImageView)
-WRAPPER(VkShaderModule)
+WRAPPER_IMMUTABLE(VkBufferView)
+WRAPPER_IMMUTABLE(VkImageView)
+WRAPPER_IMMUTABLE(VkShaderModule)
 WRAPPER(VkPipelineCache)
-WRAPPER(VkPipelineLayout)
-WRAPPER(VkPipeline)
-WRAPPER(VkRenderPass)
-WRAPPER(VkDescriptorSetLayout)
-WRAPPER(VkSampler)
+WRAPPER_IMMUTABLE(VkPipelineLayout)
+WRAPPER_IMMUTABLE(VkPipeline)
+WRAPPER_IMMUTABLE(VkRenderPass)
+WRAPPER_IMMUTABLE(VkDescriptorSetLayout)
+WRAPPER_IMMUTABLE(VkSampler)
 WRAPPER(VkDescriptorSet)
 WRAPPER(VkDescriptorPool)
-WRAPPER(VkFramebuffer)
+WRAPPER_IMMUTABLE(VkFramebuffer)
 WRAPPER(VkCommandPool)
-WRAPPER(VkSamplerYcbcrConversion)
-WRAPPER(VkDescriptorUpdateTemplate)
+WRAPPER_IMMUTABLE(VkSamplerYcbcrConversion)
+WRAPPER_IMMUTABLE(VkDescriptorUpdateTemplate)
 WRAPPER(VkPrivateDataSlot)
 WRAPPER_PARENT_INSTANCE(VkSurfaceKHR)
 WRAPPER(VkSwapchainKHR)
@@ -69,7 +69,7 @@ WRAPPER(VkBufferCollectionFUCHSIA)
 #endif  // VK_USE_PLATFORM_FUCHSIA
 WRAPPER(VkMicromapEXT)
 WRAPPER(VkOpticalFlowSessionNV)
-WRAPPER(VkShaderEXT)
+WRAPPER_IMMUTABLE(VkShaderEXT)
 // clang-format on
 
 // NOLINTEND
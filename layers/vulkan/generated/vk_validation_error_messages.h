@@ -23,7 +23,7 @@
 
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID
 typedef struct _vuid_spec_text_pair {
     const char * vuid;
     const char * spec_text;
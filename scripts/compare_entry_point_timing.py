@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares two reports written by the entry_point_timing setting (its default JSON format, not CHROME_TRACE).
+#
+# Both reports are expected to come from the same API stream, for example the same GFXReconstruct capture replayed
+# with two builds of the layer. See docs/layer_performance.md
+import argparse
+import json
+import sys
+
+# (function, object, phase) -> entry
+def LoadReport(path: str) -> dict:
+    with open(path, 'r', encoding='utf-8') as f:
+        report = json.load(f)
+    entries = {}
+    for entry in report['entry_points']:
+        entries[(entry['function'], entry['object'], entry['phase'])] = entry
+    return entries
+
+def FormatNs(nanoseconds: float) -> str:
+    if nanoseconds >= 1e9:
+        return f'{nanoseconds / 1e9:.2f}s'
+    if nanoseconds >= 1e6:
+        return f'{nanoseconds / 1e6:.2f}ms'
+    if nanoseconds >= 1e3:
+        return f'{nanoseconds / 1e3:.2f}us'
+    return f'{nanoseconds:.0f}ns'
+
+def main(argv: list) -> int:
+    parser = argparse.ArgumentParser(description='Compare two entry point timing reports of the validation layer')
+    parser.add_argument('baseline', help='Report of the reference build')
+    parser.add_argument('current', help='Report of the build being measured')
+    parser.add_argument('--top', type=int, default=30, help='Number of rows to print, sorted by the change of total time')
+    parser.add_argument('--group-by', choices=['entry', 'function', 'object'], default='entry',
+                        help='Sum the rows of each function or each validation object instead of printing each phase')
+    parser.add_argument('--threshold', type=float, default=None,
+                        help='Exit with an error if the total layer time grew by more than this percentage')
+    args = parser.parse_args(argv)
+
+    baseline = LoadReport(args.baseline)
+    current = LoadReport(args.current)
+
+    def GroupKey(key: tuple) -> tuple:
+        if args.group_by == 'function':
+            return (key[0],)
+        if args.group_by == 'object':
+            return (key[1],)
+        return key
+
+    # group -> [baseline total, current total, baseline count, current count]
+    groups = {}
+    for source, index in [(baseline, 0), (current, 1)]:
+        for key, entry in source.items():
+            group = groups.setdefault(GroupKey(key), [0, 0, 0, 0])
+            group[index] += entry['total_ns']
+            group[index + 2] += entry['count']
+
+    rows = sorted(groups.items(), key=lambda item: abs(item[1][1] - item[1][0]), reverse=True)
+    out = []
+    out.append(f'{"entry":<72} {"baseline":>10} {"current":>10} {"change":>8} {"calls":>18}\n')
+    for group, (base_ns, cur_ns, base_count, cur_count) in rows[:args.top]:
+        change = f'{(cur_ns - base_ns) * 100.0 / base_ns:+.1f}%' if base_ns else 'new'
+        calls = f'{base_count}' if base_count == cur_count else f'{base_count} -> {cur_count}'
+        out.append(f'{" ".join(group):<72} {FormatNs(base_ns):>10} {FormatNs(cur_ns):>10} {change:>8} {calls:>18}\n')
+
+    base_total = sum(group[0] for group in groups.values())
+    cur_total = sum(group[1] for group in groups.values())
+    total_change = (cur_total - base_total) * 100.0 / base_total if base_total else 0.0
+    out.append(f'\ntotal layer time: {FormatNs(base_total)} -> {FormatNs(cur_total)} ({total_change:+.1f}%)\n')
+    if sum(group[2] for group in groups.values()) != sum(group[3] for group in groups.values()):
+        out.append('warning: the call counts differ, the reports may not come from the same API stream\n')
+    sys.stdout.write(''.join(out))
+
+    if args.threshold is not None and total_change > args.threshold:
+        print(f'error: total layer time grew by more than {args.threshold}%')
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
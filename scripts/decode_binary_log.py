@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Renders a log file written with the message_format_binary_log setting as the text log it replaces.
+#
+# The format is described in layers/error_message/log_file_writer.cpp
+import argparse
+import struct
+import sys
+
+MAGIC = b'VVLBLOG\0'
+VERSION = 1
+
+RECORD_STRING = 1
+RECORD_RESET_STRINGS = 2
+RECORD_MESSAGE = 3
+
+NO_STRING = 0xFFFFFFFF
+
+# Same as PrintMessageSeverity and PrintMessageType of layers/vk_layer_config.cpp
+SEVERITIES = [(0x1, 'VERBOSE'), (0x10, 'INFO'), (0x100, 'WARN'), (0x1000, 'ERROR')]
+TYPES = [(0x1, 'GEN'), (0x2, 'SPEC'), (0x4, 'PERF')]
+
+def FormatFlags(flags: int, names: list) -> str:
+    return ','.join(name for bit, name in names if flags & bit)
+
+# std::hex with std::showbase, which doesn't prefix 0
+def FormatHandle(handle: int) -> str:
+    return f'{handle:#x}' if handle else '0'
+
+class Reader:
+    def __init__(self, data: bytes):
+        self.data = data
+        self.offset = 0
+
+    def AtEnd(self) -> bool:
+        return self.offset >= len(self.data)
+
+    def Read(self, fmt: str):
+        values = struct.unpack_from('<' + fmt, self.data, self.offset)
+        self.offset += struct.calcsize('<' + fmt)
+        return values
+
+    def ReadBytes(self, size: int) -> bytes:
+        if self.offset + size > len(self.data):
+            raise struct.error('truncated string')
+        value = self.data[self.offset:self.offset + size]
+        self.offset += size
+        return value
+
+def Decode(data: bytes, out) -> int:
+    if data[:len(MAGIC)] != MAGIC:
+        print('Not a binary validation layer log', file=sys.stderr)
+        return 1
+    reader = Reader(data)
+    reader.offset = len(MAGIC)
+    version, = reader.Read('I')
+    if version != VERSION:
+        print(f'Unsupported binary log version {version}', file=sys.stderr)
+        return 1
+
+    strings = []
+    def String(index: int) -> str:
+        return 'NULL' if index == NO_STRING else strings[index]
+
+    try:
+        while not reader.AtEnd():
+            record, = reader.Read('B')
+            if record == RECORD_STRING:
+                size, = reader.Read('I')
+                strings.append(reader.ReadBytes(size).decode('utf-8', errors='replace'))
+            elif record == RECORD_RESET_STRINGS:
+                strings = []
+            elif record == RECORD_MESSAGE:
+                severity, message_type, message_id, vuid, message, object_count = reader.Read('IIiIII')
+                out.write(f'{String(vuid)}({FormatFlags(severity, SEVERITIES)} / {FormatFlags(message_type, TYPES)}): '
+                          f'msgNum: {message_id} - {String(message)}\n')
+                out.write(f'    Objects: {object_count}\n')
+                for obj in range(object_count):
+                    handle, object_type, name = reader.Read('QII')
+                    out.write(f'        [{obj}] {FormatHandle(handle)}, type: {object_type}, name: {String(name)}\n')
+            else:
+                print(f'Unknown record {record} at offset {reader.offset - 1}', file=sys.stderr)
+                return 1
+    except struct.error:
+        # The last record can be cut if the process was killed while writing it
+        print(f'Truncated record at offset {reader.offset}', file=sys.stderr)
+        return 1
+    return 0
+
+def main(argv: list) -> int:
+    parser = argparse.ArgumentParser(description='Decode a binary log of the validation layer to text')
+    parser.add_argument('log', help='Log file written with message_format_binary_log')
+    parser.add_argument('-o', '--output', help='Text file to write, stdout by default')
+    args = parser.parse_args(argv)
+
+    with open(args.log, 'rb') as f:
+        data = f.read()
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as out:
+            return Decode(data, out)
+    return Decode(data, sys.stdout)
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -263,7 +263,7 @@ def GenerateSpecErrorMessage(api : str, valid_usage_json : str, out_file : str):
 
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID
 typedef struct _vuid_spec_text_pair {{
     const char * vuid;
     const char * spec_text;
@@ -54,6 +54,7 @@ class BestPracticesOutputGenerator(BaseGenerator):
         }
         # Commands that have a manually written post-call-record step which needs to be called from the autogen'd fcn
         self.manual_postcallrecord_list = [
+            'vkAllocateMemory',
             'vkAllocateDescriptorSets',
             'vkQueuePresentKHR',
             'vkQueueBindSparse',
@@ -66,7 +66,10 @@ class CommandValidationOutputGenerator(BaseGenerator):
 
             enum CMD_SCOPE_TYPE { CMD_SCOPE_INSIDE, CMD_SCOPE_OUTSIDE, CMD_SCOPE_BOTH };
 
+            using Func = vvl::Func;
+
             struct CommandValidationInfo {
+                Func function;
                 const char* recording_vuid;
                 const char* buffer_level_vuid;
 
@@ -78,14 +81,23 @@ class CommandValidationOutputGenerator(BaseGenerator):
 
                 CMD_SCOPE_TYPE video_coding;
                 const char* video_coding_vuid;
-            };
 
-            using Func = vvl::Func;
+                // The CommandScopeBits a command buffer needs for none of the checks above to fail
+                CommandScopeFlags required_scope;
+            };
             ''')
+        # Sorted like vvl::Func so the table is indexed by the function
+        commands = sorted([x for x in self.vk.commands.values() if x.name.startswith('vkCmd')], key=lambda x: x.name)
+        # The only commands allowed in a subpass recorded with secondary command buffers
+        secondary_contents_commands = ['vkCmdExecuteCommands', 'vkCmdNextSubpass', 'vkCmdNextSubpass2', 'vkCmdNextSubpass2KHR',
+                                       'vkCmdEndRenderPass', 'vkCmdEndRenderPass2', 'vkCmdEndRenderPass2KHR']
         out.append('// clang-format off\n')
-        out.append('static const vvl::unordered_map<Func, CommandValidationInfo> kCommandValidationTable {\n')
-        for command in [x for x in self.vk.commands.values() if x.name.startswith('vkCmd')]:
-            out.append(f'{{Func::{command.name}, {{\n')
+        out.append(f'static const std::array<CommandValidationInfo, {len(commands)}> kCommandValidationTable {{{{\n')
+        for command in commands:
+            required_scope = ['kCommandScopeRecording']
+            if command.name not in secondary_contents_commands:
+                required_scope.append('kCommandScopeInlineContents')
+            out.append(f'{{Func::{command.name},\n')
             # recording_vuid
             alias_name = command.name if command.alias is None else command.alias
             vuid = getVUID(self.valid_vuids, f'VUID-{alias_name}-commandBuffer-recording')
@@ -102,6 +114,8 @@ class CommandValidationOutputGenerator(BaseGenerator):
                 # Hard to predict what might change, so will error out instead if assumption breaks
                 print('cmdbufferlevel attribute was and not known, need to update generation code')
                 sys.exit(1)
+            if not command.secondary:
+                required_scope.append('kCommandScopePrimary')
 
             # queue_flags / queue_vuid
             queue_flags = []
@@ -124,9 +138,11 @@ class CommandValidationOutputGenerator(BaseGenerator):
             if command.renderPass is CommandScope.INSIDE:
                 renderPassType = 'CMD_SCOPE_INSIDE'
                 vuid = getVUID(self.valid_vuids, f'VUID-{alias_name}-renderpass')
+                required_scope.append('kCommandScopeInsideRenderPass')
             elif command.renderPass is CommandScope.OUTSIDE:
                 renderPassType = 'CMD_SCOPE_OUTSIDE'
                 vuid = getVUID(self.valid_vuids, f'VUID-{alias_name}-renderpass')
+                required_scope.append('kCommandScopeOutsideRenderPass')
             out.append(f'    {renderPassType}, {vuid},\n')
 
             # video_coding / video_coding_vuid
@@ -135,14 +151,33 @@ class CommandValidationOutputGenerator(BaseGenerator):
             if command.videoCoding is CommandScope.INSIDE:
                 videoCodingType = 'CMD_SCOPE_INSIDE'
                 vuid = getVUID(self.valid_vuids, f'VUID-{alias_name}-videocoding')
+                required_scope.append('kCommandScopeInsideVideoCoding')
             elif command.videoCoding is CommandScope.OUTSIDE or command.videoCoding is CommandScope.NONE:
                 videoCodingType = 'CMD_SCOPE_OUTSIDE'
                 vuid = getVUID(self.valid_vuids, f'VUID-{alias_name}-videocoding')
+                required_scope.append('kCommandScopeOutsideVideoCoding')
             out.append(f'    {videoCodingType}, {vuid},\n')
 
-            out.append('}},\n')
-        out.append('};\n')
+            # required_scope
+            out.append(f'    {" | ".join(required_scope)},\n')
+            out.append('},\n')
+        out.append('}};\n')
         out.append('// clang-format on\n')
+        out.append(f'''
+            // The vkCmd* functions are contiguous in vvl::Func, the table is indexed from the first one
+            static constexpr uint32_t kFirstCommandFunc = static_cast<uint32_t>(Func::{commands[0].name});
+            static_assert(static_cast<uint32_t>(Func::{commands[-1].name}) - kFirstCommandFunc + 1 == {len(commands)},
+                          "vkCmd* functions are not contiguous in vvl::Func");
+
+            static const CommandValidationInfo* GetCommandValidationInfo(Func function) {{
+                const uint32_t index = static_cast<uint32_t>(function) - kFirstCommandFunc;
+                if (index >= kCommandValidationTable.size()) {{
+                    return nullptr;
+                }}
+                assert(kCommandValidationTable[index].function == function);
+                return &kCommandValidationTable[index];
+            }}
+            ''')
 
         #
         # The main function to validate all the commands
@@ -154,11 +189,19 @@ class CommandValidationOutputGenerator(BaseGenerator):
             bool CoreChecks::ValidateCmd(const vvl::CommandBuffer& cb_state, const Location& loc) const {
                 bool skip = false;
 
-                auto info_it = kCommandValidationTable.find(loc.function);
-                if (info_it == kCommandValidationTable.end()) {
+                const CommandValidationInfo* info_ptr = GetCommandValidationInfo(loc.function);
+                if (!info_ptr) {
                     assert(false);
+                    return skip;
+                }
+                const auto& info = *info_ptr;
+
+                // Nearly every command is valid for the state it is recorded in, that is one mask test and only the failing
+                // commands go through the checks below, which report what the problem is
+                assert(cb_state.GetCommandScope() == cb_state.ComputeCommandScope());
+                if ((info.required_scope & ~cb_state.GetCommandScope()) == 0 && (info.queue_flags & cb_state.GetQueueFlags()) != 0) {
+                    return skip;
                 }
-                const auto& info = info_it->second;
 
                 // Validate the given command being added to the specified cmd buffer,
                 // flagging errors if CB is not in the recording state or if there's an issue with the Cmd ordering
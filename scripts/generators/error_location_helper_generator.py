@@ -131,6 +131,7 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         for bitmask in sorted(self.vk.bitmasks.values()):
             out.append(f'    {bitmask.name},\n')
         out.append('};\n')
+        out.append(f'constexpr size_t kFlagBitmaskCount = static_cast<size_t>(FlagBitmask::{sorted(self.vk.bitmasks.values())[-1].name}) + 1;\n')
 
         out.append('\n')
         out.append('// Need underscore prefix to not conflict with namespace, but still easy to match generation\n')
@@ -47,6 +47,8 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             'vkDestroyDescriptorPool',
             'vkAllocateDescriptorSets',
             'vkFreeDescriptorSets',
+            # Unwraps into per-thread scratch arrays instead of deep copying every write
+            'vkUpdateDescriptorSets',
             'vkCreateDescriptorUpdateTemplate',
             'vkCreateDescriptorUpdateTemplateKHR',
             'vkDestroyDescriptorUpdateTemplate',
@@ -166,6 +168,9 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             class ValidationObject;
             void WrapPnextChainHandles(ValidationObject *layer_data, const void *pNext);
 
+            // True for the vkCmd* commands that have no handle to unwrap, their dispatch function only calls down the chain
+            bool IsDownChainOnlyDispatch(const char *name);
+
             ''')
         guard_helper = PlatformGuardHelper()
         for command in self.vk.commands.values():
@@ -242,6 +247,7 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             }
         ''')
 
+        down_chain_only_commands = []
         for command in [x for x in self.vk.commands.values() if x.name not in self.no_autogen_list]:
             out.extend(guard_helper.add_guard(command.protect))
 
@@ -305,6 +311,8 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             down_chain_call_only = False
             if not api_decls and not api_pre and not api_post:
                 down_chain_call_only = True
+                if command.name.startswith('vkCmd'):
+                    down_chain_only_commands.append(command.name)
 
             prototype = command.cPrototype[:-1]
             prototype = prototype.replace("VKAPI_ATTR ", "")
@@ -357,6 +365,15 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             out.append('}\n')
         out.extend(guard_helper.add_guard(None))
 
+        out.append('''
+            bool IsDownChainOnlyDispatch(const char *name) {
+                static const vvl::unordered_set<std::string_view> down_chain_only_commands = {
+            ''')
+        out.extend([f'"{name}",\n' for name in down_chain_only_commands])
+        out.append('};\n')
+        out.append('return down_chain_only_commands.count(name) != 0;\n')
+        out.append('}\n')
+
         self.write("".join(out))
 
     #
@@ -125,7 +125,7 @@ class APISpecific:
 void ValidationObject::InitObjectDispatchVectors() {
 
 #define BUILD_DISPATCH_VECTOR(name) \\
-    init_object_dispatch_vector(InterceptId ## name, \\
+    init_object_dispatch_vector(InterceptId ## name, #name, \\
                                 typeid(&ValidationObject::name), \\
                                 typeid(&ThreadSafety::name), \\
                                 typeid(&StatelessValidation::name), \\
@@ -137,6 +137,7 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&SyncValidator::name));
 
     auto init_object_dispatch_vector = [this](InterceptId id,
+                                              const char* hook,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
                                               const std::type_info& tpv_typeid,
@@ -148,30 +149,33 @@ void ValidationObject::InitObjectDispatchVectors() {
                                               const std::type_info& tsv_typeid) {
         for (auto item : this->object_dispatch) {
             auto intercept_vector = &this->intercept_vectors[id];
+            const auto push_if_needed = [item, intercept_vector, hook]() {
+                if (item->IsInterceptNeeded(hook)) intercept_vector->push_back(item);
+            };
             switch (item->container_type) {
             case LayerObjectTypeThreading:
-                if (tt_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tt_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeParameterValidation:
-                if (tpv_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tpv_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeObjectTracker:
-                if (tot_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tot_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeCoreValidation:
-                if (tcv_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tcv_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeBestPractices:
-                if (tbp_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tbp_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeGpuAssisted:
-                if (tga_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tga_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeDebugPrintf:
-                if (tdp_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tdp_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeSyncValidation:
-                if (tsv_typeid != vo_typeid) intercept_vector->push_back(item);
+                if (tsv_typeid != vo_typeid) push_if_needed();
                 break;
             case LayerObjectTypeInstance:
             case LayerObjectTypeDevice:
@@ -228,6 +232,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
         'vkGetPhysicalDeviceToolPropertiesEXT',
     ]
 
+    # Heavy entry points whose PreCallValidate hooks can run in parallel when parallel validation is enabled
+    # Note: vkCreateGraphicsPipelines is a manual function and handles this itself
+    parallel_validate_functions = [
+        'vkQueueSubmit',
+        'vkQueueSubmit2',
+        'vkQueueSubmit2KHR',
+    ]
+
     def __init__(self):
         BaseGenerator.__init__(self)
 
@@ -307,31 +319,22 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_layer_config.h"
             #include "layer_options.h"
             #include "containers/custom_containers.h"
+            #include "containers/handle_table.h"
             #include "error_message/logging.h"
             #include "error_message/error_location.h"
             #include "error_message/record_object.h"
             #include "vk_object_types.h"
             #include "utils/vk_layer_extension_utils.h"
             #include "utils/vk_layer_utils.h"
+            #include "utils/worker_pool.h"
             #include "vk_dispatch_table_helper.h"
             #include "vk_extension_helper.h"
             #include "gpu/core/gpu_settings.h"
             #include "sync/sync_settings.h"
-
-            extern std::atomic<uint64_t> global_unique_id;
-
-            // To avoid re-hashing unique ids on each use, we precompute the hash and store the
-            // hash's LSBs in the high 24 bits.
-            struct HashedUint64 {
-                static const int HASHED_UINT64_SHIFT = 40;
-                size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-                static uint64_t hash(uint64_t id) {
-                    uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-                    id |= h << HASHED_UINT64_SHIFT;
-                    return id;
-                }
-            };
+            #include "core_checks/cc_settings.h"
+            #include "chassis/entry_point_timing.h"
+            #include "chassis/memory_report.h"
+            #include "chassis/check_telemetry.h"
 
             namespace chassis {
                 struct CreateGraphicsPipelines;
@@ -353,7 +356,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             // Each chassis layer will need to track its own state
             using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-            extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            extern vvl::HandleTable unique_id_mapping;
 
             VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);\n
             ''')
@@ -414,6 +417,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 std::vector<std::vector<ValidationObject*>> intercept_vectors;
+                // Commands whose hooks are all overridden by the same validation object, or by none, indexed by the PreCallValidate
+                // InterceptId of the command. The vkCmd* entry points call that object directly instead of looping intercept_vectors.
+                struct SingleIntercept {
+                    ValidationObject* object = nullptr;
+                    bool pre_call_validate = false;
+                    bool pre_call_record = false;
+                    bool post_call_record = false;
+                };
+                std::vector<SingleIntercept> single_intercepts;
 
                 VkLayerInstanceDispatchTable instance_dispatch_table;
                 VkLayerDispatchTable device_dispatch_table;
@@ -423,9 +435,25 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 CHECK_DISABLED disabled = {};
                 CHECK_ENABLED enabled = {};
                 bool fine_grained_locking{true};
+                // Zero means as many threads as the system has cores
+                uint32_t parallel_validation_thread_count = 0;
                 GpuAVSettings gpuav_settings = {};
                 DebugPrintfSettings printf_settings = {};
                 SyncValSettings syncval_settings = {};
+                CoreChecksSettings core_settings = {};
+                EntryPointTimingSettings entry_point_timing_settings = {};
+                // Created with the device when parallel validation is enabled, shared by the device object and all its validation objects
+                std::shared_ptr<vvl::WorkerPool> validation_worker_pool;
+                // Only set on the device object, when entry point timing is enabled
+                std::unique_ptr<EntryPointTimings> entry_point_timings;
+                // Created with the device when the memory report is enabled, shared by the device object and all its validation objects
+                std::shared_ptr<vvl::MemoryReport> memory_report;
+                // Set on the instance object that installed the VkAllocationCallbacks of vkCreateInstance for the layer arenas
+                bool installed_allocation_callbacks = false;
+                // Created with the device when the frame budget is enabled, shared by the device object and all its validation objects
+                std::shared_ptr<vvl::FrameBudget> frame_budget;
+                // Created with the device when the check telemetry is enabled, shared by the device object and all its validation objects
+                std::shared_ptr<vvl::CheckTelemetry> check_telemetry;
 
                 VkInstance instance = VK_NULL_HANDLE;
                 VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -450,11 +478,28 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 virtual ~ValidationObject(){};
 
                 void InitObjectDispatchVectors();
+                // Built from intercept_vectors, once they are final and again when an object is released
+                void InitSingleIntercepts();
+                // Called by InitObjectDispatchVectors() for every hook the object overrides, with the hook name (PreCallValidateCmdDraw).
+                // Returning false leaves the object out of the intercept vector of the hook, for overrides with nothing to do under the
+                // runtime enables and disables of this device (e.g. the query checks when query validation is disabled).
+                virtual bool IsInterceptNeeded(std::string_view hook) const { return true; }
 
                 mutable std::shared_mutex validation_object_mutex;
                 virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
                 virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+                // Estimated host memory of the state tracked by this object, see chassis/memory_report.h
+                virtual void AddMemoryUsage(vvl::MemoryUsage& usage) const {}
+                void SampleMemoryUsage() const {
+                    vvl::MemoryUsage usage;
+                    AddMemoryUsage(usage);
+                    memory_report->Record(container_type, usage);
+                }
+
+                // False if a check that is sampled past the frame budget must be skipped, see chassis/frame_budget.h
+                bool SampleBudgetedCheck(uint64_t sample_key) const { return !frame_budget || frame_budget->ShouldValidate(sample_key); }
+
                 // If the Record phase calls a function that blocks, we might need to release
                 // the lock that protects Record itself in order to avoid mutual waiting.
                 static thread_local WriteLockGuard* record_guard;
@@ -508,10 +553,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ValidationObjectType* GetValidationObject() const;
 
                 // Debug Logging Helpers
+                // Lets validation skip an expensive check when the message it would log is muted anyway
+                bool IsMessageMuted(std::string_view vuid_text, VkFlags msg_flags = kErrorBit) const {
+                    return debug_report->IsMessageMuted(msg_flags, vuid_text);
+                }
+
                 bool DECORATE_PRINTF(5, 6)
                     LogError(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
                     va_start(argptr, format);
+                    if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
                     const bool result = debug_report->LogMsg(kErrorBit, objlist, &loc, vuid_text, format, argptr);
                     va_end(argptr);
                     return result;
@@ -521,6 +572,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool DECORATE_PRINTF(5, 6) LogUndefinedValue(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
                     va_start(argptr, format);
+                    if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
                     const bool result = debug_report->LogMsg(kWarningBit, objlist, &loc, vuid_text, format, argptr);
                     va_end(argptr);
                     return result;
@@ -529,6 +581,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool DECORATE_PRINTF(5, 6) LogWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
                     va_start(argptr, format);
+                    if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
                     const bool result = debug_report->LogMsg(kWarningBit, objlist, &loc, vuid_text, format, argptr);
                     va_end(argptr);
                     return result;
@@ -537,6 +590,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool DECORATE_PRINTF(5, 6) LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
                     va_start(argptr, format);
+                    if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
                     const bool result = debug_report->LogMsg(kPerformanceWarningBit, objlist, &loc, vuid_text, format, argptr);
                     va_end(argptr);
                     return result;
@@ -545,6 +599,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool DECORATE_PRINTF(5, 6) LogInfo(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
                     va_start(argptr, format);
+                    if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
                     const bool result = debug_report->LogMsg(kInformationBit, objlist, &loc, vuid_text, format, argptr);
                     va_end(argptr);
                     return result;
@@ -553,6 +608,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool DECORATE_PRINTF(5, 6) LogVerbose(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const {
                     va_list argptr;
                     va_start(argptr, format);
+                    if (check_telemetry) check_telemetry->RecordVuid(vuid_text);
                     const bool result = debug_report->LogMsg(kVerboseBit, objlist, &loc, vuid_text, format, argptr);
                     va_end(argptr);
                     return result;
@@ -584,7 +640,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 // Map of wrapped descriptor pools to set of wrapped descriptor sets allocated from each pool
                 vvl::unordered_map<VkDescriptorPool, vvl::unordered_set<VkDescriptorSet>> pool_descriptor_sets_map;
 
-                // Unwrap a handle.
+                // Unwrap a handle. The unique ID is a slot index and generation of unique_id_mapping, so this is an indexed load even for
+                // the handle arrays of vkCmdBindDescriptorSets and friends, and a stale or invalid ID finds a mismatched generation
+                // instead of reading a freed record (which a pointer used as the unique ID would do).
                 template <typename HandleType>
                 HandleType Unwrap(HandleType wrapped_handle) {
                     if (wrapped_handle == (HandleType)VK_NULL_HANDLE) return wrapped_handle;
@@ -597,10 +655,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 template <typename HandleType>
                 HandleType WrapNew(HandleType new_created_handle) {
                     if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-                    auto unique_id = global_unique_id++;
-                    unique_id = HashedUint64::hash(unique_id);
+                    // The unique ID encodes the slot of the handle table, Unwrap() is a wait-free indexed load
+                    const uint64_t unique_id = unique_id_mapping.Insert(CastToUint64(new_created_handle));
                     assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-                    unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
                     return (HandleType)unique_id;
                 }
 
@@ -744,16 +801,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "layer_chassis_dispatch.h"
             #include "state_tracker/descriptor_sets.h"
             #include "chassis/chassis_modification_state.h"
+            #include "utils/arena_allocator.h"
 
             thread_local WriteLockGuard* ValidationObject::record_guard{};
 
             small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
-            // Global unique object identifier.
-            std::atomic<uint64_t> global_unique_id(1ULL);
-            // Map uniqueID to actual object handle. Accesses to the map itself are
-            // internally synchronized.
-            vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            // Map uniqueID to actual object handle. Accesses to the table itself are
+            // internally synchronized, lookups are lock-free.
+            vvl::HandleTable unique_id_mapping;
 
             // State we track in order to populate HandleData for things such as ignored pointers
             static vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
@@ -863,6 +919,32 @@ class LayerChassisOutputGenerator(BaseGenerator):
             template ObjectLifetimes* ValidationObject::GetValidationObject<ObjectLifetimes>() const;
             template CoreChecks* ValidationObject::GetValidationObject<CoreChecks>() const;
 
+            void ValidationObject::InitSingleIntercepts() {
+                // Sized once, so that a release only rewrites the entries in place
+                single_intercepts.resize(InterceptIdCount);
+                // The hooks of a command are consecutive: PreCallValidate, PreCallRecord, PostCallRecord
+                for (uint32_t id = 0; id + 2 < InterceptIdCount; id += 3) {
+                    SingleIntercept single;
+                    bool is_single = true;
+                    for (uint32_t hook = id; hook < id + 3 && is_single; ++hook) {
+                        const auto& intercepts = intercept_vectors[hook];
+                        if (intercepts.size() > 1 || (intercepts.size() == 1 && single.object && single.object != intercepts[0])) {
+                            is_single = false;
+                        } else if (intercepts.size() == 1) {
+                            single.object = intercepts[0];
+                        }
+                    }
+                    if (is_single && single.object) {
+                        single.pre_call_validate = !intercept_vectors[id].empty();
+                        single.pre_call_record = !intercept_vectors[id + 1].empty();
+                        single.post_call_record = !intercept_vectors[id + 2].empty();
+                    } else {
+                        single = SingleIntercept{};
+                    }
+                    single_intercepts[id] = single;
+                }
+            }
+
             // Takes the layer and removes it from the chassis so it will not be called anymore
             void ValidationObject::ReleaseDeviceDispatchObject(LayerObjectTypeId type_id) const {
                 auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
@@ -883,6 +965,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                             }
                         }
 
+                        layer_data->InitSingleIntercepts();
+
                         // We can't destroy the object itself now as it might be unsafe (things are still being used)
                         // If the rare case happens we need to release, we will cleanup later when we normally would have cleaned this up
                         layer_data->aborted_object_dispatch.push_back(object);
@@ -905,6 +989,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
             typedef struct {
                 ApiFunctionType function_type;
                 void* funcptr;
+                // The PreCallValidate id of the vkCmd* commands, the PreCallRecord and PostCallRecord ids follow it
+                InterceptId intercept_id = InterceptIdCount;
             } function_data;
 
             extern const vvl::unordered_map<std::string, function_data> name_to_funcptr_map;
@@ -1024,9 +1110,17 @@ class LayerChassisOutputGenerator(BaseGenerator):
                         layer_data->LogWarning("WARNING-vkGetDeviceProcAddr-device", device, loc.dot(vvl::Field::pName),
                                                "is trying to grab %s which is an instance level function", funcName);
                         return nullptr;
-                    } else {
-                        return reinterpret_cast<PFN_vkVoidFunction>(item->second.funcptr);
                     }
+                    // The intercept vectors are final once the device is created. When no validation object wants a command, and its
+                    // handles don't need unwrapping, the application can call the next layer directly instead of going through the chassis.
+                    const InterceptId id = item->second.intercept_id;
+                    if (id != InterceptIdCount && layer_data->intercept_vectors[id].empty() && layer_data->intercept_vectors[id + 1].empty() &&
+                        layer_data->intercept_vectors[id + 2].empty() && (!wrap_handles || IsDownChainOnlyDispatch(funcName))) {
+                        auto& table = layer_data->device_dispatch_table;
+                        if (!table.GetDeviceProcAddr) return nullptr;
+                        return table.GetDeviceProcAddr(device, funcName);
+                    }
+                    return reinterpret_cast<PFN_vkVoidFunction>(item->second.funcptr);
                 }
                 auto& table = layer_data->device_dispatch_table;
                 if (!table.GetDeviceProcAddr) return nullptr;
@@ -1111,9 +1205,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 CHECK_ENABLED local_enables{};
                 CHECK_DISABLED local_disables{};
                 bool lock_setting;
+                uint32_t local_parallel_validation_thread_count = 0;
                 GpuAVSettings local_gpuav_settings = {};
                 DebugPrintfSettings local_printf_settings = {};
                 SyncValSettings local_syncval_settings = {};
+                CoreChecksSettings local_core_settings = {};
+                EntryPointTimingSettings local_entry_point_timing_settings = {};
                 ConfigAndEnvSettings config_and_env_settings_data{OBJECT_LAYER_DESCRIPTION,
                                                                 pCreateInfo,
                                                                 local_enables,
@@ -1122,12 +1219,19 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                 &debug_report->duplicate_message_limit,
                                                                 &debug_report->message_format_settings,
                                                                 &lock_setting,
+                                                                &local_parallel_validation_thread_count,
                                                                 &local_gpuav_settings,
                                                                 &local_printf_settings,
-                                                                &local_syncval_settings};
+                                                                &local_syncval_settings,
+                                                                &local_core_settings,
+                                                                &local_entry_point_timing_settings};
                 ProcessConfigAndEnvSettings(&config_and_env_settings_data);
                 LayerDebugMessengerActions(debug_report, OBJECT_LAYER_DESCRIPTION);
 
+                // The layer arenas allocate from the callbacks of the first instance asking for it, until that instance is destroyed
+                const bool installed_allocation_callbacks = pAllocator && local_entry_point_timing_settings.app_allocation_callbacks &&
+                                                            vvl::arena::InstallAllocationCallbacks(*pAllocator);
+
                 // Create temporary dispatch vector for pre-calls until instance is created
                 std::vector<ValidationObject*> local_object_dispatch = CreateObjectDispatch(local_enables, local_disables);
 
@@ -1143,13 +1247,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 // Define logic to cleanup everything in case of an error
-                auto cleanup_allocations = [debug_report, &local_object_dispatch]() {
+                auto cleanup_allocations = [debug_report, &local_object_dispatch, installed_allocation_callbacks]() {
                     DeactivateInstanceDebugCallbacks(debug_report);
                     vku::FreePnextChain(debug_report->instance_pnext_chain);
                     LayerDebugUtilsDestroyInstance(debug_report);
                     for (ValidationObject* object : local_object_dispatch) {
                         delete object;
                     }
+                    if (installed_allocation_callbacks) {
+                        vvl::arena::RemoveAllocationCallbacks();
+                    }
                 };
 
                 // Init dispatch array and call registration functions
@@ -1183,9 +1290,13 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 framework->disabled = local_disables;
                 framework->enabled = local_enables;
                 framework->fine_grained_locking = lock_setting;
+                framework->parallel_validation_thread_count = local_parallel_validation_thread_count;
                 framework->gpuav_settings = local_gpuav_settings;
                 framework->printf_settings = local_printf_settings;
                 framework->syncval_settings = local_syncval_settings;
+                framework->core_settings = local_core_settings;
+                framework->entry_point_timing_settings = local_entry_point_timing_settings;
+                framework->installed_allocation_callbacks = installed_allocation_callbacks;
 
                 framework->instance = *pInstance;
                 layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1204,9 +1315,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     intercept->enabled = framework->enabled;
                     intercept->disabled = framework->disabled;
                     intercept->fine_grained_locking = framework->fine_grained_locking;
+                    intercept->parallel_validation_thread_count = framework->parallel_validation_thread_count;
                     intercept->gpuav_settings = framework->gpuav_settings;
                     intercept->printf_settings = framework->printf_settings;
                     intercept->syncval_settings = framework->syncval_settings;
+                    intercept->core_settings = framework->core_settings;
                     intercept->instance = *pInstance;
                 }
 
@@ -1228,18 +1341,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     intercept->PreCallValidateDestroyInstance(instance, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyInstance);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
                 // Before instance is destroyed, allow aborted objects to clean up
                 for (ValidationObject* intercept : layer_data->aborted_object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
@@ -1247,6 +1363,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
@@ -1262,7 +1379,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     delete *item;
                 }
 
+                // The validation objects of the instance are deleted, nothing of it uses the callbacks anymore
+                const bool installed_allocation_callbacks = layer_data->installed_allocation_callbacks;
                 FreeLayerDataPtr(key, layer_data_map);
+                if (installed_allocation_callbacks) {
+                    vvl::arena::RemoveAllocationCallbacks();
+                }
             }
 
             VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo* pCreateInfo,
@@ -1345,9 +1467,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     object->disabled = instance_interceptor->disabled;
                     object->enabled = instance_interceptor->enabled;
                     object->fine_grained_locking = instance_interceptor->fine_grained_locking;
+                    object->parallel_validation_thread_count = instance_interceptor->parallel_validation_thread_count;
                     object->gpuav_settings = instance_interceptor->gpuav_settings;
                     object->printf_settings = instance_interceptor->printf_settings;
                     object->syncval_settings = instance_interceptor->syncval_settings;
+                    object->core_settings = instance_interceptor->core_settings;
                     object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
                     object->instance_extensions = instance_interceptor->instance_extensions;
                     object->device_extensions = device_interceptor->device_extensions;
@@ -1360,6 +1484,58 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 device_interceptor->InitObjectDispatchVectors();
+                device_interceptor->InitSingleIntercepts();
+
+                if (instance_interceptor->enabled[parallel_validation]) {
+                    // The calling thread takes part in the work, so the pool has one worker less than the thread count
+                    uint32_t thread_count = instance_interceptor->parallel_validation_thread_count;
+                    if (thread_count == 0) {
+                        thread_count = std::thread::hardware_concurrency();
+                    }
+                    if (thread_count > 1) {
+                        // One pool for the whole process, shared with the other devices
+                        device_interceptor->validation_worker_pool = vvl::WorkerPool::Shared(thread_count - 1);
+                        // Validation objects also use it to split the work of a single call, like a batch of create infos
+                        for (auto* object : device_interceptor->object_dispatch) {
+                            object->validation_worker_pool = device_interceptor->validation_worker_pool;
+                        }
+                    }
+                }
+
+                if (instance_interceptor->entry_point_timing_settings.enabled) {
+                    device_interceptor->entry_point_timings =
+                        std::make_unique<EntryPointTimings>(instance_interceptor->entry_point_timing_settings);
+                }
+                if (instance_interceptor->entry_point_timing_settings.trace_markers) {
+                    vvl::trace::Begin(instance_interceptor->entry_point_timing_settings.trace_file);
+                }
+                if (instance_interceptor->entry_point_timing_settings.lock_contention_report) {
+                    vvl::lock_profile::Begin(instance_interceptor->entry_point_timing_settings.lock_contention_report_file);
+                }
+                if (instance_interceptor->entry_point_timing_settings.memory_report) {
+                    const EntryPointTimingSettings& settings = instance_interceptor->entry_point_timing_settings;
+                    device_interceptor->memory_report =
+                        std::make_shared<vvl::MemoryReport>(settings.memory_report_file, settings.memory_report_interval);
+                    for (auto* object : device_interceptor->object_dispatch) {
+                        object->memory_report = device_interceptor->memory_report;
+                    }
+                }
+                if (instance_interceptor->entry_point_timing_settings.frame_budget_us > 0) {
+                    const EntryPointTimingSettings& settings = instance_interceptor->entry_point_timing_settings;
+                    device_interceptor->frame_budget =
+                        std::make_shared<vvl::FrameBudget>(settings.frame_budget_us, settings.frame_budget_sample_rate);
+                    for (auto* object : device_interceptor->object_dispatch) {
+                        object->frame_budget = device_interceptor->frame_budget;
+                    }
+                }
+                if (instance_interceptor->entry_point_timing_settings.check_telemetry) {
+                    const EntryPointTimingSettings& settings = instance_interceptor->entry_point_timing_settings;
+                    device_interceptor->check_telemetry =
+                        std::make_shared<vvl::CheckTelemetry>(settings.check_telemetry_file, settings.check_telemetry_interval);
+                    for (auto* object : device_interceptor->object_dispatch) {
+                        object->check_telemetry = device_interceptor->check_telemetry;
+                    }
+                }
 
                 DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
 
@@ -1376,18 +1552,29 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkDestroyDevice, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     intercept->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
                 }
 
+                // Last sample, while all the state objects are still around
+                if (layer_data->memory_report) {
+                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                        auto lock = intercept->ReadLock();
+                        intercept->SampleMemoryUsage();
+                    }
+                }
+
                 RecordObject record_obj(vvl::Func::vkDestroyDevice);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 // Before device is destroyed, allow aborted objects to clean up
                 for (ValidationObject* intercept : layer_data->aborted_object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
@@ -1395,11 +1582,28 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
+                if (layer_data->entry_point_timings) {
+                    layer_data->entry_point_timings->WriteReport();
+                }
+                if (layer_data->memory_report) {
+                    layer_data->memory_report->WriteReport();
+                }
+                if (layer_data->check_telemetry) {
+                    layer_data->check_telemetry->WriteReport();
+                }
+
                 auto instance_interceptor = GetLayerDataPtr(GetDispatchKey(layer_data->physical_device), layer_data_map);
                 instance_interceptor->debug_report->device_created--;
+                if (instance_interceptor->entry_point_timing_settings.trace_markers) {
+                    vvl::trace::End();
+                }
+                if (instance_interceptor->entry_point_timing_settings.lock_contention_report) {
+                    vvl::lock_profile::End();
+                }
 
                 for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
                     delete *item;
@@ -1411,6 +1615,29 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 FreeLayerDataPtr(key, layer_data_map);
             }
 
+            // Runs the PreCallValidate hooks of the intercepts on the validation worker pool and combines their skip results.
+            // SyncValidator hands its command state from Validate to Record through thread local storage (vvl::TlsGuard), so it
+            // is always the one validated on the calling thread.
+            template <typename Validate>
+            static bool ParallelPreCallValidate(vvl::WorkerPool& pool, const std::vector<ValidationObject*>& intercepts,
+                                                Validate&& validate) {
+                small_vector<const ValidationObject*, 8> ordered_intercepts;
+                for (const ValidationObject* intercept : intercepts) {
+                    ordered_intercepts.emplace_back(intercept);
+                    if (intercept->container_type == LayerObjectTypeSyncValidation) {
+                        std::swap(ordered_intercepts.front(), ordered_intercepts.back());
+                    }
+                }
+                std::atomic<bool> skip{false};
+                auto task = [&](uint32_t index) {
+                    if (validate(ordered_intercepts[index])) {
+                        skip.store(true, std::memory_order_relaxed);
+                    }
+                };
+                pool.Run(static_cast<uint32_t>(ordered_intercepts.size()), task);
+                return skip.load(std::memory_order_relaxed);
+            }
+
             // Special-case APIs for which core_validation needs custom parameter lists and/or modifies parameters
 
             VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
@@ -1423,16 +1650,31 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 PipelineStates pipeline_states[LayerObjectTypeMaxEnum];
                 chassis::CreateGraphicsPipelines chassis_state(pCreateInfos);
 
-                for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
-                    skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
-                                                                            pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
+                if (layer_data->validation_worker_pool) {
+                    // Each validation object only touches its own pipeline_states entry
+                    skip = ParallelPreCallValidate(*layer_data->validation_worker_pool, layer_data->object_dispatch,
+                                                   [&](const ValidationObject* intercept) {
+                                                       auto lock = intercept->ReadLock();
+                                                       EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
+                                                       return intercept->PreCallValidateCreateGraphicsPipelines(
+                                                           device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
+                                                           error_obj, pipeline_states[intercept->container_type], chassis_state);
+                                                   });
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                } else {
+                    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                        auto lock = intercept->ReadLock();
+                        EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
+                        skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                                                                pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
+                        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                    }
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateGraphicsPipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1443,6 +1685,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1462,6 +1705,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1470,6 +1714,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateComputePipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                 pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1480,6 +1725,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1498,6 +1744,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |=
                         intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
@@ -1507,6 +1754,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesNV);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1517,6 +1765,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1536,6 +1785,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                                 pCreateInfos, pAllocator, pPipelines, error_obj,
                                                                                 pipeline_states[intercept->container_type], chassis_state);
@@ -1545,6 +1795,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesKHR);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         pipeline_states[intercept->container_type], chassis_state);
@@ -1557,6 +1808,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         pipeline_states[intercept->container_type], chassis_state);
@@ -1573,6 +1825,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineLayout]) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1583,6 +1836,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreatePipelineLayout);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj, chassis_state);
                 }
 
@@ -1591,6 +1845,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineLayout]) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
                 }
                 return result;
@@ -1605,6 +1860,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1615,6 +1871,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateShaderModule);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                 }
 
@@ -1626,6 +1883,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                 }
                 return result;
@@ -1646,6 +1904,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1653,6 +1912,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateShadersEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj, chassis_state);
                 }
 
@@ -1664,6 +1924,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                             chassis_state);
                 }
@@ -1681,6 +1942,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, error_obj,
                                                                             ads_state[intercept->container_type]);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1689,6 +1951,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkAllocateDescriptorSets);
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateDescriptorSets]) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
                 }
 
@@ -1697,6 +1960,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj,
                                                                     ads_state[intercept->container_type]);
                 }
@@ -1712,6 +1976,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBuffer]) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1722,6 +1987,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkCreateBuffer);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, chassis_state);
                 }
 
@@ -1730,6 +1996,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBuffer]) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
                 }
                 return result;
@@ -1748,6 +2015,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                     &handle_data);
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1755,6 +2023,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkBeginCommandBuffer, &handle_data);
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                 }
 
@@ -1763,6 +2032,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                 }
                 return result;
@@ -1796,6 +2066,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1804,6 +2075,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1818,6 +2090,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1840,6 +2113,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->ReadLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1848,6 +2122,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolProperties);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                     intercept->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1862,6 +2137,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
                     auto lock = intercept->WriteLock();
+                    EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
                     intercept->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1921,6 +2197,42 @@ class LayerChassisOutputGenerator(BaseGenerator):
             # Setup common to call wrappers. First parameter is always dispatchable
             out.append(f'auto layer_data = GetLayerDataPtr(GetDispatchKey({command.params[0].name}), layer_data_map);\n')
 
+            # When no validation object is interested in a command, after the runtime enables and disables were applied to the
+            # intercept vectors, it goes straight down the chain. When a single one is, it is called without the intercept loops.
+            if command.name.startswith('vkCmd') and command.returnType == 'void':
+                out.append(f'''
+                    if (layer_data->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}].empty() &&
+                        layer_data->intercept_vectors[InterceptIdPreCallRecord{command.name[2:]}].empty() &&
+                        layer_data->intercept_vectors[InterceptIdPostCallRecord{command.name[2:]}].empty()) {{
+                        {command.name.replace("vk", "Dispatch")}({paramsList});
+                        return;
+                    }}
+                    const auto& single = layer_data->single_intercepts[InterceptIdPreCallValidate{command.name[2:]}];
+                    if (single.object) {{
+                        ValidationObject* intercept = single.object;
+                        ErrorObject error_obj(vvl::Func::{command.name}, VulkanTypedHandle({command.params[0].name}, kVulkanObjectType{command.params[0].type[2:]}));
+                        if (single.pre_call_validate) {{
+                            auto lock = intercept->ReadLock();
+                            EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
+                            const bool skip = intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                            if (skip) return;
+                        }}
+                        RecordObject record_obj(vvl::Func::{command.name});
+                        if (single.pre_call_record) {{
+                            auto lock = intercept->WriteLock();
+                            EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
+                            intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
+                        }}
+                        {command.name.replace("vk", "Dispatch")}({paramsList});
+                        if (single.post_call_record) {{
+                            auto lock = intercept->WriteLock();
+                            EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);
+                            intercept->PostCallRecord{command.name[2:]}({paramsList}, record_obj);
+                        }}
+                        return;
+                    }}
+                    ''')
+
             # Declare result variable, if any.
             return_map = {
                 'PFN_vkVoidFunction': 'return nullptr;',
@@ -1939,15 +2251,31 @@ class LayerChassisOutputGenerator(BaseGenerator):
             out.append(f'ErrorObject error_obj(vvl::Func::{command.name}, VulkanTypedHandle({command.params[0].name}, kVulkanObjectType{command.params[0].type[2:]}));\n')
 
             # Generate pre-call validation source code
+            parallel_validate = command.name in self.parallel_validate_functions
+            if parallel_validate:
+                out.append(f'''
+                    if (layer_data->validation_worker_pool) {{
+                        skip = ParallelPreCallValidate(*layer_data->validation_worker_pool,
+                                                       layer_data->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}],
+                                                       [&](const ValidationObject* intercept) {{
+                                                           auto lock = intercept->ReadLock();
+                                                           EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
+                                                           return intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                                                       }});
+                        if (skip) {return_map[command.returnType]}
+                    }} else {{\n''')
             if not command.instance:
                 out.append(f'for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{\n')
             else:
                 out.append('for (const ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
                 auto lock = intercept->ReadLock();
+                EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallValidate, error_obj);
                     skip |= intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
                     if (skip) {return_map[command.returnType]}
                 }}\n''')
+            if parallel_validate:
+                out.append('}\n')
 
             # Generate pre-call state recording source code
             out.append(f'RecordObject record_obj(vvl::Func::{command.name});\n')
@@ -1957,6 +2285,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 out.append('for (ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
                 auto lock = intercept->WriteLock();
+                EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PreCallRecord, record_obj);
                 intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
             }}\n''')
 
@@ -1986,6 +2315,17 @@ class LayerChassisOutputGenerator(BaseGenerator):
             if command.name in post_dispatch_debug_utils_functions:
                 out.append(f'    {post_dispatch_debug_utils_functions[command.name]}\n')
 
+            # Frame boundary of the frame budget, the present itself is counted in the frame that ends
+            if command.name == 'vkQueuePresentKHR':
+                out.append('''
+                    if (layer_data->frame_budget) {
+                        layer_data->frame_budget->EndFrame(*layer_data, queue, error_obj.location);
+                    }
+                    if (layer_data->check_telemetry) {
+                        layer_data->check_telemetry->EndFrame();
+                    }
+                ''')
+
             if command.returnType == 'VkResult':
                 out.append('record_obj.result = result;\n')
             elif command.returnType == 'VkDeviceAddress':
@@ -2013,6 +2353,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             if command.name not in commands_with_blocking_operations:
                 out.append('auto lock = intercept->WriteLock();\n')
+                # Blocking calls are not timed, the wait would dominate the measurement
+                out.append('EntryPointTimer timer(*layer_data, *intercept, EntryPointPhase::PostCallRecord, record_obj);\n')
             else:
                 out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
 
@@ -2079,7 +2421,10 @@ const vvl::unordered_map<std::string, function_data> name_to_funcptr_map = {
 ''')
         for command in [x for x in self.vk.commands.values() if x.name not in self.ignore_functions]:
             out.extend(guard_helper.add_guard(command.protect))
-            out.append(f'    {{"{command.name}", {{{self.getApiFunctionType(command)}, (void*){command.name[2:]}}}}},\n')
+            if command.name.startswith('vkCmd') and command.returnType == 'void' and command.name not in self.manual_functions:
+                out.append(f'    {{"{command.name}", {{{self.getApiFunctionType(command)}, (void*){command.name[2:]}, InterceptIdPreCallValidate{command.name[2:]}}}}},\n')
+            else:
+                out.append(f'    {{"{command.name}", {{{self.getApiFunctionType(command)}, (void*){command.name[2:]}}}}},\n')
         out.extend(guard_helper.add_guard(None))
         out.append('};\n')
         out.append('} // namespace vulkan_layer_chassis\n')
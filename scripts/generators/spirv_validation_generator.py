@@ -32,6 +32,7 @@ class SpirvValidationHelperOutputGenerator(BaseGenerator):
         # Get the list of safe enum values to use from the SPIR-V grammar
         self.capabilityList = []
         self.capabilityAliasList = []
+        self.capabilityValues = dict()
         with open(grammar) as grammar_file:
             grammar_dict = json.load(grammar_file)
         for kind in grammar_dict['operand_kinds']:
@@ -44,6 +45,7 @@ class SpirvValidationHelperOutputGenerator(BaseGenerator):
                     if enum['value'] in enum_values:
                         self.capabilityAliasList.append(enum['enumerant'])
                     self.capabilityList.append(enum['enumerant'])
+                    self.capabilityValues[enum['enumerant']] = enum['value']
                     enum_values.add(enum['value'])
                 break
 
@@ -300,44 +302,73 @@ static inline std::string SpvExtensionRequirments(std::string_view extension) {
             sys.exit(1)
 
         #
-        # The main function to validate all the extensions and capabilities
-        out.append('''
-            bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(const spirv::Instruction &insn,  const Location& loc) const {
-                bool skip = false;
-                const bool pipeline = loc.function != vvl::Func::vkCreateShadersEXT;
+        # Dense index of every capability and extension with requirements, the bits of the supported sets of CoreChecks.
+        # Aliases share the index of their value, as they share their entries in spirvCapabilities
+        capabilityIndices = dict()
+        valueIndices = dict()
+        for spirv in [x for x in self.vk.spirv if x.capability and x.name in self.capabilityList]:
+            if len([x for x in spirv.enable if x.struct is None or x.struct not in self.promotedFeatures]) == 0:
+                continue
+            value = self.capabilityValues[spirv.name]
+            if value not in valueIndices:
+                valueIndices[value] = len(valueIndices)
+                capabilityIndices[spirv.name] = valueIndices[value]
+        extensionIndices = dict()
+        for spirv in [x for x in self.vk.spirv if x.extension]:
+            if spirv.name not in extensionIndices:
+                extensionIndices[spirv.name] = len(extensionIndices)
 
-                if (insn.Opcode() == spv::OpCapability) {
-                    // All capabilities are generated so if it is not in the list it is not supported by Vulkan
-                    if (spirvCapabilities.count(insn.Word(1)) == 0) {
-                        const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08739" : "VUID-VkShaderCreateInfoEXT-pCode-08739";
-                        skip |= LogError(vuid, device, loc,
-                            "SPIR-V has Capability (%s) declared, but this is not supported by Vulkan.", string_SpvCapability(insn.Word(1)));
-                        return skip; // no known capability to validate
-                    }
+        out.append(f'''
+// Dense index of the capabilities and extensions that have requirements, their bit in the supported sets of CoreChecks
+static constexpr uint32_t kSpirvCapabilityCount = {len(valueIndices)};
+static constexpr uint32_t kSpirvExtensionCount = {len(extensionIndices)};
+static_assert(kSpirvCapabilityCount <= CoreChecks::kMaxSpirvCapabilities, "CoreChecks::SpirvCapabilityBits is too small");
+static_assert(kSpirvExtensionCount <= CoreChecks::kMaxSpirvExtensions, "CoreChecks::SpirvExtensionBits is too small");
+
+// clang-format off
+// Returns vvl::kNoIndex32 if the capability is not supported by Vulkan
+static uint32_t GetSpirvCapabilityIndex(uint32_t capability) {{
+    switch (capability) {{
+''')
+        for name, index in capabilityIndices.items():
+            out.append(f'        case spv::Capability{name}: return {index};\n')
+        out.append('''        default: return vvl::kNoIndex32;
+    }
+}
+
+// Interns the name of an OpExtension, returns vvl::kNoIndex32 if the extension is not supported by Vulkan
+static uint32_t GetSpirvExtensionIndex(std::string_view extension) {
+    static const vvl::unordered_map<std::string_view, uint32_t> table {
+''')
+        for name, index in extensionIndices.items():
+            out.append(f'    {{"{name}", {index}}},\n')
+        out.append('''    };
 
-                    // Each capability has one or more requirements to check
-                    // Only one item has to be satisfied and an error only occurs
-                    // when all are not satisfied
-                    auto caps = spirvCapabilities.equal_range(insn.Word(1));
+    const auto entry = table.find(extension);
+    return entry != table.end() ? entry->second : vvl::kNoIndex32;
+}
+// clang-format on
+''')
+
+        #
+        # The requirements only depend on the device, they are checked once when it is created
+        out.append('''
+            void CoreChecks::InitSpirvSupport() {
+                // Each capability has one or more requirements to check
+                // Only one item has to be satisfied for the capability to be supported
+                for (const auto &[capability, info] : spirvCapabilities) {
                     bool has_support = false;
-                    for (auto it = caps.first; (it != caps.second) && (has_support == false); ++it) {
-                        if (it->second.version) {
-                            if (api_version >= it->second.version) {
-                                has_support = true;
-                            }
-                        } else if (it->second.feature) {
-                            if (it->second.feature.IsEnabled(enabled_features)) {
-                                has_support = true;
-                            }
-                        } else if (it->second.extension) {
-                            // kEnabledByApiLevel is not valid as some extension are promoted with feature bits to be used.
-                            // If the new Api Level gives support, it will be caught in the "it->second.version" check instead.
-                            if (IsExtEnabledByCreateinfo(device_extensions.*(it->second.extension))) {
-                                has_support = true;
-                            }
-                        } else if (it->second.property) {
-                            // support is or'ed as only one has to be supported (if applicable)
-                            switch (insn.Word(1)) {''')
+                    if (info.version) {
+                        has_support = api_version >= info.version;
+                    } else if (info.feature) {
+                        has_support = info.feature.IsEnabled(enabled_features);
+                    } else if (info.extension) {
+                        // kEnabledByApiLevel is not valid as some extension are promoted with feature bits to be used.
+                        // If the new Api Level gives support, it will be caught in the "info.version" check instead.
+                        has_support = IsExtEnabledByCreateinfo(device_extensions.*(info.extension));
+                    } else if (info.property) {
+                        // support is or'ed as only one has to be supported (if applicable)
+                        switch (capability) {''')
 
         for name, infos in sorted(self.propertyInfo.items()):
             # Only capabilities here (all items in array are the same)
@@ -346,46 +377,130 @@ static inline std::string SpvExtensionRequirments(std::string_view extension) {
 
             # use triple-tick syntax to keep tab alignment for generated code
             out.append(f'''
-                    case spv::Capability{name}:''')
+                case spv::Capability{name}:''')
             for info in infos:
                 # Need to string replace property string to create valid C++ logic
                 logic = info['logic'].replace('::', '.')
                 logic = logic.replace(info['struct'], self.propertyMap[info['struct']])
                 out.append(f'''
-                        has_support |= ({logic});''')
+                    has_support |= ({logic});''')
             out.append('''
-                        break;''')
+                    break;''')
 
         out.append('''
-                        default:
-                            break;
+                            default:
+                                break;
+                        }
+                    }
+                    if (has_support) {
+                        supported_spirv_capabilities.set(GetSpirvCapabilityIndex(capability));
+                    }
+                }
+
+                // Same for each SPIR-V Extension
+                for (const auto &[extension, info] : spirvExtensions) {
+                    bool has_support = false;
+                    if (info.version) {
+                        has_support = api_version >= info.version;
+                    } else if (info.feature) {
+                        has_support = info.feature.IsEnabled(enabled_features);
+                    } else if (info.extension) {
+                        has_support = IsExtEnabled(device_extensions.*(info.extension));
+                    }
+                    if (has_support) {
+                        supported_spirv_extensions.set(GetSpirvExtensionIndex(extension));
                     }
                 }
             }
             ''')
 
+        #
+        # The main function to validate all the extensions and capabilities
         out.append('''
-                if (has_support == false) {
+            bool CoreChecks::ValidateShaderCapabilitiesAndExtensions(const spirv::Module &module_state, const Location &loc) const {
+                bool skip = false;
+                const auto &static_data = module_state.static_data_;
+
+                // A capability or extension that is not supported by Vulkan has no bit, it is never supported
+                bool unknown = false;
+                SpirvCapabilityBits capabilities;
+                for (const spv::Capability capability : static_data.capability_list) {
+                    const uint32_t index = GetSpirvCapabilityIndex(capability);
+                    if (index == vvl::kNoIndex32) {
+                        unknown = true;
+                    } else {
+                        capabilities.set(index);
+                    }
+                }
+                SpirvExtensionBits extensions;
+                for (const spirv::Instruction *insn : static_data.extension_inst) {
+                    const uint32_t index = GetSpirvExtensionIndex(insn->GetAsString(1));
+                    if (index == vvl::kNoIndex32) {
+                        unknown = true;
+                    } else {
+                        extensions.set(index);
+                    }
+                }
+
+                // The portability subset can remove support for a capability the requirements give
+                const bool portability_check = IsExtEnabled(device_extensions.vk_khr_portability_subset) &&
+                                               (VK_FALSE == enabled_features.shaderSampleRateInterpolationFunctions);
+
+                // Usual case, everything the module declares is supported
+                if (!unknown && !portability_check && (capabilities & ~supported_spirv_capabilities).none() &&
+                    (extensions & ~supported_spirv_extensions).none()) {
+                    return skip;
+                }
+
+                // Walk the declarations to report which ones are not supported
+                for (const spv::Capability capability : static_data.capability_list) {
+                    skip |= ValidateShaderCapability(capability, loc);
+                }
+                for (const spirv::Instruction *insn : static_data.extension_inst) {
+                    skip |= ValidateShaderExtension(insn->GetAsString(1), loc);
+                }
+                return skip;
+            }
+
+            bool CoreChecks::ValidateShaderCapability(uint32_t capability, const Location &loc) const {
+                bool skip = false;
+                const bool pipeline = loc.function != vvl::Func::vkCreateShadersEXT;
+
+                // All capabilities are generated so if it is not in the list it is not supported by Vulkan
+                const uint32_t index = GetSpirvCapabilityIndex(capability);
+                if (index == vvl::kNoIndex32) {
+                    const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08739" : "VUID-VkShaderCreateInfoEXT-pCode-08739";
+                    skip |= LogError(vuid, device, loc,
+                        "SPIR-V has Capability (%s) declared, but this is not supported by Vulkan.", string_SpvCapability(capability));
+                    return skip; // no known capability to validate
+                }
+
+                if (!supported_spirv_capabilities[index]) {
                     const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08740" : "VUID-VkShaderCreateInfoEXT-pCode-08740";
                     skip |= LogError(vuid, device, loc,
-                        "SPIR-V Capability %s was declared, but one of the following requirements is required (%s).", string_SpvCapability(insn.Word(1)), SpvCapabilityRequirements(insn.Word(1)));
+                        "SPIR-V Capability %s was declared, but one of the following requirements is required (%s).", string_SpvCapability(capability), SpvCapabilityRequirements(capability));
                 }
 
                 // Portability checks
                 if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
                     if ((VK_FALSE == enabled_features.shaderSampleRateInterpolationFunctions) &&
-                        (spv::CapabilityInterpolationFunction == insn.Word(1))) {
+                        (spv::CapabilityInterpolationFunction == capability)) {
                         skip |= LogError("VUID-RuntimeSpirv-shaderSampleRateInterpolationFunctions-06325", device, loc,
                                             "SPIR-V (portability error) InterpolationFunction Capability are not supported "
                                             "by this platform");
                     }
                 }
-            } else if (insn.Opcode() == spv::OpExtension) {
+                return skip;
+            }
+
+            bool CoreChecks::ValidateShaderExtension(const std::string &extension_name, const Location &loc) const {
+                bool skip = false;
+                const bool pipeline = loc.function != vvl::Func::vkCreateShadersEXT;
                 static const std::string spv_prefix = "SPV_";
-                std::string extension_name = insn.GetAsString(1);
 
+                const uint32_t index = GetSpirvExtensionIndex(extension_name);
                 if (0 == extension_name.compare(0, spv_prefix.size(), spv_prefix)) {
-                    if (spirvExtensions.count(extension_name) == 0) {
+                    if (index == vvl::kNoIndex32) {
                         const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08741" : "VUID-VkShaderCreateInfoEXT-pCode-08741";
                         skip |= LogError(vuid, device,loc,
                             "SPIR-V Extension %s was declared, but that is not supported by Vulkan.", extension_name.c_str());
@@ -400,34 +515,12 @@ static inline std::string SpvExtensionRequirments(std::string_view extension) {
                     return skip; // no known extension to validate
                 }
 
-                // Each SPIR-V Extension has one or more requirements to check
-                // Only one item has to be satisfied and an error only occurs
-                // when all are not satisfied
-                auto ext = spirvExtensions.equal_range(extension_name);
-                bool has_support = false;
-                for (auto it = ext.first; (it != ext.second) && (has_support == false); ++it) {
-                    if (it->second.version) {
-                        if (api_version >= it->second.version) {
-                            has_support = true;
-                        }
-                    } else if (it->second.feature) {
-                        if (it->second.feature.IsEnabled(enabled_features)) {
-                            has_support = true;
-                        }
-                    } else if (it->second.extension) {
-                        if (IsExtEnabled(device_extensions.*(it->second.extension))) {
-                            has_support = true;
-                        }
-                    }
-                }
-
-                if (has_support == false) {
+                if (!supported_spirv_extensions[index]) {
                     const char *vuid = pipeline ? "VUID-VkShaderModuleCreateInfo-pCode-08742" : "VUID-VkShaderCreateInfoEXT-pCode-08742";
                     skip |= LogError(vuid, device, loc,
                         "SPIR-V Extension %s was declared, but one of the following requirements is required (%s).", extension_name.c_str(), SpvExtensionRequirments(extension_name).c_str());
                 }
-            } //spv::OpExtension
-            return skip;
+                return skip;
             }
             ''')
         out.append('// NOLINTEND') # Wrap for clang-tidy to ignore
@@ -149,10 +149,11 @@ class SyncValidationOutputGenerator(BaseGenerator):
             #pragma once
 
             #include <array>
-            #include <bitset>
             #include <map>
             #include <stdint.h>
+            #include <utility>
             #include <vulkan/vulkan.h>
+            #include "containers/bitset.h"
             #include "containers/custom_containers.h"
             ''')
         out.append('// clang-format off\n')
@@ -181,10 +182,10 @@ static const VkAccessFlagBits2 VK_ACCESS_2_PRESENT_PRESENTED_BIT_SYNCVAL = 0x{(1
         out.append('\n')
 
         syncStageAccessFlagsSize = 192
-        out.append(f'using SyncStageAccessFlags = std::bitset<{syncStageAccessFlagsSize}>;\n')
+        out.append(f'using SyncStageAccessFlags = vvl::bitset<{syncStageAccessFlagsSize}>;\n')
         out.append('// Unique bit for each stage/access combination\n')
         for access in [x for x in self.stageAccessCombo if x['stage_access_bit'] is not None]:
-            out.append(f'static const SyncStageAccessFlags {access["stage_access_bit"]} = (SyncStageAccessFlags(1) << {access["stage_access"]});\n')
+            out.append(f'static constexpr SyncStageAccessFlags {access["stage_access_bit"]} = (SyncStageAccessFlags(1) << {access["stage_access"]});\n')
 
         if len(self.stageAccessCombo) > syncStageAccessFlagsSize:
             print("The bitset is too small, errors will occur, need to increase syncStageAccessFlagsSize\n")
@@ -205,25 +206,25 @@ const std::array<SyncStageAccessInfoType, {len(self.stageAccessCombo)}>& syncSta
 ''')
 
         out.append('// Constants defining the mask of all read and write stage_access states\n')
-        out.append('static const SyncStageAccessFlags syncStageAccessReadMask = ( //  Mask of all read StageAccess bits\n')
+        out.append('static constexpr SyncStageAccessFlags syncStageAccessReadMask = ( //  Mask of all read StageAccess bits\n')
         read_list = [x['stage_access_bit'] for x in self.stageAccessCombo if x['is_read'] is not None and x['is_read'] == 'true']
         out.append('    ')
         out.append(' |\n    '.join(read_list))
         out.append('\n);')
         out.append('\n\n')
 
-        out.append('static const SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all write StageAccess bits\n')
+        out.append('static constexpr SyncStageAccessFlags syncStageAccessWriteMask = ( //  Mask of all write StageAccess bits\n')
         write_list = [x['stage_access_bit'] for x in self.stageAccessCombo if x['is_read'] is not None and x['is_read'] != 'true']
         out.append('    ')
         out.append(' |\n    '.join(write_list))
         out.append('\n);\n')
 
         out.append('''
-// Bit order mask of stage_access bit for each stage
-const std::map<VkPipelineStageFlags2, SyncStageAccessFlags>& syncStageAccessMaskByStageBit();
+// Bit order mask of stage_access bit for each stage, sorted by stage bit
+vvl::span<const std::pair<VkPipelineStageFlags2, SyncStageAccessFlags>> syncStageAccessMaskByStageBit();
 
-// Bit order mask of stage_access bit for each access
-const std::map<VkAccessFlags2, SyncStageAccessFlags>& syncStageAccessMaskByAccessBit();
+// Bit order mask of stage_access bit for each access, sorted by access bit
+vvl::span<const std::pair<VkAccessFlags2, SyncStageAccessFlags>> syncStageAccessMaskByAccessBit();
 
 // Direct VkPipelineStageFlags to valid VkAccessFlags lookup table
 const std::map<VkPipelineStageFlags2, VkAccessFlags2>& syncDirectStageToAccessMask();
@@ -250,7 +251,7 @@ const std::map<VkPipelineStageFlags2, VkPipelineStageFlags2>& syncLogicallyLater
         # syncStageAccessInfoByStageAccessIndex
         out.append('// clang-format off\n')
         out.append(f'const std::array<SyncStageAccessInfoType, {len(self.stageAccessCombo)}>& syncStageAccessInfoByStageAccessIndex() {{\n')
-        out.append(f'static const std::array<SyncStageAccessInfoType, {len(self.stageAccessCombo)}> variable = {{ {{\n')
+        out.append(f'static constexpr std::array<SyncStageAccessInfoType, {len(self.stageAccessCombo)}> variable = {{ {{\n')
         for stageAccess in self.stageAccessCombo:
             out.append(f'''    {{
         {stageAccess["stage_access_string"]},
@@ -265,8 +266,6 @@ const std::map<VkPipelineStageFlags2, VkPipelineStageFlags2>& syncLogicallyLater
         out.append('}\n')
 
         # syncStageAccessMaskByStageBit
-        out.append('const std::map<VkPipelineStageFlags2, SyncStageAccessFlags>& syncStageAccessMaskByStageBit() {\n')
-        out.append('    static const std::map<VkPipelineStageFlags2, SyncStageAccessFlags> variable = {\n')
         stage_to_stageAccess = {}
         for stageAccess_info in self.stageAccessCombo:
             stage = stageAccess_info['stage']
@@ -274,28 +273,33 @@ const std::map<VkPipelineStageFlags2, VkPipelineStageFlags2>& syncLogicallyLater
             stageAccess_bit = stageAccess_info['stage_access_bit']
             stage_to_stageAccess[stage] = stage_to_stageAccess.get(stage, []) + [stageAccess_bit]
         stages_in_bit_order = sorted([x for x in self.vk.bitmasks['VkPipelineStageFlagBits2'].flags], key=lambda x: x.value)
-        for flag in [x for x in stages_in_bit_order if x.name in stage_to_stageAccess]:
+        stage_entries = [x for x in stages_in_bit_order if x.name in stage_to_stageAccess]
+        out.append('vvl::span<const std::pair<VkPipelineStageFlags2, SyncStageAccessFlags>> syncStageAccessMaskByStageBit() {\n')
+        out.append(f'    static constexpr std::array<std::pair<VkPipelineStageFlags2, SyncStageAccessFlags>, {len(stage_entries)}> variable = {{{{\n')
+        for flag in stage_entries:
                 out.append(f'    {{ {flag.name}, (\n        {separator.join(stage_to_stageAccess[flag.name])}\n    )}},\n')
-        out.append('    };\n')
+        out.append('    }};\n')
         out.append('    return variable;\n')
         out.append('}\n\n')
 
         # syncStageAccessMaskByAccessBit
-        out.append('const std::map<VkAccessFlags2, SyncStageAccessFlags>& syncStageAccessMaskByAccessBit() {\n')
-        out.append('    static const std::map<VkAccessFlags2, SyncStageAccessFlags> variable = {\n')
         access_to_stageAccess = {}
         for stageAccess_info in self.stageAccessCombo:
             access = stageAccess_info['access']
             if access == 'VK_ACCESS_2_FLAG_NONE_KHR': continue
             stageAccess_bit = stageAccess_info['stage_access_bit']
             access_to_stageAccess[access] = access_to_stageAccess.get(access, []) + [stageAccess_bit]
+        # In bit order with the others, the lookup stops at the first bit past the mask
+        access_to_stageAccess['VK_ACCESS_2_MEMORY_READ_BIT'] = ['syncStageAccessReadMask']
+        access_to_stageAccess['VK_ACCESS_2_MEMORY_WRITE_BIT'] = ['syncStageAccessWriteMask']
 
         accesses_in_bit_order = sorted([x for x in self.vk.bitmasks['VkAccessFlagBits2'].flags], key=lambda x: x.value)
-        for flag in [x for x in accesses_in_bit_order if x.name in access_to_stageAccess]:
+        access_entries = [x for x in accesses_in_bit_order if x.name in access_to_stageAccess]
+        out.append('vvl::span<const std::pair<VkAccessFlags2, SyncStageAccessFlags>> syncStageAccessMaskByAccessBit() {\n')
+        out.append(f'    static constexpr std::array<std::pair<VkAccessFlags2, SyncStageAccessFlags>, {len(access_entries)}> variable = {{{{\n')
+        for flag in access_entries:
             out.append(f'    {{ {flag.name}, (\n        {separator.join(access_to_stageAccess[flag.name])}\n    )}},\n')
-        out.append('    { VK_ACCESS_2_MEMORY_READ_BIT, (\n        syncStageAccessReadMask\n    )},\n')
-        out.append('    { VK_ACCESS_2_MEMORY_WRITE_BIT, (\n        syncStageAccessWriteMask\n    )},\n')
-        out.append('    };\n')
+        out.append('    }};\n')
         out.append('    return variable;\n')
         out.append('}\n\n')
 
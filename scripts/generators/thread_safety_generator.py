@@ -344,10 +344,21 @@ class ThreadSafetyOutputGenerator(BaseGenerator):
         out = []
         out.append('// clang-format off\n')
         instanceParent = ['VkSurfaceKHR', 'VkDebugReportCallbackEXT', 'VkDebugUtilsMessengerEXT', 'VkDisplayKHR']
+        # Never written after creation, their only externally synchronized command is their destruction
+        immutable_handles = [
+            'VkBufferView', 'VkImageView', 'VkShaderModule', 'VkPipelineLayout', 'VkPipeline', 'VkRenderPass',
+            'VkDescriptorSetLayout', 'VkSampler', 'VkFramebuffer', 'VkSamplerYcbcrConversion', 'VkDescriptorUpdateTemplate',
+            'VkShaderEXT',
+        ]
         guard_helper = PlatformGuardHelper()
         for handle in [x for x in self.vk.handles.values() if not x.dispatchable]:
             out.extend(guard_helper.add_guard(handle.protect))
-            out.extend([f'WRAPPER_PARENT_INSTANCE({handle.name})\n'] if handle.name in instanceParent else [f'WRAPPER({handle.name})\n'])
+            if handle.name in instanceParent:
+                out.append(f'WRAPPER_PARENT_INSTANCE({handle.name})\n')
+            elif handle.name in immutable_handles:
+                out.append(f'WRAPPER_IMMUTABLE({handle.name})\n')
+            else:
+                out.append(f'WRAPPER({handle.name})\n')
         out.extend(guard_helper.add_guard(None))
         out.append('// clang-format on\n')
         self.write("".join(out))
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Micro-benchmarks of the layer containers, the baseline to compare any replacement of them against.
+//
+// The range map sizes follow what they hold in practice: syncval access maps of buffers and images have from a few
+// to several thousand ranges, image layout maps use small_range_map for images of up to 16 subresources.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/range_vector.h"
+
+namespace {
+
+using RangeMap = sparse_container::range_map<uint64_t, uint64_t>;
+using SmallRangeMap = sparse_container::small_range_map<uint64_t, uint64_t, sparse_container::range<uint64_t>, 16>;
+using Range = RangeMap::key_type;
+
+// Same shape as the syncval updaters: a default value for the gaps, existing ranges are updated in place
+template <typename Map>
+struct InfillUpdateOps {
+    uint64_t value;
+    void infill(Map &map, const typename Map::iterator &pos, const typename Map::key_type &range) const {
+        map.insert(pos, std::make_pair(range, value));
+    }
+    void update(const typename Map::iterator &pos) const { pos->second += value; }
+};
+
+// count ranges of length stride, with a gap of the same length between them
+template <typename Map>
+void FillStrided(Map &map, uint64_t count, uint64_t stride) {
+    for (uint64_t i = 0; i < count; ++i) {
+        map.insert(map.end(), std::make_pair(Range(2 * i * stride, 2 * i * stride + stride), i));
+    }
+}
+
+// Shuffled beginnings of the ranges of FillStrided
+std::vector<uint64_t> RandomOffsets(uint64_t count, uint64_t stride) {
+    std::vector<uint64_t> offsets(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        offsets[i] = 2 * i * stride;
+    }
+    std::shuffle(offsets.begin(), offsets.end(), std::mt19937_64(42));
+    return offsets;
+}
+
+void RangeMapInsert(benchmark::State &state) {
+    const uint64_t count = static_cast<uint64_t>(state.range(0));
+    const std::vector<uint64_t> offsets = RandomOffsets(count, 16);
+    for (auto _ : state) {
+        RangeMap map;
+        for (uint64_t offset : offsets) {
+            map.insert(std::make_pair(Range(offset, offset + 16), offset));
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RangeMapInsert)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+void RangeMapLookup(benchmark::State &state) {
+    const uint64_t count = static_cast<uint64_t>(state.range(0));
+    RangeMap map;
+    FillStrided(map, count, 16);
+    const std::vector<uint64_t> offsets = RandomOffsets(count, 16);
+    for (auto _ : state) {
+        for (uint64_t offset : offsets) {
+            benchmark::DoNotOptimize(map.find(offset + 3));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RangeMapLookup)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+void RangeMapIterate(benchmark::State &state) {
+    const uint64_t count = static_cast<uint64_t>(state.range(0));
+    RangeMap map;
+    FillStrided(map, count, 16);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto &[range, value] : map) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RangeMapIterate)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+// Each iteration splits every range of the map in two
+void RangeMapSplit(benchmark::State &state) {
+    const uint64_t count = static_cast<uint64_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        RangeMap map;
+        FillStrided(map, count, 16);
+        state.ResumeTiming();
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            it = map.split(it, it->first.begin + 8, sparse_container::split_op_keep_both());
+            ++it;
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RangeMapSplit)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+// A range covering the whole map: every gap is infilled and every existing range is updated
+void RangeMapInfillUpdate(benchmark::State &state) {
+    const uint64_t count = static_cast<uint64_t>(state.range(0));
+    const InfillUpdateOps<RangeMap> ops{1};
+    for (auto _ : state) {
+        state.PauseTiming();
+        RangeMap map;
+        FillStrided(map, count, 16);
+        state.ResumeTiming();
+        sparse_container::infill_update_range(map, Range(8, 2 * count * 16 - 8), ops);
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RangeMapInfillUpdate)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+// Small overwrites at random places, the pattern of repeated buffer copies and barriers
+void RangeMapOverwrite(benchmark::State &state) {
+    const uint64_t count = static_cast<uint64_t>(state.range(0));
+    RangeMap map;
+    FillStrided(map, count, 16);
+    const std::vector<uint64_t> offsets = RandomOffsets(count, 16);
+    for (auto _ : state) {
+        for (uint64_t offset : offsets) {
+            map.overwrite_range(std::make_pair(Range(offset + 8, offset + 24), offset));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RangeMapOverwrite)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+// Image layout map sized for an image with 16 subresources, rewritten one subresource at a time
+void SmallRangeMapOverwrite(benchmark::State &state) {
+    for (auto _ : state) {
+        SmallRangeMap map(16);
+        map.overwrite_range(std::make_pair(Range(0, 16), uint64_t(0)));
+        for (uint64_t i = 0; i < 16; ++i) {
+            map.overwrite_range(std::make_pair(Range(i, i + 1), i));
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(SmallRangeMapOverwrite);
+
+void SmallRangeMapInfillUpdate(benchmark::State &state) {
+    const InfillUpdateOps<SmallRangeMap> ops{1};
+    for (auto _ : state) {
+        SmallRangeMap map(16);
+        for (uint64_t i = 0; i < 16; i += 4) {
+            map.insert(std::make_pair(Range(i, i + 2), i));
+        }
+        sparse_container::infill_update_range(map, Range(1, 15), ops);
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(SmallRangeMapInfillUpdate);
+
+void SmallRangeMapLookup(benchmark::State &state) {
+    SmallRangeMap map(16);
+    for (uint64_t i = 0; i < 16; ++i) {
+        map.insert(std::make_pair(Range(i, i + 1), i));
+    }
+    for (auto _ : state) {
+        for (uint64_t i = 0; i < 16; ++i) {
+            benchmark::DoNotOptimize(map.find(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(SmallRangeMapLookup);
+
+// Inline capacity of 4, the range covers both the inline and the heap allocated storage
+void SmallVectorPushBack(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        small_vector<uint64_t, 4, uint32_t> vector;
+        for (size_t i = 0; i < count; ++i) {
+            vector.emplace_back(i);
+        }
+        benchmark::DoNotOptimize(vector.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(SmallVectorPushBack)->Arg(2)->Arg(4)->Arg(16)->Arg(256);
+
+void SmallVectorIterate(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    small_vector<uint64_t, 4, uint32_t> vector;
+    for (size_t i = 0; i < count; ++i) {
+        vector.emplace_back(i);
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint64_t value : vector) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(SmallVectorIterate)->Arg(4)->Arg(256);
+
+// Same layout as the object tracker maps. Each thread owns its own keys, inserts, looks them all up and removes them,
+// so the contention is only on the map buckets.
+void ConcurrentMapContention(benchmark::State &state) {
+    static vvl::concurrent_unordered_map<uint64_t, uint64_t, 6> map;
+    constexpr uint64_t kKeysPerThread = 1024;
+    const uint64_t first_key = static_cast<uint64_t>(state.thread_index()) * kKeysPerThread;
+    for (auto _ : state) {
+        for (uint64_t key = first_key; key < first_key + kKeysPerThread; ++key) {
+            map.insert(key, key);
+        }
+        for (uint64_t key = first_key; key < first_key + kKeysPerThread; ++key) {
+            benchmark::DoNotOptimize(map.find(key) != map.end());
+        }
+        for (uint64_t key = first_key; key < first_key + kKeysPerThread; ++key) {
+            map.pop(key);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kKeysPerThread * 3);
+}
+BENCHMARK(ConcurrentMapContention)->ThreadRange(1, 16)->UseRealTime();
+
+// Mostly lookups from every thread on a shared set of keys, like handle lookups of validation objects
+void ConcurrentMapSharedLookup(benchmark::State &state) {
+    static vvl::concurrent_unordered_map<uint64_t, uint64_t, 6> map;
+    constexpr uint64_t kKeyCount = 4096;
+    if (state.thread_index() == 0) {
+        for (uint64_t key = 0; key < kKeyCount; ++key) {
+            map.insert(key, key);
+        }
+    }
+    std::mt19937_64 random(state.thread_index());
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < 1024; ++i) {
+            benchmark::DoNotOptimize(map.contains(random() % kKeyCount));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(ConcurrentMapSharedLookup)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace
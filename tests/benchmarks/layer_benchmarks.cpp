@@ -0,0 +1,741 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// CPU overhead of the validation layer, measured against the test ICD so the driver cost is close to zero.
+//
+// Every workload is registered once per LayerConfig: without the layer, with the layer and every validation object
+// disabled (only the chassis), with each validation object enabled on its own and with all of them.
+
+#include <benchmark/benchmark.h>
+#include <spirv-tools/libspirv.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "generated/vk_function_pointers.h"
+#include "vk_layer_config.h"
+#include CONFIG_HEADER_FILE
+
+namespace {
+
+constexpr const char *kLayerName = "VK_LAYER_KHRONOS_validation";
+
+// The boolean layer settings turning the validation objects on and off
+constexpr const char *kValidationObjectSettings[] = {"validate_core",  "stateless_param", "thread_safety",
+                                                     "object_lifetime", "validate_sync",   "validate_best_practices"};
+
+struct LayerConfig {
+    const char *name;
+    bool use_layer;
+    std::vector<const char *> enabled_objects;
+};
+
+const LayerConfig kLayerConfigs[] = {
+    {"NoLayer", false, {}},
+    {"Chassis", true, {}},
+    {"Core", true, {"validate_core"}},
+    {"Stateless", true, {"stateless_param"}},
+    {"ThreadSafety", true, {"thread_safety"}},
+    {"ObjectLifetime", true, {"object_lifetime"}},
+    {"SyncVal", true, {"validate_sync"}},
+    {"BestPractices", true, {"validate_best_practices"}},
+    {"Default", true, {"validate_core", "stateless_param", "thread_safety", "object_lifetime"}},
+    {"All",
+     true,
+     {"validate_core", "stateless_param", "thread_safety", "object_lifetime", "validate_sync", "validate_best_practices"}},
+};
+
+// Written by the lock_contention_report setting of the layer when the device is destroyed
+constexpr const char *kLockContentionFile = "vvl_benchmark_lock_contention.json";
+
+// Also a (very rough) correctness check, a workload producing messages measures the error paths
+std::atomic<uint64_t> message_count{0};
+
+VKAPI_ATTR VkBool32 VKAPI_CALL CountMessage(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                            const VkDebugUtilsMessengerCallbackDataEXT *, void *) {
+    message_count.fetch_add(1, std::memory_order_relaxed);
+    return VK_FALSE;
+}
+
+constexpr const char *kVertexShader = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Vertex %main "main" %position
+               OpDecorate %position BuiltIn Position
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %vec4 = OpTypeVector %float 4
+   %out_vec4 = OpTypePointer Output %vec4
+   %position = OpVariable %out_vec4 Output
+       %zero = OpConstant %float 0
+  %zero_vec4 = OpConstantComposite %vec4 %zero %zero %zero %zero
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+               OpStore %position %zero_vec4
+               OpReturn
+               OpFunctionEnd
+)";
+
+constexpr const char *kFragmentShader = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %main "main" %color
+               OpExecutionMode %main OriginUpperLeft
+               OpDecorate %color Location 0
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %vec4 = OpTypeVector %float 4
+   %out_vec4 = OpTypePointer Output %vec4
+      %color = OpVariable %out_vec4 Output
+        %one = OpConstant %float 1
+   %one_vec4 = OpConstantComposite %vec4 %one %one %one %one
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+               OpStore %color %one_vec4
+               OpReturn
+               OpFunctionEnd
+)";
+
+constexpr const char *kComputeShader = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+    %void_fn = OpTypeFunction %void
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+               OpReturn
+               OpFunctionEnd
+)";
+
+// One instance and device with the layer set up as described by a LayerConfig. The objects created through the helpers
+// are destroyed with the context. With a lock_contention_file, the layer writes the contention of its locks to it when
+// the context is destroyed.
+class Context {
+  public:
+    explicit Context(const LayerConfig &config, const char *lock_contention_file = nullptr);
+    ~Context();
+    Context(const Context &) = delete;
+    Context &operator=(const Context &) = delete;
+
+    bool IsValid() const { return device != VK_NULL_HANDLE; }
+
+    VkBuffer CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage);
+    VkShaderModule CreateShaderModule(const char *assembly);
+    VkCommandPool CreateCommandPool();
+    std::vector<VkCommandBuffer> AllocateCommandBuffers(VkCommandPool pool, uint32_t count);
+    VkPipelineLayout CreatePipelineLayout(const VkDescriptorSetLayout *set_layout);
+
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queue_family_index = 0;
+
+  private:
+    friend struct DrawTarget;
+    uint32_t FindMemoryType(uint32_t type_bits, VkMemoryPropertyFlags properties) const;
+    VkDeviceMemory AllocateMemory(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties);
+    void OnDestroy(std::function<void()> &&destroy) { destroy_functions_.emplace_back(std::move(destroy)); }
+
+    VkInstance instance_ = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu_ = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties memory_properties_{};
+    // Run in reverse order before the device is destroyed
+    std::vector<std::function<void()>> destroy_functions_;
+};
+
+Context::Context(const LayerConfig &config, const char *lock_contention_file) {
+    std::vector<VkBool32> values(std::size(kValidationObjectSettings), VK_FALSE);
+    std::vector<VkLayerSettingEXT> settings;
+    for (size_t i = 0; i < std::size(kValidationObjectSettings); ++i) {
+        for (const char *enabled : config.enabled_objects) {
+            if (std::string(enabled) == kValidationObjectSettings[i]) {
+                values[i] = VK_TRUE;
+            }
+        }
+        settings.push_back({kLayerName, kValidationObjectSettings[i], VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &values[i]});
+    }
+    const VkBool32 lock_contention_report = VK_TRUE;
+    if (lock_contention_file) {
+        settings.push_back({kLayerName, "lock_contention_report", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &lock_contention_report});
+        settings.push_back({kLayerName, "lock_contention_report_file", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &lock_contention_file});
+    }
+    VkLayerSettingsCreateInfoEXT settings_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT};
+    settings_info.settingCount = static_cast<uint32_t>(settings.size());
+    settings_info.pSettings = settings.data();
+
+    VkDebugUtilsMessengerCreateInfoEXT messenger_info = {VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+    messenger_info.pNext = &settings_info;
+    messenger_info.messageSeverity =
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+                                 VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    messenger_info.pfnUserCallback = CountMessage;
+
+    VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app_info.pApplicationName = "vvl_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_2;
+
+    const char *extension = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_info.pApplicationInfo = &app_info;
+    if (config.use_layer) {
+        instance_info.pNext = &messenger_info;
+        instance_info.enabledLayerCount = 1;
+        instance_info.ppEnabledLayerNames = &kLayerName;
+        instance_info.enabledExtensionCount = 1;
+        instance_info.ppEnabledExtensionNames = &extension;
+    }
+    if (vk::CreateInstance(&instance_info, nullptr, &instance_) != VK_SUCCESS) {
+        instance_ = VK_NULL_HANDLE;
+        return;
+    }
+
+    uint32_t gpu_count = 1;
+    if (vk::EnumeratePhysicalDevices(instance_, &gpu_count, &gpu_) < 0 || gpu_count == 0) {
+        return;
+    }
+    vk::GetPhysicalDeviceMemoryProperties(gpu_, &memory_properties_);
+
+    uint32_t queue_family_count = 0;
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu_, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu_, &queue_family_count, queue_families.data());
+    for (uint32_t i = 0; i < queue_family_count; ++i) {
+        if (queue_families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+            queue_family_index = i;
+            break;
+        }
+    }
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueFamilyIndex = queue_family_index;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+
+    // For the bindless descriptor workload
+    VkPhysicalDeviceVulkan12Features features_12 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
+    features_12.descriptorIndexing = VK_TRUE;
+    features_12.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+    features_12.descriptorBindingPartiallyBound = VK_TRUE;
+    features_12.runtimeDescriptorArray = VK_TRUE;
+
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    device_info.pNext = &features_12;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    if (vk::CreateDevice(gpu_, &device_info, nullptr, &device) != VK_SUCCESS) {
+        device = VK_NULL_HANDLE;
+        return;
+    }
+    vk::GetDeviceQueue(device, queue_family_index, 0, &queue);
+}
+
+Context::~Context() {
+    if (device != VK_NULL_HANDLE) {
+        vk::DeviceWaitIdle(device);
+        for (auto it = destroy_functions_.rbegin(); it != destroy_functions_.rend(); ++it) {
+            (*it)();
+        }
+        vk::DestroyDevice(device, nullptr);
+    }
+    if (instance_ != VK_NULL_HANDLE) {
+        vk::DestroyInstance(instance_, nullptr);
+    }
+}
+
+uint32_t Context::FindMemoryType(uint32_t type_bits, VkMemoryPropertyFlags properties) const {
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+        if ((type_bits & (1u << i)) && (memory_properties_.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+VkDeviceMemory Context::AllocateMemory(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties) {
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    vk::AllocateMemory(device, &alloc_info, nullptr, &memory);
+    OnDestroy([this, memory]() { vk::FreeMemory(device, memory, nullptr); });
+    return memory;
+}
+
+VkBuffer Context::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage) {
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = size;
+    buffer_info.usage = usage;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    vk::CreateBuffer(device, &buffer_info, nullptr, &buffer);
+
+    VkMemoryRequirements requirements;
+    vk::GetBufferMemoryRequirements(device, buffer, &requirements);
+    VkDeviceMemory memory = AllocateMemory(requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    vk::BindBufferMemory(device, buffer, memory, 0);
+    // Destroyed before its memory is freed
+    OnDestroy([this, buffer]() { vk::DestroyBuffer(device, buffer, nullptr); });
+    return buffer;
+}
+
+VkShaderModule Context::CreateShaderModule(const char *assembly) {
+    spvtools::SpirvTools tools(SPV_ENV_VULKAN_1_0);
+    std::vector<uint32_t> spirv;
+    if (!tools.Assemble(assembly, &spirv)) {
+        return VK_NULL_HANDLE;
+    }
+    VkShaderModuleCreateInfo module_info = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    module_info.codeSize = spirv.size() * sizeof(uint32_t);
+    module_info.pCode = spirv.data();
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    vk::CreateShaderModule(device, &module_info, nullptr, &shader_module);
+    OnDestroy([this, shader_module]() { vk::DestroyShaderModule(device, shader_module, nullptr); });
+    return shader_module;
+}
+
+VkCommandPool Context::CreateCommandPool() {
+    VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = queue_family_index;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    vk::CreateCommandPool(device, &pool_info, nullptr, &pool);
+    OnDestroy([this, pool]() { vk::DestroyCommandPool(device, pool, nullptr); });
+    return pool;
+}
+
+std::vector<VkCommandBuffer> Context::AllocateCommandBuffers(VkCommandPool pool, uint32_t count) {
+    VkCommandBufferAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    alloc_info.commandPool = pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = count;
+    std::vector<VkCommandBuffer> command_buffers(count);
+    vk::AllocateCommandBuffers(device, &alloc_info, command_buffers.data());
+    return command_buffers;
+}
+
+VkPipelineLayout Context::CreatePipelineLayout(const VkDescriptorSetLayout *set_layout) {
+    VkPipelineLayoutCreateInfo layout_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    layout_info.setLayoutCount = set_layout ? 1 : 0;
+    layout_info.pSetLayouts = set_layout;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    vk::CreatePipelineLayout(device, &layout_info, nullptr, &layout);
+    OnDestroy([this, layout]() { vk::DestroyPipelineLayout(device, layout, nullptr); });
+    return layout;
+}
+
+// A render pass with a single color attachment and a pipeline drawing into it
+struct DrawTarget {
+    static constexpr uint32_t kSize = 64;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+
+    explicit DrawTarget(Context &context);
+    void Record(VkCommandBuffer command_buffer, uint32_t draw_count) const;
+};
+
+DrawTarget::DrawTarget(Context &context) {
+    const VkDevice device = context.device;
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+
+    VkAttachmentDescription attachment = {};
+    attachment.format = format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    const VkAttachmentReference color_reference = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &color_reference;
+    // Orders the clear against the draws of the previous render pass, consecutive command buffers draw to the same image
+    VkSubpassDependency dependency = {};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    VkRenderPassCreateInfo render_pass_info = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+    render_pass_info.attachmentCount = 1;
+    render_pass_info.pAttachments = &attachment;
+    render_pass_info.subpassCount = 1;
+    render_pass_info.pSubpasses = &subpass;
+    render_pass_info.dependencyCount = 1;
+    render_pass_info.pDependencies = &dependency;
+    vk::CreateRenderPass(device, &render_pass_info, nullptr, &render_pass);
+    context.OnDestroy([device, render_pass = render_pass]() { vk::DestroyRenderPass(device, render_pass, nullptr); });
+
+    VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = format;
+    image_info.extent = {kSize, kSize, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImage image = VK_NULL_HANDLE;
+    vk::CreateImage(device, &image_info, nullptr, &image);
+    VkMemoryRequirements requirements;
+    vk::GetImageMemoryRequirements(device, image, &requirements);
+    vk::BindImageMemory(device, image, context.AllocateMemory(requirements, 0), 0);
+    context.OnDestroy([device, image]() { vk::DestroyImage(device, image, nullptr); });
+
+    VkImageViewCreateInfo view_info = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+    view_info.image = image;
+    view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_info.format = format;
+    view_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    VkImageView view = VK_NULL_HANDLE;
+    vk::CreateImageView(device, &view_info, nullptr, &view);
+    context.OnDestroy([device, view]() { vk::DestroyImageView(device, view, nullptr); });
+
+    VkFramebufferCreateInfo framebuffer_info = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+    framebuffer_info.renderPass = render_pass;
+    framebuffer_info.attachmentCount = 1;
+    framebuffer_info.pAttachments = &view;
+    framebuffer_info.width = kSize;
+    framebuffer_info.height = kSize;
+    framebuffer_info.layers = 1;
+    vk::CreateFramebuffer(device, &framebuffer_info, nullptr, &framebuffer);
+    context.OnDestroy([device, framebuffer = framebuffer]() { vk::DestroyFramebuffer(device, framebuffer, nullptr); });
+
+    VkPipelineShaderStageCreateInfo stages[2] = {{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO},
+                                                 {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO}};
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = context.CreateShaderModule(kVertexShader);
+    stages[0].pName = "main";
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = context.CreateShaderModule(kFragmentShader);
+    stages[1].pName = "main";
+
+    VkPipelineVertexInputStateCreateInfo vertex_input = {VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    const VkViewport viewport = {0.0f, 0.0f, static_cast<float>(kSize), static_cast<float>(kSize), 0.0f, 1.0f};
+    const VkRect2D scissor = {{0, 0}, {kSize, kSize}};
+    VkPipelineViewportStateCreateInfo viewport_state = {VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
+    viewport_state.viewportCount = 1;
+    viewport_state.pViewports = &viewport;
+    viewport_state.scissorCount = 1;
+    viewport_state.pScissors = &scissor;
+    VkPipelineRasterizationStateCreateInfo rasterization = {VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = VK_CULL_MODE_NONE;
+    rasterization.lineWidth = 1.0f;
+    VkPipelineMultisampleStateCreateInfo multisample = {VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    VkPipelineColorBlendAttachmentState blend_attachment = {};
+    blend_attachment.colorWriteMask =
+        VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    VkPipelineColorBlendStateCreateInfo color_blend = {VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
+    color_blend.attachmentCount = 1;
+    color_blend.pAttachments = &blend_attachment;
+
+    VkGraphicsPipelineCreateInfo pipeline_info = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    pipeline_info.stageCount = 2;
+    pipeline_info.pStages = stages;
+    pipeline_info.pVertexInputState = &vertex_input;
+    pipeline_info.pInputAssemblyState = &input_assembly;
+    pipeline_info.pViewportState = &viewport_state;
+    pipeline_info.pRasterizationState = &rasterization;
+    pipeline_info.pMultisampleState = &multisample;
+    pipeline_info.pColorBlendState = &color_blend;
+    pipeline_info.layout = context.CreatePipelineLayout(nullptr);
+    pipeline_info.renderPass = render_pass;
+    vk::CreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline);
+    context.OnDestroy([device, pipeline = pipeline]() { vk::DestroyPipeline(device, pipeline, nullptr); });
+}
+
+void DrawTarget::Record(VkCommandBuffer command_buffer, uint32_t draw_count) const {
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vk::BeginCommandBuffer(command_buffer, &begin_info);
+
+    const VkClearValue clear_value = {};
+    VkRenderPassBeginInfo render_pass_begin = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+    render_pass_begin.renderPass = render_pass;
+    render_pass_begin.framebuffer = framebuffer;
+    render_pass_begin.renderArea = {{0, 0}, {kSize, kSize}};
+    render_pass_begin.clearValueCount = 1;
+    render_pass_begin.pClearValues = &clear_value;
+    vk::CmdBeginRenderPass(command_buffer, &render_pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+    vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    for (uint32_t i = 0; i < draw_count; ++i) {
+        vk::CmdDraw(command_buffer, 3, 1, 0, 0);
+    }
+    vk::CmdEndRenderPass(command_buffer);
+    vk::EndCommandBuffer(command_buffer);
+}
+
+// Sets up the context of the benchmark, or marks it as skipped
+#define BENCHMARK_CONTEXT(context, ...)                                    \
+    Context context(__VA_ARGS__);                                          \
+    if (!context.IsValid()) {                                              \
+        state.SkipWithError("could not create a device on the test ICD"); \
+        return;                                                            \
+    }
+
+void ReportMessages(benchmark::State &state, uint64_t messages_before) {
+    state.counters["messages"] = static_cast<double>(message_count.load() - messages_before);
+}
+
+// Recording of a command buffer of many draws, the most common hot path of an application
+void DrawRecording(benchmark::State &state, const LayerConfig &config) {
+    BENCHMARK_CONTEXT(context, config);
+    constexpr uint32_t kDrawCount = 1000;
+    const DrawTarget target(context);
+    const VkCommandBuffer command_buffer = context.AllocateCommandBuffers(context.CreateCommandPool(), 1)[0];
+
+    const uint64_t messages_before = message_count.load();
+    for (auto _ : state) {
+        target.Record(command_buffer, kDrawCount);
+    }
+    state.SetItemsProcessed(state.iterations() * kDrawCount);
+    ReportMessages(state, messages_before);
+}
+
+// Adds the most waited on locks of the report written by the layer as counters: the fraction of their acquisitions that
+// had to wait, and the wait time per iteration
+void ReportContendedLocks(benchmark::State &state, const char *lock_contention_file) {
+    constexpr size_t kReportedLocks = 3;
+    std::ifstream report(lock_contention_file);
+    std::string line;
+    size_t reported = 0;
+    // The layer writes one lock per line, the most waited on first
+    while (reported < kReportedLocks && std::getline(report, line)) {
+        char name[64];
+        unsigned long long acquisitions = 0, contended = 0, wait_ns = 0;
+        if (sscanf(line.c_str(), "{\"lock\": \"%63[^\"]\", \"acquisitions\": %llu, \"contended\": %llu, \"wait_ns\": %llu", name,
+                   &acquisitions, &contended, &wait_ns) != 4 ||
+            contended == 0) {
+            continue;
+        }
+        state.counters[std::string(name) + "_contended"] = static_cast<double>(contended) / static_cast<double>(acquisitions);
+        state.counters[std::string(name) + "_wait_us"] =
+            benchmark::Counter(static_cast<double>(wait_ns) / 1000.0, benchmark::Counter::kAvgIterations);
+        reported++;
+    }
+    report.close();
+    std::remove(lock_contention_file);
+}
+
+// The same recording done concurrently by 1 to 64 threads, each with its own command pool and command buffer. Reports
+// the throughput and the locks of the layer the threads waited on the most.
+void MultithreadedRecording(benchmark::State &state, const LayerConfig &config) {
+    {
+        BENCHMARK_CONTEXT(context, config, kLockContentionFile);
+        constexpr uint32_t kDrawCount = 1000;
+        const uint32_t thread_count = static_cast<uint32_t>(state.range(0));
+        const DrawTarget target(context);
+        std::vector<VkCommandBuffer> command_buffers;
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            command_buffers.push_back(context.AllocateCommandBuffers(context.CreateCommandPool(), 1)[0]);
+        }
+
+        const uint64_t messages_before = message_count.load();
+        for (auto _ : state) {
+            std::vector<std::thread> threads;
+            for (VkCommandBuffer command_buffer : command_buffers) {
+                threads.emplace_back([&target, command_buffer]() { target.Record(command_buffer, kDrawCount); });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * kDrawCount * thread_count);
+        ReportMessages(state, messages_before);
+    }
+    // The report is written when the device is destroyed
+    if (config.use_layer) {
+        ReportContendedLocks(state, kLockContentionFile);
+    }
+}
+
+// Bindless style updates, one write per element of a large update after bind descriptor array
+void BindlessDescriptorUpdates(benchmark::State &state, const LayerConfig &config) {
+    BENCHMARK_CONTEXT(context, config);
+    constexpr uint32_t kDescriptorCount = 1024;
+    const VkDevice device = context.device;
+
+    const VkDescriptorBindingFlags binding_flags =
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_info = {
+        VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO};
+    binding_flags_info.bindingCount = 1;
+    binding_flags_info.pBindingFlags = &binding_flags;
+    const VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kDescriptorCount, VK_SHADER_STAGE_ALL,
+                                                  nullptr};
+    VkDescriptorSetLayoutCreateInfo set_layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    set_layout_info.pNext = &binding_flags_info;
+    set_layout_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    set_layout_info.bindingCount = 1;
+    set_layout_info.pBindings = &binding;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    vk::CreateDescriptorSetLayout(device, &set_layout_info, nullptr, &set_layout);
+
+    const VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kDescriptorCount};
+    VkDescriptorPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    pool_info.maxSets = 1;
+    pool_info.poolSizeCount = 1;
+    pool_info.pPoolSizes = &pool_size;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    vk::CreateDescriptorPool(device, &pool_info, nullptr, &pool);
+
+    VkDescriptorSetAllocateInfo set_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    set_info.descriptorPool = pool;
+    set_info.descriptorSetCount = 1;
+    set_info.pSetLayouts = &set_layout;
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    vk::AllocateDescriptorSets(device, &set_info, &set);
+
+    const VkDescriptorBufferInfo buffer_info = {context.CreateBuffer(256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), 0, VK_WHOLE_SIZE};
+    std::vector<VkWriteDescriptorSet> writes(kDescriptorCount, {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET});
+    for (uint32_t i = 0; i < kDescriptorCount; ++i) {
+        writes[i].dstSet = set;
+        writes[i].dstBinding = 0;
+        writes[i].dstArrayElement = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo = &buffer_info;
+    }
+
+    const uint64_t messages_before = message_count.load();
+    for (auto _ : state) {
+        vk::UpdateDescriptorSets(device, kDescriptorCount, writes.data(), 0, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations() * kDescriptorCount);
+    ReportMessages(state, messages_before);
+
+    vk::DestroyDescriptorPool(device, pool, nullptr);
+    vk::DestroyDescriptorSetLayout(device, set_layout, nullptr);
+}
+
+// One vkQueueSubmit of many small command buffers, waited on with a fence
+void SubmitManyCommandBuffers(benchmark::State &state, const LayerConfig &config) {
+    BENCHMARK_CONTEXT(context, config);
+    constexpr uint32_t kCommandBufferCount = 64;
+    const VkDevice device = context.device;
+    const DrawTarget target(context);
+    const std::vector<VkCommandBuffer> command_buffers =
+        context.AllocateCommandBuffers(context.CreateCommandPool(), kCommandBufferCount);
+
+    VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    VkFence fence = VK_NULL_HANDLE;
+    vk::CreateFence(device, &fence_info, nullptr, &fence);
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = kCommandBufferCount;
+    submit_info.pCommandBuffers = command_buffers.data();
+
+    const uint64_t messages_before = message_count.load();
+    for (auto _ : state) {
+        // One time submit command buffers are recorded again for each submission
+        state.PauseTiming();
+        for (VkCommandBuffer command_buffer : command_buffers) {
+            target.Record(command_buffer, 4);
+        }
+        state.ResumeTiming();
+
+        vk::QueueSubmit(context.queue, 1, &submit_info, fence);
+        vk::WaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+        vk::ResetFences(device, 1, &fence);
+    }
+    state.SetItemsProcessed(state.iterations() * kCommandBufferCount);
+    ReportMessages(state, messages_before);
+
+    vk::DestroyFence(device, fence, nullptr);
+}
+
+// vkCreateComputePipelines with a large batch of create infos
+void PipelineBatchCreation(benchmark::State &state, const LayerConfig &config) {
+    BENCHMARK_CONTEXT(context, config);
+    constexpr uint32_t kPipelineCount = 64;
+    const VkDevice device = context.device;
+
+    VkComputePipelineCreateInfo pipeline_info = {VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    pipeline_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipeline_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_info.stage.module = context.CreateShaderModule(kComputeShader);
+    pipeline_info.stage.pName = "main";
+    pipeline_info.layout = context.CreatePipelineLayout(nullptr);
+    const std::vector<VkComputePipelineCreateInfo> create_infos(kPipelineCount, pipeline_info);
+    std::vector<VkPipeline> pipelines(kPipelineCount, VK_NULL_HANDLE);
+
+    const uint64_t messages_before = message_count.load();
+    for (auto _ : state) {
+        vk::CreateComputePipelines(device, VK_NULL_HANDLE, kPipelineCount, create_infos.data(), nullptr, pipelines.data());
+        state.PauseTiming();
+        for (VkPipeline pipeline : pipelines) {
+            vk::DestroyPipeline(device, pipeline, nullptr);
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kPipelineCount);
+    ReportMessages(state, messages_before);
+}
+
+// Same defaults as the tests, so a build tree can run the benchmarks with no environment set up
+void SetBenchmarkEnvironment() {
+    if (GetEnvironment("VK_LAYER_PATH").empty()) {
+        SetEnvironment("VK_LAYER_PATH", VALIDATION_LAYERS_BUILD_PATH);
+    }
+    if (GetEnvironment("VK_DRIVER_FILES").empty() && GetEnvironment("VK_ICD_FILENAMES").empty()) {
+        SetEnvironment("VK_DRIVER_FILES", TEST_ICD_JSON_PATH);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    SetBenchmarkEnvironment();
+    vk::InitCore("vulkan");
+
+    for (const LayerConfig &config : kLayerConfigs) {
+        const std::string suffix = std::string("/") + config.name;
+        benchmark::RegisterBenchmark(("DrawRecording" + suffix).c_str(), DrawRecording, config);
+        benchmark::RegisterBenchmark(("MultithreadedRecording" + suffix).c_str(), MultithreadedRecording, config)
+            ->RangeMultiplier(2)
+            ->Range(1, 64)
+            ->UseRealTime();
+        benchmark::RegisterBenchmark(("BindlessDescriptorUpdates" + suffix).c_str(), BindlessDescriptorUpdates, config);
+        benchmark::RegisterBenchmark(("SubmitManyCommandBuffers" + suffix).c_str(), SubmitManyCommandBuffers, config);
+        benchmark::RegisterBenchmark(("PipelineBatchCreation" + suffix).c_str(), PipelineBatchCreation, config);
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -123,7 +123,8 @@ int main(int argc, char** argv) {
         start_time = std::chrono::high_resolution_clock::now();
     }
 
-    gpuav::spirv::Module module(spirv_data, kDefaultShaderId, kInstDefaultDescriptorSet);
+    gpuav::spirv::LinkLibraryCache link_libraries;
+    gpuav::spirv::Module module(spirv_data, kDefaultShaderId, kInstDefaultDescriptorSet, link_libraries);
     if (all_passes || bindless_descriptor_pass) {
         module.RunPassBindlessDescriptor();
     }
@@ -119,6 +119,11 @@ TEST_F(NegativeCommand, IndexBufferSizeOffset) {
     m_errorMonitor->SetDesiredError("VUID-vkCmdDrawIndexed-robustBufferAccess2-07825");
     vk::CmdDrawIndexed(m_commandBuffer->handle(), 512, 1, 1, 0, 0);
     m_errorMonitor->VerifyFound();
+
+    // index size * firstIndex does not fit in 32 bits
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDrawIndexed-robustBufferAccess2-07825");
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), 1, 1, 0x80000000, 0, 0);
+    m_errorMonitor->VerifyFound();
 }
 
 TEST_F(NegativeCommand, MissingClearAttachment) {
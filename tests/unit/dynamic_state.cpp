@@ -192,6 +192,40 @@ TEST_F(NegativeDynamicState, ViewportNotBound) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDynamicState, ViewportNotBoundAfterRebind) {
+    TEST_DESCRIPTION("Draw twice with the same state, then rebind the pipeline so the dynamic viewport is no longer set.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+
+    CreatePipelineHelper pipe_static(*this);
+    pipe_static.CreateGraphicsPipeline();
+
+    CreatePipelineHelper pipe_dynamic(*this);
+    pipe_dynamic.AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT);
+    pipe_dynamic.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_dynamic.Handle());
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+
+    // Binding a pipeline with static viewport state makes the dynamic viewport undefined again
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_static.Handle());
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_dynamic.Handle());
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-07831");
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeDynamicState, ScissorNotBound) {
     TEST_DESCRIPTION("Run a simple draw calls to validate failure when Scissor dynamic state is required but not correctly bound.");
     RETURN_IF_SKIP(Init());
@@ -84,6 +84,74 @@ TEST_F(NegativeGpuAVBufferDeviceAddress, ReadBeforePointerPushConstant) {
     buffer.memory().unmap();
 }
 
+TEST_F(NegativeGpuAVBufferDeviceAddress, DeduplicateErrors) {
+    TEST_DESCRIPTION("The same error from each vertex is only logged once with gpuav_deduplicate_errors");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::shaderInt64);
+    AddDisabledFeature(vkt::Feature::robustBufferAccess);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_deduplicate_errors", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    VkPushConstantRange push_constant_ranges = {VK_SHADER_STAGE_VERTEX_BIT, 0, 2 * sizeof(VkDeviceAddress)};
+    VkPipelineLayoutCreateInfo plci = vku::InitStructHelper();
+    plci.pushConstantRangeCount = 1;
+    plci.pPushConstantRanges = &push_constant_ranges;
+    vkt::PipelineLayout pipeline_layout(*m_device, plci);
+
+    char const *shader_source = R"glsl(
+            #version 450
+            #extension GL_EXT_buffer_reference : enable
+            layout(buffer_reference, buffer_reference_align = 16) buffer bufStruct;
+            layout(push_constant) uniform ufoo {
+                bufStruct data;
+                int nWrites;
+            } u_info;
+            layout(buffer_reference, std140) buffer bufStruct {
+                int a[4]; // 16 byte strides
+            };
+            void main() {
+                for (int i=0; i < u_info.nWrites; ++i) {
+                    u_info.data.a[i] = 42;
+                }
+            }
+        )glsl";
+    VkShaderObj vs(this, shader_source, VK_SHADER_STAGE_VERTEX_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_[0] = vs.GetStageCreateInfo();
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+
+    vkt::Buffer buffer(*m_device, 64, 0, vkt::device_address);
+    VkDeviceAddress u_info_ptr = buffer.address();
+    // Will dereference the wrong ptr address
+    VkDeviceAddress push_constants[2] = {u_info_ptr - 16, 4};
+    vk::CmdPushConstants(m_commandBuffer->handle(), pipeline_layout.handle(), VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(push_constants),
+                         push_constants);
+
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+
+    // Each of the 3 vertices writes out of bounds with the same instruction
+    m_errorMonitor->SetDesiredError("UNASSIGNED-Device address out of bounds", 1);
+
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeGpuAVBufferDeviceAddress, ReadAfterPointerPushConstant) {
     TEST_DESCRIPTION("Read after the valid pointer - use Push Constants to set the value");
     RETURN_IF_SKIP(InitGpuVUBufferDeviceAddress());
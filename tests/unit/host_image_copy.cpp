@@ -68,6 +68,50 @@ TEST_F(NegativeHostImageCopy, ImageLayout) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeHostImageCopy, ImageLayoutOfMipLevel) {
+    TEST_DESCRIPTION("Copy to a mip level after only that level was transitioned to another layout");
+    image_ci = vkt::Image::ImageCreateInfo2D(
+        width, height, 2, 1, format,
+        VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+    RETURN_IF_SKIP(InitHostImageCopyTest(image_ci));
+
+    VkImageLayout layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    vkt::Image image(*m_device, image_ci);
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, layout);
+
+    std::vector<uint8_t> pixels(width * height * 4);
+
+    VkMemoryToImageCopyEXT region_to_image = vku::InitStructHelper();
+    region_to_image.pHostPointer = pixels.data();
+    region_to_image.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 1, 0, 1};
+    region_to_image.imageExtent = {width / 2, height / 2, 1};
+
+    VkCopyMemoryToImageInfoEXT copy_to_image = vku::InitStructHelper();
+    copy_to_image.dstImage = image;
+    copy_to_image.dstImageLayout = layout;
+    copy_to_image.regionCount = 1;
+    copy_to_image.pRegions = &region_to_image;
+
+    // The whole image is in the layout
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+
+    VkHostImageLayoutTransitionInfoEXT transition_info = vku::InitStructHelper();
+    transition_info.image = image;
+    transition_info.oldLayout = layout;
+    transition_info.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    transition_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 1, 1, 0, 1};
+    vk::TransitionImageLayoutEXT(*m_device, 1, &transition_info);
+
+    m_errorMonitor->SetDesiredError("VUID-VkCopyMemoryToImageInfoEXT-dstImageLayout-09059");
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+    m_errorMonitor->VerifyFound();
+
+    // Mip level 0 is still in the layout
+    region_to_image.imageSubresource.mipLevel = 0;
+    region_to_image.imageExtent = {width, height, 1};
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+}
+
 TEST_F(NegativeHostImageCopy, ImageOffset) {
     image_ci = vkt::Image::ImageCreateInfo2D(
         width, height, 1, 1, format,
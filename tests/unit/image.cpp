@@ -5352,6 +5352,25 @@ TEST_F(NegativeImage, GetPhysicalDeviceImageFormatProperties) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeImage, GetPhysicalDeviceImageFormatPropertiesSameImages) {
+    TEST_DESCRIPTION("The failed image format query is reported for every image created with the same parameters");
+    RETURN_IF_SKIP(Init());
+
+    // VK_FORMAT_E5B9G9R9_UFLOAT_PACK32 is a hardcoded format that is known to fail in MockICD
+    if (!IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test only supported by MockICD";
+    }
+    if (!FormatFeaturesAreSupported(gpu(), VK_FORMAT_E5B9G9R9_UFLOAT_PACK32, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_STORAGE_BIT)) {
+        GTEST_SKIP() << "Required formats/features not supported";
+    }
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        m_errorMonitor->SetDesiredError("VUID-VkImageCreateInfo-imageCreateMaxMipLevels-02251");
+        vkt::Image image(*m_device, 128, 128, 1, VK_FORMAT_E5B9G9R9_UFLOAT_PACK32, VK_IMAGE_USAGE_STORAGE_BIT);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
 TEST_F(NegativeImage, BlitColorToDepth) {
     TEST_DESCRIPTION("Blit a color image to a depth image");
     RETURN_IF_SKIP(Init());
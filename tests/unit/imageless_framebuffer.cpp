@@ -1151,3 +1151,67 @@ TEST_F(NegativeImagelessFramebuffer, MissingInheritanceRenderingInfo) {
     vk::BeginCommandBuffer(secondary.handle(), &beginInfo);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeImagelessFramebuffer, RenderPassBeginAfterValidBegin) {
+    TEST_DESCRIPTION("Begin with valid image views, then with mismatched ones, the second begin must still be validated.");
+
+    AddRequiredExtensions(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::imagelessFramebuffer);
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t attachment_width = 256;
+    const uint32_t attachment_height = 256;
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+
+    RenderPassSingleSubpass rp(*this);
+    rp.AddAttachmentDescription(format);
+    rp.AddAttachmentReference({0, VK_IMAGE_LAYOUT_GENERAL});
+    rp.AddColorAttachment(0);
+    rp.CreateRenderPass();
+
+    VkFramebufferAttachmentImageInfo fb_attachment_image_info = vku::InitStructHelper();
+    fb_attachment_image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    fb_attachment_image_info.width = attachment_width;
+    fb_attachment_image_info.height = attachment_height;
+    fb_attachment_image_info.layerCount = 1;
+    fb_attachment_image_info.viewFormatCount = 1;
+    fb_attachment_image_info.pViewFormats = &format;
+    VkFramebufferAttachmentsCreateInfo fb_attachment_ci = vku::InitStructHelper();
+    fb_attachment_ci.attachmentImageInfoCount = 1;
+    fb_attachment_ci.pAttachmentImageInfos = &fb_attachment_image_info;
+    VkFramebufferCreateInfo fb_ci = vku::InitStructHelper(&fb_attachment_ci);
+    fb_ci.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT;
+    fb_ci.width = attachment_width;
+    fb_ci.height = attachment_height;
+    fb_ci.layers = 1;
+    fb_ci.renderPass = rp.Handle();
+    fb_ci.attachmentCount = 1;
+    vkt::Framebuffer framebuffer(*m_device, fb_ci);
+
+    vkt::Image image(*m_device, attachment_width, attachment_height, 1, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+    vkt::ImageView image_view = image.CreateView();
+    vkt::Image small_image(*m_device, attachment_width / 2, attachment_height / 2, 1, format, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+    vkt::ImageView small_image_view = small_image.CreateView();
+
+    VkRenderPassAttachmentBeginInfo rp_attachment_begin_info = vku::InitStructHelper();
+    rp_attachment_begin_info.attachmentCount = 1;
+    rp_attachment_begin_info.pAttachments = &image_view.handle();
+    VkRenderPassBeginInfo rp_begin_info = vku::InitStructHelper(&rp_attachment_begin_info);
+    rp_begin_info.renderPass = rp.Handle();
+    rp_begin_info.framebuffer = framebuffer.handle();
+    rp_begin_info.renderArea.extent.width = attachment_width / 2;
+    rp_begin_info.renderArea.extent.height = attachment_height / 2;
+
+    m_commandBuffer->begin();
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_commandBuffer->BeginRenderPass(rp_begin_info);
+        m_commandBuffer->EndRenderPass();
+    }
+
+    rp_attachment_begin_info.pAttachments = &small_image_view.handle();
+    m_errorMonitor->SetDesiredError("VUID-VkRenderPassBeginInfo-framebuffer-03211");
+    m_errorMonitor->SetDesiredError("VUID-VkRenderPassBeginInfo-framebuffer-03212");
+    vk::CmdBeginRenderPass(m_commandBuffer->handle(), &rp_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
@@ -189,6 +189,35 @@ TEST_F(NegativeMemory, MapMemory) {
     vk::FreeMemory(device(), mem, NULL);
 }
 
+TEST_F(NegativeMemory, FlushMappedMemoryRangesOfSeveralMemories) {
+    TEST_DESCRIPTION("Flush ranges of a mapped and an unmapped memory in the same call");
+    RETURN_IF_SKIP(Init());
+
+    VkMemoryAllocateInfo memory_info = vku::InitStructHelper();
+    memory_info.allocationSize = 64 << 10;
+    ASSERT_TRUE(m_device->phy().set_memory_type(vvl::kU32Max, &memory_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+    vkt::DeviceMemory mapped_memory(*m_device, memory_info);
+    vkt::DeviceMemory unmapped_memory(*m_device, memory_info);
+
+    void *data = nullptr;
+    ASSERT_EQ(VK_SUCCESS, vk::MapMemory(device(), mapped_memory.handle(), 0, VK_WHOLE_SIZE, 0, &data));
+
+    VkMappedMemoryRange ranges[3];
+    for (auto &range : ranges) {
+        range = vku::InitStructHelper();
+        range.memory = mapped_memory.handle();
+        range.offset = 0;
+        range.size = VK_WHOLE_SIZE;
+    }
+    ranges[1].memory = unmapped_memory.handle();
+
+    m_errorMonitor->SetDesiredError("VUID-VkMappedMemoryRange-memory-00684");
+    vk::FlushMappedMemoryRanges(device(), 3, ranges);
+    m_errorMonitor->VerifyFound();
+
+    vk::UnmapMemory(device(), mapped_memory.handle());
+}
+
 TEST_F(NegativeMemory, MapMemory2) {
     TEST_DESCRIPTION("Attempt to map memory in a number of incorrect ways");
 
@@ -250,6 +250,12 @@ TEST_F(VkLayerTest, VuidCheckForHashCollisions) {
     ASSERT_TRUE(it == hashes.end());
 }
 
+TEST_F(VkLayerTest, VuidSpecTextSorted) {
+    TEST_DESCRIPTION("The spec text of a VUID is looked up with a binary search");
+    const auto less = [](const vuid_spec_text_pair &a, const vuid_spec_text_pair &b) { return strcmp(a.vuid, b.vuid) < 0; };
+    ASSERT_TRUE(std::is_sorted(std::begin(vuid_spec_text), std::end(vuid_spec_text), less));
+}
+
 TEST_F(VkLayerTest, VuidHashStability) {
     TEST_DESCRIPTION("Ensure stability of VUID hashes clients rely on for filtering");
     ASSERT_TRUE(hash_util::VuidHash("VUID-VkRenderPassCreateInfo-pNext-01963") == 0xa19880e3);
@@ -218,6 +218,48 @@ TEST_F(PositiveQuery, DestroyQueryPoolBasedOnQueryPoolResults) {
     }
 }
 
+TEST_F(PositiveQuery, DestroyLargeQueryPoolBasedOnQueryPoolResults) {
+    TEST_DESCRIPTION("Destroy a QueryPool of many timestamps based on vkGetQueryPoolResults of two ranges of its queries");
+    RETURN_IF_SKIP(Init());
+    if (HasZeroTimestampValidBits()) {
+        GTEST_SKIP() << "Device graphic queue has timestampValidBits of 0, skipping.\n";
+    }
+
+    constexpr uint32_t query_count = 1000;
+    constexpr uint32_t half_query_count = query_count / 2;
+    std::vector<uint64_t> timestamps(half_query_count);
+
+    VkQueryPoolCreateInfo query_pool_info = vkt::QueryPool::create_info(VK_QUERY_TYPE_TIMESTAMP, query_count);
+    VkQueryPool query_pool;
+    vk::CreateQueryPool(m_device->handle(), &query_pool_info, nullptr, &query_pool);
+
+    m_commandBuffer->begin();
+    vk::CmdResetQueryPool(m_commandBuffer->handle(), query_pool, 0, query_count);
+    for (uint32_t i = 0; i < query_count; ++i) {
+        vk::CmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, query_pool, i);
+    }
+    m_commandBuffer->end();
+
+    m_default_queue->Submit(*m_commandBuffer);
+
+    constexpr VkQueryResultFlags query_flags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT;
+    VkResult res = vk::GetQueryPoolResults(m_device->handle(), query_pool, half_query_count, half_query_count,
+                                           half_query_count * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t), query_flags);
+    if (res == VK_SUCCESS) {
+        res = vk::GetQueryPoolResults(m_device->handle(), query_pool, 0, half_query_count, half_query_count * sizeof(uint64_t),
+                                      timestamps.data(), sizeof(uint64_t), query_flags);
+    }
+
+    if (res == VK_SUCCESS) {
+        // Both ranges were read without VK_QUERY_RESULT_PARTIAL_BIT, so all the queries are available
+        vk::DestroyQueryPool(m_device->handle(), query_pool, nullptr);
+        m_default_queue->Wait();
+    } else {
+        m_default_queue->Wait();
+        vk::DestroyQueryPool(m_device->handle(), query_pool, nullptr);
+    }
+}
+
 TEST_F(PositiveQuery, QueryAndCopySecondaryCommandBuffers) {
     TEST_DESCRIPTION("Issue a query on a secondary command buffer and copy it on a primary.");
 
@@ -1915,6 +1915,51 @@ TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemory) {
     }
 }
 
+TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemoryManyBuilds) {
+    TEST_DESCRIPTION("Validate acceleration structure building when only two of many destination acceleration structures overlap.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::rayQuery);
+    RETURN_IF_SKIP(InitFrameworkForRayTracingTest());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr size_t build_info_count = 8;
+
+    VkMemoryAllocateFlagsInfo alloc_flags = vku::InitStructHelper();
+    alloc_flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper(&alloc_flags);
+    alloc_info.allocationSize = build_info_count * 4096;
+    vkt::DeviceMemory buffer_memory(*m_device, alloc_info);
+
+    VkBufferCreateInfo dst_blas_buffer_ci = vku::InitStructHelper();
+    dst_blas_buffer_ci.size = 4096;
+    dst_blas_buffer_ci.usage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR |
+                               VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    std::vector<vkt::Buffer> dst_blas_buffers(build_info_count);
+    std::vector<vkt::as::BuildGeometryInfoKHR> build_infos;
+    for (size_t i = 0; i < build_info_count; ++i) {
+        // Each destination acceleration structure has its own part of the memory, except the last one that is bound to the
+        // same memory as the first one
+        const VkDeviceSize memory_offset = i == build_info_count - 1 ? 0 : i * 4096;
+        dst_blas_buffers[i].init_no_mem(*m_device, dst_blas_buffer_ci);
+        vk::BindBufferMemory(device(), dst_blas_buffers[i].handle(), buffer_memory.handle(), memory_offset);
+
+        auto blas = vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device);
+        blas.GetDstAS()->SetDeviceBuffer(std::move(dst_blas_buffers[i]));
+        blas.GetDstAS()->SetSize(4096);
+        build_infos.emplace_back(std::move(blas));
+    }
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702");
+    m_commandBuffer->begin();
+    vkt::as::BuildAccelerationStructuresKHR(m_commandBuffer->handle(), build_infos);
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemory2) {
     TEST_DESCRIPTION("Validate acceleration structure building when scratch buffers overlap.");
 
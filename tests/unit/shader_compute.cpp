@@ -188,6 +188,52 @@ TEST_F(NegativeShaderCompute, SharedMemorySpecConstantSet) {
     CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
 }
 
+TEST_F(NegativeShaderCompute, SharedMemorySpecConstantSetAfterGood) {
+    TEST_DESCRIPTION("Specialize a module with good values first, then with values exceeding maxComputeSharedMemorySize");
+
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t max_shared_memory_size = m_device->phy().limits_.maxComputeSharedMemorySize;
+    const uint32_t max_shared_ints = max_shared_memory_size / 4;
+
+    std::stringstream cs_source;
+    cs_source << R"glsl(
+        #version 450
+        layout(constant_id = 0) const uint Condition = 0;
+        layout(constant_id = 1) const uint SharedSize = )glsl";
+    cs_source << (max_shared_ints + 16);
+    cs_source << R"glsl(;
+
+        #define enableSharedMemoryOpt (Condition == 1)
+        shared uint arr[enableSharedMemoryOpt ? SharedSize : 1];
+        void main(){}
+    )glsl";
+
+    uint32_t data = 2;
+
+    VkSpecializationMapEntry entry;
+    entry.constantID = 0;
+    entry.offset = 0;
+    entry.size = sizeof(uint32_t);
+
+    VkSpecializationInfo specialization_info = {};
+    specialization_info.mapEntryCount = 1;
+    specialization_info.pMapEntries = &entry;
+    specialization_info.dataSize = sizeof(uint32_t);
+    specialization_info.pData = &data;
+
+    const auto set_info = [&](CreateComputePipelineHelper &helper) {
+        helper.cs_ = std::make_unique<VkShaderObj>(this, cs_source.str().c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0,
+                                                   SPV_SOURCE_GLSL, &specialization_info);
+    };
+    // The same values twice, the second pipeline uses the specialization of the first one
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+
+    data = 1;  // set Condition
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
+}
+
 TEST_F(NegativeShaderCompute, WorkGroupSizeSpecConstant) {
     TEST_DESCRIPTION("Validate compute shader shared memory does not exceed maxComputeWorkGroupSize");
 
@@ -462,6 +508,69 @@ TEST_F(NegativeShaderCompute, WorkGroupSizeLocalSizeIdSpecConstantSet) {
     CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-x-06429");
 }
 
+TEST_F(NegativeShaderCompute, WorkGroupSizeLocalSizeIdSpecConstantOp) {
+    TEST_DESCRIPTION("Validate LocalSizeId computed from a spec constant with OpSpecConstantOp");
+
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    RETURN_IF_SKIP(InitFramework());
+
+    VkPhysicalDeviceVulkan13Features features13 = vku::InitStructHelper();
+    features13.maintenance4 = VK_TRUE;  // required to be supported in 1.3
+    RETURN_IF_SKIP(InitState(nullptr, &features13));
+
+    uint32_t x_size_limit = m_device->phy().limits_.maxComputeWorkGroupSize[0];
+
+    // The x size is spec_x * 2, selected to 1 when spec_x is 0
+    std::stringstream spv_source;
+    spv_source << R"(
+               OpCapability Shader
+          %1 = OpExtInstImport "GLSL.std.450"
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionModeId %main LocalSizeId %size_x %uint_1 %uint_1
+               OpSource GLSL 450
+               OpDecorate %spec_x SpecId 18
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %bool = OpTypeBool
+       %uint = OpTypeInt 32 0
+     %spec_x = OpSpecConstant %uint 16
+     %uint_0 = OpConstant %uint 0
+     %uint_1 = OpConstant %uint 1
+     %uint_2 = OpConstant %uint 2
+    %twice_x = OpSpecConstantOp %uint IMul %spec_x %uint_2
+    %is_zero = OpSpecConstantOp %bool IEqual %spec_x %uint_0
+     %size_x = OpSpecConstantOp %uint Select %is_zero %uint_1 %twice_x
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    uint32_t data = 1;
+
+    VkSpecializationMapEntry entry;
+    entry.constantID = 18;
+    entry.offset = 0;
+    entry.size = sizeof(uint32_t);
+
+    VkSpecializationInfo specialization_info = {};
+    specialization_info.mapEntryCount = 1;
+    specialization_info.pMapEntries = &entry;
+    specialization_info.dataSize = sizeof(uint32_t);
+    specialization_info.pData = &data;
+
+    const auto set_info = [&](CreateComputePipelineHelper &helper) {
+        helper.cs_ = std::make_unique<VkShaderObj>(this, spv_source.str().c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_3,
+                                                   SPV_SOURCE_ASM, &specialization_info);
+    };
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+
+    data = x_size_limit / 2 + 1;
+    m_errorMonitor->SetUnexpectedError("VUID-RuntimeSpirv-x-06432");
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-x-06429");
+}
+
 TEST_F(NegativeShaderCompute, WorkgroupMemoryExplicitLayout) {
     TEST_DESCRIPTION("Test VK_KHR_workgroup_memory_explicit_layout");
     SetTargetApiVersion(VK_API_VERSION_1_2);
@@ -422,6 +422,54 @@ TEST_F(NegativeShaderInterface, VsFsTypeMismatch) {
     CreatePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-OpEntryPoint-07754");
 }
 
+TEST_F(NegativeShaderInterface, VsFsTypeMismatchAfterMatch) {
+    TEST_DESCRIPTION("Test that a vertex shader which matched one fragment shader still reports a mismatch with another");
+
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    char const *vsSource = R"glsl(
+        #version 450
+        layout(location=0) out float x;
+        void main(){
+           x = 0;
+           gl_Position = vec4(1);
+        }
+    )glsl";
+    char const *fsGoodSource = R"glsl(
+        #version 450
+        layout(location=0) in float x;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = vec4(x);
+        }
+    )glsl";
+    char const *fsBadSource = R"glsl(
+        #version 450
+        layout(location=0) flat in int x; /* VS writes float */
+        layout(location=0) out vec4 color;
+        void main(){
+           color = vec4(x);
+        }
+    )glsl";
+
+    VkShaderObj vs(this, vsSource, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs_good(this, fsGoodSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+    VkShaderObj fs_bad(this, fsBadSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    const auto set_good_info = [&](CreatePipelineHelper &helper) {
+        helper.shader_stages_ = {vs.GetStageCreateInfo(), fs_good.GetStageCreateInfo()};
+    };
+    CreatePipelineHelper::OneshotTest(*this, set_good_info, kErrorBit);
+    // Same matching pair again
+    CreatePipelineHelper::OneshotTest(*this, set_good_info, kErrorBit);
+
+    const auto set_bad_info = [&](CreatePipelineHelper &helper) {
+        helper.shader_stages_ = {vs.GetStageCreateInfo(), fs_bad.GetStageCreateInfo()};
+    };
+    CreatePipelineHelper::OneshotTest(*this, set_bad_info, kErrorBit, "VUID-RuntimeSpirv-OpEntryPoint-07754");
+}
+
 TEST_F(NegativeShaderInterface, VsFsTypeMismatchInBlock) {
     TEST_DESCRIPTION(
         "Test that an error is produced for mismatched types across the vertex->fragment shader interface, when the variable is "
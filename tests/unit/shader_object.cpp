@@ -3238,6 +3238,42 @@ TEST_F(NegativeShaderObject, DifferentShaderPushConstantRanges) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderObject, DifferentShaderPushConstantRangesAfterMatch) {
+    TEST_DESCRIPTION("Draw with shaders with the same push constant ranges, then rebind a fragment shader with different ones.");
+
+    RETURN_IF_SKIP(InitBasicShaderObject());
+    InitDynamicRenderTarget();
+
+    VkPushConstantRange pushConstRange;
+    pushConstRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    pushConstRange.offset = 0u;
+    pushConstRange.size = sizeof(uint32_t);
+
+    const vkt::Shader vertShader(*m_device, VK_SHADER_STAGE_VERTEX_BIT, GLSLToSPV(VK_SHADER_STAGE_VERTEX_BIT, kVertexMinimalGlsl),
+                                 nullptr, &pushConstRange);
+    const vkt::Shader fragShader(*m_device, VK_SHADER_STAGE_FRAGMENT_BIT,
+                                 GLSLToSPV(VK_SHADER_STAGE_FRAGMENT_BIT, kFragmentMinimalGlsl), nullptr, &pushConstRange);
+    const vkt::Shader otherFragShader(*m_device, VK_SHADER_STAGE_FRAGMENT_BIT,
+                                      GLSLToSPV(VK_SHADER_STAGE_FRAGMENT_BIT, kFragmentMinimalGlsl));
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderingColor(GetDynamicRenderTarget(), GetRenderTargetArea());
+    SetDefaultDynamicStatesExclude();
+    m_commandBuffer->BindVertFragShader(vertShader, fragShader);
+    vk::CmdDraw(m_commandBuffer->handle(), 4, 1, 0, 0);
+    vk::CmdDraw(m_commandBuffer->handle(), 4, 1, 0, 0);
+
+    m_commandBuffer->BindVertFragShader(vertShader, otherFragShader);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-08878");
+    vk::CmdDraw(m_commandBuffer->handle(), 4, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->BindVertFragShader(vertShader, fragShader);
+    vk::CmdDraw(m_commandBuffer->handle(), 4, 1, 0, 0);
+    m_commandBuffer->EndRendering();
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeShaderObject, DifferentShaderDescriptorLayouts) {
     TEST_DESCRIPTION("Draw with shaders that have different descriptor layouts.");
 
@@ -73,6 +73,90 @@ TEST_F(NegativeThreading, CommandBufferCollision) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeThreading, CommandBufferCollisionOwnerCache) {
+    TEST_DESCRIPTION("The thread owning a command buffer still collides with a new thread when using the owner cache");
+    m_errorMonitor->SetDesiredError("THREADING ERROR");
+    m_errorMonitor->SetAllowedFailureMsg("THREADING ERROR");  // Ignore any extra threading errors found beyond the first one
+
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_owner_cache", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Test takes magnitude of time longer for profiles and slows down testing
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    vkt::CommandBuffer commandBuffer(*m_device, m_command_pool);
+    commandBuffer.begin();
+
+    vkt::Event event(*m_device);
+
+    ThreadTestData data;
+    data.commandBuffer = commandBuffer.handle();
+    data.event = event.handle();
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+    m_errorMonitor->SetBailout(data.bailout);
+
+    // This thread becomes the owner of the command buffer first
+    AddToCommandBuffer(&data);
+
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+
+    thread.join();
+    commandBuffer.end();
+
+    m_errorMonitor->SetBailout(NULL);
+
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeThreading, CommandBufferCollisionSkipImmutableReads) {
+    TEST_DESCRIPTION("Skipping the reads of immutable objects still tracks the command buffers");
+    m_errorMonitor->SetDesiredError("THREADING ERROR");
+    m_errorMonitor->SetAllowedFailureMsg("THREADING ERROR");  // Ignore any extra threading errors found beyond the first one
+
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_skip_immutable_reads", VK_LAYER_SETTING_TYPE_BOOL32_EXT,
+                                       1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // Test takes magnitude of time longer for profiles and slows down testing
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    vkt::CommandBuffer commandBuffer(*m_device, m_command_pool);
+    commandBuffer.begin();
+
+    vkt::Event event(*m_device);
+
+    ThreadTestData data;
+    data.commandBuffer = commandBuffer.handle();
+    data.event = event.handle();
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+    m_errorMonitor->SetBailout(data.bailout);
+
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+
+    thread.join();
+    commandBuffer.end();
+
+    m_errorMonitor->SetBailout(NULL);
+
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeThreading, UpdateDescriptorCollision) {
     TEST_DESCRIPTION("Two threads updating the same descriptor set, expected to generate a threading error");
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/arena_allocator.h"
+
+#include <deque>
+#include <map>
+
+TEST(ArenaAllocator, Containers) {
+    const vvl::ArenaStats before = vvl::arena::GetStats(vvl::Arena::Spirv);
+    {
+        using MapAllocator = vvl::ArenaAllocator<std::pair<const uint32_t, uint32_t>, vvl::Arena::Spirv>;
+        std::vector<uint64_t, vvl::ArenaAllocator<uint64_t, vvl::Arena::Spirv>> vector;
+        std::map<uint32_t, uint32_t, std::less<uint32_t>, MapAllocator> map;
+        for (uint32_t i = 0; i < 1000; ++i) {
+            vector.push_back(i);
+            map.emplace(i, i);
+        }
+        for (uint32_t i = 0; i < 1000; ++i) {
+            ASSERT_EQ(vector[i], i);
+            ASSERT_EQ(map.at(i), i);
+        }
+        const vvl::ArenaStats during = vvl::arena::GetStats(vvl::Arena::Spirv);
+        ASSERT_GE(during.bytes, before.bytes + vector.capacity() * sizeof(uint64_t));
+        ASSERT_GE(during.pooled_allocations, before.pooled_allocations + 1000);
+        ASSERT_GE(during.peak_bytes, during.bytes);
+    }
+    const vvl::ArenaStats after = vvl::arena::GetStats(vvl::Arena::Spirv);
+    ASSERT_EQ(after.bytes, before.bytes);
+    ASSERT_EQ(after.allocations, before.allocations);
+}
+
+TEST(ArenaAllocator, Alignment) {
+    struct alignas(64) Aligned {
+        uint8_t value;
+    };
+    std::deque<Aligned, vvl::ArenaAllocator<Aligned, vvl::Arena::StateTracker>> deque;
+    for (uint8_t i = 0; i < 100; ++i) {
+        deque.push_back(Aligned{i});
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(&deque.back()) % alignof(Aligned), 0u);
+    }
+}
+
+TEST(ArenaAllocator, PooledBlockReuse) {
+    void *first = vvl::arena::Allocate(vvl::Arena::SyncVal, 48, 8);
+    vvl::arena::Free(vvl::Arena::SyncVal, first, 48, 8);
+    // The pools hand out the last freed block first
+    void *second = vvl::arena::Allocate(vvl::Arena::SyncVal, 48, 8);
+    ASSERT_EQ(first, second);
+    vvl::arena::Free(vvl::Arena::SyncVal, second, 48, 8);
+}
+
+namespace {
+struct CallbackCounts {
+    uint32_t allocations = 0;
+    uint32_t frees = 0;
+    std::map<void *, size_t> alignments;
+};
+
+VKAPI_ATTR void *VKAPI_CALL CountingAllocation(void *user_data, size_t size, size_t alignment, VkSystemAllocationScope) {
+    auto &counts = *static_cast<CallbackCounts *>(user_data);
+    counts.allocations++;
+    void *memory = ::operator new(size, std::align_val_t(alignment));
+    counts.alignments[memory] = alignment;
+    return memory;
+}
+
+VKAPI_ATTR void *VKAPI_CALL CountingReallocation(void *, void *, size_t, size_t, VkSystemAllocationScope) { return nullptr; }
+
+VKAPI_ATTR void VKAPI_CALL CountingFree(void *user_data, void *memory) {
+    if (memory) {
+        auto &counts = *static_cast<CallbackCounts *>(user_data);
+        counts.frees++;
+        const size_t alignment = counts.alignments.at(memory);
+        counts.alignments.erase(memory);
+        ::operator delete(memory, std::align_val_t(alignment));
+    }
+}
+}  // namespace
+
+TEST(ArenaAllocator, AllocationCallbacks) {
+    CallbackCounts counts;
+    VkAllocationCallbacks callbacks{};
+    callbacks.pUserData = &counts;
+    callbacks.pfnAllocation = CountingAllocation;
+    callbacks.pfnReallocation = CountingReallocation;
+    callbacks.pfnFree = CountingFree;
+    ASSERT_TRUE(vvl::arena::InstallAllocationCallbacks(callbacks));
+    // Only one set of callbacks at a time
+    ASSERT_FALSE(vvl::arena::InstallAllocationCallbacks(callbacks));
+
+    // The layer under test is a library of its own, nothing else of this process allocates from these arenas
+    // and the pool of this size class starts a chunk from the callbacks
+    void *small = vvl::arena::Allocate(vvl::Arena::GpuAV, 1008, 16);
+    void *large = vvl::arena::Allocate(vvl::Arena::GpuAV, 1024 * 1024, 16);
+    ASSERT_EQ(counts.allocations, 2u);
+    vvl::arena::Free(vvl::Arena::GpuAV, large, 1024 * 1024, 16);
+    vvl::arena::Free(vvl::Arena::GpuAV, small, 1008, 16);
+
+    vvl::arena::RemoveAllocationCallbacks();
+    ASSERT_EQ(counts.frees, counts.allocations);
+
+    // Back to the heap
+    const uint32_t allocations = counts.allocations;
+    void *heap = vvl::arena::Allocate(vvl::Arena::GpuAV, 1024, 16);
+    vvl::arena::Free(vvl::Arena::GpuAV, heap, 1024, 16);
+    ASSERT_EQ(counts.allocations, allocations);
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/bitset.h"
+
+#include <bitset>
+#include <random>
+
+namespace {
+// Not a multiple of 64, so the unused bits of the last word get exercised
+constexpr size_t kBits = 150;
+
+template <typename Bitset>
+Bitset FromWords(uint64_t low, uint64_t mid, uint64_t high) {
+    return (((Bitset(high) << 64) | Bitset(mid)) << 64) | Bitset(low);
+}
+
+template <typename Bitset>
+std::vector<bool> ToBools(const Bitset &bits) {
+    std::vector<bool> result(bits.size());
+    for (size_t i = 0; i < bits.size(); ++i) {
+        result[i] = bits.test(i);
+    }
+    return result;
+}
+}  // namespace
+
+TEST(CustomContainer, BitsetConstexpr) {
+    constexpr vvl::bitset<kBits> a = vvl::bitset<kBits>(1) << 3;
+    constexpr vvl::bitset<kBits> b = vvl::bitset<kBits>(1) << 130;
+    constexpr vvl::bitset<kBits> both = a | b;
+    static_assert(both.Intersects(b), "");
+    static_assert(!a.Intersects(b), "");
+    static_assert((~vvl::bitset<kBits>()).all(), "");
+    static_assert((both & ~a) == b, "");
+    ASSERT_EQ(both.count(), 2u);
+    ASSERT_EQ((~vvl::bitset<kBits>()).count(), kBits);
+}
+
+TEST(CustomContainer, BitsetMatchesStd) {
+    std::mt19937_64 rng(0x5eed);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const uint64_t words[6] = {rng(), rng(), rng(), rng(), rng(), rng()};
+        const auto a = FromWords<vvl::bitset<kBits>>(words[0], words[1], words[2]);
+        const auto b = FromWords<vvl::bitset<kBits>>(words[3], words[4], words[5]);
+        const auto std_a = FromWords<std::bitset<kBits>>(words[0], words[1], words[2]);
+        const auto std_b = FromWords<std::bitset<kBits>>(words[3], words[4], words[5]);
+        const size_t shift = rng() % (kBits + 10);
+
+        ASSERT_EQ(ToBools(a & b), ToBools(std_a & std_b));
+        ASSERT_EQ(ToBools(a | b), ToBools(std_a | std_b));
+        ASSERT_EQ(ToBools(a ^ b), ToBools(std_a ^ std_b));
+        ASSERT_EQ(ToBools(~a), ToBools(~std_a));
+        ASSERT_EQ(ToBools(a << shift), ToBools(std_a << shift));
+        ASSERT_EQ(ToBools(a >> shift), ToBools(std_a >> shift));
+        ASSERT_EQ(a.count(), std_a.count());
+        ASSERT_EQ(a.Intersects(b), (std_a & std_b).any());
+    }
+}
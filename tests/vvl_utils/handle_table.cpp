@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/handle_table.h"
+
+TEST(CustomContainer, HandleTableInsertFind) {
+    vvl::HandleTable table;
+    const uint64_t id_a = table.Insert(0xAAAA);
+    const uint64_t id_b = table.Insert(0xBBBB);
+    ASSERT_NE(id_a, 0u);
+    ASSERT_NE(id_b, 0u);
+    ASSERT_NE(id_a, id_b);
+
+    auto iter = table.find(id_a);
+    ASSERT_TRUE(iter != table.end());
+    ASSERT_EQ(iter->second, 0xAAAAu);
+    iter = table.find(id_b);
+    ASSERT_TRUE(iter != table.end());
+    ASSERT_EQ(iter->second, 0xBBBBu);
+
+    ASSERT_TRUE(table.find(0) == table.end());
+    ASSERT_TRUE(table.find(0xFFFFFFFFFFFFull) == table.end());
+}
+
+TEST(CustomContainer, HandleTableStaleId) {
+    vvl::HandleTable table;
+    const uint64_t id_a = table.Insert(1);
+    auto popped = table.pop(id_a);
+    ASSERT_TRUE(popped != table.end());
+    ASSERT_EQ(popped->second, 1u);
+    ASSERT_TRUE(table.find(id_a) == table.end());
+    ASSERT_TRUE(table.pop(id_a) == table.end());
+
+    // The slot is reused, but the old ID must not alias the new object
+    const uint64_t id_b = table.Insert(2);
+    ASSERT_NE(id_a, id_b);
+    ASSERT_TRUE(table.find(id_a) == table.end());
+    ASSERT_EQ(table.find(id_b)->second, 2u);
+}
+
+TEST(CustomContainer, HandleTableTag) {
+    vvl::HandleTable table;
+    const uint64_t id_a = table.Insert(1);
+    ASSERT_FALSE(table.HasTag(id_a, 0x105));
+    table.SetTag(id_a, 0x105);
+    ASSERT_TRUE(table.HasTag(id_a, 0x105));
+    ASSERT_FALSE(table.HasTag(id_a, 0x205));
+    // Only the tag that was set is cleared
+    table.ClearTag(id_a, 0x205);
+    ASSERT_TRUE(table.HasTag(id_a, 0x105));
+    table.ClearTag(id_a, 0x105);
+    ASSERT_FALSE(table.HasTag(id_a, 0x105));
+
+    // The tag doesn't outlive the ID
+    table.SetTag(id_a, 0x105);
+    table.erase(id_a);
+    ASSERT_FALSE(table.HasTag(id_a, 0x105));
+    const uint64_t id_b = table.Insert(2);
+    ASSERT_FALSE(table.HasTag(id_b, 0x105));
+    table.SetTag(id_a, 0x105);
+    ASSERT_FALSE(table.HasTag(id_b, 0x105));
+    ASSERT_FALSE(table.HasTag(0xFFFFFFFFFFFFull, 0x105));
+}
+
+TEST(CustomContainer, HandleTableManyChunks) {
+    vvl::HandleTable table;
+    std::vector<uint64_t> ids;
+    const uint64_t count = vvl::HandleTable::kChunkSize * 3 + 7;
+    for (uint64_t i = 0; i < count; ++i) {
+        ids.emplace_back(table.Insert(i + 100));
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        auto iter = table.find(ids[i]);
+        ASSERT_TRUE(iter != table.end());
+        ASSERT_EQ(iter->second, i + 100);
+    }
+    for (uint64_t i = 0; i < count; i += 2) {
+        table.erase(ids[i]);
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        ASSERT_EQ(table.contains(ids[i]), (i % 2) == 1);
+    }
+}
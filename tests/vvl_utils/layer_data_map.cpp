@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/custom_containers.h"
+
+namespace {
+struct LayerData {
+    uint32_t value = 0;
+};
+}  // namespace
+
+TEST(LayerDataMap, LookupManyKeys) {
+    small_unordered_map<void *, LayerData *, 2> map;
+    uint64_t keys[8] = {};
+    for (uint32_t i = 0; i < 8; ++i) {
+        GetLayerDataPtr(&keys[i], map)->value = i;
+    }
+    // Past the 2 inline entries, and alternating keys so the last lookup of the thread doesn't match
+    for (uint32_t i = 0; i < 8; ++i) {
+        ASSERT_EQ(GetLayerDataPtr(&keys[i], map)->value, i);
+        ASSERT_EQ(GetLayerDataPtr(&keys[i], map)->value, i);
+    }
+    for (uint32_t i = 0; i < 8; ++i) {
+        FreeLayerDataPtr(&keys[i], map);
+    }
+}
+
+TEST(LayerDataMap, ReuseFreedKey) {
+    small_unordered_map<void *, LayerData *, 2> map;
+    uint64_t key = 0;
+    GetLayerDataPtr(&key, map)->value = 1;
+    ASSERT_EQ(GetLayerDataPtr(&key, map)->value, 1u);
+    // A new device can get the dispatch key of a destroyed one, the lookup must not return the freed data
+    FreeLayerDataPtr(&key, map);
+    ASSERT_EQ(GetLayerDataPtr(&key, map)->value, 0u);
+    FreeLayerDataPtr(&key, map);
+}
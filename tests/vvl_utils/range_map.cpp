@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <random>
+
+#include "../framework/test_common.h"
+#include "containers/range_vector.h"
+
+using TreeRangeMap = sparse_container::range_map<uint64_t, uint32_t>;
+using FlatRangeMap = sparse_container::range_map<uint64_t, uint32_t, sparse_container::range<uint64_t>,
+                                                 sparse_container::flat_indexed_range_map<uint64_t, uint32_t>>;
+using Range = sparse_container::range<uint64_t>;
+
+template <typename MapA, typename MapB>
+bool HaveSameEntries(const MapA& a, const MapB& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    auto it_b = b.begin();
+    for (auto it_a = a.begin(); it_a != a.end(); ++it_a, ++it_b) {
+        if (it_a->first != it_b->first || it_a->second != it_b->second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Map>
+void InfillWith(Map& map, const Range& range, uint32_t value) {
+    struct Ops {
+        uint32_t value;
+        void infill(Map& map, const typename Map::iterator& pos, const Range& range) const {
+            map.insert(pos, std::make_pair(range, value));
+        }
+        void update(const typename Map::iterator& pos) const { pos->second += value; }
+    };
+    sparse_container::infill_update_range(map, range, Ops{value});
+}
+
+TEST(CustomContainer, FlatIndexedRangeMapBounds) {
+    FlatRangeMap map;
+    for (uint64_t i = 0; i < 100; ++i) {
+        map.insert(std::make_pair(Range(i * 10, i * 10 + 5), static_cast<uint32_t>(i)));
+    }
+    // Enough lookups to build the index, then check results from the flat path
+    for (int i = 0; i < 8; ++i) {
+        map.find(uint64_t(0));
+    }
+    ASSERT_TRUE(map.get_implementation_map().index_valid());
+
+    ASSERT_EQ(map.find(uint64_t(0))->second, 0u);
+    ASSERT_EQ(map.find(uint64_t(5)), map.end());
+    ASSERT_EQ(map.find(uint64_t(994))->second, 99u);
+    ASSERT_EQ(map.find(uint64_t(995)), map.end());
+    ASSERT_EQ(map.lower_bound(Range(7, 12))->first, Range(10, 15));
+    ASSERT_EQ(map.lower_bound(Range(13, 14))->first, Range(10, 15));
+    ASSERT_EQ(map.lower_bound(Range(2000, 2001)), map.end());
+    ASSERT_EQ(map.upper_bound(Range(10, 20))->first, Range(20, 25));
+    ASSERT_EQ(map.upper_bound(Range(0, 10))->first, Range(10, 15));
+
+    // Any change drops the index
+    map.erase_range(Range(0, 10));
+    ASSERT_FALSE(map.get_implementation_map().index_valid());
+    ASSERT_EQ(map.find(uint64_t(1)), map.end());
+}
+
+TEST(CustomContainer, FlatIndexedRangeMapPrepareConcurrentLookups) {
+    FlatRangeMap map;
+    // Small maps normally never build the index
+    for (uint64_t i = 0; i < 4; ++i) {
+        map.insert(std::make_pair(Range(i * 10, i * 10 + 5), static_cast<uint32_t>(i)));
+    }
+    map.get_implementation_map().prepare_concurrent_lookups();
+    ASSERT_TRUE(map.get_implementation_map().index_valid());
+
+    ASSERT_EQ(map.find(uint64_t(12))->second, 1u);
+    ASSERT_EQ(map.find(uint64_t(16)), map.end());
+    ASSERT_EQ(map.lower_bound(Range(17, 22))->first, Range(20, 25));
+    ASSERT_EQ(map.lower_bound(Range(40, 41)), map.end());
+    ASSERT_TRUE(map.get_implementation_map().index_valid());
+}
+
+TEST(CustomContainer, FlatIndexedRangeMapMatchesTree) {
+    std::mt19937 rng(0x5eed);
+    std::uniform_int_distribution<uint64_t> begin_dist(0, 4096);
+    std::uniform_int_distribution<uint64_t> size_dist(1, 64);
+    std::uniform_int_distribution<int> op_dist(0, 4);
+
+    TreeRangeMap tree;
+    FlatRangeMap flat;
+    for (uint32_t step = 0; step < 4000; ++step) {
+        const uint64_t begin = begin_dist(rng);
+        const Range range(begin, begin + size_dist(rng));
+        switch (op_dist(rng)) {
+            case 0:
+                tree.overwrite_range(std::make_pair(range, step));
+                flat.overwrite_range(std::make_pair(range, step));
+                break;
+            case 1:
+                InfillWith(tree, range, step);
+                InfillWith(flat, range, step);
+                break;
+            case 2:
+                tree.erase_range(range);
+                flat.erase_range(range);
+                break;
+            default: {
+                // Lookup heavy phase, long enough for the flat map to use its index
+                for (uint64_t offset = 0; offset < 16; ++offset) {
+                    const auto tree_it = tree.find(begin + offset);
+                    const auto flat_it = flat.find(begin + offset);
+                    ASSERT_EQ(tree_it == tree.end(), flat_it == flat.end());
+                    if (tree_it != tree.end()) {
+                        ASSERT_EQ(tree_it->first, flat_it->first);
+                    }
+                    const auto tree_lower = tree.lower_bound(range);
+                    const auto flat_lower = flat.lower_bound(range);
+                    ASSERT_EQ(tree_lower == tree.end(), flat_lower == flat.end());
+                    if (tree_lower != tree.end()) {
+                        ASSERT_EQ(tree_lower->first, flat_lower->first);
+                    }
+                    const auto tree_upper = tree.upper_bound(range);
+                    const auto flat_upper = flat.upper_bound(range);
+                    ASSERT_EQ(tree_upper == tree.end(), flat_upper == flat.end());
+                    if (tree_upper != tree.end()) {
+                        ASSERT_EQ(tree_upper->first, flat_upper->first);
+                    }
+                }
+                break;
+            }
+        }
+        ASSERT_TRUE(HaveSameEntries(tree, flat));
+    }
+
+    const FlatRangeMap copy = flat;
+    ASSERT_FALSE(copy.get_implementation_map().index_valid());
+    ASSERT_TRUE(HaveSameEntries(tree, copy));
+}
+
+TEST(CustomContainer, FlatIndexedRangeMapRefillAfterClear) {
+    TreeRangeMap tree;
+    FlatRangeMap flat;
+    // clear() keeps the nodes for the next fill, the refilled content must not see any of the old values
+    for (uint32_t pass = 0; pass < 3; ++pass) {
+        for (uint64_t i = 0; i < 50 + pass * 10; ++i) {
+            tree.insert(std::make_pair(Range(i * 2, i * 2 + 1), static_cast<uint32_t>(i + pass)));
+            flat.insert(std::make_pair(Range(i * 2, i * 2 + 1), static_cast<uint32_t>(i + pass)));
+        }
+        InfillWith(tree, Range(0, 200), pass);
+        InfillWith(flat, Range(0, 200), pass);
+        ASSERT_TRUE(HaveSameEntries(tree, flat));
+        tree.clear();
+        flat.clear();
+        ASSERT_TRUE(flat.empty());
+    }
+}
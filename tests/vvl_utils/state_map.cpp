@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/state_map.h"
+
+#include <thread>
+
+TEST(CustomContainer, StateMapBorrowed) {
+    vvl::ConcurrentStateMap<uint64_t, std::shared_ptr<int>> map;
+    map.insert_or_assign(1, std::make_shared<int>(10));
+    map.insert_or_assign(2, std::make_shared<int>(20));
+    ASSERT_EQ(map.size(), 2u);
+
+    auto iter = map.find(1);
+    ASSERT_TRUE(iter != map.end());
+    ASSERT_EQ(*iter->second, 10);
+    // find() hands out a copy, find_borrowed() doesn't add a reference
+    ASSERT_EQ(iter->second.use_count(), 2);
+    const int *borrowed = map.find_borrowed(2);
+    ASSERT_NE(borrowed, nullptr);
+    ASSERT_EQ(*borrowed, 20);
+    ASSERT_EQ(map.find(2)->second.use_count(), 2);
+    ASSERT_EQ(map.find_borrowed(3), nullptr);
+
+    auto popped = map.pop(2);
+    ASSERT_TRUE(popped != map.end());
+    ASSERT_EQ(popped->second.use_count(), 1);
+    ASSERT_EQ(map.find_borrowed(2), nullptr);
+    ASSERT_EQ(map.snapshot().size(), 1u);
+}
+
+TEST(CustomContainer, StateEpochRetire) {
+    vvl::StateEpoch epoch;
+    std::weak_ptr<int> weak;
+    {
+        vvl::StateEpoch::Guard guard(epoch);
+        auto object = std::make_shared<int>(1);
+        weak = object;
+        epoch.Retire(std::move(object));
+        // Still borrowed by this thread
+        epoch.Reclaim();
+        ASSERT_FALSE(weak.expired());
+    }
+    epoch.Reclaim();
+    ASSERT_TRUE(weak.expired());
+    ASSERT_EQ(epoch.RetiredCount(), 0u);
+}
+
+TEST(CustomContainer, StateEpochOtherThread) {
+    vvl::StateEpoch epoch;
+    std::weak_ptr<int> weak;
+    {
+        auto object = std::make_shared<int>(1);
+        weak = object;
+        // A guard taken after the object was retired doesn't hold it back
+        epoch.Retire(std::move(object));
+    }
+    std::thread reader([&epoch, &weak]() {
+        vvl::StateEpoch::Guard guard(epoch);
+        epoch.Reclaim();
+        ASSERT_TRUE(weak.expired());
+    });
+    reader.join();
+}
+
+TEST(CustomContainer, StateMapBorrowedCache) {
+    vvl::ConcurrentStateMap<uint64_t, std::shared_ptr<int>> map;
+    ASSERT_TRUE(map.empty());
+    map.insert_or_assign(1, std::make_shared<int>(10));
+    // Second lookup is served from the per-thread cache
+    ASSERT_EQ(*map.find_borrowed(1), 10);
+    ASSERT_EQ(*map.find_borrowed(1), 10);
+
+    // Replacing or removing the value must not hand out the old pointer
+    map.insert_or_assign(1, std::make_shared<int>(11));
+    ASSERT_EQ(*map.find_borrowed(1), 11);
+    map.pop(1);
+    ASSERT_EQ(map.find_borrowed(1), nullptr);
+    map.insert_or_assign(1, std::make_shared<int>(12));
+    ASSERT_EQ(*map.find_borrowed(1), 12);
+    map.clear();
+    ASSERT_EQ(map.find_borrowed(1), nullptr);
+    ASSERT_TRUE(map.empty());
+
+    // A map living at the same address as a destroyed one doesn't see its cached entries
+    std::shared_ptr<int> held;
+    {
+        vvl::ConcurrentStateMap<uint64_t, std::shared_ptr<int>> other;
+        held = std::make_shared<int>(20);
+        other.insert_or_assign(2, held);
+        ASSERT_EQ(other.find_borrowed(2), held.get());
+    }
+    {
+        vvl::ConcurrentStateMap<uint64_t, std::shared_ptr<int>> other;
+        ASSERT_EQ(other.find_borrowed(2), nullptr);
+    }
+    ASSERT_GE(map.BucketCount(), 4u);
+}
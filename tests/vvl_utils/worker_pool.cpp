@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/worker_pool.h"
+
+TEST(WorkerPool, RunAllTasks) {
+    vvl::WorkerPool pool(3);
+    std::vector<std::atomic<uint32_t>> runs(16);
+    auto task = [&runs](uint32_t index) { runs[index]++; };
+    pool.Run(static_cast<uint32_t>(runs.size()), task);
+    for (const auto &run : runs) {
+        ASSERT_EQ(run.load(), 1u);
+    }
+}
+
+TEST(WorkerPool, DestroyUnused) {
+    // The workers are only started by the first job, these pools never start any
+    for (int i = 0; i < 100; ++i) {
+        vvl::WorkerPool pool(4);
+        ASSERT_EQ(pool.WorkerCount(), 4u);
+    }
+    // A job of a single task runs on the calling thread and doesn't need the workers either
+    vvl::WorkerPool pool(2);
+    uint32_t runs = 0;
+    auto task = [&runs](uint32_t) { runs++; };
+    pool.Run(1, task);
+    ASSERT_EQ(runs, 1u);
+}
+
+TEST(WorkerPool, FirstTaskOnCallingThread) {
+    vvl::WorkerPool pool(2);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::thread::id first_task_thread;
+    auto task = [&](uint32_t index) {
+        if (index == 0) {
+            first_task_thread = std::this_thread::get_id();
+        }
+    };
+    for (int i = 0; i < 100; ++i) {
+        pool.Run(4, task);
+        ASSERT_EQ(first_task_thread, caller);
+    }
+}
+
+TEST(WorkerPool, ConcurrentCallers) {
+    vvl::WorkerPool pool(2);
+    std::atomic<uint32_t> total{0};
+    auto caller = [&pool, &total]() {
+        for (int i = 0; i < 1000; ++i) {
+            auto task = [&total](uint32_t index) { total += index + 1; };
+            pool.Run(4, task);
+        }
+    };
+    std::thread thread_a(caller);
+    std::thread thread_b(caller);
+    thread_a.join();
+    thread_b.join();
+    ASSERT_EQ(total.load(), 2u * 1000u * 10u);
+}
+
+TEST(WorkerPool, PostedTasksRunOnWorkers) {
+    std::atomic<uint32_t> runs{0};
+    std::atomic<bool> ran_on_caller{false};
+    const std::thread::id caller = std::this_thread::get_id();
+    {
+        vvl::WorkerPool pool(2);
+        for (int i = 0; i < 64; ++i) {
+            pool.Post([&]() {
+                if (std::this_thread::get_id() == caller) {
+                    ran_on_caller = true;
+                }
+                runs++;
+            });
+        }
+        // Blocking jobs still complete while posted tasks are queued
+        std::atomic<uint32_t> total{0};
+        auto task = [&total](uint32_t index) { total += index + 1; };
+        pool.Run(4, task);
+        ASSERT_EQ(total.load(), 10u);
+    }
+    // Destroying the pool runs whatever was still queued
+    ASSERT_EQ(runs.load(), 64u);
+    ASSERT_FALSE(ran_on_caller.load());
+}
+
+TEST(WorkerPool, SharedPool) {
+    std::shared_ptr<vvl::WorkerPool> first = vvl::WorkerPool::Shared(1);
+    std::shared_ptr<vvl::WorkerPool> second = vvl::WorkerPool::Shared(3);
+    ASSERT_EQ(first, second);
+    // Grows to the largest count asked for, never shrinks
+    ASSERT_EQ(first->WorkerCount(), 3u);
+    ASSERT_EQ(vvl::WorkerPool::Shared(2)->WorkerCount(), 3u);
+
+    std::weak_ptr<vvl::WorkerPool> weak = first;
+    first.reset();
+    second.reset();
+    // Released with its last user
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(WorkerPool, TaskGroupWait) {
+    std::shared_ptr<vvl::WorkerPool> pool = vvl::WorkerPool::Shared(2);
+    std::atomic<uint32_t> group_runs{0};
+    std::atomic<uint32_t> other_runs{0};
+    vvl::TaskGroup group;
+    for (int i = 0; i < 32; ++i) {
+        pool->Post([&group_runs]() { group_runs++; }, group);
+        pool->Post([&other_runs]() { other_runs++; });
+    }
+    group.Wait();
+    ASSERT_EQ(group_runs.load(), 32u);
+    // The pool is still alive, the tasks of the other owners run whenever they run
+    pool.reset();
+    ASSERT_EQ(other_runs.load(), 32u);
+}